@@ -33,6 +33,7 @@ static uint32_t emuFeatures;
 static bool     useJoystickAsMouse;
 static float    touchCursorX;
 static float    touchCursorY;
+static bool     saveRamMapped;
 
 
 static void renderMouseCursor(int16_t screenX, int16_t screenY){
@@ -359,7 +360,8 @@ bool retro_load_game(const struct retro_game_info *info){
    //save RAM
    strlcpy(saveRamPath, saveDir, PATH_MAX_LENGTH);
    strlcat(saveRamPath, "/userdata-en-m515.ram", PATH_MAX_LENGTH);
-   saveRamFile = filestream_open(saveRamPath, RETRO_VFS_FILE_ACCESS_READ, RETRO_VFS_FILE_ACCESS_HINT_NONE);
+   saveRamMapped = emulatorMapRamFile(saveRamPath) == EMU_ERROR_NONE;
+   saveRamFile = saveRamMapped ? NULL : filestream_open(saveRamPath, RETRO_VFS_FILE_ACCESS_READ, RETRO_VFS_FILE_ACCESS_HINT_NONE);
    
    if(saveRamFile){
       if(filestream_get_size(saveRamFile) == emulatorGetRamSize()){
@@ -388,7 +390,12 @@ void retro_unload_game(void){
    
    environ_cb(RETRO_ENVIRONMENT_GET_SAVE_DIRECTORY, &saveDir);
    
-   //save RAM
+   //save RAM, a mapped RAM file is already up to date and just needs to be flushed
+   if(saveRamMapped){
+      emulatorFlushRamFile();
+      emulatorExit();
+      return;
+   }
    strlcpy(saveRamPath, saveDir, PATH_MAX_LENGTH);
    strlcat(saveRamPath, "/userdata-en-m515.ram", PATH_MAX_LENGTH);
    saveRamFile = filestream_open(saveRamPath, RETRO_VFS_FILE_ACCESS_WRITE, RETRO_VFS_FILE_ACCESS_HINT_NONE);
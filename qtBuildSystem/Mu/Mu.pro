@@ -44,6 +44,11 @@ linux-g++{
     DEFINES += EMU_MULTITHREADED
 }
 
+linux{
+    # the userdata RAM file can only be mapped as palmRam with RAM in Palm byte order
+    DEFINES += EMU_BIG_ENDIAN_MEMORY
+}
+
 android{
     QMAKE_CFLAGS += -fopenmp
     QMAKE_CXXFLAGS += -fopenmp
@@ -59,7 +64,7 @@ ios{
 
 CONFIG(debug, debug|release){
     # debug build, be accurate, fail hard, and add logging
-    DEFINES += EMU_DEBUG EMU_CUSTOM_DEBUG_LOG_HANDLER EMU_SANDBOX
+    DEFINES += EMU_DEBUG EMU_CUSTOM_DEBUG_LOG_HANDLER EMU_SANDBOX EMU_BUS_STATISTICS
     # DEFINES += EMU_SANDBOX_OPCODE_LEVEL_DEBUG # for breakpoints
     macx|linux-g++{
         # DEFINES += EMU_SANDBOX_OPCODE_LEVEL_DEBUG
@@ -99,10 +104,12 @@ SOURCES += \
     ../../src/silkscreen.c \
     ../../src/m68k/m68kcpu.c \
     ../../src/m68k/m68kdasm.c \
+    ../../src/m68k/m68kjit.c \
     ../../src/m68k/m68kopac.c \
     ../../src/m68k/m68kopdm.c \
     ../../src/m68k/m68kopnz.c \
     ../../src/m68k/m68kops.c \
+    ../../src/m68k/m68kthreaded.c \
     ../../src/armv5/CPU.c \
     ../../src/armv5/icache.c \
     ../../src/armv5.c
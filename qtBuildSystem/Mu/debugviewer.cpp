@@ -6,10 +6,12 @@
 #include <QDir>
 
 #include <vector>
+#include <algorithm>
 #include <stdint.h>
 
 #include "mainwindow.h"
 #include "emuwrapper.h"
+#include "../../src/hardwareRegisters.h"
 
 
 DebugViewer::DebugViewer(QWidget* parent) :
@@ -62,6 +64,30 @@ QString DebugViewer::stringFromNumber(int64_t number, bool hex, uint32_t forcedZ
    return numString;
 }
 
+void DebugViewer::addWatchpoint(uint8_t type){
+   //watches Length entries of the selected size starting at Address, a value makes it only stop when that value is read or written
+   EmuWrapper& emu = ((MainWindow*)parentWidget())->emu;
+   int64_t address = numberFromString(ui->debugAddress->text(), false/*negative allowed*/);
+   int64_t length = numberFromString(ui->debugLength->text(), false/*negative allowed*/);
+   int64_t value = ui->debugWatchpointValue->text() != "" ? numberFromString(ui->debugWatchpointValue->text(), false/*negative allowed*/) : -1;
+
+   ui->debugValueList->clear();
+
+   if(address != INT64_MIN && length != INT64_MIN && length != 0 && address + bitsPerEntry / 8 * length - 1 <= 0xFFFFFFFF && value != INT64_MIN && value <= 0xFFFFFFFF){
+      uint32_t error = emu.addWatchpoint(address, bitsPerEntry / 8 * length, type | (value >= 0 ? WATCHPOINT_VALUE : 0), value >= 0 ? value : 0);
+
+      if(error == EMU_ERROR_NONE)
+         ui->debugValueList->addItem("Watching " + stringFromNumber(address, true, 8) + "<->" + stringFromNumber(address + bitsPerEntry / 8 * length - 1, true, 8));
+      else if(error == EMU_ERROR_OUT_OF_MEMORY)
+         ui->debugValueList->addItem("All Watchpoints Are In Use");
+      else
+         ui->debugValueList->addItem("Invalid Parameters");
+   }
+   else{
+      ui->debugValueList->addItem("Invalid Parameters");
+   }
+}
+
 void DebugViewer::debugRadioButtonHandler(){
    switch(bitsPerEntry){
       case 8:
@@ -193,3 +219,78 @@ void DebugViewer::on_debugEraseDebugLogs_clicked(){
    emu.getDebugStrings().clear();
    emu.getDuplicateCallCount().clear();
 }
+
+void DebugViewer::on_debugWatchReads_clicked(){
+   addWatchpoint(WATCHPOINT_READ);
+}
+
+void DebugViewer::on_debugWatchWrites_clicked(){
+   addWatchpoint(WATCHPOINT_WRITE);
+}
+
+void DebugViewer::on_debugClearWatchpoints_clicked(){
+   ((MainWindow*)parentWidget())->emu.clearWatchpoints();
+   ui->debugValueList->clear();
+}
+
+void DebugViewer::on_debugShowWatchpointHit_clicked(){
+   EmuWrapper& emu = ((MainWindow*)parentWidget())->emu;
+   watchpoint_hit_t hit;
+
+   ui->debugValueList->clear();
+   if(emu.getWatchpointHit(hit)){
+      ui->debugValueList->addItem("Watchpoint:" + stringFromNumber(hit.watchpoint, false, 0));
+      ui->debugValueList->addItem(QString(hit.write ? "Write" : "Read") + ":" + stringFromNumber(hit.size, false, 0) + "bit");
+      ui->debugValueList->addItem("Address:" + stringFromNumber(hit.address, true, 8));
+      ui->debugValueList->addItem("Value:" + stringFromNumber(hit.value, true, hit.size / 4));
+      ui->debugValueList->addItem("PC:" + stringFromNumber(hit.pc, true, 8));
+   }
+   else{
+      ui->debugValueList->addItem("No Watchpoint Hit");
+   }
+}
+
+void DebugViewer::on_debugShowBusStatistics_clicked(){
+   //Length is how many of the most used hardware registers to show
+   EmuWrapper& emu = ((MainWindow*)parentWidget())->emu;
+   const char* chipNames[BUS_STATISTICS_CHIPS] = {"ROM", "USB", "SED1376", "RAM", "EMU", "Registers", "Unmapped"};
+   int64_t length = numberFromString(ui->debugLength->text(), false/*negative allowed*/);
+   bus_statistics_t* statistics = new bus_statistics_t;
+   std::vector<uint32_t> registers;
+
+   ui->debugValueList->clear();
+
+   if(!emu.getBusStatistics(*statistics, false)){
+      ui->debugValueList->addItem("Not Built With EMU_BUS_STATISTICS");
+      delete statistics;
+      return;
+   }
+
+   for(uint8_t chip = CHIP_BEGIN; chip < BUS_STATISTICS_CHIPS; chip++){
+      const bus_counter_t& counter = statistics->chip[chip];
+
+      ui->debugValueList->addItem(QString(chipNames[chip]) + " Reads 8/16/32:" + stringFromNumber(counter.reads[0], false) + "/" + stringFromNumber(counter.reads[1], false) + "/" + stringFromNumber(counter.reads[2], false));
+      ui->debugValueList->addItem(QString(chipNames[chip]) + " Writes 8/16/32:" + stringFromNumber(counter.writes[0], false) + "/" + stringFromNumber(counter.writes[1], false) + "/" + stringFromNumber(counter.writes[2], false));
+   }
+
+   for(uint32_t offset = 0; offset < REG_SIZE; offset++)
+      if(statistics->registerReads[offset] || statistics->registerWrites[offset])
+         registers.push_back(offset);
+   std::sort(registers.begin(), registers.end(), [statistics](uint32_t a, uint32_t b){
+      return statistics->registerReads[a] + statistics->registerWrites[a] > statistics->registerReads[b] + statistics->registerWrites[b];
+   });
+   if(length != INT64_MIN && length > 0 && (uint64_t)length < registers.size())
+      registers.resize(length);
+   for(uint32_t offset : registers)
+      ui->debugValueList->addItem(stringFromNumber(REG_START_ADDRESS + offset, true, 8) + " Reads:" + stringFromNumber(statistics->registerReads[offset], false) + " Writes:" + stringFromNumber(statistics->registerWrites[offset], false));
+
+   delete statistics;
+}
+
+void DebugViewer::on_debugResetBusStatistics_clicked(){
+   bus_statistics_t* statistics = new bus_statistics_t;
+
+   ((MainWindow*)parentWidget())->emu.getBusStatistics(*statistics, true);
+   ui->debugValueList->clear();
+   delete statistics;
+}
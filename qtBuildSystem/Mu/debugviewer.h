@@ -19,6 +19,7 @@ public:
 private:
    int64_t numberFromString(QString str, bool negativeAllowed);
    QString stringFromNumber(int64_t number, bool hex, uint32_t forcedZeros = 0);
+   void addWatchpoint(uint8_t type);
 
 private slots:
    void debugRadioButtonHandler();
@@ -34,6 +35,12 @@ private slots:
    void on_debugShowRegisters_clicked();
    void on_debugPrintDebugLogs_clicked();
    void on_debugEraseDebugLogs_clicked();
+   void on_debugWatchReads_clicked();
+   void on_debugWatchWrites_clicked();
+   void on_debugClearWatchpoints_clicked();
+   void on_debugShowWatchpointHit_clicked();
+   void on_debugShowBusStatistics_clicked();
+   void on_debugResetBusStatistics_clicked();
 
 private:
    uint8_t          bitsPerEntry;
@@ -64,6 +64,8 @@ EmuWrapper::EmuWrapper(){
    alreadyExists = true;
 
    emuInited = false;
+   emuRamFileMapped = false;
+   emuWatchpointWasHit = false;
    emuThreadJoin = false;
    emuRunning = false;
    emuPaused = false;
@@ -91,6 +93,12 @@ void EmuWrapper::emuThreadRun(){
             palmInput = emuInput;
             emulatorRunFrame();
             emuNewFrameReady = true;
+
+            //stop on a watchpoint so the debugger can look at the state
+            if(emulatorGetWatchpointHit(&emuWatchpointHit)){
+               emuWatchpointWasHit = true;
+               emuRunning = false;
+            }
          }
       }
       else{
@@ -146,7 +154,11 @@ uint32_t EmuWrapper::init(const QString& romPath, const QString& bootloaderPath,
 
          emulatorSetRtc(QDate::currentDate().day(), now.hour(), now.minute(), now.second());
 
-         if(ramPath != ""){
+         emuRamFileMapped = false;
+         if(ramPath != "")
+            emuRamFileMapped = emulatorMapRamFile(ramPath.toStdString().c_str()) == EMU_ERROR_NONE;
+
+         if(ramPath != "" && !emuRamFileMapped){
             QFile ramFile(ramPath);
 
             if(ramFile.exists()){
@@ -212,7 +224,11 @@ void EmuWrapper::exit(){
    if(emuThread.joinable())
       emuThread.join();
    if(emuInited){
-      if(emuRamFilePath != ""){
+      if(emuRamFileMapped){
+         //the RAM file is palmRam, it just needs to be flushed
+         emulatorFlushRamFile();
+      }
+      else if(emuRamFilePath != ""){
          QFile ramFile(emuRamFilePath);
          buffer_t emuRam;
          emuRam.size = emulatorGetRamSize();
@@ -357,6 +373,70 @@ std::vector<uint32_t> EmuWrapper::getCpuRegisters(){
    return registers;
 }
 
+uint32_t EmuWrapper::addWatchpoint(uint32_t address, uint32_t size, uint8_t type, uint32_t value){
+   bool wasPaused = isPaused();
+   uint32_t error = EMU_ERROR_OUT_OF_MEMORY;
+
+   if(!wasPaused)
+      pause();
+
+   for(uint8_t index = 0; index < EMU_WATCHPOINTS; index++){
+      if(!emulatorGetWatchpoint(index).type){
+         watchpoint_t watchpoint;
+
+         watchpoint.type = type;
+         watchpoint.address = address;
+         watchpoint.size = size;
+         watchpoint.value = value;
+         error = emulatorSetWatchpoint(index, watchpoint);
+         break;
+      }
+   }
+
+   if(!wasPaused)
+      resume();
+
+   return error;
+}
+
+void EmuWrapper::clearWatchpoints(){
+   bool wasPaused = isPaused();
+   watchpoint_t unused = {0, 0, 0, 0};
+
+   if(!wasPaused)
+      pause();
+
+   for(uint8_t index = 0; index < EMU_WATCHPOINTS; index++)
+      emulatorSetWatchpoint(index, unused);
+
+   if(!wasPaused)
+      resume();
+}
+
+bool EmuWrapper::getWatchpointHit(watchpoint_hit_t& hit){
+   if(!emuWatchpointWasHit)
+      return false;
+
+   hit = emuWatchpointHit;
+   emuWatchpointWasHit = false;
+   return true;
+}
+
+bool EmuWrapper::getBusStatistics(bus_statistics_t& statistics, bool reset){
+   bool wasPaused = isPaused();
+   bool success;
+
+   if(!wasPaused)
+      pause();
+
+   success = emulatorGetBusStatistics(&statistics, reset);
+
+   if(!wasPaused)
+      resume();
+
+   return success;
+}
+
 uint64_t EmuWrapper::getEmulatorMemory(uint32_t address, uint8_t size){
    return flx68000ReadArbitraryMemory(address, size);
 }
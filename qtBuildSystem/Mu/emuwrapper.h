@@ -23,7 +23,10 @@ private:
    std::atomic<bool> emuPaused;
    std::atomic<bool> emuNewFrameReady;
    QString           emuRamFilePath;
+   bool              emuRamFileMapped;
    QString           emuSdCardFilePath;
+   std::atomic<bool> emuWatchpointWasHit;
+   watchpoint_hit_t  emuWatchpointHit;
 
    void emuThreadRun();
 
@@ -48,6 +51,10 @@ public:
    std::vector<QString>& getDebugStrings();
    std::vector<uint64_t>& getDuplicateCallCount();
    std::vector<uint32_t> getCpuRegisters();
+   uint32_t addWatchpoint(uint32_t address, uint32_t size, uint8_t type, uint32_t value = 0);
+   void clearWatchpoints();
+   bool getWatchpointHit(watchpoint_hit_t& hit);//true = emulation was paused by a watchpoint since the last call
+   bool getBusStatistics(bus_statistics_t& statistics, bool reset);//false if the emulator wasnt built with EMU_BUS_STATISTICS
 
    uint16_t screenWidth() const{return palmFramebufferWidth;}
    uint16_t screenHeight() const{return palmFramebufferHeight;}
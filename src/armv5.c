@@ -19,6 +19,8 @@ static ArmCpu armv5Cpu;
 static Boolean armv5MemoryAccess(ArmCpu* cpu, void* buf, UInt32 vaddr, UInt8 size, Boolean write, Boolean privileged, UInt8* fsr){
    //ARM only has access to RAM, the OS 4 ROM has no data important to it and it would be wrong to access 68k registers from ARM
    vaddr &= chips[CHIP_DX_RAM].mask;
+   if(write)
+      MARK_RAM_DIRTY(vaddr);
 
 #if !defined(EMU_NO_SAFETY)
    if(size & (size - 1) || vaddr & (size - 1))//size is not a power of two or address isnt aligned to size
@@ -58,6 +60,44 @@ static Boolean armv5MemoryAccess(ArmCpu* cpu, void* buf, UInt32 vaddr, UInt8 siz
             *(uint32_t*)buf = SWAP_32(*(uint32_t*)(palmRam + vaddr));
             return true;
 
+         default:
+            return false;
+      }
+   }
+#elif defined(EMU_BIG_ENDIAN_MEMORY)
+   //RAM is in Palm byte order and ARM data is little endian like the host, no swapping needed
+   if(write){
+      switch(size){
+         case 1:
+            *(uint8_t*)(palmRam + vaddr) = *(uint8_t*)buf;
+            return true;
+
+         case 2:
+            *(uint16_t*)(palmRam + vaddr) = *(uint16_t*)buf;
+            return true;
+
+         case 4:
+            writeUnaligned32(palmRam + vaddr, *(uint32_t*)buf);
+            return true;
+
+         default:
+            return false;
+      }
+   }
+   else{
+      switch(size){
+         case 1:
+            *(uint8_t*)buf = *(uint8_t*)(palmRam + vaddr);
+            return true;
+
+         case 2:
+            *(uint16_t*)buf = *(uint16_t*)(palmRam + vaddr);
+            return true;
+
+         case 4:
+            *(uint32_t*)buf = readUnaligned32(palmRam + vaddr);
+            return true;
+
          default:
             return false;
       }
@@ -32,6 +32,7 @@
 
 
 static bool emulatorInitialized = false;
+static bool emulatorRamFileMapped = false;
 
 uint8_t*  palmRam;
 uint8_t*  palmRom;
@@ -45,11 +46,62 @@ uint16_t  palmFramebufferWidth;
 uint16_t  palmFramebufferHeight;
 int16_t*  palmAudio;
 blip_t*   palmAudioResampler;
-double    palmSysclksPerClk32;//how many SYSCLK cycles before toggling the 32.768 kHz crystal
-double    palmCycleCounter;//can be greater then 0 if too many cycles where run
-double    palmClockMultiplier;//used by the emulator to overclock the emulated Palm
+uint64_t  palmSysclksPerClk32;//how many SYSCLK cycles before toggling the 32.768 kHz crystal, 32.32 fixed point
+int64_t   palmCycleCounter;//in 1 / EMU_FPS CLK32s so a frame is exactly CRYSTAL_FREQUENCY, can be greater then 0 if too many cycles where run
+uint64_t  palmClockMultiplier;//used by the emulator to overclock the emulated Palm, 32.32 fixed point
 uint32_t  palmFrameClk32s;//how many CLK32s have happened in the current frame
-double    palmClk32Sysclks;//how many SYSCLKs have happened in the current CLK32
+uint32_t  palmFrameIrqChecksSkipped;//how many interrupt checks in the current frame found the CPU already had the right level
+uint32_t  palmFrameIdleLoopsSkipped;//how many timeslices in the current frame where ended by a polling loop
+uint32_t  palmFrameTimeslices;//how many times the current frame called flx68000Execute()
+uint64_t  palmClk32Sysclks;//how many SYSCLKs have happened in the current CLK32, 32.32 fixed point
+
+
+static void clearRam(uint64_t size){
+   //dropping the pages of a mapped file would just reload them from the file, so only the pages that are not already zero are cleared by hand
+   uint64_t offset;
+
+   if(!emulatorRamFileMapped){
+      zeroLazyBuffer(palmRam, size);
+      return;
+   }
+
+   for(offset = 0; offset < size; offset += DIRTY_RAM_PAGE_SIZE)
+      if(!bufferIsZero(palmRam + offset, u64Min(size - offset, DIRTY_RAM_PAGE_SIZE)))
+         memset(palmRam + offset, 0x00, u64Min(size - offset, DIRTY_RAM_PAGE_SIZE));
+}
+
+static void saveRamPages(uint8_t* data, uint64_t size){
+   //pages that have never been written are still zero and dont need to be copied, this keeps them and the zero pages of the destination uncommitted
+   uint64_t offset;
+
+   for(offset = 0; offset < size; offset += DIRTY_RAM_PAGE_SIZE){
+      uint64_t length = u64Min(size - offset, DIRTY_RAM_PAGE_SIZE);
+
+      if(!bufferIsZero(palmRam + offset, length)){
+         memcpy(data + offset, palmRam + offset, length);
+         swap16BufferIfLittle(data + offset, length / sizeof(uint16_t));
+      }
+      else if(!bufferIsZero(data + offset, length)){
+         memset(data + offset, 0x00, length);
+      }
+   }
+}
+
+static void loadRamPages(const uint8_t* data, uint64_t size){
+   //clear RAM then only copy in the pages that have something in them
+   uint64_t offset;
+
+   clearRam(size);
+   for(offset = 0; offset < size; offset += DIRTY_RAM_PAGE_SIZE){
+      uint64_t length = u64Min(size - offset, DIRTY_RAM_PAGE_SIZE);
+
+      if(!bufferIsZero(data + offset, length)){
+         memcpy(palmRam + offset, data + offset, length);
+         swap16BufferIfLittle(palmRam + offset, length / sizeof(uint16_t));
+      }
+   }
+   markRamRangeDirty(0, size);
+}
 
 
 uint32_t emulatorInit(buffer_t palmRomDump, buffer_t palmBootDump, uint32_t enabledEmuFeatures){
@@ -59,15 +111,15 @@ uint32_t emulatorInit(buffer_t palmRomDump, buffer_t palmBootDump, uint32_t enab
    if(!palmRomDump.data)
       return EMU_ERROR_INVALID_PARAMETER;
 
-   //allocate buffers, add 4 to memory regions to prevent SIGSEGV from accessing off the end
-   palmRam = malloc(((enabledEmuFeatures & FEATURE_RAM_HUGE) ? SUPERMASSIVE_RAM_SIZE : RAM_SIZE) + 4);
+   //allocate buffers, add 4 to memory regions to prevent SIGSEGV from accessing off the end, RAM starts out zeroed and is only committed when used
+   palmRam = allocateLazyBuffer(((enabledEmuFeatures & FEATURE_RAM_HUGE) ? SUPERMASSIVE_RAM_SIZE : RAM_SIZE) + 4);
    palmRom = malloc(ROM_SIZE + 4);
    palmReg = malloc(REG_SIZE + 4);
    palmFramebuffer = malloc(480 * 480 * sizeof(uint16_t));
    palmAudio = malloc(AUDIO_SAMPLES_PER_FRAME * 2 * sizeof(int16_t));
    palmAudioResampler = blip_new(AUDIO_SAMPLE_RATE);//have 1 second of samples
    if(!palmRam || !palmRom || !palmReg || !palmFramebuffer || !palmAudio || !palmAudioResampler){
-      free(palmRam);
+      freeLazyBuffer(palmRam, ((enabledEmuFeatures & FEATURE_RAM_HUGE) ? SUPERMASSIVE_RAM_SIZE : RAM_SIZE) + 4);
       free(palmRom);
       free(palmReg);
       free(palmFramebuffer);
@@ -77,7 +129,7 @@ uint32_t emulatorInit(buffer_t palmRomDump, buffer_t palmBootDump, uint32_t enab
    }
 
    //set default values
-   memset(palmRam, 0x00, enabledEmuFeatures & FEATURE_RAM_HUGE ? SUPERMASSIVE_RAM_SIZE : RAM_SIZE);
+   markRamRangeDirty(0, enabledEmuFeatures & FEATURE_RAM_HUGE ? SUPERMASSIVE_RAM_SIZE : RAM_SIZE);
    memcpy(palmRom, palmRomDump.data, u64Min(palmRomDump.size, ROM_SIZE));
    if(palmRomDump.size < ROM_SIZE)
       memset(palmRom + palmRomDump.size, 0x00, ROM_SIZE - palmRomDump.size);
@@ -98,8 +150,8 @@ uint32_t emulatorInit(buffer_t palmRomDump, buffer_t palmBootDump, uint32_t enab
    palmFramebufferWidth = 160;
    palmFramebufferHeight = 220;
    palmMisc.batteryLevel = 100;
-   palmCycleCounter = 0.0;
-   palmClockMultiplier = 1.00 - EMU_CPU_PERCENT_WAITING;
+   palmCycleCounter = 0;
+   palmClockMultiplier = DEFAULT_CLOCK_MULTIPLIER;
    palmEmuFeatures.info = enabledEmuFeatures;
 
    //initialize components
@@ -127,24 +179,28 @@ uint32_t emulatorInit(buffer_t palmRomDump, buffer_t palmBootDump, uint32_t enab
 
 void emulatorExit(void){
    if(emulatorInitialized){
-      free(palmRam);
+      if(emulatorRamFileMapped)
+         flushMappedFile(palmRam, emulatorGetRamSize());
+      freeLazyBuffer(palmRam, emulatorGetRamSize() + 4);
       free(palmRom);
       free(palmReg);
       free(palmFramebuffer);
       free(palmAudio);
       blip_delete(palmAudioResampler);
       free(palmSdCard.flashChip.data);
+      emulatorRamFileMapped = false;
       emulatorInitialized = false;
    }
 }
 
 void emulatorHardReset(void){
-   //equivalent to taking the battery out and putting it back in
-   memset(palmRam, 0x00, palmEmuFeatures.info & FEATURE_RAM_HUGE ? SUPERMASSIVE_RAM_SIZE : RAM_SIZE);
+   //equivalent to taking the battery out and putting it back in, gives the RAM pages back to the host instead of writing zeros to them
+   clearRam(palmEmuFeatures.info & FEATURE_RAM_HUGE ? SUPERMASSIVE_RAM_SIZE : RAM_SIZE);
+   markRamRangeDirty(0, palmEmuFeatures.info & FEATURE_RAM_HUGE ? SUPERMASSIVE_RAM_SIZE : RAM_SIZE);
    palmFramebufferWidth = 160;
    palmFramebufferHeight = 220;
    palmEmuFeatures.value = 0x00000000;
-   palmClockMultiplier = 1.00 - EMU_CPU_PERCENT_WAITING;
+   palmClockMultiplier = DEFAULT_CLOCK_MULTIPLIER;
    sed1376Reset();
    ads7846Reset();
    pdiUsbD12Reset();
@@ -160,7 +216,7 @@ void emulatorSoftReset(void){
    palmFramebufferWidth = 160;
    palmFramebufferHeight = 220;
    palmEmuFeatures.value = 0x00000000;
-   palmClockMultiplier = 1.00 - EMU_CPU_PERCENT_WAITING;
+   palmClockMultiplier = DEFAULT_CLOCK_MULTIPLIER;
    sed1376Reset();
    ads7846Reset();
    pdiUsbD12Reset();
@@ -195,9 +251,10 @@ uint64_t emulatorGetStateSize(void){
    size += TOTAL_MEMORY_BANKS;//bank handlers
    size += sizeof(uint32_t) * 4 * CHIP_END;//chip select states
    size += sizeof(uint8_t) * 5 * CHIP_END;//chip select states
-   size += sizeof(uint64_t) * 5;//32.32 fixed point double, timerXCycleCounter and CPU cycle timers
+   size += sizeof(uint64_t) * 5;//32.32 fixed point, timerXCycleCounter and CPU cycle timers
    size += sizeof(int8_t);//pllSleepWait
    size += sizeof(int8_t);//pllWakeWait
+   size += sizeof(uint8_t);//registerPollClk32s
    size += sizeof(uint32_t);//clk32Counter
    size += sizeof(uint64_t);//pctlrCpuClockDivider
    size += sizeof(uint16_t) * 2;//timerStatusReadAcknowledge
@@ -219,11 +276,15 @@ uint64_t emulatorGetStateSize(void){
 
 bool emulatorSaveState(buffer_t buffer){
    uint64_t offset = 0;
+   uint32_t bank;
    uint8_t index;
 
    if(buffer.size < emulatorGetStateSize())
       return false;//state cant fit
 
+   //timers are only updated when something looks at them
+   updateTimers();
+
    //state validation, wont load states that are not from the same state version
    writeStateValue32(buffer.data + offset, SAVE_STATE_VERSION);
    offset += sizeof(uint32_t);
@@ -258,19 +319,19 @@ bool emulatorSaveState(buffer_t buffer){
 
    //memory
    if(palmEmuFeatures.info & FEATURE_RAM_HUGE){
-      memcpy(buffer.data + offset, palmRam, SUPERMASSIVE_RAM_SIZE);
-      swap16BufferIfLittle(buffer.data + offset, SUPERMASSIVE_RAM_SIZE / sizeof(uint16_t));
+      saveRamPages(buffer.data + offset, SUPERMASSIVE_RAM_SIZE);
       offset += SUPERMASSIVE_RAM_SIZE;
    }
    else{
-      memcpy(buffer.data + offset, palmRam, RAM_SIZE);
-      swap16BufferIfLittle(buffer.data + offset, RAM_SIZE / sizeof(uint16_t));
+      saveRamPages(buffer.data + offset, RAM_SIZE);
       offset += RAM_SIZE;
    }
    memcpy(buffer.data + offset, palmReg, REG_SIZE);
    swap16BufferIfLittle(buffer.data + offset, REG_SIZE / sizeof(uint16_t));
    offset += REG_SIZE;
    memcpy(buffer.data + offset, bankType, TOTAL_MEMORY_BANKS);
+   for(bank = 0; bank < TOTAL_MEMORY_BANKS; bank++)
+      buffer.data[offset + bank] &= ~BANK_WATCHED;//watchpoints belong to the debugger, not the state
    offset += TOTAL_MEMORY_BANKS;
    for(index = CHIP_BEGIN; index < CHIP_END; index++){
       writeStateValue8(buffer.data + offset, chips[index].enable);
@@ -294,23 +355,25 @@ bool emulatorSaveState(buffer_t buffer){
    }
 
    //timing
-   writeStateValueDouble(buffer.data + offset, palmSysclksPerClk32);
+   writeStateValue64(buffer.data + offset, palmSysclksPerClk32);
    offset += sizeof(uint64_t);
-   writeStateValueDouble(buffer.data + offset, palmCycleCounter);
+   writeStateValue64(buffer.data + offset, palmCycleCounter);
    offset += sizeof(uint64_t);
-   writeStateValueDouble(buffer.data + offset, palmClockMultiplier);
+   writeStateValue64(buffer.data + offset, palmClockMultiplier);
    offset += sizeof(uint64_t);
    writeStateValue8(buffer.data + offset, pllSleepWait);
    offset += sizeof(int8_t);
    writeStateValue8(buffer.data + offset, pllWakeWait);
    offset += sizeof(int8_t);
+   writeStateValue8(buffer.data + offset, registerPollClk32s);
+   offset += sizeof(uint8_t);
    writeStateValue32(buffer.data + offset, clk32Counter);
    offset += sizeof(uint32_t);
-   writeStateValueDouble(buffer.data + offset, pctlrCpuClockDivider);
+   writeStateValue64(buffer.data + offset, pctlrCpuClockDivider);
    offset += sizeof(uint64_t);
-   writeStateValueDouble(buffer.data + offset, timerCycleCounter[0]);
+   writeStateValue64(buffer.data + offset, timerCycleCounter[0]);
    offset += sizeof(uint64_t);
-   writeStateValueDouble(buffer.data + offset, timerCycleCounter[1]);
+   writeStateValue64(buffer.data + offset, timerCycleCounter[1]);
    offset += sizeof(uint64_t);
    writeStateValue16(buffer.data + offset, timerStatusReadAcknowledge[0]);
    offset += sizeof(uint16_t);
@@ -441,13 +504,11 @@ bool emulatorLoadState(buffer_t buffer){
 
    //memory
    if(palmEmuFeatures.info & FEATURE_RAM_HUGE){
-      memcpy(palmRam, buffer.data + offset, SUPERMASSIVE_RAM_SIZE);
-      swap16BufferIfLittle(palmRam, SUPERMASSIVE_RAM_SIZE / sizeof(uint16_t));
+      loadRamPages(buffer.data + offset, SUPERMASSIVE_RAM_SIZE);
       offset += SUPERMASSIVE_RAM_SIZE;
    }
    else{
-      memcpy(palmRam, buffer.data + offset, RAM_SIZE);
-      swap16BufferIfLittle(palmRam, RAM_SIZE / sizeof(uint16_t));
+      loadRamPages(buffer.data + offset, RAM_SIZE);
       offset += RAM_SIZE;
    }
    memcpy(palmReg, buffer.data + offset, REG_SIZE);
@@ -477,23 +538,25 @@ bool emulatorLoadState(buffer_t buffer){
    }
 
    //timing
-   palmSysclksPerClk32 = readStateValueDouble(buffer.data + offset);
+   palmSysclksPerClk32 = readStateValue64(buffer.data + offset);
    offset += sizeof(uint64_t);
-   palmCycleCounter = readStateValueDouble(buffer.data + offset);
+   palmCycleCounter = (int64_t)readStateValue64(buffer.data + offset);
    offset += sizeof(uint64_t);
-   palmClockMultiplier = readStateValueDouble(buffer.data + offset);
+   palmClockMultiplier = readStateValue64(buffer.data + offset);
    offset += sizeof(uint64_t);
    pllSleepWait = readStateValue8(buffer.data + offset);
    offset += sizeof(int8_t);
    pllWakeWait = readStateValue8(buffer.data + offset);
    offset += sizeof(int8_t);
+   registerPollClk32s = readStateValue8(buffer.data + offset);
+   offset += sizeof(uint8_t);
    clk32Counter = readStateValue32(buffer.data + offset);
    offset += sizeof(uint32_t);
-   pctlrCpuClockDivider = readStateValueDouble(buffer.data + offset);
+   pctlrCpuClockDivider = readStateValue64(buffer.data + offset);
    offset += sizeof(uint64_t);
-   timerCycleCounter[0] = readStateValueDouble(buffer.data + offset);
+   timerCycleCounter[0] = readStateValue64(buffer.data + offset);
    offset += sizeof(uint64_t);
-   timerCycleCounter[1] = readStateValueDouble(buffer.data + offset);
+   timerCycleCounter[1] = readStateValue64(buffer.data + offset);
    offset += sizeof(uint64_t);
    timerStatusReadAcknowledge[0] = readStateValue16(buffer.data + offset);
    offset += sizeof(uint16_t);
@@ -581,6 +644,8 @@ bool emulatorLoadState(buffer_t buffer){
    offset += stateSdCardSize;
 
    //some modules depend on all the state memory being loaded before certian required actions can occur(refreshing cached data, freeing memory blocks)
+   updateBankAttributes();
+   restartTimers();
    flx68000LoadStateFinished();
 
    return true;
@@ -596,8 +661,7 @@ bool emulatorSaveRam(buffer_t buffer){
    if(buffer.size < size)
       return false;
 
-   memcpy(buffer.data, palmRam, size);
-   swap16BufferIfLittle(buffer.data, size / sizeof(uint16_t));
+   saveRamPages(buffer.data, size);
 
    return true;
 }
@@ -608,12 +672,91 @@ bool emulatorLoadRam(buffer_t buffer){
    if(buffer.size < size)
       return false;
 
-   memcpy(palmRam, buffer.data, size);
-   swap16BufferIfLittle(palmRam, size / sizeof(uint16_t));
+   loadRamPages(buffer.data, size);
 
    return true;
 }
 
+uint32_t emulatorMapRamFile(const char* path){
+   //the file is used as palmRam directly so it has to be in the same byte order as palmRam, which is only the Palm byte order used by RAM files when EMU_BIG_ENDIAN or EMU_BIG_ENDIAN_MEMORY is set
+#if defined(__linux__) && (defined(EMU_BIG_ENDIAN) || defined(EMU_BIG_ENDIAN_MEMORY))
+   if(!path)
+      return EMU_ERROR_INVALID_PARAMETER;
+
+   if(emulatorRamFileMapped)
+      return EMU_ERROR_RESOURCE_LOCKED;
+
+   //mapped over the existing RAM buffer so every pointer to palmRam stays valid
+   if(!mapFileOverLazyBuffer(palmRam, emulatorGetRamSize(), path))
+      return EMU_ERROR_UNKNOWN;
+
+   emulatorRamFileMapped = true;
+   markRamRangeDirty(0, emulatorGetRamSize());
+   flx68000AddressSpaceChanged();
+
+   return EMU_ERROR_NONE;
+#else
+   return EMU_ERROR_NOT_IMPLEMENTED;
+#endif
+}
+
+bool emulatorFlushRamFile(void){
+   if(!emulatorRamFileMapped)
+      return false;
+
+   return flushMappedFile(palmRam, emulatorGetRamSize());
+}
+
+uint32_t emulatorSetWatchpoint(uint8_t index, watchpoint_t watchpoint){
+   if(index >= EMU_WATCHPOINTS || (watchpoint.type && watchpoint.size == 0))
+      return EMU_ERROR_INVALID_PARAMETER;
+
+   if(!watchpoint.type)
+      memset(&watchpoint, 0x00, sizeof(watchpoint));
+   setWatchpoint(index, watchpoint);
+
+   return EMU_ERROR_NONE;
+}
+
+watchpoint_t emulatorGetWatchpoint(uint8_t index){
+   watchpoint_t unused;
+
+   if(index < EMU_WATCHPOINTS)
+      return getWatchpoint(index);
+
+   memset(&unused, 0x00, sizeof(unused));
+   return unused;
+}
+
+bool emulatorGetWatchpointHit(watchpoint_hit_t* hit){
+   return getWatchpointHit(hit, true);
+}
+
+bool emulatorGetBusStatistics(bus_statistics_t* statistics, bool reset){
+   return getBusStatistics(statistics, reset);
+}
+
+bool emulatorGetDirtyRamPages(buffer_t buffer, bool clear){
+#if defined(EMU_DIRTY_RAM_PAGES)
+   uint32_t pages = emulatorGetRamSize() >> DIRTY_RAM_PAGE_SCOOT;
+   uint32_t index;
+
+   if(buffer.size < pages / 8)
+      return false;
+
+   //bit 0 of byte 0 is the first page of RAM
+   for(index = 0; index < pages / 8; index++)
+      buffer.data[index] = dirtyRamPages[index / 4] >> index % 4 * 8 & 0xFF;
+
+   if(clear)
+      memset(dirtyRamPages, 0x00, pages / 8);
+
+   return true;
+#else
+   return false;
+#endif
+}
+
 buffer_t emulatorGetSdCardBuffer(void){
    return palmSdCard.flashChip;
 }
@@ -651,6 +794,7 @@ uint32_t emulatorInstallPrcPdb(buffer_t file){
 }
 
 void emulatorRunFrame(void){
+   bool watchpointAlreadyHit = getWatchpointHit(NULL, false);
    uint32_t samples;
 
    //I/O
@@ -658,11 +802,32 @@ void emulatorRunFrame(void){
 
    //CPU
    palmFrameClk32s = 0;
-   for(; palmCycleCounter < (double)CRYSTAL_FREQUENCY / EMU_FPS; palmCycleCounter += 1.0){
-      flx68000Execute();
-      palmFrameClk32s++;
+   palmFrameIrqChecksSkipped = 0;
+   palmFrameIdleLoopsSkipped = 0;
+   palmFrameTimeslices = 0;
+#if !defined(EMU_NO_SAFETY)
+   //address and bus errors abort the current opcode and longjmp() back here, only setting this once a frame avoids a setjmp() per timeslice
+   if(setjmp(flx68000ErrorTrap) != 0){
+      uint32_t clk32s = flx68000ExecuteAfterError();
+
+      palmFrameClk32s += clk32s;
+      palmCycleCounter += clk32s * EMU_FPS;
+   }
+#endif
+   while(palmCycleCounter < CRYSTAL_FREQUENCY){
+      //run until the next timed event or the end of the frame
+      uint32_t clk32s = u32Min(clk32sUntilNextEvent(), (CRYSTAL_FREQUENCY - palmCycleCounter + EMU_FPS - 1) / EMU_FPS);
+
+      clk32s = flx68000Execute(clk32s);
+      palmFrameTimeslices++;
+      palmFrameClk32s += clk32s;
+      palmCycleCounter += clk32s * EMU_FPS;
+
+      //stop so the debugger sees the state right after the access, the rest of the frame is made up next frame
+      if(!watchpointAlreadyHit && getWatchpointHit(NULL, false))
+         break;
    }
-   palmCycleCounter -= (double)CRYSTAL_FREQUENCY / EMU_FPS;
+   palmCycleCounter -= CRYSTAL_FREQUENCY;
 
    //audio
    blip_end_frame(palmAudioResampler, blip_clocks_needed(palmAudioResampler, AUDIO_SAMPLES_PER_FRAME));
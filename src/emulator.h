@@ -12,13 +12,21 @@ extern "C" {
 #include <stdio.h>
 
 #include "audio/blip_buf.h"
-#include "memoryAccess.h"//for size macros
+#include "memoryAccess.h"//for size macros and watchpoint types
 #include "specs/emuFeatureRegisterSpec.h"//for feature names
 
 //DEFINE INFO!!!
 //define EMU_MULTITHREADED to speed up long loops
 //define EMU_NO_SAFETY to remove all safety checks
 //define EMU_BIG_ENDIAN on big endian systems
+//define EMU_BIG_ENDIAN_MEMORY on little endian systems to keep RAM and ROM in Palm byte order and byte swap on access, 32 bit accesses are then 1 load instead of 2, the Linux frontends use it so emulatorMapRamFile works
+//define EMU_THREADED_M68K to run the 68k core with computed gotos instead of a function table, GCC and Clang only, needs EMU_NO_SAFETY
+//define EMU_FUSED_M68K to run common 68k opcode pairs like CMP then Bcc as 1 handler instead of caching ROM opcodes, needs EMU_NO_SAFETY
+//define EMU_X86_64_JIT to translate straight line runs of simple 68k opcodes from ROM into x86-64 code instead of caching them, x86-64 Linux only, needs EMU_NO_SAFETY
+//define EMU_LAZY_FLAGS to have ADD, SUB and CMP save their operands and only work out the 68k condition codes when they are read, needs EMU_NO_SAFETY
+//define EMU_DIRTY_RAM_PAGES to keep a bitmap of which RAM pages have been written, read it with emulatorGetDirtyRamPages
+//define EMU_BUS_STATISTICS to count 68k bus accesses per chip and per hardware register, read them with emulatorGetBusStatistics
+//define EMU_FUSION_STATISTICS with EMU_FUSED_M68K to count how often each 68k opcode pair was seen and fused, read them with m68k_get_fusion_counts
 //to enable degguging define EMU_DEBUG, all options below do nothing unless EMU_DEBUG is defined
 //to enable sandbox debugging define EMU_SANDBOX
 //to enable opcode level debugging define EMU_SANDBOX_OPCODE_LEVEL_DEBUG
@@ -121,12 +129,13 @@ typedef struct{
 #define AUDIO_SAMPLE_RATE 48000
 #define AUDIO_CLOCK_RATE 235929600//smallest amount of time a second can be split into:(2.0 * (14.0 * (255 + 1.0) + 15 + 1.0)) * 32768 == 235929600, used to convert the variable timing of SYSCLK and CLK32 to a fixed location in the current frame 0<->AUDIO_END_OF_FRAME
 #define AUDIO_SPEAKER_RANGE 0x6000//prevent hitting the top or bottom of the speaker when switching direction rapidly
-#define SAVE_STATE_VERSION 0
+#define SAVE_STATE_VERSION 2
 
 //system constants
 #define CRYSTAL_FREQUENCY 32768
 #define AUDIO_SAMPLES_PER_FRAME (AUDIO_SAMPLE_RATE / EMU_FPS)
 #define AUDIO_END_OF_FRAME (AUDIO_CLOCK_RATE / EMU_FPS)
+#define DEFAULT_CLOCK_MULTIPLIER ((uint64_t)((1.00 - EMU_CPU_PERCENT_WAITING) * 4294967296.0))//CPU cycles per SYSCLK when not overclocked, 32.32 fixed point
 
 //emulator data, some are GUI interface variables, some should be left alone
 extern uint8_t*  palmRam;//access allowed to read save RAM without allocating a giant buffer, but endianness must be taken into account
@@ -141,11 +150,14 @@ extern uint16_t  palmFramebufferWidth;//read allowed
 extern uint16_t  palmFramebufferHeight;//read allowed
 extern int16_t*  palmAudio;//read allowed, 2 channel signed 16 bit audio
 extern blip_t*   palmAudioResampler;//dont touch
-extern double    palmSysclksPerClk32;//dont touch
-extern double    palmCycleCounter;//dont touch
-extern double    palmClockMultiplier;//dont touch
+extern uint64_t  palmSysclksPerClk32;//dont touch
+extern int64_t   palmCycleCounter;//dont touch
+extern uint64_t  palmClockMultiplier;//dont touch
 extern uint32_t  palmFrameClk32s;//dont touch
-extern double    palmClk32Sysclks;//dont touch
+extern uint32_t  palmFrameIrqChecksSkipped;//read allowed, interrupt checks in the last frame that didnt need to call into the CPU core
+extern uint32_t  palmFrameIdleLoopsSkipped;//read allowed, timeslices in the last frame that were ended early because the CPU was only polling hardware registers
+extern uint32_t  palmFrameTimeslices;//read allowed, how many timeslices the last frame was run in, each one ends at a timed event so an idle frame only needs a few
+extern uint64_t  palmClk32Sysclks;//dont touch
 
 //functions
 uint32_t emulatorInit(buffer_t palmRomDump, buffer_t palmBootDump, uint32_t enabledEmuFeatures);//calling any emulator functions before emulatorInit results in undefined behavior
@@ -159,10 +171,17 @@ bool emulatorLoadState(buffer_t buffer);//true = success
 uint64_t emulatorGetRamSize(void);
 bool emulatorSaveRam(buffer_t buffer);//true = success
 bool emulatorLoadRam(buffer_t buffer);//true = success
+uint32_t emulatorMapRamFile(const char* path);//uses a RAM file in the Palm byte order as palmRam until emulatorExit, call before running, needs EMU_BIG_ENDIAN or EMU_BIG_ENDIAN_MEMORY, a file that isnt empty or the size of RAM is left alone and an error is returned
+bool emulatorFlushRamFile(void);//true = success, writes the mapped RAM file to disk
+bool emulatorGetDirtyRamPages(buffer_t buffer, bool clear);//true = success, needs EMU_DIRTY_RAM_PAGES, 1 bit per DIRTY_RAM_PAGE_SIZE bytes of RAM written since the last clear
 buffer_t emulatorGetSdCardBuffer(void);//this is a direct pointer to the SD card data, do not free it
 uint32_t emulatorInsertSdCard(buffer_t image);//use (NULL, desired size) to create a new empty SD card
 void emulatorEjectSdCard(void);
 uint32_t emulatorInstallPrcPdb(buffer_t file);
+uint32_t emulatorSetWatchpoint(uint8_t index, watchpoint_t watchpoint);//only 68k data accesses are watched, opcode fetches and the ARM core arnt, type = 0 removes the watchpoint
+watchpoint_t emulatorGetWatchpoint(uint8_t index);
+bool emulatorGetWatchpointHit(watchpoint_hit_t* hit);//true = a watchpoint was hit and emulatorRunFrame() stopped early, clears the hit so the next one can be caught
+bool emulatorGetBusStatistics(bus_statistics_t* statistics, bool reset);//true = success, needs EMU_BUS_STATISTICS, reset clears the counters after copying them
 void emulatorRunFrame(void);
    
 #ifdef __cplusplus
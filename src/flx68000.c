@@ -1,5 +1,6 @@
 #include <stdint.h>
 #include <stdbool.h>
+#include <string.h>
 
 #include "emulator.h"
 #include "portability.h"
@@ -18,7 +19,7 @@ void flx68000PcLongJump(uint32_t newPc){
    uint32_t dataBufferGuest;
    uint32_t windowSize;
 
-   switch(bankType[START_BANK(newPc)]){
+   switch((uint8_t)(bankType[START_BANK(newPc)] & ~BANK_WATCHED)){
       case CHIP_A0_ROM:
          dataBufferHost = (uintptr_t)palmRom;
          dataBufferGuest = chips[CHIP_A0_ROM].start;
@@ -60,6 +61,22 @@ uint16_t  m68k_read_pcrelative_16(uint32_t address){
 uint32_t  m68k_read_pcrelative_32(uint32_t address){
    return *(uint16_t*)(memBase + address) << 16 | *(uint16_t*)(memBase + address + 2);
 }
+#elif defined(EMU_BIG_ENDIAN_MEMORY)
+uint16_t m68k_read_immediate_16(uint32_t address){
+   return SWAP_16(*(uint16_t*)(memBase + address));
+}
+uint32_t m68k_read_immediate_32(uint32_t address){
+   return SWAP_32(readUnaligned32((uint8_t*)(memBase + address)));
+}
+uint8_t  m68k_read_pcrelative_8(uint32_t address){
+   return *(uint8_t*)(memBase + address);
+}
+uint16_t  m68k_read_pcrelative_16(uint32_t address){
+   return SWAP_16(*(uint16_t*)(memBase + address));
+}
+uint32_t  m68k_read_pcrelative_32(uint32_t address){
+   return SWAP_32(readUnaligned32((uint8_t*)(memBase + address)));
+}
 #else
 uint16_t m68k_read_immediate_16(uint32_t address){
    return *(uint16_t*)(memBase + address);
@@ -79,6 +96,11 @@ uint32_t  m68k_read_pcrelative_32(uint32_t address){
 #endif
 #endif
 
+bool flx68000PcInRom(uint32_t pc){
+   //ROM is never written, so opcodes from it can be cached until the address space changes
+   return bankType[START_BANK(pc)] == CHIP_A0_ROM;
+}
+
 void flx68000Init(void){
    static bool inited = false;
 
@@ -110,6 +132,9 @@ void flx68000SaveState(uint8_t* data){
    uint64_t offset = 0;
    uint8_t index;
 
+   //the flags may still be pending from the last ADD, SUB or CMP
+   m68ki_resolve_flags();
+
    for(index = 0; index < 16; index++){
       writeStateValue32(data + offset, m68ki_cpu.dar[index]);
       offset += sizeof(uint32_t);
@@ -240,36 +265,147 @@ void flx68000LoadState(uint8_t* data){
    offset += sizeof(uint32_t);
    m68ki_cpu.run_mode = readStateValue32(data + offset);
    offset += sizeof(uint32_t);
+
+   //the state always has the real flags
+   m68ki_discard_lazy_flags();
 }
 
 void flx68000LoadStateFinished(void){
+   //the address space was replaced by the one in the state
+   m68k_flush_block_cache();
+
 #if M68K_SEPARATE_READS
    //set PC accessor to the PC from the state
    flx68000PcLongJump(m68ki_cpu.pc);
 #endif
 }
 
-void flx68000Execute(void){
-   double cyclesRemaining = palmSysclksPerClk32;
+//hardware registers only change between timeslices or when something is written, so a loop that gets back to the same place with the same registers
+//without writing anything will keep doing the same thing until the timeslice ends
+bool flx68000IdleLoopPolled;
+bool flx68000IdleLoopChanged;
+static uint32_t idleLoopPc;
+static uint32_t idleLoopSr;
+static uint32_t idleLoopRegisters[16];
 
-   beginClk32();
 
-   while(cyclesRemaining >= 1.0){
-      double sysclks = dMin(cyclesRemaining, EMU_SYSCLK_PRECISION);
-      int32_t cpuCycles = sysclks * pctlrCpuClockDivider * palmClockMultiplier;
+void flx68000IdleLoopCheck(void){
+   uint32_t sr = m68k_get_reg(NULL, M68K_REG_SR);
+
+   if(!flx68000IdleLoopChanged && m68ki_cpu.pc == idleLoopPc && sr == idleLoopSr && memcmp(m68ki_cpu.dar, idleLoopRegisters, sizeof(idleLoopRegisters)) == 0){
+      //the last pass only polled hardware registers, skip the time the rest of the passes would have taken
+      SET_CYCLES(0);
+      palmFrameIdleLoopsSkipped++;
+   }
+   else{
+      idleLoopPc = m68ki_cpu.pc;
+      idleLoopSr = sr;
+      memcpy(idleLoopRegisters, m68ki_cpu.dar, sizeof(idleLoopRegisters));
+   }
 
-      if(cpuCycles > 0)
-         m68k_execute(cpuCycles);
-      addSysclks(sysclks);
+   flx68000IdleLoopPolled = false;
+   flx68000IdleLoopChanged = false;
+}
 
-      cyclesRemaining -= sysclks;
+//the state of flx68000Execute(), kept outside the function so flx68000ExecuteAfterError() can finish it after an address or bus error longjmp()s out of it
+//the SYSCLK and cycles per SYSCLK values are 32.32 fixed point
+static uint32_t executeClk32s;
+static uint64_t executeSysclksPerClk32;
+static uint64_t executeSysclksTotal;
+static uint64_t executeSysclksDone;
+static uint64_t executeSysclks;
+static uint64_t executeCpuCyclesPerSysclk;
+static int32_t  executeCpuCycles;
+static bool     executeSliceCounted = true;//an error raised from addSysclks() or endClk32() also lands in flx68000ExecuteAfterError(), these stop it counting the time twice
+static bool     executeClk32Ended = true;
+
+
+static void executeSliceRan(int32_t cpuCyclesRan){
+   if(executeSliceCounted)
+      return;
+
+   if(cpuCyclesRan < executeCpuCycles){
+      //timeslice was ended early, finish the current CLK32 and return so the next event can be recalculated
+      executeSysclks = fixedDivide((uint64_t)s32Max(cpuCyclesRan, 0) << 32, executeCpuCyclesPerSysclk);
+      executeClk32s = u32Clamp(1, (executeSysclksDone + executeSysclks + executeSysclksPerClk32 - 1) / executeSysclksPerClk32, executeClk32s);
+      executeSysclksTotal = executeSysclksPerClk32 * executeClk32s;
    }
+   executeSliceCounted = true;
+   executeSysclksDone += executeSysclks;
+   addSysclks(executeSysclks);
+}
+
+static uint32_t executeRemaining(void){
+   while(executeSysclksTotal - executeSysclksDone >= FIXED_POINT_ONE){
+      executeCpuCyclesPerSysclk = fixedMultiply(pctlrCpuClockDivider, palmClockMultiplier);
+      executeSysclks = u64Min(executeSysclksTotal - executeSysclksDone, (uint64_t)EMU_SYSCLK_PRECISION << 32);
+      executeCpuCycles = fixedMultiply(executeSysclks, executeCpuCyclesPerSysclk) >> 32;
+      flx68000IdleLoopChanged = true;//the last timeslice may have changed anything
+      executeSliceCounted = false;
 
-   endClk32();
+      executeSliceRan(executeCpuCycles > 0 ? m68k_execute_shared_trap(executeCpuCycles) : 0);
+   }
+
+   if(!executeClk32Ended){
+      executeClk32Ended = true;
+      endClk32(executeClk32s);
+   }
+
+   return executeClk32s;
+}
+
+uint32_t flx68000Execute(uint32_t clk32s){
+   executeClk32s = clk32s;
+   executeSysclksPerClk32 = palmSysclksPerClk32;
+   executeSysclksTotal = executeSysclksPerClk32 * clk32s;
+   executeSysclksDone = 0;
+   executeSliceCounted = true;
+   executeClk32Ended = false;
+
+   beginClk32();
+
+   return executeRemaining();
+}
+
+#if !defined(EMU_NO_SAFETY)
+uint32_t flx68000ExecuteAfterError(void){
+   executeSliceRan(m68k_execute_after_address_error());
+   return executeRemaining();
 }
+#endif
+
+uint64_t flx68000SysclksRan(void){
+   //only the part of the timeslice that addSysclks() hasnt been given yet
+   if(executeSliceCounted)
+      return 0;
+
+   return fixedDivide((uint64_t)s32Max(m68k_cycles_run(), 0) << 32, executeCpuCyclesPerSysclk);
+}
+
+uint32_t flx68000Clk32sRan(void){
+   if(executeClk32Ended || executeSysclksPerClk32 == 0)
+      return 0;
+
+   return (executeSysclksDone + flx68000SysclksRan()) / executeSysclksPerClk32;
+}
+
+void flx68000EndTimeslice(void){
+   //m68k_end_timeslice() makes m68k_execute() return the cycles left instead of the cycles used, this keeps the return value correct
+   if(m68k_cycles_remaining() > 0)
+      m68k_modify_timeslice(-m68k_cycles_remaining());
+}
+
+void flx68000AddressSpaceChanged(void){
+   m68k_flush_block_cache();
+}
+
+bool flx68000SetIrq(uint8_t irqLevel){
+   //the CPU checks for interrupts itself when the SR mask changes, so setting the same level again does nothing
+   if(m68ki_cpu.int_level == (uint32_t)irqLevel << 8)
+      return false;
 
-void flx68000SetIrq(uint8_t irqLevel){
    m68k_set_irq(irqLevel);
+   return true;
 }
 
 bool flx68000IsSupervisor(void){
@@ -295,9 +431,10 @@ uint64_t flx68000ReadArbitraryMemory(uint32_t address, uint8_t size){
    uint64_t data = UINT64_MAX;//invalid access
 
    //reading from a hardware register FIFO will corrupt it!
-   if(bankType[START_BANK(address)] != CHIP_NONE){
+   if((bankType[START_BANK(address)] & ~BANK_WATCHED) != CHIP_NONE){
       uint16_t m68kSr = m68k_get_reg(NULL, M68K_REG_SR);
       m68k_set_reg(M68K_REG_SR, 0x2000);//prevent privilege violations
+      suspendWatchpoints(true);
       switch(size){
          case 8:
             data = m68k_read_memory_8(address);
@@ -311,6 +448,7 @@ uint64_t flx68000ReadArbitraryMemory(uint32_t address, uint8_t size){
             data = m68k_read_memory_32(address);
             break;
       }
+      suspendWatchpoints(false);
       m68k_set_reg(M68K_REG_SR, m68kSr);
    }
 
@@ -4,6 +4,9 @@
 #include <stdint.h>
 #include <stdbool.h>
 
+extern bool flx68000IdleLoopPolled;//set when a hardware register is read, only loops that poll something are checked
+extern bool flx68000IdleLoopChanged;//set by writes and reads with side effects, a loop that did either is not skipped
+
 void flx68000Init(void);
 void flx68000Reset(void);
 uint64_t flx68000StateSize(void);
@@ -11,9 +14,22 @@ void flx68000SaveState(uint8_t* data);
 void flx68000LoadState(uint8_t* data);
 void flx68000LoadStateFinished(void);
 
-void flx68000Execute(void);//runs the CPU for 1 CLK32 pulse
-void flx68000SetIrq(uint8_t irqLevel);
+uint32_t flx68000Execute(uint32_t clk32s);//runs the CPU for up to clk32s CLK32 pulses, returns how many where run
+#if !defined(EMU_NO_SAFETY)
+#include <setjmp.h>
+
+//address and bus errors longjmp() to this, it must be setjmp() once in a function that outlives every flx68000Execute() call
+extern jmp_buf m68ki_aerr_trap;
+#define flx68000ErrorTrap m68ki_aerr_trap
+uint32_t flx68000ExecuteAfterError(void);//finishes the flx68000Execute() that was aborted when setjmp(flx68000ErrorTrap) returns nonzero, returns how many CLK32s where run
+#endif
+uint64_t flx68000SysclksRan(void);//SYSCLKs the running timeslice has used so far that arnt in addSysclks() yet, 32.32 fixed point, 0 outside of flx68000Execute()
+uint32_t flx68000Clk32sRan(void);//whole CLK32s the running flx68000Execute() has passed that arnt in endClk32() yet
+void flx68000EndTimeslice(void);//makes flx68000Execute() return at the end of the current CLK32
+void flx68000AddressSpaceChanged(void);//must be called after bankType[] is changed for ROM banks
+bool flx68000SetIrq(uint8_t irqLevel);//false if the CPU already had this level and nothing was done
 bool flx68000IsSupervisor(void);
+void flx68000IdleLoopCheck(void);//called on backwards branches, ends the timeslice if the loop can only repeat itself until then
 void flx68000BusError(uint32_t address, bool isWrite);
 
 uint32_t flx68000GetRegister(uint8_t reg);//only for debugging
@@ -19,9 +19,10 @@
 chip_t   chips[CHIP_END];
 int8_t   pllSleepWait;
 int8_t   pllWakeWait;
+uint8_t  registerPollClk32s;
 uint32_t clk32Counter;
-double   pctlrCpuClockDivider;
-double   timerCycleCounter[2];
+uint64_t pctlrCpuClockDivider;//32.32 fixed point
+uint64_t timerCycleCounter[2];//32.32 fixed point
 uint16_t timerStatusReadAcknowledge[2];
 uint8_t  portDInterruptLastValue;//used for edge triggered interrupt timing
 uint16_t spi1RxFifo[9];
@@ -36,20 +37,47 @@ uint8_t  pwm1Fifo[6];
 uint8_t  pwm1ReadPosition;
 uint8_t  pwm1WritePosition;
 
+//registers that are only storage in palmReg are accessed directly instead of going through the switches
+enum{
+   REGISTER_READ_8 = 0x01,
+   REGISTER_READ_16 = 0x02,
+   REGISTER_READ_32 = 0x04,
+   REGISTER_WRITE_8 = 0x08,
+   REGISTER_WRITE_16 = 0x10,
+   REGISTER_WRITE_32 = 0x20
+};
+
+static uint8_t  registerAccess[0x1000];
+static uint32_t registerWriteMask[0x1000];
+
+//time passed for the lazy timers and when each timer was last updated, 32.32 fixed point, only differences matter so they arnt saved
+static uint64_t timerSysclks;
+static uint64_t timerClk32s;
+static uint64_t timerSysclkStamp[2];
+static uint64_t timerClk32Stamp[2];
+static uint64_t timerEventSysclks[2];//how long after the stamp the next compare or roll over happens, UINT64_MAX if never
+static uint64_t timerEventClk32s[2];
+
+//the last ISR and ILCR checkInterrupts() worked out the level for, 0 for both is level 0
+static uint32_t interruptLastIsr;
+static uint16_t interruptLastIlcr;
+static uint8_t  interruptLastLevel;
+
 
 static void checkInterrupts(void);
 static void checkPortDInterrupts(void);
 static void pllWakeCpuIfOff(void);
-static double sysclksPerClk32(void);
+static uint64_t sysclksPerClk32(void);
+static void scheduleChanged(void);
 static int32_t audioGetFramePercentIncrementFromClk32s(int32_t count);
-static int32_t audioGetFramePercentIncrementFromSysclks(double count);
+static int32_t audioGetFramePercentIncrementFromSysclks(uint64_t count);
 static int32_t audioGetFramePercentage(void);
 
 #include "hardwareRegistersAccessors.c.h"
 #include "hardwareRegistersTiming.c.h"
 
 bool pllIsOn(void){
-   return !(palmSysclksPerClk32 < 1.0);
+   return palmSysclksPerClk32 >= FIXED_POINT_ONE;
 }
 
 bool backlightAmplifierState(void){
@@ -149,9 +177,7 @@ static void pllWakeCpuIfOff(void){
       pllWakeWait = pllWaitTable[registerArrayRead16(PLLCR) & 0x0003];
 }
 
-static void checkInterrupts(void){
-   uint32_t activeInterrupts = registerArrayRead32(ISR);
-   uint16_t interruptLevelControlRegister = registerArrayRead16(ILCR);
+static uint8_t interruptLevel(uint32_t activeInterrupts, uint16_t interruptLevelControlRegister){
    uint8_t spi1IrqLevel = interruptLevelControlRegister >> 12;
    uint8_t uart2IrqLevel = interruptLevelControlRegister >> 8 & 0x0007;
    uint8_t pwm2IrqLevel = interruptLevelControlRegister >> 4 & 0x0007;
@@ -193,14 +219,32 @@ static void checkInterrupts(void){
    if(intLevel < timer2IrqLevel && activeInterrupts & INT_TMR2)
       intLevel = timer2IrqLevel;
 
+   return intLevel;
+}
+
+static void checkInterrupts(void){
+   uint32_t activeInterrupts = registerArrayRead32(ISR);
+   uint16_t interruptLevelControlRegister = registerArrayRead16(ILCR);
+   uint8_t intLevel;
+
+   //the level only depends on ISR and ILCR, most calls happen when neither has changed
+   if(activeInterrupts != interruptLastIsr || interruptLevelControlRegister != interruptLastIlcr){
+      interruptLastIsr = activeInterrupts;
+      interruptLastIlcr = interruptLevelControlRegister;
+      interruptLastLevel = interruptLevel(activeInterrupts, interruptLevelControlRegister);
+   }
+   intLevel = interruptLastLevel;
+
    //even masked interrupts turn off PCTLR, 4.5.4 Power Control Register MC68VZ328UM.pdf
    if(intLevel > 0 && registerArrayRead8(PCTLR) & 0x80){
       registerArrayWrite8(PCTLR, registerArrayRead8(PCTLR) & 0x1F);
-      pctlrCpuClockDivider = 1.0;
+      pctlrCpuClockDivider = FIXED_POINT_ONE;
+      scheduleChanged();
    }
 
    //should be called even if intLevel is 0, that is how the interrupt state gets cleared
-   flx68000SetIrq(intLevel);
+   if(!flx68000SetIrq(intLevel))
+      palmFrameIrqChecksSkipped++;
 }
 
 static void checkPortDInterrupts(void){
@@ -312,7 +356,7 @@ void setEmuRegister(uint32_t address, uint32_t value){
          switch(value){
             case CMD_SET_CPU_SPEED:
                if(palmEmuFeatures.info & FEATURE_FAST_CPU)
-                  palmClockMultiplier = (double)palmEmuFeatures.value / 100.0 * (1.00 - EMU_CPU_PERCENT_WAITING);
+                  palmClockMultiplier = DEFAULT_CLOCK_MULTIPLIER * palmEmuFeatures.value / 100;
                return;
 
             case CMD_ARM_SERVICE:
@@ -396,6 +440,9 @@ uint8_t getHwRegister8(uint32_t address){
    if(sandboxRunning() && address < 0xE00)
       printUnknownHwAccess(address, 0, 8, false);
 
+   if(registerAccess[address] & REGISTER_READ_8)
+      return registerArrayRead8(address);
+
    switch(address){
       case PADATA:
          return getPortAValue();
@@ -427,70 +474,16 @@ uint8_t getHwRegister8(uint32_t address){
       case PMDATA:
          return getPortMValue();
 
-      case PWMCNT1:
-         debugLog("PWMCNT1 not implimented\n");
-         return 0x00;
-
-      //16 bit registers being read as 8 bit
-      case SPICONT1:
-      case SPICONT1 + 1:
-      case SPIINTCS:
-      case SPIINTCS + 1:
       case PLLFSR:
       case PLLFSR + 1:
-
-      //basic non GPIO functions
-      case SCR:
-      case LCKCON:
-      case IVR:
-      case PWMP1:
-
-      //port d special functions
-      case PDPOL:
-      case PDIRQEN:
-      case PDIRQEG:
-      case PDKBEN:
-
-      //I/O direction
-      case PBDIR:
-      case PDDIR:
-      case PEDIR:
-      case PFDIR:
-      case PJDIR:
-      case PKDIR:
-
-      //select between GPIO or special function
-      case PBSEL:
-      case PCSEL:
-      case PDSEL:
-      case PESEL:
-      case PFSEL:
-      case PGSEL:
-      case PJSEL:
-      case PKSEL:
-      case PMSEL:
-
-      //pull up/down enable
-      case PAPUEN:
-      case PBPUEN:
-      case PCPDEN:
-      case PDPUEN:
-      case PEPUEN:
-      case PFPUEN:
-      case PGPUEN:
-      case PJPUEN:
-      case PKPUEN:
-      case PMPUEN:
-         //simple read, no actions needed
-         //PGPUEN, PGSEL PMSEL and PMPUEN lack the top 2 bits but that is handled on write
-         //PDSEL lacks the bottom 4 bits but that is handled on write
+         registerPolled();
          return registerArrayRead8(address);
 
-      default:
-         //bootloader
-         if(address >= 0xE00)
-            return registerArrayRead8(address);
+      case PWMCNT1:
+         debugLog("PWMCNT1 not implimented\n");
+         return 0x00;
 
+      default:
          printUnknownHwAccess(address, 0, 8, false);
          return 0x00;
    }
@@ -509,6 +502,9 @@ uint16_t getHwRegister16(uint32_t address){
    if(sandboxRunning() && address < 0xE00)
       printUnknownHwAccess(address, 0, 16, false);
 
+   if(registerAccess[address] & REGISTER_READ_16)
+      return registerArrayRead16(address);
+
    switch(address){
       case TSTAT1:
          timerStatusReadAcknowledge[0] |= registerArrayRead16(TSTAT1);//active bits acknowledged
@@ -518,6 +514,10 @@ uint16_t getHwRegister16(uint32_t address){
          timerStatusReadAcknowledge[1] |= registerArrayRead16(TSTAT2);//active bits acknowledged
          return registerArrayRead16(TSTAT2);
 
+      case TCN1:
+      case TCN2:
+         return timerRead(address == TCN1 ? 0 : 1);
+
       case PWMC1:
          return getPwmc1();
 
@@ -527,6 +527,7 @@ uint16_t getHwRegister16(uint32_t address){
 
       case SPIRXD:{
             uint16_t fifoVal = spi1RxFifoRead();
+            flx68000IdleLoopChanged = true;
             //check if SPI1 interrupts changed
             setSpiIntCs(registerArrayRead16(SPIINTCS));
             debugLog("SPIRXD read, FIFO value:0x%04X, SPIINTCS:0x%04X\n", fifoVal, registerArrayRead16(SPIINTCS));
@@ -534,55 +535,10 @@ uint16_t getHwRegister16(uint32_t address){
          }
 
       case PLLFSR:
-         //this is a hack, it makes the busy wait in HwrDelay finish instantly, prevents issues with the power button
-         registerArrayWrite16(PLLFSR, registerArrayRead16(PLLFSR) ^ 0x8000);
+         registerPolled();
          return registerArrayRead16(PLLFSR);
 
-      //32 bit registers accessed as 16 bit
-      case IDR:
-      case IDR + 2:
-      case IMR:
-      case IMR + 2:
-      case IPR:
-      case IPR + 2:
-      case ISR:
-      case ISR + 2:
-
-      case CSA:
-      case CSB:
-      case CSC:
-      case CSD:
-      case CSGBA:
-      case CSGBB:
-      case CSGBC:
-      case CSGBD:
-      case CSUGBA:
-      case PLLCR:
-      case DRAMC:
-      case SDCTRL:
-      case RTCISR:
-      case RTCCTL:
-      case RTCIENR:
-      case ILCR:
-      case ICR:
-      case TCMP1:
-      case TCMP2:
-      case TPRER1:
-      case TPRER2:
-      case TCTL1:
-      case TCTL2:
-      case SPICONT1:
-      case SPIINTCS:
-      case SPICONT2:
-      case SPIDATA2:
-         //simple read, no actions needed
-         return registerArrayRead16(address);
-
       default:
-         //bootloader
-         if(address >= 0xE00)
-            return registerArrayRead16(address);
-
          printUnknownHwAccess(address, 0, 16, false);
          return 0x0000;
    }
@@ -601,23 +557,11 @@ uint32_t getHwRegister32(uint32_t address){
    if(sandboxRunning() && address < 0xE00)
       printUnknownHwAccess(address, 0, 32, false);
 
-   switch(address){
-      case ISR:
-      case IPR:
-      case IMR:
-      case RTCTIME:
-      case IDR:
-         //simple read, no actions needed
-         return registerArrayRead32(address);
-
-      default:
-         //bootloader
-         if(address >= 0xE00)
-            return registerArrayRead32(address);
+   if(registerAccess[address] & REGISTER_READ_32)
+      return registerArrayRead32(address);
 
-         printUnknownHwAccess(address, 0, 32, false);
-         return 0x00000000;
-   }
+   printUnknownHwAccess(address, 0, 32, false);
+   return 0x00000000;
 }
 
 void setHwRegister8(uint32_t address, uint8_t value){
@@ -633,6 +577,11 @@ void setHwRegister8(uint32_t address, uint8_t value){
    if(sandboxRunning() && address < 0xE00)
       printUnknownHwAccess(address, value, 8, true);
 
+   if(registerAccess[address] & REGISTER_WRITE_8){
+      registerArrayWrite8(address, value & registerWriteMask[address]);
+      return;
+   }
+
    switch(address){
       case SCR:
          setScr(value);
@@ -653,12 +602,8 @@ void setHwRegister8(uint32_t address, uint8_t value){
       case PCTLR:
          registerArrayWrite8(address, value & 0x9F);
          if(value & 0x80)
-            pctlrCpuClockDivider = (value & 0x1F) / 31.0;
-         return;
-
-      case IVR:
-         //write without the bottom 3 bits
-         registerArrayWrite8(address, value & 0xF8);
+            pctlrCpuClockDivider = ((uint64_t)(value & 0x1F) << 32) / 31;
+         scheduleChanged();
          return;
 
       case PBSEL:
@@ -732,51 +677,6 @@ void setHwRegister8(uint32_t address, uint8_t value){
          updateBacklightAmplifierStatus();
          return;
 
-      case PMSEL:
-      case PMDIR:
-      case PMDATA:
-         //unemulated
-         //infrared shutdown
-         registerArrayWrite8(address, value & 0x3F);
-         return;
-
-      case PMPUEN:
-      case PGPUEN:
-         //write without the top 2 bits
-         registerArrayWrite8(address, value & 0x3F);
-         return;
-
-      //select between GPIO or special function
-      case PCSEL:
-      case PESEL:
-
-      //direction select
-      case PADIR:
-      case PCDIR:
-      case PDDIR:
-      case PEDIR:
-
-      //pull up/down enable
-      case PAPUEN:
-      case PBPUEN:
-      case PCPDEN:
-      case PDPUEN:
-      case PEPUEN:
-      case PFPUEN:
-      case PJPUEN:
-      case PKPUEN:
-
-      //port data value, nothing known is attached to port
-      case PCDATA:
-      case PEDATA:
-      case PFDATA:
-
-      //dragonball LCD controller, not attached to anything in Palm m515
-      case LCKCON:
-         //simple write, no actions needed
-         registerArrayWrite8(address, value);
-         return;
-
       default:
          //writeable bootloader region
          if(address >= 0xFC0){
@@ -802,14 +702,21 @@ void setHwRegister16(uint32_t address, uint16_t value){
    if(sandboxRunning() && address < 0xE00)
       printUnknownHwAccess(address, value, 16, true);
 
+   if(registerAccess[address] & REGISTER_WRITE_16){
+      registerArrayWrite16(address, value & registerWriteMask[address]);
+      return;
+   }
+
    switch(address){
       case RTCIENR:
          //missing bits 6 and 7
          registerArrayWrite16(address, value & 0xFF3F);
+         scheduleChanged();
          return;
 
       case RTCCTL:
          registerArrayWrite16(address, value & 0x00A0);
+         scheduleChanged();
          return;
 
       case IMR:
@@ -834,7 +741,10 @@ void setHwRegister16(uint32_t address, uint16_t value){
 
       case TCTL1:
       case TCTL2:
+         timerUpdate(address == TCTL1 ? 0 : 1);
          registerArrayWrite16(address, value & 0x01FF);
+         timerSchedule(address == TCTL1 ? 0 : 1);
+         scheduleChanged();
          return;
 
       case TSTAT1:
@@ -851,6 +761,7 @@ void setHwRegister16(uint32_t address, uint16_t value){
          registerArrayWrite16(WATCHDOG, (value & 0x0003) | (registerArrayRead16(WATCHDOG) & (~value & 0x0080)));
          if(!(registerArrayRead16(WATCHDOG) & 0x0080))
             clearIprIsrBit(INT_WDT);
+         scheduleChanged();
          return;
 
       case RTCISR:
@@ -864,6 +775,7 @@ void setHwRegister16(uint32_t address, uint16_t value){
 
       case PLLFSR:
          setPllfsr(value);
+         scheduleChanged();
          return;
 
       case PLLCR:
@@ -876,6 +788,7 @@ void setHwRegister16(uint32_t address, uint16_t value){
             pllSleepWait = 30;//The PLL shuts down 30 clocks of CLK32 after the DISPLL bit is set in the PLLCR
          else
             pllSleepWait = -1;//allow the CPU to cancel the shut down
+         scheduleChanged();
          return;
 
       case ICR:
@@ -896,11 +809,6 @@ void setHwRegister16(uint32_t address, uint16_t value){
          updateCsdAddressLines();//the EDO bit can disable SDRAM access
          return;
 
-      case DRAMMC:
-         //unemulated, address line remapping, too CPU intensive to emulate
-         registerArrayWrite16(address, value);
-         return;
-
       case SDCTRL:
          //missing bits 13, 9, 8 and 7
          //debugLog("Set SDCTRL, old value:0x%04X, new value:0x%04X, PC:0x%08X\n", registerArrayRead16(address), value, flx68000GetPc());
@@ -909,84 +817,100 @@ void setHwRegister16(uint32_t address, uint16_t value){
          return;
 
       case CSA:{
-            uint16_t oldCsa = registerArrayRead16(CSA);
             bool oldBootMode = chips[CHIP_A0_ROM].inBootMode;
+            uint32_t oldStart;
+            uint32_t oldSize;
+
+            getChipRange(CHIP_A0_ROM, &oldStart, &oldSize);
 
             setCsa(value);
 
-            //only reset address space if size changed, enabled/disabled or exiting boot mode
-            if((value & 0x000F) != (oldCsa & 0x000F) || chips[CHIP_A0_ROM].inBootMode != oldBootMode)
+            //exiting boot mode changes the whole address space, anything else only changes the area covered by CSA
+            if(chips[CHIP_A0_ROM].inBootMode != oldBootMode)
                resetAddressSpace();
+            else
+               remapChip(CHIP_A0_ROM, oldStart, oldSize);
          }
          return;
 
       case CSB:{
-            uint16_t oldCsb = registerArrayRead16(CSB);
+            uint32_t oldStart;
+            uint32_t oldSize;
 
+            getChipRange(CHIP_B0_SED, &oldStart, &oldSize);
             setCsb(value);
-
-            //only reset address space if size changed or enabled/disabled
-            if((value & 0x000F) != (oldCsb & 0x000F))
-               resetAddressSpace();
+            remapChip(CHIP_B0_SED, oldStart, oldSize);
          }
          return;
 
-      case CSC:
-         registerArrayWrite16(CSC, value & 0xF9FF);
-         return;
-
       case CSD:{
             uint16_t oldCsd = registerArrayRead16(CSD);
+            uint32_t oldStart;
+            uint32_t oldSize;
 
+            getChipRange(CHIP_DX_RAM, &oldStart, &oldSize);
             setCsd(value);
 
             //CSD DRAM bit changed
             if((value & 0x0200) != (oldCsd & 0x0200))
                updateCsdAddressLines();
 
-
-            //only reset address space if size changed, enabled/disabled or DRAM bit changed
-            if((value & 0x020F) != (oldCsd & 0x020F))
-               resetAddressSpace();
+            remapChip(CHIP_DX_RAM, oldStart, oldSize);
          }
          return;
 
       case CSGBA:
          //sets the starting location of ROM(0x10000000) and the PDIUSBD12 chip
          if((value & 0xFFFE) != registerArrayRead16(CSGBA)){
+            uint32_t oldStart;
+            uint32_t oldSize;
+
+            getChipRange(CHIP_A0_ROM, &oldStart, &oldSize);
             setCsgba(value);
-            resetAddressSpace();
+            remapChip(CHIP_A0_ROM, oldStart, oldSize);
          }
          return;
 
       case CSGBB:
          //sets the starting location of the SED1376(0x1FF80000)
          if((value & 0xFFFE) != registerArrayRead16(CSGBB)){
+            uint32_t oldStart;
+            uint32_t oldSize;
+
+            getChipRange(CHIP_B0_SED, &oldStart, &oldSize);
             setCsgbb(value);
-            resetAddressSpace();
+            remapChip(CHIP_B0_SED, oldStart, oldSize);
          }
          return;
 
-      case CSGBC:
-         registerArrayWrite16(CSGBC, value & 0xFFFE);
-         return;
-
       case CSGBD:
          //sets the starting location of RAM(0x00000000)
          if((value & 0xFFFE) != registerArrayRead16(CSGBD)){
+            uint32_t oldStart;
+            uint32_t oldSize;
+
+            getChipRange(CHIP_DX_RAM, &oldStart, &oldSize);
             setCsgbd(value);
-            resetAddressSpace();
+            remapChip(CHIP_DX_RAM, oldStart, oldSize);
          }
          return;
 
       case CSUGBA:
          if((value & 0xF777) != registerArrayRead16(CSUGBA)){
+            uint32_t oldStart[3];
+            uint32_t oldSize[3];
+
+            getChipRange(CHIP_A0_ROM, &oldStart[0], &oldSize[0]);
+            getChipRange(CHIP_B0_SED, &oldStart[1], &oldSize[1]);
+            getChipRange(CHIP_DX_RAM, &oldStart[2], &oldSize[2]);
             registerArrayWrite16(CSUGBA, value & 0xF777);
             //refresh all chip select address lines
             setCsgba(registerArrayRead16(CSGBA));
             setCsgbb(registerArrayRead16(CSGBB));
             setCsgbd(registerArrayRead16(CSGBD));
-            resetAddressSpace();
+            remapChip(CHIP_A0_ROM, oldStart[0], oldSize[0]);
+            remapChip(CHIP_B0_SED, oldStart[1], oldSize[1]);
+            remapChip(CHIP_DX_RAM, oldStart[2], oldSize[2]);
          }
          return;
 
@@ -996,11 +920,17 @@ void setHwRegister16(uint32_t address, uint16_t value){
             registerArrayWrite16(CSCTRL1, value & 0x7F55);
 
             if((value & 0x4055) != (oldCsctrl1 & 0x4055)){
+               uint32_t oldStart[2];
+               uint32_t oldSize[2];
+
                //something important changed, update all chip selects
                //CSA is not dependent on CSCTRL1
+               getChipRange(CHIP_B0_SED, &oldStart[0], &oldSize[0]);
+               getChipRange(CHIP_DX_RAM, &oldStart[1], &oldSize[1]);
                setCsb(registerArrayRead16(CSB));
                setCsd(registerArrayRead16(CSD));
-               resetAddressSpace();
+               remapChip(CHIP_B0_SED, oldStart[0], oldSize[0]);
+               remapChip(CHIP_DX_RAM, oldStart[1], oldSize[1]);
             }
          }
          return;
@@ -1035,6 +965,7 @@ void setHwRegister16(uint32_t address, uint16_t value){
 
       case PWMC1:
          setPwmc1(value);
+         scheduleChanged();
          return;
 
       case PWMS1:
@@ -1050,16 +981,6 @@ void setHwRegister16(uint32_t address, uint16_t value){
          //needs to recalculate interrupts here
          return;
 
-      case UBAUD1:
-         //just does timing stuff, should be OK to ignore
-         registerArrayWrite16(UBAUD1, value & 0x2F3F);
-         return;
-
-      case NIPR1:
-         //just does timing stuff, should be OK to ignore
-         registerArrayWrite16(NIPR1, value & 0x87FF);
-         return;
-
       case SPISPC:
          //SPI1 timing, unemulated for now
 
@@ -1067,17 +988,14 @@ void setHwRegister16(uint32_t address, uint16_t value){
       case TCMP2:
       case TPRER1:
       case TPRER2:
-         //simple write, no actions needed
+         //the timer is caught up with the old settings before they change
+         timerUpdate(address == TCMP1 || address == TPRER1 ? 0 : 1);
          registerArrayWrite16(address, value);
+         timerSchedule(address == TCMP1 || address == TPRER1 ? 0 : 1);
+         scheduleChanged();
          return;
 
       default:
-         //writeable bootloader region
-         if(address >= 0xFC0){
-            registerArrayWrite16(address, value);
-            return;
-         }
-
          printUnknownHwAccess(address, value, 16, true);
          return;
    }
@@ -1096,12 +1014,12 @@ void setHwRegister32(uint32_t address, uint32_t value){
    if(sandboxRunning() && address < 0xE00)
       printUnknownHwAccess(address, value, 32, true);
 
-   switch(address){
-      case RTCTIME:
-      case RTCALRM:
-         registerArrayWrite32(address, value & 0x1F3F003F);
-         return;
+   if(registerAccess[address] & REGISTER_WRITE_32){
+      registerArrayWrite32(address, value & registerWriteMask[address]);
+      return;
+   }
 
+   switch(address){
       case IDR:
       case IPR:
          //write to read only register, do nothing
@@ -1117,35 +1035,125 @@ void setHwRegister32(uint32_t address, uint32_t value){
          checkInterrupts();
          return;
 
-      case LSSA:
-         //simple write, no actions needed
-         registerArrayWrite32(address, value);
-         return;
-
       default:
-         //writeable bootloader region
-         if(address >= 0xFC0){
-            registerArrayWrite32(address, value);
-            return;
-         }
-
          printUnknownHwAccess(address, value, 32, true);
          return;
    }
 }
 
+static void buildRegisterAccessTable(void){
+   //simple reads, no actions needed
+   //PGPUEN, PGSEL PMSEL and PMPUEN lack the top 2 bits but that is handled on write
+   //PDSEL lacks the bottom 4 bits but that is handled on write
+   static const uint16_t plainReads8[] = {
+      //16 bit registers being read as 8 bit
+      SPICONT1, SPICONT1 + 1, SPIINTCS, SPIINTCS + 1,
+
+      //basic non GPIO functions
+      SCR, LCKCON, IVR, PWMP1,
+
+      //port d special functions
+      PDPOL, PDIRQEN, PDIRQEG, PDKBEN,
+
+      //I/O direction
+      PBDIR, PDDIR, PEDIR, PFDIR, PJDIR, PKDIR,
+
+      //select between GPIO or special function
+      PBSEL, PCSEL, PDSEL, PESEL, PFSEL, PGSEL, PJSEL, PKSEL, PMSEL,
+
+      //pull up/down enable
+      PAPUEN, PBPUEN, PCPDEN, PDPUEN, PEPUEN, PFPUEN, PGPUEN, PJPUEN, PKPUEN, PMPUEN
+   };
+   static const uint16_t plainReads16[] = {
+      //32 bit registers accessed as 16 bit
+      IDR, IDR + 2, IMR, IMR + 2, IPR, IPR + 2, ISR, ISR + 2,
+
+      CSA, CSB, CSC, CSD, CSGBA, CSGBB, CSGBC, CSGBD, CSUGBA, PLLCR, DRAMC, SDCTRL,
+      RTCISR, RTCCTL, RTCIENR, ILCR, ICR,
+      TCMP1, TCMP2, TPRER1, TPRER2, TCTL1, TCTL2,
+      SPICONT1, SPIINTCS, SPICONT2, SPIDATA2
+   };
+   static const uint16_t plainReads32[] = {
+      ISR, IPR, IMR, RTCTIME, IDR
+   };
+   //simple writes, only the mask is applied
+   static const struct{uint16_t address; uint8_t access; uint32_t mask;} plainWrites[] = {
+      //write without the bottom 3 bits
+      {IVR, REGISTER_WRITE_8, 0xF8},
+
+      //select between GPIO or special function
+      {PCSEL, REGISTER_WRITE_8, 0xFF}, {PESEL, REGISTER_WRITE_8, 0xFF},
+
+      //direction select
+      {PADIR, REGISTER_WRITE_8, 0xFF}, {PCDIR, REGISTER_WRITE_8, 0xFF}, {PDDIR, REGISTER_WRITE_8, 0xFF}, {PEDIR, REGISTER_WRITE_8, 0xFF},
+
+      //pull up/down enable
+      {PAPUEN, REGISTER_WRITE_8, 0xFF}, {PBPUEN, REGISTER_WRITE_8, 0xFF}, {PCPDEN, REGISTER_WRITE_8, 0xFF}, {PDPUEN, REGISTER_WRITE_8, 0xFF},
+      {PEPUEN, REGISTER_WRITE_8, 0xFF}, {PFPUEN, REGISTER_WRITE_8, 0xFF}, {PJPUEN, REGISTER_WRITE_8, 0xFF}, {PKPUEN, REGISTER_WRITE_8, 0xFF},
+
+      //write without the top 2 bits
+      {PMPUEN, REGISTER_WRITE_8, 0x3F}, {PGPUEN, REGISTER_WRITE_8, 0x3F},
+
+      //port data value, nothing known is attached to port
+      {PCDATA, REGISTER_WRITE_8, 0xFF}, {PEDATA, REGISTER_WRITE_8, 0xFF}, {PFDATA, REGISTER_WRITE_8, 0xFF},
+
+      //unemulated, infrared shutdown
+      {PMSEL, REGISTER_WRITE_8, 0x3F}, {PMDIR, REGISTER_WRITE_8, 0x3F}, {PMDATA, REGISTER_WRITE_8, 0x3F},
+
+      //dragonball LCD controller, not attached to anything in Palm m515
+      {LCKCON, REGISTER_WRITE_8, 0xFF}, {LSSA, REGISTER_WRITE_32, 0xFFFFFFFF},
+
+      //unemulated, address line remapping, too CPU intensive to emulate
+      {DRAMMC, REGISTER_WRITE_16, 0xFFFF},
+
+      {CSC, REGISTER_WRITE_16, 0xF9FF}, {CSGBC, REGISTER_WRITE_16, 0xFFFE},
+
+      //just does timing stuff, should be OK to ignore
+      {UBAUD1, REGISTER_WRITE_16, 0x2F3F}, {NIPR1, REGISTER_WRITE_16, 0x87FF},
+
+      {RTCTIME, REGISTER_WRITE_32, 0x1F3F003F}, {RTCALRM, REGISTER_WRITE_32, 0x1F3F003F}
+   };
+   uint32_t index;
+
+   memset(registerAccess, 0x00, sizeof(registerAccess));
+   memset(registerWriteMask, 0x00, sizeof(registerWriteMask));
+
+   for(index = 0; index < sizeof(plainReads8) / sizeof(plainReads8[0]); index++)
+      registerAccess[plainReads8[index]] |= REGISTER_READ_8;
+   for(index = 0; index < sizeof(plainReads16) / sizeof(plainReads16[0]); index++)
+      registerAccess[plainReads16[index]] |= REGISTER_READ_16;
+   for(index = 0; index < sizeof(plainReads32) / sizeof(plainReads32[0]); index++)
+      registerAccess[plainReads32[index]] |= REGISTER_READ_32;
+   for(index = 0; index < sizeof(plainWrites) / sizeof(plainWrites[0]); index++){
+      registerAccess[plainWrites[index].address] |= plainWrites[index].access;
+      registerWriteMask[plainWrites[index].address] = plainWrites[index].mask;
+   }
+
+   //bootloader, the top 0x40 bytes are writeable, 8 bit writes stay in the switch because they write 32 bits
+   for(index = 0xE00; index < 0x1000; index++)
+      registerAccess[index] |= REGISTER_READ_8 | REGISTER_READ_16 | REGISTER_READ_32;
+   for(index = 0xFC0; index < 0x1000; index++){
+      registerAccess[index] |= REGISTER_WRITE_16 | REGISTER_WRITE_32;
+      registerWriteMask[index] = 0xFFFFFFFF;
+   }
+}
+
 void resetHwRegisters(void){
    uint32_t oldRtc = registerArrayRead32(RTCTIME);//preserve RTCTIME
    uint16_t oldDayr = registerArrayRead16(DAYR);//preserve DAYR
 
    memset(palmReg, 0x00, REG_SIZE - BOOTLOADER_SIZE);
-   palmSysclksPerClk32 = 0.0;
+   buildRegisterAccessTable();
+   palmSysclksPerClk32 = 0;
    clk32Counter = 0;
-   pctlrCpuClockDivider = 1.0;
+   pctlrCpuClockDivider = FIXED_POINT_ONE;
    pllSleepWait = -1;
    pllWakeWait = -1;
-   timerCycleCounter[0] = 0.0;
-   timerCycleCounter[1] = 0.0;
+   registerPollClk32s = 0;
+   timerCycleCounter[0] = 0;
+   timerCycleCounter[1] = 0;
+   timerSysclks = 0;
+   timerClk32s = 0;
    timerStatusReadAcknowledge[0] = 0x0000;
    timerStatusReadAcknowledge[1] = 0x0000;
    portDInterruptLastValue = 0x00;
@@ -1284,6 +1292,7 @@ void resetHwRegisters(void){
    updateBacklightAmplifierStatus();
 
    palmSysclksPerClk32 = sysclksPerClk32();
+   restartTimers();
 }
 
 void setRtc(uint16_t days, uint8_t hours, uint8_t minutes, uint8_t seconds){
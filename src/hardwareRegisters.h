@@ -28,10 +28,11 @@
 #define INT_TMR1   0x00000002//level 6
 #define INT_SPI2   0x00000001//level 4
 
-//reasons a timer is triggered
-#define TIMER_REASON_SYSCLK 0x00
-#define TIMER_REASON_TIN    0x01
-#define TIMER_REASON_CLK32  0x02
+//what a timer is counting
+#define TIMER_SOURCE_NONE   0x00
+#define TIMER_SOURCE_SYSCLK 0x01
+#define TIMER_SOURCE_TIN    0x02
+#define TIMER_SOURCE_CLK32  0x03
 
 //chip names
 enum{
@@ -66,9 +67,10 @@ typedef struct{
 extern chip_t   chips[];
 extern int8_t   pllSleepWait;
 extern int8_t   pllWakeWait;
+extern uint8_t  registerPollClk32s;
 extern uint32_t clk32Counter;
-extern double   pctlrCpuClockDivider;
-extern double   timerCycleCounter[];
+extern uint64_t pctlrCpuClockDivider;
+extern uint64_t timerCycleCounter[];
 extern uint16_t timerStatusReadAcknowledge[];
 extern uint8_t  portDInterruptLastValue;
 extern uint16_t spi1RxFifo[];
@@ -84,9 +86,12 @@ extern uint8_t  pwm1ReadPosition;
 extern uint8_t  pwm1WritePosition;
 
 //timing
+uint32_t clk32sUntilNextEvent(void);//how many CLK32s can be run before something needs to be handled
 void beginClk32(void);
-void endClk32(void);
-void addSysclks(double value);//only call between begin/endClk32
+void endClk32(uint32_t clk32s);//clk32s must not be greater than the last value returned by clk32sUntilNextEvent()
+void addSysclks(uint64_t value);//only call between begin/endClk32, 32.32 fixed point
+void updateTimers(void);//brings timerCycleCounter, TCN1 and TCN2 up to date, call before saving them
+void restartTimers(void);//call after timerCycleCounter is changed from outside the timers
 
 //CPU
 bool pllIsOn(void);
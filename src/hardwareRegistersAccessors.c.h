@@ -241,6 +241,23 @@ static void setCsgbd(uint16_t value){
    registerArrayWrite16(CSGBD, value & 0xFFFE);
 }
 
+static void getChipRange(uint8_t chip, uint32_t* start, uint32_t* size){
+   //the area a chip select can cover, CHIP_A1_USB comes right after CHIP_A0_ROM and RAM is mirrored once
+   *start = chips[chip].start;
+   *size = chip == CHIP_A0_ROM || chip == CHIP_DX_RAM ? chips[chip].lineSize * 2 : chips[chip].lineSize;
+}
+
+static void remapChip(uint8_t chip, uint32_t oldStart, uint32_t oldSize){
+   //only the banks the chip used to cover and now covers can change type
+   uint32_t newStart;
+   uint32_t newSize;
+
+   getChipRange(chip, &newStart, &newSize);
+   resetAddressSpaceRange(oldStart, oldSize);
+   if(newStart != oldStart || newSize != oldSize)
+      resetAddressSpaceRange(newStart, newSize);
+}
+
 static void updateCsdAddressLines(void){
    uint16_t dramc = registerArrayRead16(DRAMC);
    uint16_t sdctrl = registerArrayRead16(SDCTRL);
@@ -261,6 +278,9 @@ static void updateCsdAddressLines(void){
       //RAM is not enabled properly
       chips[CHIP_DX_RAM].mask = 0x00000000;
    }
+
+   //the direct RAM pointers depend on the mask
+   remapChip(CHIP_DX_RAM, chips[CHIP_DX_RAM].start, chips[CHIP_DX_RAM].lineSize * 2);
 }
 
 static void setPllfsr(uint16_t value){
@@ -276,6 +296,7 @@ static void setPllfsr(uint16_t value){
 static void setScr(uint8_t value){
    uint8_t oldScr = registerArrayRead8(SCR);
    uint8_t newScr = value & 0x1F;
+   bool oldRegistersProtected = chips[CHIP_REGISTERS].supervisorOnlyProtectedMemory;
 
    //preserve privilege violation, write protect violation and bus error timeout
    newScr |= oldScr & 0xE0;
@@ -292,6 +313,8 @@ static void setScr(uint8_t value){
       else
          setRegisterFFFFAccessMode();
    }
+   if(chips[CHIP_REGISTERS].supervisorOnlyProtectedMemory != oldRegistersProtected)
+      updateBankAttributes();//register protection changed
 }
 
 static void setIlcr(uint16_t value){
@@ -672,7 +695,7 @@ static uint8_t getPortMValue(void){
    return ((registerArrayRead8(PMDATA) & registerArrayRead8(PMDIR)) | (~registerArrayRead8(PMDIR) & 0x20)) & registerArrayRead8(PMSEL);
 }
 
-static void samplePwm1(bool forClk32, double sysclks){
+static void samplePwm1(bool forClk32, uint64_t sysclks){
    uint16_t pwmc1 = registerArrayRead16(PWMC1);
 
    //validate clock mode
@@ -704,6 +727,7 @@ static uint16_t getPwmc1(void){
 
    //clear INT_PWM1 if active
    if(returnValue & 0x0080){
+      flx68000IdleLoopChanged = true;
       clearIprIsrBit(INT_PWM1);
       checkInterrupts();
       registerArrayWrite16(PWMC1, returnValue & 0xFF5F);
@@ -1,160 +1,202 @@
-//both timer functions can call eachother define them here
-static void timer1(uint8_t reason, double sysclk);
-static void timer2(uint8_t reason, double sysclk);
-
-static void timer1(uint8_t reason, double sysclks){
-   uint16_t timer1Control = registerArrayRead16(TCTL1);
-   uint16_t timer1Compare = registerArrayRead16(TCMP1);
-   double timer1OldCount = timerCycleCounter[0];
-   double timer1Prescaler = (registerArrayRead16(TPRER1) & 0x00FF) + 1;
-   bool timer1Enabled = timer1Control & 0x0001;
-
-   if(timer1Enabled){
-      switch((timer1Control & 0x000E) >> 1){
-         case 0x0000://stop counter
-            //do nothing
-            return;
+//timers are only brought up to date when something looks at them or their next event is due, the rest of the time they cost nothing
+static void timerTin(uint8_t timer);
+static void timerSchedule(uint8_t timer);
+static void registerPolled(void);
 
-         case 0x0001://SYSCLK / timer prescaler
-            if(reason != TIMER_REASON_SYSCLK)
-               return;
-            timerCycleCounter[0] += sysclks / timer1Prescaler;
-            break;
-
-         case 0x0002://SYSCLK / 16 / timer prescaler
-            if(reason != TIMER_REASON_SYSCLK)
-               return;
-            timerCycleCounter[0] += sysclks / 16.0 / timer1Prescaler;
-            break;
-
-         case 0x0003://TIN/TOUT pin / timer prescaler, the other timer can be attached to TIN/TOUT
-            if(reason != TIMER_REASON_TIN)
-               return;
-            timerCycleCounter[0] += 1.0 / timer1Prescaler;
-            break;
-
-         default://CLK32 / timer prescaler
-            if(reason != TIMER_REASON_CLK32)
-               return;
-            timerCycleCounter[0] += 1.0 / timer1Prescaler;
-            break;
-      }
+static uint8_t timerClockSource(uint8_t timer, uint32_t* divider){
+   uint16_t timerControl = registerArrayRead16(timer == 0 ? TCTL1 : TCTL2);
 
-      if(timer1OldCount < timer1Compare && timerCycleCounter[0] >= timer1Compare){
-         //the comparison against the old value is to prevent an interrupt on every increment in free running mode
-         //the timer is not cycle accurate and may not hit the value in the compare register perfectly so check if it would have during in the emulated time
-         uint8_t pcrTinToutConfig = registerArrayRead8(PCR) & 0x03;//TIN/TOUT seems not to be physicaly connected but cascaded timers still need to be supported
+   *divider = (registerArrayRead16(timer == 0 ? TPRER1 : TPRER2) & 0x00FF) + 1;
 
-         //interrupt enabled
-         if(timer1Control & 0x0010)
-            setIprIsrBit(INT_TMR1);
-         //checkInterrupts() is run when the clock that called this function is finished
+   if(!(timerControl & 0x0001))
+      return TIMER_SOURCE_NONE;
 
-         //set timer triggered bit
-         registerArrayWrite16(TSTAT1, registerArrayRead16(TSTAT1) | 0x0001);
-         timerStatusReadAcknowledge[0] &= 0xFFFE;//lock bit until next read
+   switch((timerControl & 0x000E) >> 1){
+      case 0x0000://stop counter
+         return TIMER_SOURCE_NONE;
 
-         //increment other timer if enabled
-         if(pcrTinToutConfig == 0x03)
-            timer2(TIMER_REASON_TIN, 0);
+      case 0x0001://SYSCLK / timer prescaler
+         return TIMER_SOURCE_SYSCLK;
 
-         //not free running, reset to 0, to prevent loss of ticks after compare event just subtract timerXCompare
-         if(!(timer1Control & 0x0100))
-            timerCycleCounter[0] -= timer1Compare;
-      }
+      case 0x0002://SYSCLK / 16 / timer prescaler
+         *divider *= 16;
+         return TIMER_SOURCE_SYSCLK;
+
+      case 0x0003://TIN/TOUT pin / timer prescaler, the other timer can be attached to TIN/TOUT
+         return TIMER_SOURCE_TIN;
 
-      if(timerCycleCounter[0] > 0xFFFF)
-         timerCycleCounter[0] -= 0xFFFF;
-      registerArrayWrite16(TCN1, (uint16_t)timerCycleCounter[0]);
+      default://CLK32 / timer prescaler
+         return TIMER_SOURCE_CLK32;
    }
 }
 
-static void timer2(uint8_t reason, double sysclks){
-   uint16_t timer2Control = registerArrayRead16(TCTL2);
-   uint16_t timer2Compare = registerArrayRead16(TCMP2);
-   double timer2OldCount = timerCycleCounter[1];
-   double timer2Prescaler = (registerArrayRead16(TPRER2) & 0x00FF) + 1;
-   bool timer2Enabled = timer2Control & 0x0001;
-
-   if(timer2Enabled){
-      switch((timer2Control & 0x000E) >> 1){
-         case 0x0000://stop counter
-            //do nothing
-            return;
+static void timerAddTicks(uint8_t timer, uint64_t ticks){
+   //ticks is 32.32 fixed point
+   uint16_t timerControl = registerArrayRead16(timer == 0 ? TCTL1 : TCTL2);
+   uint64_t timerCompare = (uint64_t)registerArrayRead16(timer == 0 ? TCMP1 : TCMP2) << 32;
+   uint64_t timerOldCount = timerCycleCounter[timer];
 
-         case 0x0001://SYSCLK / timer prescaler
-            if(reason != TIMER_REASON_SYSCLK)
-               return;
-            timerCycleCounter[1] += sysclks / timer2Prescaler;
-            break;
-
-         case 0x0002://SYSCLK / 16 / timer prescaler
-            if(reason != TIMER_REASON_SYSCLK)
-               return;
-            timerCycleCounter[1] += sysclks / 16.0 / timer2Prescaler;
-            break;
-
-         case 0x0003://TIN/TOUT pin / timer prescaler, the other timer can be attached to TIN/TOUT
-            if(reason != TIMER_REASON_TIN)
-               return;
-            timerCycleCounter[1] += 1.0 / timer2Prescaler;
-            break;
-
-         default://CLK32 / timer prescaler
-            if(reason != TIMER_REASON_CLK32)
-               return;
-            timerCycleCounter[1] += 1.0 / timer2Prescaler;
-            break;
-      }
+   timerCycleCounter[timer] += ticks;
 
-      if(timer2OldCount < timer2Compare && timerCycleCounter[1] >= timer2Compare){
-         //the comparison against the old value is to prevent an interrupt on every increment in free running mode
-         //the timer is not cycle accurate and may not hit the value in the compare register perfectly so check if it would have during in the emulated time
-         uint8_t pcrTinToutConfig = registerArrayRead8(PCR) & 0x03;//TIN/TOUT seems not to be physicaly connected but cascaded timers still need to be supported
+   if(timerOldCount < timerCompare && timerCycleCounter[timer] >= timerCompare){
+      //the comparison against the old value is to prevent an interrupt on every increment in free running mode
+      //the timer is not cycle accurate and may not hit the value in the compare register perfectly so check if it would have during in the emulated time
+      uint8_t pcrTinToutConfig = registerArrayRead8(PCR) & 0x03;//TIN/TOUT seems not to be physicaly connected but cascaded timers still need to be supported
 
-         //interrupt enabled
-         if(timer2Control & 0x0010)
-            setIprIsrBit(INT_TMR2);
-         //checkInterrupts() is run when the clock that called this function is finished
+      //interrupt enabled
+      if(timerControl & 0x0010)
+         setIprIsrBit(timer == 0 ? INT_TMR1 : INT_TMR2);
+      //checkInterrupts() is run when the clock that called this function is finished
 
-         //set timer triggered bit
-         registerArrayWrite16(TSTAT2, registerArrayRead16(TSTAT2) | 0x0001);
-         timerStatusReadAcknowledge[1] &= 0xFFFE;//lock bit until next read
+      //this can happen when TCN is read, a loop polling TCN and TSTAT has to see TSTAT change
+      flx68000IdleLoopChanged = true;
 
-         //increment other timer if enabled
-         if(pcrTinToutConfig == 0x02)
-            timer1(TIMER_REASON_TIN, 0);
+      //set timer triggered bit
+      registerArrayWrite16(timer == 0 ? TSTAT1 : TSTAT2, registerArrayRead16(timer == 0 ? TSTAT1 : TSTAT2) | 0x0001);
+      timerStatusReadAcknowledge[timer] &= 0xFFFE;//lock bit until next read
 
-         //not free running, reset to 0, to prevent loss of ticks after compare event just subtract timerXCompare
-         if(!(timer2Control & 0x0100))
-            timerCycleCounter[1] -= timer2Compare;
-      }
+      //increment other timer if enabled
+      if(pcrTinToutConfig == (timer == 0 ? 0x03 : 0x02))
+         timerTin(!timer);
 
-      if(timerCycleCounter[1] > 0xFFFF)
-         timerCycleCounter[1] -= 0xFFFF;
-      registerArrayWrite16(TCN2, (uint16_t)timerCycleCounter[1]);
+      //not free running, reset to 0, to prevent loss of ticks after compare event just subtract timerXCompare
+      if(!(timerControl & 0x0100))
+         timerCycleCounter[timer] -= timerCompare;
    }
+
+   if(timerCycleCounter[timer] > (uint64_t)0xFFFF << 32)
+      timerCycleCounter[timer] -= (uint64_t)0xFFFF << 32;
+   registerArrayWrite16(timer == 0 ? TCN1 : TCN2, timerCycleCounter[timer] >> 32);
+}
+
+static void timerTin(uint8_t timer){
+   uint32_t divider;
+
+   if(timerClockSource(timer, &divider) == TIMER_SOURCE_TIN){
+      timerAddTicks(timer, FIXED_POINT_ONE / divider);
+      timerSchedule(timer);
+   }
+}
+
+static void timerUpdate(uint8_t timer){
+   uint32_t divider;
+   uint8_t source = timerClockSource(timer, &divider);
+   uint64_t ticks;
+
+   //only whole ticks are taken from the clock, the leftover is counted on the next update so updating more often doesnt change the result
+   switch(source){
+      case TIMER_SOURCE_SYSCLK:
+         ticks = (timerSysclks - timerSysclkStamp[timer]) / divider;
+         timerSysclkStamp[timer] += ticks * divider;
+         timerClk32Stamp[timer] = timerClk32s;
+         timerAddTicks(timer, ticks);
+         break;
+
+      case TIMER_SOURCE_CLK32:
+         ticks = (timerClk32s - timerClk32Stamp[timer]) / divider;
+         timerClk32Stamp[timer] += ticks * divider;
+         timerSysclkStamp[timer] = timerSysclks;
+         timerAddTicks(timer, ticks);
+         break;
+
+      default:
+         //not counting clocks, time passing has no effect
+         timerSysclkStamp[timer] = timerSysclks;
+         timerClk32Stamp[timer] = timerClk32s;
+         break;
+   }
+
+   timerSchedule(timer);
+}
+
+static void timerSchedule(uint8_t timer){
+   //the counter moves at a fixed rate so the clock that makes it reach the compare value or roll over can be worked out directly
+   uint32_t divider;
+   uint8_t source = timerClockSource(timer, &divider);
+   uint64_t timerCompare = (uint64_t)registerArrayRead16(timer == 0 ? TCMP1 : TCMP2) << 32;
+   uint64_t ticksUntilEvent;
+
+   timerEventSysclks[timer] = UINT64_MAX;
+   timerEventClk32s[timer] = UINT64_MAX;
+
+   if(source != TIMER_SOURCE_SYSCLK && source != TIMER_SOURCE_CLK32)
+      return;
+
+   if(timerCycleCounter[timer] < timerCompare)
+      ticksUntilEvent = timerCompare - timerCycleCounter[timer];
+   else
+      ticksUntilEvent = ((uint64_t)0xFFFF << 32) + 1 - timerCycleCounter[timer];
+
+   if(source == TIMER_SOURCE_SYSCLK)
+      timerEventSysclks[timer] = ticksUntilEvent * divider;
+   else
+      timerEventClk32s[timer] = ticksUntilEvent * divider;
+}
+
+static uint16_t timerRead(uint8_t timer){
+   //the timeslice the CPU is in hasnt been added to the timers yet, TCN has to include it to be right at the time of the read
+   uint32_t divider;
+   uint8_t source;
+   uint64_t timerCompare = (uint64_t)registerArrayRead16(timer == 0 ? TCMP1 : TCMP2) << 32;
+   uint64_t count;
+
+   timerUpdate(timer);
+   registerPolled();
+
+   source = timerClockSource(timer, &divider);
+   count = timerCycleCounter[timer];
+   if(source == TIMER_SOURCE_SYSCLK)
+      count += (timerSysclks + flx68000SysclksRan() - timerSysclkStamp[timer]) / divider;
+   else if(source == TIMER_SOURCE_CLK32)
+      count += (timerClk32s + ((uint64_t)flx68000Clk32sRan() << 32) - timerClk32Stamp[timer]) / divider;
+
+   //the compare event is handled at the end of the CLK32 its in, until then the counter waits at the compare value
+   if(timerCycleCounter[timer] < timerCompare && count >= timerCompare)
+      count = timerCompare;
+   else if(count > (uint64_t)0xFFFF << 32)
+      count -= (uint64_t)0xFFFF << 32;
+
+   //a loop waiting for TCN to reach a value isnt idle while TCN is still moving
+   if(count >> 32 != registerArrayRead16(timer == 0 ? TCN1 : TCN2))
+      flx68000IdleLoopChanged = true;
+
+   return count >> 32;
+}
+
+void updateTimers(void){
+   timerUpdate(0);
+   timerUpdate(1);
+}
+
+void restartTimers(void){
+   timerSysclkStamp[0] = timerSysclks;
+   timerSysclkStamp[1] = timerSysclks;
+   timerClk32Stamp[0] = timerClk32s;
+   timerClk32Stamp[1] = timerClk32s;
+   timerSchedule(0);
+   timerSchedule(1);
 }
 
-static double dmaclksPerClk32(void){
+static uint64_t dmaclksPerClk32(void){
+   //the dividers are all powers of 2 so this is exact in 32.32 fixed point
    uint16_t pllcr = registerArrayRead16(PLLCR);
    uint16_t pllfsr = registerArrayRead16(PLLFSR);
    uint8_t p = pllfsr & 0x00FF;
    uint8_t q = pllfsr >> 8 & 0x000F;
-   double dmaclks = 2.0 * (14.0 * (p + 1.0) + q + 1.0);
+   uint64_t dmaclks = (uint64_t)(2 * (14 * (p + 1) + q + 1)) << 32;
 
    //prescaler 1 enabled, divide by 2
    if(pllcr & 0x0080)
-      dmaclks /= 2.0;
+      dmaclks /= 2;
 
    //prescaler 2 enabled, divides value from prescaler 1 by 2
    if(pllcr & 0x0020)
-      dmaclks /= 2.0;
+      dmaclks /= 2;
 
    return dmaclks;
 }
 
-static double sysclksPerClk32(void){
+static uint64_t sysclksPerClk32(void){
    uint8_t sysclkSelect = registerArrayRead16(PLLCR) >> 8 & 0x0007;
 
    //>= 4 means run at full speed, no divider
@@ -301,18 +343,100 @@ static void rtcAddSecondClk32(void){
    watchdogSecondTickClk32();
 }
 
+static uint32_t timerClk32sUntilEvent(uint8_t timer){
+   uint64_t remaining;
+
+   if(timerEventSysclks[timer] != UINT64_MAX){
+      //SYSCLK timers dont run with the PLL off
+      if(palmSysclksPerClk32 == 0)
+         return UINT32_MAX;
+
+      remaining = timerEventSysclks[timer] - u64Min(timerSysclks - timerSysclkStamp[timer], timerEventSysclks[timer]);
+      return u32Max(u64Min((remaining + palmSysclksPerClk32 - 1) / palmSysclksPerClk32, UINT32_MAX), 1);
+   }
+
+   if(timerEventClk32s[timer] != UINT64_MAX){
+      remaining = timerEventClk32s[timer] - u64Min(timerClk32s - timerClk32Stamp[timer], timerEventClk32s[timer]);
+      return u32Max(u64Min((remaining + FIXED_POINT_ONE - 1) >> 32, UINT32_MAX), 1);
+   }
+
+   return UINT32_MAX;
+}
+
+uint32_t clk32sUntilNextEvent(void){
+   //every CLK32 in between 2 events is identical, so the CPU can run them all in 1 slice and only the last one needs to be handled by endClk32()
+   uint32_t clk32s = CRYSTAL_FREQUENCY - clk32Counter;//RTC second and watchdog
+   uint16_t rtcInterruptsEnabled = registerArrayRead16(RTCIENR);
+
+   //RTI, only the fastest enabled rate matters
+   if((registerArrayRead16(RTCCTL) & 0x0080 || registerArrayRead16(WATCHDOG) & 0x0001) && rtcInterruptsEnabled & 0xFF00){
+      uint32_t rtiPeriod = CRYSTAL_FREQUENCY / 512;
+
+      while(!(rtcInterruptsEnabled & 0x8000)){
+         rtcInterruptsEnabled <<= 1;
+         rtiPeriod <<= 1;
+      }
+      clk32s = u32Min(clk32s, rtiPeriod - clk32Counter % rtiPeriod);
+   }
+
+   clk32s = u32Min(clk32s, timerClk32sUntilEvent(0));
+   clk32s = u32Min(clk32s, timerClk32sUntilEvent(1));
+
+   //PWM1 plays samples and fires FIFO interrupts at audio rate, dont batch CLK32s while its on
+   if(registerArrayRead16(PWMC1) & 0x0010)
+      clk32s = 1;
+
+   if(pllSleepWait != -1)
+      clk32s = u32Min(clk32s, pllSleepWait + 1);
+   if(pllWakeWait != -1)
+      clk32s = u32Min(clk32s, pllWakeWait + 1);
+
+   //the CLK32 bit in PLLFSR or a timer counter is being polled, let the CPU see every time it changes
+   if(registerPollClk32s > 0)
+      clk32s = 1;
+
+   return clk32s;
+}
+
+static void scheduleChanged(void){
+   //a register that changes when the next event happens was written, stop the current slice so clk32sUntilNextEvent() is run again
+   flx68000EndTimeslice();
+}
+
+static void registerPolled(void){
+   //HwrDelay counts CLK32 bit changes and delay loops wait for TCN, once one is being read CLK32s are run 1 at a time until it hasnt been read for a whole CLK32
+   if(registerPollClk32s == 0)
+      scheduleChanged();
+   registerPollClk32s = 2;
+}
+
 void beginClk32(void){
-   palmClk32Sysclks = 0.0;
+   palmClk32Sysclks = 0;
 }
 
-void endClk32(void){
-   //currently using toggle on read hack
-   //registerArrayWrite16(PLLFSR, registerArrayRead16(PLLFSR) ^ 0x8000);
+void endClk32(uint32_t clk32s){
+   int32_t skippedClk32s = clk32s - 1;
+
+   //the CLK32 bit flips once per CLK32
+   if(clk32s & 1)
+      registerArrayWrite16(PLLFSR, registerArrayRead16(PLLFSR) ^ 0x8000);
+   if(registerPollClk32s > 0)
+      registerPollClk32s--;
+
+   //nothing happens on the CLK32s before the last one, just move the counters forward
+   clk32Counter += skippedClk32s;
+   if(pllSleepWait != -1)
+      pllSleepWait = s32Max(pllSleepWait - skippedClk32s, 0);
+   if(pllWakeWait != -1)
+      pllWakeWait = s32Max(pllWakeWait - skippedClk32s, 0);
 
    //second position counter
    if(clk32Counter >= CRYSTAL_FREQUENCY - 1){
       clk32Counter = 0;
       rtcAddSecondClk32();
+
+      //keeps the time since the last timer update too small to overflow
+      updateTimers();
    }
    else{
       clk32Counter++;
@@ -322,15 +446,18 @@ void endClk32(void){
    if(registerArrayRead16(RTCCTL) & 0x0080 || registerArrayRead16(WATCHDOG) & 0x01)
       rtiInterruptClk32();
 
-   timer1(TIMER_REASON_CLK32, 0);
-   timer2(TIMER_REASON_CLK32, 0);
-   samplePwm1(true/*forClk32*/, 0.0);
+   timerClk32s += (uint64_t)clk32s << 32;
+   if(timerClk32s - timerClk32Stamp[0] >= timerEventClk32s[0])
+      timerUpdate(0);
+   if(timerClk32s - timerClk32Stamp[1] >= timerEventClk32s[1])
+      timerUpdate(1);
+   samplePwm1(true/*forClk32*/, 0);
 
    //PLLCR sleep wait
    if(pllSleepWait != -1){
       if(pllSleepWait == 0){
          //disable PLL and CPU
-         palmSysclksPerClk32 = 0.0;
+         palmSysclksPerClk32 = 0;
          debugLog("PLL disabled, CPU is off!\n");
       }
       pllSleepWait--;
@@ -350,9 +477,12 @@ void endClk32(void){
    checkInterrupts();
 }
 
-void addSysclks(double count){
-   timer1(TIMER_REASON_SYSCLK, count);
-   timer2(TIMER_REASON_SYSCLK, count);
+void addSysclks(uint64_t count){
+   timerSysclks += count;
+   if(timerSysclks - timerSysclkStamp[0] >= timerEventSysclks[0])
+      timerUpdate(0);
+   if(timerSysclks - timerSysclkStamp[1] >= timerEventSysclks[1])
+      timerUpdate(1);
    samplePwm1(false/*forClk32*/, count);
 
    checkInterrupts();
@@ -360,11 +490,15 @@ void addSysclks(double count){
 }
 
 static int32_t audioGetFramePercentIncrementFromClk32s(int32_t count){
-   return (double)count / ((double)CRYSTAL_FREQUENCY / EMU_FPS) * AUDIO_END_OF_FRAME;
+   //a CLK32 is always the same amount of audio clocks no matter how many SYSCLKs are in it
+   return count * (AUDIO_CLOCK_RATE / CRYSTAL_FREQUENCY);
 }
 
-static int32_t audioGetFramePercentIncrementFromSysclks(double count){
-   return count / (palmSysclksPerClk32 * ((double)CRYSTAL_FREQUENCY / EMU_FPS)) * AUDIO_END_OF_FRAME;
+static int32_t audioGetFramePercentIncrementFromSysclks(uint64_t count){
+   //split into whole and partial CLK32s so the multiply cant overflow
+   if(palmSysclksPerClk32 == 0)
+      return 0;
+   return count / palmSysclksPerClk32 * (AUDIO_CLOCK_RATE / CRYSTAL_FREQUENCY) + count % palmSysclksPerClk32 * (AUDIO_CLOCK_RATE / CRYSTAL_FREQUENCY) / palmSysclksPerClk32;
 }
 
 static int32_t audioGetFramePercentage(void){
@@ -290,6 +290,44 @@ void m68k_pulse_reset(void);
 /* execute num_cycles worth of instructions.  returns number of cycles used */
 int32_t m68k_execute(int32_t num_cycles);
 
+#if M68K_EMULATE_ADDRESS_ERROR
+#include <setjmp.h>
+
+/* Address and bus errors abort the current opcode with a longjmp() to
+ * m68ki_aerr_trap, m68k_execute() does a setjmp() on it every call.
+ * m68k_execute_shared_trap() skips that, the host must have done the setjmp()
+ * itself in a function that is still running, when it returns nonzero
+ * m68k_execute_after_address_error() takes the exception and finishes the
+ * aborted call, returning the cycles used since it was started.
+ * Saves a setjmp() on every call when m68k_execute() is called very often.
+ */
+extern jmp_buf m68ki_aerr_trap;
+int32_t m68k_execute_after_address_error(void);
+#endif /* M68K_EMULATE_ADDRESS_ERROR */
+int32_t m68k_execute_shared_trap(int32_t num_cycles);
+
+/* Throw away all predecoded blocks, must be called when memory that was
+ * reported as cacheable by M68K_BLOCK_CACHE_CALLBACK() may have changed.
+ */
+void m68k_flush_block_cache(void);
+
+/* Opcode pairs that are run as 1 when M68K_FUSED_OPCODES is on */
+enum
+{
+   M68K_FUSION_TEST_BCC,    /* TST, CMP, CMPA, CMPM or CMPI then Bcc.B */
+   M68K_FUSION_MOVE_DBF,    /* MOVE.L (An)+,(Am)+ then DBF */
+   M68K_FUSION_LINK_MOVEM,  /* LINK then MOVEM.L list,-(A7) */
+   M68K_FUSIONS
+};
+
+/* How often the first opcode of a pair ran(seen) and how often the second
+ * one matched and was run fused(fused), for tuning the pairs against real
+ * code, always 0 unless M68K_FUSED_OPCODES and M68K_FUSION_STATISTICS are on.
+ */
+const char* m68k_get_fusion_name(uint32_t fusion);
+void m68k_get_fusion_counts(uint32_t fusion, uint64_t* seen, uint64_t* fused);
+void m68k_clear_fusion_counts(void);
+
 /* These functions let you read/write/modify the number of cycles left to run
  * while m68k_execute() is running.
  * These are useful if the 68k accesses a memory-mapped port on another device
@@ -140,6 +140,111 @@
 #endif
 #define M68K_INSTRUCTION_CALLBACK() sandboxOnOpcodeRun()
 
+/* If ON, m68k_execute() translates straight line runs of simple opcodes from
+ * memory M68K_BLOCK_CACHE_CALLBACK() reports as cacheable into x86-64 code
+ * the first time they run and runs that after(m68kjit.c), it replaces the
+ * block cache and m68k_flush_block_cache() throws the translations away.
+ * Every other opcode, exceptions and trace mode go through the normal
+ * handlers, it is off when the instruction hook is on.
+ * Needs an x86-64 Linux host that allows writable and executable memory,
+ * it falls back to the handlers if the memory cant be allocated.
+ */
+#if defined(EMU_X86_64_JIT) && defined(EMU_NO_SAFETY) && defined(__x86_64__) && defined(__linux__) && !(defined(EMU_DEBUG) && defined(EMU_SANDBOX) && defined(EMU_SANDBOX_OPCODE_LEVEL_DEBUG)) && !defined(EMU_THREADED_M68K) && !defined(EMU_FUSED_M68K)
+#define M68K_X86_64_JIT             OPT_ON
+#else
+#define M68K_X86_64_JIT             OPT_OFF
+#endif
+
+/* If ON, opcodes run from memory that never changes are recorded into
+ * predecoded blocks(opcode, handler and cycles) the first time they run and
+ * replayed from the block after that.
+ * M68K_BLOCK_CACHE_CALLBACK(A) must return true if the opcode at A can be
+ * cached and m68k_flush_block_cache() must be called whenever that changes.
+ * Trace mode and the instruction hook are not checked while replaying.
+ */
+#if defined(EMU_NO_SAFETY) && !(defined(EMU_DEBUG) && defined(EMU_SANDBOX) && defined(EMU_SANDBOX_OPCODE_LEVEL_DEBUG)) && !defined(EMU_THREADED_M68K) && !defined(EMU_FUSED_M68K) && !M68K_X86_64_JIT
+#define M68K_BLOCK_CACHE            OPT_SPECIFY_HANDLER
+#else
+#define M68K_BLOCK_CACHE            OPT_OFF
+#endif
+#define M68K_BLOCK_CACHE_CALLBACK(A) flx68000PcInRom(A)
+
+/* If ON, a DBF that branches back to a single MOVE.L (Ay)+,(Ax)+ or
+ * MOVE.L Dy,(Ax)+ runs as many passes of the loop as fit in the cycles left
+ * at once with M68K_BULK_COPY_CALLBACK(DEST, SOURCE, COUNT) or
+ * M68K_BULK_FILL_CALLBACK(DEST, VALUE, COUNT), they return how many longs
+ * they did and must only do longs that are plain memory.
+ * The registers, flags and cycles end up the same as running the loop.
+ */
+#if !(defined(EMU_DEBUG) && defined(EMU_SANDBOX) && defined(EMU_SANDBOX_OPCODE_LEVEL_DEBUG))
+#define M68K_BULK_MOVE_LOOPS        OPT_SPECIFY_HANDLER
+#else
+#define M68K_BULK_MOVE_LOOPS        OPT_OFF
+#endif
+#define M68K_BULK_COPY_CALLBACK(DEST, SOURCE, COUNT) ramBulkCopy32(DEST, SOURCE, COUNT)
+#define M68K_BULK_FILL_CALLBACK(DEST, VALUE, COUNT) ramBulkFill32(DEST, VALUE, COUNT)
+
+/* If ON, M68K_BACKWARD_BRANCH_CALLBACK() is run after every Bcc, BRA, BSR and
+ * DBcc that branches backwards, REG_PC is already the branch target.
+ * It may end the timeslice with SET_CYCLES(0) to skip a loop that can only
+ * repeat itself until then.
+ */
+#if !(defined(EMU_DEBUG) && defined(EMU_SANDBOX) && defined(EMU_SANDBOX_OPCODE_LEVEL_DEBUG))
+#define M68K_BACKWARD_BRANCH_HOOK   OPT_SPECIFY_HANDLER
+#else
+#define M68K_BACKWARD_BRANCH_HOOK   OPT_OFF
+#endif
+#define M68K_BACKWARD_BRANCH_CALLBACK() (flx68000IdleLoopPolled ? flx68000IdleLoopCheck() : (void)0)
+
+/* If ON, m68k_execute() runs opcodes with m68ki_execute_threaded() from
+ * m68kthreaded.c, every handler is a label in that 1 function and jumps to the
+ * next handler with a computed goto instead of returning to a central loop.
+ * Needs the GCC "labels as values" extension(GCC and Clang).
+ * Trace mode and the instruction hook are not checked.
+ * m68kthreaded.c is generated from the handlers by tools/desktop/makeThreadedM68k.
+ */
+#if defined(EMU_THREADED_M68K) && defined(__GNUC__) && defined(EMU_NO_SAFETY) && !(defined(EMU_DEBUG) && defined(EMU_SANDBOX) && defined(EMU_SANDBOX_OPCODE_LEVEL_DEBUG))
+#define M68K_THREADED_DISPATCH      OPT_ON
+#else
+#define M68K_THREADED_DISPATCH      OPT_OFF
+#endif
+
+/* If ON, when the opcode that just ran starts a common pair(CMP then Bcc and
+ * so on, see m68k.h) the next opcode is run straight after it without going
+ * back to the main loop, and if it is the second opcode of the pair it runs
+ * from a handler inlined for that pair.
+ * Trace mode and the instruction hook are not checked between the 2 opcodes,
+ * so this needs trace mode to be off.
+ */
+#if defined(EMU_FUSED_M68K) && defined(EMU_NO_SAFETY) && !M68K_THREADED_DISPATCH && !(defined(EMU_DEBUG) && defined(EMU_SANDBOX) && defined(EMU_SANDBOX_OPCODE_LEVEL_DEBUG))
+#define M68K_FUSED_OPCODES          OPT_ON
+#else
+#define M68K_FUSED_OPCODES          OPT_OFF
+#endif
+
+/* If ON, M68K_FUSED_OPCODES counts how often the first opcode of each pair
+ * ran and how often the pair was fused, see m68k_get_fusion_counts().
+ */
+#if defined(EMU_FUSION_STATISTICS)
+#define M68K_FUSION_STATISTICS      OPT_ON
+#else
+#define M68K_FUSION_STATISTICS      OPT_OFF
+#endif
+
+/* If ON, ADD, SUB and CMP only record their operands and N, Z, V and C are
+ * worked out from them when an opcode, exception or m68k_get_reg() needs
+ * them, so results that are overwritten before being tested cost nothing.
+ * The flags in m68ki_cpu are only valid after m68ki_resolve_flags().
+ * Handlers that overwrite all 4 flags discard the lazy ones before their
+ * operand fetch, an address or bus error in that fetch would stack a stale
+ * SR, so this needs the errors to be off.
+ */
+#if defined(EMU_LAZY_FLAGS) && defined(EMU_NO_SAFETY)
+#define M68K_LAZY_FLAGS             OPT_ON
+#else
+#define M68K_LAZY_FLAGS             OPT_OFF
+#endif
+
 /* If ON, the CPU will emulate the 4-byte prefetch queue of a real 68000 */
 #define M68K_EMULATE_PREFETCH       OPT_OFF
 
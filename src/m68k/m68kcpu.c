@@ -38,6 +38,8 @@
 /* ================================ INCLUDES ============================== */
 /* ======================================================================== */
 
+#include <string.h>
+
 #include "m68kops.h"
 #include "m68kcpu.h"
 
@@ -426,6 +428,9 @@ uint32_t m68k_get_reg(void* context, m68k_register_t regnum)
 {
    m68ki_cpu_core* cpu = context != NULL ?(m68ki_cpu_core*)context : &m68ki_cpu;
 
+   if(context == NULL)
+      m68ki_resolve_flags();
+
    switch(regnum)
    {
       case M68K_REG_D0:	return cpu->dar[0];
@@ -635,63 +640,534 @@ void m68k_set_cpu_type(uint32_t cpu_type)
    }
 }
 
-/* Execute some instructions until we use up num_cycles clock cycles */
-/* ASG: removed per-instruction interrupt checks */
-int32_t m68k_execute(int32_t num_cycles)
+#if M68K_LAZY_FLAGS
+void m68ki_resolve_lazy_flags(void)
 {
-   /* Make sure we're not stopped */
-   if(!CPU_STOPPED)
+   uint src = FLAGS_SRC;
+   uint dst = FLAGS_DST;
+   uint res;
+
+   switch(FLAGS_OP)
    {
-      /* Set our pool of clock cycles available */
-      SET_CYCLES(num_cycles);
-      m68ki_initial_cycles = num_cycles;
+      case M68KI_FLAGS_ADD_8:
+         res = src + dst;
+         FLAG_N = NFLAG_8(res);
+         FLAG_Z = MASK_OUT_ABOVE_8(res);
+         FLAG_V = VFLAG_ADD_8(src, dst, res);
+         FLAG_C = CFLAG_8(res);
+         break;
+      case M68KI_FLAGS_ADD_16:
+         res = src + dst;
+         FLAG_N = NFLAG_16(res);
+         FLAG_Z = MASK_OUT_ABOVE_16(res);
+         FLAG_V = VFLAG_ADD_16(src, dst, res);
+         FLAG_C = CFLAG_16(res);
+         break;
+      case M68KI_FLAGS_ADD_32:
+         res = src + dst;
+         FLAG_N = NFLAG_32(res);
+         FLAG_Z = MASK_OUT_ABOVE_32(res);
+         FLAG_V = VFLAG_ADD_32(src, dst, res);
+         FLAG_C = CFLAG_ADD_32(src, dst, res);
+         break;
+      case M68KI_FLAGS_SUB_8:
+         res = dst - src;
+         FLAG_N = NFLAG_8(res);
+         FLAG_Z = MASK_OUT_ABOVE_8(res);
+         FLAG_V = VFLAG_SUB_8(src, dst, res);
+         FLAG_C = CFLAG_8(res);
+         break;
+      case M68KI_FLAGS_SUB_16:
+         res = dst - src;
+         FLAG_N = NFLAG_16(res);
+         FLAG_Z = MASK_OUT_ABOVE_16(res);
+         FLAG_V = VFLAG_SUB_16(src, dst, res);
+         FLAG_C = CFLAG_16(res);
+         break;
+      case M68KI_FLAGS_SUB_32:
+         res = dst - src;
+         FLAG_N = NFLAG_32(res);
+         FLAG_Z = MASK_OUT_ABOVE_32(res);
+         FLAG_V = VFLAG_SUB_32(src, dst, res);
+         FLAG_C = CFLAG_SUB_32(src, dst, res);
+         break;
+   }
+   FLAGS_OP = M68KI_FLAGS_RESOLVED;
+}
+#endif /* M68K_LAZY_FLAGS */
 
-      /* ASG: update cycles */
-      USE_CYCLES(CPU_INT_CYCLES);
-      CPU_INT_CYCLES = 0;
+#if M68K_BLOCK_CACHE
+/* Predecoded blocks, a block is the path the PC took the first time it was
+ * run from that address, if the PC goes somewhere else when it is replayed the
+ * block is left and normal fetching takes over again.
+ */
+#define M68K_BLOCK_CACHE_BLOCKS  4096
+#define M68K_BLOCK_CACHE_OPCODES 32
 
-      /* Return point if we had an address error */
-      m68ki_set_address_error_trap(); /* auto-disable (see m68kcpu.h) */
+typedef struct
+{
+   void (*handler)(void);
+   uint pc;
+   uint16 ir;
+   uint8 cycles;
+} m68ki_cached_opcode;
 
-      /* Main loop.  Keep going until we run out of clock cycles */
-      do
-      {
-         /* Set tracing accodring to T1. (T0 is done inside instruction) */
-         m68ki_trace_t1(); /* auto-disable (see m68kcpu.h) */
+typedef struct
+{
+   uint start_pc;
+   uint length;   /* 0 = empty */
+   m68ki_cached_opcode opcodes[M68K_BLOCK_CACHE_OPCODES];
+} m68ki_cached_block;
 
-         /* Set the address space for reads */
-         m68ki_use_data_space(); /* auto-disable (see m68kcpu.h) */
+static m68ki_cached_block m68ki_block_cache[M68K_BLOCK_CACHE_BLOCKS];
 
-         /* Call external hook to peek at CPU */
-         m68ki_instr_hook(); /* auto-disable (see m68kcpu.h) */
+void m68k_flush_block_cache(void)
+{
+   uint i;
 
-         /* Record previous program counter */
-         REG_PPC = REG_PC;
+   for(i = 0; i < M68K_BLOCK_CACHE_BLOCKS; i++)
+      m68ki_block_cache[i].length = 0;
+}
+
+/* Run instructions from the block at the current PC, recording the block first if needed */
+static void m68ki_execute_block(void)
+{
+   m68ki_cached_block* block = &m68ki_block_cache[(REG_PC >> 1) & (M68K_BLOCK_CACHE_BLOCKS - 1)];
+   m68ki_cached_opcode* opcode;
+   m68ki_cached_opcode* end;
 
-         /* Read an instruction and call its handler */
+   if(block->length == 0 || block->start_pc != REG_PC)
+   {
+      if(!M68K_BLOCK_CACHE_CALLBACK(REG_PC))
+      {
+         /* not cacheable, run 1 opcode the normal way */
+         REG_PPC = REG_PC;
          REG_IR = m68ki_read_imm_16();
-         m68ki_instruction_jump_table[REG_IR]();
+         m68ki_instruction_handler(REG_IR)();
          USE_CYCLES(CYC_INSTRUCTION[REG_IR]);
+         return;
+      }
+
+      /* record a new block while running it */
+      block->start_pc = REG_PC;
+      block->length = 0;
+      do
+      {
+         opcode = &block->opcodes[block->length++];
+         opcode->pc = REG_PC;
+         REG_PPC = REG_PC;
+         REG_IR = m68ki_read_imm_16();
+         opcode->ir = REG_IR;
+         opcode->handler = m68ki_instruction_handler(REG_IR);
+         opcode->cycles = CYC_INSTRUCTION[REG_IR];
+         opcode->handler();
+         USE_CYCLES(opcode->cycles);
+      } while(GET_CYCLES() > 0 && block->length < M68K_BLOCK_CACHE_OPCODES && M68K_BLOCK_CACHE_CALLBACK(REG_PC));
+      return;
+   }
+
+   /* replay, every opcode checks that the PC is still on the recorded path */
+   opcode = block->opcodes;
+   end = opcode + block->length;
+   do
+   {
+      REG_PPC = REG_PC;
+      REG_IR = opcode->ir;
+      REG_PC += 2;
+      opcode->handler();
+      USE_CYCLES(opcode->cycles);
+      opcode++;
+   } while(opcode != end && REG_PC == opcode->pc && GET_CYCLES() > 0);
+}
+#elif M68K_X86_64_JIT
+void m68k_flush_block_cache(void)
+{
+   m68ki_flush_jit();
+}
+#else
+void m68k_flush_block_cache(void)
+{
+}
+#endif /* M68K_BLOCK_CACHE */
+
+#if M68K_BULK_MOVE_LOOPS
+void m68ki_bulk_move_loop(uint* r_counter)
+{
+   uint body;
+   uint* r_dst;
+   uint* r_src;
+   uint value;
+   uint loops;
+   uint loop_cycles;
+   sint cycles_left;
+
+   /* trace exceptions happen after every opcode */
+   if(FLAG_T1)
+      return;
+
+   body = m68k_read_immediate_16(ADDRESS_68K(REG_PC));
+   if((body & 0xf1f8) != 0x20d8 && (body & 0xf1f8) != 0x20c0)
+      return;
+
+   /* only as many passes as the main loop would run before the cycles run
+    * out, the cycles for this DBF are used after it returns and the DBF that
+    * falls through at the end of the loop runs the normal way
+    */
+   cycles_left = GET_CYCLES() - CYC_INSTRUCTION[REG_IR];
+   loop_cycles = CYC_INSTRUCTION[body] + CYC_INSTRUCTION[REG_IR] + CYC_DBCC_F_NOEXP;
+   if(cycles_left <= 0)
+      return;
+   loops = MASK_OUT_ABOVE_16(*r_counter);
+   if(loops > (uint)(cycles_left - 1) / loop_cycles)
+      loops = (uint)(cycles_left - 1) / loop_cycles;
+   if(loops < 2)
+      return;
+
+   r_dst = &REG_A[(body >> 9) & 7];
+   if((body & 0xf1f8) == 0x20d8)
+   {
+      /* MOVE.L (Ay)+,(Ax)+ */
+      r_src = &REG_A[body & 7];
+      if(r_src == r_dst)
+         return;
+      loops = M68K_BULK_COPY_CALLBACK(ADDRESS_68K(*r_dst), ADDRESS_68K(*r_src), loops);
+      if(loops == 0)
+         return;
+      *r_src += loops << 2;
+      value = m68ki_read_32(*r_dst + ((loops - 1) << 2));
+   }
+   else
+   {
+      /* MOVE.L Dy,(Ax)+, the counter cant be the value */
+      if(&REG_D[body & 7] == r_counter)
+         return;
+      value = REG_D[body & 7];
+      loops = M68K_BULK_FILL_CALLBACK(ADDRESS_68K(*r_dst), value, loops);
+      if(loops == 0)
+         return;
+   }
+   *r_dst += loops << 2;
+   *r_counter = MASK_OUT_BELOW_16(*r_counter) | (MASK_OUT_ABOVE_16(*r_counter) - loops);
+
+   /* flags from the last MOVE.L */
+   m68ki_discard_lazy_flags();
+   FLAG_N = NFLAG_32(value);
+   FLAG_Z = value;
+   FLAG_V = VFLAG_CLEAR;
+   FLAG_C = CFLAG_CLEAR;
+
+   USE_CYCLES(loops * loop_cycles);
+}
+#endif /* M68K_BULK_MOVE_LOOPS */
+
+static const char* const m68ki_fusion_names[M68K_FUSIONS] =
+{
+   "TST/CMP + Bcc.B",
+   "MOVE.L (An)+,(Am)+ + DBF",
+   "LINK + MOVEM.L list,-(A7)"
+};
+
+#if M68K_FUSED_OPCODES
+#if M68K_FUSION_STATISTICS
+static uint64_t m68ki_fusion_seen[M68K_FUSIONS];
+static uint64_t m68ki_fusion_fused[M68K_FUSIONS];
+#define m68ki_count_fusion(COUNTS, FUSION) (COUNTS[FUSION]++)
+#else
+#define m68ki_count_fusion(COUNTS, FUSION)
+#endif /* M68K_FUSION_STATISTICS */
+
+/* Returns the pair the opcode starts or M68K_FUSIONS if it doesnt start one */
+MUSASHI_INLINE uint m68ki_fusion_first(uint ir)
+{
+   /* TST */
+   if((ir & 0xff00) == 0x4a00 && (ir & 0x00c0) != 0x00c0)
+      return M68K_FUSION_TEST_BCC;
+   /* CMP, CMPA and CMPM, not EOR */
+   if((ir & 0xf000) == 0xb000 && ((ir & 0x0100) == 0 || (ir & 0x00c0) == 0x00c0 || (ir & 0x0038) == 0x0008))
+      return M68K_FUSION_TEST_BCC;
+   /* CMPI */
+   if((ir & 0xff00) == 0x0c00 && (ir & 0x00c0) != 0x00c0)
+      return M68K_FUSION_TEST_BCC;
+   if((ir & 0xf1f8) == 0x20d8)
+      return M68K_FUSION_MOVE_DBF;
+   if((ir & 0xfff8) == 0x4e50)
+      return M68K_FUSION_LINK_MOVEM;
+   return M68K_FUSIONS;
+}
+
+/* Same as the COND_XX() macros in m68kcpu.h, only for Bcc conditions(2 - 15) */
+MUSASHI_INLINE uint m68ki_test_condition(uint condition)
+{
+   switch(condition)
+   {
+      case 0x2: return COND_HI();
+      case 0x3: return COND_LS();
+      case 0x4: return COND_CC();
+      case 0x5: return COND_CS();
+      case 0x6: return COND_NE();
+      case 0x7: return COND_EQ();
+      case 0x8: return COND_VC();
+      case 0x9: return COND_VS();
+      case 0xa: return COND_PL();
+      case 0xb: return COND_MI();
+      case 0xc: return COND_GE();
+      case 0xd: return COND_LT();
+      case 0xe: return COND_GT();
+      default:  return COND_LE();
+   }
+}
+
+/* Run 1 opcode, and if it starts a pair the opcode after it too */
+static void m68ki_execute_fused(void)
+{
+   uint fusion;
+
+   REG_PPC = REG_PC;
+   REG_IR = m68ki_read_imm_16();
+   fusion = m68ki_fusion_first(REG_IR);
+   m68ki_instruction_handler(REG_IR)();
+   USE_CYCLES(CYC_INSTRUCTION[REG_IR]);
+
+   /* the main loop would only fetch the next opcode if there are cycles left */
+   if(fusion == M68K_FUSIONS || GET_CYCLES() <= 0)
+      return;
+
+   m68ki_count_fusion(m68ki_fusion_seen, fusion);
+   REG_PPC = REG_PC;
+   REG_IR = m68ki_read_imm_16();
+   switch(fusion)
+   {
+      case M68K_FUSION_TEST_BCC:
+         /* Bcc.B with an 8 bit displacement, BRA and BSR are not conditions */
+         if((REG_IR & 0xf000) == 0x6000 && (REG_IR & 0x0e00) != 0 && MASK_OUT_ABOVE_8(REG_IR) != 0 && MASK_OUT_ABOVE_8(REG_IR) != 0xff)
+         {
+            m68ki_count_fusion(m68ki_fusion_fused, fusion);
+            m68ki_resolve_flags();
+            if(m68ki_test_condition((REG_IR >> 8) & 0xf))
+            {
+               m68ki_trace_t0(); /* auto-disable (see m68kcpu.h) */
+               m68ki_branch_8(MASK_OUT_ABOVE_8(REG_IR));
+            }
+            else
+            {
+               USE_CYCLES(CYC_BCC_NOTAKE_B);
+            }
+            USE_CYCLES(CYC_INSTRUCTION[REG_IR]);
+            return;
+         }
+         break;
+      case M68K_FUSION_MOVE_DBF:
+         if((REG_IR & 0xfff8) == 0x51c8)
+         {
+            /* same as m68k_op_dbf_16() */
+            uint* r_dst = &DY;
+            uint res = MASK_OUT_ABOVE_16(*r_dst - 1);
+
+            m68ki_count_fusion(m68ki_fusion_fused, fusion);
+            *r_dst = MASK_OUT_BELOW_16(*r_dst) | res;
+            if(res != 0xffff)
+            {
+               uint offset = OPER_I_16();
+               REG_PC -= 2;
+               m68ki_trace_t0(); /* auto-disable (see m68kcpu.h) */
+               m68ki_branch_16(offset);
+               USE_CYCLES(CYC_DBCC_F_NOEXP);
+               if(offset == 0xfffc)
+                  m68ki_bulk_move_loop(r_dst); /* auto-disable (see m68kcpu.h) */
+            }
+            else
+            {
+               REG_PC += 2;
+               USE_CYCLES(CYC_DBCC_F_EXP);
+            }
+            USE_CYCLES(CYC_INSTRUCTION[REG_IR]);
+            return;
+         }
+         break;
+      case M68K_FUSION_LINK_MOVEM:
+         if(REG_IR == 0x48e7)
+         {
+            m68ki_count_fusion(m68ki_fusion_fused, fusion);
+            m68k_op_movem_32_re_pd();
+            USE_CYCLES(CYC_INSTRUCTION[REG_IR]);
+            return;
+         }
+         break;
+   }
+
+   /* not the rest of the pair, run it the normal way */
+   m68ki_instruction_handler(REG_IR)();
+   USE_CYCLES(CYC_INSTRUCTION[REG_IR]);
+}
+
+#endif /* M68K_FUSED_OPCODES */
+
+#if M68K_FUSED_OPCODES && M68K_FUSION_STATISTICS
+void m68k_get_fusion_counts(uint32_t fusion, uint64_t* seen, uint64_t* fused)
+{
+   *seen = m68ki_fusion_seen[fusion];
+   *fused = m68ki_fusion_fused[fusion];
+}
+
+void m68k_clear_fusion_counts(void)
+{
+   memset(m68ki_fusion_seen, 0, sizeof(m68ki_fusion_seen));
+   memset(m68ki_fusion_fused, 0, sizeof(m68ki_fusion_fused));
+}
+#else
+void m68k_get_fusion_counts(uint32_t fusion, uint64_t* seen, uint64_t* fused)
+{
+   *seen = 0;
+   *fused = 0;
+}
+
+void m68k_clear_fusion_counts(void)
+{
+}
+#endif /* M68K_FUSED_OPCODES && M68K_FUSION_STATISTICS */
 
-         /* Trace m68k_exception, if necessary */
-         m68ki_exception_if_trace(); /* auto-disable (see m68kcpu.h) */
-      } while(GET_CYCLES() > 0);
+const char* m68k_get_fusion_name(uint32_t fusion)
+{
+   return m68ki_fusion_names[fusion];
+}
 
-      /* set previous PC to current PC for the next entry into the loop */
+/* Main loop.  Keep going until we run out of clock cycles */
+static int32_t m68ki_run(void)
+{
+   do
+   {
+#if M68K_THREADED_DISPATCH
+      m68ki_execute_threaded();
+#elif M68K_X86_64_JIT
+      m68ki_execute_jit();
+#elif M68K_BLOCK_CACHE
+      m68ki_execute_block();
+#else
+      /* Set tracing accodring to T1. (T0 is done inside instruction) */
+      m68ki_trace_t1(); /* auto-disable (see m68kcpu.h) */
+
+      /* Set the address space for reads */
+      m68ki_use_data_space(); /* auto-disable (see m68kcpu.h) */
+
+      /* Call external hook to peek at CPU */
+      m68ki_instr_hook(); /* auto-disable (see m68kcpu.h) */
+
+#if M68K_FUSED_OPCODES
+      /* Run the opcode, and the one after it if they are a pair */
+      m68ki_execute_fused();
+#else
+      /* Record previous program counter */
       REG_PPC = REG_PC;
 
+      /* Read an instruction and call its handler */
+      REG_IR = m68ki_read_imm_16();
+      m68ki_instruction_handler(REG_IR)();
+      USE_CYCLES(CYC_INSTRUCTION[REG_IR]);
+#endif /* M68K_FUSED_OPCODES */
+
+      /* Trace m68k_exception, if necessary */
+      m68ki_exception_if_trace(); /* auto-disable (see m68kcpu.h) */
+#endif /* M68K_THREADED_DISPATCH */
+   } while(GET_CYCLES() > 0);
+
+   /* set previous PC to current PC for the next entry into the loop */
+   REG_PPC = REG_PC;
+
+   /* ASG: update cycles */
+   USE_CYCLES(CPU_INT_CYCLES);
+   CPU_INT_CYCLES = 0;
+
+   /* return how many clocks we used */
+   return m68ki_initial_cycles - GET_CYCLES();
+}
+
+/* Set up the cycle counters for m68k_execute() */
+static int m68ki_start(int32_t num_cycles)
+{
+   /* Make sure we're not stopped */
+   if(!CPU_STOPPED)
+   {
+      /* Set our pool of clock cycles available */
+      SET_CYCLES(num_cycles);
+      m68ki_initial_cycles = num_cycles;
+
       /* ASG: update cycles */
       USE_CYCLES(CPU_INT_CYCLES);
       CPU_INT_CYCLES = 0;
-
-      /* return how many clocks we used */
-      return m68ki_initial_cycles - GET_CYCLES();
+      return 1;
    }
 
    /* We get here if the CPU is stopped or halted */
    SET_CYCLES(0);
    CPU_INT_CYCLES = 0;
+   return 0;
+}
+
+#if M68K_EMULATE_ADDRESS_ERROR
+/* Take the address or bus error that aborted the last opcode and keep going */
+int32_t m68k_execute_after_address_error(void)
+{
+   m68ki_exception_address_error();
+   if(CPU_STOPPED)
+   {
+      SET_CYCLES(0);
+      CPU_INT_CYCLES = 0;
+      return m68ki_initial_cycles;
+   }
+
+   /* ensure we don't re-enter execution loop after an
+      address error if there's no more cycles remaining */
+   if(GET_CYCLES() <= 0)
+   {
+      /* return how many clocks we used */
+      return m68ki_initial_cycles - GET_CYCLES();
+   }
+
+   return m68ki_run();
+}
+
+/* Run the main loop with its own address error trap, the trap that was set
+ * before is put back after so m68k_execute() can be called from inside an
+ * opcode.
+ */
+static int32_t m68ki_run_trapped(void)
+{
+   jmp_buf outer_trap;
+   int32_t cycles;
+
+   memcpy(outer_trap, m68ki_aerr_trap, sizeof(jmp_buf));
+
+   /* Return point if we had an address error */
+   if(setjmp(m68ki_aerr_trap) != 0)
+      cycles = m68k_execute_after_address_error();
+   else
+      cycles = m68ki_run();
 
+   memcpy(m68ki_aerr_trap, outer_trap, sizeof(jmp_buf));
+   return cycles;
+}
+#endif /* M68K_EMULATE_ADDRESS_ERROR */
+
+/* Execute some instructions until we use up num_cycles clock cycles */
+/* ASG: removed per-instruction interrupt checks */
+int32_t m68k_execute(int32_t num_cycles)
+{
+   if(m68ki_start(num_cycles))
+   {
+#if M68K_EMULATE_ADDRESS_ERROR
+      return m68ki_run_trapped();
+#else
+      return m68ki_run();
+#endif /* M68K_EMULATE_ADDRESS_ERROR */
+   }
+   return num_cycles;
+}
+
+/* Same as m68k_execute() but uses the address error trap the host has set */
+int32_t m68k_execute_shared_trap(int32_t num_cycles)
+{
+   if(m68ki_start(num_cycles))
+      return m68ki_run();
    return num_cycles;
 }
 
@@ -740,15 +1216,6 @@ void m68k_set_irq(uint32_t int_level)
 
 void m68k_init(void)
 {
-   static uint emulation_initialized = 0;
-
-   /* The first call to this function initializes the opcode handler jump table */
-   if(!emulation_initialized)
-      {
-      m68ki_build_opcode_table();
-      emulation_initialized = 1;
-   }
-
    m68k_set_int_ack_callback(NULL);
    m68k_set_bkpt_ack_callback(NULL);
    m68k_set_reset_instr_callback(NULL);
@@ -808,6 +1275,7 @@ uint32_t m68k_context_size()
 
 uint32_t m68k_get_context(void* dst)
 {
+   m68ki_resolve_flags();
    if(dst) *(m68ki_cpu_core*)dst = m68ki_cpu;
    return sizeof(m68ki_cpu_core);
 }
@@ -285,6 +285,9 @@
 #define FLAG_V           m68ki_cpu.v_flag
 #define FLAG_C           m68ki_cpu.c_flag
 #define FLAG_INT_MASK    m68ki_cpu.int_mask
+#define FLAGS_OP         m68ki_cpu.flags_op
+#define FLAGS_SRC        m68ki_cpu.flags_src
+#define FLAGS_DST        m68ki_cpu.flags_dst
 
 #define CPU_INT_LEVEL    m68ki_cpu.int_level /* ASG: changed from CPU_INTS_PENDING */
 #define CPU_INT_CYCLES   m68ki_cpu.int_cycles /* ASG */
@@ -467,25 +470,6 @@
    #include <setjmp.h>
    extern jmp_buf m68ki_aerr_trap;
 
-   #define m68ki_set_address_error_trap() \
-      if(setjmp(m68ki_aerr_trap) != 0) \
-      { \
-         m68ki_exception_address_error(); \
-         if(CPU_STOPPED) \
-         { \
-            SET_CYCLES(0); \
-            CPU_INT_CYCLES = 0; \
-            return m68ki_initial_cycles; \
-         } \
-         /* ensure we don't re-enter execution loop after an
-            address error if there's no more cycles remaining */ \
-         if(GET_CYCLES() <= 0) \
-         { \
-            /* return how many clocks we used */ \
-            return m68ki_initial_cycles - GET_CYCLES(); \
-         } \
-      }
-
    #define m68ki_check_address_error(ADDR, WRITE_MODE, FC) \
       if((ADDR)&1) \
       { \
@@ -505,7 +489,6 @@
          longjmp(m68ki_aerr_trap, 1); \
       }
 #else
-   #define m68ki_set_address_error_trap()
    #define m68ki_check_address_error(ADDR, WRITE_MODE, FC)
    #define m68ki_trigger_bus_error(ADDR, WRITE_MODE, FC)
 #endif /* M68K_ADDRESS_ERROR */
@@ -694,12 +677,59 @@
 #define COND_XC() (!COND_XS)
 
 
+/* Lazy condition codes.
+ * ADD, SUB and CMP only record their operands and the N, Z, V and C flags are
+ * worked out from them by m68ki_resolve_flags() when something reads them.
+ * Handlers that read or only partly change N, Z, V or C call
+ * m68ki_resolve_flags() before touching them, handlers that overwrite all 4
+ * call m68ki_discard_lazy_flags() instead.  X is always set right away.
+ */
+#if M68K_LAZY_FLAGS
+#define M68KI_FLAGS_RESOLVED 0
+#define M68KI_FLAGS_ADD_8    1
+#define M68KI_FLAGS_ADD_16   2
+#define M68KI_FLAGS_ADD_32   3
+#define M68KI_FLAGS_SUB_8    4
+#define M68KI_FLAGS_SUB_16   5
+#define M68KI_FLAGS_SUB_32   6
+
+#define m68ki_resolve_flags() (FLAGS_OP != M68KI_FLAGS_RESOLVED ? m68ki_resolve_lazy_flags() : (void)0)
+#define m68ki_discard_lazy_flags() (FLAGS_OP = M68KI_FLAGS_RESOLVED)
+
+#define m68ki_set_lazy_flags(OP, S, D) (FLAGS_OP = (OP), FLAGS_SRC = (S), FLAGS_DST = (D))
+#define m68ki_set_nzvc_add_8(S, D, R)  ((void)(R), m68ki_set_lazy_flags(M68KI_FLAGS_ADD_8, S, D))
+#define m68ki_set_nzvc_add_16(S, D, R) ((void)(R), m68ki_set_lazy_flags(M68KI_FLAGS_ADD_16, S, D))
+#define m68ki_set_nzvc_add_32(S, D, R) ((void)(R), m68ki_set_lazy_flags(M68KI_FLAGS_ADD_32, S, D))
+#define m68ki_set_nzvc_sub_8(S, D, R)  ((void)(R), m68ki_set_lazy_flags(M68KI_FLAGS_SUB_8, S, D))
+#define m68ki_set_nzvc_sub_16(S, D, R) ((void)(R), m68ki_set_lazy_flags(M68KI_FLAGS_SUB_16, S, D))
+#define m68ki_set_nzvc_sub_32(S, D, R) ((void)(R), m68ki_set_lazy_flags(M68KI_FLAGS_SUB_32, S, D))
+#else
+#define m68ki_resolve_flags() ((void)0)
+#define m68ki_discard_lazy_flags() ((void)0)
+
+#define m68ki_set_nzvc_add_8(S, D, R)  (FLAG_N = NFLAG_8(R), FLAG_Z = MASK_OUT_ABOVE_8(R), FLAG_V = VFLAG_ADD_8(S, D, R), FLAG_C = CFLAG_8(R))
+#define m68ki_set_nzvc_add_16(S, D, R) (FLAG_N = NFLAG_16(R), FLAG_Z = MASK_OUT_ABOVE_16(R), FLAG_V = VFLAG_ADD_16(S, D, R), FLAG_C = CFLAG_16(R))
+#define m68ki_set_nzvc_add_32(S, D, R) (FLAG_N = NFLAG_32(R), FLAG_Z = MASK_OUT_ABOVE_32(R), FLAG_V = VFLAG_ADD_32(S, D, R), FLAG_C = CFLAG_ADD_32(S, D, R))
+#define m68ki_set_nzvc_sub_8(S, D, R)  (FLAG_N = NFLAG_8(R), FLAG_Z = MASK_OUT_ABOVE_8(R), FLAG_V = VFLAG_SUB_8(S, D, R), FLAG_C = CFLAG_8(R))
+#define m68ki_set_nzvc_sub_16(S, D, R) (FLAG_N = NFLAG_16(R), FLAG_Z = MASK_OUT_ABOVE_16(R), FLAG_V = VFLAG_SUB_16(S, D, R), FLAG_C = CFLAG_16(R))
+#define m68ki_set_nzvc_sub_32(S, D, R) (FLAG_N = NFLAG_32(R), FLAG_Z = MASK_OUT_ABOVE_32(R), FLAG_V = VFLAG_SUB_32(S, D, R), FLAG_C = CFLAG_SUB_32(S, D, R))
+#endif /* M68K_LAZY_FLAGS */
+
+#define m68ki_set_xnzvc_add_8(S, D, R)  (FLAG_X = CFLAG_8(R), m68ki_set_nzvc_add_8(S, D, R))
+#define m68ki_set_xnzvc_add_16(S, D, R) (FLAG_X = CFLAG_16(R), m68ki_set_nzvc_add_16(S, D, R))
+#define m68ki_set_xnzvc_add_32(S, D, R) (FLAG_X = CFLAG_ADD_32(S, D, R), m68ki_set_nzvc_add_32(S, D, R))
+#define m68ki_set_xnzvc_sub_8(S, D, R)  (FLAG_X = CFLAG_8(R), m68ki_set_nzvc_sub_8(S, D, R))
+#define m68ki_set_xnzvc_sub_16(S, D, R) (FLAG_X = CFLAG_16(R), m68ki_set_nzvc_sub_16(S, D, R))
+#define m68ki_set_xnzvc_sub_32(S, D, R) (FLAG_X = CFLAG_SUB_32(S, D, R), m68ki_set_nzvc_sub_32(S, D, R))
+
+
 /* Get the condition code register */
-#define m68ki_get_ccr() ((COND_XS() >> 4) | \
-                   (COND_MI() >> 4) | \
-                   (COND_EQ() << 2) | \
-                   (COND_VS() >> 6) | \
-                   (COND_CS() >> 8))
+#define m68ki_get_ccr() (m68ki_resolve_flags(), \
+                  (COND_XS() >> 4) | \
+                  (COND_MI() >> 4) | \
+                  (COND_EQ() << 2) | \
+                  (COND_VS() >> 6) | \
+                  (COND_CS() >> 8))
 
 /* Get the status register */
 #define m68ki_get_sr() ( FLAG_T1              | \
@@ -785,6 +815,9 @@ typedef struct
    uint not_z_flag;   /* Zero, inverted for speedups */
    uint v_flag;       /* Overflow */
    uint c_flag;       /* Carry */
+   uint flags_op;     /* Operation N, Z, V and C still have to be worked out from, see m68ki_resolve_flags() */
+   uint flags_src;    /* Its source operand */
+   uint flags_dst;    /* Its destination operand */
    uint int_mask;     /* I0-I2 */
    uint int_level;    /* State of interrupt pins IPL0-IPL2 -- ASG: changed from ints_pending */
    uint int_cycles;   /* ASG: extra cycles from generated interrupts */
@@ -806,7 +839,7 @@ typedef struct
    uint cyc_movem_l;
    uint cyc_shift;
    uint cyc_reset;
-   uint8* cyc_instruction;
+   const uint8* cyc_instruction;
    uint8* cyc_exception;
 
    /* Callbacks to host */
@@ -835,6 +868,25 @@ extern uint           m68ki_aerr_address;
 extern uint           m68ki_aerr_write_mode;
 extern uint           m68ki_aerr_fc;
 
+#if M68K_LAZY_FLAGS
+/* Work out N, Z, V and C from the last lazy ADD, SUB or CMP */
+void m68ki_resolve_lazy_flags(void);
+#endif /* M68K_LAZY_FLAGS */
+
+#if M68K_BULK_MOVE_LOOPS
+/* Called by DBF after it branched back 1 word, see M68K_BULK_MOVE_LOOPS */
+void m68ki_bulk_move_loop(uint* r_counter);
+#else
+#define m68ki_bulk_move_loop(r_counter)
+#endif /* M68K_BULK_MOVE_LOOPS */
+
+#if M68K_X86_64_JIT
+/* Run the translated block at the PC or 1 opcode the normal way(m68kjit.c) */
+void m68ki_execute_jit(void);
+/* Throw away all translated blocks */
+void m68ki_flush_jit(void);
+#endif /* M68K_X86_64_JIT */
+
 /* Read data immediately after the program counter */
 MUSASHI_INLINE uint m68ki_read_imm_16(void);
 MUSASHI_INLINE uint m68ki_read_imm_32(void);
@@ -1333,11 +1385,19 @@ MUSASHI_INLINE void m68ki_jump_vector(uint vector)
 MUSASHI_INLINE void m68ki_branch_8(uint offset)
 {
    REG_PC += MAKE_INT_8(offset);
+#if M68K_BACKWARD_BRANCH_HOOK
+   if(offset & 0x80)
+      M68K_BACKWARD_BRANCH_CALLBACK();
+#endif /* M68K_BACKWARD_BRANCH_HOOK */
 }
 
 MUSASHI_INLINE void m68ki_branch_16(uint offset)
 {
    REG_PC += MAKE_INT_16(offset);
+#if M68K_BACKWARD_BRANCH_HOOK
+   if(offset & 0x8000)
+      M68K_BACKWARD_BRANCH_CALLBACK();
+#endif /* M68K_BACKWARD_BRANCH_HOOK */
 }
 
 MUSASHI_INLINE void m68ki_branch_32(uint offset)
@@ -1389,6 +1449,7 @@ MUSASHI_INLINE void m68ki_set_sm_flag_nosp(uint value)
 /* Set the condition code register */
 MUSASHI_INLINE void m68ki_set_ccr(uint value)
 {
+   m68ki_discard_lazy_flags();
    FLAG_X = BIT_4(value)  << 4;
    FLAG_N = BIT_3(value)  << 4;
    FLAG_Z = !BIT_2(value);
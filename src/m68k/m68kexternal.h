@@ -2,10 +2,16 @@
 #define M68KEXTERNAL_HEADER
 
 #include <stdint.h>
+#include <stdbool.h>
 
 int32_t interruptAcknowledge(int32_t intLevel);
 void emulatorSoftReset(void);
 void flx68000PcLongJump(uint32_t newPc);
+bool flx68000PcInRom(uint32_t pc);
+extern bool flx68000IdleLoopPolled;
+void flx68000IdleLoopCheck(void);
 void sandboxOnOpcodeRun(void);
+uint32_t ramBulkCopy32(uint32_t dest, uint32_t source, uint32_t count);
+uint32_t ramBulkFill32(uint32_t dest, uint32_t value, uint32_t count);
 
 #endif
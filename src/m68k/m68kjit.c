@@ -0,0 +1,727 @@
+#include <stddef.h>
+#include <string.h>
+
+#include "m68kops.h"
+#include "m68kcpu.h"
+
+/* ======================================================================== */
+/* ========================= X86-64 BLOCK TRANSLATOR ====================== */
+/* ======================================================================== */
+
+/* Straight line runs of simple opcodes from memory that never changes are
+ * translated into x86-64 code the first time they run, a block ends before
+ * the first opcode that isnt translated and that opcode runs through its
+ * normal handler.
+ * The translated code works on m68ki_cpu directly(rbx), the registers and
+ * flags are loaded and stored by every opcode and the flags are worked out
+ * exactly like the handlers do, so the core cant tell which ran.
+ * Memory goes through m68k_read_memory_32()/m68k_write_memory_32(), they
+ * already take the direct pointer for RAM and ROM banks, the PC, PPC, IR and
+ * cycles are stored before the call because it may read the timers or take
+ * an interrupt, the block is left after it if the PC changed or the cycles
+ * left arnt enough for the rest of the block.
+ */
+
+#if M68K_X86_64_JIT
+#include <sys/mman.h>
+
+#define M68KI_JIT_BLOCKS         16384    /* 32kb of ROM before 2 blocks share an entry, retranslating is much slower than replaying */
+#define M68KI_JIT_OPCODES        32
+#define M68KI_JIT_OPCODE_BYTES   256      /* more than the longest opcode translation */
+#define M68KI_JIT_BLOCK_BYTES    (64 + M68KI_JIT_OPCODES * M68KI_JIT_OPCODE_BYTES)
+#define M68KI_JIT_CODE_BYTES     0x400000
+
+/* Host registers, only the 32 bit ones that dont need a REX prefix */
+#define M68KI_X86_EAX 0
+#define M68KI_X86_ECX 1
+#define M68KI_X86_EDX 2
+#define M68KI_X86_EBX 3
+#define M68KI_X86_ESI 6
+#define M68KI_X86_EDI 7
+
+/* op r/m32, r32 */
+#define M68KI_X86_ADD 0x01
+#define M68KI_X86_OR  0x09
+#define M68KI_X86_AND 0x21
+#define M68KI_X86_SUB 0x29
+#define M68KI_X86_XOR 0x31
+#define M68KI_X86_CMP 0x39
+#define M68KI_X86_MOV 0x89
+#define M68KI_X86_LOAD 0x8b
+
+/* op r/m32, imm32, the reg field of 0x81 */
+#define M68KI_X86_ADD_IMM 0
+#define M68KI_X86_AND_IMM 4
+#define M68KI_X86_SUB_IMM 5
+
+/* shift r/m32, imm8, the reg field of 0xc1 */
+#define M68KI_X86_ROL_IMM 0
+#define M68KI_X86_SHR_IMM 5
+
+#define M68KI_JIT_CPU(FIELD) ((uint)offsetof(m68ki_cpu_core, FIELD))
+#define M68KI_JIT_REG(REG)   (M68KI_JIT_CPU(dar) + (REG) * 4) /* 0 - 7 = D0 - D7, 8 - 15 = A0 - A7 */
+#define M68KI_JIT_D(REG)     M68KI_JIT_REG(REG)
+#define M68KI_JIT_A(REG)     M68KI_JIT_REG((REG) + 8)
+
+typedef struct
+{
+   uint pc;             /* odd = empty */
+   uint cycles;         /* cycles used before the last opcode, the block only runs with more than this left */
+   void (*code)(void);  /* NULL = the opcode at pc isnt translated */
+} m68ki_jit_block;
+
+/* The block being translated */
+typedef struct
+{
+   uint pc;             /* opcode being translated */
+   uint next_pc;
+   uint ir;
+   uint cycles;         /* cycles of the opcodes so far */
+   uint charged;        /* how many of them have been taken from m68ki_remaining_cycles */
+   uint last_pc;        /* last opcode translated */
+   uint last_ir;
+   uint last_cycles;    /* cycles of the block before the last opcode */
+   uint8* exits[M68KI_JIT_OPCODES * 2];             /* jumps to the end of the block */
+   uint exit_count;
+   uint8* cycle_checks[M68KI_JIT_OPCODES];          /* cycles left compares after memory accesses */
+   uint cycle_check_cycles[M68KI_JIT_OPCODES];      /* cycles used when they are made */
+   uint cycle_check_count;
+} m68ki_jit_state;
+
+static m68ki_jit_block m68ki_jit_blocks[M68KI_JIT_BLOCKS];
+static uint8* m68ki_jit_code;       /* NULL until first used */
+static uint m68ki_jit_code_used;
+static uint m68ki_jit_unavailable;  /* the host doesnt allow writable and executable memory */
+static uint m68ki_jit_running;      /* blocks being run, nothing may be translated while a block can still return to its code */
+static uint8* m68ki_jit_out;
+
+/* ------------------------------- Emitter -------------------------------- */
+
+static void m68ki_jit_byte(uint value)
+{
+   *m68ki_jit_out++ = value;
+}
+
+static void m68ki_jit_long(uint value)
+{
+   memcpy(m68ki_jit_out, &value, 4);
+   m68ki_jit_out += 4;
+}
+
+static void m68ki_jit_quad(uint64_t value)
+{
+   memcpy(m68ki_jit_out, &value, 8);
+   m68ki_jit_out += 8;
+}
+
+/* op reg, [rbx + offset] or op [rbx + offset], reg */
+static void m68ki_jit_field(uint op, uint reg, uint offset)
+{
+   m68ki_jit_byte(op);
+   m68ki_jit_byte(0x80 | reg << 3 | M68KI_X86_EBX);
+   m68ki_jit_long(offset);
+}
+
+static void m68ki_jit_load(uint reg, uint offset)
+{
+   m68ki_jit_field(M68KI_X86_LOAD, reg, offset);
+}
+
+static void m68ki_jit_store(uint reg, uint offset)
+{
+   m68ki_jit_field(M68KI_X86_MOV, reg, offset);
+}
+
+static void m68ki_jit_store_imm(uint offset, uint value)
+{
+   m68ki_jit_field(0xc7, 0, offset);
+   m68ki_jit_long(value);
+}
+
+/* op dst, src */
+static void m68ki_jit_op(uint op, uint dst, uint src)
+{
+   m68ki_jit_byte(op);
+   m68ki_jit_byte(0xc0 | src << 3 | dst);
+}
+
+static void m68ki_jit_op_imm(uint op, uint dst, uint value)
+{
+   m68ki_jit_byte(0x81);
+   m68ki_jit_byte(0xc0 | op << 3 | dst);
+   m68ki_jit_long(value);
+}
+
+static void m68ki_jit_shift(uint op, uint dst, uint count)
+{
+   m68ki_jit_byte(0xc1);
+   m68ki_jit_byte(0xc0 | op << 3 | dst);
+   m68ki_jit_byte(count);
+}
+
+static void m68ki_jit_mov_imm(uint dst, uint value)
+{
+   m68ki_jit_byte(0xb8 + dst);
+   m68ki_jit_long(value);
+}
+
+static void m68ki_jit_not(uint dst)
+{
+   m68ki_jit_byte(0xf7);
+   m68ki_jit_byte(0xd0 | dst);
+}
+
+/* m68ki_remaining_cycles is [r14] */
+static void m68ki_jit_use_cycles(uint cycles)
+{
+   if(cycles == 0)
+      return;
+   m68ki_jit_byte(0x41);
+   m68ki_jit_byte(0x81);
+   m68ki_jit_byte(0x2e);
+   m68ki_jit_long(cycles);
+}
+
+/* jcc rel32 to the end of the block */
+static void m68ki_jit_exit_if(m68ki_jit_state* state, uint condition)
+{
+   m68ki_jit_byte(0x0f);
+   m68ki_jit_byte(0x80 | condition);
+   state->exits[state->exit_count++] = m68ki_jit_out;
+   m68ki_jit_long(0);
+}
+
+/* --------------------------------- Flags -------------------------------- */
+
+/* Same as the handlers, for a result in edx with V and C cleared, NFLAG_16() for 16 bit results */
+static void m68ki_jit_flags_logic(uint n_shift)
+{
+   m68ki_jit_store(M68KI_X86_EDX, M68KI_JIT_CPU(not_z_flag));
+   m68ki_jit_op(M68KI_X86_MOV, M68KI_X86_ESI, M68KI_X86_EDX);
+   m68ki_jit_shift(M68KI_X86_SHR_IMM, M68KI_X86_ESI, n_shift);
+   m68ki_jit_store(M68KI_X86_ESI, M68KI_JIT_CPU(n_flag));
+   m68ki_jit_store_imm(M68KI_JIT_CPU(v_flag), VFLAG_CLEAR);
+   m68ki_jit_store_imm(M68KI_JIT_CPU(c_flag), CFLAG_CLEAR);
+}
+
+/* Flags for a value known when translating */
+static void m68ki_jit_flags_logic_imm(uint res)
+{
+   m68ki_jit_store_imm(M68KI_JIT_CPU(not_z_flag), res);
+   m68ki_jit_store_imm(M68KI_JIT_CPU(n_flag), NFLAG_32(res));
+   m68ki_jit_store_imm(M68KI_JIT_CPU(v_flag), VFLAG_CLEAR);
+   m68ki_jit_store_imm(M68KI_JIT_CPU(c_flag), CFLAG_CLEAR);
+}
+
+/* m68ki_set_nzvc_add_32()/m68ki_set_nzvc_sub_32() with S in eax, D in ecx and R in edx, X too if set_x */
+static void m68ki_jit_flags_arithmetic(uint subtract, uint set_x)
+{
+   /* V, ((S^R) & (D^R))>>24 for ADD and ((S^D) & (R^D))>>24 for SUB */
+   m68ki_jit_op(M68KI_X86_MOV, M68KI_X86_ESI, M68KI_X86_EAX);
+   m68ki_jit_op(M68KI_X86_XOR, M68KI_X86_ESI, subtract ? M68KI_X86_ECX : M68KI_X86_EDX);
+   m68ki_jit_op(M68KI_X86_MOV, M68KI_X86_EDI, subtract ? M68KI_X86_EDX : M68KI_X86_ECX);
+   m68ki_jit_op(M68KI_X86_XOR, M68KI_X86_EDI, subtract ? M68KI_X86_ECX : M68KI_X86_EDX);
+   m68ki_jit_op(M68KI_X86_AND, M68KI_X86_ESI, M68KI_X86_EDI);
+   m68ki_jit_shift(M68KI_X86_SHR_IMM, M68KI_X86_ESI, 24);
+   m68ki_jit_store(M68KI_X86_ESI, M68KI_JIT_CPU(v_flag));
+
+   /* C, ((S & D) | (~R & (S | D)))>>23 for ADD and ((S & R) | (~D & (S | R)))>>23 for SUB */
+   m68ki_jit_op(M68KI_X86_MOV, M68KI_X86_EDI, M68KI_X86_EAX);
+   m68ki_jit_op(M68KI_X86_OR, M68KI_X86_EDI, subtract ? M68KI_X86_EDX : M68KI_X86_ECX);
+   m68ki_jit_op(M68KI_X86_MOV, M68KI_X86_ESI, subtract ? M68KI_X86_ECX : M68KI_X86_EDX);
+   m68ki_jit_not(M68KI_X86_ESI);
+   m68ki_jit_op(M68KI_X86_AND, M68KI_X86_ESI, M68KI_X86_EDI);
+   m68ki_jit_op(M68KI_X86_MOV, M68KI_X86_EDI, M68KI_X86_EAX);
+   m68ki_jit_op(M68KI_X86_AND, M68KI_X86_EDI, subtract ? M68KI_X86_EDX : M68KI_X86_ECX);
+   m68ki_jit_op(M68KI_X86_OR, M68KI_X86_ESI, M68KI_X86_EDI);
+   m68ki_jit_shift(M68KI_X86_SHR_IMM, M68KI_X86_ESI, 23);
+   m68ki_jit_store(M68KI_X86_ESI, M68KI_JIT_CPU(c_flag));
+   if(set_x)
+      m68ki_jit_store(M68KI_X86_ESI, M68KI_JIT_CPU(x_flag));
+
+   m68ki_jit_store(M68KI_X86_EDX, M68KI_JIT_CPU(not_z_flag));
+   m68ki_jit_op(M68KI_X86_MOV, M68KI_X86_ESI, M68KI_X86_EDX);
+   m68ki_jit_shift(M68KI_X86_SHR_IMM, M68KI_X86_ESI, 24);
+   m68ki_jit_store(M68KI_X86_ESI, M68KI_JIT_CPU(n_flag));
+}
+
+/* ---------------------------- Memory accesses --------------------------- */
+
+/* Make the core look like the handler is running, then call FUNCTION */
+static void m68ki_jit_call(m68ki_jit_state* state, void* function)
+{
+   m68ki_jit_store_imm(M68KI_JIT_CPU(pc), state->next_pc);
+   m68ki_jit_store_imm(M68KI_JIT_CPU(ppc), state->pc);
+   m68ki_jit_store_imm(M68KI_JIT_CPU(ir), state->ir);
+   m68ki_jit_use_cycles(state->cycles - state->charged);
+   state->charged = state->cycles;
+
+   /* address in edi, value in esi */
+   m68ki_jit_field(0x23, M68KI_X86_EDI, M68KI_JIT_CPU(address_mask));
+
+   /* mov rax, function; call rax */
+   m68ki_jit_byte(0x48);
+   m68ki_jit_byte(0xb8);
+   m68ki_jit_quad((uint64_t)(uintptr_t)function);
+   m68ki_jit_byte(0xff);
+   m68ki_jit_byte(0xd0);
+}
+
+/* After the opcode that called out is done, leave if an interrupt was taken or there arnt enough cycles for the rest */
+static void m68ki_jit_call_done(m68ki_jit_state* state)
+{
+   state->cycles += CYC_INSTRUCTION[state->ir];
+   m68ki_jit_use_cycles(state->cycles - state->charged);
+   state->charged = state->cycles;
+
+   /* cmp dword [rbx + pc], next_pc; jne */
+   m68ki_jit_field(0x81, 7, M68KI_JIT_CPU(pc));
+   m68ki_jit_long(state->next_pc);
+   m68ki_jit_exit_if(state, 0x5);
+
+   /* cmp dword [r14], cycles the rest of the block needs, filled in at the end; jle */
+   m68ki_jit_byte(0x41);
+   m68ki_jit_byte(0x81);
+   m68ki_jit_byte(0x3e);
+   state->cycle_checks[state->cycle_check_count] = m68ki_jit_out;
+   state->cycle_check_cycles[state->cycle_check_count++] = state->cycles;
+   m68ki_jit_long(0);
+   m68ki_jit_exit_if(state, 0xe);
+}
+
+/* Address register + displacement into edi, MODE is the 68k EA mode(2 = (An), 3 = (An)+, 4 = -(An), 5 = d16(An)) */
+static void m68ki_jit_ea_32(m68ki_jit_state* state, uint mode, uint reg)
+{
+   m68ki_jit_load(M68KI_X86_EDI, M68KI_JIT_A(reg));
+   switch(mode)
+   {
+      case 3:
+         m68ki_jit_op(M68KI_X86_MOV, M68KI_X86_EAX, M68KI_X86_EDI);
+         m68ki_jit_op_imm(M68KI_X86_ADD_IMM, M68KI_X86_EAX, 4);
+         m68ki_jit_store(M68KI_X86_EAX, M68KI_JIT_A(reg));
+         break;
+      case 4:
+         m68ki_jit_op_imm(M68KI_X86_SUB_IMM, M68KI_X86_EDI, 4);
+         m68ki_jit_store(M68KI_X86_EDI, M68KI_JIT_A(reg));
+         break;
+      case 5:
+         m68ki_jit_op_imm(M68KI_X86_ADD_IMM, M68KI_X86_EDI, MAKE_INT_16(m68k_read_immediate_16(ADDRESS_68K(state->pc + 2))));
+         break;
+   }
+}
+
+/* ------------------------------- Opcodes -------------------------------- */
+
+/* Emit the opcode at state->pc, returns 0 without emitting anything if it isnt translated */
+static uint m68ki_jit_opcode(m68ki_jit_state* state)
+{
+   uint ir = state->ir;
+   uint rx = (ir >> 9) & 7;
+   uint ry = ir & 7;
+   uint ry_mode = (ir >> 3) & 7;
+   uint rx_mode = (ir >> 6) & 7;
+
+   state->next_pc = state->pc + 2;
+
+   /* MOVEQ */
+   if((ir & 0xf100) == 0x7000)
+   {
+      uint res = MAKE_INT_8(MASK_OUT_ABOVE_8(ir));
+
+      m68ki_jit_store_imm(M68KI_JIT_D(rx), res);
+      m68ki_jit_flags_logic_imm(res);
+      return 1;
+   }
+
+   /* MOVE.L, MOVEA.L */
+   if((ir & 0xf000) == 0x2000)
+   {
+      if(ry_mode <= 1 && rx_mode <= 1)
+      {
+         /* Dy or Ay to Dx or Ax */
+         m68ki_jit_load(M68KI_X86_EDX, M68KI_JIT_REG(ir & 0xf));
+         m68ki_jit_store(M68KI_X86_EDX, rx_mode == 0 ? M68KI_JIT_D(rx) : M68KI_JIT_A(rx));
+         if(rx_mode == 0)
+            m68ki_jit_flags_logic(24);
+         return 1;
+      }
+      if((ir & 0x003f) == 0x003c && rx_mode <= 1)
+      {
+         /* #imm to Dx or Ax */
+         uint res = m68k_read_immediate_32(ADDRESS_68K(state->pc + 2));
+
+         state->next_pc += 4;
+         m68ki_jit_store_imm(rx_mode == 0 ? M68KI_JIT_D(rx) : M68KI_JIT_A(rx), res);
+         if(rx_mode == 0)
+            m68ki_jit_flags_logic_imm(res);
+         return 1;
+      }
+      if(rx_mode == 0 && (ry_mode == 2 || ry_mode == 3 || ry_mode == 5))
+      {
+         /* (Ay), (Ay)+ or d16(Ay) to Dx */
+         if(ry_mode == 5)
+            state->next_pc += 2;
+         m68ki_jit_ea_32(state, ry_mode, ry);
+         m68ki_jit_call(state, (void*)m68k_read_memory_32);
+         m68ki_jit_op(M68KI_X86_MOV, M68KI_X86_EDX, M68KI_X86_EAX);
+         m68ki_jit_store(M68KI_X86_EDX, M68KI_JIT_D(rx));
+         m68ki_jit_flags_logic(24);
+         m68ki_jit_call_done(state);
+         return 1;
+      }
+      if(ry_mode == 0 && rx_mode >= 2 && rx_mode <= 5)
+      {
+         /* Dy to (Ax), (Ax)+, -(Ax) or d16(Ax), the value is kept in the stack slot over the call */
+         if(rx_mode == 5)
+            state->next_pc += 2;
+         m68ki_jit_load(M68KI_X86_ESI, M68KI_JIT_D(ry));
+         m68ki_jit_byte(0x89);
+         m68ki_jit_byte(0x34);
+         m68ki_jit_byte(0x24);
+         m68ki_jit_ea_32(state, rx_mode, rx);
+         m68ki_jit_call(state, (void*)m68k_write_memory_32);
+         m68ki_jit_byte(0x8b);
+         m68ki_jit_byte(0x14);
+         m68ki_jit_byte(0x24);
+         m68ki_jit_flags_logic(24);
+         m68ki_jit_call_done(state);
+         return 1;
+      }
+      return 0;
+   }
+
+   /* MOVE.W Dy,Dx */
+   if((ir & 0xf1f8) == 0x3000)
+   {
+      m68ki_jit_load(M68KI_X86_EDX, M68KI_JIT_D(ry));
+      m68ki_jit_op_imm(M68KI_X86_AND_IMM, M68KI_X86_EDX, 0xffff);
+      m68ki_jit_load(M68KI_X86_ECX, M68KI_JIT_D(rx));
+      m68ki_jit_op_imm(M68KI_X86_AND_IMM, M68KI_X86_ECX, 0xffff0000);
+      m68ki_jit_op(M68KI_X86_OR, M68KI_X86_ECX, M68KI_X86_EDX);
+      m68ki_jit_store(M68KI_X86_ECX, M68KI_JIT_D(rx));
+      m68ki_jit_flags_logic(8);
+      return 1;
+   }
+
+   /* ADD.L, SUB.L and CMP.L Dy or Ay to Dx */
+   if(((ir & 0xf1f0) == 0xd080 || (ir & 0xf1f0) == 0x9080 || (ir & 0xf1f0) == 0xb080) && ry_mode <= 1)
+   {
+      uint subtract = (ir & 0xf000) != 0xd000;
+
+      m68ki_jit_load(M68KI_X86_EAX, M68KI_JIT_REG(ir & 0xf));
+      m68ki_jit_load(M68KI_X86_ECX, M68KI_JIT_D(rx));
+      m68ki_jit_op(M68KI_X86_MOV, M68KI_X86_EDX, M68KI_X86_ECX);
+      m68ki_jit_op(subtract ? M68KI_X86_SUB : M68KI_X86_ADD, M68KI_X86_EDX, M68KI_X86_EAX);
+      if((ir & 0xf000) != 0xb000)
+         m68ki_jit_store(M68KI_X86_EDX, M68KI_JIT_D(rx));
+      m68ki_jit_flags_arithmetic(subtract, (ir & 0xf000) != 0xb000);
+      return 1;
+   }
+
+   /* ADDQ.L and SUBQ.L to Dy */
+   if((ir & 0xf0f8) == 0x5080)
+   {
+      uint subtract = ir & 0x0100;
+
+      m68ki_jit_mov_imm(M68KI_X86_EAX, ((rx - 1) & 7) + 1);
+      m68ki_jit_load(M68KI_X86_ECX, M68KI_JIT_D(ry));
+      m68ki_jit_op(M68KI_X86_MOV, M68KI_X86_EDX, M68KI_X86_ECX);
+      m68ki_jit_op(subtract ? M68KI_X86_SUB : M68KI_X86_ADD, M68KI_X86_EDX, M68KI_X86_EAX);
+      m68ki_jit_store(M68KI_X86_EDX, M68KI_JIT_D(ry));
+      m68ki_jit_flags_arithmetic(subtract, 1);
+      return 1;
+   }
+
+   /* ADDQ and SUBQ .W or .L to Ay, no flags */
+   if((ir & 0xf0f8) == 0x5048 || (ir & 0xf0f8) == 0x5088)
+   {
+      m68ki_jit_load(M68KI_X86_EAX, M68KI_JIT_A(ry));
+      m68ki_jit_op_imm((ir & 0x0100) ? M68KI_X86_SUB_IMM : M68KI_X86_ADD_IMM, M68KI_X86_EAX, ((rx - 1) & 7) + 1);
+      m68ki_jit_store(M68KI_X86_EAX, M68KI_JIT_A(ry));
+      return 1;
+   }
+
+   /* ADDA.L and SUBA.L Dy or Ay to Ax */
+   if(((ir & 0xf1f0) == 0xd1c0 || (ir & 0xf1f0) == 0x91c0) && ry_mode <= 1)
+   {
+      m68ki_jit_load(M68KI_X86_EAX, M68KI_JIT_A(rx));
+      m68ki_jit_load(M68KI_X86_ECX, M68KI_JIT_REG(ir & 0xf));
+      m68ki_jit_op((ir & 0xf000) == 0xd000 ? M68KI_X86_ADD : M68KI_X86_SUB, M68KI_X86_EAX, M68KI_X86_ECX);
+      m68ki_jit_store(M68KI_X86_EAX, M68KI_JIT_A(rx));
+      return 1;
+   }
+
+   /* AND.L and OR.L Dy to Dx, EOR.L Dx to Dy */
+   if((ir & 0xf1f8) == 0xc080 || (ir & 0xf1f8) == 0x8080 || (ir & 0xf1f8) == 0xb180)
+   {
+      uint dst = (ir & 0xf000) == 0xb000 ? ry : rx;
+
+      m68ki_jit_load(M68KI_X86_EDX, M68KI_JIT_D(dst));
+      m68ki_jit_load(M68KI_X86_EAX, M68KI_JIT_D(dst == rx ? ry : rx));
+      m68ki_jit_op((ir & 0xf000) == 0xc000 ? M68KI_X86_AND : (ir & 0xf000) == 0x8000 ? M68KI_X86_OR : M68KI_X86_XOR, M68KI_X86_EDX, M68KI_X86_EAX);
+      m68ki_jit_store(M68KI_X86_EDX, M68KI_JIT_D(dst));
+      m68ki_jit_flags_logic(24);
+      return 1;
+   }
+
+   /* CLR.L Dy */
+   if((ir & 0xfff8) == 0x4280)
+   {
+      m68ki_jit_store_imm(M68KI_JIT_D(ry), 0);
+      m68ki_jit_store_imm(M68KI_JIT_CPU(n_flag), NFLAG_CLEAR);
+      m68ki_jit_store_imm(M68KI_JIT_CPU(v_flag), VFLAG_CLEAR);
+      m68ki_jit_store_imm(M68KI_JIT_CPU(c_flag), CFLAG_CLEAR);
+      m68ki_jit_store_imm(M68KI_JIT_CPU(not_z_flag), ZFLAG_SET);
+      return 1;
+   }
+
+   /* TST.L, NOT.L and SWAP Dy */
+   if((ir & 0xfff8) == 0x4a80 || (ir & 0xfff8) == 0x4680 || (ir & 0xfff8) == 0x4840)
+   {
+      m68ki_jit_load(M68KI_X86_EDX, M68KI_JIT_D(ry));
+      if((ir & 0xfff8) != 0x4a80)
+      {
+         if((ir & 0xfff8) == 0x4680)
+            m68ki_jit_not(M68KI_X86_EDX);
+         else
+            m68ki_jit_shift(M68KI_X86_ROL_IMM, M68KI_X86_EDX, 16);
+         m68ki_jit_store(M68KI_X86_EDX, M68KI_JIT_D(ry));
+      }
+      m68ki_jit_flags_logic(24);
+      return 1;
+   }
+
+   /* NEG.L Dy */
+   if((ir & 0xfff8) == 0x4480)
+   {
+      m68ki_jit_load(M68KI_X86_EAX, M68KI_JIT_D(ry));
+      m68ki_jit_op(M68KI_X86_XOR, M68KI_X86_EDX, M68KI_X86_EDX);
+      m68ki_jit_op(M68KI_X86_SUB, M68KI_X86_EDX, M68KI_X86_EAX);
+      m68ki_jit_store(M68KI_X86_EDX, M68KI_JIT_D(ry));
+      m68ki_jit_store(M68KI_X86_EDX, M68KI_JIT_CPU(not_z_flag));
+      m68ki_jit_op(M68KI_X86_MOV, M68KI_X86_ESI, M68KI_X86_EDX);
+      m68ki_jit_shift(M68KI_X86_SHR_IMM, M68KI_X86_ESI, 24);
+      m68ki_jit_store(M68KI_X86_ESI, M68KI_JIT_CPU(n_flag));
+      /* C = X = CFLAG_SUB_32(dst, 0, res) = (dst | res)>>23, V = (dst & res)>>24 */
+      m68ki_jit_op(M68KI_X86_MOV, M68KI_X86_ESI, M68KI_X86_EAX);
+      m68ki_jit_op(M68KI_X86_OR, M68KI_X86_ESI, M68KI_X86_EDX);
+      m68ki_jit_shift(M68KI_X86_SHR_IMM, M68KI_X86_ESI, 23);
+      m68ki_jit_store(M68KI_X86_ESI, M68KI_JIT_CPU(c_flag));
+      m68ki_jit_store(M68KI_X86_ESI, M68KI_JIT_CPU(x_flag));
+      m68ki_jit_op(M68KI_X86_AND, M68KI_X86_EAX, M68KI_X86_EDX);
+      m68ki_jit_shift(M68KI_X86_SHR_IMM, M68KI_X86_EAX, 24);
+      m68ki_jit_store(M68KI_X86_EAX, M68KI_JIT_CPU(v_flag));
+      return 1;
+   }
+
+   /* EXT.W and EXT.L Dy */
+   if((ir & 0xfff8) == 0x4880 || (ir & 0xfff8) == 0x48c0)
+   {
+      m68ki_jit_load(M68KI_X86_ECX, M68KI_JIT_D(ry));
+      if((ir & 0xfff8) == 0x48c0)
+      {
+         /* movsx edx, cx */
+         m68ki_jit_byte(0x0f);
+         m68ki_jit_byte(0xbf);
+         m68ki_jit_byte(0xd1);
+         m68ki_jit_store(M68KI_X86_EDX, M68KI_JIT_D(ry));
+         m68ki_jit_flags_logic(24);
+      }
+      else
+      {
+         /* movsx edx, cl, N is NFLAG_16() of the whole register */
+         m68ki_jit_byte(0x0f);
+         m68ki_jit_byte(0xbe);
+         m68ki_jit_byte(0xd1);
+         m68ki_jit_op_imm(M68KI_X86_AND_IMM, M68KI_X86_EDX, 0xffff);
+         m68ki_jit_op_imm(M68KI_X86_AND_IMM, M68KI_X86_ECX, 0xffff0000);
+         m68ki_jit_op(M68KI_X86_OR, M68KI_X86_ECX, M68KI_X86_EDX);
+         m68ki_jit_store(M68KI_X86_ECX, M68KI_JIT_D(ry));
+         m68ki_jit_store(M68KI_X86_EDX, M68KI_JIT_CPU(not_z_flag));
+         m68ki_jit_shift(M68KI_X86_SHR_IMM, M68KI_X86_ECX, 8);
+         m68ki_jit_store(M68KI_X86_ECX, M68KI_JIT_CPU(n_flag));
+         m68ki_jit_store_imm(M68KI_JIT_CPU(v_flag), VFLAG_CLEAR);
+         m68ki_jit_store_imm(M68KI_JIT_CPU(c_flag), CFLAG_CLEAR);
+      }
+      return 1;
+   }
+
+   /* LEA (Ay),Ax and LEA d16(Ay),Ax */
+   if((ir & 0xf1f8) == 0x41d0 || (ir & 0xf1f8) == 0x41e8)
+   {
+      m68ki_jit_load(M68KI_X86_EAX, M68KI_JIT_A(ry));
+      if(ry_mode == 5)
+      {
+         m68ki_jit_op_imm(M68KI_X86_ADD_IMM, M68KI_X86_EAX, MAKE_INT_16(m68k_read_immediate_16(ADDRESS_68K(state->pc + 2))));
+         state->next_pc += 2;
+      }
+      m68ki_jit_store(M68KI_X86_EAX, M68KI_JIT_A(rx));
+      return 1;
+   }
+
+   /* EXG Dx,Dy, Ax,Ay and Dx,Ay */
+   if((ir & 0xf1f8) == 0xc140 || (ir & 0xf1f8) == 0xc148 || (ir & 0xf1f8) == 0xc188)
+   {
+      uint reg_a = (ir & 0xf1f8) == 0xc148 ? M68KI_JIT_A(rx) : M68KI_JIT_D(rx);
+      uint reg_b = (ir & 0xf1f8) == 0xc140 ? M68KI_JIT_D(ry) : M68KI_JIT_A(ry);
+
+      m68ki_jit_load(M68KI_X86_EAX, reg_a);
+      m68ki_jit_load(M68KI_X86_ECX, reg_b);
+      m68ki_jit_store(M68KI_X86_ECX, reg_a);
+      m68ki_jit_store(M68KI_X86_EAX, reg_b);
+      return 1;
+   }
+
+   /* NOP */
+   if(ir == 0x4e71)
+      return 1;
+
+   return 0;
+}
+
+/* ------------------------------- Blocks --------------------------------- */
+
+void m68ki_flush_jit(void)
+{
+   uint i;
+
+   for(i = 0; i < M68KI_JIT_BLOCKS; i++)
+   {
+      m68ki_jit_blocks[i].pc = 1;
+      m68ki_jit_blocks[i].code = NULL;
+   }
+
+   /* a block that is running keeps its code until it returns, nothing is translated until then */
+   m68ki_jit_code_used = 0;
+}
+
+static void m68ki_jit_translate(m68ki_jit_block* block, uint pc)
+{
+   m68ki_jit_state state;
+   uint8* start;
+   uint opcodes;
+   uint i;
+
+   block->pc = pc;
+   block->cycles = 0;
+   block->code = NULL;
+   if(m68ki_jit_unavailable || !M68K_BLOCK_CACHE_CALLBACK(pc))
+      return;
+
+   if(m68ki_jit_code_used + M68KI_JIT_BLOCK_BYTES > M68KI_JIT_CODE_BYTES)
+   {
+      m68ki_flush_jit();
+      block->pc = pc;
+   }
+
+   start = m68ki_jit_code + m68ki_jit_code_used;
+   m68ki_jit_out = start;
+   memset(&state, 0, sizeof(state));
+
+   /* push rbx; push r14; sub rsp, 8; mov rbx, &m68ki_cpu; mov r14, &m68ki_remaining_cycles */
+   m68ki_jit_byte(0x53);
+   m68ki_jit_byte(0x41);
+   m68ki_jit_byte(0x56);
+   m68ki_jit_byte(0x48);
+   m68ki_jit_byte(0x83);
+   m68ki_jit_byte(0xec);
+   m68ki_jit_byte(0x08);
+   m68ki_jit_byte(0x48);
+   m68ki_jit_byte(0xbb);
+   m68ki_jit_quad((uint64_t)(uintptr_t)&m68ki_cpu);
+   m68ki_jit_byte(0x49);
+   m68ki_jit_byte(0xbe);
+   m68ki_jit_quad((uint64_t)(uintptr_t)&m68ki_remaining_cycles);
+
+   state.pc = pc;
+   for(opcodes = 0; opcodes < M68KI_JIT_OPCODES && M68K_BLOCK_CACHE_CALLBACK(state.pc); opcodes++)
+   {
+      uint cycles = state.cycles;
+
+      state.ir = m68k_read_immediate_16(ADDRESS_68K(state.pc));
+      if(!m68ki_jit_opcode(&state))
+         break;
+
+      /* opcodes that dont call out are charged with the next call or at the end, no opcode takes 0 cycles */
+      if(state.cycles == cycles)
+         state.cycles += CYC_INSTRUCTION[state.ir];
+      state.last_pc = state.pc;
+      state.last_ir = state.ir;
+      state.last_cycles = cycles;
+      state.pc = state.next_pc;
+   }
+
+   if(opcodes == 0)
+      return;
+
+   /* leave the core where the handlers would have */
+   m68ki_jit_store_imm(M68KI_JIT_CPU(pc), state.pc);
+   m68ki_jit_store_imm(M68KI_JIT_CPU(ppc), state.last_pc);
+   m68ki_jit_store_imm(M68KI_JIT_CPU(ir), state.last_ir);
+   m68ki_jit_use_cycles(state.cycles - state.charged);
+
+   /* the exits skip to here, add rsp, 8; pop r14; pop rbx; ret */
+   for(i = 0; i < state.exit_count; i++)
+   {
+      uint offset = m68ki_jit_out - (state.exits[i] + 4);
+
+      memcpy(state.exits[i], &offset, 4);
+   }
+   for(i = 0; i < state.cycle_check_count; i++)
+   {
+      uint rest = state.last_cycles > state.cycle_check_cycles[i] ? state.last_cycles - state.cycle_check_cycles[i] : 0;
+
+      memcpy(state.cycle_checks[i], &rest, 4);
+   }
+   m68ki_jit_byte(0x48);
+   m68ki_jit_byte(0x83);
+   m68ki_jit_byte(0xc4);
+   m68ki_jit_byte(0x08);
+   m68ki_jit_byte(0x41);
+   m68ki_jit_byte(0x5e);
+   m68ki_jit_byte(0x5b);
+   m68ki_jit_byte(0xc3);
+
+   m68ki_jit_code_used += m68ki_jit_out - start;
+   block->cycles = state.last_cycles;
+   block->code = (void (*)(void))start;
+}
+
+/* Run the translated block at the PC, or 1 opcode the normal way if there isnt one */
+void m68ki_execute_jit(void)
+{
+   m68ki_jit_block* block = &m68ki_jit_blocks[(REG_PC >> 1) & (M68KI_JIT_BLOCKS - 1)];
+
+   if(block->pc != REG_PC && m68ki_jit_running == 0)
+   {
+      if(m68ki_jit_code == NULL && !m68ki_jit_unavailable)
+      {
+         void* code = mmap(NULL, M68KI_JIT_CODE_BYTES, PROT_READ | PROT_WRITE | PROT_EXEC, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+
+         if(code != MAP_FAILED)
+            m68ki_jit_code = code;
+         else
+            m68ki_jit_unavailable = 1;
+         m68ki_flush_jit();
+      }
+      m68ki_jit_translate(block, REG_PC);
+   }
+
+   /* trace mode, opcodes that arnt translated and blocks that would run past the end of the timeslice go through the handlers */
+   if(block->pc != REG_PC || block->code == NULL || FLAG_T1 || GET_CYCLES() <= (sint)block->cycles)
+   {
+      m68ki_trace_t1(); /* auto-disable (see m68kcpu.h) */
+      REG_PPC = REG_PC;
+      REG_IR = m68ki_read_imm_16();
+      m68ki_instruction_handler(REG_IR)();
+      USE_CYCLES(CYC_INSTRUCTION[REG_IR]);
+      m68ki_exception_if_trace(); /* auto-disable (see m68kcpu.h) */
+      return;
+   }
+
+   m68ki_resolve_flags();
+   m68ki_jit_running++;
+   block->code();
+   m68ki_jit_running--;
+}
+#endif /* M68K_X86_64_JIT */
@@ -24,6 +24,8 @@ void m68k_op_abcd_8_rr(void)
    uint dst = *r_dst;
    uint res = LOW_NIBBLE(src) + LOW_NIBBLE(dst) + XFLAG_AS_1();
 
+   m68ki_resolve_flags();
+
    FLAG_V = ~res; /* Undefined V behavior */
 
    if(res > 9)
@@ -50,6 +52,8 @@ void m68k_op_abcd_8_mm_ax7(void)
    uint dst = m68ki_read_8(ea);
    uint res = LOW_NIBBLE(src) + LOW_NIBBLE(dst) + XFLAG_AS_1();
 
+   m68ki_resolve_flags();
+
    FLAG_V = ~res; /* Undefined V behavior */
 
    if(res > 9)
@@ -76,6 +80,8 @@ void m68k_op_abcd_8_mm_ay7(void)
    uint dst = m68ki_read_8(ea);
    uint res = LOW_NIBBLE(src) + LOW_NIBBLE(dst) + XFLAG_AS_1();
 
+   m68ki_resolve_flags();
+
    FLAG_V = ~res; /* Undefined V behavior */
 
    if(res > 9)
@@ -102,6 +108,8 @@ void m68k_op_abcd_8_mm_axy7(void)
    uint dst = m68ki_read_8(ea);
    uint res = LOW_NIBBLE(src) + LOW_NIBBLE(dst) + XFLAG_AS_1();
 
+   m68ki_resolve_flags();
+
    FLAG_V = ~res; /* Undefined V behavior */
 
    if(res > 9)
@@ -128,6 +136,8 @@ void m68k_op_abcd_8_mm(void)
    uint dst = m68ki_read_8(ea);
    uint res = LOW_NIBBLE(src) + LOW_NIBBLE(dst) + XFLAG_AS_1();
 
+   m68ki_resolve_flags();
+
    FLAG_V = ~res; /* Undefined V behavior */
 
    if(res > 9)
@@ -154,12 +164,9 @@ void m68k_op_add_8_er_d(void)
    uint dst = MASK_OUT_ABOVE_8(*r_dst);
    uint res = src + dst;
 
-   FLAG_N = NFLAG_8(res);
-   FLAG_V = VFLAG_ADD_8(src, dst, res);
-   FLAG_X = FLAG_C = CFLAG_8(res);
-   FLAG_Z = MASK_OUT_ABOVE_8(res);
+   m68ki_set_xnzvc_add_8(src, dst, res);
 
-   *r_dst = MASK_OUT_BELOW_8(*r_dst) | FLAG_Z;
+   *r_dst = MASK_OUT_BELOW_8(*r_dst) | MASK_OUT_ABOVE_8(res);
 }
 
 
@@ -170,12 +177,9 @@ void m68k_op_add_8_er_ai(void)
    uint dst = MASK_OUT_ABOVE_8(*r_dst);
    uint res = src + dst;
 
-   FLAG_N = NFLAG_8(res);
-   FLAG_V = VFLAG_ADD_8(src, dst, res);
-   FLAG_X = FLAG_C = CFLAG_8(res);
-   FLAG_Z = MASK_OUT_ABOVE_8(res);
+   m68ki_set_xnzvc_add_8(src, dst, res);
 
-   *r_dst = MASK_OUT_BELOW_8(*r_dst) | FLAG_Z;
+   *r_dst = MASK_OUT_BELOW_8(*r_dst) | MASK_OUT_ABOVE_8(res);
 }
 
 
@@ -186,12 +190,9 @@ void m68k_op_add_8_er_pi(void)
    uint dst = MASK_OUT_ABOVE_8(*r_dst);
    uint res = src + dst;
 
-   FLAG_N = NFLAG_8(res);
-   FLAG_V = VFLAG_ADD_8(src, dst, res);
-   FLAG_X = FLAG_C = CFLAG_8(res);
-   FLAG_Z = MASK_OUT_ABOVE_8(res);
+   m68ki_set_xnzvc_add_8(src, dst, res);
 
-   *r_dst = MASK_OUT_BELOW_8(*r_dst) | FLAG_Z;
+   *r_dst = MASK_OUT_BELOW_8(*r_dst) | MASK_OUT_ABOVE_8(res);
 }
 
 
@@ -202,12 +203,9 @@ void m68k_op_add_8_er_pi7(void)
    uint dst = MASK_OUT_ABOVE_8(*r_dst);
    uint res = src + dst;
 
-   FLAG_N = NFLAG_8(res);
-   FLAG_V = VFLAG_ADD_8(src, dst, res);
-   FLAG_X = FLAG_C = CFLAG_8(res);
-   FLAG_Z = MASK_OUT_ABOVE_8(res);
+   m68ki_set_xnzvc_add_8(src, dst, res);
 
-   *r_dst = MASK_OUT_BELOW_8(*r_dst) | FLAG_Z;
+   *r_dst = MASK_OUT_BELOW_8(*r_dst) | MASK_OUT_ABOVE_8(res);
 }
 
 
@@ -218,12 +216,9 @@ void m68k_op_add_8_er_pd(void)
    uint dst = MASK_OUT_ABOVE_8(*r_dst);
    uint res = src + dst;
 
-   FLAG_N = NFLAG_8(res);
-   FLAG_V = VFLAG_ADD_8(src, dst, res);
-   FLAG_X = FLAG_C = CFLAG_8(res);
-   FLAG_Z = MASK_OUT_ABOVE_8(res);
+   m68ki_set_xnzvc_add_8(src, dst, res);
 
-   *r_dst = MASK_OUT_BELOW_8(*r_dst) | FLAG_Z;
+   *r_dst = MASK_OUT_BELOW_8(*r_dst) | MASK_OUT_ABOVE_8(res);
 }
 
 
@@ -234,12 +229,9 @@ void m68k_op_add_8_er_pd7(void)
    uint dst = MASK_OUT_ABOVE_8(*r_dst);
    uint res = src + dst;
 
-   FLAG_N = NFLAG_8(res);
-   FLAG_V = VFLAG_ADD_8(src, dst, res);
-   FLAG_X = FLAG_C = CFLAG_8(res);
-   FLAG_Z = MASK_OUT_ABOVE_8(res);
+   m68ki_set_xnzvc_add_8(src, dst, res);
 
-   *r_dst = MASK_OUT_BELOW_8(*r_dst) | FLAG_Z;
+   *r_dst = MASK_OUT_BELOW_8(*r_dst) | MASK_OUT_ABOVE_8(res);
 }
 
 
@@ -250,12 +242,9 @@ void m68k_op_add_8_er_di(void)
    uint dst = MASK_OUT_ABOVE_8(*r_dst);
    uint res = src + dst;
 
-   FLAG_N = NFLAG_8(res);
-   FLAG_V = VFLAG_ADD_8(src, dst, res);
-   FLAG_X = FLAG_C = CFLAG_8(res);
-   FLAG_Z = MASK_OUT_ABOVE_8(res);
+   m68ki_set_xnzvc_add_8(src, dst, res);
 
-   *r_dst = MASK_OUT_BELOW_8(*r_dst) | FLAG_Z;
+   *r_dst = MASK_OUT_BELOW_8(*r_dst) | MASK_OUT_ABOVE_8(res);
 }
 
 
@@ -266,12 +255,9 @@ void m68k_op_add_8_er_ix(void)
    uint dst = MASK_OUT_ABOVE_8(*r_dst);
    uint res = src + dst;
 
-   FLAG_N = NFLAG_8(res);
-   FLAG_V = VFLAG_ADD_8(src, dst, res);
-   FLAG_X = FLAG_C = CFLAG_8(res);
-   FLAG_Z = MASK_OUT_ABOVE_8(res);
+   m68ki_set_xnzvc_add_8(src, dst, res);
 
-   *r_dst = MASK_OUT_BELOW_8(*r_dst) | FLAG_Z;
+   *r_dst = MASK_OUT_BELOW_8(*r_dst) | MASK_OUT_ABOVE_8(res);
 }
 
 
@@ -282,12 +268,9 @@ void m68k_op_add_8_er_aw(void)
    uint dst = MASK_OUT_ABOVE_8(*r_dst);
    uint res = src + dst;
 
-   FLAG_N = NFLAG_8(res);
-   FLAG_V = VFLAG_ADD_8(src, dst, res);
-   FLAG_X = FLAG_C = CFLAG_8(res);
-   FLAG_Z = MASK_OUT_ABOVE_8(res);
+   m68ki_set_xnzvc_add_8(src, dst, res);
 
-   *r_dst = MASK_OUT_BELOW_8(*r_dst) | FLAG_Z;
+   *r_dst = MASK_OUT_BELOW_8(*r_dst) | MASK_OUT_ABOVE_8(res);
 }
 
 
@@ -298,12 +281,9 @@ void m68k_op_add_8_er_al(void)
    uint dst = MASK_OUT_ABOVE_8(*r_dst);
    uint res = src + dst;
 
-   FLAG_N = NFLAG_8(res);
-   FLAG_V = VFLAG_ADD_8(src, dst, res);
-   FLAG_X = FLAG_C = CFLAG_8(res);
-   FLAG_Z = MASK_OUT_ABOVE_8(res);
+   m68ki_set_xnzvc_add_8(src, dst, res);
 
-   *r_dst = MASK_OUT_BELOW_8(*r_dst) | FLAG_Z;
+   *r_dst = MASK_OUT_BELOW_8(*r_dst) | MASK_OUT_ABOVE_8(res);
 }
 
 
@@ -314,12 +294,9 @@ void m68k_op_add_8_er_pcdi(void)
    uint dst = MASK_OUT_ABOVE_8(*r_dst);
    uint res = src + dst;
 
-   FLAG_N = NFLAG_8(res);
-   FLAG_V = VFLAG_ADD_8(src, dst, res);
-   FLAG_X = FLAG_C = CFLAG_8(res);
-   FLAG_Z = MASK_OUT_ABOVE_8(res);
+   m68ki_set_xnzvc_add_8(src, dst, res);
 
-   *r_dst = MASK_OUT_BELOW_8(*r_dst) | FLAG_Z;
+   *r_dst = MASK_OUT_BELOW_8(*r_dst) | MASK_OUT_ABOVE_8(res);
 }
 
 
@@ -330,12 +307,9 @@ void m68k_op_add_8_er_pcix(void)
    uint dst = MASK_OUT_ABOVE_8(*r_dst);
    uint res = src + dst;
 
-   FLAG_N = NFLAG_8(res);
-   FLAG_V = VFLAG_ADD_8(src, dst, res);
-   FLAG_X = FLAG_C = CFLAG_8(res);
-   FLAG_Z = MASK_OUT_ABOVE_8(res);
+   m68ki_set_xnzvc_add_8(src, dst, res);
 
-   *r_dst = MASK_OUT_BELOW_8(*r_dst) | FLAG_Z;
+   *r_dst = MASK_OUT_BELOW_8(*r_dst) | MASK_OUT_ABOVE_8(res);
 }
 
 
@@ -346,12 +320,9 @@ void m68k_op_add_8_er_i(void)
    uint dst = MASK_OUT_ABOVE_8(*r_dst);
    uint res = src + dst;
 
-   FLAG_N = NFLAG_8(res);
-   FLAG_V = VFLAG_ADD_8(src, dst, res);
-   FLAG_X = FLAG_C = CFLAG_8(res);
-   FLAG_Z = MASK_OUT_ABOVE_8(res);
+   m68ki_set_xnzvc_add_8(src, dst, res);
 
-   *r_dst = MASK_OUT_BELOW_8(*r_dst) | FLAG_Z;
+   *r_dst = MASK_OUT_BELOW_8(*r_dst) | MASK_OUT_ABOVE_8(res);
 }
 
 
@@ -362,12 +333,9 @@ void m68k_op_add_16_er_d(void)
    uint dst = MASK_OUT_ABOVE_16(*r_dst);
    uint res = src + dst;
 
-   FLAG_N = NFLAG_16(res);
-   FLAG_V = VFLAG_ADD_16(src, dst, res);
-   FLAG_X = FLAG_C = CFLAG_16(res);
-   FLAG_Z = MASK_OUT_ABOVE_16(res);
+   m68ki_set_xnzvc_add_16(src, dst, res);
 
-   *r_dst = MASK_OUT_BELOW_16(*r_dst) | FLAG_Z;
+   *r_dst = MASK_OUT_BELOW_16(*r_dst) | MASK_OUT_ABOVE_16(res);
 }
 
 
@@ -378,12 +346,9 @@ void m68k_op_add_16_er_a(void)
    uint dst = MASK_OUT_ABOVE_16(*r_dst);
    uint res = src + dst;
 
-   FLAG_N = NFLAG_16(res);
-   FLAG_V = VFLAG_ADD_16(src, dst, res);
-   FLAG_X = FLAG_C = CFLAG_16(res);
-   FLAG_Z = MASK_OUT_ABOVE_16(res);
+   m68ki_set_xnzvc_add_16(src, dst, res);
 
-   *r_dst = MASK_OUT_BELOW_16(*r_dst) | FLAG_Z;
+   *r_dst = MASK_OUT_BELOW_16(*r_dst) | MASK_OUT_ABOVE_16(res);
 }
 
 
@@ -394,12 +359,9 @@ void m68k_op_add_16_er_ai(void)
    uint dst = MASK_OUT_ABOVE_16(*r_dst);
    uint res = src + dst;
 
-   FLAG_N = NFLAG_16(res);
-   FLAG_V = VFLAG_ADD_16(src, dst, res);
-   FLAG_X = FLAG_C = CFLAG_16(res);
-   FLAG_Z = MASK_OUT_ABOVE_16(res);
+   m68ki_set_xnzvc_add_16(src, dst, res);
 
-   *r_dst = MASK_OUT_BELOW_16(*r_dst) | FLAG_Z;
+   *r_dst = MASK_OUT_BELOW_16(*r_dst) | MASK_OUT_ABOVE_16(res);
 }
 
 
@@ -410,12 +372,9 @@ void m68k_op_add_16_er_pi(void)
    uint dst = MASK_OUT_ABOVE_16(*r_dst);
    uint res = src + dst;
 
-   FLAG_N = NFLAG_16(res);
-   FLAG_V = VFLAG_ADD_16(src, dst, res);
-   FLAG_X = FLAG_C = CFLAG_16(res);
-   FLAG_Z = MASK_OUT_ABOVE_16(res);
+   m68ki_set_xnzvc_add_16(src, dst, res);
 
-   *r_dst = MASK_OUT_BELOW_16(*r_dst) | FLAG_Z;
+   *r_dst = MASK_OUT_BELOW_16(*r_dst) | MASK_OUT_ABOVE_16(res);
 }
 
 
@@ -426,12 +385,9 @@ void m68k_op_add_16_er_pd(void)
    uint dst = MASK_OUT_ABOVE_16(*r_dst);
    uint res = src + dst;
 
-   FLAG_N = NFLAG_16(res);
-   FLAG_V = VFLAG_ADD_16(src, dst, res);
-   FLAG_X = FLAG_C = CFLAG_16(res);
-   FLAG_Z = MASK_OUT_ABOVE_16(res);
+   m68ki_set_xnzvc_add_16(src, dst, res);
 
-   *r_dst = MASK_OUT_BELOW_16(*r_dst) | FLAG_Z;
+   *r_dst = MASK_OUT_BELOW_16(*r_dst) | MASK_OUT_ABOVE_16(res);
 }
 
 
@@ -442,12 +398,9 @@ void m68k_op_add_16_er_di(void)
    uint dst = MASK_OUT_ABOVE_16(*r_dst);
    uint res = src + dst;
 
-   FLAG_N = NFLAG_16(res);
-   FLAG_V = VFLAG_ADD_16(src, dst, res);
-   FLAG_X = FLAG_C = CFLAG_16(res);
-   FLAG_Z = MASK_OUT_ABOVE_16(res);
+   m68ki_set_xnzvc_add_16(src, dst, res);
 
-   *r_dst = MASK_OUT_BELOW_16(*r_dst) | FLAG_Z;
+   *r_dst = MASK_OUT_BELOW_16(*r_dst) | MASK_OUT_ABOVE_16(res);
 }
 
 
@@ -458,12 +411,9 @@ void m68k_op_add_16_er_ix(void)
    uint dst = MASK_OUT_ABOVE_16(*r_dst);
    uint res = src + dst;
 
-   FLAG_N = NFLAG_16(res);
-   FLAG_V = VFLAG_ADD_16(src, dst, res);
-   FLAG_X = FLAG_C = CFLAG_16(res);
-   FLAG_Z = MASK_OUT_ABOVE_16(res);
+   m68ki_set_xnzvc_add_16(src, dst, res);
 
-   *r_dst = MASK_OUT_BELOW_16(*r_dst) | FLAG_Z;
+   *r_dst = MASK_OUT_BELOW_16(*r_dst) | MASK_OUT_ABOVE_16(res);
 }
 
 
@@ -474,12 +424,9 @@ void m68k_op_add_16_er_aw(void)
    uint dst = MASK_OUT_ABOVE_16(*r_dst);
    uint res = src + dst;
 
-   FLAG_N = NFLAG_16(res);
-   FLAG_V = VFLAG_ADD_16(src, dst, res);
-   FLAG_X = FLAG_C = CFLAG_16(res);
-   FLAG_Z = MASK_OUT_ABOVE_16(res);
+   m68ki_set_xnzvc_add_16(src, dst, res);
 
-   *r_dst = MASK_OUT_BELOW_16(*r_dst) | FLAG_Z;
+   *r_dst = MASK_OUT_BELOW_16(*r_dst) | MASK_OUT_ABOVE_16(res);
 }
 
 
@@ -490,12 +437,9 @@ void m68k_op_add_16_er_al(void)
    uint dst = MASK_OUT_ABOVE_16(*r_dst);
    uint res = src + dst;
 
-   FLAG_N = NFLAG_16(res);
-   FLAG_V = VFLAG_ADD_16(src, dst, res);
-   FLAG_X = FLAG_C = CFLAG_16(res);
-   FLAG_Z = MASK_OUT_ABOVE_16(res);
+   m68ki_set_xnzvc_add_16(src, dst, res);
 
-   *r_dst = MASK_OUT_BELOW_16(*r_dst) | FLAG_Z;
+   *r_dst = MASK_OUT_BELOW_16(*r_dst) | MASK_OUT_ABOVE_16(res);
 }
 
 
@@ -506,12 +450,9 @@ void m68k_op_add_16_er_pcdi(void)
    uint dst = MASK_OUT_ABOVE_16(*r_dst);
    uint res = src + dst;
 
-   FLAG_N = NFLAG_16(res);
-   FLAG_V = VFLAG_ADD_16(src, dst, res);
-   FLAG_X = FLAG_C = CFLAG_16(res);
-   FLAG_Z = MASK_OUT_ABOVE_16(res);
+   m68ki_set_xnzvc_add_16(src, dst, res);
 
-   *r_dst = MASK_OUT_BELOW_16(*r_dst) | FLAG_Z;
+   *r_dst = MASK_OUT_BELOW_16(*r_dst) | MASK_OUT_ABOVE_16(res);
 }
 
 
@@ -522,12 +463,9 @@ void m68k_op_add_16_er_pcix(void)
    uint dst = MASK_OUT_ABOVE_16(*r_dst);
    uint res = src + dst;
 
-   FLAG_N = NFLAG_16(res);
-   FLAG_V = VFLAG_ADD_16(src, dst, res);
-   FLAG_X = FLAG_C = CFLAG_16(res);
-   FLAG_Z = MASK_OUT_ABOVE_16(res);
+   m68ki_set_xnzvc_add_16(src, dst, res);
 
-   *r_dst = MASK_OUT_BELOW_16(*r_dst) | FLAG_Z;
+   *r_dst = MASK_OUT_BELOW_16(*r_dst) | MASK_OUT_ABOVE_16(res);
 }
 
 
@@ -538,12 +476,9 @@ void m68k_op_add_16_er_i(void)
    uint dst = MASK_OUT_ABOVE_16(*r_dst);
    uint res = src + dst;
 
-   FLAG_N = NFLAG_16(res);
-   FLAG_V = VFLAG_ADD_16(src, dst, res);
-   FLAG_X = FLAG_C = CFLAG_16(res);
-   FLAG_Z = MASK_OUT_ABOVE_16(res);
+   m68ki_set_xnzvc_add_16(src, dst, res);
 
-   *r_dst = MASK_OUT_BELOW_16(*r_dst) | FLAG_Z;
+   *r_dst = MASK_OUT_BELOW_16(*r_dst) | MASK_OUT_ABOVE_16(res);
 }
 
 
@@ -554,12 +489,9 @@ void m68k_op_add_32_er_d(void)
    uint dst = *r_dst;
    uint res = src + dst;
 
-   FLAG_N = NFLAG_32(res);
-   FLAG_V = VFLAG_ADD_32(src, dst, res);
-   FLAG_X = FLAG_C = CFLAG_ADD_32(src, dst, res);
-   FLAG_Z = MASK_OUT_ABOVE_32(res);
+   m68ki_set_xnzvc_add_32(src, dst, res);
 
-   *r_dst = FLAG_Z;
+   *r_dst = MASK_OUT_ABOVE_32(res);
 }
 
 
@@ -570,12 +502,9 @@ void m68k_op_add_32_er_a(void)
    uint dst = *r_dst;
    uint res = src + dst;
 
-   FLAG_N = NFLAG_32(res);
-   FLAG_V = VFLAG_ADD_32(src, dst, res);
-   FLAG_X = FLAG_C = CFLAG_ADD_32(src, dst, res);
-   FLAG_Z = MASK_OUT_ABOVE_32(res);
+   m68ki_set_xnzvc_add_32(src, dst, res);
 
-   *r_dst = FLAG_Z;
+   *r_dst = MASK_OUT_ABOVE_32(res);
 }
 
 
@@ -586,12 +515,9 @@ void m68k_op_add_32_er_ai(void)
    uint dst = *r_dst;
    uint res = src + dst;
 
-   FLAG_N = NFLAG_32(res);
-   FLAG_V = VFLAG_ADD_32(src, dst, res);
-   FLAG_X = FLAG_C = CFLAG_ADD_32(src, dst, res);
-   FLAG_Z = MASK_OUT_ABOVE_32(res);
+   m68ki_set_xnzvc_add_32(src, dst, res);
 
-   *r_dst = FLAG_Z;
+   *r_dst = MASK_OUT_ABOVE_32(res);
 }
 
 
@@ -602,12 +528,9 @@ void m68k_op_add_32_er_pi(void)
    uint dst = *r_dst;
    uint res = src + dst;
 
-   FLAG_N = NFLAG_32(res);
-   FLAG_V = VFLAG_ADD_32(src, dst, res);
-   FLAG_X = FLAG_C = CFLAG_ADD_32(src, dst, res);
-   FLAG_Z = MASK_OUT_ABOVE_32(res);
+   m68ki_set_xnzvc_add_32(src, dst, res);
 
-   *r_dst = FLAG_Z;
+   *r_dst = MASK_OUT_ABOVE_32(res);
 }
 
 
@@ -618,12 +541,9 @@ void m68k_op_add_32_er_pd(void)
    uint dst = *r_dst;
    uint res = src + dst;
 
-   FLAG_N = NFLAG_32(res);
-   FLAG_V = VFLAG_ADD_32(src, dst, res);
-   FLAG_X = FLAG_C = CFLAG_ADD_32(src, dst, res);
-   FLAG_Z = MASK_OUT_ABOVE_32(res);
+   m68ki_set_xnzvc_add_32(src, dst, res);
 
-   *r_dst = FLAG_Z;
+   *r_dst = MASK_OUT_ABOVE_32(res);
 }
 
 
@@ -634,12 +554,9 @@ void m68k_op_add_32_er_di(void)
    uint dst = *r_dst;
    uint res = src + dst;
 
-   FLAG_N = NFLAG_32(res);
-   FLAG_V = VFLAG_ADD_32(src, dst, res);
-   FLAG_X = FLAG_C = CFLAG_ADD_32(src, dst, res);
-   FLAG_Z = MASK_OUT_ABOVE_32(res);
+   m68ki_set_xnzvc_add_32(src, dst, res);
 
-   *r_dst = FLAG_Z;
+   *r_dst = MASK_OUT_ABOVE_32(res);
 }
 
 
@@ -650,12 +567,9 @@ void m68k_op_add_32_er_ix(void)
    uint dst = *r_dst;
    uint res = src + dst;
 
-   FLAG_N = NFLAG_32(res);
-   FLAG_V = VFLAG_ADD_32(src, dst, res);
-   FLAG_X = FLAG_C = CFLAG_ADD_32(src, dst, res);
-   FLAG_Z = MASK_OUT_ABOVE_32(res);
+   m68ki_set_xnzvc_add_32(src, dst, res);
 
-   *r_dst = FLAG_Z;
+   *r_dst = MASK_OUT_ABOVE_32(res);
 }
 
 
@@ -666,12 +580,9 @@ void m68k_op_add_32_er_aw(void)
    uint dst = *r_dst;
    uint res = src + dst;
 
-   FLAG_N = NFLAG_32(res);
-   FLAG_V = VFLAG_ADD_32(src, dst, res);
-   FLAG_X = FLAG_C = CFLAG_ADD_32(src, dst, res);
-   FLAG_Z = MASK_OUT_ABOVE_32(res);
+   m68ki_set_xnzvc_add_32(src, dst, res);
 
-   *r_dst = FLAG_Z;
+   *r_dst = MASK_OUT_ABOVE_32(res);
 }
 
 
@@ -682,12 +593,9 @@ void m68k_op_add_32_er_al(void)
    uint dst = *r_dst;
    uint res = src + dst;
 
-   FLAG_N = NFLAG_32(res);
-   FLAG_V = VFLAG_ADD_32(src, dst, res);
-   FLAG_X = FLAG_C = CFLAG_ADD_32(src, dst, res);
-   FLAG_Z = MASK_OUT_ABOVE_32(res);
+   m68ki_set_xnzvc_add_32(src, dst, res);
 
-   *r_dst = FLAG_Z;
+   *r_dst = MASK_OUT_ABOVE_32(res);
 }
 
 
@@ -698,12 +606,9 @@ void m68k_op_add_32_er_pcdi(void)
    uint dst = *r_dst;
    uint res = src + dst;
 
-   FLAG_N = NFLAG_32(res);
-   FLAG_V = VFLAG_ADD_32(src, dst, res);
-   FLAG_X = FLAG_C = CFLAG_ADD_32(src, dst, res);
-   FLAG_Z = MASK_OUT_ABOVE_32(res);
+   m68ki_set_xnzvc_add_32(src, dst, res);
 
-   *r_dst = FLAG_Z;
+   *r_dst = MASK_OUT_ABOVE_32(res);
 }
 
 
@@ -714,12 +619,9 @@ void m68k_op_add_32_er_pcix(void)
    uint dst = *r_dst;
    uint res = src + dst;
 
-   FLAG_N = NFLAG_32(res);
-   FLAG_V = VFLAG_ADD_32(src, dst, res);
-   FLAG_X = FLAG_C = CFLAG_ADD_32(src, dst, res);
-   FLAG_Z = MASK_OUT_ABOVE_32(res);
+   m68ki_set_xnzvc_add_32(src, dst, res);
 
-   *r_dst = FLAG_Z;
+   *r_dst = MASK_OUT_ABOVE_32(res);
 }
 
 
@@ -730,12 +632,9 @@ void m68k_op_add_32_er_i(void)
    uint dst = *r_dst;
    uint res = src + dst;
 
-   FLAG_N = NFLAG_32(res);
-   FLAG_V = VFLAG_ADD_32(src, dst, res);
-   FLAG_X = FLAG_C = CFLAG_ADD_32(src, dst, res);
-   FLAG_Z = MASK_OUT_ABOVE_32(res);
+   m68ki_set_xnzvc_add_32(src, dst, res);
 
-   *r_dst = FLAG_Z;
+   *r_dst = MASK_OUT_ABOVE_32(res);
 }
 
 
@@ -746,12 +645,9 @@ void m68k_op_add_8_re_ai(void)
    uint dst = m68ki_read_8(ea);
    uint res = src + dst;
 
-   FLAG_N = NFLAG_8(res);
-   FLAG_V = VFLAG_ADD_8(src, dst, res);
-   FLAG_X = FLAG_C = CFLAG_8(res);
-   FLAG_Z = MASK_OUT_ABOVE_8(res);
+   m68ki_set_xnzvc_add_8(src, dst, res);
 
-   m68ki_write_8(ea, FLAG_Z);
+   m68ki_write_8(ea, MASK_OUT_ABOVE_8(res));
 }
 
 
@@ -762,12 +658,9 @@ void m68k_op_add_8_re_pi(void)
    uint dst = m68ki_read_8(ea);
    uint res = src + dst;
 
-   FLAG_N = NFLAG_8(res);
-   FLAG_V = VFLAG_ADD_8(src, dst, res);
-   FLAG_X = FLAG_C = CFLAG_8(res);
-   FLAG_Z = MASK_OUT_ABOVE_8(res);
+   m68ki_set_xnzvc_add_8(src, dst, res);
 
-   m68ki_write_8(ea, FLAG_Z);
+   m68ki_write_8(ea, MASK_OUT_ABOVE_8(res));
 }
 
 
@@ -778,12 +671,9 @@ void m68k_op_add_8_re_pi7(void)
    uint dst = m68ki_read_8(ea);
    uint res = src + dst;
 
-   FLAG_N = NFLAG_8(res);
-   FLAG_V = VFLAG_ADD_8(src, dst, res);
-   FLAG_X = FLAG_C = CFLAG_8(res);
-   FLAG_Z = MASK_OUT_ABOVE_8(res);
+   m68ki_set_xnzvc_add_8(src, dst, res);
 
-   m68ki_write_8(ea, FLAG_Z);
+   m68ki_write_8(ea, MASK_OUT_ABOVE_8(res));
 }
 
 
@@ -794,12 +684,9 @@ void m68k_op_add_8_re_pd(void)
    uint dst = m68ki_read_8(ea);
    uint res = src + dst;
 
-   FLAG_N = NFLAG_8(res);
-   FLAG_V = VFLAG_ADD_8(src, dst, res);
-   FLAG_X = FLAG_C = CFLAG_8(res);
-   FLAG_Z = MASK_OUT_ABOVE_8(res);
+   m68ki_set_xnzvc_add_8(src, dst, res);
 
-   m68ki_write_8(ea, FLAG_Z);
+   m68ki_write_8(ea, MASK_OUT_ABOVE_8(res));
 }
 
 
@@ -810,12 +697,9 @@ void m68k_op_add_8_re_pd7(void)
    uint dst = m68ki_read_8(ea);
    uint res = src + dst;
 
-   FLAG_N = NFLAG_8(res);
-   FLAG_V = VFLAG_ADD_8(src, dst, res);
-   FLAG_X = FLAG_C = CFLAG_8(res);
-   FLAG_Z = MASK_OUT_ABOVE_8(res);
+   m68ki_set_xnzvc_add_8(src, dst, res);
 
-   m68ki_write_8(ea, FLAG_Z);
+   m68ki_write_8(ea, MASK_OUT_ABOVE_8(res));
 }
 
 
@@ -826,12 +710,9 @@ void m68k_op_add_8_re_di(void)
    uint dst = m68ki_read_8(ea);
    uint res = src + dst;
 
-   FLAG_N = NFLAG_8(res);
-   FLAG_V = VFLAG_ADD_8(src, dst, res);
-   FLAG_X = FLAG_C = CFLAG_8(res);
-   FLAG_Z = MASK_OUT_ABOVE_8(res);
+   m68ki_set_xnzvc_add_8(src, dst, res);
 
-   m68ki_write_8(ea, FLAG_Z);
+   m68ki_write_8(ea, MASK_OUT_ABOVE_8(res));
 }
 
 
@@ -842,12 +723,9 @@ void m68k_op_add_8_re_ix(void)
    uint dst = m68ki_read_8(ea);
    uint res = src + dst;
 
-   FLAG_N = NFLAG_8(res);
-   FLAG_V = VFLAG_ADD_8(src, dst, res);
-   FLAG_X = FLAG_C = CFLAG_8(res);
-   FLAG_Z = MASK_OUT_ABOVE_8(res);
+   m68ki_set_xnzvc_add_8(src, dst, res);
 
-   m68ki_write_8(ea, FLAG_Z);
+   m68ki_write_8(ea, MASK_OUT_ABOVE_8(res));
 }
 
 
@@ -858,12 +736,9 @@ void m68k_op_add_8_re_aw(void)
    uint dst = m68ki_read_8(ea);
    uint res = src + dst;
 
-   FLAG_N = NFLAG_8(res);
-   FLAG_V = VFLAG_ADD_8(src, dst, res);
-   FLAG_X = FLAG_C = CFLAG_8(res);
-   FLAG_Z = MASK_OUT_ABOVE_8(res);
+   m68ki_set_xnzvc_add_8(src, dst, res);
 
-   m68ki_write_8(ea, FLAG_Z);
+   m68ki_write_8(ea, MASK_OUT_ABOVE_8(res));
 }
 
 
@@ -874,12 +749,9 @@ void m68k_op_add_8_re_al(void)
    uint dst = m68ki_read_8(ea);
    uint res = src + dst;
 
-   FLAG_N = NFLAG_8(res);
-   FLAG_V = VFLAG_ADD_8(src, dst, res);
-   FLAG_X = FLAG_C = CFLAG_8(res);
-   FLAG_Z = MASK_OUT_ABOVE_8(res);
+   m68ki_set_xnzvc_add_8(src, dst, res);
 
-   m68ki_write_8(ea, FLAG_Z);
+   m68ki_write_8(ea, MASK_OUT_ABOVE_8(res));
 }
 
 
@@ -890,12 +762,9 @@ void m68k_op_add_16_re_ai(void)
    uint dst = m68ki_read_16(ea);
    uint res = src + dst;
 
-   FLAG_N = NFLAG_16(res);
-   FLAG_V = VFLAG_ADD_16(src, dst, res);
-   FLAG_X = FLAG_C = CFLAG_16(res);
-   FLAG_Z = MASK_OUT_ABOVE_16(res);
+   m68ki_set_xnzvc_add_16(src, dst, res);
 
-   m68ki_write_16(ea, FLAG_Z);
+   m68ki_write_16(ea, MASK_OUT_ABOVE_16(res));
 }
 
 
@@ -906,12 +775,9 @@ void m68k_op_add_16_re_pi(void)
    uint dst = m68ki_read_16(ea);
    uint res = src + dst;
 
-   FLAG_N = NFLAG_16(res);
-   FLAG_V = VFLAG_ADD_16(src, dst, res);
-   FLAG_X = FLAG_C = CFLAG_16(res);
-   FLAG_Z = MASK_OUT_ABOVE_16(res);
+   m68ki_set_xnzvc_add_16(src, dst, res);
 
-   m68ki_write_16(ea, FLAG_Z);
+   m68ki_write_16(ea, MASK_OUT_ABOVE_16(res));
 }
 
 
@@ -922,12 +788,9 @@ void m68k_op_add_16_re_pd(void)
    uint dst = m68ki_read_16(ea);
    uint res = src + dst;
 
-   FLAG_N = NFLAG_16(res);
-   FLAG_V = VFLAG_ADD_16(src, dst, res);
-   FLAG_X = FLAG_C = CFLAG_16(res);
-   FLAG_Z = MASK_OUT_ABOVE_16(res);
+   m68ki_set_xnzvc_add_16(src, dst, res);
 
-   m68ki_write_16(ea, FLAG_Z);
+   m68ki_write_16(ea, MASK_OUT_ABOVE_16(res));
 }
 
 
@@ -938,12 +801,9 @@ void m68k_op_add_16_re_di(void)
    uint dst = m68ki_read_16(ea);
    uint res = src + dst;
 
-   FLAG_N = NFLAG_16(res);
-   FLAG_V = VFLAG_ADD_16(src, dst, res);
-   FLAG_X = FLAG_C = CFLAG_16(res);
-   FLAG_Z = MASK_OUT_ABOVE_16(res);
+   m68ki_set_xnzvc_add_16(src, dst, res);
 
-   m68ki_write_16(ea, FLAG_Z);
+   m68ki_write_16(ea, MASK_OUT_ABOVE_16(res));
 }
 
 
@@ -954,12 +814,9 @@ void m68k_op_add_16_re_ix(void)
    uint dst = m68ki_read_16(ea);
    uint res = src + dst;
 
-   FLAG_N = NFLAG_16(res);
-   FLAG_V = VFLAG_ADD_16(src, dst, res);
-   FLAG_X = FLAG_C = CFLAG_16(res);
-   FLAG_Z = MASK_OUT_ABOVE_16(res);
+   m68ki_set_xnzvc_add_16(src, dst, res);
 
-   m68ki_write_16(ea, FLAG_Z);
+   m68ki_write_16(ea, MASK_OUT_ABOVE_16(res));
 }
 
 
@@ -970,12 +827,9 @@ void m68k_op_add_16_re_aw(void)
    uint dst = m68ki_read_16(ea);
    uint res = src + dst;
 
-   FLAG_N = NFLAG_16(res);
-   FLAG_V = VFLAG_ADD_16(src, dst, res);
-   FLAG_X = FLAG_C = CFLAG_16(res);
-   FLAG_Z = MASK_OUT_ABOVE_16(res);
+   m68ki_set_xnzvc_add_16(src, dst, res);
 
-   m68ki_write_16(ea, FLAG_Z);
+   m68ki_write_16(ea, MASK_OUT_ABOVE_16(res));
 }
 
 
@@ -986,12 +840,9 @@ void m68k_op_add_16_re_al(void)
    uint dst = m68ki_read_16(ea);
    uint res = src + dst;
 
-   FLAG_N = NFLAG_16(res);
-   FLAG_V = VFLAG_ADD_16(src, dst, res);
-   FLAG_X = FLAG_C = CFLAG_16(res);
-   FLAG_Z = MASK_OUT_ABOVE_16(res);
+   m68ki_set_xnzvc_add_16(src, dst, res);
 
-   m68ki_write_16(ea, FLAG_Z);
+   m68ki_write_16(ea, MASK_OUT_ABOVE_16(res));
 }
 
 
@@ -1002,12 +853,9 @@ void m68k_op_add_32_re_ai(void)
    uint dst = m68ki_read_32(ea);
    uint res = src + dst;
 
-   FLAG_N = NFLAG_32(res);
-   FLAG_V = VFLAG_ADD_32(src, dst, res);
-   FLAG_X = FLAG_C = CFLAG_ADD_32(src, dst, res);
-   FLAG_Z = MASK_OUT_ABOVE_32(res);
+   m68ki_set_xnzvc_add_32(src, dst, res);
 
-   m68ki_write_32(ea, FLAG_Z);
+   m68ki_write_32(ea, MASK_OUT_ABOVE_32(res));
 }
 
 
@@ -1018,12 +866,9 @@ void m68k_op_add_32_re_pi(void)
    uint dst = m68ki_read_32(ea);
    uint res = src + dst;
 
-   FLAG_N = NFLAG_32(res);
-   FLAG_V = VFLAG_ADD_32(src, dst, res);
-   FLAG_X = FLAG_C = CFLAG_ADD_32(src, dst, res);
-   FLAG_Z = MASK_OUT_ABOVE_32(res);
+   m68ki_set_xnzvc_add_32(src, dst, res);
 
-   m68ki_write_32(ea, FLAG_Z);
+   m68ki_write_32(ea, MASK_OUT_ABOVE_32(res));
 }
 
 
@@ -1034,12 +879,9 @@ void m68k_op_add_32_re_pd(void)
    uint dst = m68ki_read_32(ea);
    uint res = src + dst;
 
-   FLAG_N = NFLAG_32(res);
-   FLAG_V = VFLAG_ADD_32(src, dst, res);
-   FLAG_X = FLAG_C = CFLAG_ADD_32(src, dst, res);
-   FLAG_Z = MASK_OUT_ABOVE_32(res);
+   m68ki_set_xnzvc_add_32(src, dst, res);
 
-   m68ki_write_32(ea, FLAG_Z);
+   m68ki_write_32(ea, MASK_OUT_ABOVE_32(res));
 }
 
 
@@ -1050,12 +892,9 @@ void m68k_op_add_32_re_di(void)
    uint dst = m68ki_read_32(ea);
    uint res = src + dst;
 
-   FLAG_N = NFLAG_32(res);
-   FLAG_V = VFLAG_ADD_32(src, dst, res);
-   FLAG_X = FLAG_C = CFLAG_ADD_32(src, dst, res);
-   FLAG_Z = MASK_OUT_ABOVE_32(res);
+   m68ki_set_xnzvc_add_32(src, dst, res);
 
-   m68ki_write_32(ea, FLAG_Z);
+   m68ki_write_32(ea, MASK_OUT_ABOVE_32(res));
 }
 
 
@@ -1066,12 +905,9 @@ void m68k_op_add_32_re_ix(void)
    uint dst = m68ki_read_32(ea);
    uint res = src + dst;
 
-   FLAG_N = NFLAG_32(res);
-   FLAG_V = VFLAG_ADD_32(src, dst, res);
-   FLAG_X = FLAG_C = CFLAG_ADD_32(src, dst, res);
-   FLAG_Z = MASK_OUT_ABOVE_32(res);
+   m68ki_set_xnzvc_add_32(src, dst, res);
 
-   m68ki_write_32(ea, FLAG_Z);
+   m68ki_write_32(ea, MASK_OUT_ABOVE_32(res));
 }
 
 
@@ -1082,12 +918,9 @@ void m68k_op_add_32_re_aw(void)
    uint dst = m68ki_read_32(ea);
    uint res = src + dst;
 
-   FLAG_N = NFLAG_32(res);
-   FLAG_V = VFLAG_ADD_32(src, dst, res);
-   FLAG_X = FLAG_C = CFLAG_ADD_32(src, dst, res);
-   FLAG_Z = MASK_OUT_ABOVE_32(res);
+   m68ki_set_xnzvc_add_32(src, dst, res);
 
-   m68ki_write_32(ea, FLAG_Z);
+   m68ki_write_32(ea, MASK_OUT_ABOVE_32(res));
 }
 
 
@@ -1098,12 +931,9 @@ void m68k_op_add_32_re_al(void)
    uint dst = m68ki_read_32(ea);
    uint res = src + dst;
 
-   FLAG_N = NFLAG_32(res);
-   FLAG_V = VFLAG_ADD_32(src, dst, res);
-   FLAG_X = FLAG_C = CFLAG_ADD_32(src, dst, res);
-   FLAG_Z = MASK_OUT_ABOVE_32(res);
+   m68ki_set_xnzvc_add_32(src, dst, res);
 
-   m68ki_write_32(ea, FLAG_Z);
+   m68ki_write_32(ea, MASK_OUT_ABOVE_32(res));
 }
 
 
@@ -1326,12 +1156,9 @@ void m68k_op_addi_8_d(void)
    uint dst = MASK_OUT_ABOVE_8(*r_dst);
    uint res = src + dst;
 
-   FLAG_N = NFLAG_8(res);
-   FLAG_V = VFLAG_ADD_8(src, dst, res);
-   FLAG_X = FLAG_C = CFLAG_8(res);
-   FLAG_Z = MASK_OUT_ABOVE_8(res);
+   m68ki_set_xnzvc_add_8(src, dst, res);
 
-   *r_dst = MASK_OUT_BELOW_8(*r_dst) | FLAG_Z;
+   *r_dst = MASK_OUT_BELOW_8(*r_dst) | MASK_OUT_ABOVE_8(res);
 }
 
 
@@ -1342,12 +1169,9 @@ void m68k_op_addi_8_ai(void)
    uint dst = m68ki_read_8(ea);
    uint res = src + dst;
 
-   FLAG_N = NFLAG_8(res);
-   FLAG_V = VFLAG_ADD_8(src, dst, res);
-   FLAG_X = FLAG_C = CFLAG_8(res);
-   FLAG_Z = MASK_OUT_ABOVE_8(res);
+   m68ki_set_xnzvc_add_8(src, dst, res);
 
-   m68ki_write_8(ea, FLAG_Z);
+   m68ki_write_8(ea, MASK_OUT_ABOVE_8(res));
 }
 
 
@@ -1358,12 +1182,9 @@ void m68k_op_addi_8_pi(void)
    uint dst = m68ki_read_8(ea);
    uint res = src + dst;
 
-   FLAG_N = NFLAG_8(res);
-   FLAG_V = VFLAG_ADD_8(src, dst, res);
-   FLAG_X = FLAG_C = CFLAG_8(res);
-   FLAG_Z = MASK_OUT_ABOVE_8(res);
+   m68ki_set_xnzvc_add_8(src, dst, res);
 
-   m68ki_write_8(ea, FLAG_Z);
+   m68ki_write_8(ea, MASK_OUT_ABOVE_8(res));
 }
 
 
@@ -1374,12 +1195,9 @@ void m68k_op_addi_8_pi7(void)
    uint dst = m68ki_read_8(ea);
    uint res = src + dst;
 
-   FLAG_N = NFLAG_8(res);
-   FLAG_V = VFLAG_ADD_8(src, dst, res);
-   FLAG_X = FLAG_C = CFLAG_8(res);
-   FLAG_Z = MASK_OUT_ABOVE_8(res);
+   m68ki_set_xnzvc_add_8(src, dst, res);
 
-   m68ki_write_8(ea, FLAG_Z);
+   m68ki_write_8(ea, MASK_OUT_ABOVE_8(res));
 }
 
 
@@ -1390,12 +1208,9 @@ void m68k_op_addi_8_pd(void)
    uint dst = m68ki_read_8(ea);
    uint res = src + dst;
 
-   FLAG_N = NFLAG_8(res);
-   FLAG_V = VFLAG_ADD_8(src, dst, res);
-   FLAG_X = FLAG_C = CFLAG_8(res);
-   FLAG_Z = MASK_OUT_ABOVE_8(res);
+   m68ki_set_xnzvc_add_8(src, dst, res);
 
-   m68ki_write_8(ea, FLAG_Z);
+   m68ki_write_8(ea, MASK_OUT_ABOVE_8(res));
 }
 
 
@@ -1406,12 +1221,9 @@ void m68k_op_addi_8_pd7(void)
    uint dst = m68ki_read_8(ea);
    uint res = src + dst;
 
-   FLAG_N = NFLAG_8(res);
-   FLAG_V = VFLAG_ADD_8(src, dst, res);
-   FLAG_X = FLAG_C = CFLAG_8(res);
-   FLAG_Z = MASK_OUT_ABOVE_8(res);
+   m68ki_set_xnzvc_add_8(src, dst, res);
 
-   m68ki_write_8(ea, FLAG_Z);
+   m68ki_write_8(ea, MASK_OUT_ABOVE_8(res));
 }
 
 
@@ -1422,12 +1234,9 @@ void m68k_op_addi_8_di(void)
    uint dst = m68ki_read_8(ea);
    uint res = src + dst;
 
-   FLAG_N = NFLAG_8(res);
-   FLAG_V = VFLAG_ADD_8(src, dst, res);
-   FLAG_X = FLAG_C = CFLAG_8(res);
-   FLAG_Z = MASK_OUT_ABOVE_8(res);
+   m68ki_set_xnzvc_add_8(src, dst, res);
 
-   m68ki_write_8(ea, FLAG_Z);
+   m68ki_write_8(ea, MASK_OUT_ABOVE_8(res));
 }
 
 
@@ -1438,12 +1247,9 @@ void m68k_op_addi_8_ix(void)
    uint dst = m68ki_read_8(ea);
    uint res = src + dst;
 
-   FLAG_N = NFLAG_8(res);
-   FLAG_V = VFLAG_ADD_8(src, dst, res);
-   FLAG_X = FLAG_C = CFLAG_8(res);
-   FLAG_Z = MASK_OUT_ABOVE_8(res);
+   m68ki_set_xnzvc_add_8(src, dst, res);
 
-   m68ki_write_8(ea, FLAG_Z);
+   m68ki_write_8(ea, MASK_OUT_ABOVE_8(res));
 }
 
 
@@ -1454,12 +1260,9 @@ void m68k_op_addi_8_aw(void)
    uint dst = m68ki_read_8(ea);
    uint res = src + dst;
 
-   FLAG_N = NFLAG_8(res);
-   FLAG_V = VFLAG_ADD_8(src, dst, res);
-   FLAG_X = FLAG_C = CFLAG_8(res);
-   FLAG_Z = MASK_OUT_ABOVE_8(res);
+   m68ki_set_xnzvc_add_8(src, dst, res);
 
-   m68ki_write_8(ea, FLAG_Z);
+   m68ki_write_8(ea, MASK_OUT_ABOVE_8(res));
 }
 
 
@@ -1470,12 +1273,9 @@ void m68k_op_addi_8_al(void)
    uint dst = m68ki_read_8(ea);
    uint res = src + dst;
 
-   FLAG_N = NFLAG_8(res);
-   FLAG_V = VFLAG_ADD_8(src, dst, res);
-   FLAG_X = FLAG_C = CFLAG_8(res);
-   FLAG_Z = MASK_OUT_ABOVE_8(res);
+   m68ki_set_xnzvc_add_8(src, dst, res);
 
-   m68ki_write_8(ea, FLAG_Z);
+   m68ki_write_8(ea, MASK_OUT_ABOVE_8(res));
 }
 
 
@@ -1486,12 +1286,9 @@ void m68k_op_addi_16_d(void)
    uint dst = MASK_OUT_ABOVE_16(*r_dst);
    uint res = src + dst;
 
-   FLAG_N = NFLAG_16(res);
-   FLAG_V = VFLAG_ADD_16(src, dst, res);
-   FLAG_X = FLAG_C = CFLAG_16(res);
-   FLAG_Z = MASK_OUT_ABOVE_16(res);
+   m68ki_set_xnzvc_add_16(src, dst, res);
 
-   *r_dst = MASK_OUT_BELOW_16(*r_dst) | FLAG_Z;
+   *r_dst = MASK_OUT_BELOW_16(*r_dst) | MASK_OUT_ABOVE_16(res);
 }
 
 
@@ -1502,12 +1299,9 @@ void m68k_op_addi_16_ai(void)
    uint dst = m68ki_read_16(ea);
    uint res = src + dst;
 
-   FLAG_N = NFLAG_16(res);
-   FLAG_V = VFLAG_ADD_16(src, dst, res);
-   FLAG_X = FLAG_C = CFLAG_16(res);
-   FLAG_Z = MASK_OUT_ABOVE_16(res);
+   m68ki_set_xnzvc_add_16(src, dst, res);
 
-   m68ki_write_16(ea, FLAG_Z);
+   m68ki_write_16(ea, MASK_OUT_ABOVE_16(res));
 }
 
 
@@ -1518,12 +1312,9 @@ void m68k_op_addi_16_pi(void)
    uint dst = m68ki_read_16(ea);
    uint res = src + dst;
 
-   FLAG_N = NFLAG_16(res);
-   FLAG_V = VFLAG_ADD_16(src, dst, res);
-   FLAG_X = FLAG_C = CFLAG_16(res);
-   FLAG_Z = MASK_OUT_ABOVE_16(res);
+   m68ki_set_xnzvc_add_16(src, dst, res);
 
-   m68ki_write_16(ea, FLAG_Z);
+   m68ki_write_16(ea, MASK_OUT_ABOVE_16(res));
 }
 
 
@@ -1534,12 +1325,9 @@ void m68k_op_addi_16_pd(void)
    uint dst = m68ki_read_16(ea);
    uint res = src + dst;
 
-   FLAG_N = NFLAG_16(res);
-   FLAG_V = VFLAG_ADD_16(src, dst, res);
-   FLAG_X = FLAG_C = CFLAG_16(res);
-   FLAG_Z = MASK_OUT_ABOVE_16(res);
+   m68ki_set_xnzvc_add_16(src, dst, res);
 
-   m68ki_write_16(ea, FLAG_Z);
+   m68ki_write_16(ea, MASK_OUT_ABOVE_16(res));
 }
 
 
@@ -1550,12 +1338,9 @@ void m68k_op_addi_16_di(void)
    uint dst = m68ki_read_16(ea);
    uint res = src + dst;
 
-   FLAG_N = NFLAG_16(res);
-   FLAG_V = VFLAG_ADD_16(src, dst, res);
-   FLAG_X = FLAG_C = CFLAG_16(res);
-   FLAG_Z = MASK_OUT_ABOVE_16(res);
+   m68ki_set_xnzvc_add_16(src, dst, res);
 
-   m68ki_write_16(ea, FLAG_Z);
+   m68ki_write_16(ea, MASK_OUT_ABOVE_16(res));
 }
 
 
@@ -1566,12 +1351,9 @@ void m68k_op_addi_16_ix(void)
    uint dst = m68ki_read_16(ea);
    uint res = src + dst;
 
-   FLAG_N = NFLAG_16(res);
-   FLAG_V = VFLAG_ADD_16(src, dst, res);
-   FLAG_X = FLAG_C = CFLAG_16(res);
-   FLAG_Z = MASK_OUT_ABOVE_16(res);
+   m68ki_set_xnzvc_add_16(src, dst, res);
 
-   m68ki_write_16(ea, FLAG_Z);
+   m68ki_write_16(ea, MASK_OUT_ABOVE_16(res));
 }
 
 
@@ -1582,12 +1364,9 @@ void m68k_op_addi_16_aw(void)
    uint dst = m68ki_read_16(ea);
    uint res = src + dst;
 
-   FLAG_N = NFLAG_16(res);
-   FLAG_V = VFLAG_ADD_16(src, dst, res);
-   FLAG_X = FLAG_C = CFLAG_16(res);
-   FLAG_Z = MASK_OUT_ABOVE_16(res);
+   m68ki_set_xnzvc_add_16(src, dst, res);
 
-   m68ki_write_16(ea, FLAG_Z);
+   m68ki_write_16(ea, MASK_OUT_ABOVE_16(res));
 }
 
 
@@ -1598,12 +1377,9 @@ void m68k_op_addi_16_al(void)
    uint dst = m68ki_read_16(ea);
    uint res = src + dst;
 
-   FLAG_N = NFLAG_16(res);
-   FLAG_V = VFLAG_ADD_16(src, dst, res);
-   FLAG_X = FLAG_C = CFLAG_16(res);
-   FLAG_Z = MASK_OUT_ABOVE_16(res);
+   m68ki_set_xnzvc_add_16(src, dst, res);
 
-   m68ki_write_16(ea, FLAG_Z);
+   m68ki_write_16(ea, MASK_OUT_ABOVE_16(res));
 }
 
 
@@ -1614,12 +1390,9 @@ void m68k_op_addi_32_d(void)
    uint dst = *r_dst;
    uint res = src + dst;
 
-   FLAG_N = NFLAG_32(res);
-   FLAG_V = VFLAG_ADD_32(src, dst, res);
-   FLAG_X = FLAG_C = CFLAG_ADD_32(src, dst, res);
-   FLAG_Z = MASK_OUT_ABOVE_32(res);
+   m68ki_set_xnzvc_add_32(src, dst, res);
 
-   *r_dst = FLAG_Z;
+   *r_dst = MASK_OUT_ABOVE_32(res);
 }
 
 
@@ -1630,12 +1403,9 @@ void m68k_op_addi_32_ai(void)
    uint dst = m68ki_read_32(ea);
    uint res = src + dst;
 
-   FLAG_N = NFLAG_32(res);
-   FLAG_V = VFLAG_ADD_32(src, dst, res);
-   FLAG_X = FLAG_C = CFLAG_ADD_32(src, dst, res);
-   FLAG_Z = MASK_OUT_ABOVE_32(res);
+   m68ki_set_xnzvc_add_32(src, dst, res);
 
-   m68ki_write_32(ea, FLAG_Z);
+   m68ki_write_32(ea, MASK_OUT_ABOVE_32(res));
 }
 
 
@@ -1646,12 +1416,9 @@ void m68k_op_addi_32_pi(void)
    uint dst = m68ki_read_32(ea);
    uint res = src + dst;
 
-   FLAG_N = NFLAG_32(res);
-   FLAG_V = VFLAG_ADD_32(src, dst, res);
-   FLAG_X = FLAG_C = CFLAG_ADD_32(src, dst, res);
-   FLAG_Z = MASK_OUT_ABOVE_32(res);
+   m68ki_set_xnzvc_add_32(src, dst, res);
 
-   m68ki_write_32(ea, FLAG_Z);
+   m68ki_write_32(ea, MASK_OUT_ABOVE_32(res));
 }
 
 
@@ -1662,12 +1429,9 @@ void m68k_op_addi_32_pd(void)
    uint dst = m68ki_read_32(ea);
    uint res = src + dst;
 
-   FLAG_N = NFLAG_32(res);
-   FLAG_V = VFLAG_ADD_32(src, dst, res);
-   FLAG_X = FLAG_C = CFLAG_ADD_32(src, dst, res);
-   FLAG_Z = MASK_OUT_ABOVE_32(res);
+   m68ki_set_xnzvc_add_32(src, dst, res);
 
-   m68ki_write_32(ea, FLAG_Z);
+   m68ki_write_32(ea, MASK_OUT_ABOVE_32(res));
 }
 
 
@@ -1678,12 +1442,9 @@ void m68k_op_addi_32_di(void)
    uint dst = m68ki_read_32(ea);
    uint res = src + dst;
 
-   FLAG_N = NFLAG_32(res);
-   FLAG_V = VFLAG_ADD_32(src, dst, res);
-   FLAG_X = FLAG_C = CFLAG_ADD_32(src, dst, res);
-   FLAG_Z = MASK_OUT_ABOVE_32(res);
+   m68ki_set_xnzvc_add_32(src, dst, res);
 
-   m68ki_write_32(ea, FLAG_Z);
+   m68ki_write_32(ea, MASK_OUT_ABOVE_32(res));
 }
 
 
@@ -1694,12 +1455,9 @@ void m68k_op_addi_32_ix(void)
    uint dst = m68ki_read_32(ea);
    uint res = src + dst;
 
-   FLAG_N = NFLAG_32(res);
-   FLAG_V = VFLAG_ADD_32(src, dst, res);
-   FLAG_X = FLAG_C = CFLAG_ADD_32(src, dst, res);
-   FLAG_Z = MASK_OUT_ABOVE_32(res);
+   m68ki_set_xnzvc_add_32(src, dst, res);
 
-   m68ki_write_32(ea, FLAG_Z);
+   m68ki_write_32(ea, MASK_OUT_ABOVE_32(res));
 }
 
 
@@ -1710,12 +1468,9 @@ void m68k_op_addi_32_aw(void)
    uint dst = m68ki_read_32(ea);
    uint res = src + dst;
 
-   FLAG_N = NFLAG_32(res);
-   FLAG_V = VFLAG_ADD_32(src, dst, res);
-   FLAG_X = FLAG_C = CFLAG_ADD_32(src, dst, res);
-   FLAG_Z = MASK_OUT_ABOVE_32(res);
+   m68ki_set_xnzvc_add_32(src, dst, res);
 
-   m68ki_write_32(ea, FLAG_Z);
+   m68ki_write_32(ea, MASK_OUT_ABOVE_32(res));
 }
 
 
@@ -1726,12 +1481,9 @@ void m68k_op_addi_32_al(void)
    uint dst = m68ki_read_32(ea);
    uint res = src + dst;
 
-   FLAG_N = NFLAG_32(res);
-   FLAG_V = VFLAG_ADD_32(src, dst, res);
-   FLAG_X = FLAG_C = CFLAG_ADD_32(src, dst, res);
-   FLAG_Z = MASK_OUT_ABOVE_32(res);
+   m68ki_set_xnzvc_add_32(src, dst, res);
 
-   m68ki_write_32(ea, FLAG_Z);
+   m68ki_write_32(ea, MASK_OUT_ABOVE_32(res));
 }
 
 
@@ -1742,12 +1494,9 @@ void m68k_op_addq_8_d(void)
    uint dst = MASK_OUT_ABOVE_8(*r_dst);
    uint res = src + dst;
 
-   FLAG_N = NFLAG_8(res);
-   FLAG_V = VFLAG_ADD_8(src, dst, res);
-   FLAG_X = FLAG_C = CFLAG_8(res);
-   FLAG_Z = MASK_OUT_ABOVE_8(res);
+   m68ki_set_xnzvc_add_8(src, dst, res);
 
-   *r_dst = MASK_OUT_BELOW_8(*r_dst) | FLAG_Z;
+   *r_dst = MASK_OUT_BELOW_8(*r_dst) | MASK_OUT_ABOVE_8(res);
 }
 
 
@@ -1758,12 +1507,9 @@ void m68k_op_addq_8_ai(void)
    uint dst = m68ki_read_8(ea);
    uint res = src + dst;
 
-   FLAG_N = NFLAG_8(res);
-   FLAG_V = VFLAG_ADD_8(src, dst, res);
-   FLAG_X = FLAG_C = CFLAG_8(res);
-   FLAG_Z = MASK_OUT_ABOVE_8(res);
+   m68ki_set_xnzvc_add_8(src, dst, res);
 
-   m68ki_write_8(ea, FLAG_Z);
+   m68ki_write_8(ea, MASK_OUT_ABOVE_8(res));
 }
 
 
@@ -1774,12 +1520,9 @@ void m68k_op_addq_8_pi(void)
    uint dst = m68ki_read_8(ea);
    uint res = src + dst;
 
-   FLAG_N = NFLAG_8(res);
-   FLAG_V = VFLAG_ADD_8(src, dst, res);
-   FLAG_X = FLAG_C = CFLAG_8(res);
-   FLAG_Z = MASK_OUT_ABOVE_8(res);
+   m68ki_set_xnzvc_add_8(src, dst, res);
 
-   m68ki_write_8(ea, FLAG_Z);
+   m68ki_write_8(ea, MASK_OUT_ABOVE_8(res));
 }
 
 
@@ -1790,12 +1533,9 @@ void m68k_op_addq_8_pi7(void)
    uint dst = m68ki_read_8(ea);
    uint res = src + dst;
 
-   FLAG_N = NFLAG_8(res);
-   FLAG_V = VFLAG_ADD_8(src, dst, res);
-   FLAG_X = FLAG_C = CFLAG_8(res);
-   FLAG_Z = MASK_OUT_ABOVE_8(res);
+   m68ki_set_xnzvc_add_8(src, dst, res);
 
-   m68ki_write_8(ea, FLAG_Z);
+   m68ki_write_8(ea, MASK_OUT_ABOVE_8(res));
 }
 
 
@@ -1806,12 +1546,9 @@ void m68k_op_addq_8_pd(void)
    uint dst = m68ki_read_8(ea);
    uint res = src + dst;
 
-   FLAG_N = NFLAG_8(res);
-   FLAG_V = VFLAG_ADD_8(src, dst, res);
-   FLAG_X = FLAG_C = CFLAG_8(res);
-   FLAG_Z = MASK_OUT_ABOVE_8(res);
+   m68ki_set_xnzvc_add_8(src, dst, res);
 
-   m68ki_write_8(ea, FLAG_Z);
+   m68ki_write_8(ea, MASK_OUT_ABOVE_8(res));
 }
 
 
@@ -1822,12 +1559,9 @@ void m68k_op_addq_8_pd7(void)
    uint dst = m68ki_read_8(ea);
    uint res = src + dst;
 
-   FLAG_N = NFLAG_8(res);
-   FLAG_V = VFLAG_ADD_8(src, dst, res);
-   FLAG_X = FLAG_C = CFLAG_8(res);
-   FLAG_Z = MASK_OUT_ABOVE_8(res);
+   m68ki_set_xnzvc_add_8(src, dst, res);
 
-   m68ki_write_8(ea, FLAG_Z);
+   m68ki_write_8(ea, MASK_OUT_ABOVE_8(res));
 }
 
 
@@ -1838,12 +1572,9 @@ void m68k_op_addq_8_di(void)
    uint dst = m68ki_read_8(ea);
    uint res = src + dst;
 
-   FLAG_N = NFLAG_8(res);
-   FLAG_V = VFLAG_ADD_8(src, dst, res);
-   FLAG_X = FLAG_C = CFLAG_8(res);
-   FLAG_Z = MASK_OUT_ABOVE_8(res);
+   m68ki_set_xnzvc_add_8(src, dst, res);
 
-   m68ki_write_8(ea, FLAG_Z);
+   m68ki_write_8(ea, MASK_OUT_ABOVE_8(res));
 }
 
 
@@ -1854,12 +1585,9 @@ void m68k_op_addq_8_ix(void)
    uint dst = m68ki_read_8(ea);
    uint res = src + dst;
 
-   FLAG_N = NFLAG_8(res);
-   FLAG_V = VFLAG_ADD_8(src, dst, res);
-   FLAG_X = FLAG_C = CFLAG_8(res);
-   FLAG_Z = MASK_OUT_ABOVE_8(res);
+   m68ki_set_xnzvc_add_8(src, dst, res);
 
-   m68ki_write_8(ea, FLAG_Z);
+   m68ki_write_8(ea, MASK_OUT_ABOVE_8(res));
 }
 
 
@@ -1870,12 +1598,9 @@ void m68k_op_addq_8_aw(void)
    uint dst = m68ki_read_8(ea);
    uint res = src + dst;
 
-   FLAG_N = NFLAG_8(res);
-   FLAG_V = VFLAG_ADD_8(src, dst, res);
-   FLAG_X = FLAG_C = CFLAG_8(res);
-   FLAG_Z = MASK_OUT_ABOVE_8(res);
+   m68ki_set_xnzvc_add_8(src, dst, res);
 
-   m68ki_write_8(ea, FLAG_Z);
+   m68ki_write_8(ea, MASK_OUT_ABOVE_8(res));
 }
 
 
@@ -1886,12 +1611,9 @@ void m68k_op_addq_8_al(void)
    uint dst = m68ki_read_8(ea);
    uint res = src + dst;
 
-   FLAG_N = NFLAG_8(res);
-   FLAG_V = VFLAG_ADD_8(src, dst, res);
-   FLAG_X = FLAG_C = CFLAG_8(res);
-   FLAG_Z = MASK_OUT_ABOVE_8(res);
+   m68ki_set_xnzvc_add_8(src, dst, res);
 
-   m68ki_write_8(ea, FLAG_Z);
+   m68ki_write_8(ea, MASK_OUT_ABOVE_8(res));
 }
 
 
@@ -1902,12 +1624,9 @@ void m68k_op_addq_16_d(void)
    uint dst = MASK_OUT_ABOVE_16(*r_dst);
    uint res = src + dst;
 
-   FLAG_N = NFLAG_16(res);
-   FLAG_V = VFLAG_ADD_16(src, dst, res);
-   FLAG_X = FLAG_C = CFLAG_16(res);
-   FLAG_Z = MASK_OUT_ABOVE_16(res);
+   m68ki_set_xnzvc_add_16(src, dst, res);
 
-   *r_dst = MASK_OUT_BELOW_16(*r_dst) | FLAG_Z;
+   *r_dst = MASK_OUT_BELOW_16(*r_dst) | MASK_OUT_ABOVE_16(res);
 }
 
 
@@ -1926,12 +1645,9 @@ void m68k_op_addq_16_ai(void)
    uint dst = m68ki_read_16(ea);
    uint res = src + dst;
 
-   FLAG_N = NFLAG_16(res);
-   FLAG_V = VFLAG_ADD_16(src, dst, res);
-   FLAG_X = FLAG_C = CFLAG_16(res);
-   FLAG_Z = MASK_OUT_ABOVE_16(res);
+   m68ki_set_xnzvc_add_16(src, dst, res);
 
-   m68ki_write_16(ea, FLAG_Z);
+   m68ki_write_16(ea, MASK_OUT_ABOVE_16(res));
 }
 
 
@@ -1942,12 +1658,9 @@ void m68k_op_addq_16_pi(void)
    uint dst = m68ki_read_16(ea);
    uint res = src + dst;
 
-   FLAG_N = NFLAG_16(res);
-   FLAG_V = VFLAG_ADD_16(src, dst, res);
-   FLAG_X = FLAG_C = CFLAG_16(res);
-   FLAG_Z = MASK_OUT_ABOVE_16(res);
+   m68ki_set_xnzvc_add_16(src, dst, res);
 
-   m68ki_write_16(ea, FLAG_Z);
+   m68ki_write_16(ea, MASK_OUT_ABOVE_16(res));
 }
 
 
@@ -1958,12 +1671,9 @@ void m68k_op_addq_16_pd(void)
    uint dst = m68ki_read_16(ea);
    uint res = src + dst;
 
-   FLAG_N = NFLAG_16(res);
-   FLAG_V = VFLAG_ADD_16(src, dst, res);
-   FLAG_X = FLAG_C = CFLAG_16(res);
-   FLAG_Z = MASK_OUT_ABOVE_16(res);
+   m68ki_set_xnzvc_add_16(src, dst, res);
 
-   m68ki_write_16(ea, FLAG_Z);
+   m68ki_write_16(ea, MASK_OUT_ABOVE_16(res));
 }
 
 
@@ -1974,12 +1684,9 @@ void m68k_op_addq_16_di(void)
    uint dst = m68ki_read_16(ea);
    uint res = src + dst;
 
-   FLAG_N = NFLAG_16(res);
-   FLAG_V = VFLAG_ADD_16(src, dst, res);
-   FLAG_X = FLAG_C = CFLAG_16(res);
-   FLAG_Z = MASK_OUT_ABOVE_16(res);
+   m68ki_set_xnzvc_add_16(src, dst, res);
 
-   m68ki_write_16(ea, FLAG_Z);
+   m68ki_write_16(ea, MASK_OUT_ABOVE_16(res));
 }
 
 
@@ -1990,12 +1697,9 @@ void m68k_op_addq_16_ix(void)
    uint dst = m68ki_read_16(ea);
    uint res = src + dst;
 
-   FLAG_N = NFLAG_16(res);
-   FLAG_V = VFLAG_ADD_16(src, dst, res);
-   FLAG_X = FLAG_C = CFLAG_16(res);
-   FLAG_Z = MASK_OUT_ABOVE_16(res);
+   m68ki_set_xnzvc_add_16(src, dst, res);
 
-   m68ki_write_16(ea, FLAG_Z);
+   m68ki_write_16(ea, MASK_OUT_ABOVE_16(res));
 }
 
 
@@ -2006,12 +1710,9 @@ void m68k_op_addq_16_aw(void)
    uint dst = m68ki_read_16(ea);
    uint res = src + dst;
 
-   FLAG_N = NFLAG_16(res);
-   FLAG_V = VFLAG_ADD_16(src, dst, res);
-   FLAG_X = FLAG_C = CFLAG_16(res);
-   FLAG_Z = MASK_OUT_ABOVE_16(res);
+   m68ki_set_xnzvc_add_16(src, dst, res);
 
-   m68ki_write_16(ea, FLAG_Z);
+   m68ki_write_16(ea, MASK_OUT_ABOVE_16(res));
 }
 
 
@@ -2022,12 +1723,9 @@ void m68k_op_addq_16_al(void)
    uint dst = m68ki_read_16(ea);
    uint res = src + dst;
 
-   FLAG_N = NFLAG_16(res);
-   FLAG_V = VFLAG_ADD_16(src, dst, res);
-   FLAG_X = FLAG_C = CFLAG_16(res);
-   FLAG_Z = MASK_OUT_ABOVE_16(res);
+   m68ki_set_xnzvc_add_16(src, dst, res);
 
-   m68ki_write_16(ea, FLAG_Z);
+   m68ki_write_16(ea, MASK_OUT_ABOVE_16(res));
 }
 
 
@@ -2038,12 +1736,9 @@ void m68k_op_addq_32_d(void)
    uint dst = *r_dst;
    uint res = src + dst;
 
-   FLAG_N = NFLAG_32(res);
-   FLAG_V = VFLAG_ADD_32(src, dst, res);
-   FLAG_X = FLAG_C = CFLAG_ADD_32(src, dst, res);
-   FLAG_Z = MASK_OUT_ABOVE_32(res);
+   m68ki_set_xnzvc_add_32(src, dst, res);
 
-   *r_dst = FLAG_Z;
+   *r_dst = MASK_OUT_ABOVE_32(res);
 }
 
 
@@ -2063,12 +1758,9 @@ void m68k_op_addq_32_ai(void)
    uint res = src + dst;
 
 
-   FLAG_N = NFLAG_32(res);
-   FLAG_V = VFLAG_ADD_32(src, dst, res);
-   FLAG_X = FLAG_C = CFLAG_ADD_32(src, dst, res);
-   FLAG_Z = MASK_OUT_ABOVE_32(res);
+   m68ki_set_xnzvc_add_32(src, dst, res);
 
-   m68ki_write_32(ea, FLAG_Z);
+   m68ki_write_32(ea, MASK_OUT_ABOVE_32(res));
 }
 
 
@@ -2080,12 +1772,9 @@ void m68k_op_addq_32_pi(void)
    uint res = src + dst;
 
 
-   FLAG_N = NFLAG_32(res);
-   FLAG_V = VFLAG_ADD_32(src, dst, res);
-   FLAG_X = FLAG_C = CFLAG_ADD_32(src, dst, res);
-   FLAG_Z = MASK_OUT_ABOVE_32(res);
+   m68ki_set_xnzvc_add_32(src, dst, res);
 
-   m68ki_write_32(ea, FLAG_Z);
+   m68ki_write_32(ea, MASK_OUT_ABOVE_32(res));
 }
 
 
@@ -2097,12 +1786,9 @@ void m68k_op_addq_32_pd(void)
    uint res = src + dst;
 
 
-   FLAG_N = NFLAG_32(res);
-   FLAG_V = VFLAG_ADD_32(src, dst, res);
-   FLAG_X = FLAG_C = CFLAG_ADD_32(src, dst, res);
-   FLAG_Z = MASK_OUT_ABOVE_32(res);
+   m68ki_set_xnzvc_add_32(src, dst, res);
 
-   m68ki_write_32(ea, FLAG_Z);
+   m68ki_write_32(ea, MASK_OUT_ABOVE_32(res));
 }
 
 
@@ -2114,12 +1800,9 @@ void m68k_op_addq_32_di(void)
    uint res = src + dst;
 
 
-   FLAG_N = NFLAG_32(res);
-   FLAG_V = VFLAG_ADD_32(src, dst, res);
-   FLAG_X = FLAG_C = CFLAG_ADD_32(src, dst, res);
-   FLAG_Z = MASK_OUT_ABOVE_32(res);
+   m68ki_set_xnzvc_add_32(src, dst, res);
 
-   m68ki_write_32(ea, FLAG_Z);
+   m68ki_write_32(ea, MASK_OUT_ABOVE_32(res));
 }
 
 
@@ -2131,12 +1814,9 @@ void m68k_op_addq_32_ix(void)
    uint res = src + dst;
 
 
-   FLAG_N = NFLAG_32(res);
-   FLAG_V = VFLAG_ADD_32(src, dst, res);
-   FLAG_X = FLAG_C = CFLAG_ADD_32(src, dst, res);
-   FLAG_Z = MASK_OUT_ABOVE_32(res);
+   m68ki_set_xnzvc_add_32(src, dst, res);
 
-   m68ki_write_32(ea, FLAG_Z);
+   m68ki_write_32(ea, MASK_OUT_ABOVE_32(res));
 }
 
 
@@ -2148,12 +1828,9 @@ void m68k_op_addq_32_aw(void)
    uint res = src + dst;
 
 
-   FLAG_N = NFLAG_32(res);
-   FLAG_V = VFLAG_ADD_32(src, dst, res);
-   FLAG_X = FLAG_C = CFLAG_ADD_32(src, dst, res);
-   FLAG_Z = MASK_OUT_ABOVE_32(res);
+   m68ki_set_xnzvc_add_32(src, dst, res);
 
-   m68ki_write_32(ea, FLAG_Z);
+   m68ki_write_32(ea, MASK_OUT_ABOVE_32(res));
 }
 
 
@@ -2165,12 +1842,9 @@ void m68k_op_addq_32_al(void)
    uint res = src + dst;
 
 
-   FLAG_N = NFLAG_32(res);
-   FLAG_V = VFLAG_ADD_32(src, dst, res);
-   FLAG_X = FLAG_C = CFLAG_ADD_32(src, dst, res);
-   FLAG_Z = MASK_OUT_ABOVE_32(res);
+   m68ki_set_xnzvc_add_32(src, dst, res);
 
-   m68ki_write_32(ea, FLAG_Z);
+   m68ki_write_32(ea, MASK_OUT_ABOVE_32(res));
 }
 
 
@@ -2181,6 +1855,8 @@ void m68k_op_addx_8_rr(void)
    uint dst = MASK_OUT_ABOVE_8(*r_dst);
    uint res = src + dst + XFLAG_AS_1();
 
+   m68ki_resolve_flags();
+
    FLAG_N = NFLAG_8(res);
    FLAG_V = VFLAG_ADD_8(src, dst, res);
    FLAG_X = FLAG_C = CFLAG_8(res);
@@ -2199,6 +1875,8 @@ void m68k_op_addx_16_rr(void)
    uint dst = MASK_OUT_ABOVE_16(*r_dst);
    uint res = src + dst + XFLAG_AS_1();
 
+   m68ki_resolve_flags();
+
    FLAG_N = NFLAG_16(res);
    FLAG_V = VFLAG_ADD_16(src, dst, res);
    FLAG_X = FLAG_C = CFLAG_16(res);
@@ -2217,6 +1895,8 @@ void m68k_op_addx_32_rr(void)
    uint dst = *r_dst;
    uint res = src + dst + XFLAG_AS_1();
 
+   m68ki_resolve_flags();
+
    FLAG_N = NFLAG_32(res);
    FLAG_V = VFLAG_ADD_32(src, dst, res);
    FLAG_X = FLAG_C = CFLAG_ADD_32(src, dst, res);
@@ -2235,6 +1915,8 @@ void m68k_op_addx_8_mm_ax7(void)
    uint dst = m68ki_read_8(ea);
    uint res = src + dst + XFLAG_AS_1();
 
+   m68ki_resolve_flags();
+
    FLAG_N = NFLAG_8(res);
    FLAG_V = VFLAG_ADD_8(src, dst, res);
    FLAG_X = FLAG_C = CFLAG_8(res);
@@ -2253,6 +1935,8 @@ void m68k_op_addx_8_mm_ay7(void)
    uint dst = m68ki_read_8(ea);
    uint res = src + dst + XFLAG_AS_1();
 
+   m68ki_resolve_flags();
+
    FLAG_N = NFLAG_8(res);
    FLAG_V = VFLAG_ADD_8(src, dst, res);
    FLAG_X = FLAG_C = CFLAG_8(res);
@@ -2271,6 +1955,8 @@ void m68k_op_addx_8_mm_axy7(void)
    uint dst = m68ki_read_8(ea);
    uint res = src + dst + XFLAG_AS_1();
 
+   m68ki_resolve_flags();
+
    FLAG_N = NFLAG_8(res);
    FLAG_V = VFLAG_ADD_8(src, dst, res);
    FLAG_X = FLAG_C = CFLAG_8(res);
@@ -2289,6 +1975,8 @@ void m68k_op_addx_8_mm(void)
    uint dst = m68ki_read_8(ea);
    uint res = src + dst + XFLAG_AS_1();
 
+   m68ki_resolve_flags();
+
    FLAG_N = NFLAG_8(res);
    FLAG_V = VFLAG_ADD_8(src, dst, res);
    FLAG_X = FLAG_C = CFLAG_8(res);
@@ -2307,6 +1995,8 @@ void m68k_op_addx_16_mm(void)
    uint dst = m68ki_read_16(ea);
    uint res = src + dst + XFLAG_AS_1();
 
+   m68ki_resolve_flags();
+
    FLAG_N = NFLAG_16(res);
    FLAG_V = VFLAG_ADD_16(src, dst, res);
    FLAG_X = FLAG_C = CFLAG_16(res);
@@ -2325,6 +2015,8 @@ void m68k_op_addx_32_mm(void)
    uint dst = m68ki_read_32(ea);
    uint res = src + dst + XFLAG_AS_1();
 
+   m68ki_resolve_flags();
+
    FLAG_N = NFLAG_32(res);
    FLAG_V = VFLAG_ADD_32(src, dst, res);
    FLAG_X = FLAG_C = CFLAG_ADD_32(src, dst, res);
@@ -2338,6 +2030,7 @@ void m68k_op_addx_32_mm(void)
 
 void m68k_op_and_8_er_d(void)
 {
+   m68ki_discard_lazy_flags();
    FLAG_Z = MASK_OUT_ABOVE_8(DX &= (DY | 0xffffff00));
 
    FLAG_N = NFLAG_8(FLAG_Z);
@@ -2348,6 +2041,7 @@ void m68k_op_and_8_er_d(void)
 
 void m68k_op_and_8_er_ai(void)
 {
+   m68ki_discard_lazy_flags();
    FLAG_Z = MASK_OUT_ABOVE_8(DX &= (OPER_AY_AI_8() | 0xffffff00));
 
    FLAG_N = NFLAG_8(FLAG_Z);
@@ -2358,6 +2052,7 @@ void m68k_op_and_8_er_ai(void)
 
 void m68k_op_and_8_er_pi(void)
 {
+   m68ki_discard_lazy_flags();
    FLAG_Z = MASK_OUT_ABOVE_8(DX &= (OPER_AY_PI_8() | 0xffffff00));
 
    FLAG_N = NFLAG_8(FLAG_Z);
@@ -2368,6 +2063,7 @@ void m68k_op_and_8_er_pi(void)
 
 void m68k_op_and_8_er_pi7(void)
 {
+   m68ki_discard_lazy_flags();
    FLAG_Z = MASK_OUT_ABOVE_8(DX &= (OPER_A7_PI_8() | 0xffffff00));
 
    FLAG_N = NFLAG_8(FLAG_Z);
@@ -2378,6 +2074,7 @@ void m68k_op_and_8_er_pi7(void)
 
 void m68k_op_and_8_er_pd(void)
 {
+   m68ki_discard_lazy_flags();
    FLAG_Z = MASK_OUT_ABOVE_8(DX &= (OPER_AY_PD_8() | 0xffffff00));
 
    FLAG_N = NFLAG_8(FLAG_Z);
@@ -2388,6 +2085,7 @@ void m68k_op_and_8_er_pd(void)
 
 void m68k_op_and_8_er_pd7(void)
 {
+   m68ki_discard_lazy_flags();
    FLAG_Z = MASK_OUT_ABOVE_8(DX &= (OPER_A7_PD_8() | 0xffffff00));
 
    FLAG_N = NFLAG_8(FLAG_Z);
@@ -2398,6 +2096,7 @@ void m68k_op_and_8_er_pd7(void)
 
 void m68k_op_and_8_er_di(void)
 {
+   m68ki_discard_lazy_flags();
    FLAG_Z = MASK_OUT_ABOVE_8(DX &= (OPER_AY_DI_8() | 0xffffff00));
 
    FLAG_N = NFLAG_8(FLAG_Z);
@@ -2408,6 +2107,7 @@ void m68k_op_and_8_er_di(void)
 
 void m68k_op_and_8_er_ix(void)
 {
+   m68ki_discard_lazy_flags();
    FLAG_Z = MASK_OUT_ABOVE_8(DX &= (OPER_AY_IX_8() | 0xffffff00));
 
    FLAG_N = NFLAG_8(FLAG_Z);
@@ -2418,6 +2118,7 @@ void m68k_op_and_8_er_ix(void)
 
 void m68k_op_and_8_er_aw(void)
 {
+   m68ki_discard_lazy_flags();
    FLAG_Z = MASK_OUT_ABOVE_8(DX &= (OPER_AW_8() | 0xffffff00));
 
    FLAG_N = NFLAG_8(FLAG_Z);
@@ -2428,6 +2129,7 @@ void m68k_op_and_8_er_aw(void)
 
 void m68k_op_and_8_er_al(void)
 {
+   m68ki_discard_lazy_flags();
    FLAG_Z = MASK_OUT_ABOVE_8(DX &= (OPER_AL_8() | 0xffffff00));
 
    FLAG_N = NFLAG_8(FLAG_Z);
@@ -2438,6 +2140,7 @@ void m68k_op_and_8_er_al(void)
 
 void m68k_op_and_8_er_pcdi(void)
 {
+   m68ki_discard_lazy_flags();
    FLAG_Z = MASK_OUT_ABOVE_8(DX &= (OPER_PCDI_8() | 0xffffff00));
 
    FLAG_N = NFLAG_8(FLAG_Z);
@@ -2448,6 +2151,7 @@ void m68k_op_and_8_er_pcdi(void)
 
 void m68k_op_and_8_er_pcix(void)
 {
+   m68ki_discard_lazy_flags();
    FLAG_Z = MASK_OUT_ABOVE_8(DX &= (OPER_PCIX_8() | 0xffffff00));
 
    FLAG_N = NFLAG_8(FLAG_Z);
@@ -2458,6 +2162,7 @@ void m68k_op_and_8_er_pcix(void)
 
 void m68k_op_and_8_er_i(void)
 {
+   m68ki_discard_lazy_flags();
    FLAG_Z = MASK_OUT_ABOVE_8(DX &= (OPER_I_8() | 0xffffff00));
 
    FLAG_N = NFLAG_8(FLAG_Z);
@@ -2468,6 +2173,7 @@ void m68k_op_and_8_er_i(void)
 
 void m68k_op_and_16_er_d(void)
 {
+   m68ki_discard_lazy_flags();
    FLAG_Z = MASK_OUT_ABOVE_16(DX &= (DY | 0xffff0000));
 
    FLAG_N = NFLAG_16(FLAG_Z);
@@ -2478,6 +2184,7 @@ void m68k_op_and_16_er_d(void)
 
 void m68k_op_and_16_er_ai(void)
 {
+   m68ki_discard_lazy_flags();
    FLAG_Z = MASK_OUT_ABOVE_16(DX &= (OPER_AY_AI_16() | 0xffff0000));
 
    FLAG_N = NFLAG_16(FLAG_Z);
@@ -2488,6 +2195,7 @@ void m68k_op_and_16_er_ai(void)
 
 void m68k_op_and_16_er_pi(void)
 {
+   m68ki_discard_lazy_flags();
    FLAG_Z = MASK_OUT_ABOVE_16(DX &= (OPER_AY_PI_16() | 0xffff0000));
 
    FLAG_N = NFLAG_16(FLAG_Z);
@@ -2498,6 +2206,7 @@ void m68k_op_and_16_er_pi(void)
 
 void m68k_op_and_16_er_pd(void)
 {
+   m68ki_discard_lazy_flags();
    FLAG_Z = MASK_OUT_ABOVE_16(DX &= (OPER_AY_PD_16() | 0xffff0000));
 
    FLAG_N = NFLAG_16(FLAG_Z);
@@ -2508,6 +2217,7 @@ void m68k_op_and_16_er_pd(void)
 
 void m68k_op_and_16_er_di(void)
 {
+   m68ki_discard_lazy_flags();
    FLAG_Z = MASK_OUT_ABOVE_16(DX &= (OPER_AY_DI_16() | 0xffff0000));
 
    FLAG_N = NFLAG_16(FLAG_Z);
@@ -2518,6 +2228,7 @@ void m68k_op_and_16_er_di(void)
 
 void m68k_op_and_16_er_ix(void)
 {
+   m68ki_discard_lazy_flags();
    FLAG_Z = MASK_OUT_ABOVE_16(DX &= (OPER_AY_IX_16() | 0xffff0000));
 
    FLAG_N = NFLAG_16(FLAG_Z);
@@ -2528,6 +2239,7 @@ void m68k_op_and_16_er_ix(void)
 
 void m68k_op_and_16_er_aw(void)
 {
+   m68ki_discard_lazy_flags();
    FLAG_Z = MASK_OUT_ABOVE_16(DX &= (OPER_AW_16() | 0xffff0000));
 
    FLAG_N = NFLAG_16(FLAG_Z);
@@ -2538,6 +2250,7 @@ void m68k_op_and_16_er_aw(void)
 
 void m68k_op_and_16_er_al(void)
 {
+   m68ki_discard_lazy_flags();
    FLAG_Z = MASK_OUT_ABOVE_16(DX &= (OPER_AL_16() | 0xffff0000));
 
    FLAG_N = NFLAG_16(FLAG_Z);
@@ -2548,6 +2261,7 @@ void m68k_op_and_16_er_al(void)
 
 void m68k_op_and_16_er_pcdi(void)
 {
+   m68ki_discard_lazy_flags();
    FLAG_Z = MASK_OUT_ABOVE_16(DX &= (OPER_PCDI_16() | 0xffff0000));
 
    FLAG_N = NFLAG_16(FLAG_Z);
@@ -2558,6 +2272,7 @@ void m68k_op_and_16_er_pcdi(void)
 
 void m68k_op_and_16_er_pcix(void)
 {
+   m68ki_discard_lazy_flags();
    FLAG_Z = MASK_OUT_ABOVE_16(DX &= (OPER_PCIX_16() | 0xffff0000));
 
    FLAG_N = NFLAG_16(FLAG_Z);
@@ -2568,6 +2283,7 @@ void m68k_op_and_16_er_pcix(void)
 
 void m68k_op_and_16_er_i(void)
 {
+   m68ki_discard_lazy_flags();
    FLAG_Z = MASK_OUT_ABOVE_16(DX &= (OPER_I_16() | 0xffff0000));
 
    FLAG_N = NFLAG_16(FLAG_Z);
@@ -2578,6 +2294,7 @@ void m68k_op_and_16_er_i(void)
 
 void m68k_op_and_32_er_d(void)
 {
+   m68ki_discard_lazy_flags();
    FLAG_Z = DX &= DY;
 
    FLAG_N = NFLAG_32(FLAG_Z);
@@ -2588,6 +2305,7 @@ void m68k_op_and_32_er_d(void)
 
 void m68k_op_and_32_er_ai(void)
 {
+   m68ki_discard_lazy_flags();
    FLAG_Z = DX &= OPER_AY_AI_32();
 
    FLAG_N = NFLAG_32(FLAG_Z);
@@ -2598,6 +2316,7 @@ void m68k_op_and_32_er_ai(void)
 
 void m68k_op_and_32_er_pi(void)
 {
+   m68ki_discard_lazy_flags();
    FLAG_Z = DX &= OPER_AY_PI_32();
 
    FLAG_N = NFLAG_32(FLAG_Z);
@@ -2608,6 +2327,7 @@ void m68k_op_and_32_er_pi(void)
 
 void m68k_op_and_32_er_pd(void)
 {
+   m68ki_discard_lazy_flags();
    FLAG_Z = DX &= OPER_AY_PD_32();
 
    FLAG_N = NFLAG_32(FLAG_Z);
@@ -2618,6 +2338,7 @@ void m68k_op_and_32_er_pd(void)
 
 void m68k_op_and_32_er_di(void)
 {
+   m68ki_discard_lazy_flags();
    FLAG_Z = DX &= OPER_AY_DI_32();
 
    FLAG_N = NFLAG_32(FLAG_Z);
@@ -2628,6 +2349,7 @@ void m68k_op_and_32_er_di(void)
 
 void m68k_op_and_32_er_ix(void)
 {
+   m68ki_discard_lazy_flags();
    FLAG_Z = DX &= OPER_AY_IX_32();
 
    FLAG_N = NFLAG_32(FLAG_Z);
@@ -2638,6 +2360,7 @@ void m68k_op_and_32_er_ix(void)
 
 void m68k_op_and_32_er_aw(void)
 {
+   m68ki_discard_lazy_flags();
    FLAG_Z = DX &= OPER_AW_32();
 
    FLAG_N = NFLAG_32(FLAG_Z);
@@ -2648,6 +2371,7 @@ void m68k_op_and_32_er_aw(void)
 
 void m68k_op_and_32_er_al(void)
 {
+   m68ki_discard_lazy_flags();
    FLAG_Z = DX &= OPER_AL_32();
 
    FLAG_N = NFLAG_32(FLAG_Z);
@@ -2658,6 +2382,7 @@ void m68k_op_and_32_er_al(void)
 
 void m68k_op_and_32_er_pcdi(void)
 {
+   m68ki_discard_lazy_flags();
    FLAG_Z = DX &= OPER_PCDI_32();
 
    FLAG_N = NFLAG_32(FLAG_Z);
@@ -2668,6 +2393,7 @@ void m68k_op_and_32_er_pcdi(void)
 
 void m68k_op_and_32_er_pcix(void)
 {
+   m68ki_discard_lazy_flags();
    FLAG_Z = DX &= OPER_PCIX_32();
 
    FLAG_N = NFLAG_32(FLAG_Z);
@@ -2678,6 +2404,7 @@ void m68k_op_and_32_er_pcix(void)
 
 void m68k_op_and_32_er_i(void)
 {
+   m68ki_discard_lazy_flags();
    FLAG_Z = DX &= OPER_I_32();
 
    FLAG_N = NFLAG_32(FLAG_Z);
@@ -2691,6 +2418,7 @@ void m68k_op_and_8_re_ai(void)
    uint ea = EA_AY_AI_8();
    uint res = DX & m68ki_read_8(ea);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_8(res);
    FLAG_C = CFLAG_CLEAR;
    FLAG_V = VFLAG_CLEAR;
@@ -2705,6 +2433,7 @@ void m68k_op_and_8_re_pi(void)
    uint ea = EA_AY_PI_8();
    uint res = DX & m68ki_read_8(ea);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_8(res);
    FLAG_C = CFLAG_CLEAR;
    FLAG_V = VFLAG_CLEAR;
@@ -2719,6 +2448,7 @@ void m68k_op_and_8_re_pi7(void)
    uint ea = EA_A7_PI_8();
    uint res = DX & m68ki_read_8(ea);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_8(res);
    FLAG_C = CFLAG_CLEAR;
    FLAG_V = VFLAG_CLEAR;
@@ -2733,6 +2463,7 @@ void m68k_op_and_8_re_pd(void)
    uint ea = EA_AY_PD_8();
    uint res = DX & m68ki_read_8(ea);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_8(res);
    FLAG_C = CFLAG_CLEAR;
    FLAG_V = VFLAG_CLEAR;
@@ -2747,6 +2478,7 @@ void m68k_op_and_8_re_pd7(void)
    uint ea = EA_A7_PD_8();
    uint res = DX & m68ki_read_8(ea);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_8(res);
    FLAG_C = CFLAG_CLEAR;
    FLAG_V = VFLAG_CLEAR;
@@ -2761,6 +2493,7 @@ void m68k_op_and_8_re_di(void)
    uint ea = EA_AY_DI_8();
    uint res = DX & m68ki_read_8(ea);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_8(res);
    FLAG_C = CFLAG_CLEAR;
    FLAG_V = VFLAG_CLEAR;
@@ -2775,6 +2508,7 @@ void m68k_op_and_8_re_ix(void)
    uint ea = EA_AY_IX_8();
    uint res = DX & m68ki_read_8(ea);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_8(res);
    FLAG_C = CFLAG_CLEAR;
    FLAG_V = VFLAG_CLEAR;
@@ -2789,6 +2523,7 @@ void m68k_op_and_8_re_aw(void)
    uint ea = EA_AW_8();
    uint res = DX & m68ki_read_8(ea);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_8(res);
    FLAG_C = CFLAG_CLEAR;
    FLAG_V = VFLAG_CLEAR;
@@ -2803,6 +2538,7 @@ void m68k_op_and_8_re_al(void)
    uint ea = EA_AL_8();
    uint res = DX & m68ki_read_8(ea);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_8(res);
    FLAG_C = CFLAG_CLEAR;
    FLAG_V = VFLAG_CLEAR;
@@ -2817,6 +2553,7 @@ void m68k_op_and_16_re_ai(void)
    uint ea = EA_AY_AI_16();
    uint res = DX & m68ki_read_16(ea);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_16(res);
    FLAG_C = CFLAG_CLEAR;
    FLAG_V = VFLAG_CLEAR;
@@ -2831,6 +2568,7 @@ void m68k_op_and_16_re_pi(void)
    uint ea = EA_AY_PI_16();
    uint res = DX & m68ki_read_16(ea);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_16(res);
    FLAG_C = CFLAG_CLEAR;
    FLAG_V = VFLAG_CLEAR;
@@ -2845,6 +2583,7 @@ void m68k_op_and_16_re_pd(void)
    uint ea = EA_AY_PD_16();
    uint res = DX & m68ki_read_16(ea);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_16(res);
    FLAG_C = CFLAG_CLEAR;
    FLAG_V = VFLAG_CLEAR;
@@ -2859,6 +2598,7 @@ void m68k_op_and_16_re_di(void)
    uint ea = EA_AY_DI_16();
    uint res = DX & m68ki_read_16(ea);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_16(res);
    FLAG_C = CFLAG_CLEAR;
    FLAG_V = VFLAG_CLEAR;
@@ -2873,6 +2613,7 @@ void m68k_op_and_16_re_ix(void)
    uint ea = EA_AY_IX_16();
    uint res = DX & m68ki_read_16(ea);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_16(res);
    FLAG_C = CFLAG_CLEAR;
    FLAG_V = VFLAG_CLEAR;
@@ -2887,6 +2628,7 @@ void m68k_op_and_16_re_aw(void)
    uint ea = EA_AW_16();
    uint res = DX & m68ki_read_16(ea);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_16(res);
    FLAG_C = CFLAG_CLEAR;
    FLAG_V = VFLAG_CLEAR;
@@ -2901,6 +2643,7 @@ void m68k_op_and_16_re_al(void)
    uint ea = EA_AL_16();
    uint res = DX & m68ki_read_16(ea);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_16(res);
    FLAG_C = CFLAG_CLEAR;
    FLAG_V = VFLAG_CLEAR;
@@ -2915,6 +2658,7 @@ void m68k_op_and_32_re_ai(void)
    uint ea = EA_AY_AI_32();
    uint res = DX & m68ki_read_32(ea);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_32(res);
    FLAG_Z = res;
    FLAG_C = CFLAG_CLEAR;
@@ -2929,6 +2673,7 @@ void m68k_op_and_32_re_pi(void)
    uint ea = EA_AY_PI_32();
    uint res = DX & m68ki_read_32(ea);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_32(res);
    FLAG_Z = res;
    FLAG_C = CFLAG_CLEAR;
@@ -2943,6 +2688,7 @@ void m68k_op_and_32_re_pd(void)
    uint ea = EA_AY_PD_32();
    uint res = DX & m68ki_read_32(ea);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_32(res);
    FLAG_Z = res;
    FLAG_C = CFLAG_CLEAR;
@@ -2957,6 +2703,7 @@ void m68k_op_and_32_re_di(void)
    uint ea = EA_AY_DI_32();
    uint res = DX & m68ki_read_32(ea);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_32(res);
    FLAG_Z = res;
    FLAG_C = CFLAG_CLEAR;
@@ -2971,6 +2718,7 @@ void m68k_op_and_32_re_ix(void)
    uint ea = EA_AY_IX_32();
    uint res = DX & m68ki_read_32(ea);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_32(res);
    FLAG_Z = res;
    FLAG_C = CFLAG_CLEAR;
@@ -2985,6 +2733,7 @@ void m68k_op_and_32_re_aw(void)
    uint ea = EA_AW_32();
    uint res = DX & m68ki_read_32(ea);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_32(res);
    FLAG_Z = res;
    FLAG_C = CFLAG_CLEAR;
@@ -2999,6 +2748,7 @@ void m68k_op_and_32_re_al(void)
    uint ea = EA_AL_32();
    uint res = DX & m68ki_read_32(ea);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_32(res);
    FLAG_Z = res;
    FLAG_C = CFLAG_CLEAR;
@@ -3010,6 +2760,7 @@ void m68k_op_and_32_re_al(void)
 
 void m68k_op_andi_8_d(void)
 {
+   m68ki_discard_lazy_flags();
    FLAG_Z = MASK_OUT_ABOVE_8(DY &= (OPER_I_8() | 0xffffff00));
 
    FLAG_N = NFLAG_8(FLAG_Z);
@@ -3024,6 +2775,7 @@ void m68k_op_andi_8_ai(void)
    uint ea = EA_AY_AI_8();
    uint res = src & m68ki_read_8(ea);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_8(res);
    FLAG_Z = res;
    FLAG_C = CFLAG_CLEAR;
@@ -3039,6 +2791,7 @@ void m68k_op_andi_8_pi(void)
    uint ea = EA_AY_PI_8();
    uint res = src & m68ki_read_8(ea);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_8(res);
    FLAG_Z = res;
    FLAG_C = CFLAG_CLEAR;
@@ -3054,6 +2807,7 @@ void m68k_op_andi_8_pi7(void)
    uint ea = EA_A7_PI_8();
    uint res = src & m68ki_read_8(ea);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_8(res);
    FLAG_Z = res;
    FLAG_C = CFLAG_CLEAR;
@@ -3069,6 +2823,7 @@ void m68k_op_andi_8_pd(void)
    uint ea = EA_AY_PD_8();
    uint res = src & m68ki_read_8(ea);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_8(res);
    FLAG_Z = res;
    FLAG_C = CFLAG_CLEAR;
@@ -3084,6 +2839,7 @@ void m68k_op_andi_8_pd7(void)
    uint ea = EA_A7_PD_8();
    uint res = src & m68ki_read_8(ea);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_8(res);
    FLAG_Z = res;
    FLAG_C = CFLAG_CLEAR;
@@ -3099,6 +2855,7 @@ void m68k_op_andi_8_di(void)
    uint ea = EA_AY_DI_8();
    uint res = src & m68ki_read_8(ea);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_8(res);
    FLAG_Z = res;
    FLAG_C = CFLAG_CLEAR;
@@ -3114,6 +2871,7 @@ void m68k_op_andi_8_ix(void)
    uint ea = EA_AY_IX_8();
    uint res = src & m68ki_read_8(ea);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_8(res);
    FLAG_Z = res;
    FLAG_C = CFLAG_CLEAR;
@@ -3129,6 +2887,7 @@ void m68k_op_andi_8_aw(void)
    uint ea = EA_AW_8();
    uint res = src & m68ki_read_8(ea);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_8(res);
    FLAG_Z = res;
    FLAG_C = CFLAG_CLEAR;
@@ -3144,6 +2903,7 @@ void m68k_op_andi_8_al(void)
    uint ea = EA_AL_8();
    uint res = src & m68ki_read_8(ea);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_8(res);
    FLAG_Z = res;
    FLAG_C = CFLAG_CLEAR;
@@ -3155,6 +2915,7 @@ void m68k_op_andi_8_al(void)
 
 void m68k_op_andi_16_d(void)
 {
+   m68ki_discard_lazy_flags();
    FLAG_Z = MASK_OUT_ABOVE_16(DY &= (OPER_I_16() | 0xffff0000));
 
    FLAG_N = NFLAG_16(FLAG_Z);
@@ -3169,6 +2930,7 @@ void m68k_op_andi_16_ai(void)
    uint ea = EA_AY_AI_16();
    uint res = src & m68ki_read_16(ea);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_16(res);
    FLAG_Z = res;
    FLAG_C = CFLAG_CLEAR;
@@ -3184,6 +2946,7 @@ void m68k_op_andi_16_pi(void)
    uint ea = EA_AY_PI_16();
    uint res = src & m68ki_read_16(ea);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_16(res);
    FLAG_Z = res;
    FLAG_C = CFLAG_CLEAR;
@@ -3199,6 +2962,7 @@ void m68k_op_andi_16_pd(void)
    uint ea = EA_AY_PD_16();
    uint res = src & m68ki_read_16(ea);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_16(res);
    FLAG_Z = res;
    FLAG_C = CFLAG_CLEAR;
@@ -3214,6 +2978,7 @@ void m68k_op_andi_16_di(void)
    uint ea = EA_AY_DI_16();
    uint res = src & m68ki_read_16(ea);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_16(res);
    FLAG_Z = res;
    FLAG_C = CFLAG_CLEAR;
@@ -3229,6 +2994,7 @@ void m68k_op_andi_16_ix(void)
    uint ea = EA_AY_IX_16();
    uint res = src & m68ki_read_16(ea);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_16(res);
    FLAG_Z = res;
    FLAG_C = CFLAG_CLEAR;
@@ -3244,6 +3010,7 @@ void m68k_op_andi_16_aw(void)
    uint ea = EA_AW_16();
    uint res = src & m68ki_read_16(ea);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_16(res);
    FLAG_Z = res;
    FLAG_C = CFLAG_CLEAR;
@@ -3259,6 +3026,7 @@ void m68k_op_andi_16_al(void)
    uint ea = EA_AL_16();
    uint res = src & m68ki_read_16(ea);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_16(res);
    FLAG_Z = res;
    FLAG_C = CFLAG_CLEAR;
@@ -3270,6 +3038,7 @@ void m68k_op_andi_16_al(void)
 
 void m68k_op_andi_32_d(void)
 {
+   m68ki_discard_lazy_flags();
    FLAG_Z = DY &= (OPER_I_32());
 
    FLAG_N = NFLAG_32(FLAG_Z);
@@ -3284,6 +3053,7 @@ void m68k_op_andi_32_ai(void)
    uint ea = EA_AY_AI_32();
    uint res = src & m68ki_read_32(ea);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_32(res);
    FLAG_Z = res;
    FLAG_C = CFLAG_CLEAR;
@@ -3299,6 +3069,7 @@ void m68k_op_andi_32_pi(void)
    uint ea = EA_AY_PI_32();
    uint res = src & m68ki_read_32(ea);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_32(res);
    FLAG_Z = res;
    FLAG_C = CFLAG_CLEAR;
@@ -3314,6 +3085,7 @@ void m68k_op_andi_32_pd(void)
    uint ea = EA_AY_PD_32();
    uint res = src & m68ki_read_32(ea);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_32(res);
    FLAG_Z = res;
    FLAG_C = CFLAG_CLEAR;
@@ -3329,6 +3101,7 @@ void m68k_op_andi_32_di(void)
    uint ea = EA_AY_DI_32();
    uint res = src & m68ki_read_32(ea);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_32(res);
    FLAG_Z = res;
    FLAG_C = CFLAG_CLEAR;
@@ -3344,6 +3117,7 @@ void m68k_op_andi_32_ix(void)
    uint ea = EA_AY_IX_32();
    uint res = src & m68ki_read_32(ea);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_32(res);
    FLAG_Z = res;
    FLAG_C = CFLAG_CLEAR;
@@ -3359,6 +3133,7 @@ void m68k_op_andi_32_aw(void)
    uint ea = EA_AW_32();
    uint res = src & m68ki_read_32(ea);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_32(res);
    FLAG_Z = res;
    FLAG_C = CFLAG_CLEAR;
@@ -3374,6 +3149,7 @@ void m68k_op_andi_32_al(void)
    uint ea = EA_AL_32();
    uint res = src & m68ki_read_32(ea);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_32(res);
    FLAG_Z = res;
    FLAG_C = CFLAG_CLEAR;
@@ -3414,6 +3190,7 @@ void m68k_op_asr_8_s(void)
 
    *r_dst = MASK_OUT_BELOW_8(*r_dst) | res;
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_8(res);
    FLAG_Z = res;
    FLAG_V = VFLAG_CLEAR;
@@ -3433,6 +3210,7 @@ void m68k_op_asr_16_s(void)
 
    *r_dst = MASK_OUT_BELOW_16(*r_dst) | res;
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_16(res);
    FLAG_Z = res;
    FLAG_V = VFLAG_CLEAR;
@@ -3452,6 +3230,7 @@ void m68k_op_asr_32_s(void)
 
    *r_dst = res;
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_32(res);
    FLAG_Z = res;
    FLAG_V = VFLAG_CLEAR;
@@ -3466,6 +3245,8 @@ void m68k_op_asr_8_r(void)
    uint src = MASK_OUT_ABOVE_8(*r_dst);
    uint res = src >> shift;
 
+   m68ki_resolve_flags();
+
    if(shift != 0)
    {
       USE_CYCLES(shift<<CYC_SHIFT);
@@ -3518,6 +3299,8 @@ void m68k_op_asr_16_r(void)
    uint src = MASK_OUT_ABOVE_16(*r_dst);
    uint res = src >> shift;
 
+   m68ki_resolve_flags();
+
    if(shift != 0)
    {
       USE_CYCLES(shift<<CYC_SHIFT);
@@ -3570,6 +3353,8 @@ void m68k_op_asr_32_r(void)
    uint src = *r_dst;
    uint res = src >> shift;
 
+   m68ki_resolve_flags();
+
    if(shift != 0)
    {
       USE_CYCLES(shift<<CYC_SHIFT);
@@ -3626,6 +3411,7 @@ void m68k_op_asr_16_ai(void)
 
    m68ki_write_16(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_16(res);
    FLAG_Z = res;
    FLAG_V = VFLAG_CLEAR;
@@ -3644,6 +3430,7 @@ void m68k_op_asr_16_pi(void)
 
    m68ki_write_16(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_16(res);
    FLAG_Z = res;
    FLAG_V = VFLAG_CLEAR;
@@ -3662,6 +3449,7 @@ void m68k_op_asr_16_pd(void)
 
    m68ki_write_16(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_16(res);
    FLAG_Z = res;
    FLAG_V = VFLAG_CLEAR;
@@ -3680,6 +3468,7 @@ void m68k_op_asr_16_di(void)
 
    m68ki_write_16(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_16(res);
    FLAG_Z = res;
    FLAG_V = VFLAG_CLEAR;
@@ -3698,6 +3487,7 @@ void m68k_op_asr_16_ix(void)
 
    m68ki_write_16(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_16(res);
    FLAG_Z = res;
    FLAG_V = VFLAG_CLEAR;
@@ -3716,6 +3506,7 @@ void m68k_op_asr_16_aw(void)
 
    m68ki_write_16(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_16(res);
    FLAG_Z = res;
    FLAG_V = VFLAG_CLEAR;
@@ -3734,6 +3525,7 @@ void m68k_op_asr_16_al(void)
 
    m68ki_write_16(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_16(res);
    FLAG_Z = res;
    FLAG_V = VFLAG_CLEAR;
@@ -3748,6 +3540,8 @@ void m68k_op_asl_8_s(void)
    uint src = MASK_OUT_ABOVE_8(*r_dst);
    uint res = MASK_OUT_ABOVE_8(src << shift);
 
+   m68ki_resolve_flags();
+
    *r_dst = MASK_OUT_BELOW_8(*r_dst) | res;
 
    FLAG_X = FLAG_C = src << shift;
@@ -3765,6 +3559,8 @@ void m68k_op_asl_16_s(void)
    uint src = MASK_OUT_ABOVE_16(*r_dst);
    uint res = MASK_OUT_ABOVE_16(src << shift);
 
+   m68ki_resolve_flags();
+
    *r_dst = MASK_OUT_BELOW_16(*r_dst) | res;
 
    FLAG_N = NFLAG_16(res);
@@ -3782,6 +3578,8 @@ void m68k_op_asl_32_s(void)
    uint src = *r_dst;
    uint res = MASK_OUT_ABOVE_32(src << shift);
 
+   m68ki_resolve_flags();
+
    *r_dst = res;
 
    FLAG_N = NFLAG_32(res);
@@ -3799,6 +3597,8 @@ void m68k_op_asl_8_r(void)
    uint src = MASK_OUT_ABOVE_8(*r_dst);
    uint res = MASK_OUT_ABOVE_8(src << shift);
 
+   m68ki_resolve_flags();
+
    if(shift != 0)
    {
       USE_CYCLES(shift<<CYC_SHIFT);
@@ -3836,6 +3636,8 @@ void m68k_op_asl_16_r(void)
    uint src = MASK_OUT_ABOVE_16(*r_dst);
    uint res = MASK_OUT_ABOVE_16(src << shift);
 
+   m68ki_resolve_flags();
+
    if(shift != 0)
    {
       USE_CYCLES(shift<<CYC_SHIFT);
@@ -3873,6 +3675,8 @@ void m68k_op_asl_32_r(void)
    uint src = *r_dst;
    uint res = MASK_OUT_ABOVE_32(src << shift);
 
+   m68ki_resolve_flags();
+
    if(shift != 0)
    {
       USE_CYCLES(shift<<CYC_SHIFT);
@@ -3909,6 +3713,8 @@ void m68k_op_asl_16_ai(void)
    uint src = m68ki_read_16(ea);
    uint res = MASK_OUT_ABOVE_16(src << 1);
 
+   m68ki_resolve_flags();
+
    m68ki_write_16(ea, res);
 
    FLAG_N = NFLAG_16(res);
@@ -3925,6 +3731,8 @@ void m68k_op_asl_16_pi(void)
    uint src = m68ki_read_16(ea);
    uint res = MASK_OUT_ABOVE_16(src << 1);
 
+   m68ki_resolve_flags();
+
    m68ki_write_16(ea, res);
 
    FLAG_N = NFLAG_16(res);
@@ -3941,6 +3749,8 @@ void m68k_op_asl_16_pd(void)
    uint src = m68ki_read_16(ea);
    uint res = MASK_OUT_ABOVE_16(src << 1);
 
+   m68ki_resolve_flags();
+
    m68ki_write_16(ea, res);
 
    FLAG_N = NFLAG_16(res);
@@ -3957,6 +3767,8 @@ void m68k_op_asl_16_di(void)
    uint src = m68ki_read_16(ea);
    uint res = MASK_OUT_ABOVE_16(src << 1);
 
+   m68ki_resolve_flags();
+
    m68ki_write_16(ea, res);
 
    FLAG_N = NFLAG_16(res);
@@ -3973,6 +3785,8 @@ void m68k_op_asl_16_ix(void)
    uint src = m68ki_read_16(ea);
    uint res = MASK_OUT_ABOVE_16(src << 1);
 
+   m68ki_resolve_flags();
+
    m68ki_write_16(ea, res);
 
    FLAG_N = NFLAG_16(res);
@@ -3989,6 +3803,8 @@ void m68k_op_asl_16_aw(void)
    uint src = m68ki_read_16(ea);
    uint res = MASK_OUT_ABOVE_16(src << 1);
 
+   m68ki_resolve_flags();
+
    m68ki_write_16(ea, res);
 
    FLAG_N = NFLAG_16(res);
@@ -4005,6 +3821,8 @@ void m68k_op_asl_16_al(void)
    uint src = m68ki_read_16(ea);
    uint res = MASK_OUT_ABOVE_16(src << 1);
 
+   m68ki_resolve_flags();
+
    m68ki_write_16(ea, res);
 
    FLAG_N = NFLAG_16(res);
@@ -4017,6 +3835,7 @@ void m68k_op_asl_16_al(void)
 
 void m68k_op_bhi_8(void)
 {
+   m68ki_resolve_flags();
    if(COND_HI())
    {
       m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
@@ -4029,6 +3848,7 @@ void m68k_op_bhi_8(void)
 
 void m68k_op_bls_8(void)
 {
+   m68ki_resolve_flags();
    if(COND_LS())
    {
       m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
@@ -4041,6 +3861,7 @@ void m68k_op_bls_8(void)
 
 void m68k_op_bcc_8(void)
 {
+   m68ki_resolve_flags();
    if(COND_CC())
    {
       m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
@@ -4053,6 +3874,7 @@ void m68k_op_bcc_8(void)
 
 void m68k_op_bcs_8(void)
 {
+   m68ki_resolve_flags();
    if(COND_CS())
    {
       m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
@@ -4065,6 +3887,7 @@ void m68k_op_bcs_8(void)
 
 void m68k_op_bne_8(void)
 {
+   m68ki_resolve_flags();
    if(COND_NE())
    {
       m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
@@ -4077,6 +3900,7 @@ void m68k_op_bne_8(void)
 
 void m68k_op_beq_8(void)
 {
+   m68ki_resolve_flags();
    if(COND_EQ())
    {
       m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
@@ -4089,6 +3913,7 @@ void m68k_op_beq_8(void)
 
 void m68k_op_bvc_8(void)
 {
+   m68ki_resolve_flags();
    if(COND_VC())
    {
       m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
@@ -4101,6 +3926,7 @@ void m68k_op_bvc_8(void)
 
 void m68k_op_bvs_8(void)
 {
+   m68ki_resolve_flags();
    if(COND_VS())
    {
       m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
@@ -4113,6 +3939,7 @@ void m68k_op_bvs_8(void)
 
 void m68k_op_bpl_8(void)
 {
+   m68ki_resolve_flags();
    if(COND_PL())
    {
       m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
@@ -4125,6 +3952,7 @@ void m68k_op_bpl_8(void)
 
 void m68k_op_bmi_8(void)
 {
+   m68ki_resolve_flags();
    if(COND_MI())
    {
       m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
@@ -4137,6 +3965,7 @@ void m68k_op_bmi_8(void)
 
 void m68k_op_bge_8(void)
 {
+   m68ki_resolve_flags();
    if(COND_GE())
    {
       m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
@@ -4149,6 +3978,7 @@ void m68k_op_bge_8(void)
 
 void m68k_op_blt_8(void)
 {
+   m68ki_resolve_flags();
    if(COND_LT())
    {
       m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
@@ -4161,6 +3991,7 @@ void m68k_op_blt_8(void)
 
 void m68k_op_bgt_8(void)
 {
+   m68ki_resolve_flags();
    if(COND_GT())
    {
       m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
@@ -4173,6 +4004,7 @@ void m68k_op_bgt_8(void)
 
 void m68k_op_ble_8(void)
 {
+   m68ki_resolve_flags();
    if(COND_LE())
    {
       m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
@@ -4185,6 +4017,7 @@ void m68k_op_ble_8(void)
 
 void m68k_op_bhi_16(void)
 {
+   m68ki_resolve_flags();
    if(COND_HI())
    {
       uint offset = OPER_I_16();
@@ -4200,6 +4033,7 @@ void m68k_op_bhi_16(void)
 
 void m68k_op_bls_16(void)
 {
+   m68ki_resolve_flags();
    if(COND_LS())
    {
       uint offset = OPER_I_16();
@@ -4215,6 +4049,7 @@ void m68k_op_bls_16(void)
 
 void m68k_op_bcc_16(void)
 {
+   m68ki_resolve_flags();
    if(COND_CC())
    {
       uint offset = OPER_I_16();
@@ -4230,6 +4065,7 @@ void m68k_op_bcc_16(void)
 
 void m68k_op_bcs_16(void)
 {
+   m68ki_resolve_flags();
    if(COND_CS())
    {
       uint offset = OPER_I_16();
@@ -4245,6 +4081,7 @@ void m68k_op_bcs_16(void)
 
 void m68k_op_bne_16(void)
 {
+   m68ki_resolve_flags();
    if(COND_NE())
    {
       uint offset = OPER_I_16();
@@ -4260,6 +4097,7 @@ void m68k_op_bne_16(void)
 
 void m68k_op_beq_16(void)
 {
+   m68ki_resolve_flags();
    if(COND_EQ())
    {
       uint offset = OPER_I_16();
@@ -4275,6 +4113,7 @@ void m68k_op_beq_16(void)
 
 void m68k_op_bvc_16(void)
 {
+   m68ki_resolve_flags();
    if(COND_VC())
    {
       uint offset = OPER_I_16();
@@ -4290,6 +4129,7 @@ void m68k_op_bvc_16(void)
 
 void m68k_op_bvs_16(void)
 {
+   m68ki_resolve_flags();
    if(COND_VS())
    {
       uint offset = OPER_I_16();
@@ -4305,6 +4145,7 @@ void m68k_op_bvs_16(void)
 
 void m68k_op_bpl_16(void)
 {
+   m68ki_resolve_flags();
    if(COND_PL())
    {
       uint offset = OPER_I_16();
@@ -4320,6 +4161,7 @@ void m68k_op_bpl_16(void)
 
 void m68k_op_bmi_16(void)
 {
+   m68ki_resolve_flags();
    if(COND_MI())
    {
       uint offset = OPER_I_16();
@@ -4335,6 +4177,7 @@ void m68k_op_bmi_16(void)
 
 void m68k_op_bge_16(void)
 {
+   m68ki_resolve_flags();
    if(COND_GE())
    {
       uint offset = OPER_I_16();
@@ -4350,6 +4193,7 @@ void m68k_op_bge_16(void)
 
 void m68k_op_blt_16(void)
 {
+   m68ki_resolve_flags();
    if(COND_LT())
    {
       uint offset = OPER_I_16();
@@ -4365,6 +4209,7 @@ void m68k_op_blt_16(void)
 
 void m68k_op_bgt_16(void)
 {
+   m68ki_resolve_flags();
    if(COND_GT())
    {
       uint offset = OPER_I_16();
@@ -4380,6 +4225,7 @@ void m68k_op_bgt_16(void)
 
 void m68k_op_ble_16(void)
 {
+   m68ki_resolve_flags();
    if(COND_LE())
    {
       uint offset = OPER_I_16();
@@ -4395,6 +4241,7 @@ void m68k_op_ble_16(void)
 
 void m68k_op_bhi_32(void)
 {
+   m68ki_resolve_flags();
    if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
    {
       if(COND_HI())
@@ -4414,6 +4261,7 @@ void m68k_op_bhi_32(void)
 
 void m68k_op_bls_32(void)
 {
+   m68ki_resolve_flags();
    if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
    {
       if(COND_LS())
@@ -4433,6 +4281,7 @@ void m68k_op_bls_32(void)
 
 void m68k_op_bcc_32(void)
 {
+   m68ki_resolve_flags();
    if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
    {
       if(COND_CC())
@@ -4452,6 +4301,7 @@ void m68k_op_bcc_32(void)
 
 void m68k_op_bcs_32(void)
 {
+   m68ki_resolve_flags();
    if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
    {
       if(COND_CS())
@@ -4471,6 +4321,7 @@ void m68k_op_bcs_32(void)
 
 void m68k_op_bne_32(void)
 {
+   m68ki_resolve_flags();
    if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
    {
       if(COND_NE())
@@ -4490,6 +4341,7 @@ void m68k_op_bne_32(void)
 
 void m68k_op_beq_32(void)
 {
+   m68ki_resolve_flags();
    if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
    {
       if(COND_EQ())
@@ -4509,6 +4361,7 @@ void m68k_op_beq_32(void)
 
 void m68k_op_bvc_32(void)
 {
+   m68ki_resolve_flags();
    if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
    {
       if(COND_VC())
@@ -4528,6 +4381,7 @@ void m68k_op_bvc_32(void)
 
 void m68k_op_bvs_32(void)
 {
+   m68ki_resolve_flags();
    if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
    {
       if(COND_VS())
@@ -4547,6 +4401,7 @@ void m68k_op_bvs_32(void)
 
 void m68k_op_bpl_32(void)
 {
+   m68ki_resolve_flags();
    if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
    {
       if(COND_PL())
@@ -4566,6 +4421,7 @@ void m68k_op_bpl_32(void)
 
 void m68k_op_bmi_32(void)
 {
+   m68ki_resolve_flags();
    if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
    {
       if(COND_MI())
@@ -4585,6 +4441,7 @@ void m68k_op_bmi_32(void)
 
 void m68k_op_bge_32(void)
 {
+   m68ki_resolve_flags();
    if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
    {
       if(COND_GE())
@@ -4604,6 +4461,7 @@ void m68k_op_bge_32(void)
 
 void m68k_op_blt_32(void)
 {
+   m68ki_resolve_flags();
    if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
    {
       if(COND_LT())
@@ -4623,6 +4481,7 @@ void m68k_op_blt_32(void)
 
 void m68k_op_bgt_32(void)
 {
+   m68ki_resolve_flags();
    if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
    {
       if(COND_GT())
@@ -4642,6 +4501,7 @@ void m68k_op_bgt_32(void)
 
 void m68k_op_ble_32(void)
 {
+   m68ki_resolve_flags();
    if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
    {
       if(COND_LE())
@@ -4664,6 +4524,8 @@ void m68k_op_bchg_32_r_d(void)
    uint* r_dst = &DY;
    uint mask = 1 << (DX & 0x1f);
 
+   m68ki_resolve_flags();
+
    FLAG_Z = *r_dst & mask;
    *r_dst ^= mask;
 }
@@ -4675,6 +4537,8 @@ void m68k_op_bchg_8_r_ai(void)
    uint src = m68ki_read_8(ea);
    uint mask = 1 << (DX & 7);
 
+   m68ki_resolve_flags();
+
    FLAG_Z = src & mask;
    m68ki_write_8(ea, src ^ mask);
 }
@@ -4686,6 +4550,8 @@ void m68k_op_bchg_8_r_pi(void)
    uint src = m68ki_read_8(ea);
    uint mask = 1 << (DX & 7);
 
+   m68ki_resolve_flags();
+
    FLAG_Z = src & mask;
    m68ki_write_8(ea, src ^ mask);
 }
@@ -4697,6 +4563,8 @@ void m68k_op_bchg_8_r_pi7(void)
    uint src = m68ki_read_8(ea);
    uint mask = 1 << (DX & 7);
 
+   m68ki_resolve_flags();
+
    FLAG_Z = src & mask;
    m68ki_write_8(ea, src ^ mask);
 }
@@ -4708,6 +4576,8 @@ void m68k_op_bchg_8_r_pd(void)
    uint src = m68ki_read_8(ea);
    uint mask = 1 << (DX & 7);
 
+   m68ki_resolve_flags();
+
    FLAG_Z = src & mask;
    m68ki_write_8(ea, src ^ mask);
 }
@@ -4719,6 +4589,8 @@ void m68k_op_bchg_8_r_pd7(void)
    uint src = m68ki_read_8(ea);
    uint mask = 1 << (DX & 7);
 
+   m68ki_resolve_flags();
+
    FLAG_Z = src & mask;
    m68ki_write_8(ea, src ^ mask);
 }
@@ -4730,6 +4602,8 @@ void m68k_op_bchg_8_r_di(void)
    uint src = m68ki_read_8(ea);
    uint mask = 1 << (DX & 7);
 
+   m68ki_resolve_flags();
+
    FLAG_Z = src & mask;
    m68ki_write_8(ea, src ^ mask);
 }
@@ -4741,6 +4615,8 @@ void m68k_op_bchg_8_r_ix(void)
    uint src = m68ki_read_8(ea);
    uint mask = 1 << (DX & 7);
 
+   m68ki_resolve_flags();
+
    FLAG_Z = src & mask;
    m68ki_write_8(ea, src ^ mask);
 }
@@ -4752,6 +4628,8 @@ void m68k_op_bchg_8_r_aw(void)
    uint src = m68ki_read_8(ea);
    uint mask = 1 << (DX & 7);
 
+   m68ki_resolve_flags();
+
    FLAG_Z = src & mask;
    m68ki_write_8(ea, src ^ mask);
 }
@@ -4763,6 +4641,8 @@ void m68k_op_bchg_8_r_al(void)
    uint src = m68ki_read_8(ea);
    uint mask = 1 << (DX & 7);
 
+   m68ki_resolve_flags();
+
    FLAG_Z = src & mask;
    m68ki_write_8(ea, src ^ mask);
 }
@@ -4773,6 +4653,8 @@ void m68k_op_bchg_32_s_d(void)
    uint* r_dst = &DY;
    uint mask = 1 << (OPER_I_8() & 0x1f);
 
+   m68ki_resolve_flags();
+
    FLAG_Z = *r_dst & mask;
    *r_dst ^= mask;
 }
@@ -4784,6 +4666,8 @@ void m68k_op_bchg_8_s_ai(void)
    uint ea = EA_AY_AI_8();
    uint src = m68ki_read_8(ea);
 
+   m68ki_resolve_flags();
+
    FLAG_Z = src & mask;
    m68ki_write_8(ea, src ^ mask);
 }
@@ -4795,6 +4679,8 @@ void m68k_op_bchg_8_s_pi(void)
    uint ea = EA_AY_PI_8();
    uint src = m68ki_read_8(ea);
 
+   m68ki_resolve_flags();
+
    FLAG_Z = src & mask;
    m68ki_write_8(ea, src ^ mask);
 }
@@ -4806,6 +4692,8 @@ void m68k_op_bchg_8_s_pi7(void)
    uint ea = EA_A7_PI_8();
    uint src = m68ki_read_8(ea);
 
+   m68ki_resolve_flags();
+
    FLAG_Z = src & mask;
    m68ki_write_8(ea, src ^ mask);
 }
@@ -4817,6 +4705,8 @@ void m68k_op_bchg_8_s_pd(void)
    uint ea = EA_AY_PD_8();
    uint src = m68ki_read_8(ea);
 
+   m68ki_resolve_flags();
+
    FLAG_Z = src & mask;
    m68ki_write_8(ea, src ^ mask);
 }
@@ -4828,6 +4718,8 @@ void m68k_op_bchg_8_s_pd7(void)
    uint ea = EA_A7_PD_8();
    uint src = m68ki_read_8(ea);
 
+   m68ki_resolve_flags();
+
    FLAG_Z = src & mask;
    m68ki_write_8(ea, src ^ mask);
 }
@@ -4839,6 +4731,8 @@ void m68k_op_bchg_8_s_di(void)
    uint ea = EA_AY_DI_8();
    uint src = m68ki_read_8(ea);
 
+   m68ki_resolve_flags();
+
    FLAG_Z = src & mask;
    m68ki_write_8(ea, src ^ mask);
 }
@@ -4850,6 +4744,8 @@ void m68k_op_bchg_8_s_ix(void)
    uint ea = EA_AY_IX_8();
    uint src = m68ki_read_8(ea);
 
+   m68ki_resolve_flags();
+
    FLAG_Z = src & mask;
    m68ki_write_8(ea, src ^ mask);
 }
@@ -4861,6 +4757,8 @@ void m68k_op_bchg_8_s_aw(void)
    uint ea = EA_AW_8();
    uint src = m68ki_read_8(ea);
 
+   m68ki_resolve_flags();
+
    FLAG_Z = src & mask;
    m68ki_write_8(ea, src ^ mask);
 }
@@ -4872,6 +4770,8 @@ void m68k_op_bchg_8_s_al(void)
    uint ea = EA_AL_8();
    uint src = m68ki_read_8(ea);
 
+   m68ki_resolve_flags();
+
    FLAG_Z = src & mask;
    m68ki_write_8(ea, src ^ mask);
 }
@@ -4882,6 +4782,8 @@ void m68k_op_bclr_32_r_d(void)
    uint* r_dst = &DY;
    uint mask = 1 << (DX & 0x1f);
 
+   m68ki_resolve_flags();
+
    FLAG_Z = *r_dst & mask;
    *r_dst &= ~mask;
 }
@@ -4893,6 +4795,8 @@ void m68k_op_bclr_8_r_ai(void)
    uint src = m68ki_read_8(ea);
    uint mask = 1 << (DX & 7);
 
+   m68ki_resolve_flags();
+
    FLAG_Z = src & mask;
    m68ki_write_8(ea, src & ~mask);
 }
@@ -4904,6 +4808,8 @@ void m68k_op_bclr_8_r_pi(void)
    uint src = m68ki_read_8(ea);
    uint mask = 1 << (DX & 7);
 
+   m68ki_resolve_flags();
+
    FLAG_Z = src & mask;
    m68ki_write_8(ea, src & ~mask);
 }
@@ -4915,6 +4821,8 @@ void m68k_op_bclr_8_r_pi7(void)
    uint src = m68ki_read_8(ea);
    uint mask = 1 << (DX & 7);
 
+   m68ki_resolve_flags();
+
    FLAG_Z = src & mask;
    m68ki_write_8(ea, src & ~mask);
 }
@@ -4926,6 +4834,8 @@ void m68k_op_bclr_8_r_pd(void)
    uint src = m68ki_read_8(ea);
    uint mask = 1 << (DX & 7);
 
+   m68ki_resolve_flags();
+
    FLAG_Z = src & mask;
    m68ki_write_8(ea, src & ~mask);
 }
@@ -4937,6 +4847,8 @@ void m68k_op_bclr_8_r_pd7(void)
    uint src = m68ki_read_8(ea);
    uint mask = 1 << (DX & 7);
 
+   m68ki_resolve_flags();
+
    FLAG_Z = src & mask;
    m68ki_write_8(ea, src & ~mask);
 }
@@ -4948,6 +4860,8 @@ void m68k_op_bclr_8_r_di(void)
    uint src = m68ki_read_8(ea);
    uint mask = 1 << (DX & 7);
 
+   m68ki_resolve_flags();
+
    FLAG_Z = src & mask;
    m68ki_write_8(ea, src & ~mask);
 }
@@ -4959,6 +4873,8 @@ void m68k_op_bclr_8_r_ix(void)
    uint src = m68ki_read_8(ea);
    uint mask = 1 << (DX & 7);
 
+   m68ki_resolve_flags();
+
    FLAG_Z = src & mask;
    m68ki_write_8(ea, src & ~mask);
 }
@@ -4970,6 +4886,8 @@ void m68k_op_bclr_8_r_aw(void)
    uint src = m68ki_read_8(ea);
    uint mask = 1 << (DX & 7);
 
+   m68ki_resolve_flags();
+
    FLAG_Z = src & mask;
    m68ki_write_8(ea, src & ~mask);
 }
@@ -4981,6 +4899,8 @@ void m68k_op_bclr_8_r_al(void)
    uint src = m68ki_read_8(ea);
    uint mask = 1 << (DX & 7);
 
+   m68ki_resolve_flags();
+
    FLAG_Z = src & mask;
    m68ki_write_8(ea, src & ~mask);
 }
@@ -4991,6 +4911,8 @@ void m68k_op_bclr_32_s_d(void)
    uint* r_dst = &DY;
    uint mask = 1 << (OPER_I_8() & 0x1f);
 
+   m68ki_resolve_flags();
+
    FLAG_Z = *r_dst & mask;
    *r_dst &= ~mask;
 }
@@ -5002,6 +4924,8 @@ void m68k_op_bclr_8_s_ai(void)
    uint ea = EA_AY_AI_8();
    uint src = m68ki_read_8(ea);
 
+   m68ki_resolve_flags();
+
    FLAG_Z = src & mask;
    m68ki_write_8(ea, src & ~mask);
 }
@@ -5013,6 +4937,8 @@ void m68k_op_bclr_8_s_pi(void)
    uint ea = EA_AY_PI_8();
    uint src = m68ki_read_8(ea);
 
+   m68ki_resolve_flags();
+
    FLAG_Z = src & mask;
    m68ki_write_8(ea, src & ~mask);
 }
@@ -5024,6 +4950,8 @@ void m68k_op_bclr_8_s_pi7(void)
    uint ea = EA_A7_PI_8();
    uint src = m68ki_read_8(ea);
 
+   m68ki_resolve_flags();
+
    FLAG_Z = src & mask;
    m68ki_write_8(ea, src & ~mask);
 }
@@ -5035,6 +4963,8 @@ void m68k_op_bclr_8_s_pd(void)
    uint ea = EA_AY_PD_8();
    uint src = m68ki_read_8(ea);
 
+   m68ki_resolve_flags();
+
    FLAG_Z = src & mask;
    m68ki_write_8(ea, src & ~mask);
 }
@@ -5046,6 +4976,8 @@ void m68k_op_bclr_8_s_pd7(void)
    uint ea = EA_A7_PD_8();
    uint src = m68ki_read_8(ea);
 
+   m68ki_resolve_flags();
+
    FLAG_Z = src & mask;
    m68ki_write_8(ea, src & ~mask);
 }
@@ -5057,6 +4989,8 @@ void m68k_op_bclr_8_s_di(void)
    uint ea = EA_AY_DI_8();
    uint src = m68ki_read_8(ea);
 
+   m68ki_resolve_flags();
+
    FLAG_Z = src & mask;
    m68ki_write_8(ea, src & ~mask);
 }
@@ -5068,6 +5002,8 @@ void m68k_op_bclr_8_s_ix(void)
    uint ea = EA_AY_IX_8();
    uint src = m68ki_read_8(ea);
 
+   m68ki_resolve_flags();
+
    FLAG_Z = src & mask;
    m68ki_write_8(ea, src & ~mask);
 }
@@ -5079,6 +5015,8 @@ void m68k_op_bclr_8_s_aw(void)
    uint ea = EA_AW_8();
    uint src = m68ki_read_8(ea);
 
+   m68ki_resolve_flags();
+
    FLAG_Z = src & mask;
    m68ki_write_8(ea, src & ~mask);
 }
@@ -5090,6 +5028,8 @@ void m68k_op_bclr_8_s_al(void)
    uint ea = EA_AL_8();
    uint src = m68ki_read_8(ea);
 
+   m68ki_resolve_flags();
+
    FLAG_Z = src & mask;
    m68ki_write_8(ea, src & ~mask);
 }
@@ -5097,6 +5037,7 @@ void m68k_op_bclr_8_s_al(void)
 
 void m68k_op_bfchg_32_d(void)
 {
+   m68ki_resolve_flags();
    if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
    {
       uint word2 = OPER_I_16();
@@ -5132,6 +5073,7 @@ void m68k_op_bfchg_32_d(void)
 
 void m68k_op_bfchg_32_ai(void)
 {
+   m68ki_resolve_flags();
    if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
    {
       uint word2 = OPER_I_16();
@@ -5186,6 +5128,7 @@ void m68k_op_bfchg_32_ai(void)
 
 void m68k_op_bfchg_32_di(void)
 {
+   m68ki_resolve_flags();
    if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
    {
       uint word2 = OPER_I_16();
@@ -5240,6 +5183,7 @@ void m68k_op_bfchg_32_di(void)
 
 void m68k_op_bfchg_32_ix(void)
 {
+   m68ki_resolve_flags();
    if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
    {
       uint word2 = OPER_I_16();
@@ -5294,6 +5238,7 @@ void m68k_op_bfchg_32_ix(void)
 
 void m68k_op_bfchg_32_aw(void)
 {
+   m68ki_resolve_flags();
    if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
    {
       uint word2 = OPER_I_16();
@@ -5348,6 +5293,7 @@ void m68k_op_bfchg_32_aw(void)
 
 void m68k_op_bfchg_32_al(void)
 {
+   m68ki_resolve_flags();
    if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
    {
       uint word2 = OPER_I_16();
@@ -5402,6 +5348,7 @@ void m68k_op_bfchg_32_al(void)
 
 void m68k_op_bfclr_32_d(void)
 {
+   m68ki_resolve_flags();
    if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
    {
       uint word2 = OPER_I_16();
@@ -5439,6 +5386,7 @@ void m68k_op_bfclr_32_d(void)
 
 void m68k_op_bfclr_32_ai(void)
 {
+   m68ki_resolve_flags();
    if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
    {
       uint word2 = OPER_I_16();
@@ -5493,6 +5441,7 @@ void m68k_op_bfclr_32_ai(void)
 
 void m68k_op_bfclr_32_di(void)
 {
+   m68ki_resolve_flags();
    if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
    {
       uint word2 = OPER_I_16();
@@ -5547,6 +5496,7 @@ void m68k_op_bfclr_32_di(void)
 
 void m68k_op_bfclr_32_ix(void)
 {
+   m68ki_resolve_flags();
    if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
    {
       uint word2 = OPER_I_16();
@@ -5601,6 +5551,7 @@ void m68k_op_bfclr_32_ix(void)
 
 void m68k_op_bfclr_32_aw(void)
 {
+   m68ki_resolve_flags();
    if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
    {
       uint word2 = OPER_I_16();
@@ -5655,6 +5606,7 @@ void m68k_op_bfclr_32_aw(void)
 
 void m68k_op_bfclr_32_al(void)
 {
+   m68ki_resolve_flags();
    if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
    {
       uint word2 = OPER_I_16();
@@ -5709,6 +5661,7 @@ void m68k_op_bfclr_32_al(void)
 
 void m68k_op_bfexts_32_d(void)
 {
+   m68ki_resolve_flags();
    if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
    {
       uint word2 = OPER_I_16();
@@ -5743,6 +5696,7 @@ void m68k_op_bfexts_32_d(void)
 
 void m68k_op_bfexts_32_ai(void)
 {
+   m68ki_resolve_flags();
    if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
    {
       uint word2 = OPER_I_16();
@@ -5791,6 +5745,7 @@ void m68k_op_bfexts_32_ai(void)
 
 void m68k_op_bfexts_32_di(void)
 {
+   m68ki_resolve_flags();
    if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
    {
       uint word2 = OPER_I_16();
@@ -5839,6 +5794,7 @@ void m68k_op_bfexts_32_di(void)
 
 void m68k_op_bfexts_32_ix(void)
 {
+   m68ki_resolve_flags();
    if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
    {
       uint word2 = OPER_I_16();
@@ -5887,6 +5843,7 @@ void m68k_op_bfexts_32_ix(void)
 
 void m68k_op_bfexts_32_aw(void)
 {
+   m68ki_resolve_flags();
    if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
    {
       uint word2 = OPER_I_16();
@@ -5935,6 +5892,7 @@ void m68k_op_bfexts_32_aw(void)
 
 void m68k_op_bfexts_32_al(void)
 {
+   m68ki_resolve_flags();
    if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
    {
       uint word2 = OPER_I_16();
@@ -5983,6 +5941,7 @@ void m68k_op_bfexts_32_al(void)
 
 void m68k_op_bfexts_32_pcdi(void)
 {
+   m68ki_resolve_flags();
    if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
    {
       uint word2 = OPER_I_16();
@@ -6031,6 +5990,7 @@ void m68k_op_bfexts_32_pcdi(void)
 
 void m68k_op_bfexts_32_pcix(void)
 {
+   m68ki_resolve_flags();
    if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
    {
       uint word2 = OPER_I_16();
@@ -6079,6 +6039,7 @@ void m68k_op_bfexts_32_pcix(void)
 
 void m68k_op_bfextu_32_d(void)
 {
+   m68ki_resolve_flags();
    if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
    {
       uint word2 = OPER_I_16();
@@ -6113,6 +6074,7 @@ void m68k_op_bfextu_32_d(void)
 
 void m68k_op_bfextu_32_ai(void)
 {
+   m68ki_resolve_flags();
    if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
    {
       uint word2 = OPER_I_16();
@@ -6160,6 +6122,7 @@ void m68k_op_bfextu_32_ai(void)
 
 void m68k_op_bfextu_32_di(void)
 {
+   m68ki_resolve_flags();
    if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
    {
       uint word2 = OPER_I_16();
@@ -6207,6 +6170,7 @@ void m68k_op_bfextu_32_di(void)
 
 void m68k_op_bfextu_32_ix(void)
 {
+   m68ki_resolve_flags();
    if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
    {
       uint word2 = OPER_I_16();
@@ -6254,6 +6218,7 @@ void m68k_op_bfextu_32_ix(void)
 
 void m68k_op_bfextu_32_aw(void)
 {
+   m68ki_resolve_flags();
    if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
    {
       uint word2 = OPER_I_16();
@@ -6301,6 +6266,7 @@ void m68k_op_bfextu_32_aw(void)
 
 void m68k_op_bfextu_32_al(void)
 {
+   m68ki_resolve_flags();
    if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
    {
       uint word2 = OPER_I_16();
@@ -6348,6 +6314,7 @@ void m68k_op_bfextu_32_al(void)
 
 void m68k_op_bfextu_32_pcdi(void)
 {
+   m68ki_resolve_flags();
    if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
    {
       uint word2 = OPER_I_16();
@@ -6395,6 +6362,7 @@ void m68k_op_bfextu_32_pcdi(void)
 
 void m68k_op_bfextu_32_pcix(void)
 {
+   m68ki_resolve_flags();
    if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
    {
       uint word2 = OPER_I_16();
@@ -6442,6 +6410,7 @@ void m68k_op_bfextu_32_pcix(void)
 
 void m68k_op_bfffo_32_d(void)
 {
+   m68ki_resolve_flags();
    if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
    {
       uint word2 = OPER_I_16();
@@ -6480,6 +6449,7 @@ void m68k_op_bfffo_32_d(void)
 
 void m68k_op_bfffo_32_ai(void)
 {
+   m68ki_resolve_flags();
    if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
    {
       uint word2 = OPER_I_16();
@@ -6532,6 +6502,7 @@ void m68k_op_bfffo_32_ai(void)
 
 void m68k_op_bfffo_32_di(void)
 {
+   m68ki_resolve_flags();
    if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
    {
       uint word2 = OPER_I_16();
@@ -6584,6 +6555,7 @@ void m68k_op_bfffo_32_di(void)
 
 void m68k_op_bfffo_32_ix(void)
 {
+   m68ki_resolve_flags();
    if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
    {
       uint word2 = OPER_I_16();
@@ -6636,6 +6608,7 @@ void m68k_op_bfffo_32_ix(void)
 
 void m68k_op_bfffo_32_aw(void)
 {
+   m68ki_resolve_flags();
    if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
    {
       uint word2 = OPER_I_16();
@@ -6688,6 +6661,7 @@ void m68k_op_bfffo_32_aw(void)
 
 void m68k_op_bfffo_32_al(void)
 {
+   m68ki_resolve_flags();
    if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
    {
       uint word2 = OPER_I_16();
@@ -6740,6 +6714,7 @@ void m68k_op_bfffo_32_al(void)
 
 void m68k_op_bfffo_32_pcdi(void)
 {
+   m68ki_resolve_flags();
    if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
    {
       uint word2 = OPER_I_16();
@@ -6792,6 +6767,7 @@ void m68k_op_bfffo_32_pcdi(void)
 
 void m68k_op_bfffo_32_pcix(void)
 {
+   m68ki_resolve_flags();
    if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
    {
       uint word2 = OPER_I_16();
@@ -6844,6 +6820,7 @@ void m68k_op_bfffo_32_pcix(void)
 
 void m68k_op_bfins_32_d(void)
 {
+   m68ki_resolve_flags();
    if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
    {
       uint word2 = OPER_I_16();
@@ -6886,6 +6863,7 @@ void m68k_op_bfins_32_d(void)
 
 void m68k_op_bfins_32_ai(void)
 {
+   m68ki_resolve_flags();
    if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
    {
       uint word2 = OPER_I_16();
@@ -6947,6 +6925,7 @@ void m68k_op_bfins_32_ai(void)
 
 void m68k_op_bfins_32_di(void)
 {
+   m68ki_resolve_flags();
    if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
    {
       uint word2 = OPER_I_16();
@@ -7008,6 +6987,7 @@ void m68k_op_bfins_32_di(void)
 
 void m68k_op_bfins_32_ix(void)
 {
+   m68ki_resolve_flags();
    if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
    {
       uint word2 = OPER_I_16();
@@ -7069,6 +7049,7 @@ void m68k_op_bfins_32_ix(void)
 
 void m68k_op_bfins_32_aw(void)
 {
+   m68ki_resolve_flags();
    if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
    {
       uint word2 = OPER_I_16();
@@ -7130,6 +7111,7 @@ void m68k_op_bfins_32_aw(void)
 
 void m68k_op_bfins_32_al(void)
 {
+   m68ki_resolve_flags();
    if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
    {
       uint word2 = OPER_I_16();
@@ -7191,6 +7173,7 @@ void m68k_op_bfins_32_al(void)
 
 void m68k_op_bfset_32_d(void)
 {
+   m68ki_resolve_flags();
    if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
    {
       uint word2 = OPER_I_16();
@@ -7228,6 +7211,7 @@ void m68k_op_bfset_32_d(void)
 
 void m68k_op_bfset_32_ai(void)
 {
+   m68ki_resolve_flags();
    if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
    {
       uint word2 = OPER_I_16();
@@ -7283,6 +7267,7 @@ void m68k_op_bfset_32_ai(void)
 
 void m68k_op_bfset_32_di(void)
 {
+   m68ki_resolve_flags();
    if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
    {
       uint word2 = OPER_I_16();
@@ -7338,6 +7323,7 @@ void m68k_op_bfset_32_di(void)
 
 void m68k_op_bfset_32_ix(void)
 {
+   m68ki_resolve_flags();
    if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
    {
       uint word2 = OPER_I_16();
@@ -7393,6 +7379,7 @@ void m68k_op_bfset_32_ix(void)
 
 void m68k_op_bfset_32_aw(void)
 {
+   m68ki_resolve_flags();
    if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
    {
       uint word2 = OPER_I_16();
@@ -7448,6 +7435,7 @@ void m68k_op_bfset_32_aw(void)
 
 void m68k_op_bfset_32_al(void)
 {
+   m68ki_resolve_flags();
    if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
    {
       uint word2 = OPER_I_16();
@@ -7503,6 +7491,7 @@ void m68k_op_bfset_32_al(void)
 
 void m68k_op_bftst_32_d(void)
 {
+   m68ki_resolve_flags();
    if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
    {
       uint word2 = OPER_I_16();
@@ -7538,6 +7527,7 @@ void m68k_op_bftst_32_d(void)
 
 void m68k_op_bftst_32_ai(void)
 {
+   m68ki_resolve_flags();
    if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
    {
       uint word2 = OPER_I_16();
@@ -7589,6 +7579,7 @@ void m68k_op_bftst_32_ai(void)
 
 void m68k_op_bftst_32_di(void)
 {
+   m68ki_resolve_flags();
    if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
    {
       uint word2 = OPER_I_16();
@@ -7640,6 +7631,7 @@ void m68k_op_bftst_32_di(void)
 
 void m68k_op_bftst_32_ix(void)
 {
+   m68ki_resolve_flags();
    if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
    {
       uint word2 = OPER_I_16();
@@ -7691,6 +7683,7 @@ void m68k_op_bftst_32_ix(void)
 
 void m68k_op_bftst_32_aw(void)
 {
+   m68ki_resolve_flags();
    if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
    {
       uint word2 = OPER_I_16();
@@ -7742,6 +7735,7 @@ void m68k_op_bftst_32_aw(void)
 
 void m68k_op_bftst_32_al(void)
 {
+   m68ki_resolve_flags();
    if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
    {
       uint word2 = OPER_I_16();
@@ -7793,6 +7787,7 @@ void m68k_op_bftst_32_al(void)
 
 void m68k_op_bftst_32_pcdi(void)
 {
+   m68ki_resolve_flags();
    if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
    {
       uint word2 = OPER_I_16();
@@ -7844,6 +7839,7 @@ void m68k_op_bftst_32_pcdi(void)
 
 void m68k_op_bftst_32_pcix(void)
 {
+   m68ki_resolve_flags();
    if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
    {
       uint word2 = OPER_I_16();
@@ -7944,6 +7940,8 @@ void m68k_op_bset_32_r_d(void)
    uint* r_dst = &DY;
    uint mask = 1 << (DX & 0x1f);
 
+   m68ki_resolve_flags();
+
    FLAG_Z = *r_dst & mask;
    *r_dst |= mask;
 }
@@ -7955,6 +7953,8 @@ void m68k_op_bset_8_r_ai(void)
    uint src = m68ki_read_8(ea);
    uint mask = 1 << (DX & 7);
 
+   m68ki_resolve_flags();
+
    FLAG_Z = src & mask;
    m68ki_write_8(ea, src | mask);
 }
@@ -7966,6 +7966,8 @@ void m68k_op_bset_8_r_pi(void)
    uint src = m68ki_read_8(ea);
    uint mask = 1 << (DX & 7);
 
+   m68ki_resolve_flags();
+
    FLAG_Z = src & mask;
    m68ki_write_8(ea, src | mask);
 }
@@ -7977,6 +7979,8 @@ void m68k_op_bset_8_r_pi7(void)
    uint src = m68ki_read_8(ea);
    uint mask = 1 << (DX & 7);
 
+   m68ki_resolve_flags();
+
    FLAG_Z = src & mask;
    m68ki_write_8(ea, src | mask);
 }
@@ -7988,6 +7992,8 @@ void m68k_op_bset_8_r_pd(void)
    uint src = m68ki_read_8(ea);
    uint mask = 1 << (DX & 7);
 
+   m68ki_resolve_flags();
+
    FLAG_Z = src & mask;
    m68ki_write_8(ea, src | mask);
 }
@@ -7999,6 +8005,8 @@ void m68k_op_bset_8_r_pd7(void)
    uint src = m68ki_read_8(ea);
    uint mask = 1 << (DX & 7);
 
+   m68ki_resolve_flags();
+
    FLAG_Z = src & mask;
    m68ki_write_8(ea, src | mask);
 }
@@ -8010,6 +8018,8 @@ void m68k_op_bset_8_r_di(void)
    uint src = m68ki_read_8(ea);
    uint mask = 1 << (DX & 7);
 
+   m68ki_resolve_flags();
+
    FLAG_Z = src & mask;
    m68ki_write_8(ea, src | mask);
 }
@@ -8021,6 +8031,8 @@ void m68k_op_bset_8_r_ix(void)
    uint src = m68ki_read_8(ea);
    uint mask = 1 << (DX & 7);
 
+   m68ki_resolve_flags();
+
    FLAG_Z = src & mask;
    m68ki_write_8(ea, src | mask);
 }
@@ -8032,6 +8044,8 @@ void m68k_op_bset_8_r_aw(void)
    uint src = m68ki_read_8(ea);
    uint mask = 1 << (DX & 7);
 
+   m68ki_resolve_flags();
+
    FLAG_Z = src & mask;
    m68ki_write_8(ea, src | mask);
 }
@@ -8043,6 +8057,8 @@ void m68k_op_bset_8_r_al(void)
    uint src = m68ki_read_8(ea);
    uint mask = 1 << (DX & 7);
 
+   m68ki_resolve_flags();
+
    FLAG_Z = src & mask;
    m68ki_write_8(ea, src | mask);
 }
@@ -8053,6 +8069,8 @@ void m68k_op_bset_32_s_d(void)
    uint* r_dst = &DY;
    uint mask = 1 << (OPER_I_8() & 0x1f);
 
+   m68ki_resolve_flags();
+
    FLAG_Z = *r_dst & mask;
    *r_dst |= mask;
 }
@@ -8064,6 +8082,8 @@ void m68k_op_bset_8_s_ai(void)
    uint ea = EA_AY_AI_8();
    uint src = m68ki_read_8(ea);
 
+   m68ki_resolve_flags();
+
    FLAG_Z = src & mask;
    m68ki_write_8(ea, src | mask);
 }
@@ -8075,6 +8095,8 @@ void m68k_op_bset_8_s_pi(void)
    uint ea = EA_AY_PI_8();
    uint src = m68ki_read_8(ea);
 
+   m68ki_resolve_flags();
+
    FLAG_Z = src & mask;
    m68ki_write_8(ea, src | mask);
 }
@@ -8086,6 +8108,8 @@ void m68k_op_bset_8_s_pi7(void)
    uint ea = EA_A7_PI_8();
    uint src = m68ki_read_8(ea);
 
+   m68ki_resolve_flags();
+
    FLAG_Z = src & mask;
    m68ki_write_8(ea, src | mask);
 }
@@ -8097,6 +8121,8 @@ void m68k_op_bset_8_s_pd(void)
    uint ea = EA_AY_PD_8();
    uint src = m68ki_read_8(ea);
 
+   m68ki_resolve_flags();
+
    FLAG_Z = src & mask;
    m68ki_write_8(ea, src | mask);
 }
@@ -8108,6 +8134,8 @@ void m68k_op_bset_8_s_pd7(void)
    uint ea = EA_A7_PD_8();
    uint src = m68ki_read_8(ea);
 
+   m68ki_resolve_flags();
+
    FLAG_Z = src & mask;
    m68ki_write_8(ea, src | mask);
 }
@@ -8119,6 +8147,8 @@ void m68k_op_bset_8_s_di(void)
    uint ea = EA_AY_DI_8();
    uint src = m68ki_read_8(ea);
 
+   m68ki_resolve_flags();
+
    FLAG_Z = src & mask;
    m68ki_write_8(ea, src | mask);
 }
@@ -8130,6 +8160,8 @@ void m68k_op_bset_8_s_ix(void)
    uint ea = EA_AY_IX_8();
    uint src = m68ki_read_8(ea);
 
+   m68ki_resolve_flags();
+
    FLAG_Z = src & mask;
    m68ki_write_8(ea, src | mask);
 }
@@ -8141,6 +8173,8 @@ void m68k_op_bset_8_s_aw(void)
    uint ea = EA_AW_8();
    uint src = m68ki_read_8(ea);
 
+   m68ki_resolve_flags();
+
    FLAG_Z = src & mask;
    m68ki_write_8(ea, src | mask);
 }
@@ -8152,6 +8186,8 @@ void m68k_op_bset_8_s_al(void)
    uint ea = EA_AL_8();
    uint src = m68ki_read_8(ea);
 
+   m68ki_resolve_flags();
+
    FLAG_Z = src & mask;
    m68ki_write_8(ea, src | mask);
 }
@@ -8192,84 +8228,98 @@ void m68k_op_bsr_32(void)
 
 void m68k_op_btst_32_r_d(void)
 {
+   m68ki_resolve_flags();
    FLAG_Z = DY & (1 << (DX & 0x1f));
 }
 
 
 void m68k_op_btst_8_r_ai(void)
 {
+   m68ki_resolve_flags();
    FLAG_Z = OPER_AY_AI_8() & (1 << (DX & 7));
 }
 
 
 void m68k_op_btst_8_r_pi(void)
 {
+   m68ki_resolve_flags();
    FLAG_Z = OPER_AY_PI_8() & (1 << (DX & 7));
 }
 
 
 void m68k_op_btst_8_r_pi7(void)
 {
+   m68ki_resolve_flags();
    FLAG_Z = OPER_A7_PI_8() & (1 << (DX & 7));
 }
 
 
 void m68k_op_btst_8_r_pd(void)
 {
+   m68ki_resolve_flags();
    FLAG_Z = OPER_AY_PD_8() & (1 << (DX & 7));
 }
 
 
 void m68k_op_btst_8_r_pd7(void)
 {
+   m68ki_resolve_flags();
    FLAG_Z = OPER_A7_PD_8() & (1 << (DX & 7));
 }
 
 
 void m68k_op_btst_8_r_di(void)
 {
+   m68ki_resolve_flags();
    FLAG_Z = OPER_AY_DI_8() & (1 << (DX & 7));
 }
 
 
 void m68k_op_btst_8_r_ix(void)
 {
+   m68ki_resolve_flags();
    FLAG_Z = OPER_AY_IX_8() & (1 << (DX & 7));
 }
 
 
 void m68k_op_btst_8_r_aw(void)
 {
+   m68ki_resolve_flags();
    FLAG_Z = OPER_AW_8() & (1 << (DX & 7));
 }
 
 
 void m68k_op_btst_8_r_al(void)
 {
+   m68ki_resolve_flags();
    FLAG_Z = OPER_AL_8() & (1 << (DX & 7));
 }
 
 
 void m68k_op_btst_8_r_pcdi(void)
 {
+   m68ki_resolve_flags();
    FLAG_Z = OPER_PCDI_8() & (1 << (DX & 7));
 }
 
 
 void m68k_op_btst_8_r_pcix(void)
 {
+   m68ki_resolve_flags();
    FLAG_Z = OPER_PCIX_8() & (1 << (DX & 7));
 }
 
 
 void m68k_op_btst_8_r_i(void)
 {
+   m68ki_resolve_flags();
    FLAG_Z = OPER_I_8() & (1 << (DX & 7));
 }
 
 
 void m68k_op_btst_32_s_d(void)
 {
+   m68ki_resolve_flags();
    FLAG_Z = DY & (1 << (OPER_I_8() & 0x1f));
 }
 
@@ -8278,6 +8328,8 @@ void m68k_op_btst_8_s_ai(void)
 {
    uint bit = OPER_I_8() & 7;
 
+   m68ki_resolve_flags();
+
    FLAG_Z = OPER_AY_AI_8() & (1 << bit);
 }
 
@@ -8286,6 +8338,8 @@ void m68k_op_btst_8_s_pi(void)
 {
    uint bit = OPER_I_8() & 7;
 
+   m68ki_resolve_flags();
+
    FLAG_Z = OPER_AY_PI_8() & (1 << bit);
 }
 
@@ -8294,6 +8348,8 @@ void m68k_op_btst_8_s_pi7(void)
 {
    uint bit = OPER_I_8() & 7;
 
+   m68ki_resolve_flags();
+
    FLAG_Z = OPER_A7_PI_8() & (1 << bit);
 }
 
@@ -8302,6 +8358,8 @@ void m68k_op_btst_8_s_pd(void)
 {
    uint bit = OPER_I_8() & 7;
 
+   m68ki_resolve_flags();
+
    FLAG_Z = OPER_AY_PD_8() & (1 << bit);
 }
 
@@ -8310,6 +8368,8 @@ void m68k_op_btst_8_s_pd7(void)
 {
    uint bit = OPER_I_8() & 7;
 
+   m68ki_resolve_flags();
+
    FLAG_Z = OPER_A7_PD_8() & (1 << bit);
 }
 
@@ -8318,6 +8378,8 @@ void m68k_op_btst_8_s_di(void)
 {
    uint bit = OPER_I_8() & 7;
 
+   m68ki_resolve_flags();
+
    FLAG_Z = OPER_AY_DI_8() & (1 << bit);
 }
 
@@ -8326,6 +8388,8 @@ void m68k_op_btst_8_s_ix(void)
 {
    uint bit = OPER_I_8() & 7;
 
+   m68ki_resolve_flags();
+
    FLAG_Z = OPER_AY_IX_8() & (1 << bit);
 }
 
@@ -8334,6 +8398,8 @@ void m68k_op_btst_8_s_aw(void)
 {
    uint bit = OPER_I_8() & 7;
 
+   m68ki_resolve_flags();
+
    FLAG_Z = OPER_AW_8() & (1 << bit);
 }
 
@@ -8342,6 +8408,8 @@ void m68k_op_btst_8_s_al(void)
 {
    uint bit = OPER_I_8() & 7;
 
+   m68ki_resolve_flags();
+
    FLAG_Z = OPER_AL_8() & (1 << bit);
 }
 
@@ -8350,6 +8418,8 @@ void m68k_op_btst_8_s_pcdi(void)
 {
    uint bit = OPER_I_8() & 7;
 
+   m68ki_resolve_flags();
+
    FLAG_Z = OPER_PCDI_8() & (1 << bit);
 }
 
@@ -8358,6 +8428,8 @@ void m68k_op_btst_8_s_pcix(void)
 {
    uint bit = OPER_I_8() & 7;
 
+   m68ki_resolve_flags();
+
    FLAG_Z = OPER_PCIX_8() & (1 << bit);
 }
 
@@ -8497,6 +8569,7 @@ void m68k_op_callm_32_pcix(void)
 
 void m68k_op_cas_8_ai(void)
 {
+   m68ki_resolve_flags();
    if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
    {
       uint word2 = OPER_I_16();
@@ -8526,6 +8599,7 @@ void m68k_op_cas_8_ai(void)
 
 void m68k_op_cas_8_pi(void)
 {
+   m68ki_resolve_flags();
    if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
    {
       uint word2 = OPER_I_16();
@@ -8555,6 +8629,7 @@ void m68k_op_cas_8_pi(void)
 
 void m68k_op_cas_8_pi7(void)
 {
+   m68ki_resolve_flags();
    if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
    {
       uint word2 = OPER_I_16();
@@ -8584,6 +8659,7 @@ void m68k_op_cas_8_pi7(void)
 
 void m68k_op_cas_8_pd(void)
 {
+   m68ki_resolve_flags();
    if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
    {
       uint word2 = OPER_I_16();
@@ -8613,6 +8689,7 @@ void m68k_op_cas_8_pd(void)
 
 void m68k_op_cas_8_pd7(void)
 {
+   m68ki_resolve_flags();
    if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
    {
       uint word2 = OPER_I_16();
@@ -8642,6 +8719,7 @@ void m68k_op_cas_8_pd7(void)
 
 void m68k_op_cas_8_di(void)
 {
+   m68ki_resolve_flags();
    if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
    {
       uint word2 = OPER_I_16();
@@ -8671,6 +8749,7 @@ void m68k_op_cas_8_di(void)
 
 void m68k_op_cas_8_ix(void)
 {
+   m68ki_resolve_flags();
    if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
    {
       uint word2 = OPER_I_16();
@@ -8700,6 +8779,7 @@ void m68k_op_cas_8_ix(void)
 
 void m68k_op_cas_8_aw(void)
 {
+   m68ki_resolve_flags();
    if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
    {
       uint word2 = OPER_I_16();
@@ -8729,6 +8809,7 @@ void m68k_op_cas_8_aw(void)
 
 void m68k_op_cas_8_al(void)
 {
+   m68ki_resolve_flags();
    if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
    {
       uint word2 = OPER_I_16();
@@ -8758,6 +8839,7 @@ void m68k_op_cas_8_al(void)
 
 void m68k_op_cas_16_ai(void)
 {
+   m68ki_resolve_flags();
    if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
    {
       uint word2 = OPER_I_16();
@@ -8787,6 +8869,7 @@ void m68k_op_cas_16_ai(void)
 
 void m68k_op_cas_16_pi(void)
 {
+   m68ki_resolve_flags();
    if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
    {
       uint word2 = OPER_I_16();
@@ -8816,6 +8899,7 @@ void m68k_op_cas_16_pi(void)
 
 void m68k_op_cas_16_pd(void)
 {
+   m68ki_resolve_flags();
    if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
    {
       uint word2 = OPER_I_16();
@@ -8845,6 +8929,7 @@ void m68k_op_cas_16_pd(void)
 
 void m68k_op_cas_16_di(void)
 {
+   m68ki_resolve_flags();
    if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
    {
       uint word2 = OPER_I_16();
@@ -8874,6 +8959,7 @@ void m68k_op_cas_16_di(void)
 
 void m68k_op_cas_16_ix(void)
 {
+   m68ki_resolve_flags();
    if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
    {
       uint word2 = OPER_I_16();
@@ -8903,6 +8989,7 @@ void m68k_op_cas_16_ix(void)
 
 void m68k_op_cas_16_aw(void)
 {
+   m68ki_resolve_flags();
    if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
    {
       uint word2 = OPER_I_16();
@@ -8932,6 +9019,7 @@ void m68k_op_cas_16_aw(void)
 
 void m68k_op_cas_16_al(void)
 {
+   m68ki_resolve_flags();
    if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
    {
       uint word2 = OPER_I_16();
@@ -8961,6 +9049,7 @@ void m68k_op_cas_16_al(void)
 
 void m68k_op_cas_32_ai(void)
 {
+   m68ki_resolve_flags();
    if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
    {
       uint word2 = OPER_I_16();
@@ -8990,6 +9079,7 @@ void m68k_op_cas_32_ai(void)
 
 void m68k_op_cas_32_pi(void)
 {
+   m68ki_resolve_flags();
    if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
    {
       uint word2 = OPER_I_16();
@@ -9019,6 +9109,7 @@ void m68k_op_cas_32_pi(void)
 
 void m68k_op_cas_32_pd(void)
 {
+   m68ki_resolve_flags();
    if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
    {
       uint word2 = OPER_I_16();
@@ -9048,6 +9139,7 @@ void m68k_op_cas_32_pd(void)
 
 void m68k_op_cas_32_di(void)
 {
+   m68ki_resolve_flags();
    if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
    {
       uint word2 = OPER_I_16();
@@ -9077,6 +9169,7 @@ void m68k_op_cas_32_di(void)
 
 void m68k_op_cas_32_ix(void)
 {
+   m68ki_resolve_flags();
    if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
    {
       uint word2 = OPER_I_16();
@@ -9106,6 +9199,7 @@ void m68k_op_cas_32_ix(void)
 
 void m68k_op_cas_32_aw(void)
 {
+   m68ki_resolve_flags();
    if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
    {
       uint word2 = OPER_I_16();
@@ -9135,6 +9229,7 @@ void m68k_op_cas_32_aw(void)
 
 void m68k_op_cas_32_al(void)
 {
+   m68ki_resolve_flags();
    if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
    {
       uint word2 = OPER_I_16();
@@ -9164,6 +9259,7 @@ void m68k_op_cas_32_al(void)
 
 void m68k_op_cas2_16(void)
 {
+   m68ki_resolve_flags();
    if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
    {
       uint word2 = OPER_I_32();
@@ -9209,6 +9305,7 @@ void m68k_op_cas2_16(void)
 
 void m68k_op_cas2_32(void)
 {
+   m68ki_resolve_flags();
    if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
    {
       uint word2 = OPER_I_32();
@@ -9257,6 +9354,8 @@ void m68k_op_chk_16_d(void)
    sint src = MAKE_INT_16(DX);
    sint bound = MAKE_INT_16(DY);
 
+   m68ki_resolve_flags();
+
    FLAG_Z = ZFLAG_16(src); /* Undocumented */
    FLAG_V = VFLAG_CLEAR;   /* Undocumented */
    FLAG_C = CFLAG_CLEAR;   /* Undocumented */
@@ -9275,6 +9374,8 @@ void m68k_op_chk_16_ai(void)
    sint src = MAKE_INT_16(DX);
    sint bound = MAKE_INT_16(OPER_AY_AI_16());
 
+   m68ki_resolve_flags();
+
    FLAG_Z = ZFLAG_16(src); /* Undocumented */
    FLAG_V = VFLAG_CLEAR;   /* Undocumented */
    FLAG_C = CFLAG_CLEAR;   /* Undocumented */
@@ -9293,6 +9394,8 @@ void m68k_op_chk_16_pi(void)
    sint src = MAKE_INT_16(DX);
    sint bound = MAKE_INT_16(OPER_AY_PI_16());
 
+   m68ki_resolve_flags();
+
    FLAG_Z = ZFLAG_16(src); /* Undocumented */
    FLAG_V = VFLAG_CLEAR;   /* Undocumented */
    FLAG_C = CFLAG_CLEAR;   /* Undocumented */
@@ -9311,6 +9414,8 @@ void m68k_op_chk_16_pd(void)
    sint src = MAKE_INT_16(DX);
    sint bound = MAKE_INT_16(OPER_AY_PD_16());
 
+   m68ki_resolve_flags();
+
    FLAG_Z = ZFLAG_16(src); /* Undocumented */
    FLAG_V = VFLAG_CLEAR;   /* Undocumented */
    FLAG_C = CFLAG_CLEAR;   /* Undocumented */
@@ -9329,6 +9434,8 @@ void m68k_op_chk_16_di(void)
    sint src = MAKE_INT_16(DX);
    sint bound = MAKE_INT_16(OPER_AY_DI_16());
 
+   m68ki_resolve_flags();
+
    FLAG_Z = ZFLAG_16(src); /* Undocumented */
    FLAG_V = VFLAG_CLEAR;   /* Undocumented */
    FLAG_C = CFLAG_CLEAR;   /* Undocumented */
@@ -9347,6 +9454,8 @@ void m68k_op_chk_16_ix(void)
    sint src = MAKE_INT_16(DX);
    sint bound = MAKE_INT_16(OPER_AY_IX_16());
 
+   m68ki_resolve_flags();
+
    FLAG_Z = ZFLAG_16(src); /* Undocumented */
    FLAG_V = VFLAG_CLEAR;   /* Undocumented */
    FLAG_C = CFLAG_CLEAR;   /* Undocumented */
@@ -9365,6 +9474,8 @@ void m68k_op_chk_16_aw(void)
    sint src = MAKE_INT_16(DX);
    sint bound = MAKE_INT_16(OPER_AW_16());
 
+   m68ki_resolve_flags();
+
    FLAG_Z = ZFLAG_16(src); /* Undocumented */
    FLAG_V = VFLAG_CLEAR;   /* Undocumented */
    FLAG_C = CFLAG_CLEAR;   /* Undocumented */
@@ -9383,6 +9494,8 @@ void m68k_op_chk_16_al(void)
    sint src = MAKE_INT_16(DX);
    sint bound = MAKE_INT_16(OPER_AL_16());
 
+   m68ki_resolve_flags();
+
    FLAG_Z = ZFLAG_16(src); /* Undocumented */
    FLAG_V = VFLAG_CLEAR;   /* Undocumented */
    FLAG_C = CFLAG_CLEAR;   /* Undocumented */
@@ -9401,6 +9514,8 @@ void m68k_op_chk_16_pcdi(void)
    sint src = MAKE_INT_16(DX);
    sint bound = MAKE_INT_16(OPER_PCDI_16());
 
+   m68ki_resolve_flags();
+
    FLAG_Z = ZFLAG_16(src); /* Undocumented */
    FLAG_V = VFLAG_CLEAR;   /* Undocumented */
    FLAG_C = CFLAG_CLEAR;   /* Undocumented */
@@ -9419,6 +9534,8 @@ void m68k_op_chk_16_pcix(void)
    sint src = MAKE_INT_16(DX);
    sint bound = MAKE_INT_16(OPER_PCIX_16());
 
+   m68ki_resolve_flags();
+
    FLAG_Z = ZFLAG_16(src); /* Undocumented */
    FLAG_V = VFLAG_CLEAR;   /* Undocumented */
    FLAG_C = CFLAG_CLEAR;   /* Undocumented */
@@ -9437,6 +9554,8 @@ void m68k_op_chk_16_i(void)
    sint src = MAKE_INT_16(DX);
    sint bound = MAKE_INT_16(OPER_I_16());
 
+   m68ki_resolve_flags();
+
    FLAG_Z = ZFLAG_16(src); /* Undocumented */
    FLAG_V = VFLAG_CLEAR;   /* Undocumented */
    FLAG_C = CFLAG_CLEAR;   /* Undocumented */
@@ -9452,6 +9571,7 @@ void m68k_op_chk_16_i(void)
 
 void m68k_op_chk_32_d(void)
 {
+   m68ki_resolve_flags();
    if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
    {
       sint src = MAKE_INT_32(DX);
@@ -9475,6 +9595,7 @@ void m68k_op_chk_32_d(void)
 
 void m68k_op_chk_32_ai(void)
 {
+   m68ki_resolve_flags();
    if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
    {
       sint src = MAKE_INT_32(DX);
@@ -9498,6 +9619,7 @@ void m68k_op_chk_32_ai(void)
 
 void m68k_op_chk_32_pi(void)
 {
+   m68ki_resolve_flags();
    if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
    {
       sint src = MAKE_INT_32(DX);
@@ -9521,6 +9643,7 @@ void m68k_op_chk_32_pi(void)
 
 void m68k_op_chk_32_pd(void)
 {
+   m68ki_resolve_flags();
    if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
    {
       sint src = MAKE_INT_32(DX);
@@ -9544,6 +9667,7 @@ void m68k_op_chk_32_pd(void)
 
 void m68k_op_chk_32_di(void)
 {
+   m68ki_resolve_flags();
    if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
    {
       sint src = MAKE_INT_32(DX);
@@ -9567,6 +9691,7 @@ void m68k_op_chk_32_di(void)
 
 void m68k_op_chk_32_ix(void)
 {
+   m68ki_resolve_flags();
    if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
    {
       sint src = MAKE_INT_32(DX);
@@ -9590,6 +9715,7 @@ void m68k_op_chk_32_ix(void)
 
 void m68k_op_chk_32_aw(void)
 {
+   m68ki_resolve_flags();
    if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
    {
       sint src = MAKE_INT_32(DX);
@@ -9613,6 +9739,7 @@ void m68k_op_chk_32_aw(void)
 
 void m68k_op_chk_32_al(void)
 {
+   m68ki_resolve_flags();
    if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
    {
       sint src = MAKE_INT_32(DX);
@@ -9636,6 +9763,7 @@ void m68k_op_chk_32_al(void)
 
 void m68k_op_chk_32_pcdi(void)
 {
+   m68ki_resolve_flags();
    if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
    {
       sint src = MAKE_INT_32(DX);
@@ -9659,6 +9787,7 @@ void m68k_op_chk_32_pcdi(void)
 
 void m68k_op_chk_32_pcix(void)
 {
+   m68ki_resolve_flags();
    if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
    {
       sint src = MAKE_INT_32(DX);
@@ -9682,6 +9811,7 @@ void m68k_op_chk_32_pcix(void)
 
 void m68k_op_chk_32_i(void)
 {
+   m68ki_resolve_flags();
    if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
    {
       sint src = MAKE_INT_32(DX);
@@ -9705,6 +9835,7 @@ void m68k_op_chk_32_i(void)
 
 void m68k_op_chk2cmp2_8_pcdi(void)
 {
+   m68ki_resolve_flags();
    if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
    {
       uint word2 = OPER_I_16();
@@ -9736,6 +9867,7 @@ void m68k_op_chk2cmp2_8_pcdi(void)
 
 void m68k_op_chk2cmp2_8_pcix(void)
 {
+   m68ki_resolve_flags();
    if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
    {
       uint word2 = OPER_I_16();
@@ -9767,6 +9899,7 @@ void m68k_op_chk2cmp2_8_pcix(void)
 
 void m68k_op_chk2cmp2_8_ai(void)
 {
+   m68ki_resolve_flags();
    if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
    {
       uint word2 = OPER_I_16();
@@ -9798,6 +9931,7 @@ void m68k_op_chk2cmp2_8_ai(void)
 
 void m68k_op_chk2cmp2_8_di(void)
 {
+   m68ki_resolve_flags();
    if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
    {
       uint word2 = OPER_I_16();
@@ -9829,6 +9963,7 @@ void m68k_op_chk2cmp2_8_di(void)
 
 void m68k_op_chk2cmp2_8_ix(void)
 {
+   m68ki_resolve_flags();
    if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
    {
       uint word2 = OPER_I_16();
@@ -9860,6 +9995,7 @@ void m68k_op_chk2cmp2_8_ix(void)
 
 void m68k_op_chk2cmp2_8_aw(void)
 {
+   m68ki_resolve_flags();
    if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
    {
       uint word2 = OPER_I_16();
@@ -9891,6 +10027,7 @@ void m68k_op_chk2cmp2_8_aw(void)
 
 void m68k_op_chk2cmp2_8_al(void)
 {
+   m68ki_resolve_flags();
    if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
    {
       uint word2 = OPER_I_16();
@@ -9922,6 +10059,7 @@ void m68k_op_chk2cmp2_8_al(void)
 
 void m68k_op_chk2cmp2_16_pcdi(void)
 {
+   m68ki_resolve_flags();
    if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
    {
       uint word2 = OPER_I_16();
@@ -9958,6 +10096,7 @@ void m68k_op_chk2cmp2_16_pcdi(void)
 
 void m68k_op_chk2cmp2_16_pcix(void)
 {
+   m68ki_resolve_flags();
    if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
    {
       uint word2 = OPER_I_16();
@@ -9994,6 +10133,7 @@ void m68k_op_chk2cmp2_16_pcix(void)
 
 void m68k_op_chk2cmp2_16_ai(void)
 {
+   m68ki_resolve_flags();
    if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
    {
       uint word2 = OPER_I_16();
@@ -10031,6 +10171,7 @@ void m68k_op_chk2cmp2_16_ai(void)
 
 void m68k_op_chk2cmp2_16_di(void)
 {
+   m68ki_resolve_flags();
    if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
    {
       uint word2 = OPER_I_16();
@@ -10068,6 +10209,7 @@ void m68k_op_chk2cmp2_16_di(void)
 
 void m68k_op_chk2cmp2_16_ix(void)
 {
+   m68ki_resolve_flags();
    if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
    {
       uint word2 = OPER_I_16();
@@ -10105,6 +10247,7 @@ void m68k_op_chk2cmp2_16_ix(void)
 
 void m68k_op_chk2cmp2_16_aw(void)
 {
+   m68ki_resolve_flags();
    if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
    {
       uint word2 = OPER_I_16();
@@ -10142,6 +10285,7 @@ void m68k_op_chk2cmp2_16_aw(void)
 
 void m68k_op_chk2cmp2_16_al(void)
 {
+   m68ki_resolve_flags();
    if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
    {
       uint word2 = OPER_I_16();
@@ -10179,6 +10323,7 @@ void m68k_op_chk2cmp2_16_al(void)
 
 void m68k_op_chk2cmp2_32_pcdi(void)
 {
+   m68ki_resolve_flags();
    if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
    {
       uint word2 = OPER_I_16();
@@ -10209,6 +10354,7 @@ void m68k_op_chk2cmp2_32_pcdi(void)
 
 void m68k_op_chk2cmp2_32_pcix(void)
 {
+   m68ki_resolve_flags();
    if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
    {
       uint word2 = OPER_I_16();
@@ -10239,6 +10385,7 @@ void m68k_op_chk2cmp2_32_pcix(void)
 
 void m68k_op_chk2cmp2_32_ai(void)
 {
+   m68ki_resolve_flags();
    if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
    {
       uint word2 = OPER_I_16();
@@ -10269,6 +10416,7 @@ void m68k_op_chk2cmp2_32_ai(void)
 
 void m68k_op_chk2cmp2_32_di(void)
 {
+   m68ki_resolve_flags();
    if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
    {
       uint word2 = OPER_I_16();
@@ -10299,6 +10447,7 @@ void m68k_op_chk2cmp2_32_di(void)
 
 void m68k_op_chk2cmp2_32_ix(void)
 {
+   m68ki_resolve_flags();
    if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
    {
       uint word2 = OPER_I_16();
@@ -10329,6 +10478,7 @@ void m68k_op_chk2cmp2_32_ix(void)
 
 void m68k_op_chk2cmp2_32_aw(void)
 {
+   m68ki_resolve_flags();
    if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
    {
       uint word2 = OPER_I_16();
@@ -10359,6 +10509,7 @@ void m68k_op_chk2cmp2_32_aw(void)
 
 void m68k_op_chk2cmp2_32_al(void)
 {
+   m68ki_resolve_flags();
    if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
    {
       uint word2 = OPER_I_16();
@@ -10391,6 +10542,7 @@ void m68k_op_clr_8_d(void)
 {
    DY &= 0xffffff00;
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_CLEAR;
    FLAG_V = VFLAG_CLEAR;
    FLAG_C = CFLAG_CLEAR;
@@ -10402,6 +10554,7 @@ void m68k_op_clr_8_ai(void)
 {
    m68ki_write_8(EA_AY_AI_8(), 0);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_CLEAR;
    FLAG_V = VFLAG_CLEAR;
    FLAG_C = CFLAG_CLEAR;
@@ -10413,6 +10566,7 @@ void m68k_op_clr_8_pi(void)
 {
    m68ki_write_8(EA_AY_PI_8(), 0);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_CLEAR;
    FLAG_V = VFLAG_CLEAR;
    FLAG_C = CFLAG_CLEAR;
@@ -10424,6 +10578,7 @@ void m68k_op_clr_8_pi7(void)
 {
    m68ki_write_8(EA_A7_PI_8(), 0);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_CLEAR;
    FLAG_V = VFLAG_CLEAR;
    FLAG_C = CFLAG_CLEAR;
@@ -10435,6 +10590,7 @@ void m68k_op_clr_8_pd(void)
 {
    m68ki_write_8(EA_AY_PD_8(), 0);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_CLEAR;
    FLAG_V = VFLAG_CLEAR;
    FLAG_C = CFLAG_CLEAR;
@@ -10446,6 +10602,7 @@ void m68k_op_clr_8_pd7(void)
 {
    m68ki_write_8(EA_A7_PD_8(), 0);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_CLEAR;
    FLAG_V = VFLAG_CLEAR;
    FLAG_C = CFLAG_CLEAR;
@@ -10457,6 +10614,7 @@ void m68k_op_clr_8_di(void)
 {
    m68ki_write_8(EA_AY_DI_8(), 0);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_CLEAR;
    FLAG_V = VFLAG_CLEAR;
    FLAG_C = CFLAG_CLEAR;
@@ -10468,6 +10626,7 @@ void m68k_op_clr_8_ix(void)
 {
    m68ki_write_8(EA_AY_IX_8(), 0);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_CLEAR;
    FLAG_V = VFLAG_CLEAR;
    FLAG_C = CFLAG_CLEAR;
@@ -10479,6 +10638,7 @@ void m68k_op_clr_8_aw(void)
 {
    m68ki_write_8(EA_AW_8(), 0);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_CLEAR;
    FLAG_V = VFLAG_CLEAR;
    FLAG_C = CFLAG_CLEAR;
@@ -10490,6 +10650,7 @@ void m68k_op_clr_8_al(void)
 {
    m68ki_write_8(EA_AL_8(), 0);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_CLEAR;
    FLAG_V = VFLAG_CLEAR;
    FLAG_C = CFLAG_CLEAR;
@@ -10501,6 +10662,7 @@ void m68k_op_clr_16_d(void)
 {
    DY &= 0xffff0000;
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_CLEAR;
    FLAG_V = VFLAG_CLEAR;
    FLAG_C = CFLAG_CLEAR;
@@ -10512,6 +10674,7 @@ void m68k_op_clr_16_ai(void)
 {
    m68ki_write_16(EA_AY_AI_16(), 0);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_CLEAR;
    FLAG_V = VFLAG_CLEAR;
    FLAG_C = CFLAG_CLEAR;
@@ -10523,6 +10686,7 @@ void m68k_op_clr_16_pi(void)
 {
    m68ki_write_16(EA_AY_PI_16(), 0);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_CLEAR;
    FLAG_V = VFLAG_CLEAR;
    FLAG_C = CFLAG_CLEAR;
@@ -10534,6 +10698,7 @@ void m68k_op_clr_16_pd(void)
 {
    m68ki_write_16(EA_AY_PD_16(), 0);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_CLEAR;
    FLAG_V = VFLAG_CLEAR;
    FLAG_C = CFLAG_CLEAR;
@@ -10545,6 +10710,7 @@ void m68k_op_clr_16_di(void)
 {
    m68ki_write_16(EA_AY_DI_16(), 0);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_CLEAR;
    FLAG_V = VFLAG_CLEAR;
    FLAG_C = CFLAG_CLEAR;
@@ -10556,6 +10722,7 @@ void m68k_op_clr_16_ix(void)
 {
    m68ki_write_16(EA_AY_IX_16(), 0);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_CLEAR;
    FLAG_V = VFLAG_CLEAR;
    FLAG_C = CFLAG_CLEAR;
@@ -10567,6 +10734,7 @@ void m68k_op_clr_16_aw(void)
 {
    m68ki_write_16(EA_AW_16(), 0);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_CLEAR;
    FLAG_V = VFLAG_CLEAR;
    FLAG_C = CFLAG_CLEAR;
@@ -10578,6 +10746,7 @@ void m68k_op_clr_16_al(void)
 {
    m68ki_write_16(EA_AL_16(), 0);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_CLEAR;
    FLAG_V = VFLAG_CLEAR;
    FLAG_C = CFLAG_CLEAR;
@@ -10589,6 +10758,7 @@ void m68k_op_clr_32_d(void)
 {
    DY = 0;
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_CLEAR;
    FLAG_V = VFLAG_CLEAR;
    FLAG_C = CFLAG_CLEAR;
@@ -10600,6 +10770,7 @@ void m68k_op_clr_32_ai(void)
 {
    m68ki_write_32(EA_AY_AI_32(), 0);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_CLEAR;
    FLAG_V = VFLAG_CLEAR;
    FLAG_C = CFLAG_CLEAR;
@@ -10611,6 +10782,7 @@ void m68k_op_clr_32_pi(void)
 {
    m68ki_write_32(EA_AY_PI_32(), 0);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_CLEAR;
    FLAG_V = VFLAG_CLEAR;
    FLAG_C = CFLAG_CLEAR;
@@ -10622,6 +10794,7 @@ void m68k_op_clr_32_pd(void)
 {
    m68ki_write_32(EA_AY_PD_32(), 0);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_CLEAR;
    FLAG_V = VFLAG_CLEAR;
    FLAG_C = CFLAG_CLEAR;
@@ -10633,6 +10806,7 @@ void m68k_op_clr_32_di(void)
 {
    m68ki_write_32(EA_AY_DI_32(), 0);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_CLEAR;
    FLAG_V = VFLAG_CLEAR;
    FLAG_C = CFLAG_CLEAR;
@@ -10644,6 +10818,7 @@ void m68k_op_clr_32_ix(void)
 {
    m68ki_write_32(EA_AY_IX_32(), 0);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_CLEAR;
    FLAG_V = VFLAG_CLEAR;
    FLAG_C = CFLAG_CLEAR;
@@ -10655,6 +10830,7 @@ void m68k_op_clr_32_aw(void)
 {
    m68ki_write_32(EA_AW_32(), 0);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_CLEAR;
    FLAG_V = VFLAG_CLEAR;
    FLAG_C = CFLAG_CLEAR;
@@ -10666,6 +10842,7 @@ void m68k_op_clr_32_al(void)
 {
    m68ki_write_32(EA_AL_32(), 0);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_CLEAR;
    FLAG_V = VFLAG_CLEAR;
    FLAG_C = CFLAG_CLEAR;
@@ -10679,10 +10856,7 @@ void m68k_op_cmp_8_d(void)
    uint dst = MASK_OUT_ABOVE_8(DX);
    uint res = dst - src;
 
-   FLAG_N = NFLAG_8(res);
-   FLAG_Z = MASK_OUT_ABOVE_8(res);
-   FLAG_V = VFLAG_SUB_8(src, dst, res);
-   FLAG_C = CFLAG_8(res);
+   m68ki_set_nzvc_sub_8(src, dst, res);
 }
 
 
@@ -10692,10 +10866,7 @@ void m68k_op_cmp_8_ai(void)
    uint dst = MASK_OUT_ABOVE_8(DX);
    uint res = dst - src;
 
-   FLAG_N = NFLAG_8(res);
-   FLAG_Z = MASK_OUT_ABOVE_8(res);
-   FLAG_V = VFLAG_SUB_8(src, dst, res);
-   FLAG_C = CFLAG_8(res);
+   m68ki_set_nzvc_sub_8(src, dst, res);
 }
 
 
@@ -10705,10 +10876,7 @@ void m68k_op_cmp_8_pi(void)
    uint dst = MASK_OUT_ABOVE_8(DX);
    uint res = dst - src;
 
-   FLAG_N = NFLAG_8(res);
-   FLAG_Z = MASK_OUT_ABOVE_8(res);
-   FLAG_V = VFLAG_SUB_8(src, dst, res);
-   FLAG_C = CFLAG_8(res);
+   m68ki_set_nzvc_sub_8(src, dst, res);
 }
 
 
@@ -10718,10 +10886,7 @@ void m68k_op_cmp_8_pi7(void)
    uint dst = MASK_OUT_ABOVE_8(DX);
    uint res = dst - src;
 
-   FLAG_N = NFLAG_8(res);
-   FLAG_Z = MASK_OUT_ABOVE_8(res);
-   FLAG_V = VFLAG_SUB_8(src, dst, res);
-   FLAG_C = CFLAG_8(res);
+   m68ki_set_nzvc_sub_8(src, dst, res);
 }
 
 
@@ -10731,10 +10896,7 @@ void m68k_op_cmp_8_pd(void)
    uint dst = MASK_OUT_ABOVE_8(DX);
    uint res = dst - src;
 
-   FLAG_N = NFLAG_8(res);
-   FLAG_Z = MASK_OUT_ABOVE_8(res);
-   FLAG_V = VFLAG_SUB_8(src, dst, res);
-   FLAG_C = CFLAG_8(res);
+   m68ki_set_nzvc_sub_8(src, dst, res);
 }
 
 
@@ -10744,10 +10906,7 @@ void m68k_op_cmp_8_pd7(void)
    uint dst = MASK_OUT_ABOVE_8(DX);
    uint res = dst - src;
 
-   FLAG_N = NFLAG_8(res);
-   FLAG_Z = MASK_OUT_ABOVE_8(res);
-   FLAG_V = VFLAG_SUB_8(src, dst, res);
-   FLAG_C = CFLAG_8(res);
+   m68ki_set_nzvc_sub_8(src, dst, res);
 }
 
 
@@ -10757,10 +10916,7 @@ void m68k_op_cmp_8_di(void)
    uint dst = MASK_OUT_ABOVE_8(DX);
    uint res = dst - src;
 
-   FLAG_N = NFLAG_8(res);
-   FLAG_Z = MASK_OUT_ABOVE_8(res);
-   FLAG_V = VFLAG_SUB_8(src, dst, res);
-   FLAG_C = CFLAG_8(res);
+   m68ki_set_nzvc_sub_8(src, dst, res);
 }
 
 
@@ -10770,10 +10926,7 @@ void m68k_op_cmp_8_ix(void)
    uint dst = MASK_OUT_ABOVE_8(DX);
    uint res = dst - src;
 
-   FLAG_N = NFLAG_8(res);
-   FLAG_Z = MASK_OUT_ABOVE_8(res);
-   FLAG_V = VFLAG_SUB_8(src, dst, res);
-   FLAG_C = CFLAG_8(res);
+   m68ki_set_nzvc_sub_8(src, dst, res);
 }
 
 
@@ -10783,10 +10936,7 @@ void m68k_op_cmp_8_aw(void)
    uint dst = MASK_OUT_ABOVE_8(DX);
    uint res = dst - src;
 
-   FLAG_N = NFLAG_8(res);
-   FLAG_Z = MASK_OUT_ABOVE_8(res);
-   FLAG_V = VFLAG_SUB_8(src, dst, res);
-   FLAG_C = CFLAG_8(res);
+   m68ki_set_nzvc_sub_8(src, dst, res);
 }
 
 
@@ -10796,10 +10946,7 @@ void m68k_op_cmp_8_al(void)
    uint dst = MASK_OUT_ABOVE_8(DX);
    uint res = dst - src;
 
-   FLAG_N = NFLAG_8(res);
-   FLAG_Z = MASK_OUT_ABOVE_8(res);
-   FLAG_V = VFLAG_SUB_8(src, dst, res);
-   FLAG_C = CFLAG_8(res);
+   m68ki_set_nzvc_sub_8(src, dst, res);
 }
 
 
@@ -10809,10 +10956,7 @@ void m68k_op_cmp_8_pcdi(void)
    uint dst = MASK_OUT_ABOVE_8(DX);
    uint res = dst - src;
 
-   FLAG_N = NFLAG_8(res);
-   FLAG_Z = MASK_OUT_ABOVE_8(res);
-   FLAG_V = VFLAG_SUB_8(src, dst, res);
-   FLAG_C = CFLAG_8(res);
+   m68ki_set_nzvc_sub_8(src, dst, res);
 }
 
 
@@ -10822,10 +10966,7 @@ void m68k_op_cmp_8_pcix(void)
    uint dst = MASK_OUT_ABOVE_8(DX);
    uint res = dst - src;
 
-   FLAG_N = NFLAG_8(res);
-   FLAG_Z = MASK_OUT_ABOVE_8(res);
-   FLAG_V = VFLAG_SUB_8(src, dst, res);
-   FLAG_C = CFLAG_8(res);
+   m68ki_set_nzvc_sub_8(src, dst, res);
 }
 
 
@@ -10835,10 +10976,7 @@ void m68k_op_cmp_8_i(void)
    uint dst = MASK_OUT_ABOVE_8(DX);
    uint res = dst - src;
 
-   FLAG_N = NFLAG_8(res);
-   FLAG_Z = MASK_OUT_ABOVE_8(res);
-   FLAG_V = VFLAG_SUB_8(src, dst, res);
-   FLAG_C = CFLAG_8(res);
+   m68ki_set_nzvc_sub_8(src, dst, res);
 }
 
 
@@ -10848,10 +10986,7 @@ void m68k_op_cmp_16_d(void)
    uint dst = MASK_OUT_ABOVE_16(DX);
    uint res = dst - src;
 
-   FLAG_N = NFLAG_16(res);
-   FLAG_Z = MASK_OUT_ABOVE_16(res);
-   FLAG_V = VFLAG_SUB_16(src, dst, res);
-   FLAG_C = CFLAG_16(res);
+   m68ki_set_nzvc_sub_16(src, dst, res);
 }
 
 
@@ -10861,10 +10996,7 @@ void m68k_op_cmp_16_a(void)
    uint dst = MASK_OUT_ABOVE_16(DX);
    uint res = dst - src;
 
-   FLAG_N = NFLAG_16(res);
-   FLAG_Z = MASK_OUT_ABOVE_16(res);
-   FLAG_V = VFLAG_SUB_16(src, dst, res);
-   FLAG_C = CFLAG_16(res);
+   m68ki_set_nzvc_sub_16(src, dst, res);
 }
 
 
@@ -10874,10 +11006,7 @@ void m68k_op_cmp_16_ai(void)
    uint dst = MASK_OUT_ABOVE_16(DX);
    uint res = dst - src;
 
-   FLAG_N = NFLAG_16(res);
-   FLAG_Z = MASK_OUT_ABOVE_16(res);
-   FLAG_V = VFLAG_SUB_16(src, dst, res);
-   FLAG_C = CFLAG_16(res);
+   m68ki_set_nzvc_sub_16(src, dst, res);
 }
 
 
@@ -10887,10 +11016,7 @@ void m68k_op_cmp_16_pi(void)
    uint dst = MASK_OUT_ABOVE_16(DX);
    uint res = dst - src;
 
-   FLAG_N = NFLAG_16(res);
-   FLAG_Z = MASK_OUT_ABOVE_16(res);
-   FLAG_V = VFLAG_SUB_16(src, dst, res);
-   FLAG_C = CFLAG_16(res);
+   m68ki_set_nzvc_sub_16(src, dst, res);
 }
 
 
@@ -10900,10 +11026,7 @@ void m68k_op_cmp_16_pd(void)
    uint dst = MASK_OUT_ABOVE_16(DX);
    uint res = dst - src;
 
-   FLAG_N = NFLAG_16(res);
-   FLAG_Z = MASK_OUT_ABOVE_16(res);
-   FLAG_V = VFLAG_SUB_16(src, dst, res);
-   FLAG_C = CFLAG_16(res);
+   m68ki_set_nzvc_sub_16(src, dst, res);
 }
 
 
@@ -10913,10 +11036,7 @@ void m68k_op_cmp_16_di(void)
    uint dst = MASK_OUT_ABOVE_16(DX);
    uint res = dst - src;
 
-   FLAG_N = NFLAG_16(res);
-   FLAG_Z = MASK_OUT_ABOVE_16(res);
-   FLAG_V = VFLAG_SUB_16(src, dst, res);
-   FLAG_C = CFLAG_16(res);
+   m68ki_set_nzvc_sub_16(src, dst, res);
 }
 
 
@@ -10926,10 +11046,7 @@ void m68k_op_cmp_16_ix(void)
    uint dst = MASK_OUT_ABOVE_16(DX);
    uint res = dst - src;
 
-   FLAG_N = NFLAG_16(res);
-   FLAG_Z = MASK_OUT_ABOVE_16(res);
-   FLAG_V = VFLAG_SUB_16(src, dst, res);
-   FLAG_C = CFLAG_16(res);
+   m68ki_set_nzvc_sub_16(src, dst, res);
 }
 
 
@@ -10939,10 +11056,7 @@ void m68k_op_cmp_16_aw(void)
    uint dst = MASK_OUT_ABOVE_16(DX);
    uint res = dst - src;
 
-   FLAG_N = NFLAG_16(res);
-   FLAG_Z = MASK_OUT_ABOVE_16(res);
-   FLAG_V = VFLAG_SUB_16(src, dst, res);
-   FLAG_C = CFLAG_16(res);
+   m68ki_set_nzvc_sub_16(src, dst, res);
 }
 
 
@@ -10952,10 +11066,7 @@ void m68k_op_cmp_16_al(void)
    uint dst = MASK_OUT_ABOVE_16(DX);
    uint res = dst - src;
 
-   FLAG_N = NFLAG_16(res);
-   FLAG_Z = MASK_OUT_ABOVE_16(res);
-   FLAG_V = VFLAG_SUB_16(src, dst, res);
-   FLAG_C = CFLAG_16(res);
+   m68ki_set_nzvc_sub_16(src, dst, res);
 }
 
 
@@ -10965,10 +11076,7 @@ void m68k_op_cmp_16_pcdi(void)
    uint dst = MASK_OUT_ABOVE_16(DX);
    uint res = dst - src;
 
-   FLAG_N = NFLAG_16(res);
-   FLAG_Z = MASK_OUT_ABOVE_16(res);
-   FLAG_V = VFLAG_SUB_16(src, dst, res);
-   FLAG_C = CFLAG_16(res);
+   m68ki_set_nzvc_sub_16(src, dst, res);
 }
 
 
@@ -10978,10 +11086,7 @@ void m68k_op_cmp_16_pcix(void)
    uint dst = MASK_OUT_ABOVE_16(DX);
    uint res = dst - src;
 
-   FLAG_N = NFLAG_16(res);
-   FLAG_Z = MASK_OUT_ABOVE_16(res);
-   FLAG_V = VFLAG_SUB_16(src, dst, res);
-   FLAG_C = CFLAG_16(res);
+   m68ki_set_nzvc_sub_16(src, dst, res);
 }
 
 
@@ -10991,10 +11096,7 @@ void m68k_op_cmp_16_i(void)
    uint dst = MASK_OUT_ABOVE_16(DX);
    uint res = dst - src;
 
-   FLAG_N = NFLAG_16(res);
-   FLAG_Z = MASK_OUT_ABOVE_16(res);
-   FLAG_V = VFLAG_SUB_16(src, dst, res);
-   FLAG_C = CFLAG_16(res);
+   m68ki_set_nzvc_sub_16(src, dst, res);
 }
 
 
@@ -11004,10 +11106,7 @@ void m68k_op_cmp_32_d(void)
    uint dst = DX;
    uint res = dst - src;
 
-   FLAG_N = NFLAG_32(res);
-   FLAG_Z = MASK_OUT_ABOVE_32(res);
-   FLAG_V = VFLAG_SUB_32(src, dst, res);
-   FLAG_C = CFLAG_SUB_32(src, dst, res);
+   m68ki_set_nzvc_sub_32(src, dst, res);
 }
 
 
@@ -11017,10 +11116,7 @@ void m68k_op_cmp_32_a(void)
    uint dst = DX;
    uint res = dst - src;
 
-   FLAG_N = NFLAG_32(res);
-   FLAG_Z = MASK_OUT_ABOVE_32(res);
-   FLAG_V = VFLAG_SUB_32(src, dst, res);
-   FLAG_C = CFLAG_SUB_32(src, dst, res);
+   m68ki_set_nzvc_sub_32(src, dst, res);
 }
 
 
@@ -11030,10 +11126,7 @@ void m68k_op_cmp_32_ai(void)
    uint dst = DX;
    uint res = dst - src;
 
-   FLAG_N = NFLAG_32(res);
-   FLAG_Z = MASK_OUT_ABOVE_32(res);
-   FLAG_V = VFLAG_SUB_32(src, dst, res);
-   FLAG_C = CFLAG_SUB_32(src, dst, res);
+   m68ki_set_nzvc_sub_32(src, dst, res);
 }
 
 
@@ -11043,10 +11136,7 @@ void m68k_op_cmp_32_pi(void)
    uint dst = DX;
    uint res = dst - src;
 
-   FLAG_N = NFLAG_32(res);
-   FLAG_Z = MASK_OUT_ABOVE_32(res);
-   FLAG_V = VFLAG_SUB_32(src, dst, res);
-   FLAG_C = CFLAG_SUB_32(src, dst, res);
+   m68ki_set_nzvc_sub_32(src, dst, res);
 }
 
 
@@ -11056,10 +11146,7 @@ void m68k_op_cmp_32_pd(void)
    uint dst = DX;
    uint res = dst - src;
 
-   FLAG_N = NFLAG_32(res);
-   FLAG_Z = MASK_OUT_ABOVE_32(res);
-   FLAG_V = VFLAG_SUB_32(src, dst, res);
-   FLAG_C = CFLAG_SUB_32(src, dst, res);
+   m68ki_set_nzvc_sub_32(src, dst, res);
 }
 
 
@@ -11069,10 +11156,7 @@ void m68k_op_cmp_32_di(void)
    uint dst = DX;
    uint res = dst - src;
 
-   FLAG_N = NFLAG_32(res);
-   FLAG_Z = MASK_OUT_ABOVE_32(res);
-   FLAG_V = VFLAG_SUB_32(src, dst, res);
-   FLAG_C = CFLAG_SUB_32(src, dst, res);
+   m68ki_set_nzvc_sub_32(src, dst, res);
 }
 
 
@@ -11082,10 +11166,7 @@ void m68k_op_cmp_32_ix(void)
    uint dst = DX;
    uint res = dst - src;
 
-   FLAG_N = NFLAG_32(res);
-   FLAG_Z = MASK_OUT_ABOVE_32(res);
-   FLAG_V = VFLAG_SUB_32(src, dst, res);
-   FLAG_C = CFLAG_SUB_32(src, dst, res);
+   m68ki_set_nzvc_sub_32(src, dst, res);
 }
 
 
@@ -11095,10 +11176,7 @@ void m68k_op_cmp_32_aw(void)
    uint dst = DX;
    uint res = dst - src;
 
-   FLAG_N = NFLAG_32(res);
-   FLAG_Z = MASK_OUT_ABOVE_32(res);
-   FLAG_V = VFLAG_SUB_32(src, dst, res);
-   FLAG_C = CFLAG_SUB_32(src, dst, res);
+   m68ki_set_nzvc_sub_32(src, dst, res);
 }
 
 
@@ -11108,10 +11186,7 @@ void m68k_op_cmp_32_al(void)
    uint dst = DX;
    uint res = dst - src;
 
-   FLAG_N = NFLAG_32(res);
-   FLAG_Z = MASK_OUT_ABOVE_32(res);
-   FLAG_V = VFLAG_SUB_32(src, dst, res);
-   FLAG_C = CFLAG_SUB_32(src, dst, res);
+   m68ki_set_nzvc_sub_32(src, dst, res);
 }
 
 
@@ -11121,10 +11196,7 @@ void m68k_op_cmp_32_pcdi(void)
    uint dst = DX;
    uint res = dst - src;
 
-   FLAG_N = NFLAG_32(res);
-   FLAG_Z = MASK_OUT_ABOVE_32(res);
-   FLAG_V = VFLAG_SUB_32(src, dst, res);
-   FLAG_C = CFLAG_SUB_32(src, dst, res);
+   m68ki_set_nzvc_sub_32(src, dst, res);
 }
 
 
@@ -11134,10 +11206,7 @@ void m68k_op_cmp_32_pcix(void)
    uint dst = DX;
    uint res = dst - src;
 
-   FLAG_N = NFLAG_32(res);
-   FLAG_Z = MASK_OUT_ABOVE_32(res);
-   FLAG_V = VFLAG_SUB_32(src, dst, res);
-   FLAG_C = CFLAG_SUB_32(src, dst, res);
+   m68ki_set_nzvc_sub_32(src, dst, res);
 }
 
 
@@ -11147,10 +11216,7 @@ void m68k_op_cmp_32_i(void)
    uint dst = DX;
    uint res = dst - src;
 
-   FLAG_N = NFLAG_32(res);
-   FLAG_Z = MASK_OUT_ABOVE_32(res);
-   FLAG_V = VFLAG_SUB_32(src, dst, res);
-   FLAG_C = CFLAG_SUB_32(src, dst, res);
+   m68ki_set_nzvc_sub_32(src, dst, res);
 }
 
 
@@ -11160,10 +11226,7 @@ void m68k_op_cmpa_16_d(void)
    uint dst = AX;
    uint res = dst - src;
 
-   FLAG_N = NFLAG_32(res);
-   FLAG_Z = MASK_OUT_ABOVE_32(res);
-   FLAG_V = VFLAG_SUB_32(src, dst, res);
-   FLAG_C = CFLAG_SUB_32(src, dst, res);
+   m68ki_set_nzvc_sub_32(src, dst, res);
 }
 
 
@@ -11173,10 +11236,7 @@ void m68k_op_cmpa_16_a(void)
    uint dst = AX;
    uint res = dst - src;
 
-   FLAG_N = NFLAG_32(res);
-   FLAG_Z = MASK_OUT_ABOVE_32(res);
-   FLAG_V = VFLAG_SUB_32(src, dst, res);
-   FLAG_C = CFLAG_SUB_32(src, dst, res);
+   m68ki_set_nzvc_sub_32(src, dst, res);
 }
 
 
@@ -11186,10 +11246,7 @@ void m68k_op_cmpa_16_ai(void)
    uint dst = AX;
    uint res = dst - src;
 
-   FLAG_N = NFLAG_32(res);
-   FLAG_Z = MASK_OUT_ABOVE_32(res);
-   FLAG_V = VFLAG_SUB_32(src, dst, res);
-   FLAG_C = CFLAG_SUB_32(src, dst, res);
+   m68ki_set_nzvc_sub_32(src, dst, res);
 }
 
 
@@ -11199,10 +11256,7 @@ void m68k_op_cmpa_16_pi(void)
    uint dst = AX;
    uint res = dst - src;
 
-   FLAG_N = NFLAG_32(res);
-   FLAG_Z = MASK_OUT_ABOVE_32(res);
-   FLAG_V = VFLAG_SUB_32(src, dst, res);
-   FLAG_C = CFLAG_SUB_32(src, dst, res);
+   m68ki_set_nzvc_sub_32(src, dst, res);
 }
 
 
@@ -11212,10 +11266,7 @@ void m68k_op_cmpa_16_pd(void)
    uint dst = AX;
    uint res = dst - src;
 
-   FLAG_N = NFLAG_32(res);
-   FLAG_Z = MASK_OUT_ABOVE_32(res);
-   FLAG_V = VFLAG_SUB_32(src, dst, res);
-   FLAG_C = CFLAG_SUB_32(src, dst, res);
+   m68ki_set_nzvc_sub_32(src, dst, res);
 }
 
 
@@ -11225,10 +11276,7 @@ void m68k_op_cmpa_16_di(void)
    uint dst = AX;
    uint res = dst - src;
 
-   FLAG_N = NFLAG_32(res);
-   FLAG_Z = MASK_OUT_ABOVE_32(res);
-   FLAG_V = VFLAG_SUB_32(src, dst, res);
-   FLAG_C = CFLAG_SUB_32(src, dst, res);
+   m68ki_set_nzvc_sub_32(src, dst, res);
 }
 
 
@@ -11238,10 +11286,7 @@ void m68k_op_cmpa_16_ix(void)
    uint dst = AX;
    uint res = dst - src;
 
-   FLAG_N = NFLAG_32(res);
-   FLAG_Z = MASK_OUT_ABOVE_32(res);
-   FLAG_V = VFLAG_SUB_32(src, dst, res);
-   FLAG_C = CFLAG_SUB_32(src, dst, res);
+   m68ki_set_nzvc_sub_32(src, dst, res);
 }
 
 
@@ -11251,10 +11296,7 @@ void m68k_op_cmpa_16_aw(void)
    uint dst = AX;
    uint res = dst - src;
 
-   FLAG_N = NFLAG_32(res);
-   FLAG_Z = MASK_OUT_ABOVE_32(res);
-   FLAG_V = VFLAG_SUB_32(src, dst, res);
-   FLAG_C = CFLAG_SUB_32(src, dst, res);
+   m68ki_set_nzvc_sub_32(src, dst, res);
 }
 
 
@@ -11264,10 +11306,7 @@ void m68k_op_cmpa_16_al(void)
    uint dst = AX;
    uint res = dst - src;
 
-   FLAG_N = NFLAG_32(res);
-   FLAG_Z = MASK_OUT_ABOVE_32(res);
-   FLAG_V = VFLAG_SUB_32(src, dst, res);
-   FLAG_C = CFLAG_SUB_32(src, dst, res);
+   m68ki_set_nzvc_sub_32(src, dst, res);
 }
 
 
@@ -11277,10 +11316,7 @@ void m68k_op_cmpa_16_pcdi(void)
    uint dst = AX;
    uint res = dst - src;
 
-   FLAG_N = NFLAG_32(res);
-   FLAG_Z = MASK_OUT_ABOVE_32(res);
-   FLAG_V = VFLAG_SUB_32(src, dst, res);
-   FLAG_C = CFLAG_SUB_32(src, dst, res);
+   m68ki_set_nzvc_sub_32(src, dst, res);
 }
 
 
@@ -11290,10 +11326,7 @@ void m68k_op_cmpa_16_pcix(void)
    uint dst = AX;
    uint res = dst - src;
 
-   FLAG_N = NFLAG_32(res);
-   FLAG_Z = MASK_OUT_ABOVE_32(res);
-   FLAG_V = VFLAG_SUB_32(src, dst, res);
-   FLAG_C = CFLAG_SUB_32(src, dst, res);
+   m68ki_set_nzvc_sub_32(src, dst, res);
 }
 
 
@@ -11303,10 +11336,7 @@ void m68k_op_cmpa_16_i(void)
    uint dst = AX;
    uint res = dst - src;
 
-   FLAG_N = NFLAG_32(res);
-   FLAG_Z = MASK_OUT_ABOVE_32(res);
-   FLAG_V = VFLAG_SUB_32(src, dst, res);
-   FLAG_C = CFLAG_SUB_32(src, dst, res);
+   m68ki_set_nzvc_sub_32(src, dst, res);
 }
 
 
@@ -11316,10 +11346,7 @@ void m68k_op_cmpa_32_d(void)
    uint dst = AX;
    uint res = dst - src;
 
-   FLAG_N = NFLAG_32(res);
-   FLAG_Z = MASK_OUT_ABOVE_32(res);
-   FLAG_V = VFLAG_SUB_32(src, dst, res);
-   FLAG_C = CFLAG_SUB_32(src, dst, res);
+   m68ki_set_nzvc_sub_32(src, dst, res);
 }
 
 
@@ -11329,10 +11356,7 @@ void m68k_op_cmpa_32_a(void)
    uint dst = AX;
    uint res = dst - src;
 
-   FLAG_N = NFLAG_32(res);
-   FLAG_Z = MASK_OUT_ABOVE_32(res);
-   FLAG_V = VFLAG_SUB_32(src, dst, res);
-   FLAG_C = CFLAG_SUB_32(src, dst, res);
+   m68ki_set_nzvc_sub_32(src, dst, res);
 }
 
 
@@ -11342,10 +11366,7 @@ void m68k_op_cmpa_32_ai(void)
    uint dst = AX;
    uint res = dst - src;
 
-   FLAG_N = NFLAG_32(res);
-   FLAG_Z = MASK_OUT_ABOVE_32(res);
-   FLAG_V = VFLAG_SUB_32(src, dst, res);
-   FLAG_C = CFLAG_SUB_32(src, dst, res);
+   m68ki_set_nzvc_sub_32(src, dst, res);
 }
 
 
@@ -11355,10 +11376,7 @@ void m68k_op_cmpa_32_pi(void)
    uint dst = AX;
    uint res = dst - src;
 
-   FLAG_N = NFLAG_32(res);
-   FLAG_Z = MASK_OUT_ABOVE_32(res);
-   FLAG_V = VFLAG_SUB_32(src, dst, res);
-   FLAG_C = CFLAG_SUB_32(src, dst, res);
+   m68ki_set_nzvc_sub_32(src, dst, res);
 }
 
 
@@ -11368,10 +11386,7 @@ void m68k_op_cmpa_32_pd(void)
    uint dst = AX;
    uint res = dst - src;
 
-   FLAG_N = NFLAG_32(res);
-   FLAG_Z = MASK_OUT_ABOVE_32(res);
-   FLAG_V = VFLAG_SUB_32(src, dst, res);
-   FLAG_C = CFLAG_SUB_32(src, dst, res);
+   m68ki_set_nzvc_sub_32(src, dst, res);
 }
 
 
@@ -11381,10 +11396,7 @@ void m68k_op_cmpa_32_di(void)
    uint dst = AX;
    uint res = dst - src;
 
-   FLAG_N = NFLAG_32(res);
-   FLAG_Z = MASK_OUT_ABOVE_32(res);
-   FLAG_V = VFLAG_SUB_32(src, dst, res);
-   FLAG_C = CFLAG_SUB_32(src, dst, res);
+   m68ki_set_nzvc_sub_32(src, dst, res);
 }
 
 
@@ -11394,10 +11406,7 @@ void m68k_op_cmpa_32_ix(void)
    uint dst = AX;
    uint res = dst - src;
 
-   FLAG_N = NFLAG_32(res);
-   FLAG_Z = MASK_OUT_ABOVE_32(res);
-   FLAG_V = VFLAG_SUB_32(src, dst, res);
-   FLAG_C = CFLAG_SUB_32(src, dst, res);
+   m68ki_set_nzvc_sub_32(src, dst, res);
 }
 
 
@@ -11407,10 +11416,7 @@ void m68k_op_cmpa_32_aw(void)
    uint dst = AX;
    uint res = dst - src;
 
-   FLAG_N = NFLAG_32(res);
-   FLAG_Z = MASK_OUT_ABOVE_32(res);
-   FLAG_V = VFLAG_SUB_32(src, dst, res);
-   FLAG_C = CFLAG_SUB_32(src, dst, res);
+   m68ki_set_nzvc_sub_32(src, dst, res);
 }
 
 
@@ -11420,10 +11426,7 @@ void m68k_op_cmpa_32_al(void)
    uint dst = AX;
    uint res = dst - src;
 
-   FLAG_N = NFLAG_32(res);
-   FLAG_Z = MASK_OUT_ABOVE_32(res);
-   FLAG_V = VFLAG_SUB_32(src, dst, res);
-   FLAG_C = CFLAG_SUB_32(src, dst, res);
+   m68ki_set_nzvc_sub_32(src, dst, res);
 }
 
 
@@ -11433,10 +11436,7 @@ void m68k_op_cmpa_32_pcdi(void)
    uint dst = AX;
    uint res = dst - src;
 
-   FLAG_N = NFLAG_32(res);
-   FLAG_Z = MASK_OUT_ABOVE_32(res);
-   FLAG_V = VFLAG_SUB_32(src, dst, res);
-   FLAG_C = CFLAG_SUB_32(src, dst, res);
+   m68ki_set_nzvc_sub_32(src, dst, res);
 }
 
 
@@ -11446,10 +11446,7 @@ void m68k_op_cmpa_32_pcix(void)
    uint dst = AX;
    uint res = dst - src;
 
-   FLAG_N = NFLAG_32(res);
-   FLAG_Z = MASK_OUT_ABOVE_32(res);
-   FLAG_V = VFLAG_SUB_32(src, dst, res);
-   FLAG_C = CFLAG_SUB_32(src, dst, res);
+   m68ki_set_nzvc_sub_32(src, dst, res);
 }
 
 
@@ -11459,10 +11456,7 @@ void m68k_op_cmpa_32_i(void)
    uint dst = AX;
    uint res = dst - src;
 
-   FLAG_N = NFLAG_32(res);
-   FLAG_Z = MASK_OUT_ABOVE_32(res);
-   FLAG_V = VFLAG_SUB_32(src, dst, res);
-   FLAG_C = CFLAG_SUB_32(src, dst, res);
+   m68ki_set_nzvc_sub_32(src, dst, res);
 }
 
 
@@ -11472,10 +11466,7 @@ void m68k_op_cmpi_8_d(void)
    uint dst = MASK_OUT_ABOVE_8(DY);
    uint res = dst - src;
 
-   FLAG_N = NFLAG_8(res);
-   FLAG_Z = MASK_OUT_ABOVE_8(res);
-   FLAG_V = VFLAG_SUB_8(src, dst, res);
-   FLAG_C = CFLAG_8(res);
+   m68ki_set_nzvc_sub_8(src, dst, res);
 }
 
 
@@ -11485,10 +11476,7 @@ void m68k_op_cmpi_8_ai(void)
    uint dst = OPER_AY_AI_8();
    uint res = dst - src;
 
-   FLAG_N = NFLAG_8(res);
-   FLAG_Z = MASK_OUT_ABOVE_8(res);
-   FLAG_V = VFLAG_SUB_8(src, dst, res);
-   FLAG_C = CFLAG_8(res);
+   m68ki_set_nzvc_sub_8(src, dst, res);
 }
 
 
@@ -11498,10 +11486,7 @@ void m68k_op_cmpi_8_pi(void)
    uint dst = OPER_AY_PI_8();
    uint res = dst - src;
 
-   FLAG_N = NFLAG_8(res);
-   FLAG_Z = MASK_OUT_ABOVE_8(res);
-   FLAG_V = VFLAG_SUB_8(src, dst, res);
-   FLAG_C = CFLAG_8(res);
+   m68ki_set_nzvc_sub_8(src, dst, res);
 }
 
 
@@ -11511,10 +11496,7 @@ void m68k_op_cmpi_8_pi7(void)
    uint dst = OPER_A7_PI_8();
    uint res = dst - src;
 
-   FLAG_N = NFLAG_8(res);
-   FLAG_Z = MASK_OUT_ABOVE_8(res);
-   FLAG_V = VFLAG_SUB_8(src, dst, res);
-   FLAG_C = CFLAG_8(res);
+   m68ki_set_nzvc_sub_8(src, dst, res);
 }
 
 
@@ -11524,10 +11506,7 @@ void m68k_op_cmpi_8_pd(void)
    uint dst = OPER_AY_PD_8();
    uint res = dst - src;
 
-   FLAG_N = NFLAG_8(res);
-   FLAG_Z = MASK_OUT_ABOVE_8(res);
-   FLAG_V = VFLAG_SUB_8(src, dst, res);
-   FLAG_C = CFLAG_8(res);
+   m68ki_set_nzvc_sub_8(src, dst, res);
 }
 
 
@@ -11537,10 +11516,7 @@ void m68k_op_cmpi_8_pd7(void)
    uint dst = OPER_A7_PD_8();
    uint res = dst - src;
 
-   FLAG_N = NFLAG_8(res);
-   FLAG_Z = MASK_OUT_ABOVE_8(res);
-   FLAG_V = VFLAG_SUB_8(src, dst, res);
-   FLAG_C = CFLAG_8(res);
+   m68ki_set_nzvc_sub_8(src, dst, res);
 }
 
 
@@ -11550,10 +11526,7 @@ void m68k_op_cmpi_8_di(void)
    uint dst = OPER_AY_DI_8();
    uint res = dst - src;
 
-   FLAG_N = NFLAG_8(res);
-   FLAG_Z = MASK_OUT_ABOVE_8(res);
-   FLAG_V = VFLAG_SUB_8(src, dst, res);
-   FLAG_C = CFLAG_8(res);
+   m68ki_set_nzvc_sub_8(src, dst, res);
 }
 
 
@@ -11563,10 +11536,7 @@ void m68k_op_cmpi_8_ix(void)
    uint dst = OPER_AY_IX_8();
    uint res = dst - src;
 
-   FLAG_N = NFLAG_8(res);
-   FLAG_Z = MASK_OUT_ABOVE_8(res);
-   FLAG_V = VFLAG_SUB_8(src, dst, res);
-   FLAG_C = CFLAG_8(res);
+   m68ki_set_nzvc_sub_8(src, dst, res);
 }
 
 
@@ -11576,10 +11546,7 @@ void m68k_op_cmpi_8_aw(void)
    uint dst = OPER_AW_8();
    uint res = dst - src;
 
-   FLAG_N = NFLAG_8(res);
-   FLAG_Z = MASK_OUT_ABOVE_8(res);
-   FLAG_V = VFLAG_SUB_8(src, dst, res);
-   FLAG_C = CFLAG_8(res);
+   m68ki_set_nzvc_sub_8(src, dst, res);
 }
 
 
@@ -11589,10 +11556,7 @@ void m68k_op_cmpi_8_al(void)
    uint dst = OPER_AL_8();
    uint res = dst - src;
 
-   FLAG_N = NFLAG_8(res);
-   FLAG_Z = MASK_OUT_ABOVE_8(res);
-   FLAG_V = VFLAG_SUB_8(src, dst, res);
-   FLAG_C = CFLAG_8(res);
+   m68ki_set_nzvc_sub_8(src, dst, res);
 }
 
 
@@ -11604,10 +11568,7 @@ void m68k_op_cmpi_8_pcdi(void)
       uint dst = OPER_PCDI_8();
       uint res = dst - src;
 
-      FLAG_N = NFLAG_8(res);
-      FLAG_Z = MASK_OUT_ABOVE_8(res);
-      FLAG_V = VFLAG_SUB_8(src, dst, res);
-      FLAG_C = CFLAG_8(res);
+      m68ki_set_nzvc_sub_8(src, dst, res);
       return;
    }
    m68ki_exception_illegal();
@@ -11622,10 +11583,7 @@ void m68k_op_cmpi_8_pcix(void)
       uint dst = OPER_PCIX_8();
       uint res = dst - src;
 
-      FLAG_N = NFLAG_8(res);
-      FLAG_Z = MASK_OUT_ABOVE_8(res);
-      FLAG_V = VFLAG_SUB_8(src, dst, res);
-      FLAG_C = CFLAG_8(res);
+      m68ki_set_nzvc_sub_8(src, dst, res);
       return;
    }
    m68ki_exception_illegal();
@@ -11638,10 +11596,7 @@ void m68k_op_cmpi_16_d(void)
    uint dst = MASK_OUT_ABOVE_16(DY);
    uint res = dst - src;
 
-   FLAG_N = NFLAG_16(res);
-   FLAG_Z = MASK_OUT_ABOVE_16(res);
-   FLAG_V = VFLAG_SUB_16(src, dst, res);
-   FLAG_C = CFLAG_16(res);
+   m68ki_set_nzvc_sub_16(src, dst, res);
 }
 
 
@@ -11651,10 +11606,7 @@ void m68k_op_cmpi_16_ai(void)
    uint dst = OPER_AY_AI_16();
    uint res = dst - src;
 
-   FLAG_N = NFLAG_16(res);
-   FLAG_Z = MASK_OUT_ABOVE_16(res);
-   FLAG_V = VFLAG_SUB_16(src, dst, res);
-   FLAG_C = CFLAG_16(res);
+   m68ki_set_nzvc_sub_16(src, dst, res);
 }
 
 
@@ -11664,10 +11616,7 @@ void m68k_op_cmpi_16_pi(void)
    uint dst = OPER_AY_PI_16();
    uint res = dst - src;
 
-   FLAG_N = NFLAG_16(res);
-   FLAG_Z = MASK_OUT_ABOVE_16(res);
-   FLAG_V = VFLAG_SUB_16(src, dst, res);
-   FLAG_C = CFLAG_16(res);
+   m68ki_set_nzvc_sub_16(src, dst, res);
 }
 
 
@@ -11677,10 +11626,7 @@ void m68k_op_cmpi_16_pd(void)
    uint dst = OPER_AY_PD_16();
    uint res = dst - src;
 
-   FLAG_N = NFLAG_16(res);
-   FLAG_Z = MASK_OUT_ABOVE_16(res);
-   FLAG_V = VFLAG_SUB_16(src, dst, res);
-   FLAG_C = CFLAG_16(res);
+   m68ki_set_nzvc_sub_16(src, dst, res);
 }
 
 
@@ -11690,10 +11636,7 @@ void m68k_op_cmpi_16_di(void)
    uint dst = OPER_AY_DI_16();
    uint res = dst - src;
 
-   FLAG_N = NFLAG_16(res);
-   FLAG_Z = MASK_OUT_ABOVE_16(res);
-   FLAG_V = VFLAG_SUB_16(src, dst, res);
-   FLAG_C = CFLAG_16(res);
+   m68ki_set_nzvc_sub_16(src, dst, res);
 }
 
 
@@ -11703,10 +11646,7 @@ void m68k_op_cmpi_16_ix(void)
    uint dst = OPER_AY_IX_16();
    uint res = dst - src;
 
-   FLAG_N = NFLAG_16(res);
-   FLAG_Z = MASK_OUT_ABOVE_16(res);
-   FLAG_V = VFLAG_SUB_16(src, dst, res);
-   FLAG_C = CFLAG_16(res);
+   m68ki_set_nzvc_sub_16(src, dst, res);
 }
 
 
@@ -11716,10 +11656,7 @@ void m68k_op_cmpi_16_aw(void)
    uint dst = OPER_AW_16();
    uint res = dst - src;
 
-   FLAG_N = NFLAG_16(res);
-   FLAG_Z = MASK_OUT_ABOVE_16(res);
-   FLAG_V = VFLAG_SUB_16(src, dst, res);
-   FLAG_C = CFLAG_16(res);
+   m68ki_set_nzvc_sub_16(src, dst, res);
 }
 
 
@@ -11729,10 +11666,7 @@ void m68k_op_cmpi_16_al(void)
    uint dst = OPER_AL_16();
    uint res = dst - src;
 
-   FLAG_N = NFLAG_16(res);
-   FLAG_Z = MASK_OUT_ABOVE_16(res);
-   FLAG_V = VFLAG_SUB_16(src, dst, res);
-   FLAG_C = CFLAG_16(res);
+   m68ki_set_nzvc_sub_16(src, dst, res);
 }
 
 
@@ -11744,10 +11678,7 @@ void m68k_op_cmpi_16_pcdi(void)
       uint dst = OPER_PCDI_16();
       uint res = dst - src;
 
-      FLAG_N = NFLAG_16(res);
-      FLAG_Z = MASK_OUT_ABOVE_16(res);
-      FLAG_V = VFLAG_SUB_16(src, dst, res);
-      FLAG_C = CFLAG_16(res);
+      m68ki_set_nzvc_sub_16(src, dst, res);
       return;
    }
    m68ki_exception_illegal();
@@ -11762,10 +11693,7 @@ void m68k_op_cmpi_16_pcix(void)
       uint dst = OPER_PCIX_16();
       uint res = dst - src;
 
-      FLAG_N = NFLAG_16(res);
-      FLAG_Z = MASK_OUT_ABOVE_16(res);
-      FLAG_V = VFLAG_SUB_16(src, dst, res);
-      FLAG_C = CFLAG_16(res);
+      m68ki_set_nzvc_sub_16(src, dst, res);
       return;
    }
    m68ki_exception_illegal();
@@ -11778,10 +11706,7 @@ void m68k_op_cmpi_32_d(void)
    uint dst = DY;
    uint res = dst - src;
 
-   FLAG_N = NFLAG_32(res);
-   FLAG_Z = MASK_OUT_ABOVE_32(res);
-   FLAG_V = VFLAG_SUB_32(src, dst, res);
-   FLAG_C = CFLAG_SUB_32(src, dst, res);
+   m68ki_set_nzvc_sub_32(src, dst, res);
 }
 
 
@@ -11791,10 +11716,7 @@ void m68k_op_cmpi_32_ai(void)
    uint dst = OPER_AY_AI_32();
    uint res = dst - src;
 
-   FLAG_N = NFLAG_32(res);
-   FLAG_Z = MASK_OUT_ABOVE_32(res);
-   FLAG_V = VFLAG_SUB_32(src, dst, res);
-   FLAG_C = CFLAG_SUB_32(src, dst, res);
+   m68ki_set_nzvc_sub_32(src, dst, res);
 }
 
 
@@ -11804,10 +11726,7 @@ void m68k_op_cmpi_32_pi(void)
    uint dst = OPER_AY_PI_32();
    uint res = dst - src;
 
-   FLAG_N = NFLAG_32(res);
-   FLAG_Z = MASK_OUT_ABOVE_32(res);
-   FLAG_V = VFLAG_SUB_32(src, dst, res);
-   FLAG_C = CFLAG_SUB_32(src, dst, res);
+   m68ki_set_nzvc_sub_32(src, dst, res);
 }
 
 
@@ -11817,10 +11736,7 @@ void m68k_op_cmpi_32_pd(void)
    uint dst = OPER_AY_PD_32();
    uint res = dst - src;
 
-   FLAG_N = NFLAG_32(res);
-   FLAG_Z = MASK_OUT_ABOVE_32(res);
-   FLAG_V = VFLAG_SUB_32(src, dst, res);
-   FLAG_C = CFLAG_SUB_32(src, dst, res);
+   m68ki_set_nzvc_sub_32(src, dst, res);
 }
 
 
@@ -11830,10 +11746,7 @@ void m68k_op_cmpi_32_di(void)
    uint dst = OPER_AY_DI_32();
    uint res = dst - src;
 
-   FLAG_N = NFLAG_32(res);
-   FLAG_Z = MASK_OUT_ABOVE_32(res);
-   FLAG_V = VFLAG_SUB_32(src, dst, res);
-   FLAG_C = CFLAG_SUB_32(src, dst, res);
+   m68ki_set_nzvc_sub_32(src, dst, res);
 }
 
 
@@ -11843,10 +11756,7 @@ void m68k_op_cmpi_32_ix(void)
    uint dst = OPER_AY_IX_32();
    uint res = dst - src;
 
-   FLAG_N = NFLAG_32(res);
-   FLAG_Z = MASK_OUT_ABOVE_32(res);
-   FLAG_V = VFLAG_SUB_32(src, dst, res);
-   FLAG_C = CFLAG_SUB_32(src, dst, res);
+   m68ki_set_nzvc_sub_32(src, dst, res);
 }
 
 
@@ -11856,10 +11766,7 @@ void m68k_op_cmpi_32_aw(void)
    uint dst = OPER_AW_32();
    uint res = dst - src;
 
-   FLAG_N = NFLAG_32(res);
-   FLAG_Z = MASK_OUT_ABOVE_32(res);
-   FLAG_V = VFLAG_SUB_32(src, dst, res);
-   FLAG_C = CFLAG_SUB_32(src, dst, res);
+   m68ki_set_nzvc_sub_32(src, dst, res);
 }
 
 
@@ -11869,10 +11776,7 @@ void m68k_op_cmpi_32_al(void)
    uint dst = OPER_AL_32();
    uint res = dst - src;
 
-   FLAG_N = NFLAG_32(res);
-   FLAG_Z = MASK_OUT_ABOVE_32(res);
-   FLAG_V = VFLAG_SUB_32(src, dst, res);
-   FLAG_C = CFLAG_SUB_32(src, dst, res);
+   m68ki_set_nzvc_sub_32(src, dst, res);
 }
 
 
@@ -11884,10 +11788,7 @@ void m68k_op_cmpi_32_pcdi(void)
       uint dst = OPER_PCDI_32();
       uint res = dst - src;
 
-      FLAG_N = NFLAG_32(res);
-      FLAG_Z = MASK_OUT_ABOVE_32(res);
-      FLAG_V = VFLAG_SUB_32(src, dst, res);
-      FLAG_C = CFLAG_SUB_32(src, dst, res);
+      m68ki_set_nzvc_sub_32(src, dst, res);
       return;
    }
    m68ki_exception_illegal();
@@ -11902,10 +11803,7 @@ void m68k_op_cmpi_32_pcix(void)
       uint dst = OPER_PCIX_32();
       uint res = dst - src;
 
-      FLAG_N = NFLAG_32(res);
-      FLAG_Z = MASK_OUT_ABOVE_32(res);
-      FLAG_V = VFLAG_SUB_32(src, dst, res);
-      FLAG_C = CFLAG_SUB_32(src, dst, res);
+      m68ki_set_nzvc_sub_32(src, dst, res);
       return;
    }
    m68ki_exception_illegal();
@@ -11918,10 +11816,7 @@ void m68k_op_cmpm_8_ax7(void)
    uint dst = OPER_A7_PI_8();
    uint res = dst - src;
 
-   FLAG_N = NFLAG_8(res);
-   FLAG_Z = MASK_OUT_ABOVE_8(res);
-   FLAG_V = VFLAG_SUB_8(src, dst, res);
-   FLAG_C = CFLAG_8(res);
+   m68ki_set_nzvc_sub_8(src, dst, res);
 }
 
 
@@ -11931,10 +11826,7 @@ void m68k_op_cmpm_8_ay7(void)
    uint dst = OPER_AX_PI_8();
    uint res = dst - src;
 
-   FLAG_N = NFLAG_8(res);
-   FLAG_Z = MASK_OUT_ABOVE_8(res);
-   FLAG_V = VFLAG_SUB_8(src, dst, res);
-   FLAG_C = CFLAG_8(res);
+   m68ki_set_nzvc_sub_8(src, dst, res);
 }
 
 
@@ -11944,10 +11836,7 @@ void m68k_op_cmpm_8_axy7(void)
    uint dst = OPER_A7_PI_8();
    uint res = dst - src;
 
-   FLAG_N = NFLAG_8(res);
-   FLAG_Z = MASK_OUT_ABOVE_8(res);
-   FLAG_V = VFLAG_SUB_8(src, dst, res);
-   FLAG_C = CFLAG_8(res);
+   m68ki_set_nzvc_sub_8(src, dst, res);
 }
 
 
@@ -11957,6 +11846,7 @@ void m68k_op_cmpm_8(void)
    uint dst = OPER_AX_PI_8();
    uint res = dst - src;
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_8(res);
    FLAG_Z = MASK_OUT_ABOVE_8(res);
    FLAG_V = VFLAG_SUB_8(src, dst, res);
@@ -11970,6 +11860,7 @@ void m68k_op_cmpm_16(void)
    uint dst = OPER_AX_PI_16();
    uint res = dst - src;
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_16(res);
    FLAG_Z = MASK_OUT_ABOVE_16(res);
    FLAG_V = VFLAG_SUB_16(src, dst, res);
@@ -11983,6 +11874,7 @@ void m68k_op_cmpm_32(void)
    uint dst = OPER_AX_PI_32();
    uint res = dst - src;
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_32(res);
    FLAG_Z = MASK_OUT_ABOVE_32(res);
    FLAG_V = VFLAG_SUB_32(src, dst, res);
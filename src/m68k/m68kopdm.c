@@ -24,6 +24,8 @@ void m68k_op_dbf_16(void)
       m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
       m68ki_branch_16(offset);
       USE_CYCLES(CYC_DBCC_F_NOEXP);
+      if(offset == 0xfffc)
+         m68ki_bulk_move_loop(r_dst); /* auto-disable (see m68kcpu.h) */
       return;
    }
    REG_PC += 2;
@@ -33,6 +35,7 @@ void m68k_op_dbf_16(void)
 
 void m68k_op_dbhi_16(void)
 {
+   m68ki_resolve_flags();
    if(COND_NOT_HI())
    {
       uint* r_dst = &DY;
@@ -58,6 +61,7 @@ void m68k_op_dbhi_16(void)
 
 void m68k_op_dbls_16(void)
 {
+   m68ki_resolve_flags();
    if(COND_NOT_LS())
    {
       uint* r_dst = &DY;
@@ -83,6 +87,7 @@ void m68k_op_dbls_16(void)
 
 void m68k_op_dbcc_16(void)
 {
+   m68ki_resolve_flags();
    if(COND_NOT_CC())
    {
       uint* r_dst = &DY;
@@ -108,6 +113,7 @@ void m68k_op_dbcc_16(void)
 
 void m68k_op_dbcs_16(void)
 {
+   m68ki_resolve_flags();
    if(COND_NOT_CS())
    {
       uint* r_dst = &DY;
@@ -133,6 +139,7 @@ void m68k_op_dbcs_16(void)
 
 void m68k_op_dbne_16(void)
 {
+   m68ki_resolve_flags();
    if(COND_NOT_NE())
    {
       uint* r_dst = &DY;
@@ -158,6 +165,7 @@ void m68k_op_dbne_16(void)
 
 void m68k_op_dbeq_16(void)
 {
+   m68ki_resolve_flags();
    if(COND_NOT_EQ())
    {
       uint* r_dst = &DY;
@@ -183,6 +191,7 @@ void m68k_op_dbeq_16(void)
 
 void m68k_op_dbvc_16(void)
 {
+   m68ki_resolve_flags();
    if(COND_NOT_VC())
    {
       uint* r_dst = &DY;
@@ -208,6 +217,7 @@ void m68k_op_dbvc_16(void)
 
 void m68k_op_dbvs_16(void)
 {
+   m68ki_resolve_flags();
    if(COND_NOT_VS())
    {
       uint* r_dst = &DY;
@@ -233,6 +243,7 @@ void m68k_op_dbvs_16(void)
 
 void m68k_op_dbpl_16(void)
 {
+   m68ki_resolve_flags();
    if(COND_NOT_PL())
    {
       uint* r_dst = &DY;
@@ -258,6 +269,7 @@ void m68k_op_dbpl_16(void)
 
 void m68k_op_dbmi_16(void)
 {
+   m68ki_resolve_flags();
    if(COND_NOT_MI())
    {
       uint* r_dst = &DY;
@@ -283,6 +295,7 @@ void m68k_op_dbmi_16(void)
 
 void m68k_op_dbge_16(void)
 {
+   m68ki_resolve_flags();
    if(COND_NOT_GE())
    {
       uint* r_dst = &DY;
@@ -308,6 +321,7 @@ void m68k_op_dbge_16(void)
 
 void m68k_op_dblt_16(void)
 {
+   m68ki_resolve_flags();
    if(COND_NOT_LT())
    {
       uint* r_dst = &DY;
@@ -333,6 +347,7 @@ void m68k_op_dblt_16(void)
 
 void m68k_op_dbgt_16(void)
 {
+   m68ki_resolve_flags();
    if(COND_NOT_GT())
    {
       uint* r_dst = &DY;
@@ -358,6 +373,7 @@ void m68k_op_dbgt_16(void)
 
 void m68k_op_dble_16(void)
 {
+   m68ki_resolve_flags();
    if(COND_NOT_LE())
    {
       uint* r_dst = &DY;
@@ -388,6 +404,8 @@ void m68k_op_divs_16_d(void)
    sint quotient;
    sint remainder;
 
+   m68ki_resolve_flags();
+
    if(src != 0)
    {
       if((uint32)*r_dst == 0x80000000 && src == -1)
@@ -426,6 +444,8 @@ void m68k_op_divs_16_ai(void)
    sint quotient;
    sint remainder;
 
+   m68ki_resolve_flags();
+
    if(src != 0)
    {
       if((uint32)*r_dst == 0x80000000 && src == -1)
@@ -464,6 +484,8 @@ void m68k_op_divs_16_pi(void)
    sint quotient;
    sint remainder;
 
+   m68ki_resolve_flags();
+
    if(src != 0)
    {
       if((uint32)*r_dst == 0x80000000 && src == -1)
@@ -502,6 +524,8 @@ void m68k_op_divs_16_pd(void)
    sint quotient;
    sint remainder;
 
+   m68ki_resolve_flags();
+
    if(src != 0)
    {
       if((uint32)*r_dst == 0x80000000 && src == -1)
@@ -540,6 +564,8 @@ void m68k_op_divs_16_di(void)
    sint quotient;
    sint remainder;
 
+   m68ki_resolve_flags();
+
    if(src != 0)
    {
       if((uint32)*r_dst == 0x80000000 && src == -1)
@@ -578,6 +604,8 @@ void m68k_op_divs_16_ix(void)
    sint quotient;
    sint remainder;
 
+   m68ki_resolve_flags();
+
    if(src != 0)
    {
       if((uint32)*r_dst == 0x80000000 && src == -1)
@@ -616,6 +644,8 @@ void m68k_op_divs_16_aw(void)
    sint quotient;
    sint remainder;
 
+   m68ki_resolve_flags();
+
    if(src != 0)
    {
       if((uint32)*r_dst == 0x80000000 && src == -1)
@@ -654,6 +684,8 @@ void m68k_op_divs_16_al(void)
    sint quotient;
    sint remainder;
 
+   m68ki_resolve_flags();
+
    if(src != 0)
    {
       if((uint32)*r_dst == 0x80000000 && src == -1)
@@ -692,6 +724,8 @@ void m68k_op_divs_16_pcdi(void)
    sint quotient;
    sint remainder;
 
+   m68ki_resolve_flags();
+
    if(src != 0)
    {
       if((uint32)*r_dst == 0x80000000 && src == -1)
@@ -730,6 +764,8 @@ void m68k_op_divs_16_pcix(void)
    sint quotient;
    sint remainder;
 
+   m68ki_resolve_flags();
+
    if(src != 0)
    {
       if((uint32)*r_dst == 0x80000000 && src == -1)
@@ -768,6 +804,8 @@ void m68k_op_divs_16_i(void)
    sint quotient;
    sint remainder;
 
+   m68ki_resolve_flags();
+
    if(src != 0)
    {
       if((uint32)*r_dst == 0x80000000 && src == -1)
@@ -804,6 +842,8 @@ void m68k_op_divu_16_d(void)
    uint* r_dst = &DX;
    uint src = MASK_OUT_ABOVE_16(DY);
 
+   m68ki_resolve_flags();
+
    if(src != 0)
    {
       uint quotient = *r_dst / src;
@@ -830,6 +870,8 @@ void m68k_op_divu_16_ai(void)
    uint* r_dst = &DX;
    uint src = OPER_AY_AI_16();
 
+   m68ki_resolve_flags();
+
    if(src != 0)
    {
       uint quotient = *r_dst / src;
@@ -856,6 +898,8 @@ void m68k_op_divu_16_pi(void)
    uint* r_dst = &DX;
    uint src = OPER_AY_PI_16();
 
+   m68ki_resolve_flags();
+
    if(src != 0)
    {
       uint quotient = *r_dst / src;
@@ -882,6 +926,8 @@ void m68k_op_divu_16_pd(void)
    uint* r_dst = &DX;
    uint src = OPER_AY_PD_16();
 
+   m68ki_resolve_flags();
+
    if(src != 0)
    {
       uint quotient = *r_dst / src;
@@ -908,6 +954,8 @@ void m68k_op_divu_16_di(void)
    uint* r_dst = &DX;
    uint src = OPER_AY_DI_16();
 
+   m68ki_resolve_flags();
+
    if(src != 0)
    {
       uint quotient = *r_dst / src;
@@ -934,6 +982,8 @@ void m68k_op_divu_16_ix(void)
    uint* r_dst = &DX;
    uint src = OPER_AY_IX_16();
 
+   m68ki_resolve_flags();
+
    if(src != 0)
    {
       uint quotient = *r_dst / src;
@@ -960,6 +1010,8 @@ void m68k_op_divu_16_aw(void)
    uint* r_dst = &DX;
    uint src = OPER_AW_16();
 
+   m68ki_resolve_flags();
+
    if(src != 0)
    {
       uint quotient = *r_dst / src;
@@ -986,6 +1038,8 @@ void m68k_op_divu_16_al(void)
    uint* r_dst = &DX;
    uint src = OPER_AL_16();
 
+   m68ki_resolve_flags();
+
    if(src != 0)
    {
       uint quotient = *r_dst / src;
@@ -1012,6 +1066,8 @@ void m68k_op_divu_16_pcdi(void)
    uint* r_dst = &DX;
    uint src = OPER_PCDI_16();
 
+   m68ki_resolve_flags();
+
    if(src != 0)
    {
       uint quotient = *r_dst / src;
@@ -1038,6 +1094,8 @@ void m68k_op_divu_16_pcix(void)
    uint* r_dst = &DX;
    uint src = OPER_PCIX_16();
 
+   m68ki_resolve_flags();
+
    if(src != 0)
    {
       uint quotient = *r_dst / src;
@@ -1064,6 +1122,8 @@ void m68k_op_divu_16_i(void)
    uint* r_dst = &DX;
    uint src = OPER_I_16();
 
+   m68ki_resolve_flags();
+
    if(src != 0)
    {
       uint quotient = *r_dst / src;
@@ -1087,6 +1147,7 @@ void m68k_op_divu_16_i(void)
 
 void m68k_op_divl_32_d(void)
 {
+   m68ki_resolve_flags();
 #if M68K_USE_64_BIT
 
    if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
@@ -1298,6 +1359,7 @@ void m68k_op_divl_32_d(void)
 
 void m68k_op_divl_32_ai(void)
 {
+   m68ki_resolve_flags();
 #if M68K_USE_64_BIT
 
    if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
@@ -1509,6 +1571,7 @@ void m68k_op_divl_32_ai(void)
 
 void m68k_op_divl_32_pi(void)
 {
+   m68ki_resolve_flags();
 #if M68K_USE_64_BIT
 
    if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
@@ -1720,6 +1783,7 @@ void m68k_op_divl_32_pi(void)
 
 void m68k_op_divl_32_pd(void)
 {
+   m68ki_resolve_flags();
 #if M68K_USE_64_BIT
 
    if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
@@ -1931,6 +1995,7 @@ void m68k_op_divl_32_pd(void)
 
 void m68k_op_divl_32_di(void)
 {
+   m68ki_resolve_flags();
 #if M68K_USE_64_BIT
 
    if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
@@ -2142,6 +2207,7 @@ void m68k_op_divl_32_di(void)
 
 void m68k_op_divl_32_ix(void)
 {
+   m68ki_resolve_flags();
 #if M68K_USE_64_BIT
 
    if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
@@ -2353,6 +2419,7 @@ void m68k_op_divl_32_ix(void)
 
 void m68k_op_divl_32_aw(void)
 {
+   m68ki_resolve_flags();
 #if M68K_USE_64_BIT
 
    if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
@@ -2564,6 +2631,7 @@ void m68k_op_divl_32_aw(void)
 
 void m68k_op_divl_32_al(void)
 {
+   m68ki_resolve_flags();
 #if M68K_USE_64_BIT
 
    if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
@@ -2775,6 +2843,7 @@ void m68k_op_divl_32_al(void)
 
 void m68k_op_divl_32_pcdi(void)
 {
+   m68ki_resolve_flags();
 #if M68K_USE_64_BIT
 
    if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
@@ -2986,6 +3055,7 @@ void m68k_op_divl_32_pcdi(void)
 
 void m68k_op_divl_32_pcix(void)
 {
+   m68ki_resolve_flags();
 #if M68K_USE_64_BIT
 
    if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
@@ -3197,6 +3267,7 @@ void m68k_op_divl_32_pcix(void)
 
 void m68k_op_divl_32_i(void)
 {
+   m68ki_resolve_flags();
 #if M68K_USE_64_BIT
 
    if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
@@ -3410,6 +3481,7 @@ void m68k_op_eor_8_d(void)
 {
    uint res = MASK_OUT_ABOVE_8(DY ^= MASK_OUT_ABOVE_8(DX));
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_8(res);
    FLAG_Z = res;
    FLAG_C = CFLAG_CLEAR;
@@ -3424,6 +3496,7 @@ void m68k_op_eor_8_ai(void)
 
    m68ki_write_8(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_8(res);
    FLAG_Z = res;
    FLAG_C = CFLAG_CLEAR;
@@ -3438,6 +3511,7 @@ void m68k_op_eor_8_pi(void)
 
    m68ki_write_8(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_8(res);
    FLAG_Z = res;
    FLAG_C = CFLAG_CLEAR;
@@ -3452,6 +3526,7 @@ void m68k_op_eor_8_pi7(void)
 
    m68ki_write_8(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_8(res);
    FLAG_Z = res;
    FLAG_C = CFLAG_CLEAR;
@@ -3466,6 +3541,7 @@ void m68k_op_eor_8_pd(void)
 
    m68ki_write_8(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_8(res);
    FLAG_Z = res;
    FLAG_C = CFLAG_CLEAR;
@@ -3480,6 +3556,7 @@ void m68k_op_eor_8_pd7(void)
 
    m68ki_write_8(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_8(res);
    FLAG_Z = res;
    FLAG_C = CFLAG_CLEAR;
@@ -3494,6 +3571,7 @@ void m68k_op_eor_8_di(void)
 
    m68ki_write_8(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_8(res);
    FLAG_Z = res;
    FLAG_C = CFLAG_CLEAR;
@@ -3508,6 +3586,7 @@ void m68k_op_eor_8_ix(void)
 
    m68ki_write_8(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_8(res);
    FLAG_Z = res;
    FLAG_C = CFLAG_CLEAR;
@@ -3522,6 +3601,7 @@ void m68k_op_eor_8_aw(void)
 
    m68ki_write_8(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_8(res);
    FLAG_Z = res;
    FLAG_C = CFLAG_CLEAR;
@@ -3536,6 +3616,7 @@ void m68k_op_eor_8_al(void)
 
    m68ki_write_8(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_8(res);
    FLAG_Z = res;
    FLAG_C = CFLAG_CLEAR;
@@ -3547,6 +3628,7 @@ void m68k_op_eor_16_d(void)
 {
    uint res = MASK_OUT_ABOVE_16(DY ^= MASK_OUT_ABOVE_16(DX));
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_16(res);
    FLAG_Z = res;
    FLAG_C = CFLAG_CLEAR;
@@ -3561,6 +3643,7 @@ void m68k_op_eor_16_ai(void)
 
    m68ki_write_16(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_16(res);
    FLAG_Z = res;
    FLAG_C = CFLAG_CLEAR;
@@ -3575,6 +3658,7 @@ void m68k_op_eor_16_pi(void)
 
    m68ki_write_16(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_16(res);
    FLAG_Z = res;
    FLAG_C = CFLAG_CLEAR;
@@ -3589,6 +3673,7 @@ void m68k_op_eor_16_pd(void)
 
    m68ki_write_16(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_16(res);
    FLAG_Z = res;
    FLAG_C = CFLAG_CLEAR;
@@ -3603,6 +3688,7 @@ void m68k_op_eor_16_di(void)
 
    m68ki_write_16(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_16(res);
    FLAG_Z = res;
    FLAG_C = CFLAG_CLEAR;
@@ -3617,6 +3703,7 @@ void m68k_op_eor_16_ix(void)
 
    m68ki_write_16(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_16(res);
    FLAG_Z = res;
    FLAG_C = CFLAG_CLEAR;
@@ -3631,6 +3718,7 @@ void m68k_op_eor_16_aw(void)
 
    m68ki_write_16(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_16(res);
    FLAG_Z = res;
    FLAG_C = CFLAG_CLEAR;
@@ -3645,6 +3733,7 @@ void m68k_op_eor_16_al(void)
 
    m68ki_write_16(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_16(res);
    FLAG_Z = res;
    FLAG_C = CFLAG_CLEAR;
@@ -3656,6 +3745,7 @@ void m68k_op_eor_32_d(void)
 {
    uint res = DY ^= DX;
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_32(res);
    FLAG_Z = res;
    FLAG_C = CFLAG_CLEAR;
@@ -3670,6 +3760,7 @@ void m68k_op_eor_32_ai(void)
 
    m68ki_write_32(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_32(res);
    FLAG_Z = res;
    FLAG_C = CFLAG_CLEAR;
@@ -3684,6 +3775,7 @@ void m68k_op_eor_32_pi(void)
 
    m68ki_write_32(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_32(res);
    FLAG_Z = res;
    FLAG_C = CFLAG_CLEAR;
@@ -3698,6 +3790,7 @@ void m68k_op_eor_32_pd(void)
 
    m68ki_write_32(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_32(res);
    FLAG_Z = res;
    FLAG_C = CFLAG_CLEAR;
@@ -3712,6 +3805,7 @@ void m68k_op_eor_32_di(void)
 
    m68ki_write_32(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_32(res);
    FLAG_Z = res;
    FLAG_C = CFLAG_CLEAR;
@@ -3726,6 +3820,7 @@ void m68k_op_eor_32_ix(void)
 
    m68ki_write_32(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_32(res);
    FLAG_Z = res;
    FLAG_C = CFLAG_CLEAR;
@@ -3740,6 +3835,7 @@ void m68k_op_eor_32_aw(void)
 
    m68ki_write_32(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_32(res);
    FLAG_Z = res;
    FLAG_C = CFLAG_CLEAR;
@@ -3754,6 +3850,7 @@ void m68k_op_eor_32_al(void)
 
    m68ki_write_32(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_32(res);
    FLAG_Z = res;
    FLAG_C = CFLAG_CLEAR;
@@ -3765,6 +3862,7 @@ void m68k_op_eori_8_d(void)
 {
    uint res = MASK_OUT_ABOVE_8(DY ^= OPER_I_8());
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_8(res);
    FLAG_Z = res;
    FLAG_C = CFLAG_CLEAR;
@@ -3780,6 +3878,7 @@ void m68k_op_eori_8_ai(void)
 
    m68ki_write_8(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_8(res);
    FLAG_Z = res;
    FLAG_C = CFLAG_CLEAR;
@@ -3795,6 +3894,7 @@ void m68k_op_eori_8_pi(void)
 
    m68ki_write_8(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_8(res);
    FLAG_Z = res;
    FLAG_C = CFLAG_CLEAR;
@@ -3810,6 +3910,7 @@ void m68k_op_eori_8_pi7(void)
 
    m68ki_write_8(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_8(res);
    FLAG_Z = res;
    FLAG_C = CFLAG_CLEAR;
@@ -3825,6 +3926,7 @@ void m68k_op_eori_8_pd(void)
 
    m68ki_write_8(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_8(res);
    FLAG_Z = res;
    FLAG_C = CFLAG_CLEAR;
@@ -3840,6 +3942,7 @@ void m68k_op_eori_8_pd7(void)
 
    m68ki_write_8(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_8(res);
    FLAG_Z = res;
    FLAG_C = CFLAG_CLEAR;
@@ -3855,6 +3958,7 @@ void m68k_op_eori_8_di(void)
 
    m68ki_write_8(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_8(res);
    FLAG_Z = res;
    FLAG_C = CFLAG_CLEAR;
@@ -3870,6 +3974,7 @@ void m68k_op_eori_8_ix(void)
 
    m68ki_write_8(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_8(res);
    FLAG_Z = res;
    FLAG_C = CFLAG_CLEAR;
@@ -3885,6 +3990,7 @@ void m68k_op_eori_8_aw(void)
 
    m68ki_write_8(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_8(res);
    FLAG_Z = res;
    FLAG_C = CFLAG_CLEAR;
@@ -3900,6 +4006,7 @@ void m68k_op_eori_8_al(void)
 
    m68ki_write_8(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_8(res);
    FLAG_Z = res;
    FLAG_C = CFLAG_CLEAR;
@@ -3911,6 +4018,7 @@ void m68k_op_eori_16_d(void)
 {
    uint res = MASK_OUT_ABOVE_16(DY ^= OPER_I_16());
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_16(res);
    FLAG_Z = res;
    FLAG_C = CFLAG_CLEAR;
@@ -3926,6 +4034,7 @@ void m68k_op_eori_16_ai(void)
 
    m68ki_write_16(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_16(res);
    FLAG_Z = res;
    FLAG_C = CFLAG_CLEAR;
@@ -3941,6 +4050,7 @@ void m68k_op_eori_16_pi(void)
 
    m68ki_write_16(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_16(res);
    FLAG_Z = res;
    FLAG_C = CFLAG_CLEAR;
@@ -3956,6 +4066,7 @@ void m68k_op_eori_16_pd(void)
 
    m68ki_write_16(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_16(res);
    FLAG_Z = res;
    FLAG_C = CFLAG_CLEAR;
@@ -3971,6 +4082,7 @@ void m68k_op_eori_16_di(void)
 
    m68ki_write_16(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_16(res);
    FLAG_Z = res;
    FLAG_C = CFLAG_CLEAR;
@@ -3986,6 +4098,7 @@ void m68k_op_eori_16_ix(void)
 
    m68ki_write_16(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_16(res);
    FLAG_Z = res;
    FLAG_C = CFLAG_CLEAR;
@@ -4001,6 +4114,7 @@ void m68k_op_eori_16_aw(void)
 
    m68ki_write_16(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_16(res);
    FLAG_Z = res;
    FLAG_C = CFLAG_CLEAR;
@@ -4016,6 +4130,7 @@ void m68k_op_eori_16_al(void)
 
    m68ki_write_16(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_16(res);
    FLAG_Z = res;
    FLAG_C = CFLAG_CLEAR;
@@ -4027,6 +4142,7 @@ void m68k_op_eori_32_d(void)
 {
    uint res = DY ^= OPER_I_32();
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_32(res);
    FLAG_Z = res;
    FLAG_C = CFLAG_CLEAR;
@@ -4042,6 +4158,7 @@ void m68k_op_eori_32_ai(void)
 
    m68ki_write_32(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_32(res);
    FLAG_Z = res;
    FLAG_C = CFLAG_CLEAR;
@@ -4057,6 +4174,7 @@ void m68k_op_eori_32_pi(void)
 
    m68ki_write_32(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_32(res);
    FLAG_Z = res;
    FLAG_C = CFLAG_CLEAR;
@@ -4072,6 +4190,7 @@ void m68k_op_eori_32_pd(void)
 
    m68ki_write_32(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_32(res);
    FLAG_Z = res;
    FLAG_C = CFLAG_CLEAR;
@@ -4087,6 +4206,7 @@ void m68k_op_eori_32_di(void)
 
    m68ki_write_32(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_32(res);
    FLAG_Z = res;
    FLAG_C = CFLAG_CLEAR;
@@ -4102,6 +4222,7 @@ void m68k_op_eori_32_ix(void)
 
    m68ki_write_32(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_32(res);
    FLAG_Z = res;
    FLAG_C = CFLAG_CLEAR;
@@ -4117,6 +4238,7 @@ void m68k_op_eori_32_aw(void)
 
    m68ki_write_32(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_32(res);
    FLAG_Z = res;
    FLAG_C = CFLAG_CLEAR;
@@ -4132,6 +4254,7 @@ void m68k_op_eori_32_al(void)
 
    m68ki_write_32(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_32(res);
    FLAG_Z = res;
    FLAG_C = CFLAG_CLEAR;
@@ -4194,6 +4317,7 @@ void m68k_op_ext_16(void)
 
    *r_dst = MASK_OUT_BELOW_16(*r_dst) | MASK_OUT_ABOVE_8(*r_dst) | (GET_MSB_8(*r_dst) ? 0xff00 : 0);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_16(*r_dst);
    FLAG_Z = MASK_OUT_ABOVE_16(*r_dst);
    FLAG_V = VFLAG_CLEAR;
@@ -4207,6 +4331,7 @@ void m68k_op_ext_32(void)
 
    *r_dst = MASK_OUT_ABOVE_16(*r_dst) | (GET_MSB_16(*r_dst) ? 0xffff0000 : 0);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_32(*r_dst);
    FLAG_Z = *r_dst;
    FLAG_V = VFLAG_CLEAR;
@@ -4216,6 +4341,7 @@ void m68k_op_ext_32(void)
 
 void m68k_op_extb_32(void)
 {
+   m68ki_resolve_flags();
    if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
    {
       uint* r_dst = &DY;
@@ -4461,6 +4587,7 @@ void m68k_op_lsr_8_s(void)
 
    *r_dst = MASK_OUT_BELOW_8(*r_dst) | res;
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_CLEAR;
    FLAG_Z = res;
    FLAG_X = FLAG_C = src << (9-shift);
@@ -4477,6 +4604,7 @@ void m68k_op_lsr_16_s(void)
 
    *r_dst = MASK_OUT_BELOW_16(*r_dst) | res;
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_CLEAR;
    FLAG_Z = res;
    FLAG_X = FLAG_C = src << (9-shift);
@@ -4493,6 +4621,7 @@ void m68k_op_lsr_32_s(void)
 
    *r_dst = res;
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_CLEAR;
    FLAG_Z = res;
    FLAG_X = FLAG_C = src << (9-shift);
@@ -4507,6 +4636,8 @@ void m68k_op_lsr_8_r(void)
    uint src = MASK_OUT_ABOVE_8(*r_dst);
    uint res = src >> shift;
 
+   m68ki_resolve_flags();
+
    if(shift != 0)
    {
       USE_CYCLES(shift<<CYC_SHIFT);
@@ -4544,6 +4675,8 @@ void m68k_op_lsr_16_r(void)
    uint src = MASK_OUT_ABOVE_16(*r_dst);
    uint res = src >> shift;
 
+   m68ki_resolve_flags();
+
    if(shift != 0)
    {
       USE_CYCLES(shift<<CYC_SHIFT);
@@ -4581,6 +4714,8 @@ void m68k_op_lsr_32_r(void)
    uint src = *r_dst;
    uint res = src >> shift;
 
+   m68ki_resolve_flags();
+
    if(shift != 0)
    {
       USE_CYCLES(shift<<CYC_SHIFT);
@@ -4618,6 +4753,7 @@ void m68k_op_lsr_16_ai(void)
 
    m68ki_write_16(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_CLEAR;
    FLAG_Z = res;
    FLAG_C = FLAG_X = src << 8;
@@ -4633,6 +4769,7 @@ void m68k_op_lsr_16_pi(void)
 
    m68ki_write_16(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_CLEAR;
    FLAG_Z = res;
    FLAG_C = FLAG_X = src << 8;
@@ -4648,6 +4785,7 @@ void m68k_op_lsr_16_pd(void)
 
    m68ki_write_16(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_CLEAR;
    FLAG_Z = res;
    FLAG_C = FLAG_X = src << 8;
@@ -4663,6 +4801,7 @@ void m68k_op_lsr_16_di(void)
 
    m68ki_write_16(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_CLEAR;
    FLAG_Z = res;
    FLAG_C = FLAG_X = src << 8;
@@ -4678,6 +4817,7 @@ void m68k_op_lsr_16_ix(void)
 
    m68ki_write_16(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_CLEAR;
    FLAG_Z = res;
    FLAG_C = FLAG_X = src << 8;
@@ -4693,6 +4833,7 @@ void m68k_op_lsr_16_aw(void)
 
    m68ki_write_16(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_CLEAR;
    FLAG_Z = res;
    FLAG_C = FLAG_X = src << 8;
@@ -4708,6 +4849,7 @@ void m68k_op_lsr_16_al(void)
 
    m68ki_write_16(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_CLEAR;
    FLAG_Z = res;
    FLAG_C = FLAG_X = src << 8;
@@ -4724,6 +4866,7 @@ void m68k_op_lsl_8_s(void)
 
    *r_dst = MASK_OUT_BELOW_8(*r_dst) | res;
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_8(res);
    FLAG_Z = res;
    FLAG_X = FLAG_C = src << shift;
@@ -4740,6 +4883,7 @@ void m68k_op_lsl_16_s(void)
 
    *r_dst = MASK_OUT_BELOW_16(*r_dst) | res;
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_16(res);
    FLAG_Z = res;
    FLAG_X = FLAG_C = src >> (8-shift);
@@ -4756,6 +4900,7 @@ void m68k_op_lsl_32_s(void)
 
    *r_dst = res;
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_32(res);
    FLAG_Z = res;
    FLAG_X = FLAG_C = src >> (24-shift);
@@ -4770,6 +4915,8 @@ void m68k_op_lsl_8_r(void)
    uint src = MASK_OUT_ABOVE_8(*r_dst);
    uint res = MASK_OUT_ABOVE_8(src << shift);
 
+   m68ki_resolve_flags();
+
    if(shift != 0)
    {
       USE_CYCLES(shift<<CYC_SHIFT);
@@ -4807,6 +4954,8 @@ void m68k_op_lsl_16_r(void)
    uint src = MASK_OUT_ABOVE_16(*r_dst);
    uint res = MASK_OUT_ABOVE_16(src << shift);
 
+   m68ki_resolve_flags();
+
    if(shift != 0)
    {
       USE_CYCLES(shift<<CYC_SHIFT);
@@ -4844,6 +4993,8 @@ void m68k_op_lsl_32_r(void)
    uint src = *r_dst;
    uint res = MASK_OUT_ABOVE_32(src << shift);
 
+   m68ki_resolve_flags();
+
    if(shift != 0)
    {
       USE_CYCLES(shift<<CYC_SHIFT);
@@ -4881,6 +5032,7 @@ void m68k_op_lsl_16_ai(void)
 
    m68ki_write_16(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_16(res);
    FLAG_Z = res;
    FLAG_X = FLAG_C = src >> 7;
@@ -4896,6 +5048,7 @@ void m68k_op_lsl_16_pi(void)
 
    m68ki_write_16(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_16(res);
    FLAG_Z = res;
    FLAG_X = FLAG_C = src >> 7;
@@ -4911,6 +5064,7 @@ void m68k_op_lsl_16_pd(void)
 
    m68ki_write_16(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_16(res);
    FLAG_Z = res;
    FLAG_X = FLAG_C = src >> 7;
@@ -4926,6 +5080,7 @@ void m68k_op_lsl_16_di(void)
 
    m68ki_write_16(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_16(res);
    FLAG_Z = res;
    FLAG_X = FLAG_C = src >> 7;
@@ -4941,6 +5096,7 @@ void m68k_op_lsl_16_ix(void)
 
    m68ki_write_16(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_16(res);
    FLAG_Z = res;
    FLAG_X = FLAG_C = src >> 7;
@@ -4956,6 +5112,7 @@ void m68k_op_lsl_16_aw(void)
 
    m68ki_write_16(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_16(res);
    FLAG_Z = res;
    FLAG_X = FLAG_C = src >> 7;
@@ -4971,6 +5128,7 @@ void m68k_op_lsl_16_al(void)
 
    m68ki_write_16(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_16(res);
    FLAG_Z = res;
    FLAG_X = FLAG_C = src >> 7;
@@ -4985,6 +5143,7 @@ void m68k_op_move_8_d_d(void)
 
    *r_dst = MASK_OUT_BELOW_8(*r_dst) | res;
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_8(res);
    FLAG_Z = res;
    FLAG_V = VFLAG_CLEAR;
@@ -4999,6 +5158,7 @@ void m68k_op_move_8_d_ai(void)
 
    *r_dst = MASK_OUT_BELOW_8(*r_dst) | res;
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_8(res);
    FLAG_Z = res;
    FLAG_V = VFLAG_CLEAR;
@@ -5013,6 +5173,7 @@ void m68k_op_move_8_d_pi(void)
 
    *r_dst = MASK_OUT_BELOW_8(*r_dst) | res;
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_8(res);
    FLAG_Z = res;
    FLAG_V = VFLAG_CLEAR;
@@ -5027,6 +5188,7 @@ void m68k_op_move_8_d_pi7(void)
 
    *r_dst = MASK_OUT_BELOW_8(*r_dst) | res;
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_8(res);
    FLAG_Z = res;
    FLAG_V = VFLAG_CLEAR;
@@ -5041,6 +5203,7 @@ void m68k_op_move_8_d_pd(void)
 
    *r_dst = MASK_OUT_BELOW_8(*r_dst) | res;
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_8(res);
    FLAG_Z = res;
    FLAG_V = VFLAG_CLEAR;
@@ -5055,6 +5218,7 @@ void m68k_op_move_8_d_pd7(void)
 
    *r_dst = MASK_OUT_BELOW_8(*r_dst) | res;
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_8(res);
    FLAG_Z = res;
    FLAG_V = VFLAG_CLEAR;
@@ -5069,6 +5233,7 @@ void m68k_op_move_8_d_di(void)
 
    *r_dst = MASK_OUT_BELOW_8(*r_dst) | res;
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_8(res);
    FLAG_Z = res;
    FLAG_V = VFLAG_CLEAR;
@@ -5083,6 +5248,7 @@ void m68k_op_move_8_d_ix(void)
 
    *r_dst = MASK_OUT_BELOW_8(*r_dst) | res;
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_8(res);
    FLAG_Z = res;
    FLAG_V = VFLAG_CLEAR;
@@ -5097,6 +5263,7 @@ void m68k_op_move_8_d_aw(void)
 
    *r_dst = MASK_OUT_BELOW_8(*r_dst) | res;
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_8(res);
    FLAG_Z = res;
    FLAG_V = VFLAG_CLEAR;
@@ -5111,6 +5278,7 @@ void m68k_op_move_8_d_al(void)
 
    *r_dst = MASK_OUT_BELOW_8(*r_dst) | res;
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_8(res);
    FLAG_Z = res;
    FLAG_V = VFLAG_CLEAR;
@@ -5125,6 +5293,7 @@ void m68k_op_move_8_d_pcdi(void)
 
    *r_dst = MASK_OUT_BELOW_8(*r_dst) | res;
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_8(res);
    FLAG_Z = res;
    FLAG_V = VFLAG_CLEAR;
@@ -5139,6 +5308,7 @@ void m68k_op_move_8_d_pcix(void)
 
    *r_dst = MASK_OUT_BELOW_8(*r_dst) | res;
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_8(res);
    FLAG_Z = res;
    FLAG_V = VFLAG_CLEAR;
@@ -5153,6 +5323,7 @@ void m68k_op_move_8_d_i(void)
 
    *r_dst = MASK_OUT_BELOW_8(*r_dst) | res;
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_8(res);
    FLAG_Z = res;
    FLAG_V = VFLAG_CLEAR;
@@ -5167,6 +5338,7 @@ void m68k_op_move_8_ai_d(void)
 
    m68ki_write_8(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_8(res);
    FLAG_Z = res;
    FLAG_V = VFLAG_CLEAR;
@@ -5181,6 +5353,7 @@ void m68k_op_move_8_ai_ai(void)
 
    m68ki_write_8(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_8(res);
    FLAG_Z = res;
    FLAG_V = VFLAG_CLEAR;
@@ -5195,6 +5368,7 @@ void m68k_op_move_8_ai_pi(void)
 
    m68ki_write_8(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_8(res);
    FLAG_Z = res;
    FLAG_V = VFLAG_CLEAR;
@@ -5209,6 +5383,7 @@ void m68k_op_move_8_ai_pi7(void)
 
    m68ki_write_8(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_8(res);
    FLAG_Z = res;
    FLAG_V = VFLAG_CLEAR;
@@ -5223,6 +5398,7 @@ void m68k_op_move_8_ai_pd(void)
 
    m68ki_write_8(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_8(res);
    FLAG_Z = res;
    FLAG_V = VFLAG_CLEAR;
@@ -5237,6 +5413,7 @@ void m68k_op_move_8_ai_pd7(void)
 
    m68ki_write_8(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_8(res);
    FLAG_Z = res;
    FLAG_V = VFLAG_CLEAR;
@@ -5251,6 +5428,7 @@ void m68k_op_move_8_ai_di(void)
 
    m68ki_write_8(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_8(res);
    FLAG_Z = res;
    FLAG_V = VFLAG_CLEAR;
@@ -5265,6 +5443,7 @@ void m68k_op_move_8_ai_ix(void)
 
    m68ki_write_8(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_8(res);
    FLAG_Z = res;
    FLAG_V = VFLAG_CLEAR;
@@ -5279,6 +5458,7 @@ void m68k_op_move_8_ai_aw(void)
 
    m68ki_write_8(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_8(res);
    FLAG_Z = res;
    FLAG_V = VFLAG_CLEAR;
@@ -5293,6 +5473,7 @@ void m68k_op_move_8_ai_al(void)
 
    m68ki_write_8(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_8(res);
    FLAG_Z = res;
    FLAG_V = VFLAG_CLEAR;
@@ -5307,6 +5488,7 @@ void m68k_op_move_8_ai_pcdi(void)
 
    m68ki_write_8(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_8(res);
    FLAG_Z = res;
    FLAG_V = VFLAG_CLEAR;
@@ -5321,6 +5503,7 @@ void m68k_op_move_8_ai_pcix(void)
 
    m68ki_write_8(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_8(res);
    FLAG_Z = res;
    FLAG_V = VFLAG_CLEAR;
@@ -5335,6 +5518,7 @@ void m68k_op_move_8_ai_i(void)
 
    m68ki_write_8(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_8(res);
    FLAG_Z = res;
    FLAG_V = VFLAG_CLEAR;
@@ -5349,6 +5533,7 @@ void m68k_op_move_8_pi7_d(void)
 
    m68ki_write_8(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_8(res);
    FLAG_Z = res;
    FLAG_V = VFLAG_CLEAR;
@@ -5363,6 +5548,7 @@ void m68k_op_move_8_pi_d(void)
 
    m68ki_write_8(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_8(res);
    FLAG_Z = res;
    FLAG_V = VFLAG_CLEAR;
@@ -5377,6 +5563,7 @@ void m68k_op_move_8_pi7_ai(void)
 
    m68ki_write_8(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_8(res);
    FLAG_Z = res;
    FLAG_V = VFLAG_CLEAR;
@@ -5391,6 +5578,7 @@ void m68k_op_move_8_pi7_pi(void)
 
    m68ki_write_8(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_8(res);
    FLAG_Z = res;
    FLAG_V = VFLAG_CLEAR;
@@ -5405,6 +5593,7 @@ void m68k_op_move_8_pi7_pi7(void)
 
    m68ki_write_8(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_8(res);
    FLAG_Z = res;
    FLAG_V = VFLAG_CLEAR;
@@ -5419,6 +5608,7 @@ void m68k_op_move_8_pi7_pd(void)
 
    m68ki_write_8(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_8(res);
    FLAG_Z = res;
    FLAG_V = VFLAG_CLEAR;
@@ -5433,6 +5623,7 @@ void m68k_op_move_8_pi7_pd7(void)
 
    m68ki_write_8(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_8(res);
    FLAG_Z = res;
    FLAG_V = VFLAG_CLEAR;
@@ -5447,6 +5638,7 @@ void m68k_op_move_8_pi7_di(void)
 
    m68ki_write_8(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_8(res);
    FLAG_Z = res;
    FLAG_V = VFLAG_CLEAR;
@@ -5461,6 +5653,7 @@ void m68k_op_move_8_pi7_ix(void)
 
    m68ki_write_8(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_8(res);
    FLAG_Z = res;
    FLAG_V = VFLAG_CLEAR;
@@ -5475,6 +5668,7 @@ void m68k_op_move_8_pi7_aw(void)
 
    m68ki_write_8(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_8(res);
    FLAG_Z = res;
    FLAG_V = VFLAG_CLEAR;
@@ -5489,6 +5683,7 @@ void m68k_op_move_8_pi7_al(void)
 
    m68ki_write_8(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_8(res);
    FLAG_Z = res;
    FLAG_V = VFLAG_CLEAR;
@@ -5503,6 +5698,7 @@ void m68k_op_move_8_pi7_pcdi(void)
 
    m68ki_write_8(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_8(res);
    FLAG_Z = res;
    FLAG_V = VFLAG_CLEAR;
@@ -5517,6 +5713,7 @@ void m68k_op_move_8_pi7_pcix(void)
 
    m68ki_write_8(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_8(res);
    FLAG_Z = res;
    FLAG_V = VFLAG_CLEAR;
@@ -5531,6 +5728,7 @@ void m68k_op_move_8_pi7_i(void)
 
    m68ki_write_8(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_8(res);
    FLAG_Z = res;
    FLAG_V = VFLAG_CLEAR;
@@ -5545,6 +5743,7 @@ void m68k_op_move_8_pi_ai(void)
 
    m68ki_write_8(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_8(res);
    FLAG_Z = res;
    FLAG_V = VFLAG_CLEAR;
@@ -5559,6 +5758,7 @@ void m68k_op_move_8_pi_pi(void)
 
    m68ki_write_8(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_8(res);
    FLAG_Z = res;
    FLAG_V = VFLAG_CLEAR;
@@ -5573,6 +5773,7 @@ void m68k_op_move_8_pi_pi7(void)
 
    m68ki_write_8(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_8(res);
    FLAG_Z = res;
    FLAG_V = VFLAG_CLEAR;
@@ -5587,6 +5788,7 @@ void m68k_op_move_8_pi_pd(void)
 
    m68ki_write_8(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_8(res);
    FLAG_Z = res;
    FLAG_V = VFLAG_CLEAR;
@@ -5601,6 +5803,7 @@ void m68k_op_move_8_pi_pd7(void)
 
    m68ki_write_8(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_8(res);
    FLAG_Z = res;
    FLAG_V = VFLAG_CLEAR;
@@ -5615,6 +5818,7 @@ void m68k_op_move_8_pi_di(void)
 
    m68ki_write_8(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_8(res);
    FLAG_Z = res;
    FLAG_V = VFLAG_CLEAR;
@@ -5629,6 +5833,7 @@ void m68k_op_move_8_pi_ix(void)
 
    m68ki_write_8(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_8(res);
    FLAG_Z = res;
    FLAG_V = VFLAG_CLEAR;
@@ -5643,6 +5848,7 @@ void m68k_op_move_8_pi_aw(void)
 
    m68ki_write_8(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_8(res);
    FLAG_Z = res;
    FLAG_V = VFLAG_CLEAR;
@@ -5657,6 +5863,7 @@ void m68k_op_move_8_pi_al(void)
 
    m68ki_write_8(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_8(res);
    FLAG_Z = res;
    FLAG_V = VFLAG_CLEAR;
@@ -5671,6 +5878,7 @@ void m68k_op_move_8_pi_pcdi(void)
 
    m68ki_write_8(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_8(res);
    FLAG_Z = res;
    FLAG_V = VFLAG_CLEAR;
@@ -5685,6 +5893,7 @@ void m68k_op_move_8_pi_pcix(void)
 
    m68ki_write_8(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_8(res);
    FLAG_Z = res;
    FLAG_V = VFLAG_CLEAR;
@@ -5699,6 +5908,7 @@ void m68k_op_move_8_pi_i(void)
 
    m68ki_write_8(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_8(res);
    FLAG_Z = res;
    FLAG_V = VFLAG_CLEAR;
@@ -5713,6 +5923,7 @@ void m68k_op_move_8_pd7_d(void)
 
    m68ki_write_8(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_8(res);
    FLAG_Z = res;
    FLAG_V = VFLAG_CLEAR;
@@ -5727,6 +5938,7 @@ void m68k_op_move_8_pd_d(void)
 
    m68ki_write_8(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_8(res);
    FLAG_Z = res;
    FLAG_V = VFLAG_CLEAR;
@@ -5741,6 +5953,7 @@ void m68k_op_move_8_pd7_ai(void)
 
    m68ki_write_8(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_8(res);
    FLAG_Z = res;
    FLAG_V = VFLAG_CLEAR;
@@ -5755,6 +5968,7 @@ void m68k_op_move_8_pd7_pi(void)
 
    m68ki_write_8(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_8(res);
    FLAG_Z = res;
    FLAG_V = VFLAG_CLEAR;
@@ -5769,6 +5983,7 @@ void m68k_op_move_8_pd7_pi7(void)
 
    m68ki_write_8(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_8(res);
    FLAG_Z = res;
    FLAG_V = VFLAG_CLEAR;
@@ -5783,6 +5998,7 @@ void m68k_op_move_8_pd7_pd(void)
 
    m68ki_write_8(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_8(res);
    FLAG_Z = res;
    FLAG_V = VFLAG_CLEAR;
@@ -5797,6 +6013,7 @@ void m68k_op_move_8_pd7_pd7(void)
 
    m68ki_write_8(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_8(res);
    FLAG_Z = res;
    FLAG_V = VFLAG_CLEAR;
@@ -5811,6 +6028,7 @@ void m68k_op_move_8_pd7_di(void)
 
    m68ki_write_8(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_8(res);
    FLAG_Z = res;
    FLAG_V = VFLAG_CLEAR;
@@ -5825,6 +6043,7 @@ void m68k_op_move_8_pd7_ix(void)
 
    m68ki_write_8(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_8(res);
    FLAG_Z = res;
    FLAG_V = VFLAG_CLEAR;
@@ -5839,6 +6058,7 @@ void m68k_op_move_8_pd7_aw(void)
 
    m68ki_write_8(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_8(res);
    FLAG_Z = res;
    FLAG_V = VFLAG_CLEAR;
@@ -5853,6 +6073,7 @@ void m68k_op_move_8_pd7_al(void)
 
    m68ki_write_8(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_8(res);
    FLAG_Z = res;
    FLAG_V = VFLAG_CLEAR;
@@ -5867,6 +6088,7 @@ void m68k_op_move_8_pd7_pcdi(void)
 
    m68ki_write_8(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_8(res);
    FLAG_Z = res;
    FLAG_V = VFLAG_CLEAR;
@@ -5881,6 +6103,7 @@ void m68k_op_move_8_pd7_pcix(void)
 
    m68ki_write_8(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_8(res);
    FLAG_Z = res;
    FLAG_V = VFLAG_CLEAR;
@@ -5895,6 +6118,7 @@ void m68k_op_move_8_pd7_i(void)
 
    m68ki_write_8(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_8(res);
    FLAG_Z = res;
    FLAG_V = VFLAG_CLEAR;
@@ -5909,6 +6133,7 @@ void m68k_op_move_8_pd_ai(void)
 
    m68ki_write_8(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_8(res);
    FLAG_Z = res;
    FLAG_V = VFLAG_CLEAR;
@@ -5923,6 +6148,7 @@ void m68k_op_move_8_pd_pi(void)
 
    m68ki_write_8(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_8(res);
    FLAG_Z = res;
    FLAG_V = VFLAG_CLEAR;
@@ -5937,6 +6163,7 @@ void m68k_op_move_8_pd_pi7(void)
 
    m68ki_write_8(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_8(res);
    FLAG_Z = res;
    FLAG_V = VFLAG_CLEAR;
@@ -5951,6 +6178,7 @@ void m68k_op_move_8_pd_pd(void)
 
    m68ki_write_8(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_8(res);
    FLAG_Z = res;
    FLAG_V = VFLAG_CLEAR;
@@ -5965,6 +6193,7 @@ void m68k_op_move_8_pd_pd7(void)
 
    m68ki_write_8(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_8(res);
    FLAG_Z = res;
    FLAG_V = VFLAG_CLEAR;
@@ -5979,6 +6208,7 @@ void m68k_op_move_8_pd_di(void)
 
    m68ki_write_8(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_8(res);
    FLAG_Z = res;
    FLAG_V = VFLAG_CLEAR;
@@ -5993,6 +6223,7 @@ void m68k_op_move_8_pd_ix(void)
 
    m68ki_write_8(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_8(res);
    FLAG_Z = res;
    FLAG_V = VFLAG_CLEAR;
@@ -6007,6 +6238,7 @@ void m68k_op_move_8_pd_aw(void)
 
    m68ki_write_8(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_8(res);
    FLAG_Z = res;
    FLAG_V = VFLAG_CLEAR;
@@ -6021,6 +6253,7 @@ void m68k_op_move_8_pd_al(void)
 
    m68ki_write_8(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_8(res);
    FLAG_Z = res;
    FLAG_V = VFLAG_CLEAR;
@@ -6035,6 +6268,7 @@ void m68k_op_move_8_pd_pcdi(void)
 
    m68ki_write_8(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_8(res);
    FLAG_Z = res;
    FLAG_V = VFLAG_CLEAR;
@@ -6049,6 +6283,7 @@ void m68k_op_move_8_pd_pcix(void)
 
    m68ki_write_8(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_8(res);
    FLAG_Z = res;
    FLAG_V = VFLAG_CLEAR;
@@ -6063,6 +6298,7 @@ void m68k_op_move_8_pd_i(void)
 
    m68ki_write_8(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_8(res);
    FLAG_Z = res;
    FLAG_V = VFLAG_CLEAR;
@@ -6077,6 +6313,7 @@ void m68k_op_move_8_di_d(void)
 
    m68ki_write_8(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_8(res);
    FLAG_Z = res;
    FLAG_V = VFLAG_CLEAR;
@@ -6091,6 +6328,7 @@ void m68k_op_move_8_di_ai(void)
 
    m68ki_write_8(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_8(res);
    FLAG_Z = res;
    FLAG_V = VFLAG_CLEAR;
@@ -6105,6 +6343,7 @@ void m68k_op_move_8_di_pi(void)
 
    m68ki_write_8(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_8(res);
    FLAG_Z = res;
    FLAG_V = VFLAG_CLEAR;
@@ -6119,6 +6358,7 @@ void m68k_op_move_8_di_pi7(void)
 
    m68ki_write_8(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_8(res);
    FLAG_Z = res;
    FLAG_V = VFLAG_CLEAR;
@@ -6133,6 +6373,7 @@ void m68k_op_move_8_di_pd(void)
 
    m68ki_write_8(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_8(res);
    FLAG_Z = res;
    FLAG_V = VFLAG_CLEAR;
@@ -6147,6 +6388,7 @@ void m68k_op_move_8_di_pd7(void)
 
    m68ki_write_8(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_8(res);
    FLAG_Z = res;
    FLAG_V = VFLAG_CLEAR;
@@ -6161,6 +6403,7 @@ void m68k_op_move_8_di_di(void)
 
    m68ki_write_8(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_8(res);
    FLAG_Z = res;
    FLAG_V = VFLAG_CLEAR;
@@ -6175,6 +6418,7 @@ void m68k_op_move_8_di_ix(void)
 
    m68ki_write_8(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_8(res);
    FLAG_Z = res;
    FLAG_V = VFLAG_CLEAR;
@@ -6189,6 +6433,7 @@ void m68k_op_move_8_di_aw(void)
 
    m68ki_write_8(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_8(res);
    FLAG_Z = res;
    FLAG_V = VFLAG_CLEAR;
@@ -6203,6 +6448,7 @@ void m68k_op_move_8_di_al(void)
 
    m68ki_write_8(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_8(res);
    FLAG_Z = res;
    FLAG_V = VFLAG_CLEAR;
@@ -6217,6 +6463,7 @@ void m68k_op_move_8_di_pcdi(void)
 
    m68ki_write_8(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_8(res);
    FLAG_Z = res;
    FLAG_V = VFLAG_CLEAR;
@@ -6231,6 +6478,7 @@ void m68k_op_move_8_di_pcix(void)
 
    m68ki_write_8(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_8(res);
    FLAG_Z = res;
    FLAG_V = VFLAG_CLEAR;
@@ -6245,6 +6493,7 @@ void m68k_op_move_8_di_i(void)
 
    m68ki_write_8(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_8(res);
    FLAG_Z = res;
    FLAG_V = VFLAG_CLEAR;
@@ -6259,6 +6508,7 @@ void m68k_op_move_8_ix_d(void)
 
    m68ki_write_8(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_8(res);
    FLAG_Z = res;
    FLAG_V = VFLAG_CLEAR;
@@ -6273,6 +6523,7 @@ void m68k_op_move_8_ix_ai(void)
 
    m68ki_write_8(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_8(res);
    FLAG_Z = res;
    FLAG_V = VFLAG_CLEAR;
@@ -6287,6 +6538,7 @@ void m68k_op_move_8_ix_pi(void)
 
    m68ki_write_8(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_8(res);
    FLAG_Z = res;
    FLAG_V = VFLAG_CLEAR;
@@ -6301,6 +6553,7 @@ void m68k_op_move_8_ix_pi7(void)
 
    m68ki_write_8(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_8(res);
    FLAG_Z = res;
    FLAG_V = VFLAG_CLEAR;
@@ -6315,6 +6568,7 @@ void m68k_op_move_8_ix_pd(void)
 
    m68ki_write_8(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_8(res);
    FLAG_Z = res;
    FLAG_V = VFLAG_CLEAR;
@@ -6329,6 +6583,7 @@ void m68k_op_move_8_ix_pd7(void)
 
    m68ki_write_8(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_8(res);
    FLAG_Z = res;
    FLAG_V = VFLAG_CLEAR;
@@ -6343,6 +6598,7 @@ void m68k_op_move_8_ix_di(void)
 
    m68ki_write_8(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_8(res);
    FLAG_Z = res;
    FLAG_V = VFLAG_CLEAR;
@@ -6357,6 +6613,7 @@ void m68k_op_move_8_ix_ix(void)
 
    m68ki_write_8(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_8(res);
    FLAG_Z = res;
    FLAG_V = VFLAG_CLEAR;
@@ -6371,6 +6628,7 @@ void m68k_op_move_8_ix_aw(void)
 
    m68ki_write_8(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_8(res);
    FLAG_Z = res;
    FLAG_V = VFLAG_CLEAR;
@@ -6385,6 +6643,7 @@ void m68k_op_move_8_ix_al(void)
 
    m68ki_write_8(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_8(res);
    FLAG_Z = res;
    FLAG_V = VFLAG_CLEAR;
@@ -6399,6 +6658,7 @@ void m68k_op_move_8_ix_pcdi(void)
 
    m68ki_write_8(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_8(res);
    FLAG_Z = res;
    FLAG_V = VFLAG_CLEAR;
@@ -6413,6 +6673,7 @@ void m68k_op_move_8_ix_pcix(void)
 
    m68ki_write_8(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_8(res);
    FLAG_Z = res;
    FLAG_V = VFLAG_CLEAR;
@@ -6427,6 +6688,7 @@ void m68k_op_move_8_ix_i(void)
 
    m68ki_write_8(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_8(res);
    FLAG_Z = res;
    FLAG_V = VFLAG_CLEAR;
@@ -6441,6 +6703,7 @@ void m68k_op_move_8_aw_d(void)
 
    m68ki_write_8(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_8(res);
    FLAG_Z = res;
    FLAG_V = VFLAG_CLEAR;
@@ -6455,6 +6718,7 @@ void m68k_op_move_8_aw_ai(void)
 
    m68ki_write_8(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_8(res);
    FLAG_Z = res;
    FLAG_V = VFLAG_CLEAR;
@@ -6469,6 +6733,7 @@ void m68k_op_move_8_aw_pi(void)
 
    m68ki_write_8(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_8(res);
    FLAG_Z = res;
    FLAG_V = VFLAG_CLEAR;
@@ -6483,6 +6748,7 @@ void m68k_op_move_8_aw_pi7(void)
 
    m68ki_write_8(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_8(res);
    FLAG_Z = res;
    FLAG_V = VFLAG_CLEAR;
@@ -6497,6 +6763,7 @@ void m68k_op_move_8_aw_pd(void)
 
    m68ki_write_8(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_8(res);
    FLAG_Z = res;
    FLAG_V = VFLAG_CLEAR;
@@ -6511,6 +6778,7 @@ void m68k_op_move_8_aw_pd7(void)
 
    m68ki_write_8(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_8(res);
    FLAG_Z = res;
    FLAG_V = VFLAG_CLEAR;
@@ -6525,6 +6793,7 @@ void m68k_op_move_8_aw_di(void)
 
    m68ki_write_8(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_8(res);
    FLAG_Z = res;
    FLAG_V = VFLAG_CLEAR;
@@ -6539,6 +6808,7 @@ void m68k_op_move_8_aw_ix(void)
 
    m68ki_write_8(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_8(res);
    FLAG_Z = res;
    FLAG_V = VFLAG_CLEAR;
@@ -6553,6 +6823,7 @@ void m68k_op_move_8_aw_aw(void)
 
    m68ki_write_8(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_8(res);
    FLAG_Z = res;
    FLAG_V = VFLAG_CLEAR;
@@ -6567,6 +6838,7 @@ void m68k_op_move_8_aw_al(void)
 
    m68ki_write_8(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_8(res);
    FLAG_Z = res;
    FLAG_V = VFLAG_CLEAR;
@@ -6581,6 +6853,7 @@ void m68k_op_move_8_aw_pcdi(void)
 
    m68ki_write_8(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_8(res);
    FLAG_Z = res;
    FLAG_V = VFLAG_CLEAR;
@@ -6595,6 +6868,7 @@ void m68k_op_move_8_aw_pcix(void)
 
    m68ki_write_8(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_8(res);
    FLAG_Z = res;
    FLAG_V = VFLAG_CLEAR;
@@ -6609,6 +6883,7 @@ void m68k_op_move_8_aw_i(void)
 
    m68ki_write_8(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_8(res);
    FLAG_Z = res;
    FLAG_V = VFLAG_CLEAR;
@@ -6623,6 +6898,7 @@ void m68k_op_move_8_al_d(void)
 
    m68ki_write_8(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_8(res);
    FLAG_Z = res;
    FLAG_V = VFLAG_CLEAR;
@@ -6637,6 +6913,7 @@ void m68k_op_move_8_al_ai(void)
 
    m68ki_write_8(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_8(res);
    FLAG_Z = res;
    FLAG_V = VFLAG_CLEAR;
@@ -6651,6 +6928,7 @@ void m68k_op_move_8_al_pi(void)
 
    m68ki_write_8(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_8(res);
    FLAG_Z = res;
    FLAG_V = VFLAG_CLEAR;
@@ -6665,6 +6943,7 @@ void m68k_op_move_8_al_pi7(void)
 
    m68ki_write_8(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_8(res);
    FLAG_Z = res;
    FLAG_V = VFLAG_CLEAR;
@@ -6679,6 +6958,7 @@ void m68k_op_move_8_al_pd(void)
 
    m68ki_write_8(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_8(res);
    FLAG_Z = res;
    FLAG_V = VFLAG_CLEAR;
@@ -6693,6 +6973,7 @@ void m68k_op_move_8_al_pd7(void)
 
    m68ki_write_8(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_8(res);
    FLAG_Z = res;
    FLAG_V = VFLAG_CLEAR;
@@ -6707,6 +6988,7 @@ void m68k_op_move_8_al_di(void)
 
    m68ki_write_8(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_8(res);
    FLAG_Z = res;
    FLAG_V = VFLAG_CLEAR;
@@ -6721,6 +7003,7 @@ void m68k_op_move_8_al_ix(void)
 
    m68ki_write_8(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_8(res);
    FLAG_Z = res;
    FLAG_V = VFLAG_CLEAR;
@@ -6735,6 +7018,7 @@ void m68k_op_move_8_al_aw(void)
 
    m68ki_write_8(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_8(res);
    FLAG_Z = res;
    FLAG_V = VFLAG_CLEAR;
@@ -6749,6 +7033,7 @@ void m68k_op_move_8_al_al(void)
 
    m68ki_write_8(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_8(res);
    FLAG_Z = res;
    FLAG_V = VFLAG_CLEAR;
@@ -6763,6 +7048,7 @@ void m68k_op_move_8_al_pcdi(void)
 
    m68ki_write_8(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_8(res);
    FLAG_Z = res;
    FLAG_V = VFLAG_CLEAR;
@@ -6777,6 +7063,7 @@ void m68k_op_move_8_al_pcix(void)
 
    m68ki_write_8(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_8(res);
    FLAG_Z = res;
    FLAG_V = VFLAG_CLEAR;
@@ -6791,6 +7078,7 @@ void m68k_op_move_8_al_i(void)
 
    m68ki_write_8(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_8(res);
    FLAG_Z = res;
    FLAG_V = VFLAG_CLEAR;
@@ -6805,6 +7093,7 @@ void m68k_op_move_16_d_d(void)
 
    *r_dst = MASK_OUT_BELOW_16(*r_dst) | res;
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_16(res);
    FLAG_Z = res;
    FLAG_V = VFLAG_CLEAR;
@@ -6819,6 +7108,7 @@ void m68k_op_move_16_d_a(void)
 
    *r_dst = MASK_OUT_BELOW_16(*r_dst) | res;
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_16(res);
    FLAG_Z = res;
    FLAG_V = VFLAG_CLEAR;
@@ -6833,6 +7123,7 @@ void m68k_op_move_16_d_ai(void)
 
    *r_dst = MASK_OUT_BELOW_16(*r_dst) | res;
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_16(res);
    FLAG_Z = res;
    FLAG_V = VFLAG_CLEAR;
@@ -6847,6 +7138,7 @@ void m68k_op_move_16_d_pi(void)
 
    *r_dst = MASK_OUT_BELOW_16(*r_dst) | res;
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_16(res);
    FLAG_Z = res;
    FLAG_V = VFLAG_CLEAR;
@@ -6861,6 +7153,7 @@ void m68k_op_move_16_d_pd(void)
 
    *r_dst = MASK_OUT_BELOW_16(*r_dst) | res;
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_16(res);
    FLAG_Z = res;
    FLAG_V = VFLAG_CLEAR;
@@ -6875,6 +7168,7 @@ void m68k_op_move_16_d_di(void)
 
    *r_dst = MASK_OUT_BELOW_16(*r_dst) | res;
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_16(res);
    FLAG_Z = res;
    FLAG_V = VFLAG_CLEAR;
@@ -6889,6 +7183,7 @@ void m68k_op_move_16_d_ix(void)
 
    *r_dst = MASK_OUT_BELOW_16(*r_dst) | res;
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_16(res);
    FLAG_Z = res;
    FLAG_V = VFLAG_CLEAR;
@@ -6903,6 +7198,7 @@ void m68k_op_move_16_d_aw(void)
 
    *r_dst = MASK_OUT_BELOW_16(*r_dst) | res;
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_16(res);
    FLAG_Z = res;
    FLAG_V = VFLAG_CLEAR;
@@ -6917,6 +7213,7 @@ void m68k_op_move_16_d_al(void)
 
    *r_dst = MASK_OUT_BELOW_16(*r_dst) | res;
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_16(res);
    FLAG_Z = res;
    FLAG_V = VFLAG_CLEAR;
@@ -6931,6 +7228,7 @@ void m68k_op_move_16_d_pcdi(void)
 
    *r_dst = MASK_OUT_BELOW_16(*r_dst) | res;
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_16(res);
    FLAG_Z = res;
    FLAG_V = VFLAG_CLEAR;
@@ -6945,6 +7243,7 @@ void m68k_op_move_16_d_pcix(void)
 
    *r_dst = MASK_OUT_BELOW_16(*r_dst) | res;
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_16(res);
    FLAG_Z = res;
    FLAG_V = VFLAG_CLEAR;
@@ -6959,6 +7258,7 @@ void m68k_op_move_16_d_i(void)
 
    *r_dst = MASK_OUT_BELOW_16(*r_dst) | res;
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_16(res);
    FLAG_Z = res;
    FLAG_V = VFLAG_CLEAR;
@@ -6973,6 +7273,7 @@ void m68k_op_move_16_ai_d(void)
 
    m68ki_write_16(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_16(res);
    FLAG_Z = res;
    FLAG_V = VFLAG_CLEAR;
@@ -6987,6 +7288,7 @@ void m68k_op_move_16_ai_a(void)
 
    m68ki_write_16(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_16(res);
    FLAG_Z = res;
    FLAG_V = VFLAG_CLEAR;
@@ -7001,6 +7303,7 @@ void m68k_op_move_16_ai_ai(void)
 
    m68ki_write_16(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_16(res);
    FLAG_Z = res;
    FLAG_V = VFLAG_CLEAR;
@@ -7015,6 +7318,7 @@ void m68k_op_move_16_ai_pi(void)
 
    m68ki_write_16(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_16(res);
    FLAG_Z = res;
    FLAG_V = VFLAG_CLEAR;
@@ -7029,6 +7333,7 @@ void m68k_op_move_16_ai_pd(void)
 
    m68ki_write_16(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_16(res);
    FLAG_Z = res;
    FLAG_V = VFLAG_CLEAR;
@@ -7043,6 +7348,7 @@ void m68k_op_move_16_ai_di(void)
 
    m68ki_write_16(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_16(res);
    FLAG_Z = res;
    FLAG_V = VFLAG_CLEAR;
@@ -7057,6 +7363,7 @@ void m68k_op_move_16_ai_ix(void)
 
    m68ki_write_16(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_16(res);
    FLAG_Z = res;
    FLAG_V = VFLAG_CLEAR;
@@ -7071,6 +7378,7 @@ void m68k_op_move_16_ai_aw(void)
 
    m68ki_write_16(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_16(res);
    FLAG_Z = res;
    FLAG_V = VFLAG_CLEAR;
@@ -7085,6 +7393,7 @@ void m68k_op_move_16_ai_al(void)
 
    m68ki_write_16(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_16(res);
    FLAG_Z = res;
    FLAG_V = VFLAG_CLEAR;
@@ -7099,6 +7408,7 @@ void m68k_op_move_16_ai_pcdi(void)
 
    m68ki_write_16(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_16(res);
    FLAG_Z = res;
    FLAG_V = VFLAG_CLEAR;
@@ -7113,6 +7423,7 @@ void m68k_op_move_16_ai_pcix(void)
 
    m68ki_write_16(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_16(res);
    FLAG_Z = res;
    FLAG_V = VFLAG_CLEAR;
@@ -7127,6 +7438,7 @@ void m68k_op_move_16_ai_i(void)
 
    m68ki_write_16(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_16(res);
    FLAG_Z = res;
    FLAG_V = VFLAG_CLEAR;
@@ -7141,6 +7453,7 @@ void m68k_op_move_16_pi_d(void)
 
    m68ki_write_16(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_16(res);
    FLAG_Z = res;
    FLAG_V = VFLAG_CLEAR;
@@ -7155,6 +7468,7 @@ void m68k_op_move_16_pi_a(void)
 
    m68ki_write_16(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_16(res);
    FLAG_Z = res;
    FLAG_V = VFLAG_CLEAR;
@@ -7169,6 +7483,7 @@ void m68k_op_move_16_pi_ai(void)
 
    m68ki_write_16(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_16(res);
    FLAG_Z = res;
    FLAG_V = VFLAG_CLEAR;
@@ -7183,6 +7498,7 @@ void m68k_op_move_16_pi_pi(void)
 
    m68ki_write_16(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_16(res);
    FLAG_Z = res;
    FLAG_V = VFLAG_CLEAR;
@@ -7197,6 +7513,7 @@ void m68k_op_move_16_pi_pd(void)
 
    m68ki_write_16(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_16(res);
    FLAG_Z = res;
    FLAG_V = VFLAG_CLEAR;
@@ -7211,6 +7528,7 @@ void m68k_op_move_16_pi_di(void)
 
    m68ki_write_16(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_16(res);
    FLAG_Z = res;
    FLAG_V = VFLAG_CLEAR;
@@ -7225,6 +7543,7 @@ void m68k_op_move_16_pi_ix(void)
 
    m68ki_write_16(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_16(res);
    FLAG_Z = res;
    FLAG_V = VFLAG_CLEAR;
@@ -7239,6 +7558,7 @@ void m68k_op_move_16_pi_aw(void)
 
    m68ki_write_16(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_16(res);
    FLAG_Z = res;
    FLAG_V = VFLAG_CLEAR;
@@ -7253,6 +7573,7 @@ void m68k_op_move_16_pi_al(void)
 
    m68ki_write_16(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_16(res);
    FLAG_Z = res;
    FLAG_V = VFLAG_CLEAR;
@@ -7267,6 +7588,7 @@ void m68k_op_move_16_pi_pcdi(void)
 
    m68ki_write_16(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_16(res);
    FLAG_Z = res;
    FLAG_V = VFLAG_CLEAR;
@@ -7281,6 +7603,7 @@ void m68k_op_move_16_pi_pcix(void)
 
    m68ki_write_16(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_16(res);
    FLAG_Z = res;
    FLAG_V = VFLAG_CLEAR;
@@ -7295,6 +7618,7 @@ void m68k_op_move_16_pi_i(void)
 
    m68ki_write_16(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_16(res);
    FLAG_Z = res;
    FLAG_V = VFLAG_CLEAR;
@@ -7309,6 +7633,7 @@ void m68k_op_move_16_pd_d(void)
 
    m68ki_write_16(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_16(res);
    FLAG_Z = res;
    FLAG_V = VFLAG_CLEAR;
@@ -7323,6 +7648,7 @@ void m68k_op_move_16_pd_a(void)
 
    m68ki_write_16(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_16(res);
    FLAG_Z = res;
    FLAG_V = VFLAG_CLEAR;
@@ -7337,6 +7663,7 @@ void m68k_op_move_16_pd_ai(void)
 
    m68ki_write_16(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_16(res);
    FLAG_Z = res;
    FLAG_V = VFLAG_CLEAR;
@@ -7351,6 +7678,7 @@ void m68k_op_move_16_pd_pi(void)
 
    m68ki_write_16(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_16(res);
    FLAG_Z = res;
    FLAG_V = VFLAG_CLEAR;
@@ -7365,6 +7693,7 @@ void m68k_op_move_16_pd_pd(void)
 
    m68ki_write_16(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_16(res);
    FLAG_Z = res;
    FLAG_V = VFLAG_CLEAR;
@@ -7379,6 +7708,7 @@ void m68k_op_move_16_pd_di(void)
 
    m68ki_write_16(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_16(res);
    FLAG_Z = res;
    FLAG_V = VFLAG_CLEAR;
@@ -7393,6 +7723,7 @@ void m68k_op_move_16_pd_ix(void)
 
    m68ki_write_16(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_16(res);
    FLAG_Z = res;
    FLAG_V = VFLAG_CLEAR;
@@ -7407,6 +7738,7 @@ void m68k_op_move_16_pd_aw(void)
 
    m68ki_write_16(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_16(res);
    FLAG_Z = res;
    FLAG_V = VFLAG_CLEAR;
@@ -7421,6 +7753,7 @@ void m68k_op_move_16_pd_al(void)
 
    m68ki_write_16(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_16(res);
    FLAG_Z = res;
    FLAG_V = VFLAG_CLEAR;
@@ -7435,6 +7768,7 @@ void m68k_op_move_16_pd_pcdi(void)
 
    m68ki_write_16(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_16(res);
    FLAG_Z = res;
    FLAG_V = VFLAG_CLEAR;
@@ -7449,6 +7783,7 @@ void m68k_op_move_16_pd_pcix(void)
 
    m68ki_write_16(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_16(res);
    FLAG_Z = res;
    FLAG_V = VFLAG_CLEAR;
@@ -7463,6 +7798,7 @@ void m68k_op_move_16_pd_i(void)
 
    m68ki_write_16(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_16(res);
    FLAG_Z = res;
    FLAG_V = VFLAG_CLEAR;
@@ -7477,6 +7813,7 @@ void m68k_op_move_16_di_d(void)
 
    m68ki_write_16(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_16(res);
    FLAG_Z = res;
    FLAG_V = VFLAG_CLEAR;
@@ -7491,6 +7828,7 @@ void m68k_op_move_16_di_a(void)
 
    m68ki_write_16(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_16(res);
    FLAG_Z = res;
    FLAG_V = VFLAG_CLEAR;
@@ -7505,6 +7843,7 @@ void m68k_op_move_16_di_ai(void)
 
    m68ki_write_16(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_16(res);
    FLAG_Z = res;
    FLAG_V = VFLAG_CLEAR;
@@ -7519,6 +7858,7 @@ void m68k_op_move_16_di_pi(void)
 
    m68ki_write_16(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_16(res);
    FLAG_Z = res;
    FLAG_V = VFLAG_CLEAR;
@@ -7533,6 +7873,7 @@ void m68k_op_move_16_di_pd(void)
 
    m68ki_write_16(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_16(res);
    FLAG_Z = res;
    FLAG_V = VFLAG_CLEAR;
@@ -7547,6 +7888,7 @@ void m68k_op_move_16_di_di(void)
 
    m68ki_write_16(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_16(res);
    FLAG_Z = res;
    FLAG_V = VFLAG_CLEAR;
@@ -7561,6 +7903,7 @@ void m68k_op_move_16_di_ix(void)
 
    m68ki_write_16(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_16(res);
    FLAG_Z = res;
    FLAG_V = VFLAG_CLEAR;
@@ -7575,6 +7918,7 @@ void m68k_op_move_16_di_aw(void)
 
    m68ki_write_16(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_16(res);
    FLAG_Z = res;
    FLAG_V = VFLAG_CLEAR;
@@ -7589,6 +7933,7 @@ void m68k_op_move_16_di_al(void)
 
    m68ki_write_16(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_16(res);
    FLAG_Z = res;
    FLAG_V = VFLAG_CLEAR;
@@ -7603,6 +7948,7 @@ void m68k_op_move_16_di_pcdi(void)
 
    m68ki_write_16(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_16(res);
    FLAG_Z = res;
    FLAG_V = VFLAG_CLEAR;
@@ -7617,6 +7963,7 @@ void m68k_op_move_16_di_pcix(void)
 
    m68ki_write_16(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_16(res);
    FLAG_Z = res;
    FLAG_V = VFLAG_CLEAR;
@@ -7631,6 +7978,7 @@ void m68k_op_move_16_di_i(void)
 
    m68ki_write_16(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_16(res);
    FLAG_Z = res;
    FLAG_V = VFLAG_CLEAR;
@@ -7645,6 +7993,7 @@ void m68k_op_move_16_ix_d(void)
 
    m68ki_write_16(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_16(res);
    FLAG_Z = res;
    FLAG_V = VFLAG_CLEAR;
@@ -7659,6 +8008,7 @@ void m68k_op_move_16_ix_a(void)
 
    m68ki_write_16(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_16(res);
    FLAG_Z = res;
    FLAG_V = VFLAG_CLEAR;
@@ -7673,6 +8023,7 @@ void m68k_op_move_16_ix_ai(void)
 
    m68ki_write_16(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_16(res);
    FLAG_Z = res;
    FLAG_V = VFLAG_CLEAR;
@@ -7687,6 +8038,7 @@ void m68k_op_move_16_ix_pi(void)
 
    m68ki_write_16(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_16(res);
    FLAG_Z = res;
    FLAG_V = VFLAG_CLEAR;
@@ -7701,6 +8053,7 @@ void m68k_op_move_16_ix_pd(void)
 
    m68ki_write_16(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_16(res);
    FLAG_Z = res;
    FLAG_V = VFLAG_CLEAR;
@@ -7715,6 +8068,7 @@ void m68k_op_move_16_ix_di(void)
 
    m68ki_write_16(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_16(res);
    FLAG_Z = res;
    FLAG_V = VFLAG_CLEAR;
@@ -7729,6 +8083,7 @@ void m68k_op_move_16_ix_ix(void)
 
    m68ki_write_16(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_16(res);
    FLAG_Z = res;
    FLAG_V = VFLAG_CLEAR;
@@ -7743,6 +8098,7 @@ void m68k_op_move_16_ix_aw(void)
 
    m68ki_write_16(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_16(res);
    FLAG_Z = res;
    FLAG_V = VFLAG_CLEAR;
@@ -7757,6 +8113,7 @@ void m68k_op_move_16_ix_al(void)
 
    m68ki_write_16(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_16(res);
    FLAG_Z = res;
    FLAG_V = VFLAG_CLEAR;
@@ -7771,6 +8128,7 @@ void m68k_op_move_16_ix_pcdi(void)
 
    m68ki_write_16(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_16(res);
    FLAG_Z = res;
    FLAG_V = VFLAG_CLEAR;
@@ -7785,6 +8143,7 @@ void m68k_op_move_16_ix_pcix(void)
 
    m68ki_write_16(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_16(res);
    FLAG_Z = res;
    FLAG_V = VFLAG_CLEAR;
@@ -7799,6 +8158,7 @@ void m68k_op_move_16_ix_i(void)
 
    m68ki_write_16(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_16(res);
    FLAG_Z = res;
    FLAG_V = VFLAG_CLEAR;
@@ -7813,6 +8173,7 @@ void m68k_op_move_16_aw_d(void)
 
    m68ki_write_16(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_16(res);
    FLAG_Z = res;
    FLAG_V = VFLAG_CLEAR;
@@ -7827,6 +8188,7 @@ void m68k_op_move_16_aw_a(void)
 
    m68ki_write_16(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_16(res);
    FLAG_Z = res;
    FLAG_V = VFLAG_CLEAR;
@@ -7841,6 +8203,7 @@ void m68k_op_move_16_aw_ai(void)
 
    m68ki_write_16(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_16(res);
    FLAG_Z = res;
    FLAG_V = VFLAG_CLEAR;
@@ -7855,6 +8218,7 @@ void m68k_op_move_16_aw_pi(void)
 
    m68ki_write_16(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_16(res);
    FLAG_Z = res;
    FLAG_V = VFLAG_CLEAR;
@@ -7869,6 +8233,7 @@ void m68k_op_move_16_aw_pd(void)
 
    m68ki_write_16(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_16(res);
    FLAG_Z = res;
    FLAG_V = VFLAG_CLEAR;
@@ -7883,6 +8248,7 @@ void m68k_op_move_16_aw_di(void)
 
    m68ki_write_16(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_16(res);
    FLAG_Z = res;
    FLAG_V = VFLAG_CLEAR;
@@ -7897,6 +8263,7 @@ void m68k_op_move_16_aw_ix(void)
 
    m68ki_write_16(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_16(res);
    FLAG_Z = res;
    FLAG_V = VFLAG_CLEAR;
@@ -7911,6 +8278,7 @@ void m68k_op_move_16_aw_aw(void)
 
    m68ki_write_16(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_16(res);
    FLAG_Z = res;
    FLAG_V = VFLAG_CLEAR;
@@ -7925,6 +8293,7 @@ void m68k_op_move_16_aw_al(void)
 
    m68ki_write_16(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_16(res);
    FLAG_Z = res;
    FLAG_V = VFLAG_CLEAR;
@@ -7939,6 +8308,7 @@ void m68k_op_move_16_aw_pcdi(void)
 
    m68ki_write_16(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_16(res);
    FLAG_Z = res;
    FLAG_V = VFLAG_CLEAR;
@@ -7953,6 +8323,7 @@ void m68k_op_move_16_aw_pcix(void)
 
    m68ki_write_16(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_16(res);
    FLAG_Z = res;
    FLAG_V = VFLAG_CLEAR;
@@ -7967,6 +8338,7 @@ void m68k_op_move_16_aw_i(void)
 
    m68ki_write_16(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_16(res);
    FLAG_Z = res;
    FLAG_V = VFLAG_CLEAR;
@@ -7981,6 +8353,7 @@ void m68k_op_move_16_al_d(void)
 
    m68ki_write_16(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_16(res);
    FLAG_Z = res;
    FLAG_V = VFLAG_CLEAR;
@@ -7995,6 +8368,7 @@ void m68k_op_move_16_al_a(void)
 
    m68ki_write_16(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_16(res);
    FLAG_Z = res;
    FLAG_V = VFLAG_CLEAR;
@@ -8009,6 +8383,7 @@ void m68k_op_move_16_al_ai(void)
 
    m68ki_write_16(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_16(res);
    FLAG_Z = res;
    FLAG_V = VFLAG_CLEAR;
@@ -8023,6 +8398,7 @@ void m68k_op_move_16_al_pi(void)
 
    m68ki_write_16(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_16(res);
    FLAG_Z = res;
    FLAG_V = VFLAG_CLEAR;
@@ -8037,6 +8413,7 @@ void m68k_op_move_16_al_pd(void)
 
    m68ki_write_16(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_16(res);
    FLAG_Z = res;
    FLAG_V = VFLAG_CLEAR;
@@ -8051,6 +8428,7 @@ void m68k_op_move_16_al_di(void)
 
    m68ki_write_16(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_16(res);
    FLAG_Z = res;
    FLAG_V = VFLAG_CLEAR;
@@ -8065,6 +8443,7 @@ void m68k_op_move_16_al_ix(void)
 
    m68ki_write_16(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_16(res);
    FLAG_Z = res;
    FLAG_V = VFLAG_CLEAR;
@@ -8079,6 +8458,7 @@ void m68k_op_move_16_al_aw(void)
 
    m68ki_write_16(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_16(res);
    FLAG_Z = res;
    FLAG_V = VFLAG_CLEAR;
@@ -8093,6 +8473,7 @@ void m68k_op_move_16_al_al(void)
 
    m68ki_write_16(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_16(res);
    FLAG_Z = res;
    FLAG_V = VFLAG_CLEAR;
@@ -8107,6 +8488,7 @@ void m68k_op_move_16_al_pcdi(void)
 
    m68ki_write_16(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_16(res);
    FLAG_Z = res;
    FLAG_V = VFLAG_CLEAR;
@@ -8121,6 +8503,7 @@ void m68k_op_move_16_al_pcix(void)
 
    m68ki_write_16(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_16(res);
    FLAG_Z = res;
    FLAG_V = VFLAG_CLEAR;
@@ -8135,6 +8518,7 @@ void m68k_op_move_16_al_i(void)
 
    m68ki_write_16(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_16(res);
    FLAG_Z = res;
    FLAG_V = VFLAG_CLEAR;
@@ -8149,6 +8533,7 @@ void m68k_op_move_32_d_d(void)
 
    *r_dst = res;
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_32(res);
    FLAG_Z = res;
    FLAG_V = VFLAG_CLEAR;
@@ -8163,6 +8548,7 @@ void m68k_op_move_32_d_a(void)
 
    *r_dst = res;
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_32(res);
    FLAG_Z = res;
    FLAG_V = VFLAG_CLEAR;
@@ -8177,6 +8563,7 @@ void m68k_op_move_32_d_ai(void)
 
    *r_dst = res;
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_32(res);
    FLAG_Z = res;
    FLAG_V = VFLAG_CLEAR;
@@ -8191,6 +8578,7 @@ void m68k_op_move_32_d_pi(void)
 
    *r_dst = res;
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_32(res);
    FLAG_Z = res;
    FLAG_V = VFLAG_CLEAR;
@@ -8205,6 +8593,7 @@ void m68k_op_move_32_d_pd(void)
 
    *r_dst = res;
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_32(res);
    FLAG_Z = res;
    FLAG_V = VFLAG_CLEAR;
@@ -8219,6 +8608,7 @@ void m68k_op_move_32_d_di(void)
 
    *r_dst = res;
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_32(res);
    FLAG_Z = res;
    FLAG_V = VFLAG_CLEAR;
@@ -8233,6 +8623,7 @@ void m68k_op_move_32_d_ix(void)
 
    *r_dst = res;
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_32(res);
    FLAG_Z = res;
    FLAG_V = VFLAG_CLEAR;
@@ -8247,6 +8638,7 @@ void m68k_op_move_32_d_aw(void)
 
    *r_dst = res;
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_32(res);
    FLAG_Z = res;
    FLAG_V = VFLAG_CLEAR;
@@ -8261,6 +8653,7 @@ void m68k_op_move_32_d_al(void)
 
    *r_dst = res;
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_32(res);
    FLAG_Z = res;
    FLAG_V = VFLAG_CLEAR;
@@ -8275,6 +8668,7 @@ void m68k_op_move_32_d_pcdi(void)
 
    *r_dst = res;
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_32(res);
    FLAG_Z = res;
    FLAG_V = VFLAG_CLEAR;
@@ -8289,6 +8683,7 @@ void m68k_op_move_32_d_pcix(void)
 
    *r_dst = res;
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_32(res);
    FLAG_Z = res;
    FLAG_V = VFLAG_CLEAR;
@@ -8303,6 +8698,7 @@ void m68k_op_move_32_d_i(void)
 
    *r_dst = res;
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_32(res);
    FLAG_Z = res;
    FLAG_V = VFLAG_CLEAR;
@@ -8317,6 +8713,7 @@ void m68k_op_move_32_ai_d(void)
 
    m68ki_write_32(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_32(res);
    FLAG_Z = res;
    FLAG_V = VFLAG_CLEAR;
@@ -8331,6 +8728,7 @@ void m68k_op_move_32_ai_a(void)
 
    m68ki_write_32(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_32(res);
    FLAG_Z = res;
    FLAG_V = VFLAG_CLEAR;
@@ -8345,6 +8743,7 @@ void m68k_op_move_32_ai_ai(void)
 
    m68ki_write_32(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_32(res);
    FLAG_Z = res;
    FLAG_V = VFLAG_CLEAR;
@@ -8359,6 +8758,7 @@ void m68k_op_move_32_ai_pi(void)
 
    m68ki_write_32(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_32(res);
    FLAG_Z = res;
    FLAG_V = VFLAG_CLEAR;
@@ -8373,6 +8773,7 @@ void m68k_op_move_32_ai_pd(void)
 
    m68ki_write_32(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_32(res);
    FLAG_Z = res;
    FLAG_V = VFLAG_CLEAR;
@@ -8387,6 +8788,7 @@ void m68k_op_move_32_ai_di(void)
 
    m68ki_write_32(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_32(res);
    FLAG_Z = res;
    FLAG_V = VFLAG_CLEAR;
@@ -8401,6 +8803,7 @@ void m68k_op_move_32_ai_ix(void)
 
    m68ki_write_32(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_32(res);
    FLAG_Z = res;
    FLAG_V = VFLAG_CLEAR;
@@ -8415,6 +8818,7 @@ void m68k_op_move_32_ai_aw(void)
 
    m68ki_write_32(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_32(res);
    FLAG_Z = res;
    FLAG_V = VFLAG_CLEAR;
@@ -8429,6 +8833,7 @@ void m68k_op_move_32_ai_al(void)
 
    m68ki_write_32(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_32(res);
    FLAG_Z = res;
    FLAG_V = VFLAG_CLEAR;
@@ -8443,6 +8848,7 @@ void m68k_op_move_32_ai_pcdi(void)
 
    m68ki_write_32(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_32(res);
    FLAG_Z = res;
    FLAG_V = VFLAG_CLEAR;
@@ -8457,6 +8863,7 @@ void m68k_op_move_32_ai_pcix(void)
 
    m68ki_write_32(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_32(res);
    FLAG_Z = res;
    FLAG_V = VFLAG_CLEAR;
@@ -8471,6 +8878,7 @@ void m68k_op_move_32_ai_i(void)
 
    m68ki_write_32(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_32(res);
    FLAG_Z = res;
    FLAG_V = VFLAG_CLEAR;
@@ -8485,6 +8893,7 @@ void m68k_op_move_32_pi_d(void)
 
    m68ki_write_32(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_32(res);
    FLAG_Z = res;
    FLAG_V = VFLAG_CLEAR;
@@ -8499,6 +8908,7 @@ void m68k_op_move_32_pi_a(void)
 
    m68ki_write_32(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_32(res);
    FLAG_Z = res;
    FLAG_V = VFLAG_CLEAR;
@@ -8513,6 +8923,7 @@ void m68k_op_move_32_pi_ai(void)
 
    m68ki_write_32(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_32(res);
    FLAG_Z = res;
    FLAG_V = VFLAG_CLEAR;
@@ -8527,6 +8938,7 @@ void m68k_op_move_32_pi_pi(void)
 
    m68ki_write_32(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_32(res);
    FLAG_Z = res;
    FLAG_V = VFLAG_CLEAR;
@@ -8541,6 +8953,7 @@ void m68k_op_move_32_pi_pd(void)
 
    m68ki_write_32(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_32(res);
    FLAG_Z = res;
    FLAG_V = VFLAG_CLEAR;
@@ -8555,6 +8968,7 @@ void m68k_op_move_32_pi_di(void)
 
    m68ki_write_32(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_32(res);
    FLAG_Z = res;
    FLAG_V = VFLAG_CLEAR;
@@ -8569,6 +8983,7 @@ void m68k_op_move_32_pi_ix(void)
 
    m68ki_write_32(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_32(res);
    FLAG_Z = res;
    FLAG_V = VFLAG_CLEAR;
@@ -8583,6 +8998,7 @@ void m68k_op_move_32_pi_aw(void)
 
    m68ki_write_32(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_32(res);
    FLAG_Z = res;
    FLAG_V = VFLAG_CLEAR;
@@ -8597,6 +9013,7 @@ void m68k_op_move_32_pi_al(void)
 
    m68ki_write_32(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_32(res);
    FLAG_Z = res;
    FLAG_V = VFLAG_CLEAR;
@@ -8611,6 +9028,7 @@ void m68k_op_move_32_pi_pcdi(void)
 
    m68ki_write_32(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_32(res);
    FLAG_Z = res;
    FLAG_V = VFLAG_CLEAR;
@@ -8625,6 +9043,7 @@ void m68k_op_move_32_pi_pcix(void)
 
    m68ki_write_32(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_32(res);
    FLAG_Z = res;
    FLAG_V = VFLAG_CLEAR;
@@ -8639,6 +9058,7 @@ void m68k_op_move_32_pi_i(void)
 
    m68ki_write_32(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_32(res);
    FLAG_Z = res;
    FLAG_V = VFLAG_CLEAR;
@@ -8653,6 +9073,7 @@ void m68k_op_move_32_pd_d(void)
 
    m68ki_write_32(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_32(res);
    FLAG_Z = res;
    FLAG_V = VFLAG_CLEAR;
@@ -8667,6 +9088,7 @@ void m68k_op_move_32_pd_a(void)
 
    m68ki_write_32(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_32(res);
    FLAG_Z = res;
    FLAG_V = VFLAG_CLEAR;
@@ -8681,6 +9103,7 @@ void m68k_op_move_32_pd_ai(void)
 
    m68ki_write_32(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_32(res);
    FLAG_Z = res;
    FLAG_V = VFLAG_CLEAR;
@@ -8695,6 +9118,7 @@ void m68k_op_move_32_pd_pi(void)
 
    m68ki_write_32(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_32(res);
    FLAG_Z = res;
    FLAG_V = VFLAG_CLEAR;
@@ -8709,6 +9133,7 @@ void m68k_op_move_32_pd_pd(void)
 
    m68ki_write_32(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_32(res);
    FLAG_Z = res;
    FLAG_V = VFLAG_CLEAR;
@@ -8723,6 +9148,7 @@ void m68k_op_move_32_pd_di(void)
 
    m68ki_write_32(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_32(res);
    FLAG_Z = res;
    FLAG_V = VFLAG_CLEAR;
@@ -8737,6 +9163,7 @@ void m68k_op_move_32_pd_ix(void)
 
    m68ki_write_32(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_32(res);
    FLAG_Z = res;
    FLAG_V = VFLAG_CLEAR;
@@ -8751,6 +9178,7 @@ void m68k_op_move_32_pd_aw(void)
 
    m68ki_write_32(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_32(res);
    FLAG_Z = res;
    FLAG_V = VFLAG_CLEAR;
@@ -8765,6 +9193,7 @@ void m68k_op_move_32_pd_al(void)
 
    m68ki_write_32(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_32(res);
    FLAG_Z = res;
    FLAG_V = VFLAG_CLEAR;
@@ -8779,6 +9208,7 @@ void m68k_op_move_32_pd_pcdi(void)
 
    m68ki_write_32(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_32(res);
    FLAG_Z = res;
    FLAG_V = VFLAG_CLEAR;
@@ -8793,6 +9223,7 @@ void m68k_op_move_32_pd_pcix(void)
 
    m68ki_write_32(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_32(res);
    FLAG_Z = res;
    FLAG_V = VFLAG_CLEAR;
@@ -8807,6 +9238,7 @@ void m68k_op_move_32_pd_i(void)
 
    m68ki_write_32(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_32(res);
    FLAG_Z = res;
    FLAG_V = VFLAG_CLEAR;
@@ -8821,6 +9253,7 @@ void m68k_op_move_32_di_d(void)
 
    m68ki_write_32(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_32(res);
    FLAG_Z = res;
    FLAG_V = VFLAG_CLEAR;
@@ -8835,6 +9268,7 @@ void m68k_op_move_32_di_a(void)
 
    m68ki_write_32(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_32(res);
    FLAG_Z = res;
    FLAG_V = VFLAG_CLEAR;
@@ -8849,6 +9283,7 @@ void m68k_op_move_32_di_ai(void)
 
    m68ki_write_32(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_32(res);
    FLAG_Z = res;
    FLAG_V = VFLAG_CLEAR;
@@ -8863,6 +9298,7 @@ void m68k_op_move_32_di_pi(void)
 
    m68ki_write_32(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_32(res);
    FLAG_Z = res;
    FLAG_V = VFLAG_CLEAR;
@@ -8877,6 +9313,7 @@ void m68k_op_move_32_di_pd(void)
 
    m68ki_write_32(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_32(res);
    FLAG_Z = res;
    FLAG_V = VFLAG_CLEAR;
@@ -8891,6 +9328,7 @@ void m68k_op_move_32_di_di(void)
 
    m68ki_write_32(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_32(res);
    FLAG_Z = res;
    FLAG_V = VFLAG_CLEAR;
@@ -8905,6 +9343,7 @@ void m68k_op_move_32_di_ix(void)
 
    m68ki_write_32(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_32(res);
    FLAG_Z = res;
    FLAG_V = VFLAG_CLEAR;
@@ -8919,6 +9358,7 @@ void m68k_op_move_32_di_aw(void)
 
    m68ki_write_32(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_32(res);
    FLAG_Z = res;
    FLAG_V = VFLAG_CLEAR;
@@ -8933,6 +9373,7 @@ void m68k_op_move_32_di_al(void)
 
    m68ki_write_32(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_32(res);
    FLAG_Z = res;
    FLAG_V = VFLAG_CLEAR;
@@ -8947,6 +9388,7 @@ void m68k_op_move_32_di_pcdi(void)
 
    m68ki_write_32(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_32(res);
    FLAG_Z = res;
    FLAG_V = VFLAG_CLEAR;
@@ -8961,6 +9403,7 @@ void m68k_op_move_32_di_pcix(void)
 
    m68ki_write_32(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_32(res);
    FLAG_Z = res;
    FLAG_V = VFLAG_CLEAR;
@@ -8975,6 +9418,7 @@ void m68k_op_move_32_di_i(void)
 
    m68ki_write_32(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_32(res);
    FLAG_Z = res;
    FLAG_V = VFLAG_CLEAR;
@@ -8989,6 +9433,7 @@ void m68k_op_move_32_ix_d(void)
 
    m68ki_write_32(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_32(res);
    FLAG_Z = res;
    FLAG_V = VFLAG_CLEAR;
@@ -9003,6 +9448,7 @@ void m68k_op_move_32_ix_a(void)
 
    m68ki_write_32(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_32(res);
    FLAG_Z = res;
    FLAG_V = VFLAG_CLEAR;
@@ -9017,6 +9463,7 @@ void m68k_op_move_32_ix_ai(void)
 
    m68ki_write_32(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_32(res);
    FLAG_Z = res;
    FLAG_V = VFLAG_CLEAR;
@@ -9031,6 +9478,7 @@ void m68k_op_move_32_ix_pi(void)
 
    m68ki_write_32(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_32(res);
    FLAG_Z = res;
    FLAG_V = VFLAG_CLEAR;
@@ -9045,6 +9493,7 @@ void m68k_op_move_32_ix_pd(void)
 
    m68ki_write_32(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_32(res);
    FLAG_Z = res;
    FLAG_V = VFLAG_CLEAR;
@@ -9059,6 +9508,7 @@ void m68k_op_move_32_ix_di(void)
 
    m68ki_write_32(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_32(res);
    FLAG_Z = res;
    FLAG_V = VFLAG_CLEAR;
@@ -9073,6 +9523,7 @@ void m68k_op_move_32_ix_ix(void)
 
    m68ki_write_32(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_32(res);
    FLAG_Z = res;
    FLAG_V = VFLAG_CLEAR;
@@ -9087,6 +9538,7 @@ void m68k_op_move_32_ix_aw(void)
 
    m68ki_write_32(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_32(res);
    FLAG_Z = res;
    FLAG_V = VFLAG_CLEAR;
@@ -9101,6 +9553,7 @@ void m68k_op_move_32_ix_al(void)
 
    m68ki_write_32(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_32(res);
    FLAG_Z = res;
    FLAG_V = VFLAG_CLEAR;
@@ -9115,6 +9568,7 @@ void m68k_op_move_32_ix_pcdi(void)
 
    m68ki_write_32(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_32(res);
    FLAG_Z = res;
    FLAG_V = VFLAG_CLEAR;
@@ -9129,6 +9583,7 @@ void m68k_op_move_32_ix_pcix(void)
 
    m68ki_write_32(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_32(res);
    FLAG_Z = res;
    FLAG_V = VFLAG_CLEAR;
@@ -9143,6 +9598,7 @@ void m68k_op_move_32_ix_i(void)
 
    m68ki_write_32(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_32(res);
    FLAG_Z = res;
    FLAG_V = VFLAG_CLEAR;
@@ -9157,6 +9613,7 @@ void m68k_op_move_32_aw_d(void)
 
    m68ki_write_32(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_32(res);
    FLAG_Z = res;
    FLAG_V = VFLAG_CLEAR;
@@ -9171,6 +9628,7 @@ void m68k_op_move_32_aw_a(void)
 
    m68ki_write_32(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_32(res);
    FLAG_Z = res;
    FLAG_V = VFLAG_CLEAR;
@@ -9185,6 +9643,7 @@ void m68k_op_move_32_aw_ai(void)
 
    m68ki_write_32(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_32(res);
    FLAG_Z = res;
    FLAG_V = VFLAG_CLEAR;
@@ -9199,6 +9658,7 @@ void m68k_op_move_32_aw_pi(void)
 
    m68ki_write_32(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_32(res);
    FLAG_Z = res;
    FLAG_V = VFLAG_CLEAR;
@@ -9213,6 +9673,7 @@ void m68k_op_move_32_aw_pd(void)
 
    m68ki_write_32(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_32(res);
    FLAG_Z = res;
    FLAG_V = VFLAG_CLEAR;
@@ -9227,6 +9688,7 @@ void m68k_op_move_32_aw_di(void)
 
    m68ki_write_32(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_32(res);
    FLAG_Z = res;
    FLAG_V = VFLAG_CLEAR;
@@ -9241,6 +9703,7 @@ void m68k_op_move_32_aw_ix(void)
 
    m68ki_write_32(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_32(res);
    FLAG_Z = res;
    FLAG_V = VFLAG_CLEAR;
@@ -9255,6 +9718,7 @@ void m68k_op_move_32_aw_aw(void)
 
    m68ki_write_32(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_32(res);
    FLAG_Z = res;
    FLAG_V = VFLAG_CLEAR;
@@ -9269,6 +9733,7 @@ void m68k_op_move_32_aw_al(void)
 
    m68ki_write_32(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_32(res);
    FLAG_Z = res;
    FLAG_V = VFLAG_CLEAR;
@@ -9283,6 +9748,7 @@ void m68k_op_move_32_aw_pcdi(void)
 
    m68ki_write_32(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_32(res);
    FLAG_Z = res;
    FLAG_V = VFLAG_CLEAR;
@@ -9297,6 +9763,7 @@ void m68k_op_move_32_aw_pcix(void)
 
    m68ki_write_32(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_32(res);
    FLAG_Z = res;
    FLAG_V = VFLAG_CLEAR;
@@ -9311,6 +9778,7 @@ void m68k_op_move_32_aw_i(void)
 
    m68ki_write_32(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_32(res);
    FLAG_Z = res;
    FLAG_V = VFLAG_CLEAR;
@@ -9325,6 +9793,7 @@ void m68k_op_move_32_al_d(void)
 
    m68ki_write_32(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_32(res);
    FLAG_Z = res;
    FLAG_V = VFLAG_CLEAR;
@@ -9339,6 +9808,7 @@ void m68k_op_move_32_al_a(void)
 
    m68ki_write_32(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_32(res);
    FLAG_Z = res;
    FLAG_V = VFLAG_CLEAR;
@@ -9353,6 +9823,7 @@ void m68k_op_move_32_al_ai(void)
 
    m68ki_write_32(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_32(res);
    FLAG_Z = res;
    FLAG_V = VFLAG_CLEAR;
@@ -9367,6 +9838,7 @@ void m68k_op_move_32_al_pi(void)
 
    m68ki_write_32(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_32(res);
    FLAG_Z = res;
    FLAG_V = VFLAG_CLEAR;
@@ -9381,6 +9853,7 @@ void m68k_op_move_32_al_pd(void)
 
    m68ki_write_32(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_32(res);
    FLAG_Z = res;
    FLAG_V = VFLAG_CLEAR;
@@ -9395,6 +9868,7 @@ void m68k_op_move_32_al_di(void)
 
    m68ki_write_32(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_32(res);
    FLAG_Z = res;
    FLAG_V = VFLAG_CLEAR;
@@ -9409,6 +9883,7 @@ void m68k_op_move_32_al_ix(void)
 
    m68ki_write_32(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_32(res);
    FLAG_Z = res;
    FLAG_V = VFLAG_CLEAR;
@@ -9423,6 +9898,7 @@ void m68k_op_move_32_al_aw(void)
 
    m68ki_write_32(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_32(res);
    FLAG_Z = res;
    FLAG_V = VFLAG_CLEAR;
@@ -9437,6 +9913,7 @@ void m68k_op_move_32_al_al(void)
 
    m68ki_write_32(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_32(res);
    FLAG_Z = res;
    FLAG_V = VFLAG_CLEAR;
@@ -9451,6 +9928,7 @@ void m68k_op_move_32_al_pcdi(void)
 
    m68ki_write_32(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_32(res);
    FLAG_Z = res;
    FLAG_V = VFLAG_CLEAR;
@@ -9465,6 +9943,7 @@ void m68k_op_move_32_al_pcix(void)
 
    m68ki_write_32(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_32(res);
    FLAG_Z = res;
    FLAG_V = VFLAG_CLEAR;
@@ -9479,6 +9958,7 @@ void m68k_op_move_32_al_i(void)
 
    m68ki_write_32(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_32(res);
    FLAG_Z = res;
    FLAG_V = VFLAG_CLEAR;
@@ -11537,6 +12017,7 @@ void m68k_op_moveq_32(void)
 {
    uint res = DX = MAKE_INT_8(MASK_OUT_ABOVE_8(REG_IR));
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_32(res);
    FLAG_Z = res;
    FLAG_V = VFLAG_CLEAR;
@@ -11551,6 +12032,7 @@ void m68k_op_muls_16_d(void)
 
    *r_dst = res;
 
+   m68ki_discard_lazy_flags();
    FLAG_Z = res;
    FLAG_N = NFLAG_32(res);
    FLAG_V = VFLAG_CLEAR;
@@ -11565,6 +12047,7 @@ void m68k_op_muls_16_ai(void)
 
    *r_dst = res;
 
+   m68ki_discard_lazy_flags();
    FLAG_Z = res;
    FLAG_N = NFLAG_32(res);
    FLAG_V = VFLAG_CLEAR;
@@ -11579,6 +12062,7 @@ void m68k_op_muls_16_pi(void)
 
    *r_dst = res;
 
+   m68ki_discard_lazy_flags();
    FLAG_Z = res;
    FLAG_N = NFLAG_32(res);
    FLAG_V = VFLAG_CLEAR;
@@ -11593,6 +12077,7 @@ void m68k_op_muls_16_pd(void)
 
    *r_dst = res;
 
+   m68ki_discard_lazy_flags();
    FLAG_Z = res;
    FLAG_N = NFLAG_32(res);
    FLAG_V = VFLAG_CLEAR;
@@ -11607,6 +12092,7 @@ void m68k_op_muls_16_di(void)
 
    *r_dst = res;
 
+   m68ki_discard_lazy_flags();
    FLAG_Z = res;
    FLAG_N = NFLAG_32(res);
    FLAG_V = VFLAG_CLEAR;
@@ -11621,6 +12107,7 @@ void m68k_op_muls_16_ix(void)
 
    *r_dst = res;
 
+   m68ki_discard_lazy_flags();
    FLAG_Z = res;
    FLAG_N = NFLAG_32(res);
    FLAG_V = VFLAG_CLEAR;
@@ -11635,6 +12122,7 @@ void m68k_op_muls_16_aw(void)
 
    *r_dst = res;
 
+   m68ki_discard_lazy_flags();
    FLAG_Z = res;
    FLAG_N = NFLAG_32(res);
    FLAG_V = VFLAG_CLEAR;
@@ -11649,6 +12137,7 @@ void m68k_op_muls_16_al(void)
 
    *r_dst = res;
 
+   m68ki_discard_lazy_flags();
    FLAG_Z = res;
    FLAG_N = NFLAG_32(res);
    FLAG_V = VFLAG_CLEAR;
@@ -11663,6 +12152,7 @@ void m68k_op_muls_16_pcdi(void)
 
    *r_dst = res;
 
+   m68ki_discard_lazy_flags();
    FLAG_Z = res;
    FLAG_N = NFLAG_32(res);
    FLAG_V = VFLAG_CLEAR;
@@ -11677,6 +12167,7 @@ void m68k_op_muls_16_pcix(void)
 
    *r_dst = res;
 
+   m68ki_discard_lazy_flags();
    FLAG_Z = res;
    FLAG_N = NFLAG_32(res);
    FLAG_V = VFLAG_CLEAR;
@@ -11691,6 +12182,7 @@ void m68k_op_muls_16_i(void)
 
    *r_dst = res;
 
+   m68ki_discard_lazy_flags();
    FLAG_Z = res;
    FLAG_N = NFLAG_32(res);
    FLAG_V = VFLAG_CLEAR;
@@ -11705,6 +12197,7 @@ void m68k_op_mulu_16_d(void)
 
    *r_dst = res;
 
+   m68ki_discard_lazy_flags();
    FLAG_Z = res;
    FLAG_N = NFLAG_32(res);
    FLAG_V = VFLAG_CLEAR;
@@ -11719,6 +12212,7 @@ void m68k_op_mulu_16_ai(void)
 
    *r_dst = res;
 
+   m68ki_discard_lazy_flags();
    FLAG_Z = res;
    FLAG_N = NFLAG_32(res);
    FLAG_V = VFLAG_CLEAR;
@@ -11733,6 +12227,7 @@ void m68k_op_mulu_16_pi(void)
 
    *r_dst = res;
 
+   m68ki_discard_lazy_flags();
    FLAG_Z = res;
    FLAG_N = NFLAG_32(res);
    FLAG_V = VFLAG_CLEAR;
@@ -11747,6 +12242,7 @@ void m68k_op_mulu_16_pd(void)
 
    *r_dst = res;
 
+   m68ki_discard_lazy_flags();
    FLAG_Z = res;
    FLAG_N = NFLAG_32(res);
    FLAG_V = VFLAG_CLEAR;
@@ -11761,6 +12257,7 @@ void m68k_op_mulu_16_di(void)
 
    *r_dst = res;
 
+   m68ki_discard_lazy_flags();
    FLAG_Z = res;
    FLAG_N = NFLAG_32(res);
    FLAG_V = VFLAG_CLEAR;
@@ -11775,6 +12272,7 @@ void m68k_op_mulu_16_ix(void)
 
    *r_dst = res;
 
+   m68ki_discard_lazy_flags();
    FLAG_Z = res;
    FLAG_N = NFLAG_32(res);
    FLAG_V = VFLAG_CLEAR;
@@ -11789,6 +12287,7 @@ void m68k_op_mulu_16_aw(void)
 
    *r_dst = res;
 
+   m68ki_discard_lazy_flags();
    FLAG_Z = res;
    FLAG_N = NFLAG_32(res);
    FLAG_V = VFLAG_CLEAR;
@@ -11803,6 +12302,7 @@ void m68k_op_mulu_16_al(void)
 
    *r_dst = res;
 
+   m68ki_discard_lazy_flags();
    FLAG_Z = res;
    FLAG_N = NFLAG_32(res);
    FLAG_V = VFLAG_CLEAR;
@@ -11817,6 +12317,7 @@ void m68k_op_mulu_16_pcdi(void)
 
    *r_dst = res;
 
+   m68ki_discard_lazy_flags();
    FLAG_Z = res;
    FLAG_N = NFLAG_32(res);
    FLAG_V = VFLAG_CLEAR;
@@ -11831,6 +12332,7 @@ void m68k_op_mulu_16_pcix(void)
 
    *r_dst = res;
 
+   m68ki_discard_lazy_flags();
    FLAG_Z = res;
    FLAG_N = NFLAG_32(res);
    FLAG_V = VFLAG_CLEAR;
@@ -11845,6 +12347,7 @@ void m68k_op_mulu_16_i(void)
 
    *r_dst = res;
 
+   m68ki_discard_lazy_flags();
    FLAG_Z = res;
    FLAG_N = NFLAG_32(res);
    FLAG_V = VFLAG_CLEAR;
@@ -11854,6 +12357,7 @@ void m68k_op_mulu_16_i(void)
 
 void m68k_op_mull_32_d(void)
 {
+   m68ki_resolve_flags();
 #if M68K_USE_64_BIT
 
    if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
@@ -11978,6 +12482,7 @@ void m68k_op_mull_32_d(void)
 
 void m68k_op_mull_32_ai(void)
 {
+   m68ki_resolve_flags();
 #if M68K_USE_64_BIT
 
    if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
@@ -12102,6 +12607,7 @@ void m68k_op_mull_32_ai(void)
 
 void m68k_op_mull_32_pi(void)
 {
+   m68ki_resolve_flags();
 #if M68K_USE_64_BIT
 
    if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
@@ -12226,6 +12732,7 @@ void m68k_op_mull_32_pi(void)
 
 void m68k_op_mull_32_pd(void)
 {
+   m68ki_resolve_flags();
 #if M68K_USE_64_BIT
 
    if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
@@ -12350,6 +12857,7 @@ void m68k_op_mull_32_pd(void)
 
 void m68k_op_mull_32_di(void)
 {
+   m68ki_resolve_flags();
 #if M68K_USE_64_BIT
 
    if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
@@ -12474,6 +12982,7 @@ void m68k_op_mull_32_di(void)
 
 void m68k_op_mull_32_ix(void)
 {
+   m68ki_resolve_flags();
 #if M68K_USE_64_BIT
 
    if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
@@ -12598,6 +13107,7 @@ void m68k_op_mull_32_ix(void)
 
 void m68k_op_mull_32_aw(void)
 {
+   m68ki_resolve_flags();
 #if M68K_USE_64_BIT
 
    if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
@@ -12722,6 +13232,7 @@ void m68k_op_mull_32_aw(void)
 
 void m68k_op_mull_32_al(void)
 {
+   m68ki_resolve_flags();
 #if M68K_USE_64_BIT
 
    if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
@@ -12846,6 +13357,7 @@ void m68k_op_mull_32_al(void)
 
 void m68k_op_mull_32_pcdi(void)
 {
+   m68ki_resolve_flags();
 #if M68K_USE_64_BIT
 
    if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
@@ -12970,6 +13482,7 @@ void m68k_op_mull_32_pcdi(void)
 
 void m68k_op_mull_32_pcix(void)
 {
+   m68ki_resolve_flags();
 #if M68K_USE_64_BIT
 
    if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
@@ -13094,6 +13607,7 @@ void m68k_op_mull_32_pcix(void)
 
 void m68k_op_mull_32_i(void)
 {
+   m68ki_resolve_flags();
 #if M68K_USE_64_BIT
 
    if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
@@ -11,6 +11,8 @@ void m68k_op_nbcd_8_d(void)
    uint dst = *r_dst;
    uint res = MASK_OUT_ABOVE_8(0x9a - dst - XFLAG_AS_1());
 
+   m68ki_resolve_flags();
+
    if(res != 0x9a)
    {
       FLAG_V = ~res; /* Undefined V behavior */
@@ -44,6 +46,8 @@ void m68k_op_nbcd_8_ai(void)
    uint dst = m68ki_read_8(ea);
    uint res = MASK_OUT_ABOVE_8(0x9a - dst - XFLAG_AS_1());
 
+   m68ki_resolve_flags();
+
    if(res != 0x9a)
    {
       FLAG_V = ~res; /* Undefined V behavior */
@@ -77,6 +81,8 @@ void m68k_op_nbcd_8_pi(void)
    uint dst = m68ki_read_8(ea);
    uint res = MASK_OUT_ABOVE_8(0x9a - dst - XFLAG_AS_1());
 
+   m68ki_resolve_flags();
+
    if(res != 0x9a)
    {
       FLAG_V = ~res; /* Undefined V behavior */
@@ -110,6 +116,8 @@ void m68k_op_nbcd_8_pi7(void)
    uint dst = m68ki_read_8(ea);
    uint res = MASK_OUT_ABOVE_8(0x9a - dst - XFLAG_AS_1());
 
+   m68ki_resolve_flags();
+
    if(res != 0x9a)
    {
       FLAG_V = ~res; /* Undefined V behavior */
@@ -143,6 +151,8 @@ void m68k_op_nbcd_8_pd(void)
    uint dst = m68ki_read_8(ea);
    uint res = MASK_OUT_ABOVE_8(0x9a - dst - XFLAG_AS_1());
 
+   m68ki_resolve_flags();
+
    if(res != 0x9a)
    {
       FLAG_V = ~res; /* Undefined V behavior */
@@ -176,6 +186,8 @@ void m68k_op_nbcd_8_pd7(void)
    uint dst = m68ki_read_8(ea);
    uint res = MASK_OUT_ABOVE_8(0x9a - dst - XFLAG_AS_1());
 
+   m68ki_resolve_flags();
+
    if(res != 0x9a)
    {
       FLAG_V = ~res; /* Undefined V behavior */
@@ -209,6 +221,8 @@ void m68k_op_nbcd_8_di(void)
    uint dst = m68ki_read_8(ea);
    uint res = MASK_OUT_ABOVE_8(0x9a - dst - XFLAG_AS_1());
 
+   m68ki_resolve_flags();
+
    if(res != 0x9a)
    {
       FLAG_V = ~res; /* Undefined V behavior */
@@ -242,6 +256,8 @@ void m68k_op_nbcd_8_ix(void)
    uint dst = m68ki_read_8(ea);
    uint res = MASK_OUT_ABOVE_8(0x9a - dst - XFLAG_AS_1());
 
+   m68ki_resolve_flags();
+
    if(res != 0x9a)
    {
       FLAG_V = ~res; /* Undefined V behavior */
@@ -275,6 +291,8 @@ void m68k_op_nbcd_8_aw(void)
    uint dst = m68ki_read_8(ea);
    uint res = MASK_OUT_ABOVE_8(0x9a - dst - XFLAG_AS_1());
 
+   m68ki_resolve_flags();
+
    if(res != 0x9a)
    {
       FLAG_V = ~res; /* Undefined V behavior */
@@ -308,6 +326,8 @@ void m68k_op_nbcd_8_al(void)
    uint dst = m68ki_read_8(ea);
    uint res = MASK_OUT_ABOVE_8(0x9a - dst - XFLAG_AS_1());
 
+   m68ki_resolve_flags();
+
    if(res != 0x9a)
    {
       FLAG_V = ~res; /* Undefined V behavior */
@@ -340,6 +360,7 @@ void m68k_op_neg_8_d(void)
    uint* r_dst = &DY;
    uint res = 0 - MASK_OUT_ABOVE_8(*r_dst);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_8(res);
    FLAG_C = FLAG_X = CFLAG_8(res);
    FLAG_V = *r_dst & res;
@@ -355,6 +376,7 @@ void m68k_op_neg_8_ai(void)
    uint src = m68ki_read_8(ea);
    uint res = 0 - src;
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_8(res);
    FLAG_C = FLAG_X = CFLAG_8(res);
    FLAG_V = src & res;
@@ -370,6 +392,7 @@ void m68k_op_neg_8_pi(void)
    uint src = m68ki_read_8(ea);
    uint res = 0 - src;
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_8(res);
    FLAG_C = FLAG_X = CFLAG_8(res);
    FLAG_V = src & res;
@@ -385,6 +408,7 @@ void m68k_op_neg_8_pi7(void)
    uint src = m68ki_read_8(ea);
    uint res = 0 - src;
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_8(res);
    FLAG_C = FLAG_X = CFLAG_8(res);
    FLAG_V = src & res;
@@ -400,6 +424,7 @@ void m68k_op_neg_8_pd(void)
    uint src = m68ki_read_8(ea);
    uint res = 0 - src;
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_8(res);
    FLAG_C = FLAG_X = CFLAG_8(res);
    FLAG_V = src & res;
@@ -415,6 +440,7 @@ void m68k_op_neg_8_pd7(void)
    uint src = m68ki_read_8(ea);
    uint res = 0 - src;
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_8(res);
    FLAG_C = FLAG_X = CFLAG_8(res);
    FLAG_V = src & res;
@@ -430,6 +456,7 @@ void m68k_op_neg_8_di(void)
    uint src = m68ki_read_8(ea);
    uint res = 0 - src;
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_8(res);
    FLAG_C = FLAG_X = CFLAG_8(res);
    FLAG_V = src & res;
@@ -445,6 +472,7 @@ void m68k_op_neg_8_ix(void)
    uint src = m68ki_read_8(ea);
    uint res = 0 - src;
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_8(res);
    FLAG_C = FLAG_X = CFLAG_8(res);
    FLAG_V = src & res;
@@ -460,6 +488,7 @@ void m68k_op_neg_8_aw(void)
    uint src = m68ki_read_8(ea);
    uint res = 0 - src;
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_8(res);
    FLAG_C = FLAG_X = CFLAG_8(res);
    FLAG_V = src & res;
@@ -475,6 +504,7 @@ void m68k_op_neg_8_al(void)
    uint src = m68ki_read_8(ea);
    uint res = 0 - src;
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_8(res);
    FLAG_C = FLAG_X = CFLAG_8(res);
    FLAG_V = src & res;
@@ -489,6 +519,7 @@ void m68k_op_neg_16_d(void)
    uint* r_dst = &DY;
    uint res = 0 - MASK_OUT_ABOVE_16(*r_dst);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_16(res);
    FLAG_C = FLAG_X = CFLAG_16(res);
    FLAG_V = (*r_dst & res)>>8;
@@ -504,6 +535,7 @@ void m68k_op_neg_16_ai(void)
    uint src = m68ki_read_16(ea);
    uint res = 0 - src;
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_16(res);
    FLAG_C = FLAG_X = CFLAG_16(res);
    FLAG_V = (src & res)>>8;
@@ -519,6 +551,7 @@ void m68k_op_neg_16_pi(void)
    uint src = m68ki_read_16(ea);
    uint res = 0 - src;
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_16(res);
    FLAG_C = FLAG_X = CFLAG_16(res);
    FLAG_V = (src & res)>>8;
@@ -534,6 +567,7 @@ void m68k_op_neg_16_pd(void)
    uint src = m68ki_read_16(ea);
    uint res = 0 - src;
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_16(res);
    FLAG_C = FLAG_X = CFLAG_16(res);
    FLAG_V = (src & res)>>8;
@@ -549,6 +583,7 @@ void m68k_op_neg_16_di(void)
    uint src = m68ki_read_16(ea);
    uint res = 0 - src;
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_16(res);
    FLAG_C = FLAG_X = CFLAG_16(res);
    FLAG_V = (src & res)>>8;
@@ -564,6 +599,7 @@ void m68k_op_neg_16_ix(void)
    uint src = m68ki_read_16(ea);
    uint res = 0 - src;
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_16(res);
    FLAG_C = FLAG_X = CFLAG_16(res);
    FLAG_V = (src & res)>>8;
@@ -579,6 +615,7 @@ void m68k_op_neg_16_aw(void)
    uint src = m68ki_read_16(ea);
    uint res = 0 - src;
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_16(res);
    FLAG_C = FLAG_X = CFLAG_16(res);
    FLAG_V = (src & res)>>8;
@@ -594,6 +631,7 @@ void m68k_op_neg_16_al(void)
    uint src = m68ki_read_16(ea);
    uint res = 0 - src;
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_16(res);
    FLAG_C = FLAG_X = CFLAG_16(res);
    FLAG_V = (src & res)>>8;
@@ -608,6 +646,7 @@ void m68k_op_neg_32_d(void)
    uint* r_dst = &DY;
    uint res = 0 - *r_dst;
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_32(res);
    FLAG_C = FLAG_X = CFLAG_SUB_32(*r_dst, 0, res);
    FLAG_V = (*r_dst & res)>>24;
@@ -623,6 +662,7 @@ void m68k_op_neg_32_ai(void)
    uint src = m68ki_read_32(ea);
    uint res = 0 - src;
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_32(res);
    FLAG_C = FLAG_X = CFLAG_SUB_32(src, 0, res);
    FLAG_V = (src & res)>>24;
@@ -638,6 +678,7 @@ void m68k_op_neg_32_pi(void)
    uint src = m68ki_read_32(ea);
    uint res = 0 - src;
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_32(res);
    FLAG_C = FLAG_X = CFLAG_SUB_32(src, 0, res);
    FLAG_V = (src & res)>>24;
@@ -653,6 +694,7 @@ void m68k_op_neg_32_pd(void)
    uint src = m68ki_read_32(ea);
    uint res = 0 - src;
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_32(res);
    FLAG_C = FLAG_X = CFLAG_SUB_32(src, 0, res);
    FLAG_V = (src & res)>>24;
@@ -668,6 +710,7 @@ void m68k_op_neg_32_di(void)
    uint src = m68ki_read_32(ea);
    uint res = 0 - src;
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_32(res);
    FLAG_C = FLAG_X = CFLAG_SUB_32(src, 0, res);
    FLAG_V = (src & res)>>24;
@@ -683,6 +726,7 @@ void m68k_op_neg_32_ix(void)
    uint src = m68ki_read_32(ea);
    uint res = 0 - src;
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_32(res);
    FLAG_C = FLAG_X = CFLAG_SUB_32(src, 0, res);
    FLAG_V = (src & res)>>24;
@@ -698,6 +742,7 @@ void m68k_op_neg_32_aw(void)
    uint src = m68ki_read_32(ea);
    uint res = 0 - src;
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_32(res);
    FLAG_C = FLAG_X = CFLAG_SUB_32(src, 0, res);
    FLAG_V = (src & res)>>24;
@@ -713,6 +758,7 @@ void m68k_op_neg_32_al(void)
    uint src = m68ki_read_32(ea);
    uint res = 0 - src;
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_32(res);
    FLAG_C = FLAG_X = CFLAG_SUB_32(src, 0, res);
    FLAG_V = (src & res)>>24;
@@ -727,6 +773,8 @@ void m68k_op_negx_8_d(void)
    uint* r_dst = &DY;
    uint res = 0 - MASK_OUT_ABOVE_8(*r_dst) - XFLAG_AS_1();
 
+   m68ki_resolve_flags();
+
    FLAG_N = NFLAG_8(res);
    FLAG_X = FLAG_C = CFLAG_8(res);
    FLAG_V = *r_dst & res;
@@ -744,6 +792,8 @@ void m68k_op_negx_8_ai(void)
    uint src = m68ki_read_8(ea);
    uint res = 0 - src - XFLAG_AS_1();
 
+   m68ki_resolve_flags();
+
    FLAG_N = NFLAG_8(res);
    FLAG_X = FLAG_C = CFLAG_8(res);
    FLAG_V = src & res;
@@ -761,6 +811,8 @@ void m68k_op_negx_8_pi(void)
    uint src = m68ki_read_8(ea);
    uint res = 0 - src - XFLAG_AS_1();
 
+   m68ki_resolve_flags();
+
    FLAG_N = NFLAG_8(res);
    FLAG_X = FLAG_C = CFLAG_8(res);
    FLAG_V = src & res;
@@ -778,6 +830,8 @@ void m68k_op_negx_8_pi7(void)
    uint src = m68ki_read_8(ea);
    uint res = 0 - src - XFLAG_AS_1();
 
+   m68ki_resolve_flags();
+
    FLAG_N = NFLAG_8(res);
    FLAG_X = FLAG_C = CFLAG_8(res);
    FLAG_V = src & res;
@@ -795,6 +849,8 @@ void m68k_op_negx_8_pd(void)
    uint src = m68ki_read_8(ea);
    uint res = 0 - src - XFLAG_AS_1();
 
+   m68ki_resolve_flags();
+
    FLAG_N = NFLAG_8(res);
    FLAG_X = FLAG_C = CFLAG_8(res);
    FLAG_V = src & res;
@@ -812,6 +868,8 @@ void m68k_op_negx_8_pd7(void)
    uint src = m68ki_read_8(ea);
    uint res = 0 - src - XFLAG_AS_1();
 
+   m68ki_resolve_flags();
+
    FLAG_N = NFLAG_8(res);
    FLAG_X = FLAG_C = CFLAG_8(res);
    FLAG_V = src & res;
@@ -829,6 +887,8 @@ void m68k_op_negx_8_di(void)
    uint src = m68ki_read_8(ea);
    uint res = 0 - src - XFLAG_AS_1();
 
+   m68ki_resolve_flags();
+
    FLAG_N = NFLAG_8(res);
    FLAG_X = FLAG_C = CFLAG_8(res);
    FLAG_V = src & res;
@@ -846,6 +906,8 @@ void m68k_op_negx_8_ix(void)
    uint src = m68ki_read_8(ea);
    uint res = 0 - src - XFLAG_AS_1();
 
+   m68ki_resolve_flags();
+
    FLAG_N = NFLAG_8(res);
    FLAG_X = FLAG_C = CFLAG_8(res);
    FLAG_V = src & res;
@@ -863,6 +925,8 @@ void m68k_op_negx_8_aw(void)
    uint src = m68ki_read_8(ea);
    uint res = 0 - src - XFLAG_AS_1();
 
+   m68ki_resolve_flags();
+
    FLAG_N = NFLAG_8(res);
    FLAG_X = FLAG_C = CFLAG_8(res);
    FLAG_V = src & res;
@@ -880,6 +944,8 @@ void m68k_op_negx_8_al(void)
    uint src = m68ki_read_8(ea);
    uint res = 0 - src - XFLAG_AS_1();
 
+   m68ki_resolve_flags();
+
    FLAG_N = NFLAG_8(res);
    FLAG_X = FLAG_C = CFLAG_8(res);
    FLAG_V = src & res;
@@ -896,6 +962,8 @@ void m68k_op_negx_16_d(void)
    uint* r_dst = &DY;
    uint res = 0 - MASK_OUT_ABOVE_16(*r_dst) - XFLAG_AS_1();
 
+   m68ki_resolve_flags();
+
    FLAG_N = NFLAG_16(res);
    FLAG_X = FLAG_C = CFLAG_16(res);
    FLAG_V = (*r_dst & res)>>8;
@@ -913,6 +981,8 @@ void m68k_op_negx_16_ai(void)
    uint src = m68ki_read_16(ea);
    uint res = 0 - MASK_OUT_ABOVE_16(src) - XFLAG_AS_1();
 
+   m68ki_resolve_flags();
+
    FLAG_N = NFLAG_16(res);
    FLAG_X = FLAG_C = CFLAG_16(res);
    FLAG_V = (src & res)>>8;
@@ -930,6 +1000,8 @@ void m68k_op_negx_16_pi(void)
    uint src = m68ki_read_16(ea);
    uint res = 0 - MASK_OUT_ABOVE_16(src) - XFLAG_AS_1();
 
+   m68ki_resolve_flags();
+
    FLAG_N = NFLAG_16(res);
    FLAG_X = FLAG_C = CFLAG_16(res);
    FLAG_V = (src & res)>>8;
@@ -947,6 +1019,8 @@ void m68k_op_negx_16_pd(void)
    uint src = m68ki_read_16(ea);
    uint res = 0 - MASK_OUT_ABOVE_16(src) - XFLAG_AS_1();
 
+   m68ki_resolve_flags();
+
    FLAG_N = NFLAG_16(res);
    FLAG_X = FLAG_C = CFLAG_16(res);
    FLAG_V = (src & res)>>8;
@@ -964,6 +1038,8 @@ void m68k_op_negx_16_di(void)
    uint src = m68ki_read_16(ea);
    uint res = 0 - MASK_OUT_ABOVE_16(src) - XFLAG_AS_1();
 
+   m68ki_resolve_flags();
+
    FLAG_N = NFLAG_16(res);
    FLAG_X = FLAG_C = CFLAG_16(res);
    FLAG_V = (src & res)>>8;
@@ -981,6 +1057,8 @@ void m68k_op_negx_16_ix(void)
    uint src = m68ki_read_16(ea);
    uint res = 0 - MASK_OUT_ABOVE_16(src) - XFLAG_AS_1();
 
+   m68ki_resolve_flags();
+
    FLAG_N = NFLAG_16(res);
    FLAG_X = FLAG_C = CFLAG_16(res);
    FLAG_V = (src & res)>>8;
@@ -998,6 +1076,8 @@ void m68k_op_negx_16_aw(void)
    uint src = m68ki_read_16(ea);
    uint res = 0 - MASK_OUT_ABOVE_16(src) - XFLAG_AS_1();
 
+   m68ki_resolve_flags();
+
    FLAG_N = NFLAG_16(res);
    FLAG_X = FLAG_C = CFLAG_16(res);
    FLAG_V = (src & res)>>8;
@@ -1015,6 +1095,8 @@ void m68k_op_negx_16_al(void)
    uint src = m68ki_read_16(ea);
    uint res = 0 - MASK_OUT_ABOVE_16(src) - XFLAG_AS_1();
 
+   m68ki_resolve_flags();
+
    FLAG_N = NFLAG_16(res);
    FLAG_X = FLAG_C = CFLAG_16(res);
    FLAG_V = (src & res)>>8;
@@ -1031,6 +1113,8 @@ void m68k_op_negx_32_d(void)
    uint* r_dst = &DY;
    uint res = 0 - MASK_OUT_ABOVE_32(*r_dst) - XFLAG_AS_1();
 
+   m68ki_resolve_flags();
+
    FLAG_N = NFLAG_32(res);
    FLAG_X = FLAG_C = CFLAG_SUB_32(*r_dst, 0, res);
    FLAG_V = (*r_dst & res)>>24;
@@ -1048,6 +1132,8 @@ void m68k_op_negx_32_ai(void)
    uint src = m68ki_read_32(ea);
    uint res = 0 - MASK_OUT_ABOVE_32(src) - XFLAG_AS_1();
 
+   m68ki_resolve_flags();
+
    FLAG_N = NFLAG_32(res);
    FLAG_X = FLAG_C = CFLAG_SUB_32(src, 0, res);
    FLAG_V = (src & res)>>24;
@@ -1065,6 +1151,8 @@ void m68k_op_negx_32_pi(void)
    uint src = m68ki_read_32(ea);
    uint res = 0 - MASK_OUT_ABOVE_32(src) - XFLAG_AS_1();
 
+   m68ki_resolve_flags();
+
    FLAG_N = NFLAG_32(res);
    FLAG_X = FLAG_C = CFLAG_SUB_32(src, 0, res);
    FLAG_V = (src & res)>>24;
@@ -1082,6 +1170,8 @@ void m68k_op_negx_32_pd(void)
    uint src = m68ki_read_32(ea);
    uint res = 0 - MASK_OUT_ABOVE_32(src) - XFLAG_AS_1();
 
+   m68ki_resolve_flags();
+
    FLAG_N = NFLAG_32(res);
    FLAG_X = FLAG_C = CFLAG_SUB_32(src, 0, res);
    FLAG_V = (src & res)>>24;
@@ -1099,6 +1189,8 @@ void m68k_op_negx_32_di(void)
    uint src = m68ki_read_32(ea);
    uint res = 0 - MASK_OUT_ABOVE_32(src) - XFLAG_AS_1();
 
+   m68ki_resolve_flags();
+
    FLAG_N = NFLAG_32(res);
    FLAG_X = FLAG_C = CFLAG_SUB_32(src, 0, res);
    FLAG_V = (src & res)>>24;
@@ -1116,6 +1208,8 @@ void m68k_op_negx_32_ix(void)
    uint src = m68ki_read_32(ea);
    uint res = 0 - MASK_OUT_ABOVE_32(src) - XFLAG_AS_1();
 
+   m68ki_resolve_flags();
+
    FLAG_N = NFLAG_32(res);
    FLAG_X = FLAG_C = CFLAG_SUB_32(src, 0, res);
    FLAG_V = (src & res)>>24;
@@ -1133,6 +1227,8 @@ void m68k_op_negx_32_aw(void)
    uint src = m68ki_read_32(ea);
    uint res = 0 - MASK_OUT_ABOVE_32(src) - XFLAG_AS_1();
 
+   m68ki_resolve_flags();
+
    FLAG_N = NFLAG_32(res);
    FLAG_X = FLAG_C = CFLAG_SUB_32(src, 0, res);
    FLAG_V = (src & res)>>24;
@@ -1150,6 +1246,8 @@ void m68k_op_negx_32_al(void)
    uint src = m68ki_read_32(ea);
    uint res = 0 - MASK_OUT_ABOVE_32(src) - XFLAG_AS_1();
 
+   m68ki_resolve_flags();
+
    FLAG_N = NFLAG_32(res);
    FLAG_X = FLAG_C = CFLAG_SUB_32(src, 0, res);
    FLAG_V = (src & res)>>24;
@@ -1174,6 +1272,7 @@ void m68k_op_not_8_d(void)
 
    *r_dst = MASK_OUT_BELOW_8(*r_dst) | res;
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_8(res);
    FLAG_Z = res;
    FLAG_C = CFLAG_CLEAR;
@@ -1188,6 +1287,7 @@ void m68k_op_not_8_ai(void)
 
    m68ki_write_8(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_8(res);
    FLAG_Z = res;
    FLAG_C = CFLAG_CLEAR;
@@ -1202,6 +1302,7 @@ void m68k_op_not_8_pi(void)
 
    m68ki_write_8(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_8(res);
    FLAG_Z = res;
    FLAG_C = CFLAG_CLEAR;
@@ -1216,6 +1317,7 @@ void m68k_op_not_8_pi7(void)
 
    m68ki_write_8(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_8(res);
    FLAG_Z = res;
    FLAG_C = CFLAG_CLEAR;
@@ -1230,6 +1332,7 @@ void m68k_op_not_8_pd(void)
 
    m68ki_write_8(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_8(res);
    FLAG_Z = res;
    FLAG_C = CFLAG_CLEAR;
@@ -1244,6 +1347,7 @@ void m68k_op_not_8_pd7(void)
 
    m68ki_write_8(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_8(res);
    FLAG_Z = res;
    FLAG_C = CFLAG_CLEAR;
@@ -1258,6 +1362,7 @@ void m68k_op_not_8_di(void)
 
    m68ki_write_8(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_8(res);
    FLAG_Z = res;
    FLAG_C = CFLAG_CLEAR;
@@ -1272,6 +1377,7 @@ void m68k_op_not_8_ix(void)
 
    m68ki_write_8(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_8(res);
    FLAG_Z = res;
    FLAG_C = CFLAG_CLEAR;
@@ -1286,6 +1392,7 @@ void m68k_op_not_8_aw(void)
 
    m68ki_write_8(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_8(res);
    FLAG_Z = res;
    FLAG_C = CFLAG_CLEAR;
@@ -1300,6 +1407,7 @@ void m68k_op_not_8_al(void)
 
    m68ki_write_8(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_8(res);
    FLAG_Z = res;
    FLAG_C = CFLAG_CLEAR;
@@ -1314,6 +1422,7 @@ void m68k_op_not_16_d(void)
 
    *r_dst = MASK_OUT_BELOW_16(*r_dst) | res;
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_16(res);
    FLAG_Z = res;
    FLAG_C = CFLAG_CLEAR;
@@ -1328,6 +1437,7 @@ void m68k_op_not_16_ai(void)
 
    m68ki_write_16(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_16(res);
    FLAG_Z = res;
    FLAG_C = CFLAG_CLEAR;
@@ -1342,6 +1452,7 @@ void m68k_op_not_16_pi(void)
 
    m68ki_write_16(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_16(res);
    FLAG_Z = res;
    FLAG_C = CFLAG_CLEAR;
@@ -1356,6 +1467,7 @@ void m68k_op_not_16_pd(void)
 
    m68ki_write_16(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_16(res);
    FLAG_Z = res;
    FLAG_C = CFLAG_CLEAR;
@@ -1370,6 +1482,7 @@ void m68k_op_not_16_di(void)
 
    m68ki_write_16(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_16(res);
    FLAG_Z = res;
    FLAG_C = CFLAG_CLEAR;
@@ -1384,6 +1497,7 @@ void m68k_op_not_16_ix(void)
 
    m68ki_write_16(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_16(res);
    FLAG_Z = res;
    FLAG_C = CFLAG_CLEAR;
@@ -1398,6 +1512,7 @@ void m68k_op_not_16_aw(void)
 
    m68ki_write_16(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_16(res);
    FLAG_Z = res;
    FLAG_C = CFLAG_CLEAR;
@@ -1412,6 +1527,7 @@ void m68k_op_not_16_al(void)
 
    m68ki_write_16(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_16(res);
    FLAG_Z = res;
    FLAG_C = CFLAG_CLEAR;
@@ -1424,6 +1540,7 @@ void m68k_op_not_32_d(void)
    uint* r_dst = &DY;
    uint res = *r_dst = MASK_OUT_ABOVE_32(~*r_dst);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_32(res);
    FLAG_Z = res;
    FLAG_C = CFLAG_CLEAR;
@@ -1438,6 +1555,7 @@ void m68k_op_not_32_ai(void)
 
    m68ki_write_32(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_32(res);
    FLAG_Z = res;
    FLAG_C = CFLAG_CLEAR;
@@ -1452,6 +1570,7 @@ void m68k_op_not_32_pi(void)
 
    m68ki_write_32(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_32(res);
    FLAG_Z = res;
    FLAG_C = CFLAG_CLEAR;
@@ -1466,6 +1585,7 @@ void m68k_op_not_32_pd(void)
 
    m68ki_write_32(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_32(res);
    FLAG_Z = res;
    FLAG_C = CFLAG_CLEAR;
@@ -1480,6 +1600,7 @@ void m68k_op_not_32_di(void)
 
    m68ki_write_32(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_32(res);
    FLAG_Z = res;
    FLAG_C = CFLAG_CLEAR;
@@ -1494,6 +1615,7 @@ void m68k_op_not_32_ix(void)
 
    m68ki_write_32(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_32(res);
    FLAG_Z = res;
    FLAG_C = CFLAG_CLEAR;
@@ -1508,6 +1630,7 @@ void m68k_op_not_32_aw(void)
 
    m68ki_write_32(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_32(res);
    FLAG_Z = res;
    FLAG_C = CFLAG_CLEAR;
@@ -1522,6 +1645,7 @@ void m68k_op_not_32_al(void)
 
    m68ki_write_32(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_32(res);
    FLAG_Z = res;
    FLAG_C = CFLAG_CLEAR;
@@ -1533,6 +1657,7 @@ void m68k_op_or_8_er_d(void)
 {
    uint res = MASK_OUT_ABOVE_8((DX |= MASK_OUT_ABOVE_8(DY)));
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_8(res);
    FLAG_Z = res;
    FLAG_C = CFLAG_CLEAR;
@@ -1544,6 +1669,7 @@ void m68k_op_or_8_er_ai(void)
 {
    uint res = MASK_OUT_ABOVE_8((DX |= OPER_AY_AI_8()));
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_8(res);
    FLAG_Z = res;
    FLAG_C = CFLAG_CLEAR;
@@ -1555,6 +1681,7 @@ void m68k_op_or_8_er_pi(void)
 {
    uint res = MASK_OUT_ABOVE_8((DX |= OPER_AY_PI_8()));
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_8(res);
    FLAG_Z = res;
    FLAG_C = CFLAG_CLEAR;
@@ -1566,6 +1693,7 @@ void m68k_op_or_8_er_pi7(void)
 {
    uint res = MASK_OUT_ABOVE_8((DX |= OPER_A7_PI_8()));
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_8(res);
    FLAG_Z = res;
    FLAG_C = CFLAG_CLEAR;
@@ -1577,6 +1705,7 @@ void m68k_op_or_8_er_pd(void)
 {
    uint res = MASK_OUT_ABOVE_8((DX |= OPER_AY_PD_8()));
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_8(res);
    FLAG_Z = res;
    FLAG_C = CFLAG_CLEAR;
@@ -1588,6 +1717,7 @@ void m68k_op_or_8_er_pd7(void)
 {
    uint res = MASK_OUT_ABOVE_8((DX |= OPER_A7_PD_8()));
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_8(res);
    FLAG_Z = res;
    FLAG_C = CFLAG_CLEAR;
@@ -1599,6 +1729,7 @@ void m68k_op_or_8_er_di(void)
 {
    uint res = MASK_OUT_ABOVE_8((DX |= OPER_AY_DI_8()));
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_8(res);
    FLAG_Z = res;
    FLAG_C = CFLAG_CLEAR;
@@ -1610,6 +1741,7 @@ void m68k_op_or_8_er_ix(void)
 {
    uint res = MASK_OUT_ABOVE_8((DX |= OPER_AY_IX_8()));
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_8(res);
    FLAG_Z = res;
    FLAG_C = CFLAG_CLEAR;
@@ -1621,6 +1753,7 @@ void m68k_op_or_8_er_aw(void)
 {
    uint res = MASK_OUT_ABOVE_8((DX |= OPER_AW_8()));
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_8(res);
    FLAG_Z = res;
    FLAG_C = CFLAG_CLEAR;
@@ -1632,6 +1765,7 @@ void m68k_op_or_8_er_al(void)
 {
    uint res = MASK_OUT_ABOVE_8((DX |= OPER_AL_8()));
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_8(res);
    FLAG_Z = res;
    FLAG_C = CFLAG_CLEAR;
@@ -1643,6 +1777,7 @@ void m68k_op_or_8_er_pcdi(void)
 {
    uint res = MASK_OUT_ABOVE_8((DX |= OPER_PCDI_8()));
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_8(res);
    FLAG_Z = res;
    FLAG_C = CFLAG_CLEAR;
@@ -1654,6 +1789,7 @@ void m68k_op_or_8_er_pcix(void)
 {
    uint res = MASK_OUT_ABOVE_8((DX |= OPER_PCIX_8()));
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_8(res);
    FLAG_Z = res;
    FLAG_C = CFLAG_CLEAR;
@@ -1665,6 +1801,7 @@ void m68k_op_or_8_er_i(void)
 {
    uint res = MASK_OUT_ABOVE_8((DX |= OPER_I_8()));
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_8(res);
    FLAG_Z = res;
    FLAG_C = CFLAG_CLEAR;
@@ -1676,6 +1813,7 @@ void m68k_op_or_16_er_d(void)
 {
    uint res = MASK_OUT_ABOVE_16((DX |= MASK_OUT_ABOVE_16(DY)));
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_16(res);
    FLAG_Z = res;
    FLAG_C = CFLAG_CLEAR;
@@ -1687,6 +1825,7 @@ void m68k_op_or_16_er_ai(void)
 {
    uint res = MASK_OUT_ABOVE_16((DX |= OPER_AY_AI_16()));
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_16(res);
    FLAG_Z = res;
    FLAG_C = CFLAG_CLEAR;
@@ -1698,6 +1837,7 @@ void m68k_op_or_16_er_pi(void)
 {
    uint res = MASK_OUT_ABOVE_16((DX |= OPER_AY_PI_16()));
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_16(res);
    FLAG_Z = res;
    FLAG_C = CFLAG_CLEAR;
@@ -1709,6 +1849,7 @@ void m68k_op_or_16_er_pd(void)
 {
    uint res = MASK_OUT_ABOVE_16((DX |= OPER_AY_PD_16()));
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_16(res);
    FLAG_Z = res;
    FLAG_C = CFLAG_CLEAR;
@@ -1720,6 +1861,7 @@ void m68k_op_or_16_er_di(void)
 {
    uint res = MASK_OUT_ABOVE_16((DX |= OPER_AY_DI_16()));
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_16(res);
    FLAG_Z = res;
    FLAG_C = CFLAG_CLEAR;
@@ -1731,6 +1873,7 @@ void m68k_op_or_16_er_ix(void)
 {
    uint res = MASK_OUT_ABOVE_16((DX |= OPER_AY_IX_16()));
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_16(res);
    FLAG_Z = res;
    FLAG_C = CFLAG_CLEAR;
@@ -1742,6 +1885,7 @@ void m68k_op_or_16_er_aw(void)
 {
    uint res = MASK_OUT_ABOVE_16((DX |= OPER_AW_16()));
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_16(res);
    FLAG_Z = res;
    FLAG_C = CFLAG_CLEAR;
@@ -1753,6 +1897,7 @@ void m68k_op_or_16_er_al(void)
 {
    uint res = MASK_OUT_ABOVE_16((DX |= OPER_AL_16()));
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_16(res);
    FLAG_Z = res;
    FLAG_C = CFLAG_CLEAR;
@@ -1764,6 +1909,7 @@ void m68k_op_or_16_er_pcdi(void)
 {
    uint res = MASK_OUT_ABOVE_16((DX |= OPER_PCDI_16()));
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_16(res);
    FLAG_Z = res;
    FLAG_C = CFLAG_CLEAR;
@@ -1775,6 +1921,7 @@ void m68k_op_or_16_er_pcix(void)
 {
    uint res = MASK_OUT_ABOVE_16((DX |= OPER_PCIX_16()));
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_16(res);
    FLAG_Z = res;
    FLAG_C = CFLAG_CLEAR;
@@ -1786,6 +1933,7 @@ void m68k_op_or_16_er_i(void)
 {
    uint res = MASK_OUT_ABOVE_16((DX |= OPER_I_16()));
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_16(res);
    FLAG_Z = res;
    FLAG_C = CFLAG_CLEAR;
@@ -1797,6 +1945,7 @@ void m68k_op_or_32_er_d(void)
 {
    uint res = DX |= DY;
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_32(res);
    FLAG_Z = res;
    FLAG_C = CFLAG_CLEAR;
@@ -1808,6 +1957,7 @@ void m68k_op_or_32_er_ai(void)
 {
    uint res = DX |= OPER_AY_AI_32();
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_32(res);
    FLAG_Z = res;
    FLAG_C = CFLAG_CLEAR;
@@ -1819,6 +1969,7 @@ void m68k_op_or_32_er_pi(void)
 {
    uint res = DX |= OPER_AY_PI_32();
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_32(res);
    FLAG_Z = res;
    FLAG_C = CFLAG_CLEAR;
@@ -1830,6 +1981,7 @@ void m68k_op_or_32_er_pd(void)
 {
    uint res = DX |= OPER_AY_PD_32();
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_32(res);
    FLAG_Z = res;
    FLAG_C = CFLAG_CLEAR;
@@ -1841,6 +1993,7 @@ void m68k_op_or_32_er_di(void)
 {
    uint res = DX |= OPER_AY_DI_32();
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_32(res);
    FLAG_Z = res;
    FLAG_C = CFLAG_CLEAR;
@@ -1852,6 +2005,7 @@ void m68k_op_or_32_er_ix(void)
 {
    uint res = DX |= OPER_AY_IX_32();
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_32(res);
    FLAG_Z = res;
    FLAG_C = CFLAG_CLEAR;
@@ -1863,6 +2017,7 @@ void m68k_op_or_32_er_aw(void)
 {
    uint res = DX |= OPER_AW_32();
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_32(res);
    FLAG_Z = res;
    FLAG_C = CFLAG_CLEAR;
@@ -1874,6 +2029,7 @@ void m68k_op_or_32_er_al(void)
 {
    uint res = DX |= OPER_AL_32();
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_32(res);
    FLAG_Z = res;
    FLAG_C = CFLAG_CLEAR;
@@ -1885,6 +2041,7 @@ void m68k_op_or_32_er_pcdi(void)
 {
    uint res = DX |= OPER_PCDI_32();
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_32(res);
    FLAG_Z = res;
    FLAG_C = CFLAG_CLEAR;
@@ -1896,6 +2053,7 @@ void m68k_op_or_32_er_pcix(void)
 {
    uint res = DX |= OPER_PCIX_32();
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_32(res);
    FLAG_Z = res;
    FLAG_C = CFLAG_CLEAR;
@@ -1907,6 +2065,7 @@ void m68k_op_or_32_er_i(void)
 {
    uint res = DX |= OPER_I_32();
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_32(res);
    FLAG_Z = res;
    FLAG_C = CFLAG_CLEAR;
@@ -1921,6 +2080,7 @@ void m68k_op_or_8_re_ai(void)
 
    m68ki_write_8(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_8(res);
    FLAG_Z = res;
    FLAG_C = CFLAG_CLEAR;
@@ -1935,6 +2095,7 @@ void m68k_op_or_8_re_pi(void)
 
    m68ki_write_8(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_8(res);
    FLAG_Z = res;
    FLAG_C = CFLAG_CLEAR;
@@ -1949,6 +2110,7 @@ void m68k_op_or_8_re_pi7(void)
 
    m68ki_write_8(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_8(res);
    FLAG_Z = res;
    FLAG_C = CFLAG_CLEAR;
@@ -1963,6 +2125,7 @@ void m68k_op_or_8_re_pd(void)
 
    m68ki_write_8(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_8(res);
    FLAG_Z = res;
    FLAG_C = CFLAG_CLEAR;
@@ -1977,6 +2140,7 @@ void m68k_op_or_8_re_pd7(void)
 
    m68ki_write_8(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_8(res);
    FLAG_Z = res;
    FLAG_C = CFLAG_CLEAR;
@@ -1991,6 +2155,7 @@ void m68k_op_or_8_re_di(void)
 
    m68ki_write_8(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_8(res);
    FLAG_Z = res;
    FLAG_C = CFLAG_CLEAR;
@@ -2005,6 +2170,7 @@ void m68k_op_or_8_re_ix(void)
 
    m68ki_write_8(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_8(res);
    FLAG_Z = res;
    FLAG_C = CFLAG_CLEAR;
@@ -2019,6 +2185,7 @@ void m68k_op_or_8_re_aw(void)
 
    m68ki_write_8(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_8(res);
    FLAG_Z = res;
    FLAG_C = CFLAG_CLEAR;
@@ -2033,6 +2200,7 @@ void m68k_op_or_8_re_al(void)
 
    m68ki_write_8(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_8(res);
    FLAG_Z = res;
    FLAG_C = CFLAG_CLEAR;
@@ -2047,6 +2215,7 @@ void m68k_op_or_16_re_ai(void)
 
    m68ki_write_16(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_16(res);
    FLAG_Z = res;
    FLAG_C = CFLAG_CLEAR;
@@ -2061,6 +2230,7 @@ void m68k_op_or_16_re_pi(void)
 
    m68ki_write_16(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_16(res);
    FLAG_Z = res;
    FLAG_C = CFLAG_CLEAR;
@@ -2075,6 +2245,7 @@ void m68k_op_or_16_re_pd(void)
 
    m68ki_write_16(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_16(res);
    FLAG_Z = res;
    FLAG_C = CFLAG_CLEAR;
@@ -2089,6 +2260,7 @@ void m68k_op_or_16_re_di(void)
 
    m68ki_write_16(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_16(res);
    FLAG_Z = res;
    FLAG_C = CFLAG_CLEAR;
@@ -2103,6 +2275,7 @@ void m68k_op_or_16_re_ix(void)
 
    m68ki_write_16(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_16(res);
    FLAG_Z = res;
    FLAG_C = CFLAG_CLEAR;
@@ -2117,6 +2290,7 @@ void m68k_op_or_16_re_aw(void)
 
    m68ki_write_16(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_16(res);
    FLAG_Z = res;
    FLAG_C = CFLAG_CLEAR;
@@ -2131,6 +2305,7 @@ void m68k_op_or_16_re_al(void)
 
    m68ki_write_16(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_16(res);
    FLAG_Z = res;
    FLAG_C = CFLAG_CLEAR;
@@ -2145,6 +2320,7 @@ void m68k_op_or_32_re_ai(void)
 
    m68ki_write_32(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_32(res);
    FLAG_Z = res;
    FLAG_C = CFLAG_CLEAR;
@@ -2159,6 +2335,7 @@ void m68k_op_or_32_re_pi(void)
 
    m68ki_write_32(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_32(res);
    FLAG_Z = res;
    FLAG_C = CFLAG_CLEAR;
@@ -2173,6 +2350,7 @@ void m68k_op_or_32_re_pd(void)
 
    m68ki_write_32(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_32(res);
    FLAG_Z = res;
    FLAG_C = CFLAG_CLEAR;
@@ -2187,6 +2365,7 @@ void m68k_op_or_32_re_di(void)
 
    m68ki_write_32(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_32(res);
    FLAG_Z = res;
    FLAG_C = CFLAG_CLEAR;
@@ -2201,6 +2380,7 @@ void m68k_op_or_32_re_ix(void)
 
    m68ki_write_32(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_32(res);
    FLAG_Z = res;
    FLAG_C = CFLAG_CLEAR;
@@ -2215,6 +2395,7 @@ void m68k_op_or_32_re_aw(void)
 
    m68ki_write_32(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_32(res);
    FLAG_Z = res;
    FLAG_C = CFLAG_CLEAR;
@@ -2229,6 +2410,7 @@ void m68k_op_or_32_re_al(void)
 
    m68ki_write_32(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_32(res);
    FLAG_Z = res;
    FLAG_C = CFLAG_CLEAR;
@@ -2240,6 +2422,7 @@ void m68k_op_ori_8_d(void)
 {
    uint res = MASK_OUT_ABOVE_8((DY |= OPER_I_8()));
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_8(res);
    FLAG_Z = res;
    FLAG_C = CFLAG_CLEAR;
@@ -2255,6 +2438,7 @@ void m68k_op_ori_8_ai(void)
 
    m68ki_write_8(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_8(res);
    FLAG_Z = res;
    FLAG_C = CFLAG_CLEAR;
@@ -2270,6 +2454,7 @@ void m68k_op_ori_8_pi(void)
 
    m68ki_write_8(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_8(res);
    FLAG_Z = res;
    FLAG_C = CFLAG_CLEAR;
@@ -2285,6 +2470,7 @@ void m68k_op_ori_8_pi7(void)
 
    m68ki_write_8(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_8(res);
    FLAG_Z = res;
    FLAG_C = CFLAG_CLEAR;
@@ -2300,6 +2486,7 @@ void m68k_op_ori_8_pd(void)
 
    m68ki_write_8(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_8(res);
    FLAG_Z = res;
    FLAG_C = CFLAG_CLEAR;
@@ -2315,6 +2502,7 @@ void m68k_op_ori_8_pd7(void)
 
    m68ki_write_8(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_8(res);
    FLAG_Z = res;
    FLAG_C = CFLAG_CLEAR;
@@ -2330,6 +2518,7 @@ void m68k_op_ori_8_di(void)
 
    m68ki_write_8(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_8(res);
    FLAG_Z = res;
    FLAG_C = CFLAG_CLEAR;
@@ -2345,6 +2534,7 @@ void m68k_op_ori_8_ix(void)
 
    m68ki_write_8(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_8(res);
    FLAG_Z = res;
    FLAG_C = CFLAG_CLEAR;
@@ -2360,6 +2550,7 @@ void m68k_op_ori_8_aw(void)
 
    m68ki_write_8(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_8(res);
    FLAG_Z = res;
    FLAG_C = CFLAG_CLEAR;
@@ -2375,6 +2566,7 @@ void m68k_op_ori_8_al(void)
 
    m68ki_write_8(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_8(res);
    FLAG_Z = res;
    FLAG_C = CFLAG_CLEAR;
@@ -2386,6 +2578,7 @@ void m68k_op_ori_16_d(void)
 {
    uint res = MASK_OUT_ABOVE_16(DY |= OPER_I_16());
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_16(res);
    FLAG_Z = res;
    FLAG_C = CFLAG_CLEAR;
@@ -2401,6 +2594,7 @@ void m68k_op_ori_16_ai(void)
 
    m68ki_write_16(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_16(res);
    FLAG_Z = res;
    FLAG_C = CFLAG_CLEAR;
@@ -2416,6 +2610,7 @@ void m68k_op_ori_16_pi(void)
 
    m68ki_write_16(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_16(res);
    FLAG_Z = res;
    FLAG_C = CFLAG_CLEAR;
@@ -2431,6 +2626,7 @@ void m68k_op_ori_16_pd(void)
 
    m68ki_write_16(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_16(res);
    FLAG_Z = res;
    FLAG_C = CFLAG_CLEAR;
@@ -2446,6 +2642,7 @@ void m68k_op_ori_16_di(void)
 
    m68ki_write_16(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_16(res);
    FLAG_Z = res;
    FLAG_C = CFLAG_CLEAR;
@@ -2461,6 +2658,7 @@ void m68k_op_ori_16_ix(void)
 
    m68ki_write_16(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_16(res);
    FLAG_Z = res;
    FLAG_C = CFLAG_CLEAR;
@@ -2476,6 +2674,7 @@ void m68k_op_ori_16_aw(void)
 
    m68ki_write_16(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_16(res);
    FLAG_Z = res;
    FLAG_C = CFLAG_CLEAR;
@@ -2491,6 +2690,7 @@ void m68k_op_ori_16_al(void)
 
    m68ki_write_16(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_16(res);
    FLAG_Z = res;
    FLAG_C = CFLAG_CLEAR;
@@ -2502,6 +2702,7 @@ void m68k_op_ori_32_d(void)
 {
    uint res = DY |= OPER_I_32();
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_32(res);
    FLAG_Z = res;
    FLAG_C = CFLAG_CLEAR;
@@ -2517,6 +2718,7 @@ void m68k_op_ori_32_ai(void)
 
    m68ki_write_32(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_32(res);
    FLAG_Z = res;
    FLAG_C = CFLAG_CLEAR;
@@ -2532,6 +2734,7 @@ void m68k_op_ori_32_pi(void)
 
    m68ki_write_32(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_32(res);
    FLAG_Z = res;
    FLAG_C = CFLAG_CLEAR;
@@ -2547,6 +2750,7 @@ void m68k_op_ori_32_pd(void)
 
    m68ki_write_32(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_32(res);
    FLAG_Z = res;
    FLAG_C = CFLAG_CLEAR;
@@ -2562,6 +2766,7 @@ void m68k_op_ori_32_di(void)
 
    m68ki_write_32(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_32(res);
    FLAG_Z = res;
    FLAG_C = CFLAG_CLEAR;
@@ -2577,6 +2782,7 @@ void m68k_op_ori_32_ix(void)
 
    m68ki_write_32(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_32(res);
    FLAG_Z = res;
    FLAG_C = CFLAG_CLEAR;
@@ -2592,6 +2798,7 @@ void m68k_op_ori_32_aw(void)
 
    m68ki_write_32(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_32(res);
    FLAG_Z = res;
    FLAG_C = CFLAG_CLEAR;
@@ -2607,6 +2814,7 @@ void m68k_op_ori_32_al(void)
 
    m68ki_write_32(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_32(res);
    FLAG_Z = res;
    FLAG_C = CFLAG_CLEAR;
@@ -2793,6 +3001,7 @@ void m68k_op_ror_8_s(void)
 
    *r_dst = MASK_OUT_BELOW_8(*r_dst) | res;
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_8(res);
    FLAG_Z = res;
    FLAG_C = src << (9-orig_shift);
@@ -2809,6 +3018,7 @@ void m68k_op_ror_16_s(void)
 
    *r_dst = MASK_OUT_BELOW_16(*r_dst) | res;
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_16(res);
    FLAG_Z = res;
    FLAG_C = src << (9-shift);
@@ -2825,6 +3035,7 @@ void m68k_op_ror_32_s(void)
 
    *r_dst = res;
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_32(res);
    FLAG_Z = res;
    FLAG_C = src << (9-shift);
@@ -2840,6 +3051,8 @@ void m68k_op_ror_8_r(void)
    uint src = MASK_OUT_ABOVE_8(*r_dst);
    uint res = ROR_8(src, shift);
 
+   m68ki_resolve_flags();
+
    if(orig_shift != 0)
    {
       USE_CYCLES(orig_shift<<CYC_SHIFT);
@@ -2867,6 +3080,8 @@ void m68k_op_ror_16_r(void)
    uint src = MASK_OUT_ABOVE_16(*r_dst);
    uint res = ROR_16(src, shift);
 
+   m68ki_resolve_flags();
+
    if(orig_shift != 0)
    {
       USE_CYCLES(orig_shift<<CYC_SHIFT);
@@ -2891,6 +3106,8 @@ void m68k_op_ror_32_r(void)
    uint* r_dst = &DY;
    uint orig_shift = DX & 0x3f;
    uint shift = orig_shift & 31;
+
+   m68ki_resolve_flags();
    uint64 src = *r_dst;
    uint res = ROR_32(src, shift);
 
@@ -2921,6 +3138,7 @@ void m68k_op_ror_16_ai(void)
 
    m68ki_write_16(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_16(res);
    FLAG_Z = res;
    FLAG_C = src << 8;
@@ -2936,6 +3154,7 @@ void m68k_op_ror_16_pi(void)
 
    m68ki_write_16(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_16(res);
    FLAG_Z = res;
    FLAG_C = src << 8;
@@ -2951,6 +3170,7 @@ void m68k_op_ror_16_pd(void)
 
    m68ki_write_16(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_16(res);
    FLAG_Z = res;
    FLAG_C = src << 8;
@@ -2966,6 +3186,7 @@ void m68k_op_ror_16_di(void)
 
    m68ki_write_16(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_16(res);
    FLAG_Z = res;
    FLAG_C = src << 8;
@@ -2981,6 +3202,7 @@ void m68k_op_ror_16_ix(void)
 
    m68ki_write_16(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_16(res);
    FLAG_Z = res;
    FLAG_C = src << 8;
@@ -2996,6 +3218,7 @@ void m68k_op_ror_16_aw(void)
 
    m68ki_write_16(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_16(res);
    FLAG_Z = res;
    FLAG_C = src << 8;
@@ -3011,6 +3234,7 @@ void m68k_op_ror_16_al(void)
 
    m68ki_write_16(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_16(res);
    FLAG_Z = res;
    FLAG_C = src << 8;
@@ -3028,6 +3252,7 @@ void m68k_op_rol_8_s(void)
 
    *r_dst = MASK_OUT_BELOW_8(*r_dst) | res;
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_8(res);
    FLAG_Z = res;
    FLAG_C = src << orig_shift;
@@ -3044,6 +3269,7 @@ void m68k_op_rol_16_s(void)
 
    *r_dst = MASK_OUT_BELOW_16(*r_dst) | res;
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_16(res);
    FLAG_Z = res;
    FLAG_C = src >> (8-shift);
@@ -3060,6 +3286,7 @@ void m68k_op_rol_32_s(void)
 
    *r_dst = res;
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_32(res);
    FLAG_Z = res;
    FLAG_C = src >> (24-shift);
@@ -3075,6 +3302,8 @@ void m68k_op_rol_8_r(void)
    uint src = MASK_OUT_ABOVE_8(*r_dst);
    uint res = ROL_8(src, shift);
 
+   m68ki_resolve_flags();
+
    if(orig_shift != 0)
    {
       USE_CYCLES(orig_shift<<CYC_SHIFT);
@@ -3110,6 +3339,8 @@ void m68k_op_rol_16_r(void)
    uint src = MASK_OUT_ABOVE_16(*r_dst);
    uint res = MASK_OUT_ABOVE_16(ROL_16(src, shift));
 
+   m68ki_resolve_flags();
+
    if(orig_shift != 0)
    {
       USE_CYCLES(orig_shift<<CYC_SHIFT);
@@ -3142,6 +3373,8 @@ void m68k_op_rol_32_r(void)
    uint* r_dst = &DY;
    uint orig_shift = DX & 0x3f;
    uint shift = orig_shift & 31;
+
+   m68ki_resolve_flags();
    uint64 src = *r_dst;
    uint res = ROL_32(src, shift);
 
@@ -3173,6 +3406,7 @@ void m68k_op_rol_16_ai(void)
 
    m68ki_write_16(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_16(res);
    FLAG_Z = res;
    FLAG_C = src >> 7;
@@ -3188,6 +3422,7 @@ void m68k_op_rol_16_pi(void)
 
    m68ki_write_16(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_16(res);
    FLAG_Z = res;
    FLAG_C = src >> 7;
@@ -3203,6 +3438,7 @@ void m68k_op_rol_16_pd(void)
 
    m68ki_write_16(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_16(res);
    FLAG_Z = res;
    FLAG_C = src >> 7;
@@ -3218,6 +3454,7 @@ void m68k_op_rol_16_di(void)
 
    m68ki_write_16(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_16(res);
    FLAG_Z = res;
    FLAG_C = src >> 7;
@@ -3233,6 +3470,7 @@ void m68k_op_rol_16_ix(void)
 
    m68ki_write_16(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_16(res);
    FLAG_Z = res;
    FLAG_C = src >> 7;
@@ -3248,6 +3486,7 @@ void m68k_op_rol_16_aw(void)
 
    m68ki_write_16(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_16(res);
    FLAG_Z = res;
    FLAG_C = src >> 7;
@@ -3263,6 +3502,7 @@ void m68k_op_rol_16_al(void)
 
    m68ki_write_16(ea, res);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_16(res);
    FLAG_Z = res;
    FLAG_C = src >> 7;
@@ -3277,6 +3517,8 @@ void m68k_op_roxr_8_s(void)
    uint src = MASK_OUT_ABOVE_8(*r_dst);
    uint res = ROR_9(src | (XFLAG_AS_1() << 8), shift);
 
+   m68ki_resolve_flags();
+
    FLAG_C = FLAG_X = res;
    res = MASK_OUT_ABOVE_8(res);
 
@@ -3295,6 +3537,8 @@ void m68k_op_roxr_16_s(void)
    uint src = MASK_OUT_ABOVE_16(*r_dst);
    uint res = ROR_17(src | (XFLAG_AS_1() << 16), shift);
 
+   m68ki_resolve_flags();
+
    FLAG_C = FLAG_X = res >> 8;
    res = MASK_OUT_ABOVE_16(res);
 
@@ -3308,6 +3552,7 @@ void m68k_op_roxr_16_s(void)
 
 void m68k_op_roxr_32_s(void)
 {
+   m68ki_resolve_flags();
 #if M68K_USE_64_BIT
 
    uint*  r_dst = &DY;
@@ -3350,6 +3595,8 @@ void m68k_op_roxr_8_r(void)
    uint* r_dst = &DY;
    uint orig_shift = DX & 0x3f;
 
+   m68ki_resolve_flags();
+
    if(orig_shift != 0)
    {
       uint shift = orig_shift % 9;
@@ -3380,6 +3627,8 @@ void m68k_op_roxr_16_r(void)
    uint* r_dst = &DY;
    uint orig_shift = DX & 0x3f;
 
+   m68ki_resolve_flags();
+
    if(orig_shift != 0)
    {
       uint shift = orig_shift % 17;
@@ -3407,6 +3656,7 @@ void m68k_op_roxr_16_r(void)
 
 void m68k_op_roxr_32_r(void)
 {
+   m68ki_resolve_flags();
 #if M68K_USE_64_BIT
 
    uint*  r_dst = &DY;
@@ -3471,6 +3721,8 @@ void m68k_op_roxr_16_ai(void)
    uint src = m68ki_read_16(ea);
    uint res = ROR_17(src | (XFLAG_AS_1() << 16), 1);
 
+   m68ki_resolve_flags();
+
    FLAG_C = FLAG_X = res >> 8;
    res = MASK_OUT_ABOVE_16(res);
 
@@ -3488,6 +3740,8 @@ void m68k_op_roxr_16_pi(void)
    uint src = m68ki_read_16(ea);
    uint res = ROR_17(src | (XFLAG_AS_1() << 16), 1);
 
+   m68ki_resolve_flags();
+
    FLAG_C = FLAG_X = res >> 8;
    res = MASK_OUT_ABOVE_16(res);
 
@@ -3505,6 +3759,8 @@ void m68k_op_roxr_16_pd(void)
    uint src = m68ki_read_16(ea);
    uint res = ROR_17(src | (XFLAG_AS_1() << 16), 1);
 
+   m68ki_resolve_flags();
+
    FLAG_C = FLAG_X = res >> 8;
    res = MASK_OUT_ABOVE_16(res);
 
@@ -3522,6 +3778,8 @@ void m68k_op_roxr_16_di(void)
    uint src = m68ki_read_16(ea);
    uint res = ROR_17(src | (XFLAG_AS_1() << 16), 1);
 
+   m68ki_resolve_flags();
+
    FLAG_C = FLAG_X = res >> 8;
    res = MASK_OUT_ABOVE_16(res);
 
@@ -3539,6 +3797,8 @@ void m68k_op_roxr_16_ix(void)
    uint src = m68ki_read_16(ea);
    uint res = ROR_17(src | (XFLAG_AS_1() << 16), 1);
 
+   m68ki_resolve_flags();
+
    FLAG_C = FLAG_X = res >> 8;
    res = MASK_OUT_ABOVE_16(res);
 
@@ -3556,6 +3816,8 @@ void m68k_op_roxr_16_aw(void)
    uint src = m68ki_read_16(ea);
    uint res = ROR_17(src | (XFLAG_AS_1() << 16), 1);
 
+   m68ki_resolve_flags();
+
    FLAG_C = FLAG_X = res >> 8;
    res = MASK_OUT_ABOVE_16(res);
 
@@ -3573,6 +3835,8 @@ void m68k_op_roxr_16_al(void)
    uint src = m68ki_read_16(ea);
    uint res = ROR_17(src | (XFLAG_AS_1() << 16), 1);
 
+   m68ki_resolve_flags();
+
    FLAG_C = FLAG_X = res >> 8;
    res = MASK_OUT_ABOVE_16(res);
 
@@ -3591,6 +3855,8 @@ void m68k_op_roxl_8_s(void)
    uint src = MASK_OUT_ABOVE_8(*r_dst);
    uint res = ROL_9(src | (XFLAG_AS_1() << 8), shift);
 
+   m68ki_resolve_flags();
+
    FLAG_C = FLAG_X = res;
    res = MASK_OUT_ABOVE_8(res);
 
@@ -3609,6 +3875,8 @@ void m68k_op_roxl_16_s(void)
    uint src = MASK_OUT_ABOVE_16(*r_dst);
    uint res = ROL_17(src | (XFLAG_AS_1() << 16), shift);
 
+   m68ki_resolve_flags();
+
    FLAG_C = FLAG_X = res >> 8;
    res = MASK_OUT_ABOVE_16(res);
 
@@ -3622,6 +3890,7 @@ void m68k_op_roxl_16_s(void)
 
 void m68k_op_roxl_32_s(void)
 {
+   m68ki_resolve_flags();
 #if M68K_USE_64_BIT
 
    uint*  r_dst = &DY;
@@ -3664,6 +3933,8 @@ void m68k_op_roxl_8_r(void)
    uint* r_dst = &DY;
    uint orig_shift = DX & 0x3f;
 
+   m68ki_resolve_flags();
+
 
    if(orig_shift != 0)
    {
@@ -3695,6 +3966,8 @@ void m68k_op_roxl_16_r(void)
    uint* r_dst = &DY;
    uint orig_shift = DX & 0x3f;
 
+   m68ki_resolve_flags();
+
    if(orig_shift != 0)
    {
       uint shift = orig_shift % 17;
@@ -3722,6 +3995,7 @@ void m68k_op_roxl_16_r(void)
 
 void m68k_op_roxl_32_r(void)
 {
+   m68ki_resolve_flags();
 #if M68K_USE_64_BIT
 
    uint*  r_dst = &DY;
@@ -3786,6 +4060,8 @@ void m68k_op_roxl_16_ai(void)
    uint src = m68ki_read_16(ea);
    uint res = ROL_17(src | (XFLAG_AS_1() << 16), 1);
 
+   m68ki_resolve_flags();
+
    FLAG_C = FLAG_X = res >> 8;
    res = MASK_OUT_ABOVE_16(res);
 
@@ -3803,6 +4079,8 @@ void m68k_op_roxl_16_pi(void)
    uint src = m68ki_read_16(ea);
    uint res = ROL_17(src | (XFLAG_AS_1() << 16), 1);
 
+   m68ki_resolve_flags();
+
    FLAG_C = FLAG_X = res >> 8;
    res = MASK_OUT_ABOVE_16(res);
 
@@ -3820,6 +4098,8 @@ void m68k_op_roxl_16_pd(void)
    uint src = m68ki_read_16(ea);
    uint res = ROL_17(src | (XFLAG_AS_1() << 16), 1);
 
+   m68ki_resolve_flags();
+
    FLAG_C = FLAG_X = res >> 8;
    res = MASK_OUT_ABOVE_16(res);
 
@@ -3837,6 +4117,8 @@ void m68k_op_roxl_16_di(void)
    uint src = m68ki_read_16(ea);
    uint res = ROL_17(src | (XFLAG_AS_1() << 16), 1);
 
+   m68ki_resolve_flags();
+
    FLAG_C = FLAG_X = res >> 8;
    res = MASK_OUT_ABOVE_16(res);
 
@@ -3854,6 +4136,8 @@ void m68k_op_roxl_16_ix(void)
    uint src = m68ki_read_16(ea);
    uint res = ROL_17(src | (XFLAG_AS_1() << 16), 1);
 
+   m68ki_resolve_flags();
+
    FLAG_C = FLAG_X = res >> 8;
    res = MASK_OUT_ABOVE_16(res);
 
@@ -3871,6 +4155,8 @@ void m68k_op_roxl_16_aw(void)
    uint src = m68ki_read_16(ea);
    uint res = ROL_17(src | (XFLAG_AS_1() << 16), 1);
 
+   m68ki_resolve_flags();
+
    FLAG_C = FLAG_X = res >> 8;
    res = MASK_OUT_ABOVE_16(res);
 
@@ -3888,6 +4174,8 @@ void m68k_op_roxl_16_al(void)
    uint src = m68ki_read_16(ea);
    uint res = ROL_17(src | (XFLAG_AS_1() << 16), 1);
 
+   m68ki_resolve_flags();
+
    FLAG_C = FLAG_X = res >> 8;
    res = MASK_OUT_ABOVE_16(res);
 
@@ -4035,6 +4323,8 @@ void m68k_op_sbcd_8_rr(void)
    uint dst = *r_dst;
    uint res = LOW_NIBBLE(dst) - LOW_NIBBLE(src) - XFLAG_AS_1();
 
+   m68ki_resolve_flags();
+
    FLAG_V = ~res; /* Undefined V behavior */
 
    if(res > 9)
@@ -4061,6 +4351,8 @@ void m68k_op_sbcd_8_mm_ax7(void)
    uint dst = m68ki_read_8(ea);
    uint res = LOW_NIBBLE(dst) - LOW_NIBBLE(src) - XFLAG_AS_1();
 
+   m68ki_resolve_flags();
+
    FLAG_V = ~res; /* Undefined V behavior */
 
    if(res > 9)
@@ -4087,6 +4379,8 @@ void m68k_op_sbcd_8_mm_ay7(void)
    uint dst = m68ki_read_8(ea);
    uint res = LOW_NIBBLE(dst) - LOW_NIBBLE(src) - XFLAG_AS_1();
 
+   m68ki_resolve_flags();
+
    FLAG_V = ~res; /* Undefined V behavior */
 
    if(res > 9)
@@ -4113,6 +4407,8 @@ void m68k_op_sbcd_8_mm_axy7(void)
    uint dst = m68ki_read_8(ea);
    uint res = LOW_NIBBLE(dst) - LOW_NIBBLE(src) - XFLAG_AS_1();
 
+   m68ki_resolve_flags();
+
    FLAG_V = ~res; /* Undefined V behavior */
 
    if(res > 9)
@@ -4139,6 +4435,8 @@ void m68k_op_sbcd_8_mm(void)
    uint dst = m68ki_read_8(ea);
    uint res = LOW_NIBBLE(dst) - LOW_NIBBLE(src) - XFLAG_AS_1();
 
+   m68ki_resolve_flags();
+
    FLAG_V = ~res; /* Undefined V behavior */
 
    if(res > 9)
@@ -4280,6 +4578,7 @@ void m68k_op_sf_8_al(void)
 
 void m68k_op_shi_8_d(void)
 {
+   m68ki_resolve_flags();
    if(COND_HI())
    {
       DY |= 0xff;
@@ -4292,6 +4591,7 @@ void m68k_op_shi_8_d(void)
 
 void m68k_op_sls_8_d(void)
 {
+   m68ki_resolve_flags();
    if(COND_LS())
    {
       DY |= 0xff;
@@ -4304,6 +4604,7 @@ void m68k_op_sls_8_d(void)
 
 void m68k_op_scc_8_d(void)
 {
+   m68ki_resolve_flags();
    if(COND_CC())
    {
       DY |= 0xff;
@@ -4316,6 +4617,7 @@ void m68k_op_scc_8_d(void)
 
 void m68k_op_scs_8_d(void)
 {
+   m68ki_resolve_flags();
    if(COND_CS())
    {
       DY |= 0xff;
@@ -4328,6 +4630,7 @@ void m68k_op_scs_8_d(void)
 
 void m68k_op_sne_8_d(void)
 {
+   m68ki_resolve_flags();
    if(COND_NE())
    {
       DY |= 0xff;
@@ -4340,6 +4643,7 @@ void m68k_op_sne_8_d(void)
 
 void m68k_op_seq_8_d(void)
 {
+   m68ki_resolve_flags();
    if(COND_EQ())
    {
       DY |= 0xff;
@@ -4352,6 +4656,7 @@ void m68k_op_seq_8_d(void)
 
 void m68k_op_svc_8_d(void)
 {
+   m68ki_resolve_flags();
    if(COND_VC())
    {
       DY |= 0xff;
@@ -4364,6 +4669,7 @@ void m68k_op_svc_8_d(void)
 
 void m68k_op_svs_8_d(void)
 {
+   m68ki_resolve_flags();
    if(COND_VS())
    {
       DY |= 0xff;
@@ -4376,6 +4682,7 @@ void m68k_op_svs_8_d(void)
 
 void m68k_op_spl_8_d(void)
 {
+   m68ki_resolve_flags();
    if(COND_PL())
    {
       DY |= 0xff;
@@ -4388,6 +4695,7 @@ void m68k_op_spl_8_d(void)
 
 void m68k_op_smi_8_d(void)
 {
+   m68ki_resolve_flags();
    if(COND_MI())
    {
       DY |= 0xff;
@@ -4400,6 +4708,7 @@ void m68k_op_smi_8_d(void)
 
 void m68k_op_sge_8_d(void)
 {
+   m68ki_resolve_flags();
    if(COND_GE())
    {
       DY |= 0xff;
@@ -4412,6 +4721,7 @@ void m68k_op_sge_8_d(void)
 
 void m68k_op_slt_8_d(void)
 {
+   m68ki_resolve_flags();
    if(COND_LT())
    {
       DY |= 0xff;
@@ -4424,6 +4734,7 @@ void m68k_op_slt_8_d(void)
 
 void m68k_op_sgt_8_d(void)
 {
+   m68ki_resolve_flags();
    if(COND_GT())
    {
       DY |= 0xff;
@@ -4436,6 +4747,7 @@ void m68k_op_sgt_8_d(void)
 
 void m68k_op_sle_8_d(void)
 {
+   m68ki_resolve_flags();
    if(COND_LE())
    {
       DY |= 0xff;
@@ -4448,756 +4760,882 @@ void m68k_op_sle_8_d(void)
 
 void m68k_op_shi_8_ai(void)
 {
+   m68ki_resolve_flags();
    m68ki_write_8(EA_AY_AI_8(), COND_HI() ? 0xff : 0);
 }
 
 
 void m68k_op_shi_8_pi(void)
 {
+   m68ki_resolve_flags();
    m68ki_write_8(EA_AY_PI_8(), COND_HI() ? 0xff : 0);
 }
 
 
 void m68k_op_shi_8_pi7(void)
 {
+   m68ki_resolve_flags();
    m68ki_write_8(EA_A7_PI_8(), COND_HI() ? 0xff : 0);
 }
 
 
 void m68k_op_shi_8_pd(void)
 {
+   m68ki_resolve_flags();
    m68ki_write_8(EA_AY_PD_8(), COND_HI() ? 0xff : 0);
 }
 
 
 void m68k_op_shi_8_pd7(void)
 {
+   m68ki_resolve_flags();
    m68ki_write_8(EA_A7_PD_8(), COND_HI() ? 0xff : 0);
 }
 
 
 void m68k_op_shi_8_di(void)
 {
+   m68ki_resolve_flags();
    m68ki_write_8(EA_AY_DI_8(), COND_HI() ? 0xff : 0);
 }
 
 
 void m68k_op_shi_8_ix(void)
 {
+   m68ki_resolve_flags();
    m68ki_write_8(EA_AY_IX_8(), COND_HI() ? 0xff : 0);
 }
 
 
 void m68k_op_shi_8_aw(void)
 {
+   m68ki_resolve_flags();
    m68ki_write_8(EA_AW_8(), COND_HI() ? 0xff : 0);
 }
 
 
 void m68k_op_shi_8_al(void)
 {
+   m68ki_resolve_flags();
    m68ki_write_8(EA_AL_8(), COND_HI() ? 0xff : 0);
 }
 
 
 void m68k_op_sls_8_ai(void)
 {
+   m68ki_resolve_flags();
    m68ki_write_8(EA_AY_AI_8(), COND_LS() ? 0xff : 0);
 }
 
 
 void m68k_op_sls_8_pi(void)
 {
+   m68ki_resolve_flags();
    m68ki_write_8(EA_AY_PI_8(), COND_LS() ? 0xff : 0);
 }
 
 
 void m68k_op_sls_8_pi7(void)
 {
+   m68ki_resolve_flags();
    m68ki_write_8(EA_A7_PI_8(), COND_LS() ? 0xff : 0);
 }
 
 
 void m68k_op_sls_8_pd(void)
 {
+   m68ki_resolve_flags();
    m68ki_write_8(EA_AY_PD_8(), COND_LS() ? 0xff : 0);
 }
 
 
 void m68k_op_sls_8_pd7(void)
 {
+   m68ki_resolve_flags();
    m68ki_write_8(EA_A7_PD_8(), COND_LS() ? 0xff : 0);
 }
 
 
 void m68k_op_sls_8_di(void)
 {
+   m68ki_resolve_flags();
    m68ki_write_8(EA_AY_DI_8(), COND_LS() ? 0xff : 0);
 }
 
 
 void m68k_op_sls_8_ix(void)
 {
+   m68ki_resolve_flags();
    m68ki_write_8(EA_AY_IX_8(), COND_LS() ? 0xff : 0);
 }
 
 
 void m68k_op_sls_8_aw(void)
 {
+   m68ki_resolve_flags();
    m68ki_write_8(EA_AW_8(), COND_LS() ? 0xff : 0);
 }
 
 
 void m68k_op_sls_8_al(void)
 {
+   m68ki_resolve_flags();
    m68ki_write_8(EA_AL_8(), COND_LS() ? 0xff : 0);
 }
 
 
 void m68k_op_scc_8_ai(void)
 {
+   m68ki_resolve_flags();
    m68ki_write_8(EA_AY_AI_8(), COND_CC() ? 0xff : 0);
 }
 
 
 void m68k_op_scc_8_pi(void)
 {
+   m68ki_resolve_flags();
    m68ki_write_8(EA_AY_PI_8(), COND_CC() ? 0xff : 0);
 }
 
 
 void m68k_op_scc_8_pi7(void)
 {
+   m68ki_resolve_flags();
    m68ki_write_8(EA_A7_PI_8(), COND_CC() ? 0xff : 0);
 }
 
 
 void m68k_op_scc_8_pd(void)
 {
+   m68ki_resolve_flags();
    m68ki_write_8(EA_AY_PD_8(), COND_CC() ? 0xff : 0);
 }
 
 
 void m68k_op_scc_8_pd7(void)
 {
+   m68ki_resolve_flags();
    m68ki_write_8(EA_A7_PD_8(), COND_CC() ? 0xff : 0);
 }
 
 
 void m68k_op_scc_8_di(void)
 {
+   m68ki_resolve_flags();
    m68ki_write_8(EA_AY_DI_8(), COND_CC() ? 0xff : 0);
 }
 
 
 void m68k_op_scc_8_ix(void)
 {
+   m68ki_resolve_flags();
    m68ki_write_8(EA_AY_IX_8(), COND_CC() ? 0xff : 0);
 }
 
 
 void m68k_op_scc_8_aw(void)
 {
+   m68ki_resolve_flags();
    m68ki_write_8(EA_AW_8(), COND_CC() ? 0xff : 0);
 }
 
 
 void m68k_op_scc_8_al(void)
 {
+   m68ki_resolve_flags();
    m68ki_write_8(EA_AL_8(), COND_CC() ? 0xff : 0);
 }
 
 
 void m68k_op_scs_8_ai(void)
 {
+   m68ki_resolve_flags();
    m68ki_write_8(EA_AY_AI_8(), COND_CS() ? 0xff : 0);
 }
 
 
 void m68k_op_scs_8_pi(void)
 {
+   m68ki_resolve_flags();
    m68ki_write_8(EA_AY_PI_8(), COND_CS() ? 0xff : 0);
 }
 
 
 void m68k_op_scs_8_pi7(void)
 {
+   m68ki_resolve_flags();
    m68ki_write_8(EA_A7_PI_8(), COND_CS() ? 0xff : 0);
 }
 
 
 void m68k_op_scs_8_pd(void)
 {
+   m68ki_resolve_flags();
    m68ki_write_8(EA_AY_PD_8(), COND_CS() ? 0xff : 0);
 }
 
 
 void m68k_op_scs_8_pd7(void)
 {
+   m68ki_resolve_flags();
    m68ki_write_8(EA_A7_PD_8(), COND_CS() ? 0xff : 0);
 }
 
 
 void m68k_op_scs_8_di(void)
 {
+   m68ki_resolve_flags();
    m68ki_write_8(EA_AY_DI_8(), COND_CS() ? 0xff : 0);
 }
 
 
 void m68k_op_scs_8_ix(void)
 {
+   m68ki_resolve_flags();
    m68ki_write_8(EA_AY_IX_8(), COND_CS() ? 0xff : 0);
 }
 
 
 void m68k_op_scs_8_aw(void)
 {
+   m68ki_resolve_flags();
    m68ki_write_8(EA_AW_8(), COND_CS() ? 0xff : 0);
 }
 
 
 void m68k_op_scs_8_al(void)
 {
+   m68ki_resolve_flags();
    m68ki_write_8(EA_AL_8(), COND_CS() ? 0xff : 0);
 }
 
 
 void m68k_op_sne_8_ai(void)
 {
+   m68ki_resolve_flags();
    m68ki_write_8(EA_AY_AI_8(), COND_NE() ? 0xff : 0);
 }
 
 
 void m68k_op_sne_8_pi(void)
 {
+   m68ki_resolve_flags();
    m68ki_write_8(EA_AY_PI_8(), COND_NE() ? 0xff : 0);
 }
 
 
 void m68k_op_sne_8_pi7(void)
 {
+   m68ki_resolve_flags();
    m68ki_write_8(EA_A7_PI_8(), COND_NE() ? 0xff : 0);
 }
 
 
 void m68k_op_sne_8_pd(void)
 {
+   m68ki_resolve_flags();
    m68ki_write_8(EA_AY_PD_8(), COND_NE() ? 0xff : 0);
 }
 
 
 void m68k_op_sne_8_pd7(void)
 {
+   m68ki_resolve_flags();
    m68ki_write_8(EA_A7_PD_8(), COND_NE() ? 0xff : 0);
 }
 
 
 void m68k_op_sne_8_di(void)
 {
+   m68ki_resolve_flags();
    m68ki_write_8(EA_AY_DI_8(), COND_NE() ? 0xff : 0);
 }
 
 
 void m68k_op_sne_8_ix(void)
 {
+   m68ki_resolve_flags();
    m68ki_write_8(EA_AY_IX_8(), COND_NE() ? 0xff : 0);
 }
 
 
 void m68k_op_sne_8_aw(void)
 {
+   m68ki_resolve_flags();
    m68ki_write_8(EA_AW_8(), COND_NE() ? 0xff : 0);
 }
 
 
 void m68k_op_sne_8_al(void)
 {
+   m68ki_resolve_flags();
    m68ki_write_8(EA_AL_8(), COND_NE() ? 0xff : 0);
 }
 
 
 void m68k_op_seq_8_ai(void)
 {
+   m68ki_resolve_flags();
    m68ki_write_8(EA_AY_AI_8(), COND_EQ() ? 0xff : 0);
 }
 
 
 void m68k_op_seq_8_pi(void)
 {
+   m68ki_resolve_flags();
    m68ki_write_8(EA_AY_PI_8(), COND_EQ() ? 0xff : 0);
 }
 
 
 void m68k_op_seq_8_pi7(void)
 {
+   m68ki_resolve_flags();
    m68ki_write_8(EA_A7_PI_8(), COND_EQ() ? 0xff : 0);
 }
 
 
 void m68k_op_seq_8_pd(void)
 {
+   m68ki_resolve_flags();
    m68ki_write_8(EA_AY_PD_8(), COND_EQ() ? 0xff : 0);
 }
 
 
 void m68k_op_seq_8_pd7(void)
 {
+   m68ki_resolve_flags();
    m68ki_write_8(EA_A7_PD_8(), COND_EQ() ? 0xff : 0);
 }
 
 
 void m68k_op_seq_8_di(void)
 {
+   m68ki_resolve_flags();
    m68ki_write_8(EA_AY_DI_8(), COND_EQ() ? 0xff : 0);
 }
 
 
 void m68k_op_seq_8_ix(void)
 {
+   m68ki_resolve_flags();
    m68ki_write_8(EA_AY_IX_8(), COND_EQ() ? 0xff : 0);
 }
 
 
 void m68k_op_seq_8_aw(void)
 {
+   m68ki_resolve_flags();
    m68ki_write_8(EA_AW_8(), COND_EQ() ? 0xff : 0);
 }
 
 
 void m68k_op_seq_8_al(void)
 {
+   m68ki_resolve_flags();
    m68ki_write_8(EA_AL_8(), COND_EQ() ? 0xff : 0);
 }
 
 
 void m68k_op_svc_8_ai(void)
 {
+   m68ki_resolve_flags();
    m68ki_write_8(EA_AY_AI_8(), COND_VC() ? 0xff : 0);
 }
 
 
 void m68k_op_svc_8_pi(void)
 {
+   m68ki_resolve_flags();
    m68ki_write_8(EA_AY_PI_8(), COND_VC() ? 0xff : 0);
 }
 
 
 void m68k_op_svc_8_pi7(void)
 {
+   m68ki_resolve_flags();
    m68ki_write_8(EA_A7_PI_8(), COND_VC() ? 0xff : 0);
 }
 
 
 void m68k_op_svc_8_pd(void)
 {
+   m68ki_resolve_flags();
    m68ki_write_8(EA_AY_PD_8(), COND_VC() ? 0xff : 0);
 }
 
 
 void m68k_op_svc_8_pd7(void)
 {
+   m68ki_resolve_flags();
    m68ki_write_8(EA_A7_PD_8(), COND_VC() ? 0xff : 0);
 }
 
 
 void m68k_op_svc_8_di(void)
 {
+   m68ki_resolve_flags();
    m68ki_write_8(EA_AY_DI_8(), COND_VC() ? 0xff : 0);
 }
 
 
 void m68k_op_svc_8_ix(void)
 {
+   m68ki_resolve_flags();
    m68ki_write_8(EA_AY_IX_8(), COND_VC() ? 0xff : 0);
 }
 
 
 void m68k_op_svc_8_aw(void)
 {
+   m68ki_resolve_flags();
    m68ki_write_8(EA_AW_8(), COND_VC() ? 0xff : 0);
 }
 
 
 void m68k_op_svc_8_al(void)
 {
+   m68ki_resolve_flags();
    m68ki_write_8(EA_AL_8(), COND_VC() ? 0xff : 0);
 }
 
 
 void m68k_op_svs_8_ai(void)
 {
+   m68ki_resolve_flags();
    m68ki_write_8(EA_AY_AI_8(), COND_VS() ? 0xff : 0);
 }
 
 
 void m68k_op_svs_8_pi(void)
 {
+   m68ki_resolve_flags();
    m68ki_write_8(EA_AY_PI_8(), COND_VS() ? 0xff : 0);
 }
 
 
 void m68k_op_svs_8_pi7(void)
 {
+   m68ki_resolve_flags();
    m68ki_write_8(EA_A7_PI_8(), COND_VS() ? 0xff : 0);
 }
 
 
 void m68k_op_svs_8_pd(void)
 {
+   m68ki_resolve_flags();
    m68ki_write_8(EA_AY_PD_8(), COND_VS() ? 0xff : 0);
 }
 
 
 void m68k_op_svs_8_pd7(void)
 {
+   m68ki_resolve_flags();
    m68ki_write_8(EA_A7_PD_8(), COND_VS() ? 0xff : 0);
 }
 
 
 void m68k_op_svs_8_di(void)
 {
+   m68ki_resolve_flags();
    m68ki_write_8(EA_AY_DI_8(), COND_VS() ? 0xff : 0);
 }
 
 
 void m68k_op_svs_8_ix(void)
 {
+   m68ki_resolve_flags();
    m68ki_write_8(EA_AY_IX_8(), COND_VS() ? 0xff : 0);
 }
 
 
 void m68k_op_svs_8_aw(void)
 {
+   m68ki_resolve_flags();
    m68ki_write_8(EA_AW_8(), COND_VS() ? 0xff : 0);
 }
 
 
 void m68k_op_svs_8_al(void)
 {
+   m68ki_resolve_flags();
    m68ki_write_8(EA_AL_8(), COND_VS() ? 0xff : 0);
 }
 
 
 void m68k_op_spl_8_ai(void)
 {
+   m68ki_resolve_flags();
    m68ki_write_8(EA_AY_AI_8(), COND_PL() ? 0xff : 0);
 }
 
 
 void m68k_op_spl_8_pi(void)
 {
+   m68ki_resolve_flags();
    m68ki_write_8(EA_AY_PI_8(), COND_PL() ? 0xff : 0);
 }
 
 
 void m68k_op_spl_8_pi7(void)
 {
+   m68ki_resolve_flags();
    m68ki_write_8(EA_A7_PI_8(), COND_PL() ? 0xff : 0);
 }
 
 
 void m68k_op_spl_8_pd(void)
 {
+   m68ki_resolve_flags();
    m68ki_write_8(EA_AY_PD_8(), COND_PL() ? 0xff : 0);
 }
 
 
 void m68k_op_spl_8_pd7(void)
 {
+   m68ki_resolve_flags();
    m68ki_write_8(EA_A7_PD_8(), COND_PL() ? 0xff : 0);
 }
 
 
 void m68k_op_spl_8_di(void)
 {
+   m68ki_resolve_flags();
    m68ki_write_8(EA_AY_DI_8(), COND_PL() ? 0xff : 0);
 }
 
 
 void m68k_op_spl_8_ix(void)
 {
+   m68ki_resolve_flags();
    m68ki_write_8(EA_AY_IX_8(), COND_PL() ? 0xff : 0);
 }
 
 
 void m68k_op_spl_8_aw(void)
 {
+   m68ki_resolve_flags();
    m68ki_write_8(EA_AW_8(), COND_PL() ? 0xff : 0);
 }
 
 
 void m68k_op_spl_8_al(void)
 {
+   m68ki_resolve_flags();
    m68ki_write_8(EA_AL_8(), COND_PL() ? 0xff : 0);
 }
 
 
 void m68k_op_smi_8_ai(void)
 {
+   m68ki_resolve_flags();
    m68ki_write_8(EA_AY_AI_8(), COND_MI() ? 0xff : 0);
 }
 
 
 void m68k_op_smi_8_pi(void)
 {
+   m68ki_resolve_flags();
    m68ki_write_8(EA_AY_PI_8(), COND_MI() ? 0xff : 0);
 }
 
 
 void m68k_op_smi_8_pi7(void)
 {
+   m68ki_resolve_flags();
    m68ki_write_8(EA_A7_PI_8(), COND_MI() ? 0xff : 0);
 }
 
 
 void m68k_op_smi_8_pd(void)
 {
+   m68ki_resolve_flags();
    m68ki_write_8(EA_AY_PD_8(), COND_MI() ? 0xff : 0);
 }
 
 
 void m68k_op_smi_8_pd7(void)
 {
+   m68ki_resolve_flags();
    m68ki_write_8(EA_A7_PD_8(), COND_MI() ? 0xff : 0);
 }
 
 
 void m68k_op_smi_8_di(void)
 {
+   m68ki_resolve_flags();
    m68ki_write_8(EA_AY_DI_8(), COND_MI() ? 0xff : 0);
 }
 
 
 void m68k_op_smi_8_ix(void)
 {
+   m68ki_resolve_flags();
    m68ki_write_8(EA_AY_IX_8(), COND_MI() ? 0xff : 0);
 }
 
 
 void m68k_op_smi_8_aw(void)
 {
+   m68ki_resolve_flags();
    m68ki_write_8(EA_AW_8(), COND_MI() ? 0xff : 0);
 }
 
 
 void m68k_op_smi_8_al(void)
 {
+   m68ki_resolve_flags();
    m68ki_write_8(EA_AL_8(), COND_MI() ? 0xff : 0);
 }
 
 
 void m68k_op_sge_8_ai(void)
 {
+   m68ki_resolve_flags();
    m68ki_write_8(EA_AY_AI_8(), COND_GE() ? 0xff : 0);
 }
 
 
 void m68k_op_sge_8_pi(void)
 {
+   m68ki_resolve_flags();
    m68ki_write_8(EA_AY_PI_8(), COND_GE() ? 0xff : 0);
 }
 
 
 void m68k_op_sge_8_pi7(void)
 {
+   m68ki_resolve_flags();
    m68ki_write_8(EA_A7_PI_8(), COND_GE() ? 0xff : 0);
 }
 
 
 void m68k_op_sge_8_pd(void)
 {
+   m68ki_resolve_flags();
    m68ki_write_8(EA_AY_PD_8(), COND_GE() ? 0xff : 0);
 }
 
 
 void m68k_op_sge_8_pd7(void)
 {
+   m68ki_resolve_flags();
    m68ki_write_8(EA_A7_PD_8(), COND_GE() ? 0xff : 0);
 }
 
 
 void m68k_op_sge_8_di(void)
 {
+   m68ki_resolve_flags();
    m68ki_write_8(EA_AY_DI_8(), COND_GE() ? 0xff : 0);
 }
 
 
 void m68k_op_sge_8_ix(void)
 {
+   m68ki_resolve_flags();
    m68ki_write_8(EA_AY_IX_8(), COND_GE() ? 0xff : 0);
 }
 
 
 void m68k_op_sge_8_aw(void)
 {
+   m68ki_resolve_flags();
    m68ki_write_8(EA_AW_8(), COND_GE() ? 0xff : 0);
 }
 
 
 void m68k_op_sge_8_al(void)
 {
+   m68ki_resolve_flags();
    m68ki_write_8(EA_AL_8(), COND_GE() ? 0xff : 0);
 }
 
 
 void m68k_op_slt_8_ai(void)
 {
+   m68ki_resolve_flags();
    m68ki_write_8(EA_AY_AI_8(), COND_LT() ? 0xff : 0);
 }
 
 
 void m68k_op_slt_8_pi(void)
 {
+   m68ki_resolve_flags();
    m68ki_write_8(EA_AY_PI_8(), COND_LT() ? 0xff : 0);
 }
 
 
 void m68k_op_slt_8_pi7(void)
 {
+   m68ki_resolve_flags();
    m68ki_write_8(EA_A7_PI_8(), COND_LT() ? 0xff : 0);
 }
 
 
 void m68k_op_slt_8_pd(void)
 {
+   m68ki_resolve_flags();
    m68ki_write_8(EA_AY_PD_8(), COND_LT() ? 0xff : 0);
 }
 
 
 void m68k_op_slt_8_pd7(void)
 {
+   m68ki_resolve_flags();
    m68ki_write_8(EA_A7_PD_8(), COND_LT() ? 0xff : 0);
 }
 
 
 void m68k_op_slt_8_di(void)
 {
+   m68ki_resolve_flags();
    m68ki_write_8(EA_AY_DI_8(), COND_LT() ? 0xff : 0);
 }
 
 
 void m68k_op_slt_8_ix(void)
 {
+   m68ki_resolve_flags();
    m68ki_write_8(EA_AY_IX_8(), COND_LT() ? 0xff : 0);
 }
 
 
 void m68k_op_slt_8_aw(void)
 {
+   m68ki_resolve_flags();
    m68ki_write_8(EA_AW_8(), COND_LT() ? 0xff : 0);
 }
 
 
 void m68k_op_slt_8_al(void)
 {
+   m68ki_resolve_flags();
    m68ki_write_8(EA_AL_8(), COND_LT() ? 0xff : 0);
 }
 
 
 void m68k_op_sgt_8_ai(void)
 {
+   m68ki_resolve_flags();
    m68ki_write_8(EA_AY_AI_8(), COND_GT() ? 0xff : 0);
 }
 
 
 void m68k_op_sgt_8_pi(void)
 {
+   m68ki_resolve_flags();
    m68ki_write_8(EA_AY_PI_8(), COND_GT() ? 0xff : 0);
 }
 
 
 void m68k_op_sgt_8_pi7(void)
 {
+   m68ki_resolve_flags();
    m68ki_write_8(EA_A7_PI_8(), COND_GT() ? 0xff : 0);
 }
 
 
 void m68k_op_sgt_8_pd(void)
 {
+   m68ki_resolve_flags();
    m68ki_write_8(EA_AY_PD_8(), COND_GT() ? 0xff : 0);
 }
 
 
 void m68k_op_sgt_8_pd7(void)
 {
+   m68ki_resolve_flags();
    m68ki_write_8(EA_A7_PD_8(), COND_GT() ? 0xff : 0);
 }
 
 
 void m68k_op_sgt_8_di(void)
 {
+   m68ki_resolve_flags();
    m68ki_write_8(EA_AY_DI_8(), COND_GT() ? 0xff : 0);
 }
 
 
 void m68k_op_sgt_8_ix(void)
 {
+   m68ki_resolve_flags();
    m68ki_write_8(EA_AY_IX_8(), COND_GT() ? 0xff : 0);
 }
 
 
 void m68k_op_sgt_8_aw(void)
 {
+   m68ki_resolve_flags();
    m68ki_write_8(EA_AW_8(), COND_GT() ? 0xff : 0);
 }
 
 
 void m68k_op_sgt_8_al(void)
 {
+   m68ki_resolve_flags();
    m68ki_write_8(EA_AL_8(), COND_GT() ? 0xff : 0);
 }
 
 
 void m68k_op_sle_8_ai(void)
 {
+   m68ki_resolve_flags();
    m68ki_write_8(EA_AY_AI_8(), COND_LE() ? 0xff : 0);
 }
 
 
 void m68k_op_sle_8_pi(void)
 {
+   m68ki_resolve_flags();
    m68ki_write_8(EA_AY_PI_8(), COND_LE() ? 0xff : 0);
 }
 
 
 void m68k_op_sle_8_pi7(void)
 {
+   m68ki_resolve_flags();
    m68ki_write_8(EA_A7_PI_8(), COND_LE() ? 0xff : 0);
 }
 
 
 void m68k_op_sle_8_pd(void)
 {
+   m68ki_resolve_flags();
    m68ki_write_8(EA_AY_PD_8(), COND_LE() ? 0xff : 0);
 }
 
 
 void m68k_op_sle_8_pd7(void)
 {
+   m68ki_resolve_flags();
    m68ki_write_8(EA_A7_PD_8(), COND_LE() ? 0xff : 0);
 }
 
 
 void m68k_op_sle_8_di(void)
 {
+   m68ki_resolve_flags();
    m68ki_write_8(EA_AY_DI_8(), COND_LE() ? 0xff : 0);
 }
 
 
 void m68k_op_sle_8_ix(void)
 {
+   m68ki_resolve_flags();
    m68ki_write_8(EA_AY_IX_8(), COND_LE() ? 0xff : 0);
 }
 
 
 void m68k_op_sle_8_aw(void)
 {
+   m68ki_resolve_flags();
    m68ki_write_8(EA_AW_8(), COND_LE() ? 0xff : 0);
 }
 
 
 void m68k_op_sle_8_al(void)
 {
+   m68ki_resolve_flags();
    m68ki_write_8(EA_AL_8(), COND_LE() ? 0xff : 0);
 }
 
@@ -5227,12 +5665,9 @@ void m68k_op_sub_8_er_d(void)
    uint dst = MASK_OUT_ABOVE_8(*r_dst);
    uint res = dst - src;
 
-   FLAG_N = NFLAG_8(res);
-   FLAG_X = FLAG_C = CFLAG_8(res);
-   FLAG_V = VFLAG_SUB_8(src, dst, res);
-   FLAG_Z = MASK_OUT_ABOVE_8(res);
+   m68ki_set_xnzvc_sub_8(src, dst, res);
 
-   *r_dst = MASK_OUT_BELOW_8(*r_dst) | FLAG_Z;
+   *r_dst = MASK_OUT_BELOW_8(*r_dst) | MASK_OUT_ABOVE_8(res);
 }
 
 
@@ -5243,12 +5678,9 @@ void m68k_op_sub_8_er_ai(void)
    uint dst = MASK_OUT_ABOVE_8(*r_dst);
    uint res = dst - src;
 
-   FLAG_N = NFLAG_8(res);
-   FLAG_X = FLAG_C = CFLAG_8(res);
-   FLAG_V = VFLAG_SUB_8(src, dst, res);
-   FLAG_Z = MASK_OUT_ABOVE_8(res);
+   m68ki_set_xnzvc_sub_8(src, dst, res);
 
-   *r_dst = MASK_OUT_BELOW_8(*r_dst) | FLAG_Z;
+   *r_dst = MASK_OUT_BELOW_8(*r_dst) | MASK_OUT_ABOVE_8(res);
 }
 
 
@@ -5259,12 +5691,9 @@ void m68k_op_sub_8_er_pi(void)
    uint dst = MASK_OUT_ABOVE_8(*r_dst);
    uint res = dst - src;
 
-   FLAG_N = NFLAG_8(res);
-   FLAG_X = FLAG_C = CFLAG_8(res);
-   FLAG_V = VFLAG_SUB_8(src, dst, res);
-   FLAG_Z = MASK_OUT_ABOVE_8(res);
+   m68ki_set_xnzvc_sub_8(src, dst, res);
 
-   *r_dst = MASK_OUT_BELOW_8(*r_dst) | FLAG_Z;
+   *r_dst = MASK_OUT_BELOW_8(*r_dst) | MASK_OUT_ABOVE_8(res);
 }
 
 
@@ -5275,12 +5704,9 @@ void m68k_op_sub_8_er_pi7(void)
    uint dst = MASK_OUT_ABOVE_8(*r_dst);
    uint res = dst - src;
 
-   FLAG_N = NFLAG_8(res);
-   FLAG_X = FLAG_C = CFLAG_8(res);
-   FLAG_V = VFLAG_SUB_8(src, dst, res);
-   FLAG_Z = MASK_OUT_ABOVE_8(res);
+   m68ki_set_xnzvc_sub_8(src, dst, res);
 
-   *r_dst = MASK_OUT_BELOW_8(*r_dst) | FLAG_Z;
+   *r_dst = MASK_OUT_BELOW_8(*r_dst) | MASK_OUT_ABOVE_8(res);
 }
 
 
@@ -5291,12 +5717,9 @@ void m68k_op_sub_8_er_pd(void)
    uint dst = MASK_OUT_ABOVE_8(*r_dst);
    uint res = dst - src;
 
-   FLAG_N = NFLAG_8(res);
-   FLAG_X = FLAG_C = CFLAG_8(res);
-   FLAG_V = VFLAG_SUB_8(src, dst, res);
-   FLAG_Z = MASK_OUT_ABOVE_8(res);
+   m68ki_set_xnzvc_sub_8(src, dst, res);
 
-   *r_dst = MASK_OUT_BELOW_8(*r_dst) | FLAG_Z;
+   *r_dst = MASK_OUT_BELOW_8(*r_dst) | MASK_OUT_ABOVE_8(res);
 }
 
 
@@ -5307,12 +5730,9 @@ void m68k_op_sub_8_er_pd7(void)
    uint dst = MASK_OUT_ABOVE_8(*r_dst);
    uint res = dst - src;
 
-   FLAG_N = NFLAG_8(res);
-   FLAG_X = FLAG_C = CFLAG_8(res);
-   FLAG_V = VFLAG_SUB_8(src, dst, res);
-   FLAG_Z = MASK_OUT_ABOVE_8(res);
+   m68ki_set_xnzvc_sub_8(src, dst, res);
 
-   *r_dst = MASK_OUT_BELOW_8(*r_dst) | FLAG_Z;
+   *r_dst = MASK_OUT_BELOW_8(*r_dst) | MASK_OUT_ABOVE_8(res);
 }
 
 
@@ -5323,12 +5743,9 @@ void m68k_op_sub_8_er_di(void)
    uint dst = MASK_OUT_ABOVE_8(*r_dst);
    uint res = dst - src;
 
-   FLAG_N = NFLAG_8(res);
-   FLAG_X = FLAG_C = CFLAG_8(res);
-   FLAG_V = VFLAG_SUB_8(src, dst, res);
-   FLAG_Z = MASK_OUT_ABOVE_8(res);
+   m68ki_set_xnzvc_sub_8(src, dst, res);
 
-   *r_dst = MASK_OUT_BELOW_8(*r_dst) | FLAG_Z;
+   *r_dst = MASK_OUT_BELOW_8(*r_dst) | MASK_OUT_ABOVE_8(res);
 }
 
 
@@ -5339,12 +5756,9 @@ void m68k_op_sub_8_er_ix(void)
    uint dst = MASK_OUT_ABOVE_8(*r_dst);
    uint res = dst - src;
 
-   FLAG_N = NFLAG_8(res);
-   FLAG_X = FLAG_C = CFLAG_8(res);
-   FLAG_V = VFLAG_SUB_8(src, dst, res);
-   FLAG_Z = MASK_OUT_ABOVE_8(res);
+   m68ki_set_xnzvc_sub_8(src, dst, res);
 
-   *r_dst = MASK_OUT_BELOW_8(*r_dst) | FLAG_Z;
+   *r_dst = MASK_OUT_BELOW_8(*r_dst) | MASK_OUT_ABOVE_8(res);
 }
 
 
@@ -5355,12 +5769,9 @@ void m68k_op_sub_8_er_aw(void)
    uint dst = MASK_OUT_ABOVE_8(*r_dst);
    uint res = dst - src;
 
-   FLAG_N = NFLAG_8(res);
-   FLAG_X = FLAG_C = CFLAG_8(res);
-   FLAG_V = VFLAG_SUB_8(src, dst, res);
-   FLAG_Z = MASK_OUT_ABOVE_8(res);
+   m68ki_set_xnzvc_sub_8(src, dst, res);
 
-   *r_dst = MASK_OUT_BELOW_8(*r_dst) | FLAG_Z;
+   *r_dst = MASK_OUT_BELOW_8(*r_dst) | MASK_OUT_ABOVE_8(res);
 }
 
 
@@ -5371,12 +5782,9 @@ void m68k_op_sub_8_er_al(void)
    uint dst = MASK_OUT_ABOVE_8(*r_dst);
    uint res = dst - src;
 
-   FLAG_N = NFLAG_8(res);
-   FLAG_X = FLAG_C = CFLAG_8(res);
-   FLAG_V = VFLAG_SUB_8(src, dst, res);
-   FLAG_Z = MASK_OUT_ABOVE_8(res);
+   m68ki_set_xnzvc_sub_8(src, dst, res);
 
-   *r_dst = MASK_OUT_BELOW_8(*r_dst) | FLAG_Z;
+   *r_dst = MASK_OUT_BELOW_8(*r_dst) | MASK_OUT_ABOVE_8(res);
 }
 
 
@@ -5387,12 +5795,9 @@ void m68k_op_sub_8_er_pcdi(void)
    uint dst = MASK_OUT_ABOVE_8(*r_dst);
    uint res = dst - src;
 
-   FLAG_N = NFLAG_8(res);
-   FLAG_X = FLAG_C = CFLAG_8(res);
-   FLAG_V = VFLAG_SUB_8(src, dst, res);
-   FLAG_Z = MASK_OUT_ABOVE_8(res);
+   m68ki_set_xnzvc_sub_8(src, dst, res);
 
-   *r_dst = MASK_OUT_BELOW_8(*r_dst) | FLAG_Z;
+   *r_dst = MASK_OUT_BELOW_8(*r_dst) | MASK_OUT_ABOVE_8(res);
 }
 
 
@@ -5403,12 +5808,9 @@ void m68k_op_sub_8_er_pcix(void)
    uint dst = MASK_OUT_ABOVE_8(*r_dst);
    uint res = dst - src;
 
-   FLAG_N = NFLAG_8(res);
-   FLAG_X = FLAG_C = CFLAG_8(res);
-   FLAG_V = VFLAG_SUB_8(src, dst, res);
-   FLAG_Z = MASK_OUT_ABOVE_8(res);
+   m68ki_set_xnzvc_sub_8(src, dst, res);
 
-   *r_dst = MASK_OUT_BELOW_8(*r_dst) | FLAG_Z;
+   *r_dst = MASK_OUT_BELOW_8(*r_dst) | MASK_OUT_ABOVE_8(res);
 }
 
 
@@ -5419,12 +5821,9 @@ void m68k_op_sub_8_er_i(void)
    uint dst = MASK_OUT_ABOVE_8(*r_dst);
    uint res = dst - src;
 
-   FLAG_N = NFLAG_8(res);
-   FLAG_X = FLAG_C = CFLAG_8(res);
-   FLAG_V = VFLAG_SUB_8(src, dst, res);
-   FLAG_Z = MASK_OUT_ABOVE_8(res);
+   m68ki_set_xnzvc_sub_8(src, dst, res);
 
-   *r_dst = MASK_OUT_BELOW_8(*r_dst) | FLAG_Z;
+   *r_dst = MASK_OUT_BELOW_8(*r_dst) | MASK_OUT_ABOVE_8(res);
 }
 
 
@@ -5435,12 +5834,9 @@ void m68k_op_sub_16_er_d(void)
    uint dst = MASK_OUT_ABOVE_16(*r_dst);
    uint res = dst - src;
 
-   FLAG_N = NFLAG_16(res);
-   FLAG_X = FLAG_C = CFLAG_16(res);
-   FLAG_V = VFLAG_SUB_16(src, dst, res);
-   FLAG_Z = MASK_OUT_ABOVE_16(res);
+   m68ki_set_xnzvc_sub_16(src, dst, res);
 
-   *r_dst = MASK_OUT_BELOW_16(*r_dst) | FLAG_Z;
+   *r_dst = MASK_OUT_BELOW_16(*r_dst) | MASK_OUT_ABOVE_16(res);
 }
 
 
@@ -5451,12 +5847,9 @@ void m68k_op_sub_16_er_a(void)
    uint dst = MASK_OUT_ABOVE_16(*r_dst);
    uint res = dst - src;
 
-   FLAG_N = NFLAG_16(res);
-   FLAG_X = FLAG_C = CFLAG_16(res);
-   FLAG_V = VFLAG_SUB_16(src, dst, res);
-   FLAG_Z = MASK_OUT_ABOVE_16(res);
+   m68ki_set_xnzvc_sub_16(src, dst, res);
 
-   *r_dst = MASK_OUT_BELOW_16(*r_dst) | FLAG_Z;
+   *r_dst = MASK_OUT_BELOW_16(*r_dst) | MASK_OUT_ABOVE_16(res);
 }
 
 
@@ -5467,12 +5860,9 @@ void m68k_op_sub_16_er_ai(void)
    uint dst = MASK_OUT_ABOVE_16(*r_dst);
    uint res = dst - src;
 
-   FLAG_N = NFLAG_16(res);
-   FLAG_X = FLAG_C = CFLAG_16(res);
-   FLAG_V = VFLAG_SUB_16(src, dst, res);
-   FLAG_Z = MASK_OUT_ABOVE_16(res);
+   m68ki_set_xnzvc_sub_16(src, dst, res);
 
-   *r_dst = MASK_OUT_BELOW_16(*r_dst) | FLAG_Z;
+   *r_dst = MASK_OUT_BELOW_16(*r_dst) | MASK_OUT_ABOVE_16(res);
 }
 
 
@@ -5483,12 +5873,9 @@ void m68k_op_sub_16_er_pi(void)
    uint dst = MASK_OUT_ABOVE_16(*r_dst);
    uint res = dst - src;
 
-   FLAG_N = NFLAG_16(res);
-   FLAG_X = FLAG_C = CFLAG_16(res);
-   FLAG_V = VFLAG_SUB_16(src, dst, res);
-   FLAG_Z = MASK_OUT_ABOVE_16(res);
+   m68ki_set_xnzvc_sub_16(src, dst, res);
 
-   *r_dst = MASK_OUT_BELOW_16(*r_dst) | FLAG_Z;
+   *r_dst = MASK_OUT_BELOW_16(*r_dst) | MASK_OUT_ABOVE_16(res);
 }
 
 
@@ -5499,12 +5886,9 @@ void m68k_op_sub_16_er_pd(void)
    uint dst = MASK_OUT_ABOVE_16(*r_dst);
    uint res = dst - src;
 
-   FLAG_N = NFLAG_16(res);
-   FLAG_X = FLAG_C = CFLAG_16(res);
-   FLAG_V = VFLAG_SUB_16(src, dst, res);
-   FLAG_Z = MASK_OUT_ABOVE_16(res);
+   m68ki_set_xnzvc_sub_16(src, dst, res);
 
-   *r_dst = MASK_OUT_BELOW_16(*r_dst) | FLAG_Z;
+   *r_dst = MASK_OUT_BELOW_16(*r_dst) | MASK_OUT_ABOVE_16(res);
 }
 
 
@@ -5515,12 +5899,9 @@ void m68k_op_sub_16_er_di(void)
    uint dst = MASK_OUT_ABOVE_16(*r_dst);
    uint res = dst - src;
 
-   FLAG_N = NFLAG_16(res);
-   FLAG_X = FLAG_C = CFLAG_16(res);
-   FLAG_V = VFLAG_SUB_16(src, dst, res);
-   FLAG_Z = MASK_OUT_ABOVE_16(res);
+   m68ki_set_xnzvc_sub_16(src, dst, res);
 
-   *r_dst = MASK_OUT_BELOW_16(*r_dst) | FLAG_Z;
+   *r_dst = MASK_OUT_BELOW_16(*r_dst) | MASK_OUT_ABOVE_16(res);
 }
 
 
@@ -5531,12 +5912,9 @@ void m68k_op_sub_16_er_ix(void)
    uint dst = MASK_OUT_ABOVE_16(*r_dst);
    uint res = dst - src;
 
-   FLAG_N = NFLAG_16(res);
-   FLAG_X = FLAG_C = CFLAG_16(res);
-   FLAG_V = VFLAG_SUB_16(src, dst, res);
-   FLAG_Z = MASK_OUT_ABOVE_16(res);
+   m68ki_set_xnzvc_sub_16(src, dst, res);
 
-   *r_dst = MASK_OUT_BELOW_16(*r_dst) | FLAG_Z;
+   *r_dst = MASK_OUT_BELOW_16(*r_dst) | MASK_OUT_ABOVE_16(res);
 }
 
 
@@ -5547,12 +5925,9 @@ void m68k_op_sub_16_er_aw(void)
    uint dst = MASK_OUT_ABOVE_16(*r_dst);
    uint res = dst - src;
 
-   FLAG_N = NFLAG_16(res);
-   FLAG_X = FLAG_C = CFLAG_16(res);
-   FLAG_V = VFLAG_SUB_16(src, dst, res);
-   FLAG_Z = MASK_OUT_ABOVE_16(res);
+   m68ki_set_xnzvc_sub_16(src, dst, res);
 
-   *r_dst = MASK_OUT_BELOW_16(*r_dst) | FLAG_Z;
+   *r_dst = MASK_OUT_BELOW_16(*r_dst) | MASK_OUT_ABOVE_16(res);
 }
 
 
@@ -5563,12 +5938,9 @@ void m68k_op_sub_16_er_al(void)
    uint dst = MASK_OUT_ABOVE_16(*r_dst);
    uint res = dst - src;
 
-   FLAG_N = NFLAG_16(res);
-   FLAG_X = FLAG_C = CFLAG_16(res);
-   FLAG_V = VFLAG_SUB_16(src, dst, res);
-   FLAG_Z = MASK_OUT_ABOVE_16(res);
+   m68ki_set_xnzvc_sub_16(src, dst, res);
 
-   *r_dst = MASK_OUT_BELOW_16(*r_dst) | FLAG_Z;
+   *r_dst = MASK_OUT_BELOW_16(*r_dst) | MASK_OUT_ABOVE_16(res);
 }
 
 
@@ -5579,12 +5951,9 @@ void m68k_op_sub_16_er_pcdi(void)
    uint dst = MASK_OUT_ABOVE_16(*r_dst);
    uint res = dst - src;
 
-   FLAG_N = NFLAG_16(res);
-   FLAG_X = FLAG_C = CFLAG_16(res);
-   FLAG_V = VFLAG_SUB_16(src, dst, res);
-   FLAG_Z = MASK_OUT_ABOVE_16(res);
+   m68ki_set_xnzvc_sub_16(src, dst, res);
 
-   *r_dst = MASK_OUT_BELOW_16(*r_dst) | FLAG_Z;
+   *r_dst = MASK_OUT_BELOW_16(*r_dst) | MASK_OUT_ABOVE_16(res);
 }
 
 
@@ -5595,12 +5964,9 @@ void m68k_op_sub_16_er_pcix(void)
    uint dst = MASK_OUT_ABOVE_16(*r_dst);
    uint res = dst - src;
 
-   FLAG_N = NFLAG_16(res);
-   FLAG_X = FLAG_C = CFLAG_16(res);
-   FLAG_V = VFLAG_SUB_16(src, dst, res);
-   FLAG_Z = MASK_OUT_ABOVE_16(res);
+   m68ki_set_xnzvc_sub_16(src, dst, res);
 
-   *r_dst = MASK_OUT_BELOW_16(*r_dst) | FLAG_Z;
+   *r_dst = MASK_OUT_BELOW_16(*r_dst) | MASK_OUT_ABOVE_16(res);
 }
 
 
@@ -5611,12 +5977,9 @@ void m68k_op_sub_16_er_i(void)
    uint dst = MASK_OUT_ABOVE_16(*r_dst);
    uint res = dst - src;
 
-   FLAG_N = NFLAG_16(res);
-   FLAG_X = FLAG_C = CFLAG_16(res);
-   FLAG_V = VFLAG_SUB_16(src, dst, res);
-   FLAG_Z = MASK_OUT_ABOVE_16(res);
+   m68ki_set_xnzvc_sub_16(src, dst, res);
 
-   *r_dst = MASK_OUT_BELOW_16(*r_dst) | FLAG_Z;
+   *r_dst = MASK_OUT_BELOW_16(*r_dst) | MASK_OUT_ABOVE_16(res);
 }
 
 
@@ -5627,12 +5990,9 @@ void m68k_op_sub_32_er_d(void)
    uint dst = *r_dst;
    uint res = dst - src;
 
-   FLAG_N = NFLAG_32(res);
-   FLAG_X = FLAG_C = CFLAG_SUB_32(src, dst, res);
-   FLAG_V = VFLAG_SUB_32(src, dst, res);
-   FLAG_Z = MASK_OUT_ABOVE_32(res);
+   m68ki_set_xnzvc_sub_32(src, dst, res);
 
-   *r_dst = FLAG_Z;
+   *r_dst = MASK_OUT_ABOVE_32(res);
 }
 
 
@@ -5643,12 +6003,9 @@ void m68k_op_sub_32_er_a(void)
    uint dst = *r_dst;
    uint res = dst - src;
 
-   FLAG_N = NFLAG_32(res);
-   FLAG_X = FLAG_C = CFLAG_SUB_32(src, dst, res);
-   FLAG_V = VFLAG_SUB_32(src, dst, res);
-   FLAG_Z = MASK_OUT_ABOVE_32(res);
+   m68ki_set_xnzvc_sub_32(src, dst, res);
 
-   *r_dst = FLAG_Z;
+   *r_dst = MASK_OUT_ABOVE_32(res);
 }
 
 
@@ -5659,12 +6016,9 @@ void m68k_op_sub_32_er_ai(void)
    uint dst = *r_dst;
    uint res = dst - src;
 
-   FLAG_N = NFLAG_32(res);
-   FLAG_X = FLAG_C = CFLAG_SUB_32(src, dst, res);
-   FLAG_V = VFLAG_SUB_32(src, dst, res);
-   FLAG_Z = MASK_OUT_ABOVE_32(res);
+   m68ki_set_xnzvc_sub_32(src, dst, res);
 
-   *r_dst = FLAG_Z;
+   *r_dst = MASK_OUT_ABOVE_32(res);
 }
 
 
@@ -5675,12 +6029,9 @@ void m68k_op_sub_32_er_pi(void)
    uint dst = *r_dst;
    uint res = dst - src;
 
-   FLAG_N = NFLAG_32(res);
-   FLAG_X = FLAG_C = CFLAG_SUB_32(src, dst, res);
-   FLAG_V = VFLAG_SUB_32(src, dst, res);
-   FLAG_Z = MASK_OUT_ABOVE_32(res);
+   m68ki_set_xnzvc_sub_32(src, dst, res);
 
-   *r_dst = FLAG_Z;
+   *r_dst = MASK_OUT_ABOVE_32(res);
 }
 
 
@@ -5691,12 +6042,9 @@ void m68k_op_sub_32_er_pd(void)
    uint dst = *r_dst;
    uint res = dst - src;
 
-   FLAG_N = NFLAG_32(res);
-   FLAG_X = FLAG_C = CFLAG_SUB_32(src, dst, res);
-   FLAG_V = VFLAG_SUB_32(src, dst, res);
-   FLAG_Z = MASK_OUT_ABOVE_32(res);
+   m68ki_set_xnzvc_sub_32(src, dst, res);
 
-   *r_dst = FLAG_Z;
+   *r_dst = MASK_OUT_ABOVE_32(res);
 }
 
 
@@ -5707,12 +6055,9 @@ void m68k_op_sub_32_er_di(void)
    uint dst = *r_dst;
    uint res = dst - src;
 
-   FLAG_N = NFLAG_32(res);
-   FLAG_X = FLAG_C = CFLAG_SUB_32(src, dst, res);
-   FLAG_V = VFLAG_SUB_32(src, dst, res);
-   FLAG_Z = MASK_OUT_ABOVE_32(res);
+   m68ki_set_xnzvc_sub_32(src, dst, res);
 
-   *r_dst = FLAG_Z;
+   *r_dst = MASK_OUT_ABOVE_32(res);
 }
 
 
@@ -5723,12 +6068,9 @@ void m68k_op_sub_32_er_ix(void)
    uint dst = *r_dst;
    uint res = dst - src;
 
-   FLAG_N = NFLAG_32(res);
-   FLAG_X = FLAG_C = CFLAG_SUB_32(src, dst, res);
-   FLAG_V = VFLAG_SUB_32(src, dst, res);
-   FLAG_Z = MASK_OUT_ABOVE_32(res);
+   m68ki_set_xnzvc_sub_32(src, dst, res);
 
-   *r_dst = FLAG_Z;
+   *r_dst = MASK_OUT_ABOVE_32(res);
 }
 
 
@@ -5739,12 +6081,9 @@ void m68k_op_sub_32_er_aw(void)
    uint dst = *r_dst;
    uint res = dst - src;
 
-   FLAG_N = NFLAG_32(res);
-   FLAG_X = FLAG_C = CFLAG_SUB_32(src, dst, res);
-   FLAG_V = VFLAG_SUB_32(src, dst, res);
-   FLAG_Z = MASK_OUT_ABOVE_32(res);
+   m68ki_set_xnzvc_sub_32(src, dst, res);
 
-   *r_dst = FLAG_Z;
+   *r_dst = MASK_OUT_ABOVE_32(res);
 }
 
 
@@ -5755,12 +6094,9 @@ void m68k_op_sub_32_er_al(void)
    uint dst = *r_dst;
    uint res = dst - src;
 
-   FLAG_N = NFLAG_32(res);
-   FLAG_X = FLAG_C = CFLAG_SUB_32(src, dst, res);
-   FLAG_V = VFLAG_SUB_32(src, dst, res);
-   FLAG_Z = MASK_OUT_ABOVE_32(res);
+   m68ki_set_xnzvc_sub_32(src, dst, res);
 
-   *r_dst = FLAG_Z;
+   *r_dst = MASK_OUT_ABOVE_32(res);
 }
 
 
@@ -5771,12 +6107,9 @@ void m68k_op_sub_32_er_pcdi(void)
    uint dst = *r_dst;
    uint res = dst - src;
 
-   FLAG_N = NFLAG_32(res);
-   FLAG_X = FLAG_C = CFLAG_SUB_32(src, dst, res);
-   FLAG_V = VFLAG_SUB_32(src, dst, res);
-   FLAG_Z = MASK_OUT_ABOVE_32(res);
+   m68ki_set_xnzvc_sub_32(src, dst, res);
 
-   *r_dst = FLAG_Z;
+   *r_dst = MASK_OUT_ABOVE_32(res);
 }
 
 
@@ -5787,12 +6120,9 @@ void m68k_op_sub_32_er_pcix(void)
    uint dst = *r_dst;
    uint res = dst - src;
 
-   FLAG_N = NFLAG_32(res);
-   FLAG_X = FLAG_C = CFLAG_SUB_32(src, dst, res);
-   FLAG_V = VFLAG_SUB_32(src, dst, res);
-   FLAG_Z = MASK_OUT_ABOVE_32(res);
+   m68ki_set_xnzvc_sub_32(src, dst, res);
 
-   *r_dst = FLAG_Z;
+   *r_dst = MASK_OUT_ABOVE_32(res);
 }
 
 
@@ -5803,12 +6133,9 @@ void m68k_op_sub_32_er_i(void)
    uint dst = *r_dst;
    uint res = dst - src;
 
-   FLAG_N = NFLAG_32(res);
-   FLAG_X = FLAG_C = CFLAG_SUB_32(src, dst, res);
-   FLAG_V = VFLAG_SUB_32(src, dst, res);
-   FLAG_Z = MASK_OUT_ABOVE_32(res);
+   m68ki_set_xnzvc_sub_32(src, dst, res);
 
-   *r_dst = FLAG_Z;
+   *r_dst = MASK_OUT_ABOVE_32(res);
 }
 
 
@@ -5819,12 +6146,9 @@ void m68k_op_sub_8_re_ai(void)
    uint dst = m68ki_read_8(ea);
    uint res = dst - src;
 
-   FLAG_N = NFLAG_8(res);
-   FLAG_Z = MASK_OUT_ABOVE_8(res);
-   FLAG_X = FLAG_C = CFLAG_8(res);
-   FLAG_V = VFLAG_SUB_8(src, dst, res);
+   m68ki_set_xnzvc_sub_8(src, dst, res);
 
-   m68ki_write_8(ea, FLAG_Z);
+   m68ki_write_8(ea, MASK_OUT_ABOVE_8(res));
 }
 
 
@@ -5835,12 +6159,9 @@ void m68k_op_sub_8_re_pi(void)
    uint dst = m68ki_read_8(ea);
    uint res = dst - src;
 
-   FLAG_N = NFLAG_8(res);
-   FLAG_Z = MASK_OUT_ABOVE_8(res);
-   FLAG_X = FLAG_C = CFLAG_8(res);
-   FLAG_V = VFLAG_SUB_8(src, dst, res);
+   m68ki_set_xnzvc_sub_8(src, dst, res);
 
-   m68ki_write_8(ea, FLAG_Z);
+   m68ki_write_8(ea, MASK_OUT_ABOVE_8(res));
 }
 
 
@@ -5851,12 +6172,9 @@ void m68k_op_sub_8_re_pi7(void)
    uint dst = m68ki_read_8(ea);
    uint res = dst - src;
 
-   FLAG_N = NFLAG_8(res);
-   FLAG_Z = MASK_OUT_ABOVE_8(res);
-   FLAG_X = FLAG_C = CFLAG_8(res);
-   FLAG_V = VFLAG_SUB_8(src, dst, res);
+   m68ki_set_xnzvc_sub_8(src, dst, res);
 
-   m68ki_write_8(ea, FLAG_Z);
+   m68ki_write_8(ea, MASK_OUT_ABOVE_8(res));
 }
 
 
@@ -5867,12 +6185,9 @@ void m68k_op_sub_8_re_pd(void)
    uint dst = m68ki_read_8(ea);
    uint res = dst - src;
 
-   FLAG_N = NFLAG_8(res);
-   FLAG_Z = MASK_OUT_ABOVE_8(res);
-   FLAG_X = FLAG_C = CFLAG_8(res);
-   FLAG_V = VFLAG_SUB_8(src, dst, res);
+   m68ki_set_xnzvc_sub_8(src, dst, res);
 
-   m68ki_write_8(ea, FLAG_Z);
+   m68ki_write_8(ea, MASK_OUT_ABOVE_8(res));
 }
 
 
@@ -5883,12 +6198,9 @@ void m68k_op_sub_8_re_pd7(void)
    uint dst = m68ki_read_8(ea);
    uint res = dst - src;
 
-   FLAG_N = NFLAG_8(res);
-   FLAG_Z = MASK_OUT_ABOVE_8(res);
-   FLAG_X = FLAG_C = CFLAG_8(res);
-   FLAG_V = VFLAG_SUB_8(src, dst, res);
+   m68ki_set_xnzvc_sub_8(src, dst, res);
 
-   m68ki_write_8(ea, FLAG_Z);
+   m68ki_write_8(ea, MASK_OUT_ABOVE_8(res));
 }
 
 
@@ -5899,12 +6211,9 @@ void m68k_op_sub_8_re_di(void)
    uint dst = m68ki_read_8(ea);
    uint res = dst - src;
 
-   FLAG_N = NFLAG_8(res);
-   FLAG_Z = MASK_OUT_ABOVE_8(res);
-   FLAG_X = FLAG_C = CFLAG_8(res);
-   FLAG_V = VFLAG_SUB_8(src, dst, res);
+   m68ki_set_xnzvc_sub_8(src, dst, res);
 
-   m68ki_write_8(ea, FLAG_Z);
+   m68ki_write_8(ea, MASK_OUT_ABOVE_8(res));
 }
 
 
@@ -5915,12 +6224,9 @@ void m68k_op_sub_8_re_ix(void)
    uint dst = m68ki_read_8(ea);
    uint res = dst - src;
 
-   FLAG_N = NFLAG_8(res);
-   FLAG_Z = MASK_OUT_ABOVE_8(res);
-   FLAG_X = FLAG_C = CFLAG_8(res);
-   FLAG_V = VFLAG_SUB_8(src, dst, res);
+   m68ki_set_xnzvc_sub_8(src, dst, res);
 
-   m68ki_write_8(ea, FLAG_Z);
+   m68ki_write_8(ea, MASK_OUT_ABOVE_8(res));
 }
 
 
@@ -5931,12 +6237,9 @@ void m68k_op_sub_8_re_aw(void)
    uint dst = m68ki_read_8(ea);
    uint res = dst - src;
 
-   FLAG_N = NFLAG_8(res);
-   FLAG_Z = MASK_OUT_ABOVE_8(res);
-   FLAG_X = FLAG_C = CFLAG_8(res);
-   FLAG_V = VFLAG_SUB_8(src, dst, res);
+   m68ki_set_xnzvc_sub_8(src, dst, res);
 
-   m68ki_write_8(ea, FLAG_Z);
+   m68ki_write_8(ea, MASK_OUT_ABOVE_8(res));
 }
 
 
@@ -5947,12 +6250,9 @@ void m68k_op_sub_8_re_al(void)
    uint dst = m68ki_read_8(ea);
    uint res = dst - src;
 
-   FLAG_N = NFLAG_8(res);
-   FLAG_Z = MASK_OUT_ABOVE_8(res);
-   FLAG_X = FLAG_C = CFLAG_8(res);
-   FLAG_V = VFLAG_SUB_8(src, dst, res);
+   m68ki_set_xnzvc_sub_8(src, dst, res);
 
-   m68ki_write_8(ea, FLAG_Z);
+   m68ki_write_8(ea, MASK_OUT_ABOVE_8(res));
 }
 
 
@@ -5963,12 +6263,9 @@ void m68k_op_sub_16_re_ai(void)
    uint dst = m68ki_read_16(ea);
    uint res = dst - src;
 
-   FLAG_N = NFLAG_16(res);
-   FLAG_Z = MASK_OUT_ABOVE_16(res);
-   FLAG_X = FLAG_C = CFLAG_16(res);
-   FLAG_V = VFLAG_SUB_16(src, dst, res);
+   m68ki_set_xnzvc_sub_16(src, dst, res);
 
-   m68ki_write_16(ea, FLAG_Z);
+   m68ki_write_16(ea, MASK_OUT_ABOVE_16(res));
 }
 
 
@@ -5979,12 +6276,9 @@ void m68k_op_sub_16_re_pi(void)
    uint dst = m68ki_read_16(ea);
    uint res = dst - src;
 
-   FLAG_N = NFLAG_16(res);
-   FLAG_Z = MASK_OUT_ABOVE_16(res);
-   FLAG_X = FLAG_C = CFLAG_16(res);
-   FLAG_V = VFLAG_SUB_16(src, dst, res);
+   m68ki_set_xnzvc_sub_16(src, dst, res);
 
-   m68ki_write_16(ea, FLAG_Z);
+   m68ki_write_16(ea, MASK_OUT_ABOVE_16(res));
 }
 
 
@@ -5995,12 +6289,9 @@ void m68k_op_sub_16_re_pd(void)
    uint dst = m68ki_read_16(ea);
    uint res = dst - src;
 
-   FLAG_N = NFLAG_16(res);
-   FLAG_Z = MASK_OUT_ABOVE_16(res);
-   FLAG_X = FLAG_C = CFLAG_16(res);
-   FLAG_V = VFLAG_SUB_16(src, dst, res);
+   m68ki_set_xnzvc_sub_16(src, dst, res);
 
-   m68ki_write_16(ea, FLAG_Z);
+   m68ki_write_16(ea, MASK_OUT_ABOVE_16(res));
 }
 
 
@@ -6011,12 +6302,9 @@ void m68k_op_sub_16_re_di(void)
    uint dst = m68ki_read_16(ea);
    uint res = dst - src;
 
-   FLAG_N = NFLAG_16(res);
-   FLAG_Z = MASK_OUT_ABOVE_16(res);
-   FLAG_X = FLAG_C = CFLAG_16(res);
-   FLAG_V = VFLAG_SUB_16(src, dst, res);
+   m68ki_set_xnzvc_sub_16(src, dst, res);
 
-   m68ki_write_16(ea, FLAG_Z);
+   m68ki_write_16(ea, MASK_OUT_ABOVE_16(res));
 }
 
 
@@ -6027,12 +6315,9 @@ void m68k_op_sub_16_re_ix(void)
    uint dst = m68ki_read_16(ea);
    uint res = dst - src;
 
-   FLAG_N = NFLAG_16(res);
-   FLAG_Z = MASK_OUT_ABOVE_16(res);
-   FLAG_X = FLAG_C = CFLAG_16(res);
-   FLAG_V = VFLAG_SUB_16(src, dst, res);
+   m68ki_set_xnzvc_sub_16(src, dst, res);
 
-   m68ki_write_16(ea, FLAG_Z);
+   m68ki_write_16(ea, MASK_OUT_ABOVE_16(res));
 }
 
 
@@ -6043,12 +6328,9 @@ void m68k_op_sub_16_re_aw(void)
    uint dst = m68ki_read_16(ea);
    uint res = dst - src;
 
-   FLAG_N = NFLAG_16(res);
-   FLAG_Z = MASK_OUT_ABOVE_16(res);
-   FLAG_X = FLAG_C = CFLAG_16(res);
-   FLAG_V = VFLAG_SUB_16(src, dst, res);
+   m68ki_set_xnzvc_sub_16(src, dst, res);
 
-   m68ki_write_16(ea, FLAG_Z);
+   m68ki_write_16(ea, MASK_OUT_ABOVE_16(res));
 }
 
 
@@ -6059,12 +6341,9 @@ void m68k_op_sub_16_re_al(void)
    uint dst = m68ki_read_16(ea);
    uint res = dst - src;
 
-   FLAG_N = NFLAG_16(res);
-   FLAG_Z = MASK_OUT_ABOVE_16(res);
-   FLAG_X = FLAG_C = CFLAG_16(res);
-   FLAG_V = VFLAG_SUB_16(src, dst, res);
+   m68ki_set_xnzvc_sub_16(src, dst, res);
 
-   m68ki_write_16(ea, FLAG_Z);
+   m68ki_write_16(ea, MASK_OUT_ABOVE_16(res));
 }
 
 
@@ -6075,12 +6354,9 @@ void m68k_op_sub_32_re_ai(void)
    uint dst = m68ki_read_32(ea);
    uint res = dst - src;
 
-   FLAG_N = NFLAG_32(res);
-   FLAG_Z = MASK_OUT_ABOVE_32(res);
-   FLAG_X = FLAG_C = CFLAG_SUB_32(src, dst, res);
-   FLAG_V = VFLAG_SUB_32(src, dst, res);
+   m68ki_set_xnzvc_sub_32(src, dst, res);
 
-   m68ki_write_32(ea, FLAG_Z);
+   m68ki_write_32(ea, MASK_OUT_ABOVE_32(res));
 }
 
 
@@ -6091,12 +6367,9 @@ void m68k_op_sub_32_re_pi(void)
    uint dst = m68ki_read_32(ea);
    uint res = dst - src;
 
-   FLAG_N = NFLAG_32(res);
-   FLAG_Z = MASK_OUT_ABOVE_32(res);
-   FLAG_X = FLAG_C = CFLAG_SUB_32(src, dst, res);
-   FLAG_V = VFLAG_SUB_32(src, dst, res);
+   m68ki_set_xnzvc_sub_32(src, dst, res);
 
-   m68ki_write_32(ea, FLAG_Z);
+   m68ki_write_32(ea, MASK_OUT_ABOVE_32(res));
 }
 
 
@@ -6107,12 +6380,9 @@ void m68k_op_sub_32_re_pd(void)
    uint dst = m68ki_read_32(ea);
    uint res = dst - src;
 
-   FLAG_N = NFLAG_32(res);
-   FLAG_Z = MASK_OUT_ABOVE_32(res);
-   FLAG_X = FLAG_C = CFLAG_SUB_32(src, dst, res);
-   FLAG_V = VFLAG_SUB_32(src, dst, res);
+   m68ki_set_xnzvc_sub_32(src, dst, res);
 
-   m68ki_write_32(ea, FLAG_Z);
+   m68ki_write_32(ea, MASK_OUT_ABOVE_32(res));
 }
 
 
@@ -6123,12 +6393,9 @@ void m68k_op_sub_32_re_di(void)
    uint dst = m68ki_read_32(ea);
    uint res = dst - src;
 
-   FLAG_N = NFLAG_32(res);
-   FLAG_Z = MASK_OUT_ABOVE_32(res);
-   FLAG_X = FLAG_C = CFLAG_SUB_32(src, dst, res);
-   FLAG_V = VFLAG_SUB_32(src, dst, res);
+   m68ki_set_xnzvc_sub_32(src, dst, res);
 
-   m68ki_write_32(ea, FLAG_Z);
+   m68ki_write_32(ea, MASK_OUT_ABOVE_32(res));
 }
 
 
@@ -6139,12 +6406,9 @@ void m68k_op_sub_32_re_ix(void)
    uint dst = m68ki_read_32(ea);
    uint res = dst - src;
 
-   FLAG_N = NFLAG_32(res);
-   FLAG_Z = MASK_OUT_ABOVE_32(res);
-   FLAG_X = FLAG_C = CFLAG_SUB_32(src, dst, res);
-   FLAG_V = VFLAG_SUB_32(src, dst, res);
+   m68ki_set_xnzvc_sub_32(src, dst, res);
 
-   m68ki_write_32(ea, FLAG_Z);
+   m68ki_write_32(ea, MASK_OUT_ABOVE_32(res));
 }
 
 
@@ -6155,12 +6419,9 @@ void m68k_op_sub_32_re_aw(void)
    uint dst = m68ki_read_32(ea);
    uint res = dst - src;
 
-   FLAG_N = NFLAG_32(res);
-   FLAG_Z = MASK_OUT_ABOVE_32(res);
-   FLAG_X = FLAG_C = CFLAG_SUB_32(src, dst, res);
-   FLAG_V = VFLAG_SUB_32(src, dst, res);
+   m68ki_set_xnzvc_sub_32(src, dst, res);
 
-   m68ki_write_32(ea, FLAG_Z);
+   m68ki_write_32(ea, MASK_OUT_ABOVE_32(res));
 }
 
 
@@ -6171,12 +6432,9 @@ void m68k_op_sub_32_re_al(void)
    uint dst = m68ki_read_32(ea);
    uint res = dst - src;
 
-   FLAG_N = NFLAG_32(res);
-   FLAG_Z = MASK_OUT_ABOVE_32(res);
-   FLAG_X = FLAG_C = CFLAG_SUB_32(src, dst, res);
-   FLAG_V = VFLAG_SUB_32(src, dst, res);
+   m68ki_set_xnzvc_sub_32(src, dst, res);
 
-   m68ki_write_32(ea, FLAG_Z);
+   m68ki_write_32(ea, MASK_OUT_ABOVE_32(res));
 }
 
 
@@ -6399,12 +6657,9 @@ void m68k_op_subi_8_d(void)
    uint dst = MASK_OUT_ABOVE_8(*r_dst);
    uint res = dst - src;
 
-   FLAG_N = NFLAG_8(res);
-   FLAG_Z = MASK_OUT_ABOVE_8(res);
-   FLAG_X = FLAG_C = CFLAG_8(res);
-   FLAG_V = VFLAG_SUB_8(src, dst, res);
+   m68ki_set_xnzvc_sub_8(src, dst, res);
 
-   *r_dst = MASK_OUT_BELOW_8(*r_dst) | FLAG_Z;
+   *r_dst = MASK_OUT_BELOW_8(*r_dst) | MASK_OUT_ABOVE_8(res);
 }
 
 
@@ -6415,12 +6670,9 @@ void m68k_op_subi_8_ai(void)
    uint dst = m68ki_read_8(ea);
    uint res = dst - src;
 
-   FLAG_N = NFLAG_8(res);
-   FLAG_Z = MASK_OUT_ABOVE_8(res);
-   FLAG_X = FLAG_C = CFLAG_8(res);
-   FLAG_V = VFLAG_SUB_8(src, dst, res);
+   m68ki_set_xnzvc_sub_8(src, dst, res);
 
-   m68ki_write_8(ea, FLAG_Z);
+   m68ki_write_8(ea, MASK_OUT_ABOVE_8(res));
 }
 
 
@@ -6431,12 +6683,9 @@ void m68k_op_subi_8_pi(void)
    uint dst = m68ki_read_8(ea);
    uint res = dst - src;
 
-   FLAG_N = NFLAG_8(res);
-   FLAG_Z = MASK_OUT_ABOVE_8(res);
-   FLAG_X = FLAG_C = CFLAG_8(res);
-   FLAG_V = VFLAG_SUB_8(src, dst, res);
+   m68ki_set_xnzvc_sub_8(src, dst, res);
 
-   m68ki_write_8(ea, FLAG_Z);
+   m68ki_write_8(ea, MASK_OUT_ABOVE_8(res));
 }
 
 
@@ -6447,12 +6696,9 @@ void m68k_op_subi_8_pi7(void)
    uint dst = m68ki_read_8(ea);
    uint res = dst - src;
 
-   FLAG_N = NFLAG_8(res);
-   FLAG_Z = MASK_OUT_ABOVE_8(res);
-   FLAG_X = FLAG_C = CFLAG_8(res);
-   FLAG_V = VFLAG_SUB_8(src, dst, res);
+   m68ki_set_xnzvc_sub_8(src, dst, res);
 
-   m68ki_write_8(ea, FLAG_Z);
+   m68ki_write_8(ea, MASK_OUT_ABOVE_8(res));
 }
 
 
@@ -6463,12 +6709,9 @@ void m68k_op_subi_8_pd(void)
    uint dst = m68ki_read_8(ea);
    uint res = dst - src;
 
-   FLAG_N = NFLAG_8(res);
-   FLAG_Z = MASK_OUT_ABOVE_8(res);
-   FLAG_X = FLAG_C = CFLAG_8(res);
-   FLAG_V = VFLAG_SUB_8(src, dst, res);
+   m68ki_set_xnzvc_sub_8(src, dst, res);
 
-   m68ki_write_8(ea, FLAG_Z);
+   m68ki_write_8(ea, MASK_OUT_ABOVE_8(res));
 }
 
 
@@ -6479,12 +6722,9 @@ void m68k_op_subi_8_pd7(void)
    uint dst = m68ki_read_8(ea);
    uint res = dst - src;
 
-   FLAG_N = NFLAG_8(res);
-   FLAG_Z = MASK_OUT_ABOVE_8(res);
-   FLAG_X = FLAG_C = CFLAG_8(res);
-   FLAG_V = VFLAG_SUB_8(src, dst, res);
+   m68ki_set_xnzvc_sub_8(src, dst, res);
 
-   m68ki_write_8(ea, FLAG_Z);
+   m68ki_write_8(ea, MASK_OUT_ABOVE_8(res));
 }
 
 
@@ -6495,12 +6735,9 @@ void m68k_op_subi_8_di(void)
    uint dst = m68ki_read_8(ea);
    uint res = dst - src;
 
-   FLAG_N = NFLAG_8(res);
-   FLAG_Z = MASK_OUT_ABOVE_8(res);
-   FLAG_X = FLAG_C = CFLAG_8(res);
-   FLAG_V = VFLAG_SUB_8(src, dst, res);
+   m68ki_set_xnzvc_sub_8(src, dst, res);
 
-   m68ki_write_8(ea, FLAG_Z);
+   m68ki_write_8(ea, MASK_OUT_ABOVE_8(res));
 }
 
 
@@ -6511,12 +6748,9 @@ void m68k_op_subi_8_ix(void)
    uint dst = m68ki_read_8(ea);
    uint res = dst - src;
 
-   FLAG_N = NFLAG_8(res);
-   FLAG_Z = MASK_OUT_ABOVE_8(res);
-   FLAG_X = FLAG_C = CFLAG_8(res);
-   FLAG_V = VFLAG_SUB_8(src, dst, res);
+   m68ki_set_xnzvc_sub_8(src, dst, res);
 
-   m68ki_write_8(ea, FLAG_Z);
+   m68ki_write_8(ea, MASK_OUT_ABOVE_8(res));
 }
 
 
@@ -6527,12 +6761,9 @@ void m68k_op_subi_8_aw(void)
    uint dst = m68ki_read_8(ea);
    uint res = dst - src;
 
-   FLAG_N = NFLAG_8(res);
-   FLAG_Z = MASK_OUT_ABOVE_8(res);
-   FLAG_X = FLAG_C = CFLAG_8(res);
-   FLAG_V = VFLAG_SUB_8(src, dst, res);
+   m68ki_set_xnzvc_sub_8(src, dst, res);
 
-   m68ki_write_8(ea, FLAG_Z);
+   m68ki_write_8(ea, MASK_OUT_ABOVE_8(res));
 }
 
 
@@ -6543,12 +6774,9 @@ void m68k_op_subi_8_al(void)
    uint dst = m68ki_read_8(ea);
    uint res = dst - src;
 
-   FLAG_N = NFLAG_8(res);
-   FLAG_Z = MASK_OUT_ABOVE_8(res);
-   FLAG_X = FLAG_C = CFLAG_8(res);
-   FLAG_V = VFLAG_SUB_8(src, dst, res);
+   m68ki_set_xnzvc_sub_8(src, dst, res);
 
-   m68ki_write_8(ea, FLAG_Z);
+   m68ki_write_8(ea, MASK_OUT_ABOVE_8(res));
 }
 
 
@@ -6559,12 +6787,9 @@ void m68k_op_subi_16_d(void)
    uint dst = MASK_OUT_ABOVE_16(*r_dst);
    uint res = dst - src;
 
-   FLAG_N = NFLAG_16(res);
-   FLAG_Z = MASK_OUT_ABOVE_16(res);
-   FLAG_X = FLAG_C = CFLAG_16(res);
-   FLAG_V = VFLAG_SUB_16(src, dst, res);
+   m68ki_set_xnzvc_sub_16(src, dst, res);
 
-   *r_dst = MASK_OUT_BELOW_16(*r_dst) | FLAG_Z;
+   *r_dst = MASK_OUT_BELOW_16(*r_dst) | MASK_OUT_ABOVE_16(res);
 }
 
 
@@ -6575,12 +6800,9 @@ void m68k_op_subi_16_ai(void)
    uint dst = m68ki_read_16(ea);
    uint res = dst - src;
 
-   FLAG_N = NFLAG_16(res);
-   FLAG_Z = MASK_OUT_ABOVE_16(res);
-   FLAG_X = FLAG_C = CFLAG_16(res);
-   FLAG_V = VFLAG_SUB_16(src, dst, res);
+   m68ki_set_xnzvc_sub_16(src, dst, res);
 
-   m68ki_write_16(ea, FLAG_Z);
+   m68ki_write_16(ea, MASK_OUT_ABOVE_16(res));
 }
 
 
@@ -6591,12 +6813,9 @@ void m68k_op_subi_16_pi(void)
    uint dst = m68ki_read_16(ea);
    uint res = dst - src;
 
-   FLAG_N = NFLAG_16(res);
-   FLAG_Z = MASK_OUT_ABOVE_16(res);
-   FLAG_X = FLAG_C = CFLAG_16(res);
-   FLAG_V = VFLAG_SUB_16(src, dst, res);
+   m68ki_set_xnzvc_sub_16(src, dst, res);
 
-   m68ki_write_16(ea, FLAG_Z);
+   m68ki_write_16(ea, MASK_OUT_ABOVE_16(res));
 }
 
 
@@ -6607,12 +6826,9 @@ void m68k_op_subi_16_pd(void)
    uint dst = m68ki_read_16(ea);
    uint res = dst - src;
 
-   FLAG_N = NFLAG_16(res);
-   FLAG_Z = MASK_OUT_ABOVE_16(res);
-   FLAG_X = FLAG_C = CFLAG_16(res);
-   FLAG_V = VFLAG_SUB_16(src, dst, res);
+   m68ki_set_xnzvc_sub_16(src, dst, res);
 
-   m68ki_write_16(ea, FLAG_Z);
+   m68ki_write_16(ea, MASK_OUT_ABOVE_16(res));
 }
 
 
@@ -6623,12 +6839,9 @@ void m68k_op_subi_16_di(void)
    uint dst = m68ki_read_16(ea);
    uint res = dst - src;
 
-   FLAG_N = NFLAG_16(res);
-   FLAG_Z = MASK_OUT_ABOVE_16(res);
-   FLAG_X = FLAG_C = CFLAG_16(res);
-   FLAG_V = VFLAG_SUB_16(src, dst, res);
+   m68ki_set_xnzvc_sub_16(src, dst, res);
 
-   m68ki_write_16(ea, FLAG_Z);
+   m68ki_write_16(ea, MASK_OUT_ABOVE_16(res));
 }
 
 
@@ -6639,12 +6852,9 @@ void m68k_op_subi_16_ix(void)
    uint dst = m68ki_read_16(ea);
    uint res = dst - src;
 
-   FLAG_N = NFLAG_16(res);
-   FLAG_Z = MASK_OUT_ABOVE_16(res);
-   FLAG_X = FLAG_C = CFLAG_16(res);
-   FLAG_V = VFLAG_SUB_16(src, dst, res);
+   m68ki_set_xnzvc_sub_16(src, dst, res);
 
-   m68ki_write_16(ea, FLAG_Z);
+   m68ki_write_16(ea, MASK_OUT_ABOVE_16(res));
 }
 
 
@@ -6655,12 +6865,9 @@ void m68k_op_subi_16_aw(void)
    uint dst = m68ki_read_16(ea);
    uint res = dst - src;
 
-   FLAG_N = NFLAG_16(res);
-   FLAG_Z = MASK_OUT_ABOVE_16(res);
-   FLAG_X = FLAG_C = CFLAG_16(res);
-   FLAG_V = VFLAG_SUB_16(src, dst, res);
+   m68ki_set_xnzvc_sub_16(src, dst, res);
 
-   m68ki_write_16(ea, FLAG_Z);
+   m68ki_write_16(ea, MASK_OUT_ABOVE_16(res));
 }
 
 
@@ -6671,12 +6878,9 @@ void m68k_op_subi_16_al(void)
    uint dst = m68ki_read_16(ea);
    uint res = dst - src;
 
-   FLAG_N = NFLAG_16(res);
-   FLAG_Z = MASK_OUT_ABOVE_16(res);
-   FLAG_X = FLAG_C = CFLAG_16(res);
-   FLAG_V = VFLAG_SUB_16(src, dst, res);
+   m68ki_set_xnzvc_sub_16(src, dst, res);
 
-   m68ki_write_16(ea, FLAG_Z);
+   m68ki_write_16(ea, MASK_OUT_ABOVE_16(res));
 }
 
 
@@ -6687,12 +6891,9 @@ void m68k_op_subi_32_d(void)
    uint dst = *r_dst;
    uint res = dst - src;
 
-   FLAG_N = NFLAG_32(res);
-   FLAG_Z = MASK_OUT_ABOVE_32(res);
-   FLAG_X = FLAG_C = CFLAG_SUB_32(src, dst, res);
-   FLAG_V = VFLAG_SUB_32(src, dst, res);
+   m68ki_set_xnzvc_sub_32(src, dst, res);
 
-   *r_dst = FLAG_Z;
+   *r_dst = MASK_OUT_ABOVE_32(res);
 }
 
 
@@ -6703,12 +6904,9 @@ void m68k_op_subi_32_ai(void)
    uint dst = m68ki_read_32(ea);
    uint res = dst - src;
 
-   FLAG_N = NFLAG_32(res);
-   FLAG_Z = MASK_OUT_ABOVE_32(res);
-   FLAG_X = FLAG_C = CFLAG_SUB_32(src, dst, res);
-   FLAG_V = VFLAG_SUB_32(src, dst, res);
+   m68ki_set_xnzvc_sub_32(src, dst, res);
 
-   m68ki_write_32(ea, FLAG_Z);
+   m68ki_write_32(ea, MASK_OUT_ABOVE_32(res));
 }
 
 
@@ -6719,12 +6917,9 @@ void m68k_op_subi_32_pi(void)
    uint dst = m68ki_read_32(ea);
    uint res = dst - src;
 
-   FLAG_N = NFLAG_32(res);
-   FLAG_Z = MASK_OUT_ABOVE_32(res);
-   FLAG_X = FLAG_C = CFLAG_SUB_32(src, dst, res);
-   FLAG_V = VFLAG_SUB_32(src, dst, res);
+   m68ki_set_xnzvc_sub_32(src, dst, res);
 
-   m68ki_write_32(ea, FLAG_Z);
+   m68ki_write_32(ea, MASK_OUT_ABOVE_32(res));
 }
 
 
@@ -6735,12 +6930,9 @@ void m68k_op_subi_32_pd(void)
    uint dst = m68ki_read_32(ea);
    uint res = dst - src;
 
-   FLAG_N = NFLAG_32(res);
-   FLAG_Z = MASK_OUT_ABOVE_32(res);
-   FLAG_X = FLAG_C = CFLAG_SUB_32(src, dst, res);
-   FLAG_V = VFLAG_SUB_32(src, dst, res);
+   m68ki_set_xnzvc_sub_32(src, dst, res);
 
-   m68ki_write_32(ea, FLAG_Z);
+   m68ki_write_32(ea, MASK_OUT_ABOVE_32(res));
 }
 
 
@@ -6751,12 +6943,9 @@ void m68k_op_subi_32_di(void)
    uint dst = m68ki_read_32(ea);
    uint res = dst - src;
 
-   FLAG_N = NFLAG_32(res);
-   FLAG_Z = MASK_OUT_ABOVE_32(res);
-   FLAG_X = FLAG_C = CFLAG_SUB_32(src, dst, res);
-   FLAG_V = VFLAG_SUB_32(src, dst, res);
+   m68ki_set_xnzvc_sub_32(src, dst, res);
 
-   m68ki_write_32(ea, FLAG_Z);
+   m68ki_write_32(ea, MASK_OUT_ABOVE_32(res));
 }
 
 
@@ -6767,12 +6956,9 @@ void m68k_op_subi_32_ix(void)
    uint dst = m68ki_read_32(ea);
    uint res = dst - src;
 
-   FLAG_N = NFLAG_32(res);
-   FLAG_Z = MASK_OUT_ABOVE_32(res);
-   FLAG_X = FLAG_C = CFLAG_SUB_32(src, dst, res);
-   FLAG_V = VFLAG_SUB_32(src, dst, res);
+   m68ki_set_xnzvc_sub_32(src, dst, res);
 
-   m68ki_write_32(ea, FLAG_Z);
+   m68ki_write_32(ea, MASK_OUT_ABOVE_32(res));
 }
 
 
@@ -6783,12 +6969,9 @@ void m68k_op_subi_32_aw(void)
    uint dst = m68ki_read_32(ea);
    uint res = dst - src;
 
-   FLAG_N = NFLAG_32(res);
-   FLAG_Z = MASK_OUT_ABOVE_32(res);
-   FLAG_X = FLAG_C = CFLAG_SUB_32(src, dst, res);
-   FLAG_V = VFLAG_SUB_32(src, dst, res);
+   m68ki_set_xnzvc_sub_32(src, dst, res);
 
-   m68ki_write_32(ea, FLAG_Z);
+   m68ki_write_32(ea, MASK_OUT_ABOVE_32(res));
 }
 
 
@@ -6799,12 +6982,9 @@ void m68k_op_subi_32_al(void)
    uint dst = m68ki_read_32(ea);
    uint res = dst - src;
 
-   FLAG_N = NFLAG_32(res);
-   FLAG_Z = MASK_OUT_ABOVE_32(res);
-   FLAG_X = FLAG_C = CFLAG_SUB_32(src, dst, res);
-   FLAG_V = VFLAG_SUB_32(src, dst, res);
+   m68ki_set_xnzvc_sub_32(src, dst, res);
 
-   m68ki_write_32(ea, FLAG_Z);
+   m68ki_write_32(ea, MASK_OUT_ABOVE_32(res));
 }
 
 
@@ -6815,12 +6995,9 @@ void m68k_op_subq_8_d(void)
    uint dst = MASK_OUT_ABOVE_8(*r_dst);
    uint res = dst - src;
 
-   FLAG_N = NFLAG_8(res);
-   FLAG_Z = MASK_OUT_ABOVE_8(res);
-   FLAG_X = FLAG_C = CFLAG_8(res);
-   FLAG_V = VFLAG_SUB_8(src, dst, res);
+   m68ki_set_xnzvc_sub_8(src, dst, res);
 
-   *r_dst = MASK_OUT_BELOW_8(*r_dst) | FLAG_Z;
+   *r_dst = MASK_OUT_BELOW_8(*r_dst) | MASK_OUT_ABOVE_8(res);
 }
 
 
@@ -6831,12 +7008,9 @@ void m68k_op_subq_8_ai(void)
    uint dst = m68ki_read_8(ea);
    uint res = dst - src;
 
-   FLAG_N = NFLAG_8(res);
-   FLAG_Z = MASK_OUT_ABOVE_8(res);
-   FLAG_X = FLAG_C = CFLAG_8(res);
-   FLAG_V = VFLAG_SUB_8(src, dst, res);
+   m68ki_set_xnzvc_sub_8(src, dst, res);
 
-   m68ki_write_8(ea, FLAG_Z);
+   m68ki_write_8(ea, MASK_OUT_ABOVE_8(res));
 }
 
 
@@ -6847,12 +7021,9 @@ void m68k_op_subq_8_pi(void)
    uint dst = m68ki_read_8(ea);
    uint res = dst - src;
 
-   FLAG_N = NFLAG_8(res);
-   FLAG_Z = MASK_OUT_ABOVE_8(res);
-   FLAG_X = FLAG_C = CFLAG_8(res);
-   FLAG_V = VFLAG_SUB_8(src, dst, res);
+   m68ki_set_xnzvc_sub_8(src, dst, res);
 
-   m68ki_write_8(ea, FLAG_Z);
+   m68ki_write_8(ea, MASK_OUT_ABOVE_8(res));
 }
 
 
@@ -6863,12 +7034,9 @@ void m68k_op_subq_8_pi7(void)
    uint dst = m68ki_read_8(ea);
    uint res = dst - src;
 
-   FLAG_N = NFLAG_8(res);
-   FLAG_Z = MASK_OUT_ABOVE_8(res);
-   FLAG_X = FLAG_C = CFLAG_8(res);
-   FLAG_V = VFLAG_SUB_8(src, dst, res);
+   m68ki_set_xnzvc_sub_8(src, dst, res);
 
-   m68ki_write_8(ea, FLAG_Z);
+   m68ki_write_8(ea, MASK_OUT_ABOVE_8(res));
 }
 
 
@@ -6879,12 +7047,9 @@ void m68k_op_subq_8_pd(void)
    uint dst = m68ki_read_8(ea);
    uint res = dst - src;
 
-   FLAG_N = NFLAG_8(res);
-   FLAG_Z = MASK_OUT_ABOVE_8(res);
-   FLAG_X = FLAG_C = CFLAG_8(res);
-   FLAG_V = VFLAG_SUB_8(src, dst, res);
+   m68ki_set_xnzvc_sub_8(src, dst, res);
 
-   m68ki_write_8(ea, FLAG_Z);
+   m68ki_write_8(ea, MASK_OUT_ABOVE_8(res));
 }
 
 
@@ -6895,12 +7060,9 @@ void m68k_op_subq_8_pd7(void)
    uint dst = m68ki_read_8(ea);
    uint res = dst - src;
 
-   FLAG_N = NFLAG_8(res);
-   FLAG_Z = MASK_OUT_ABOVE_8(res);
-   FLAG_X = FLAG_C = CFLAG_8(res);
-   FLAG_V = VFLAG_SUB_8(src, dst, res);
+   m68ki_set_xnzvc_sub_8(src, dst, res);
 
-   m68ki_write_8(ea, FLAG_Z);
+   m68ki_write_8(ea, MASK_OUT_ABOVE_8(res));
 }
 
 
@@ -6911,12 +7073,9 @@ void m68k_op_subq_8_di(void)
    uint dst = m68ki_read_8(ea);
    uint res = dst - src;
 
-   FLAG_N = NFLAG_8(res);
-   FLAG_Z = MASK_OUT_ABOVE_8(res);
-   FLAG_X = FLAG_C = CFLAG_8(res);
-   FLAG_V = VFLAG_SUB_8(src, dst, res);
+   m68ki_set_xnzvc_sub_8(src, dst, res);
 
-   m68ki_write_8(ea, FLAG_Z);
+   m68ki_write_8(ea, MASK_OUT_ABOVE_8(res));
 }
 
 
@@ -6927,12 +7086,9 @@ void m68k_op_subq_8_ix(void)
    uint dst = m68ki_read_8(ea);
    uint res = dst - src;
 
-   FLAG_N = NFLAG_8(res);
-   FLAG_Z = MASK_OUT_ABOVE_8(res);
-   FLAG_X = FLAG_C = CFLAG_8(res);
-   FLAG_V = VFLAG_SUB_8(src, dst, res);
+   m68ki_set_xnzvc_sub_8(src, dst, res);
 
-   m68ki_write_8(ea, FLAG_Z);
+   m68ki_write_8(ea, MASK_OUT_ABOVE_8(res));
 }
 
 
@@ -6943,12 +7099,9 @@ void m68k_op_subq_8_aw(void)
    uint dst = m68ki_read_8(ea);
    uint res = dst - src;
 
-   FLAG_N = NFLAG_8(res);
-   FLAG_Z = MASK_OUT_ABOVE_8(res);
-   FLAG_X = FLAG_C = CFLAG_8(res);
-   FLAG_V = VFLAG_SUB_8(src, dst, res);
+   m68ki_set_xnzvc_sub_8(src, dst, res);
 
-   m68ki_write_8(ea, FLAG_Z);
+   m68ki_write_8(ea, MASK_OUT_ABOVE_8(res));
 }
 
 
@@ -6959,12 +7112,9 @@ void m68k_op_subq_8_al(void)
    uint dst = m68ki_read_8(ea);
    uint res = dst - src;
 
-   FLAG_N = NFLAG_8(res);
-   FLAG_Z = MASK_OUT_ABOVE_8(res);
-   FLAG_X = FLAG_C = CFLAG_8(res);
-   FLAG_V = VFLAG_SUB_8(src, dst, res);
+   m68ki_set_xnzvc_sub_8(src, dst, res);
 
-   m68ki_write_8(ea, FLAG_Z);
+   m68ki_write_8(ea, MASK_OUT_ABOVE_8(res));
 }
 
 
@@ -6975,12 +7125,9 @@ void m68k_op_subq_16_d(void)
    uint dst = MASK_OUT_ABOVE_16(*r_dst);
    uint res = dst - src;
 
-   FLAG_N = NFLAG_16(res);
-   FLAG_Z = MASK_OUT_ABOVE_16(res);
-   FLAG_X = FLAG_C = CFLAG_16(res);
-   FLAG_V = VFLAG_SUB_16(src, dst, res);
+   m68ki_set_xnzvc_sub_16(src, dst, res);
 
-   *r_dst = MASK_OUT_BELOW_16(*r_dst) | FLAG_Z;
+   *r_dst = MASK_OUT_BELOW_16(*r_dst) | MASK_OUT_ABOVE_16(res);
 }
 
 
@@ -6999,12 +7146,9 @@ void m68k_op_subq_16_ai(void)
    uint dst = m68ki_read_16(ea);
    uint res = dst - src;
 
-   FLAG_N = NFLAG_16(res);
-   FLAG_Z = MASK_OUT_ABOVE_16(res);
-   FLAG_X = FLAG_C = CFLAG_16(res);
-   FLAG_V = VFLAG_SUB_16(src, dst, res);
+   m68ki_set_xnzvc_sub_16(src, dst, res);
 
-   m68ki_write_16(ea, FLAG_Z);
+   m68ki_write_16(ea, MASK_OUT_ABOVE_16(res));
 }
 
 
@@ -7015,12 +7159,9 @@ void m68k_op_subq_16_pi(void)
    uint dst = m68ki_read_16(ea);
    uint res = dst - src;
 
-   FLAG_N = NFLAG_16(res);
-   FLAG_Z = MASK_OUT_ABOVE_16(res);
-   FLAG_X = FLAG_C = CFLAG_16(res);
-   FLAG_V = VFLAG_SUB_16(src, dst, res);
+   m68ki_set_xnzvc_sub_16(src, dst, res);
 
-   m68ki_write_16(ea, FLAG_Z);
+   m68ki_write_16(ea, MASK_OUT_ABOVE_16(res));
 }
 
 
@@ -7031,12 +7172,9 @@ void m68k_op_subq_16_pd(void)
    uint dst = m68ki_read_16(ea);
    uint res = dst - src;
 
-   FLAG_N = NFLAG_16(res);
-   FLAG_Z = MASK_OUT_ABOVE_16(res);
-   FLAG_X = FLAG_C = CFLAG_16(res);
-   FLAG_V = VFLAG_SUB_16(src, dst, res);
+   m68ki_set_xnzvc_sub_16(src, dst, res);
 
-   m68ki_write_16(ea, FLAG_Z);
+   m68ki_write_16(ea, MASK_OUT_ABOVE_16(res));
 }
 
 
@@ -7047,12 +7185,9 @@ void m68k_op_subq_16_di(void)
    uint dst = m68ki_read_16(ea);
    uint res = dst - src;
 
-   FLAG_N = NFLAG_16(res);
-   FLAG_Z = MASK_OUT_ABOVE_16(res);
-   FLAG_X = FLAG_C = CFLAG_16(res);
-   FLAG_V = VFLAG_SUB_16(src, dst, res);
+   m68ki_set_xnzvc_sub_16(src, dst, res);
 
-   m68ki_write_16(ea, FLAG_Z);
+   m68ki_write_16(ea, MASK_OUT_ABOVE_16(res));
 }
 
 
@@ -7063,12 +7198,9 @@ void m68k_op_subq_16_ix(void)
    uint dst = m68ki_read_16(ea);
    uint res = dst - src;
 
-   FLAG_N = NFLAG_16(res);
-   FLAG_Z = MASK_OUT_ABOVE_16(res);
-   FLAG_X = FLAG_C = CFLAG_16(res);
-   FLAG_V = VFLAG_SUB_16(src, dst, res);
+   m68ki_set_xnzvc_sub_16(src, dst, res);
 
-   m68ki_write_16(ea, FLAG_Z);
+   m68ki_write_16(ea, MASK_OUT_ABOVE_16(res));
 }
 
 
@@ -7079,12 +7211,9 @@ void m68k_op_subq_16_aw(void)
    uint dst = m68ki_read_16(ea);
    uint res = dst - src;
 
-   FLAG_N = NFLAG_16(res);
-   FLAG_Z = MASK_OUT_ABOVE_16(res);
-   FLAG_X = FLAG_C = CFLAG_16(res);
-   FLAG_V = VFLAG_SUB_16(src, dst, res);
+   m68ki_set_xnzvc_sub_16(src, dst, res);
 
-   m68ki_write_16(ea, FLAG_Z);
+   m68ki_write_16(ea, MASK_OUT_ABOVE_16(res));
 }
 
 
@@ -7095,12 +7224,9 @@ void m68k_op_subq_16_al(void)
    uint dst = m68ki_read_16(ea);
    uint res = dst - src;
 
-   FLAG_N = NFLAG_16(res);
-   FLAG_Z = MASK_OUT_ABOVE_16(res);
-   FLAG_X = FLAG_C = CFLAG_16(res);
-   FLAG_V = VFLAG_SUB_16(src, dst, res);
+   m68ki_set_xnzvc_sub_16(src, dst, res);
 
-   m68ki_write_16(ea, FLAG_Z);
+   m68ki_write_16(ea, MASK_OUT_ABOVE_16(res));
 }
 
 
@@ -7111,12 +7237,9 @@ void m68k_op_subq_32_d(void)
    uint dst = *r_dst;
    uint res = dst - src;
 
-   FLAG_N = NFLAG_32(res);
-   FLAG_Z = MASK_OUT_ABOVE_32(res);
-   FLAG_X = FLAG_C = CFLAG_SUB_32(src, dst, res);
-   FLAG_V = VFLAG_SUB_32(src, dst, res);
+   m68ki_set_xnzvc_sub_32(src, dst, res);
 
-   *r_dst = FLAG_Z;
+   *r_dst = MASK_OUT_ABOVE_32(res);
 }
 
 
@@ -7135,12 +7258,9 @@ void m68k_op_subq_32_ai(void)
    uint dst = m68ki_read_32(ea);
    uint res = dst - src;
 
-   FLAG_N = NFLAG_32(res);
-   FLAG_Z = MASK_OUT_ABOVE_32(res);
-   FLAG_X = FLAG_C = CFLAG_SUB_32(src, dst, res);
-   FLAG_V = VFLAG_SUB_32(src, dst, res);
+   m68ki_set_xnzvc_sub_32(src, dst, res);
 
-   m68ki_write_32(ea, FLAG_Z);
+   m68ki_write_32(ea, MASK_OUT_ABOVE_32(res));
 }
 
 
@@ -7151,12 +7271,9 @@ void m68k_op_subq_32_pi(void)
    uint dst = m68ki_read_32(ea);
    uint res = dst - src;
 
-   FLAG_N = NFLAG_32(res);
-   FLAG_Z = MASK_OUT_ABOVE_32(res);
-   FLAG_X = FLAG_C = CFLAG_SUB_32(src, dst, res);
-   FLAG_V = VFLAG_SUB_32(src, dst, res);
+   m68ki_set_xnzvc_sub_32(src, dst, res);
 
-   m68ki_write_32(ea, FLAG_Z);
+   m68ki_write_32(ea, MASK_OUT_ABOVE_32(res));
 }
 
 
@@ -7167,12 +7284,9 @@ void m68k_op_subq_32_pd(void)
    uint dst = m68ki_read_32(ea);
    uint res = dst - src;
 
-   FLAG_N = NFLAG_32(res);
-   FLAG_Z = MASK_OUT_ABOVE_32(res);
-   FLAG_X = FLAG_C = CFLAG_SUB_32(src, dst, res);
-   FLAG_V = VFLAG_SUB_32(src, dst, res);
+   m68ki_set_xnzvc_sub_32(src, dst, res);
 
-   m68ki_write_32(ea, FLAG_Z);
+   m68ki_write_32(ea, MASK_OUT_ABOVE_32(res));
 }
 
 
@@ -7183,12 +7297,9 @@ void m68k_op_subq_32_di(void)
    uint dst = m68ki_read_32(ea);
    uint res = dst - src;
 
-   FLAG_N = NFLAG_32(res);
-   FLAG_Z = MASK_OUT_ABOVE_32(res);
-   FLAG_X = FLAG_C = CFLAG_SUB_32(src, dst, res);
-   FLAG_V = VFLAG_SUB_32(src, dst, res);
+   m68ki_set_xnzvc_sub_32(src, dst, res);
 
-   m68ki_write_32(ea, FLAG_Z);
+   m68ki_write_32(ea, MASK_OUT_ABOVE_32(res));
 }
 
 
@@ -7199,12 +7310,9 @@ void m68k_op_subq_32_ix(void)
    uint dst = m68ki_read_32(ea);
    uint res = dst - src;
 
-   FLAG_N = NFLAG_32(res);
-   FLAG_Z = MASK_OUT_ABOVE_32(res);
-   FLAG_X = FLAG_C = CFLAG_SUB_32(src, dst, res);
-   FLAG_V = VFLAG_SUB_32(src, dst, res);
+   m68ki_set_xnzvc_sub_32(src, dst, res);
 
-   m68ki_write_32(ea, FLAG_Z);
+   m68ki_write_32(ea, MASK_OUT_ABOVE_32(res));
 }
 
 
@@ -7215,12 +7323,9 @@ void m68k_op_subq_32_aw(void)
    uint dst = m68ki_read_32(ea);
    uint res = dst - src;
 
-   FLAG_N = NFLAG_32(res);
-   FLAG_Z = MASK_OUT_ABOVE_32(res);
-   FLAG_X = FLAG_C = CFLAG_SUB_32(src, dst, res);
-   FLAG_V = VFLAG_SUB_32(src, dst, res);
+   m68ki_set_xnzvc_sub_32(src, dst, res);
 
-   m68ki_write_32(ea, FLAG_Z);
+   m68ki_write_32(ea, MASK_OUT_ABOVE_32(res));
 }
 
 
@@ -7231,12 +7336,9 @@ void m68k_op_subq_32_al(void)
    uint dst = m68ki_read_32(ea);
    uint res = dst - src;
 
-   FLAG_N = NFLAG_32(res);
-   FLAG_Z = MASK_OUT_ABOVE_32(res);
-   FLAG_X = FLAG_C = CFLAG_SUB_32(src, dst, res);
-   FLAG_V = VFLAG_SUB_32(src, dst, res);
+   m68ki_set_xnzvc_sub_32(src, dst, res);
 
-   m68ki_write_32(ea, FLAG_Z);
+   m68ki_write_32(ea, MASK_OUT_ABOVE_32(res));
 }
 
 
@@ -7247,6 +7349,8 @@ void m68k_op_subx_8_rr(void)
    uint dst = MASK_OUT_ABOVE_8(*r_dst);
    uint res = dst - src - XFLAG_AS_1();
 
+   m68ki_resolve_flags();
+
    FLAG_N = NFLAG_8(res);
    FLAG_X = FLAG_C = CFLAG_8(res);
    FLAG_V = VFLAG_SUB_8(src, dst, res);
@@ -7265,6 +7369,8 @@ void m68k_op_subx_16_rr(void)
    uint dst = MASK_OUT_ABOVE_16(*r_dst);
    uint res = dst - src - XFLAG_AS_1();
 
+   m68ki_resolve_flags();
+
    FLAG_N = NFLAG_16(res);
    FLAG_X = FLAG_C = CFLAG_16(res);
    FLAG_V = VFLAG_SUB_16(src, dst, res);
@@ -7283,6 +7389,8 @@ void m68k_op_subx_32_rr(void)
    uint dst = *r_dst;
    uint res = dst - src - XFLAG_AS_1();
 
+   m68ki_resolve_flags();
+
    FLAG_N = NFLAG_32(res);
    FLAG_X = FLAG_C = CFLAG_SUB_32(src, dst, res);
    FLAG_V = VFLAG_SUB_32(src, dst, res);
@@ -7301,6 +7409,8 @@ void m68k_op_subx_8_mm_ax7(void)
    uint dst = m68ki_read_8(ea);
    uint res = dst - src - XFLAG_AS_1();
 
+   m68ki_resolve_flags();
+
    FLAG_N = NFLAG_8(res);
    FLAG_X = FLAG_C = CFLAG_8(res);
    FLAG_V = VFLAG_SUB_8(src, dst, res);
@@ -7319,6 +7429,8 @@ void m68k_op_subx_8_mm_ay7(void)
    uint dst = m68ki_read_8(ea);
    uint res = dst - src - XFLAG_AS_1();
 
+   m68ki_resolve_flags();
+
    FLAG_N = NFLAG_8(res);
    FLAG_X = FLAG_C = CFLAG_8(res);
    FLAG_V = VFLAG_SUB_8(src, dst, res);
@@ -7337,6 +7449,8 @@ void m68k_op_subx_8_mm_axy7(void)
    uint dst = m68ki_read_8(ea);
    uint res = dst - src - XFLAG_AS_1();
 
+   m68ki_resolve_flags();
+
    FLAG_N = NFLAG_8(res);
    FLAG_X = FLAG_C = CFLAG_8(res);
    FLAG_V = VFLAG_SUB_8(src, dst, res);
@@ -7355,6 +7469,8 @@ void m68k_op_subx_8_mm(void)
    uint dst = m68ki_read_8(ea);
    uint res = dst - src - XFLAG_AS_1();
 
+   m68ki_resolve_flags();
+
    FLAG_N = NFLAG_8(res);
    FLAG_X = FLAG_C = CFLAG_8(res);
    FLAG_V = VFLAG_SUB_8(src, dst, res);
@@ -7373,6 +7489,8 @@ void m68k_op_subx_16_mm(void)
    uint dst = m68ki_read_16(ea);
    uint res = dst - src - XFLAG_AS_1();
 
+   m68ki_resolve_flags();
+
    FLAG_N = NFLAG_16(res);
    FLAG_X = FLAG_C = CFLAG_16(res);
    FLAG_V = VFLAG_SUB_16(src, dst, res);
@@ -7391,6 +7509,8 @@ void m68k_op_subx_32_mm(void)
    uint dst = m68ki_read_32(ea);
    uint res = dst - src - XFLAG_AS_1();
 
+   m68ki_resolve_flags();
+
    FLAG_N = NFLAG_32(res);
    FLAG_X = FLAG_C = CFLAG_SUB_32(src, dst, res);
    FLAG_V = VFLAG_SUB_32(src, dst, res);
@@ -7406,6 +7526,8 @@ void m68k_op_swap_32(void)
 {
    uint* r_dst = &DY;
 
+   m68ki_resolve_flags();
+
    FLAG_Z = MASK_OUT_ABOVE_32(*r_dst<<16);
    *r_dst = (*r_dst>>16) | FLAG_Z;
 
@@ -7420,6 +7542,7 @@ void m68k_op_tas_8_d(void)
 {
    uint* r_dst = &DY;
 
+   m68ki_discard_lazy_flags();
    FLAG_Z = MASK_OUT_ABOVE_8(*r_dst);
    FLAG_N = NFLAG_8(*r_dst);
    FLAG_V = VFLAG_CLEAR;
@@ -7433,6 +7556,7 @@ void m68k_op_tas_8_ai(void)
    uint ea = EA_AY_AI_8();
    uint dst = m68ki_read_8(ea);
 
+   m68ki_discard_lazy_flags();
    FLAG_Z = dst;
    FLAG_N = NFLAG_8(dst);
    FLAG_V = VFLAG_CLEAR;
@@ -7446,6 +7570,7 @@ void m68k_op_tas_8_pi(void)
    uint ea = EA_AY_PI_8();
    uint dst = m68ki_read_8(ea);
 
+   m68ki_discard_lazy_flags();
    FLAG_Z = dst;
    FLAG_N = NFLAG_8(dst);
    FLAG_V = VFLAG_CLEAR;
@@ -7459,6 +7584,7 @@ void m68k_op_tas_8_pi7(void)
    uint ea = EA_A7_PI_8();
    uint dst = m68ki_read_8(ea);
 
+   m68ki_discard_lazy_flags();
    FLAG_Z = dst;
    FLAG_N = NFLAG_8(dst);
    FLAG_V = VFLAG_CLEAR;
@@ -7472,6 +7598,7 @@ void m68k_op_tas_8_pd(void)
    uint ea = EA_AY_PD_8();
    uint dst = m68ki_read_8(ea);
 
+   m68ki_discard_lazy_flags();
    FLAG_Z = dst;
    FLAG_N = NFLAG_8(dst);
    FLAG_V = VFLAG_CLEAR;
@@ -7485,6 +7612,7 @@ void m68k_op_tas_8_pd7(void)
    uint ea = EA_A7_PD_8();
    uint dst = m68ki_read_8(ea);
 
+   m68ki_discard_lazy_flags();
    FLAG_Z = dst;
    FLAG_N = NFLAG_8(dst);
    FLAG_V = VFLAG_CLEAR;
@@ -7498,6 +7626,7 @@ void m68k_op_tas_8_di(void)
    uint ea = EA_AY_DI_8();
    uint dst = m68ki_read_8(ea);
 
+   m68ki_discard_lazy_flags();
    FLAG_Z = dst;
    FLAG_N = NFLAG_8(dst);
    FLAG_V = VFLAG_CLEAR;
@@ -7511,6 +7640,7 @@ void m68k_op_tas_8_ix(void)
    uint ea = EA_AY_IX_8();
    uint dst = m68ki_read_8(ea);
 
+   m68ki_discard_lazy_flags();
    FLAG_Z = dst;
    FLAG_N = NFLAG_8(dst);
    FLAG_V = VFLAG_CLEAR;
@@ -7524,6 +7654,7 @@ void m68k_op_tas_8_aw(void)
    uint ea = EA_AW_8();
    uint dst = m68ki_read_8(ea);
 
+   m68ki_discard_lazy_flags();
    FLAG_Z = dst;
    FLAG_N = NFLAG_8(dst);
    FLAG_V = VFLAG_CLEAR;
@@ -7537,6 +7668,7 @@ void m68k_op_tas_8_al(void)
    uint ea = EA_AL_8();
    uint dst = m68ki_read_8(ea);
 
+   m68ki_discard_lazy_flags();
    FLAG_Z = dst;
    FLAG_N = NFLAG_8(dst);
    FLAG_V = VFLAG_CLEAR;
@@ -7619,6 +7751,7 @@ void m68k_op_trapf_32(void)
 
 void m68k_op_traphi(void)
 {
+   m68ki_resolve_flags();
    if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
    {
       if(COND_HI())
@@ -7631,6 +7764,7 @@ void m68k_op_traphi(void)
 
 void m68k_op_trapls(void)
 {
+   m68ki_resolve_flags();
    if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
    {
       if(COND_LS())
@@ -7643,6 +7777,7 @@ void m68k_op_trapls(void)
 
 void m68k_op_trapcc(void)
 {
+   m68ki_resolve_flags();
    if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
    {
       if(COND_CC())
@@ -7655,6 +7790,7 @@ void m68k_op_trapcc(void)
 
 void m68k_op_trapcs(void)
 {
+   m68ki_resolve_flags();
    if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
    {
       if(COND_CS())
@@ -7667,6 +7803,7 @@ void m68k_op_trapcs(void)
 
 void m68k_op_trapne(void)
 {
+   m68ki_resolve_flags();
    if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
    {
       if(COND_NE())
@@ -7679,6 +7816,7 @@ void m68k_op_trapne(void)
 
 void m68k_op_trapeq(void)
 {
+   m68ki_resolve_flags();
    if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
    {
       if(COND_EQ())
@@ -7691,6 +7829,7 @@ void m68k_op_trapeq(void)
 
 void m68k_op_trapvc(void)
 {
+   m68ki_resolve_flags();
    if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
    {
       if(COND_VC())
@@ -7703,6 +7842,7 @@ void m68k_op_trapvc(void)
 
 void m68k_op_trapvs(void)
 {
+   m68ki_resolve_flags();
    if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
    {
       if(COND_VS())
@@ -7715,6 +7855,7 @@ void m68k_op_trapvs(void)
 
 void m68k_op_trappl(void)
 {
+   m68ki_resolve_flags();
    if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
    {
       if(COND_PL())
@@ -7727,6 +7868,7 @@ void m68k_op_trappl(void)
 
 void m68k_op_trapmi(void)
 {
+   m68ki_resolve_flags();
    if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
    {
       if(COND_MI())
@@ -7739,6 +7881,7 @@ void m68k_op_trapmi(void)
 
 void m68k_op_trapge(void)
 {
+   m68ki_resolve_flags();
    if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
    {
       if(COND_GE())
@@ -7751,6 +7894,7 @@ void m68k_op_trapge(void)
 
 void m68k_op_traplt(void)
 {
+   m68ki_resolve_flags();
    if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
    {
       if(COND_LT())
@@ -7763,6 +7907,7 @@ void m68k_op_traplt(void)
 
 void m68k_op_trapgt(void)
 {
+   m68ki_resolve_flags();
    if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
    {
       if(COND_GT())
@@ -7775,6 +7920,7 @@ void m68k_op_trapgt(void)
 
 void m68k_op_traple(void)
 {
+   m68ki_resolve_flags();
    if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
    {
       if(COND_LE())
@@ -7787,6 +7933,7 @@ void m68k_op_traple(void)
 
 void m68k_op_traphi_16(void)
 {
+   m68ki_resolve_flags();
    if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
    {
       if(COND_HI())
@@ -7803,6 +7950,7 @@ void m68k_op_traphi_16(void)
 
 void m68k_op_trapls_16(void)
 {
+   m68ki_resolve_flags();
    if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
    {
       if(COND_LS())
@@ -7819,6 +7967,7 @@ void m68k_op_trapls_16(void)
 
 void m68k_op_trapcc_16(void)
 {
+   m68ki_resolve_flags();
    if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
    {
       if(COND_CC())
@@ -7835,6 +7984,7 @@ void m68k_op_trapcc_16(void)
 
 void m68k_op_trapcs_16(void)
 {
+   m68ki_resolve_flags();
    if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
    {
       if(COND_CS())
@@ -7851,6 +8001,7 @@ void m68k_op_trapcs_16(void)
 
 void m68k_op_trapne_16(void)
 {
+   m68ki_resolve_flags();
    if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
    {
       if(COND_NE())
@@ -7867,6 +8018,7 @@ void m68k_op_trapne_16(void)
 
 void m68k_op_trapeq_16(void)
 {
+   m68ki_resolve_flags();
    if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
    {
       if(COND_EQ())
@@ -7883,6 +8035,7 @@ void m68k_op_trapeq_16(void)
 
 void m68k_op_trapvc_16(void)
 {
+   m68ki_resolve_flags();
    if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
    {
       if(COND_VC())
@@ -7899,6 +8052,7 @@ void m68k_op_trapvc_16(void)
 
 void m68k_op_trapvs_16(void)
 {
+   m68ki_resolve_flags();
    if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
    {
       if(COND_VS())
@@ -7915,6 +8069,7 @@ void m68k_op_trapvs_16(void)
 
 void m68k_op_trappl_16(void)
 {
+   m68ki_resolve_flags();
    if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
    {
       if(COND_PL())
@@ -7931,6 +8086,7 @@ void m68k_op_trappl_16(void)
 
 void m68k_op_trapmi_16(void)
 {
+   m68ki_resolve_flags();
    if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
    {
       if(COND_MI())
@@ -7947,6 +8103,7 @@ void m68k_op_trapmi_16(void)
 
 void m68k_op_trapge_16(void)
 {
+   m68ki_resolve_flags();
    if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
    {
       if(COND_GE())
@@ -7963,6 +8120,7 @@ void m68k_op_trapge_16(void)
 
 void m68k_op_traplt_16(void)
 {
+   m68ki_resolve_flags();
    if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
    {
       if(COND_LT())
@@ -7979,6 +8137,7 @@ void m68k_op_traplt_16(void)
 
 void m68k_op_trapgt_16(void)
 {
+   m68ki_resolve_flags();
    if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
    {
       if(COND_GT())
@@ -7995,6 +8154,7 @@ void m68k_op_trapgt_16(void)
 
 void m68k_op_traple_16(void)
 {
+   m68ki_resolve_flags();
    if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
    {
       if(COND_LE())
@@ -8011,6 +8171,7 @@ void m68k_op_traple_16(void)
 
 void m68k_op_traphi_32(void)
 {
+   m68ki_resolve_flags();
    if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
    {
       if(COND_HI())
@@ -8027,6 +8188,7 @@ void m68k_op_traphi_32(void)
 
 void m68k_op_trapls_32(void)
 {
+   m68ki_resolve_flags();
    if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
    {
       if(COND_LS())
@@ -8043,6 +8205,7 @@ void m68k_op_trapls_32(void)
 
 void m68k_op_trapcc_32(void)
 {
+   m68ki_resolve_flags();
    if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
    {
       if(COND_CC())
@@ -8059,6 +8222,7 @@ void m68k_op_trapcc_32(void)
 
 void m68k_op_trapcs_32(void)
 {
+   m68ki_resolve_flags();
    if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
    {
       if(COND_CS())
@@ -8075,6 +8239,7 @@ void m68k_op_trapcs_32(void)
 
 void m68k_op_trapne_32(void)
 {
+   m68ki_resolve_flags();
    if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
    {
       if(COND_NE())
@@ -8091,6 +8256,7 @@ void m68k_op_trapne_32(void)
 
 void m68k_op_trapeq_32(void)
 {
+   m68ki_resolve_flags();
    if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
    {
       if(COND_EQ())
@@ -8107,6 +8273,7 @@ void m68k_op_trapeq_32(void)
 
 void m68k_op_trapvc_32(void)
 {
+   m68ki_resolve_flags();
    if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
    {
       if(COND_VC())
@@ -8123,6 +8290,7 @@ void m68k_op_trapvc_32(void)
 
 void m68k_op_trapvs_32(void)
 {
+   m68ki_resolve_flags();
    if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
    {
       if(COND_VS())
@@ -8139,6 +8307,7 @@ void m68k_op_trapvs_32(void)
 
 void m68k_op_trappl_32(void)
 {
+   m68ki_resolve_flags();
    if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
    {
       if(COND_PL())
@@ -8155,6 +8324,7 @@ void m68k_op_trappl_32(void)
 
 void m68k_op_trapmi_32(void)
 {
+   m68ki_resolve_flags();
    if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
    {
       if(COND_MI())
@@ -8171,6 +8341,7 @@ void m68k_op_trapmi_32(void)
 
 void m68k_op_trapge_32(void)
 {
+   m68ki_resolve_flags();
    if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
    {
       if(COND_GE())
@@ -8187,6 +8358,7 @@ void m68k_op_trapge_32(void)
 
 void m68k_op_traplt_32(void)
 {
+   m68ki_resolve_flags();
    if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
    {
       if(COND_LT())
@@ -8203,6 +8375,7 @@ void m68k_op_traplt_32(void)
 
 void m68k_op_trapgt_32(void)
 {
+   m68ki_resolve_flags();
    if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
    {
       if(COND_GT())
@@ -8219,6 +8392,7 @@ void m68k_op_trapgt_32(void)
 
 void m68k_op_traple_32(void)
 {
+   m68ki_resolve_flags();
    if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
    {
       if(COND_LE())
@@ -8235,6 +8409,7 @@ void m68k_op_traple_32(void)
 
 void m68k_op_trapv(void)
 {
+   m68ki_resolve_flags();
    if(COND_VC())
    {
       return;
@@ -8247,6 +8422,7 @@ void m68k_op_tst_8_d(void)
 {
    uint res = MASK_OUT_ABOVE_8(DY);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_8(res);
    FLAG_Z = res;
    FLAG_V = VFLAG_CLEAR;
@@ -8258,6 +8434,7 @@ void m68k_op_tst_8_ai(void)
 {
    uint res = OPER_AY_AI_8();
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_8(res);
    FLAG_Z = res;
    FLAG_V = VFLAG_CLEAR;
@@ -8269,6 +8446,7 @@ void m68k_op_tst_8_pi(void)
 {
    uint res = OPER_AY_PI_8();
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_8(res);
    FLAG_Z = res;
    FLAG_V = VFLAG_CLEAR;
@@ -8280,6 +8458,7 @@ void m68k_op_tst_8_pi7(void)
 {
    uint res = OPER_A7_PI_8();
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_8(res);
    FLAG_Z = res;
    FLAG_V = VFLAG_CLEAR;
@@ -8291,6 +8470,7 @@ void m68k_op_tst_8_pd(void)
 {
    uint res = OPER_AY_PD_8();
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_8(res);
    FLAG_Z = res;
    FLAG_V = VFLAG_CLEAR;
@@ -8302,6 +8482,7 @@ void m68k_op_tst_8_pd7(void)
 {
    uint res = OPER_A7_PD_8();
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_8(res);
    FLAG_Z = res;
    FLAG_V = VFLAG_CLEAR;
@@ -8313,6 +8494,7 @@ void m68k_op_tst_8_di(void)
 {
    uint res = OPER_AY_DI_8();
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_8(res);
    FLAG_Z = res;
    FLAG_V = VFLAG_CLEAR;
@@ -8324,6 +8506,7 @@ void m68k_op_tst_8_ix(void)
 {
    uint res = OPER_AY_IX_8();
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_8(res);
    FLAG_Z = res;
    FLAG_V = VFLAG_CLEAR;
@@ -8335,6 +8518,7 @@ void m68k_op_tst_8_aw(void)
 {
    uint res = OPER_AW_8();
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_8(res);
    FLAG_Z = res;
    FLAG_V = VFLAG_CLEAR;
@@ -8346,6 +8530,7 @@ void m68k_op_tst_8_al(void)
 {
    uint res = OPER_AL_8();
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_8(res);
    FLAG_Z = res;
    FLAG_V = VFLAG_CLEAR;
@@ -8355,6 +8540,7 @@ void m68k_op_tst_8_al(void)
 
 void m68k_op_tst_8_pcdi(void)
 {
+   m68ki_resolve_flags();
    if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
    {
       uint res = OPER_PCDI_8();
@@ -8371,6 +8557,7 @@ void m68k_op_tst_8_pcdi(void)
 
 void m68k_op_tst_8_pcix(void)
 {
+   m68ki_resolve_flags();
    if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
    {
       uint res = OPER_PCIX_8();
@@ -8387,6 +8574,7 @@ void m68k_op_tst_8_pcix(void)
 
 void m68k_op_tst_8_i(void)
 {
+   m68ki_resolve_flags();
    if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
    {
       uint res = OPER_I_8();
@@ -8405,6 +8593,7 @@ void m68k_op_tst_16_d(void)
 {
    uint res = MASK_OUT_ABOVE_16(DY);
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_16(res);
    FLAG_Z = res;
    FLAG_V = VFLAG_CLEAR;
@@ -8414,6 +8603,7 @@ void m68k_op_tst_16_d(void)
 
 void m68k_op_tst_16_a(void)
 {
+   m68ki_resolve_flags();
    if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
    {
       uint res = MAKE_INT_16(AY);
@@ -8432,6 +8622,7 @@ void m68k_op_tst_16_ai(void)
 {
    uint res = OPER_AY_AI_16();
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_16(res);
    FLAG_Z = res;
    FLAG_V = VFLAG_CLEAR;
@@ -8443,6 +8634,7 @@ void m68k_op_tst_16_pi(void)
 {
    uint res = OPER_AY_PI_16();
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_16(res);
    FLAG_Z = res;
    FLAG_V = VFLAG_CLEAR;
@@ -8454,6 +8646,7 @@ void m68k_op_tst_16_pd(void)
 {
    uint res = OPER_AY_PD_16();
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_16(res);
    FLAG_Z = res;
    FLAG_V = VFLAG_CLEAR;
@@ -8465,6 +8658,7 @@ void m68k_op_tst_16_di(void)
 {
    uint res = OPER_AY_DI_16();
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_16(res);
    FLAG_Z = res;
    FLAG_V = VFLAG_CLEAR;
@@ -8476,6 +8670,7 @@ void m68k_op_tst_16_ix(void)
 {
    uint res = OPER_AY_IX_16();
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_16(res);
    FLAG_Z = res;
    FLAG_V = VFLAG_CLEAR;
@@ -8487,6 +8682,7 @@ void m68k_op_tst_16_aw(void)
 {
    uint res = OPER_AW_16();
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_16(res);
    FLAG_Z = res;
    FLAG_V = VFLAG_CLEAR;
@@ -8498,6 +8694,7 @@ void m68k_op_tst_16_al(void)
 {
    uint res = OPER_AL_16();
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_16(res);
    FLAG_Z = res;
    FLAG_V = VFLAG_CLEAR;
@@ -8507,6 +8704,7 @@ void m68k_op_tst_16_al(void)
 
 void m68k_op_tst_16_pcdi(void)
 {
+   m68ki_resolve_flags();
    if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
    {
       uint res = OPER_PCDI_16();
@@ -8523,6 +8721,7 @@ void m68k_op_tst_16_pcdi(void)
 
 void m68k_op_tst_16_pcix(void)
 {
+   m68ki_resolve_flags();
    if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
    {
       uint res = OPER_PCIX_16();
@@ -8539,6 +8738,7 @@ void m68k_op_tst_16_pcix(void)
 
 void m68k_op_tst_16_i(void)
 {
+   m68ki_resolve_flags();
    if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
    {
       uint res = OPER_I_16();
@@ -8557,6 +8757,7 @@ void m68k_op_tst_32_d(void)
 {
    uint res = DY;
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_32(res);
    FLAG_Z = res;
    FLAG_V = VFLAG_CLEAR;
@@ -8566,6 +8767,7 @@ void m68k_op_tst_32_d(void)
 
 void m68k_op_tst_32_a(void)
 {
+   m68ki_resolve_flags();
    if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
    {
       uint res = AY;
@@ -8584,6 +8786,7 @@ void m68k_op_tst_32_ai(void)
 {
    uint res = OPER_AY_AI_32();
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_32(res);
    FLAG_Z = res;
    FLAG_V = VFLAG_CLEAR;
@@ -8595,6 +8798,7 @@ void m68k_op_tst_32_pi(void)
 {
    uint res = OPER_AY_PI_32();
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_32(res);
    FLAG_Z = res;
    FLAG_V = VFLAG_CLEAR;
@@ -8606,6 +8810,7 @@ void m68k_op_tst_32_pd(void)
 {
    uint res = OPER_AY_PD_32();
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_32(res);
    FLAG_Z = res;
    FLAG_V = VFLAG_CLEAR;
@@ -8617,6 +8822,7 @@ void m68k_op_tst_32_di(void)
 {
    uint res = OPER_AY_DI_32();
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_32(res);
    FLAG_Z = res;
    FLAG_V = VFLAG_CLEAR;
@@ -8628,6 +8834,7 @@ void m68k_op_tst_32_ix(void)
 {
    uint res = OPER_AY_IX_32();
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_32(res);
    FLAG_Z = res;
    FLAG_V = VFLAG_CLEAR;
@@ -8639,6 +8846,7 @@ void m68k_op_tst_32_aw(void)
 {
    uint res = OPER_AW_32();
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_32(res);
    FLAG_Z = res;
    FLAG_V = VFLAG_CLEAR;
@@ -8650,6 +8858,7 @@ void m68k_op_tst_32_al(void)
 {
    uint res = OPER_AL_32();
 
+   m68ki_discard_lazy_flags();
    FLAG_N = NFLAG_32(res);
    FLAG_Z = res;
    FLAG_V = VFLAG_CLEAR;
@@ -8659,6 +8868,7 @@ void m68k_op_tst_32_al(void)
 
 void m68k_op_tst_32_pcdi(void)
 {
+   m68ki_resolve_flags();
    if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
    {
       uint res = OPER_PCDI_32();
@@ -8675,6 +8885,7 @@ void m68k_op_tst_32_pcdi(void)
 
 void m68k_op_tst_32_pcix(void)
 {
+   m68ki_resolve_flags();
    if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
    {
       uint res = OPER_PCIX_32();
@@ -8691,6 +8902,7 @@ void m68k_op_tst_32_pcix(void)
 
 void m68k_op_tst_32_i(void)
 {
+   m68ki_resolve_flags();
    if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
    {
       uint res = OPER_I_32();
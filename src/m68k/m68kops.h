@@ -1970,11 +1970,21 @@ void m68k_op_unpk_16_mm_ax7(void);
 void m68k_op_unpk_16_mm_ay7(void);
 void m68k_op_unpk_16_mm_axy7(void);
 void m68k_op_unpk_16_mm(void);
-/* Build the opcode handler table */
-void m68ki_build_opcode_table(void);
+/* Every opcode has a 16 bit index into m68ki_instruction_handlers[] instead
+ * of its own pointer, the tables are 128kb + 16kb instead of 512kb.
+ * M68KI_INSTRUCTION_HANDLERS is the number of entrys in m68kophandlers.txt
+ * plus 1 for illegal opcodes, all the tables are generated into m68kops.c by
+ * tools/desktop/makeM68kOpcodeTables.
+ */
+#define M68KI_INSTRUCTION_HANDLERS 1963
+#define m68ki_instruction_handler(OPCODE) m68ki_instruction_handlers[m68ki_instruction_index_table[OPCODE]]
 
-extern void (*m68ki_instruction_jump_table[0x10000])(void); /* opcode handler jump table */
-extern uint8_t m68ki_cycles[][0x10000];
+extern const uint16_t m68ki_instruction_index_table[0x10000]; /* handler index for every opcode */
+extern void (*const m68ki_instruction_handlers[M68KI_INSTRUCTION_HANDLERS])(void); /* opcode handlers by index */
+extern const uint8_t m68ki_cycles[3][0x10000]; /* cycles for every opcode, 0 = 68000, 1 = 68010, 2 = 68020 */
+
+/* Run opcodes until the cycles run out using computed gotos(m68kthreaded.c) */
+void m68ki_execute_threaded(void);
 
 
 /* ======================================================================== */
@@ -0,0 +1,37146 @@
+#include <stdlib.h>
+
+#include "m68kops.h"
+#include "m68kcpu.h"
+
+/* ======================================================================== */
+/* ==================== THREADED INSTRUCTION HANDLERS ===================== */
+/* ======================================================================== */
+
+/* Generated by tools/desktop/makeThreadedM68k from m68kopac.c, m68kopdm.c and
+ * m68kopnz.c, dont edit this file, edit the handlers and run make.sh again.
+ */
+
+#if M68K_THREADED_DISPATCH
+typedef struct
+{
+   void (*handler)(void);
+   void* label;
+} m68ki_threaded_handler;
+
+static int m68ki_threaded_compare(const void* a, const void* b)
+{
+   uintptr_t handler_a = (uintptr_t)((const m68ki_threaded_handler*)a)->handler;
+   uintptr_t handler_b = (uintptr_t)((const m68ki_threaded_handler*)b)->handler;
+
+   return handler_a < handler_b ? -1 : handler_a > handler_b;
+}
+
+/* Fetch the next opcode and jump straight to its handler */
+#define M68KI_THREADED_DISPATCH() \
+   do \
+   { \
+      REG_PPC = REG_PC; \
+      REG_IR = m68ki_read_imm_16(); \
+      goto *m68ki_threaded_jump_table[m68ki_instruction_index_table[REG_IR]]; \
+   } while(0)
+
+/* End of every handler, same as the end of the loop in m68k_execute() */
+#define M68KI_THREADED_NEXT() \
+   do \
+   { \
+      USE_CYCLES(CYC_INSTRUCTION[REG_IR]); \
+      if(GET_CYCLES() <= 0) \
+         return; \
+      M68KI_THREADED_DISPATCH(); \
+   } while(0)
+
+/* Runs opcodes until the cycles run out, every handler is a label and jumps to the next opcode itself */
+void m68ki_execute_threaded(void)
+{
+   static m68ki_threaded_handler m68ki_threaded_handlers[] =
+   {
+      {m68k_op_1010, &&m68k_op_1010},
+      {m68k_op_1111, &&m68k_op_1111},
+      {m68k_op_abcd_8_rr, &&m68k_op_abcd_8_rr},
+      {m68k_op_abcd_8_mm_ax7, &&m68k_op_abcd_8_mm_ax7},
+      {m68k_op_abcd_8_mm_ay7, &&m68k_op_abcd_8_mm_ay7},
+      {m68k_op_abcd_8_mm_axy7, &&m68k_op_abcd_8_mm_axy7},
+      {m68k_op_abcd_8_mm, &&m68k_op_abcd_8_mm},
+      {m68k_op_add_8_er_d, &&m68k_op_add_8_er_d},
+      {m68k_op_add_8_er_ai, &&m68k_op_add_8_er_ai},
+      {m68k_op_add_8_er_pi, &&m68k_op_add_8_er_pi},
+      {m68k_op_add_8_er_pi7, &&m68k_op_add_8_er_pi7},
+      {m68k_op_add_8_er_pd, &&m68k_op_add_8_er_pd},
+      {m68k_op_add_8_er_pd7, &&m68k_op_add_8_er_pd7},
+      {m68k_op_add_8_er_di, &&m68k_op_add_8_er_di},
+      {m68k_op_add_8_er_ix, &&m68k_op_add_8_er_ix},
+      {m68k_op_add_8_er_aw, &&m68k_op_add_8_er_aw},
+      {m68k_op_add_8_er_al, &&m68k_op_add_8_er_al},
+      {m68k_op_add_8_er_pcdi, &&m68k_op_add_8_er_pcdi},
+      {m68k_op_add_8_er_pcix, &&m68k_op_add_8_er_pcix},
+      {m68k_op_add_8_er_i, &&m68k_op_add_8_er_i},
+      {m68k_op_add_16_er_d, &&m68k_op_add_16_er_d},
+      {m68k_op_add_16_er_a, &&m68k_op_add_16_er_a},
+      {m68k_op_add_16_er_ai, &&m68k_op_add_16_er_ai},
+      {m68k_op_add_16_er_pi, &&m68k_op_add_16_er_pi},
+      {m68k_op_add_16_er_pd, &&m68k_op_add_16_er_pd},
+      {m68k_op_add_16_er_di, &&m68k_op_add_16_er_di},
+      {m68k_op_add_16_er_ix, &&m68k_op_add_16_er_ix},
+      {m68k_op_add_16_er_aw, &&m68k_op_add_16_er_aw},
+      {m68k_op_add_16_er_al, &&m68k_op_add_16_er_al},
+      {m68k_op_add_16_er_pcdi, &&m68k_op_add_16_er_pcdi},
+      {m68k_op_add_16_er_pcix, &&m68k_op_add_16_er_pcix},
+      {m68k_op_add_16_er_i, &&m68k_op_add_16_er_i},
+      {m68k_op_add_32_er_d, &&m68k_op_add_32_er_d},
+      {m68k_op_add_32_er_a, &&m68k_op_add_32_er_a},
+      {m68k_op_add_32_er_ai, &&m68k_op_add_32_er_ai},
+      {m68k_op_add_32_er_pi, &&m68k_op_add_32_er_pi},
+      {m68k_op_add_32_er_pd, &&m68k_op_add_32_er_pd},
+      {m68k_op_add_32_er_di, &&m68k_op_add_32_er_di},
+      {m68k_op_add_32_er_ix, &&m68k_op_add_32_er_ix},
+      {m68k_op_add_32_er_aw, &&m68k_op_add_32_er_aw},
+      {m68k_op_add_32_er_al, &&m68k_op_add_32_er_al},
+      {m68k_op_add_32_er_pcdi, &&m68k_op_add_32_er_pcdi},
+      {m68k_op_add_32_er_pcix, &&m68k_op_add_32_er_pcix},
+      {m68k_op_add_32_er_i, &&m68k_op_add_32_er_i},
+      {m68k_op_add_8_re_ai, &&m68k_op_add_8_re_ai},
+      {m68k_op_add_8_re_pi, &&m68k_op_add_8_re_pi},
+      {m68k_op_add_8_re_pi7, &&m68k_op_add_8_re_pi7},
+      {m68k_op_add_8_re_pd, &&m68k_op_add_8_re_pd},
+      {m68k_op_add_8_re_pd7, &&m68k_op_add_8_re_pd7},
+      {m68k_op_add_8_re_di, &&m68k_op_add_8_re_di},
+      {m68k_op_add_8_re_ix, &&m68k_op_add_8_re_ix},
+      {m68k_op_add_8_re_aw, &&m68k_op_add_8_re_aw},
+      {m68k_op_add_8_re_al, &&m68k_op_add_8_re_al},
+      {m68k_op_add_16_re_ai, &&m68k_op_add_16_re_ai},
+      {m68k_op_add_16_re_pi, &&m68k_op_add_16_re_pi},
+      {m68k_op_add_16_re_pd, &&m68k_op_add_16_re_pd},
+      {m68k_op_add_16_re_di, &&m68k_op_add_16_re_di},
+      {m68k_op_add_16_re_ix, &&m68k_op_add_16_re_ix},
+      {m68k_op_add_16_re_aw, &&m68k_op_add_16_re_aw},
+      {m68k_op_add_16_re_al, &&m68k_op_add_16_re_al},
+      {m68k_op_add_32_re_ai, &&m68k_op_add_32_re_ai},
+      {m68k_op_add_32_re_pi, &&m68k_op_add_32_re_pi},
+      {m68k_op_add_32_re_pd, &&m68k_op_add_32_re_pd},
+      {m68k_op_add_32_re_di, &&m68k_op_add_32_re_di},
+      {m68k_op_add_32_re_ix, &&m68k_op_add_32_re_ix},
+      {m68k_op_add_32_re_aw, &&m68k_op_add_32_re_aw},
+      {m68k_op_add_32_re_al, &&m68k_op_add_32_re_al},
+      {m68k_op_adda_16_d, &&m68k_op_adda_16_d},
+      {m68k_op_adda_16_a, &&m68k_op_adda_16_a},
+      {m68k_op_adda_16_ai, &&m68k_op_adda_16_ai},
+      {m68k_op_adda_16_pi, &&m68k_op_adda_16_pi},
+      {m68k_op_adda_16_pd, &&m68k_op_adda_16_pd},
+      {m68k_op_adda_16_di, &&m68k_op_adda_16_di},
+      {m68k_op_adda_16_ix, &&m68k_op_adda_16_ix},
+      {m68k_op_adda_16_aw, &&m68k_op_adda_16_aw},
+      {m68k_op_adda_16_al, &&m68k_op_adda_16_al},
+      {m68k_op_adda_16_pcdi, &&m68k_op_adda_16_pcdi},
+      {m68k_op_adda_16_pcix, &&m68k_op_adda_16_pcix},
+      {m68k_op_adda_16_i, &&m68k_op_adda_16_i},
+      {m68k_op_adda_32_d, &&m68k_op_adda_32_d},
+      {m68k_op_adda_32_a, &&m68k_op_adda_32_a},
+      {m68k_op_adda_32_ai, &&m68k_op_adda_32_ai},
+      {m68k_op_adda_32_pi, &&m68k_op_adda_32_pi},
+      {m68k_op_adda_32_pd, &&m68k_op_adda_32_pd},
+      {m68k_op_adda_32_di, &&m68k_op_adda_32_di},
+      {m68k_op_adda_32_ix, &&m68k_op_adda_32_ix},
+      {m68k_op_adda_32_aw, &&m68k_op_adda_32_aw},
+      {m68k_op_adda_32_al, &&m68k_op_adda_32_al},
+      {m68k_op_adda_32_pcdi, &&m68k_op_adda_32_pcdi},
+      {m68k_op_adda_32_pcix, &&m68k_op_adda_32_pcix},
+      {m68k_op_adda_32_i, &&m68k_op_adda_32_i},
+      {m68k_op_addi_8_d, &&m68k_op_addi_8_d},
+      {m68k_op_addi_8_ai, &&m68k_op_addi_8_ai},
+      {m68k_op_addi_8_pi, &&m68k_op_addi_8_pi},
+      {m68k_op_addi_8_pi7, &&m68k_op_addi_8_pi7},
+      {m68k_op_addi_8_pd, &&m68k_op_addi_8_pd},
+      {m68k_op_addi_8_pd7, &&m68k_op_addi_8_pd7},
+      {m68k_op_addi_8_di, &&m68k_op_addi_8_di},
+      {m68k_op_addi_8_ix, &&m68k_op_addi_8_ix},
+      {m68k_op_addi_8_aw, &&m68k_op_addi_8_aw},
+      {m68k_op_addi_8_al, &&m68k_op_addi_8_al},
+      {m68k_op_addi_16_d, &&m68k_op_addi_16_d},
+      {m68k_op_addi_16_ai, &&m68k_op_addi_16_ai},
+      {m68k_op_addi_16_pi, &&m68k_op_addi_16_pi},
+      {m68k_op_addi_16_pd, &&m68k_op_addi_16_pd},
+      {m68k_op_addi_16_di, &&m68k_op_addi_16_di},
+      {m68k_op_addi_16_ix, &&m68k_op_addi_16_ix},
+      {m68k_op_addi_16_aw, &&m68k_op_addi_16_aw},
+      {m68k_op_addi_16_al, &&m68k_op_addi_16_al},
+      {m68k_op_addi_32_d, &&m68k_op_addi_32_d},
+      {m68k_op_addi_32_ai, &&m68k_op_addi_32_ai},
+      {m68k_op_addi_32_pi, &&m68k_op_addi_32_pi},
+      {m68k_op_addi_32_pd, &&m68k_op_addi_32_pd},
+      {m68k_op_addi_32_di, &&m68k_op_addi_32_di},
+      {m68k_op_addi_32_ix, &&m68k_op_addi_32_ix},
+      {m68k_op_addi_32_aw, &&m68k_op_addi_32_aw},
+      {m68k_op_addi_32_al, &&m68k_op_addi_32_al},
+      {m68k_op_addq_8_d, &&m68k_op_addq_8_d},
+      {m68k_op_addq_8_ai, &&m68k_op_addq_8_ai},
+      {m68k_op_addq_8_pi, &&m68k_op_addq_8_pi},
+      {m68k_op_addq_8_pi7, &&m68k_op_addq_8_pi7},
+      {m68k_op_addq_8_pd, &&m68k_op_addq_8_pd},
+      {m68k_op_addq_8_pd7, &&m68k_op_addq_8_pd7},
+      {m68k_op_addq_8_di, &&m68k_op_addq_8_di},
+      {m68k_op_addq_8_ix, &&m68k_op_addq_8_ix},
+      {m68k_op_addq_8_aw, &&m68k_op_addq_8_aw},
+      {m68k_op_addq_8_al, &&m68k_op_addq_8_al},
+      {m68k_op_addq_16_d, &&m68k_op_addq_16_d},
+      {m68k_op_addq_16_a, &&m68k_op_addq_16_a},
+      {m68k_op_addq_16_ai, &&m68k_op_addq_16_ai},
+      {m68k_op_addq_16_pi, &&m68k_op_addq_16_pi},
+      {m68k_op_addq_16_pd, &&m68k_op_addq_16_pd},
+      {m68k_op_addq_16_di, &&m68k_op_addq_16_di},
+      {m68k_op_addq_16_ix, &&m68k_op_addq_16_ix},
+      {m68k_op_addq_16_aw, &&m68k_op_addq_16_aw},
+      {m68k_op_addq_16_al, &&m68k_op_addq_16_al},
+      {m68k_op_addq_32_d, &&m68k_op_addq_32_d},
+      {m68k_op_addq_32_a, &&m68k_op_addq_32_a},
+      {m68k_op_addq_32_ai, &&m68k_op_addq_32_ai},
+      {m68k_op_addq_32_pi, &&m68k_op_addq_32_pi},
+      {m68k_op_addq_32_pd, &&m68k_op_addq_32_pd},
+      {m68k_op_addq_32_di, &&m68k_op_addq_32_di},
+      {m68k_op_addq_32_ix, &&m68k_op_addq_32_ix},
+      {m68k_op_addq_32_aw, &&m68k_op_addq_32_aw},
+      {m68k_op_addq_32_al, &&m68k_op_addq_32_al},
+      {m68k_op_addx_8_rr, &&m68k_op_addx_8_rr},
+      {m68k_op_addx_16_rr, &&m68k_op_addx_16_rr},
+      {m68k_op_addx_32_rr, &&m68k_op_addx_32_rr},
+      {m68k_op_addx_8_mm_ax7, &&m68k_op_addx_8_mm_ax7},
+      {m68k_op_addx_8_mm_ay7, &&m68k_op_addx_8_mm_ay7},
+      {m68k_op_addx_8_mm_axy7, &&m68k_op_addx_8_mm_axy7},
+      {m68k_op_addx_8_mm, &&m68k_op_addx_8_mm},
+      {m68k_op_addx_16_mm, &&m68k_op_addx_16_mm},
+      {m68k_op_addx_32_mm, &&m68k_op_addx_32_mm},
+      {m68k_op_and_8_er_d, &&m68k_op_and_8_er_d},
+      {m68k_op_and_8_er_ai, &&m68k_op_and_8_er_ai},
+      {m68k_op_and_8_er_pi, &&m68k_op_and_8_er_pi},
+      {m68k_op_and_8_er_pi7, &&m68k_op_and_8_er_pi7},
+      {m68k_op_and_8_er_pd, &&m68k_op_and_8_er_pd},
+      {m68k_op_and_8_er_pd7, &&m68k_op_and_8_er_pd7},
+      {m68k_op_and_8_er_di, &&m68k_op_and_8_er_di},
+      {m68k_op_and_8_er_ix, &&m68k_op_and_8_er_ix},
+      {m68k_op_and_8_er_aw, &&m68k_op_and_8_er_aw},
+      {m68k_op_and_8_er_al, &&m68k_op_and_8_er_al},
+      {m68k_op_and_8_er_pcdi, &&m68k_op_and_8_er_pcdi},
+      {m68k_op_and_8_er_pcix, &&m68k_op_and_8_er_pcix},
+      {m68k_op_and_8_er_i, &&m68k_op_and_8_er_i},
+      {m68k_op_and_16_er_d, &&m68k_op_and_16_er_d},
+      {m68k_op_and_16_er_ai, &&m68k_op_and_16_er_ai},
+      {m68k_op_and_16_er_pi, &&m68k_op_and_16_er_pi},
+      {m68k_op_and_16_er_pd, &&m68k_op_and_16_er_pd},
+      {m68k_op_and_16_er_di, &&m68k_op_and_16_er_di},
+      {m68k_op_and_16_er_ix, &&m68k_op_and_16_er_ix},
+      {m68k_op_and_16_er_aw, &&m68k_op_and_16_er_aw},
+      {m68k_op_and_16_er_al, &&m68k_op_and_16_er_al},
+      {m68k_op_and_16_er_pcdi, &&m68k_op_and_16_er_pcdi},
+      {m68k_op_and_16_er_pcix, &&m68k_op_and_16_er_pcix},
+      {m68k_op_and_16_er_i, &&m68k_op_and_16_er_i},
+      {m68k_op_and_32_er_d, &&m68k_op_and_32_er_d},
+      {m68k_op_and_32_er_ai, &&m68k_op_and_32_er_ai},
+      {m68k_op_and_32_er_pi, &&m68k_op_and_32_er_pi},
+      {m68k_op_and_32_er_pd, &&m68k_op_and_32_er_pd},
+      {m68k_op_and_32_er_di, &&m68k_op_and_32_er_di},
+      {m68k_op_and_32_er_ix, &&m68k_op_and_32_er_ix},
+      {m68k_op_and_32_er_aw, &&m68k_op_and_32_er_aw},
+      {m68k_op_and_32_er_al, &&m68k_op_and_32_er_al},
+      {m68k_op_and_32_er_pcdi, &&m68k_op_and_32_er_pcdi},
+      {m68k_op_and_32_er_pcix, &&m68k_op_and_32_er_pcix},
+      {m68k_op_and_32_er_i, &&m68k_op_and_32_er_i},
+      {m68k_op_and_8_re_ai, &&m68k_op_and_8_re_ai},
+      {m68k_op_and_8_re_pi, &&m68k_op_and_8_re_pi},
+      {m68k_op_and_8_re_pi7, &&m68k_op_and_8_re_pi7},
+      {m68k_op_and_8_re_pd, &&m68k_op_and_8_re_pd},
+      {m68k_op_and_8_re_pd7, &&m68k_op_and_8_re_pd7},
+      {m68k_op_and_8_re_di, &&m68k_op_and_8_re_di},
+      {m68k_op_and_8_re_ix, &&m68k_op_and_8_re_ix},
+      {m68k_op_and_8_re_aw, &&m68k_op_and_8_re_aw},
+      {m68k_op_and_8_re_al, &&m68k_op_and_8_re_al},
+      {m68k_op_and_16_re_ai, &&m68k_op_and_16_re_ai},
+      {m68k_op_and_16_re_pi, &&m68k_op_and_16_re_pi},
+      {m68k_op_and_16_re_pd, &&m68k_op_and_16_re_pd},
+      {m68k_op_and_16_re_di, &&m68k_op_and_16_re_di},
+      {m68k_op_and_16_re_ix, &&m68k_op_and_16_re_ix},
+      {m68k_op_and_16_re_aw, &&m68k_op_and_16_re_aw},
+      {m68k_op_and_16_re_al, &&m68k_op_and_16_re_al},
+      {m68k_op_and_32_re_ai, &&m68k_op_and_32_re_ai},
+      {m68k_op_and_32_re_pi, &&m68k_op_and_32_re_pi},
+      {m68k_op_and_32_re_pd, &&m68k_op_and_32_re_pd},
+      {m68k_op_and_32_re_di, &&m68k_op_and_32_re_di},
+      {m68k_op_and_32_re_ix, &&m68k_op_and_32_re_ix},
+      {m68k_op_and_32_re_aw, &&m68k_op_and_32_re_aw},
+      {m68k_op_and_32_re_al, &&m68k_op_and_32_re_al},
+      {m68k_op_andi_8_d, &&m68k_op_andi_8_d},
+      {m68k_op_andi_8_ai, &&m68k_op_andi_8_ai},
+      {m68k_op_andi_8_pi, &&m68k_op_andi_8_pi},
+      {m68k_op_andi_8_pi7, &&m68k_op_andi_8_pi7},
+      {m68k_op_andi_8_pd, &&m68k_op_andi_8_pd},
+      {m68k_op_andi_8_pd7, &&m68k_op_andi_8_pd7},
+      {m68k_op_andi_8_di, &&m68k_op_andi_8_di},
+      {m68k_op_andi_8_ix, &&m68k_op_andi_8_ix},
+      {m68k_op_andi_8_aw, &&m68k_op_andi_8_aw},
+      {m68k_op_andi_8_al, &&m68k_op_andi_8_al},
+      {m68k_op_andi_16_d, &&m68k_op_andi_16_d},
+      {m68k_op_andi_16_ai, &&m68k_op_andi_16_ai},
+      {m68k_op_andi_16_pi, &&m68k_op_andi_16_pi},
+      {m68k_op_andi_16_pd, &&m68k_op_andi_16_pd},
+      {m68k_op_andi_16_di, &&m68k_op_andi_16_di},
+      {m68k_op_andi_16_ix, &&m68k_op_andi_16_ix},
+      {m68k_op_andi_16_aw, &&m68k_op_andi_16_aw},
+      {m68k_op_andi_16_al, &&m68k_op_andi_16_al},
+      {m68k_op_andi_32_d, &&m68k_op_andi_32_d},
+      {m68k_op_andi_32_ai, &&m68k_op_andi_32_ai},
+      {m68k_op_andi_32_pi, &&m68k_op_andi_32_pi},
+      {m68k_op_andi_32_pd, &&m68k_op_andi_32_pd},
+      {m68k_op_andi_32_di, &&m68k_op_andi_32_di},
+      {m68k_op_andi_32_ix, &&m68k_op_andi_32_ix},
+      {m68k_op_andi_32_aw, &&m68k_op_andi_32_aw},
+      {m68k_op_andi_32_al, &&m68k_op_andi_32_al},
+      {m68k_op_andi_8_toc, &&m68k_op_andi_8_toc},
+      {m68k_op_andi_16_tos, &&m68k_op_andi_16_tos},
+      {m68k_op_asr_8_s, &&m68k_op_asr_8_s},
+      {m68k_op_asr_16_s, &&m68k_op_asr_16_s},
+      {m68k_op_asr_32_s, &&m68k_op_asr_32_s},
+      {m68k_op_asr_8_r, &&m68k_op_asr_8_r},
+      {m68k_op_asr_16_r, &&m68k_op_asr_16_r},
+      {m68k_op_asr_32_r, &&m68k_op_asr_32_r},
+      {m68k_op_asr_16_ai, &&m68k_op_asr_16_ai},
+      {m68k_op_asr_16_pi, &&m68k_op_asr_16_pi},
+      {m68k_op_asr_16_pd, &&m68k_op_asr_16_pd},
+      {m68k_op_asr_16_di, &&m68k_op_asr_16_di},
+      {m68k_op_asr_16_ix, &&m68k_op_asr_16_ix},
+      {m68k_op_asr_16_aw, &&m68k_op_asr_16_aw},
+      {m68k_op_asr_16_al, &&m68k_op_asr_16_al},
+      {m68k_op_asl_8_s, &&m68k_op_asl_8_s},
+      {m68k_op_asl_16_s, &&m68k_op_asl_16_s},
+      {m68k_op_asl_32_s, &&m68k_op_asl_32_s},
+      {m68k_op_asl_8_r, &&m68k_op_asl_8_r},
+      {m68k_op_asl_16_r, &&m68k_op_asl_16_r},
+      {m68k_op_asl_32_r, &&m68k_op_asl_32_r},
+      {m68k_op_asl_16_ai, &&m68k_op_asl_16_ai},
+      {m68k_op_asl_16_pi, &&m68k_op_asl_16_pi},
+      {m68k_op_asl_16_pd, &&m68k_op_asl_16_pd},
+      {m68k_op_asl_16_di, &&m68k_op_asl_16_di},
+      {m68k_op_asl_16_ix, &&m68k_op_asl_16_ix},
+      {m68k_op_asl_16_aw, &&m68k_op_asl_16_aw},
+      {m68k_op_asl_16_al, &&m68k_op_asl_16_al},
+      {m68k_op_bhi_8, &&m68k_op_bhi_8},
+      {m68k_op_bls_8, &&m68k_op_bls_8},
+      {m68k_op_bcc_8, &&m68k_op_bcc_8},
+      {m68k_op_bcs_8, &&m68k_op_bcs_8},
+      {m68k_op_bne_8, &&m68k_op_bne_8},
+      {m68k_op_beq_8, &&m68k_op_beq_8},
+      {m68k_op_bvc_8, &&m68k_op_bvc_8},
+      {m68k_op_bvs_8, &&m68k_op_bvs_8},
+      {m68k_op_bpl_8, &&m68k_op_bpl_8},
+      {m68k_op_bmi_8, &&m68k_op_bmi_8},
+      {m68k_op_bge_8, &&m68k_op_bge_8},
+      {m68k_op_blt_8, &&m68k_op_blt_8},
+      {m68k_op_bgt_8, &&m68k_op_bgt_8},
+      {m68k_op_ble_8, &&m68k_op_ble_8},
+      {m68k_op_bhi_16, &&m68k_op_bhi_16},
+      {m68k_op_bls_16, &&m68k_op_bls_16},
+      {m68k_op_bcc_16, &&m68k_op_bcc_16},
+      {m68k_op_bcs_16, &&m68k_op_bcs_16},
+      {m68k_op_bne_16, &&m68k_op_bne_16},
+      {m68k_op_beq_16, &&m68k_op_beq_16},
+      {m68k_op_bvc_16, &&m68k_op_bvc_16},
+      {m68k_op_bvs_16, &&m68k_op_bvs_16},
+      {m68k_op_bpl_16, &&m68k_op_bpl_16},
+      {m68k_op_bmi_16, &&m68k_op_bmi_16},
+      {m68k_op_bge_16, &&m68k_op_bge_16},
+      {m68k_op_blt_16, &&m68k_op_blt_16},
+      {m68k_op_bgt_16, &&m68k_op_bgt_16},
+      {m68k_op_ble_16, &&m68k_op_ble_16},
+      {m68k_op_bhi_32, &&m68k_op_bhi_32},
+      {m68k_op_bls_32, &&m68k_op_bls_32},
+      {m68k_op_bcc_32, &&m68k_op_bcc_32},
+      {m68k_op_bcs_32, &&m68k_op_bcs_32},
+      {m68k_op_bne_32, &&m68k_op_bne_32},
+      {m68k_op_beq_32, &&m68k_op_beq_32},
+      {m68k_op_bvc_32, &&m68k_op_bvc_32},
+      {m68k_op_bvs_32, &&m68k_op_bvs_32},
+      {m68k_op_bpl_32, &&m68k_op_bpl_32},
+      {m68k_op_bmi_32, &&m68k_op_bmi_32},
+      {m68k_op_bge_32, &&m68k_op_bge_32},
+      {m68k_op_blt_32, &&m68k_op_blt_32},
+      {m68k_op_bgt_32, &&m68k_op_bgt_32},
+      {m68k_op_ble_32, &&m68k_op_ble_32},
+      {m68k_op_bchg_32_r_d, &&m68k_op_bchg_32_r_d},
+      {m68k_op_bchg_8_r_ai, &&m68k_op_bchg_8_r_ai},
+      {m68k_op_bchg_8_r_pi, &&m68k_op_bchg_8_r_pi},
+      {m68k_op_bchg_8_r_pi7, &&m68k_op_bchg_8_r_pi7},
+      {m68k_op_bchg_8_r_pd, &&m68k_op_bchg_8_r_pd},
+      {m68k_op_bchg_8_r_pd7, &&m68k_op_bchg_8_r_pd7},
+      {m68k_op_bchg_8_r_di, &&m68k_op_bchg_8_r_di},
+      {m68k_op_bchg_8_r_ix, &&m68k_op_bchg_8_r_ix},
+      {m68k_op_bchg_8_r_aw, &&m68k_op_bchg_8_r_aw},
+      {m68k_op_bchg_8_r_al, &&m68k_op_bchg_8_r_al},
+      {m68k_op_bchg_32_s_d, &&m68k_op_bchg_32_s_d},
+      {m68k_op_bchg_8_s_ai, &&m68k_op_bchg_8_s_ai},
+      {m68k_op_bchg_8_s_pi, &&m68k_op_bchg_8_s_pi},
+      {m68k_op_bchg_8_s_pi7, &&m68k_op_bchg_8_s_pi7},
+      {m68k_op_bchg_8_s_pd, &&m68k_op_bchg_8_s_pd},
+      {m68k_op_bchg_8_s_pd7, &&m68k_op_bchg_8_s_pd7},
+      {m68k_op_bchg_8_s_di, &&m68k_op_bchg_8_s_di},
+      {m68k_op_bchg_8_s_ix, &&m68k_op_bchg_8_s_ix},
+      {m68k_op_bchg_8_s_aw, &&m68k_op_bchg_8_s_aw},
+      {m68k_op_bchg_8_s_al, &&m68k_op_bchg_8_s_al},
+      {m68k_op_bclr_32_r_d, &&m68k_op_bclr_32_r_d},
+      {m68k_op_bclr_8_r_ai, &&m68k_op_bclr_8_r_ai},
+      {m68k_op_bclr_8_r_pi, &&m68k_op_bclr_8_r_pi},
+      {m68k_op_bclr_8_r_pi7, &&m68k_op_bclr_8_r_pi7},
+      {m68k_op_bclr_8_r_pd, &&m68k_op_bclr_8_r_pd},
+      {m68k_op_bclr_8_r_pd7, &&m68k_op_bclr_8_r_pd7},
+      {m68k_op_bclr_8_r_di, &&m68k_op_bclr_8_r_di},
+      {m68k_op_bclr_8_r_ix, &&m68k_op_bclr_8_r_ix},
+      {m68k_op_bclr_8_r_aw, &&m68k_op_bclr_8_r_aw},
+      {m68k_op_bclr_8_r_al, &&m68k_op_bclr_8_r_al},
+      {m68k_op_bclr_32_s_d, &&m68k_op_bclr_32_s_d},
+      {m68k_op_bclr_8_s_ai, &&m68k_op_bclr_8_s_ai},
+      {m68k_op_bclr_8_s_pi, &&m68k_op_bclr_8_s_pi},
+      {m68k_op_bclr_8_s_pi7, &&m68k_op_bclr_8_s_pi7},
+      {m68k_op_bclr_8_s_pd, &&m68k_op_bclr_8_s_pd},
+      {m68k_op_bclr_8_s_pd7, &&m68k_op_bclr_8_s_pd7},
+      {m68k_op_bclr_8_s_di, &&m68k_op_bclr_8_s_di},
+      {m68k_op_bclr_8_s_ix, &&m68k_op_bclr_8_s_ix},
+      {m68k_op_bclr_8_s_aw, &&m68k_op_bclr_8_s_aw},
+      {m68k_op_bclr_8_s_al, &&m68k_op_bclr_8_s_al},
+      {m68k_op_bfchg_32_d, &&m68k_op_bfchg_32_d},
+      {m68k_op_bfchg_32_ai, &&m68k_op_bfchg_32_ai},
+      {m68k_op_bfchg_32_di, &&m68k_op_bfchg_32_di},
+      {m68k_op_bfchg_32_ix, &&m68k_op_bfchg_32_ix},
+      {m68k_op_bfchg_32_aw, &&m68k_op_bfchg_32_aw},
+      {m68k_op_bfchg_32_al, &&m68k_op_bfchg_32_al},
+      {m68k_op_bfclr_32_d, &&m68k_op_bfclr_32_d},
+      {m68k_op_bfclr_32_ai, &&m68k_op_bfclr_32_ai},
+      {m68k_op_bfclr_32_di, &&m68k_op_bfclr_32_di},
+      {m68k_op_bfclr_32_ix, &&m68k_op_bfclr_32_ix},
+      {m68k_op_bfclr_32_aw, &&m68k_op_bfclr_32_aw},
+      {m68k_op_bfclr_32_al, &&m68k_op_bfclr_32_al},
+      {m68k_op_bfexts_32_d, &&m68k_op_bfexts_32_d},
+      {m68k_op_bfexts_32_ai, &&m68k_op_bfexts_32_ai},
+      {m68k_op_bfexts_32_di, &&m68k_op_bfexts_32_di},
+      {m68k_op_bfexts_32_ix, &&m68k_op_bfexts_32_ix},
+      {m68k_op_bfexts_32_aw, &&m68k_op_bfexts_32_aw},
+      {m68k_op_bfexts_32_al, &&m68k_op_bfexts_32_al},
+      {m68k_op_bfexts_32_pcdi, &&m68k_op_bfexts_32_pcdi},
+      {m68k_op_bfexts_32_pcix, &&m68k_op_bfexts_32_pcix},
+      {m68k_op_bfextu_32_d, &&m68k_op_bfextu_32_d},
+      {m68k_op_bfextu_32_ai, &&m68k_op_bfextu_32_ai},
+      {m68k_op_bfextu_32_di, &&m68k_op_bfextu_32_di},
+      {m68k_op_bfextu_32_ix, &&m68k_op_bfextu_32_ix},
+      {m68k_op_bfextu_32_aw, &&m68k_op_bfextu_32_aw},
+      {m68k_op_bfextu_32_al, &&m68k_op_bfextu_32_al},
+      {m68k_op_bfextu_32_pcdi, &&m68k_op_bfextu_32_pcdi},
+      {m68k_op_bfextu_32_pcix, &&m68k_op_bfextu_32_pcix},
+      {m68k_op_bfffo_32_d, &&m68k_op_bfffo_32_d},
+      {m68k_op_bfffo_32_ai, &&m68k_op_bfffo_32_ai},
+      {m68k_op_bfffo_32_di, &&m68k_op_bfffo_32_di},
+      {m68k_op_bfffo_32_ix, &&m68k_op_bfffo_32_ix},
+      {m68k_op_bfffo_32_aw, &&m68k_op_bfffo_32_aw},
+      {m68k_op_bfffo_32_al, &&m68k_op_bfffo_32_al},
+      {m68k_op_bfffo_32_pcdi, &&m68k_op_bfffo_32_pcdi},
+      {m68k_op_bfffo_32_pcix, &&m68k_op_bfffo_32_pcix},
+      {m68k_op_bfins_32_d, &&m68k_op_bfins_32_d},
+      {m68k_op_bfins_32_ai, &&m68k_op_bfins_32_ai},
+      {m68k_op_bfins_32_di, &&m68k_op_bfins_32_di},
+      {m68k_op_bfins_32_ix, &&m68k_op_bfins_32_ix},
+      {m68k_op_bfins_32_aw, &&m68k_op_bfins_32_aw},
+      {m68k_op_bfins_32_al, &&m68k_op_bfins_32_al},
+      {m68k_op_bfset_32_d, &&m68k_op_bfset_32_d},
+      {m68k_op_bfset_32_ai, &&m68k_op_bfset_32_ai},
+      {m68k_op_bfset_32_di, &&m68k_op_bfset_32_di},
+      {m68k_op_bfset_32_ix, &&m68k_op_bfset_32_ix},
+      {m68k_op_bfset_32_aw, &&m68k_op_bfset_32_aw},
+      {m68k_op_bfset_32_al, &&m68k_op_bfset_32_al},
+      {m68k_op_bftst_32_d, &&m68k_op_bftst_32_d},
+      {m68k_op_bftst_32_ai, &&m68k_op_bftst_32_ai},
+      {m68k_op_bftst_32_di, &&m68k_op_bftst_32_di},
+      {m68k_op_bftst_32_ix, &&m68k_op_bftst_32_ix},
+      {m68k_op_bftst_32_aw, &&m68k_op_bftst_32_aw},
+      {m68k_op_bftst_32_al, &&m68k_op_bftst_32_al},
+      {m68k_op_bftst_32_pcdi, &&m68k_op_bftst_32_pcdi},
+      {m68k_op_bftst_32_pcix, &&m68k_op_bftst_32_pcix},
+      {m68k_op_bkpt, &&m68k_op_bkpt},
+      {m68k_op_bra_8, &&m68k_op_bra_8},
+      {m68k_op_bra_16, &&m68k_op_bra_16},
+      {m68k_op_bra_32, &&m68k_op_bra_32},
+      {m68k_op_bset_32_r_d, &&m68k_op_bset_32_r_d},
+      {m68k_op_bset_8_r_ai, &&m68k_op_bset_8_r_ai},
+      {m68k_op_bset_8_r_pi, &&m68k_op_bset_8_r_pi},
+      {m68k_op_bset_8_r_pi7, &&m68k_op_bset_8_r_pi7},
+      {m68k_op_bset_8_r_pd, &&m68k_op_bset_8_r_pd},
+      {m68k_op_bset_8_r_pd7, &&m68k_op_bset_8_r_pd7},
+      {m68k_op_bset_8_r_di, &&m68k_op_bset_8_r_di},
+      {m68k_op_bset_8_r_ix, &&m68k_op_bset_8_r_ix},
+      {m68k_op_bset_8_r_aw, &&m68k_op_bset_8_r_aw},
+      {m68k_op_bset_8_r_al, &&m68k_op_bset_8_r_al},
+      {m68k_op_bset_32_s_d, &&m68k_op_bset_32_s_d},
+      {m68k_op_bset_8_s_ai, &&m68k_op_bset_8_s_ai},
+      {m68k_op_bset_8_s_pi, &&m68k_op_bset_8_s_pi},
+      {m68k_op_bset_8_s_pi7, &&m68k_op_bset_8_s_pi7},
+      {m68k_op_bset_8_s_pd, &&m68k_op_bset_8_s_pd},
+      {m68k_op_bset_8_s_pd7, &&m68k_op_bset_8_s_pd7},
+      {m68k_op_bset_8_s_di, &&m68k_op_bset_8_s_di},
+      {m68k_op_bset_8_s_ix, &&m68k_op_bset_8_s_ix},
+      {m68k_op_bset_8_s_aw, &&m68k_op_bset_8_s_aw},
+      {m68k_op_bset_8_s_al, &&m68k_op_bset_8_s_al},
+      {m68k_op_bsr_8, &&m68k_op_bsr_8},
+      {m68k_op_bsr_16, &&m68k_op_bsr_16},
+      {m68k_op_bsr_32, &&m68k_op_bsr_32},
+      {m68k_op_btst_32_r_d, &&m68k_op_btst_32_r_d},
+      {m68k_op_btst_8_r_ai, &&m68k_op_btst_8_r_ai},
+      {m68k_op_btst_8_r_pi, &&m68k_op_btst_8_r_pi},
+      {m68k_op_btst_8_r_pi7, &&m68k_op_btst_8_r_pi7},
+      {m68k_op_btst_8_r_pd, &&m68k_op_btst_8_r_pd},
+      {m68k_op_btst_8_r_pd7, &&m68k_op_btst_8_r_pd7},
+      {m68k_op_btst_8_r_di, &&m68k_op_btst_8_r_di},
+      {m68k_op_btst_8_r_ix, &&m68k_op_btst_8_r_ix},
+      {m68k_op_btst_8_r_aw, &&m68k_op_btst_8_r_aw},
+      {m68k_op_btst_8_r_al, &&m68k_op_btst_8_r_al},
+      {m68k_op_btst_8_r_pcdi, &&m68k_op_btst_8_r_pcdi},
+      {m68k_op_btst_8_r_pcix, &&m68k_op_btst_8_r_pcix},
+      {m68k_op_btst_8_r_i, &&m68k_op_btst_8_r_i},
+      {m68k_op_btst_32_s_d, &&m68k_op_btst_32_s_d},
+      {m68k_op_btst_8_s_ai, &&m68k_op_btst_8_s_ai},
+      {m68k_op_btst_8_s_pi, &&m68k_op_btst_8_s_pi},
+      {m68k_op_btst_8_s_pi7, &&m68k_op_btst_8_s_pi7},
+      {m68k_op_btst_8_s_pd, &&m68k_op_btst_8_s_pd},
+      {m68k_op_btst_8_s_pd7, &&m68k_op_btst_8_s_pd7},
+      {m68k_op_btst_8_s_di, &&m68k_op_btst_8_s_di},
+      {m68k_op_btst_8_s_ix, &&m68k_op_btst_8_s_ix},
+      {m68k_op_btst_8_s_aw, &&m68k_op_btst_8_s_aw},
+      {m68k_op_btst_8_s_al, &&m68k_op_btst_8_s_al},
+      {m68k_op_btst_8_s_pcdi, &&m68k_op_btst_8_s_pcdi},
+      {m68k_op_btst_8_s_pcix, &&m68k_op_btst_8_s_pcix},
+      {m68k_op_callm_32_ai, &&m68k_op_callm_32_ai},
+      {m68k_op_callm_32_di, &&m68k_op_callm_32_di},
+      {m68k_op_callm_32_ix, &&m68k_op_callm_32_ix},
+      {m68k_op_callm_32_aw, &&m68k_op_callm_32_aw},
+      {m68k_op_callm_32_al, &&m68k_op_callm_32_al},
+      {m68k_op_callm_32_pcdi, &&m68k_op_callm_32_pcdi},
+      {m68k_op_callm_32_pcix, &&m68k_op_callm_32_pcix},
+      {m68k_op_cas_8_ai, &&m68k_op_cas_8_ai},
+      {m68k_op_cas_8_pi, &&m68k_op_cas_8_pi},
+      {m68k_op_cas_8_pi7, &&m68k_op_cas_8_pi7},
+      {m68k_op_cas_8_pd, &&m68k_op_cas_8_pd},
+      {m68k_op_cas_8_pd7, &&m68k_op_cas_8_pd7},
+      {m68k_op_cas_8_di, &&m68k_op_cas_8_di},
+      {m68k_op_cas_8_ix, &&m68k_op_cas_8_ix},
+      {m68k_op_cas_8_aw, &&m68k_op_cas_8_aw},
+      {m68k_op_cas_8_al, &&m68k_op_cas_8_al},
+      {m68k_op_cas_16_ai, &&m68k_op_cas_16_ai},
+      {m68k_op_cas_16_pi, &&m68k_op_cas_16_pi},
+      {m68k_op_cas_16_pd, &&m68k_op_cas_16_pd},
+      {m68k_op_cas_16_di, &&m68k_op_cas_16_di},
+      {m68k_op_cas_16_ix, &&m68k_op_cas_16_ix},
+      {m68k_op_cas_16_aw, &&m68k_op_cas_16_aw},
+      {m68k_op_cas_16_al, &&m68k_op_cas_16_al},
+      {m68k_op_cas_32_ai, &&m68k_op_cas_32_ai},
+      {m68k_op_cas_32_pi, &&m68k_op_cas_32_pi},
+      {m68k_op_cas_32_pd, &&m68k_op_cas_32_pd},
+      {m68k_op_cas_32_di, &&m68k_op_cas_32_di},
+      {m68k_op_cas_32_ix, &&m68k_op_cas_32_ix},
+      {m68k_op_cas_32_aw, &&m68k_op_cas_32_aw},
+      {m68k_op_cas_32_al, &&m68k_op_cas_32_al},
+      {m68k_op_cas2_16, &&m68k_op_cas2_16},
+      {m68k_op_cas2_32, &&m68k_op_cas2_32},
+      {m68k_op_chk_16_d, &&m68k_op_chk_16_d},
+      {m68k_op_chk_16_ai, &&m68k_op_chk_16_ai},
+      {m68k_op_chk_16_pi, &&m68k_op_chk_16_pi},
+      {m68k_op_chk_16_pd, &&m68k_op_chk_16_pd},
+      {m68k_op_chk_16_di, &&m68k_op_chk_16_di},
+      {m68k_op_chk_16_ix, &&m68k_op_chk_16_ix},
+      {m68k_op_chk_16_aw, &&m68k_op_chk_16_aw},
+      {m68k_op_chk_16_al, &&m68k_op_chk_16_al},
+      {m68k_op_chk_16_pcdi, &&m68k_op_chk_16_pcdi},
+      {m68k_op_chk_16_pcix, &&m68k_op_chk_16_pcix},
+      {m68k_op_chk_16_i, &&m68k_op_chk_16_i},
+      {m68k_op_chk_32_d, &&m68k_op_chk_32_d},
+      {m68k_op_chk_32_ai, &&m68k_op_chk_32_ai},
+      {m68k_op_chk_32_pi, &&m68k_op_chk_32_pi},
+      {m68k_op_chk_32_pd, &&m68k_op_chk_32_pd},
+      {m68k_op_chk_32_di, &&m68k_op_chk_32_di},
+      {m68k_op_chk_32_ix, &&m68k_op_chk_32_ix},
+      {m68k_op_chk_32_aw, &&m68k_op_chk_32_aw},
+      {m68k_op_chk_32_al, &&m68k_op_chk_32_al},
+      {m68k_op_chk_32_pcdi, &&m68k_op_chk_32_pcdi},
+      {m68k_op_chk_32_pcix, &&m68k_op_chk_32_pcix},
+      {m68k_op_chk_32_i, &&m68k_op_chk_32_i},
+      {m68k_op_chk2cmp2_8_pcdi, &&m68k_op_chk2cmp2_8_pcdi},
+      {m68k_op_chk2cmp2_8_pcix, &&m68k_op_chk2cmp2_8_pcix},
+      {m68k_op_chk2cmp2_8_ai, &&m68k_op_chk2cmp2_8_ai},
+      {m68k_op_chk2cmp2_8_di, &&m68k_op_chk2cmp2_8_di},
+      {m68k_op_chk2cmp2_8_ix, &&m68k_op_chk2cmp2_8_ix},
+      {m68k_op_chk2cmp2_8_aw, &&m68k_op_chk2cmp2_8_aw},
+      {m68k_op_chk2cmp2_8_al, &&m68k_op_chk2cmp2_8_al},
+      {m68k_op_chk2cmp2_16_pcdi, &&m68k_op_chk2cmp2_16_pcdi},
+      {m68k_op_chk2cmp2_16_pcix, &&m68k_op_chk2cmp2_16_pcix},
+      {m68k_op_chk2cmp2_16_ai, &&m68k_op_chk2cmp2_16_ai},
+      {m68k_op_chk2cmp2_16_di, &&m68k_op_chk2cmp2_16_di},
+      {m68k_op_chk2cmp2_16_ix, &&m68k_op_chk2cmp2_16_ix},
+      {m68k_op_chk2cmp2_16_aw, &&m68k_op_chk2cmp2_16_aw},
+      {m68k_op_chk2cmp2_16_al, &&m68k_op_chk2cmp2_16_al},
+      {m68k_op_chk2cmp2_32_pcdi, &&m68k_op_chk2cmp2_32_pcdi},
+      {m68k_op_chk2cmp2_32_pcix, &&m68k_op_chk2cmp2_32_pcix},
+      {m68k_op_chk2cmp2_32_ai, &&m68k_op_chk2cmp2_32_ai},
+      {m68k_op_chk2cmp2_32_di, &&m68k_op_chk2cmp2_32_di},
+      {m68k_op_chk2cmp2_32_ix, &&m68k_op_chk2cmp2_32_ix},
+      {m68k_op_chk2cmp2_32_aw, &&m68k_op_chk2cmp2_32_aw},
+      {m68k_op_chk2cmp2_32_al, &&m68k_op_chk2cmp2_32_al},
+      {m68k_op_clr_8_d, &&m68k_op_clr_8_d},
+      {m68k_op_clr_8_ai, &&m68k_op_clr_8_ai},
+      {m68k_op_clr_8_pi, &&m68k_op_clr_8_pi},
+      {m68k_op_clr_8_pi7, &&m68k_op_clr_8_pi7},
+      {m68k_op_clr_8_pd, &&m68k_op_clr_8_pd},
+      {m68k_op_clr_8_pd7, &&m68k_op_clr_8_pd7},
+      {m68k_op_clr_8_di, &&m68k_op_clr_8_di},
+      {m68k_op_clr_8_ix, &&m68k_op_clr_8_ix},
+      {m68k_op_clr_8_aw, &&m68k_op_clr_8_aw},
+      {m68k_op_clr_8_al, &&m68k_op_clr_8_al},
+      {m68k_op_clr_16_d, &&m68k_op_clr_16_d},
+      {m68k_op_clr_16_ai, &&m68k_op_clr_16_ai},
+      {m68k_op_clr_16_pi, &&m68k_op_clr_16_pi},
+      {m68k_op_clr_16_pd, &&m68k_op_clr_16_pd},
+      {m68k_op_clr_16_di, &&m68k_op_clr_16_di},
+      {m68k_op_clr_16_ix, &&m68k_op_clr_16_ix},
+      {m68k_op_clr_16_aw, &&m68k_op_clr_16_aw},
+      {m68k_op_clr_16_al, &&m68k_op_clr_16_al},
+      {m68k_op_clr_32_d, &&m68k_op_clr_32_d},
+      {m68k_op_clr_32_ai, &&m68k_op_clr_32_ai},
+      {m68k_op_clr_32_pi, &&m68k_op_clr_32_pi},
+      {m68k_op_clr_32_pd, &&m68k_op_clr_32_pd},
+      {m68k_op_clr_32_di, &&m68k_op_clr_32_di},
+      {m68k_op_clr_32_ix, &&m68k_op_clr_32_ix},
+      {m68k_op_clr_32_aw, &&m68k_op_clr_32_aw},
+      {m68k_op_clr_32_al, &&m68k_op_clr_32_al},
+      {m68k_op_cmp_8_d, &&m68k_op_cmp_8_d},
+      {m68k_op_cmp_8_ai, &&m68k_op_cmp_8_ai},
+      {m68k_op_cmp_8_pi, &&m68k_op_cmp_8_pi},
+      {m68k_op_cmp_8_pi7, &&m68k_op_cmp_8_pi7},
+      {m68k_op_cmp_8_pd, &&m68k_op_cmp_8_pd},
+      {m68k_op_cmp_8_pd7, &&m68k_op_cmp_8_pd7},
+      {m68k_op_cmp_8_di, &&m68k_op_cmp_8_di},
+      {m68k_op_cmp_8_ix, &&m68k_op_cmp_8_ix},
+      {m68k_op_cmp_8_aw, &&m68k_op_cmp_8_aw},
+      {m68k_op_cmp_8_al, &&m68k_op_cmp_8_al},
+      {m68k_op_cmp_8_pcdi, &&m68k_op_cmp_8_pcdi},
+      {m68k_op_cmp_8_pcix, &&m68k_op_cmp_8_pcix},
+      {m68k_op_cmp_8_i, &&m68k_op_cmp_8_i},
+      {m68k_op_cmp_16_d, &&m68k_op_cmp_16_d},
+      {m68k_op_cmp_16_a, &&m68k_op_cmp_16_a},
+      {m68k_op_cmp_16_ai, &&m68k_op_cmp_16_ai},
+      {m68k_op_cmp_16_pi, &&m68k_op_cmp_16_pi},
+      {m68k_op_cmp_16_pd, &&m68k_op_cmp_16_pd},
+      {m68k_op_cmp_16_di, &&m68k_op_cmp_16_di},
+      {m68k_op_cmp_16_ix, &&m68k_op_cmp_16_ix},
+      {m68k_op_cmp_16_aw, &&m68k_op_cmp_16_aw},
+      {m68k_op_cmp_16_al, &&m68k_op_cmp_16_al},
+      {m68k_op_cmp_16_pcdi, &&m68k_op_cmp_16_pcdi},
+      {m68k_op_cmp_16_pcix, &&m68k_op_cmp_16_pcix},
+      {m68k_op_cmp_16_i, &&m68k_op_cmp_16_i},
+      {m68k_op_cmp_32_d, &&m68k_op_cmp_32_d},
+      {m68k_op_cmp_32_a, &&m68k_op_cmp_32_a},
+      {m68k_op_cmp_32_ai, &&m68k_op_cmp_32_ai},
+      {m68k_op_cmp_32_pi, &&m68k_op_cmp_32_pi},
+      {m68k_op_cmp_32_pd, &&m68k_op_cmp_32_pd},
+      {m68k_op_cmp_32_di, &&m68k_op_cmp_32_di},
+      {m68k_op_cmp_32_ix, &&m68k_op_cmp_32_ix},
+      {m68k_op_cmp_32_aw, &&m68k_op_cmp_32_aw},
+      {m68k_op_cmp_32_al, &&m68k_op_cmp_32_al},
+      {m68k_op_cmp_32_pcdi, &&m68k_op_cmp_32_pcdi},
+      {m68k_op_cmp_32_pcix, &&m68k_op_cmp_32_pcix},
+      {m68k_op_cmp_32_i, &&m68k_op_cmp_32_i},
+      {m68k_op_cmpa_16_d, &&m68k_op_cmpa_16_d},
+      {m68k_op_cmpa_16_a, &&m68k_op_cmpa_16_a},
+      {m68k_op_cmpa_16_ai, &&m68k_op_cmpa_16_ai},
+      {m68k_op_cmpa_16_pi, &&m68k_op_cmpa_16_pi},
+      {m68k_op_cmpa_16_pd, &&m68k_op_cmpa_16_pd},
+      {m68k_op_cmpa_16_di, &&m68k_op_cmpa_16_di},
+      {m68k_op_cmpa_16_ix, &&m68k_op_cmpa_16_ix},
+      {m68k_op_cmpa_16_aw, &&m68k_op_cmpa_16_aw},
+      {m68k_op_cmpa_16_al, &&m68k_op_cmpa_16_al},
+      {m68k_op_cmpa_16_pcdi, &&m68k_op_cmpa_16_pcdi},
+      {m68k_op_cmpa_16_pcix, &&m68k_op_cmpa_16_pcix},
+      {m68k_op_cmpa_16_i, &&m68k_op_cmpa_16_i},
+      {m68k_op_cmpa_32_d, &&m68k_op_cmpa_32_d},
+      {m68k_op_cmpa_32_a, &&m68k_op_cmpa_32_a},
+      {m68k_op_cmpa_32_ai, &&m68k_op_cmpa_32_ai},
+      {m68k_op_cmpa_32_pi, &&m68k_op_cmpa_32_pi},
+      {m68k_op_cmpa_32_pd, &&m68k_op_cmpa_32_pd},
+      {m68k_op_cmpa_32_di, &&m68k_op_cmpa_32_di},
+      {m68k_op_cmpa_32_ix, &&m68k_op_cmpa_32_ix},
+      {m68k_op_cmpa_32_aw, &&m68k_op_cmpa_32_aw},
+      {m68k_op_cmpa_32_al, &&m68k_op_cmpa_32_al},
+      {m68k_op_cmpa_32_pcdi, &&m68k_op_cmpa_32_pcdi},
+      {m68k_op_cmpa_32_pcix, &&m68k_op_cmpa_32_pcix},
+      {m68k_op_cmpa_32_i, &&m68k_op_cmpa_32_i},
+      {m68k_op_cmpi_8_d, &&m68k_op_cmpi_8_d},
+      {m68k_op_cmpi_8_ai, &&m68k_op_cmpi_8_ai},
+      {m68k_op_cmpi_8_pi, &&m68k_op_cmpi_8_pi},
+      {m68k_op_cmpi_8_pi7, &&m68k_op_cmpi_8_pi7},
+      {m68k_op_cmpi_8_pd, &&m68k_op_cmpi_8_pd},
+      {m68k_op_cmpi_8_pd7, &&m68k_op_cmpi_8_pd7},
+      {m68k_op_cmpi_8_di, &&m68k_op_cmpi_8_di},
+      {m68k_op_cmpi_8_ix, &&m68k_op_cmpi_8_ix},
+      {m68k_op_cmpi_8_aw, &&m68k_op_cmpi_8_aw},
+      {m68k_op_cmpi_8_al, &&m68k_op_cmpi_8_al},
+      {m68k_op_cmpi_8_pcdi, &&m68k_op_cmpi_8_pcdi},
+      {m68k_op_cmpi_8_pcix, &&m68k_op_cmpi_8_pcix},
+      {m68k_op_cmpi_16_d, &&m68k_op_cmpi_16_d},
+      {m68k_op_cmpi_16_ai, &&m68k_op_cmpi_16_ai},
+      {m68k_op_cmpi_16_pi, &&m68k_op_cmpi_16_pi},
+      {m68k_op_cmpi_16_pd, &&m68k_op_cmpi_16_pd},
+      {m68k_op_cmpi_16_di, &&m68k_op_cmpi_16_di},
+      {m68k_op_cmpi_16_ix, &&m68k_op_cmpi_16_ix},
+      {m68k_op_cmpi_16_aw, &&m68k_op_cmpi_16_aw},
+      {m68k_op_cmpi_16_al, &&m68k_op_cmpi_16_al},
+      {m68k_op_cmpi_16_pcdi, &&m68k_op_cmpi_16_pcdi},
+      {m68k_op_cmpi_16_pcix, &&m68k_op_cmpi_16_pcix},
+      {m68k_op_cmpi_32_d, &&m68k_op_cmpi_32_d},
+      {m68k_op_cmpi_32_ai, &&m68k_op_cmpi_32_ai},
+      {m68k_op_cmpi_32_pi, &&m68k_op_cmpi_32_pi},
+      {m68k_op_cmpi_32_pd, &&m68k_op_cmpi_32_pd},
+      {m68k_op_cmpi_32_di, &&m68k_op_cmpi_32_di},
+      {m68k_op_cmpi_32_ix, &&m68k_op_cmpi_32_ix},
+      {m68k_op_cmpi_32_aw, &&m68k_op_cmpi_32_aw},
+      {m68k_op_cmpi_32_al, &&m68k_op_cmpi_32_al},
+      {m68k_op_cmpi_32_pcdi, &&m68k_op_cmpi_32_pcdi},
+      {m68k_op_cmpi_32_pcix, &&m68k_op_cmpi_32_pcix},
+      {m68k_op_cmpm_8_ax7, &&m68k_op_cmpm_8_ax7},
+      {m68k_op_cmpm_8_ay7, &&m68k_op_cmpm_8_ay7},
+      {m68k_op_cmpm_8_axy7, &&m68k_op_cmpm_8_axy7},
+      {m68k_op_cmpm_8, &&m68k_op_cmpm_8},
+      {m68k_op_cmpm_16, &&m68k_op_cmpm_16},
+      {m68k_op_cmpm_32, &&m68k_op_cmpm_32},
+      {m68k_op_cpbcc_32, &&m68k_op_cpbcc_32},
+      {m68k_op_cpdbcc_32, &&m68k_op_cpdbcc_32},
+      {m68k_op_cpgen_32, &&m68k_op_cpgen_32},
+      {m68k_op_cpscc_32, &&m68k_op_cpscc_32},
+      {m68k_op_cptrapcc_32, &&m68k_op_cptrapcc_32},
+      {m68k_op_dbt_16, &&m68k_op_dbt_16},
+      {m68k_op_dbf_16, &&m68k_op_dbf_16},
+      {m68k_op_dbhi_16, &&m68k_op_dbhi_16},
+      {m68k_op_dbls_16, &&m68k_op_dbls_16},
+      {m68k_op_dbcc_16, &&m68k_op_dbcc_16},
+      {m68k_op_dbcs_16, &&m68k_op_dbcs_16},
+      {m68k_op_dbne_16, &&m68k_op_dbne_16},
+      {m68k_op_dbeq_16, &&m68k_op_dbeq_16},
+      {m68k_op_dbvc_16, &&m68k_op_dbvc_16},
+      {m68k_op_dbvs_16, &&m68k_op_dbvs_16},
+      {m68k_op_dbpl_16, &&m68k_op_dbpl_16},
+      {m68k_op_dbmi_16, &&m68k_op_dbmi_16},
+      {m68k_op_dbge_16, &&m68k_op_dbge_16},
+      {m68k_op_dblt_16, &&m68k_op_dblt_16},
+      {m68k_op_dbgt_16, &&m68k_op_dbgt_16},
+      {m68k_op_dble_16, &&m68k_op_dble_16},
+      {m68k_op_divs_16_d, &&m68k_op_divs_16_d},
+      {m68k_op_divs_16_ai, &&m68k_op_divs_16_ai},
+      {m68k_op_divs_16_pi, &&m68k_op_divs_16_pi},
+      {m68k_op_divs_16_pd, &&m68k_op_divs_16_pd},
+      {m68k_op_divs_16_di, &&m68k_op_divs_16_di},
+      {m68k_op_divs_16_ix, &&m68k_op_divs_16_ix},
+      {m68k_op_divs_16_aw, &&m68k_op_divs_16_aw},
+      {m68k_op_divs_16_al, &&m68k_op_divs_16_al},
+      {m68k_op_divs_16_pcdi, &&m68k_op_divs_16_pcdi},
+      {m68k_op_divs_16_pcix, &&m68k_op_divs_16_pcix},
+      {m68k_op_divs_16_i, &&m68k_op_divs_16_i},
+      {m68k_op_divu_16_d, &&m68k_op_divu_16_d},
+      {m68k_op_divu_16_ai, &&m68k_op_divu_16_ai},
+      {m68k_op_divu_16_pi, &&m68k_op_divu_16_pi},
+      {m68k_op_divu_16_pd, &&m68k_op_divu_16_pd},
+      {m68k_op_divu_16_di, &&m68k_op_divu_16_di},
+      {m68k_op_divu_16_ix, &&m68k_op_divu_16_ix},
+      {m68k_op_divu_16_aw, &&m68k_op_divu_16_aw},
+      {m68k_op_divu_16_al, &&m68k_op_divu_16_al},
+      {m68k_op_divu_16_pcdi, &&m68k_op_divu_16_pcdi},
+      {m68k_op_divu_16_pcix, &&m68k_op_divu_16_pcix},
+      {m68k_op_divu_16_i, &&m68k_op_divu_16_i},
+      {m68k_op_divl_32_d, &&m68k_op_divl_32_d},
+      {m68k_op_divl_32_ai, &&m68k_op_divl_32_ai},
+      {m68k_op_divl_32_pi, &&m68k_op_divl_32_pi},
+      {m68k_op_divl_32_pd, &&m68k_op_divl_32_pd},
+      {m68k_op_divl_32_di, &&m68k_op_divl_32_di},
+      {m68k_op_divl_32_ix, &&m68k_op_divl_32_ix},
+      {m68k_op_divl_32_aw, &&m68k_op_divl_32_aw},
+      {m68k_op_divl_32_al, &&m68k_op_divl_32_al},
+      {m68k_op_divl_32_pcdi, &&m68k_op_divl_32_pcdi},
+      {m68k_op_divl_32_pcix, &&m68k_op_divl_32_pcix},
+      {m68k_op_divl_32_i, &&m68k_op_divl_32_i},
+      {m68k_op_eor_8_d, &&m68k_op_eor_8_d},
+      {m68k_op_eor_8_ai, &&m68k_op_eor_8_ai},
+      {m68k_op_eor_8_pi, &&m68k_op_eor_8_pi},
+      {m68k_op_eor_8_pi7, &&m68k_op_eor_8_pi7},
+      {m68k_op_eor_8_pd, &&m68k_op_eor_8_pd},
+      {m68k_op_eor_8_pd7, &&m68k_op_eor_8_pd7},
+      {m68k_op_eor_8_di, &&m68k_op_eor_8_di},
+      {m68k_op_eor_8_ix, &&m68k_op_eor_8_ix},
+      {m68k_op_eor_8_aw, &&m68k_op_eor_8_aw},
+      {m68k_op_eor_8_al, &&m68k_op_eor_8_al},
+      {m68k_op_eor_16_d, &&m68k_op_eor_16_d},
+      {m68k_op_eor_16_ai, &&m68k_op_eor_16_ai},
+      {m68k_op_eor_16_pi, &&m68k_op_eor_16_pi},
+      {m68k_op_eor_16_pd, &&m68k_op_eor_16_pd},
+      {m68k_op_eor_16_di, &&m68k_op_eor_16_di},
+      {m68k_op_eor_16_ix, &&m68k_op_eor_16_ix},
+      {m68k_op_eor_16_aw, &&m68k_op_eor_16_aw},
+      {m68k_op_eor_16_al, &&m68k_op_eor_16_al},
+      {m68k_op_eor_32_d, &&m68k_op_eor_32_d},
+      {m68k_op_eor_32_ai, &&m68k_op_eor_32_ai},
+      {m68k_op_eor_32_pi, &&m68k_op_eor_32_pi},
+      {m68k_op_eor_32_pd, &&m68k_op_eor_32_pd},
+      {m68k_op_eor_32_di, &&m68k_op_eor_32_di},
+      {m68k_op_eor_32_ix, &&m68k_op_eor_32_ix},
+      {m68k_op_eor_32_aw, &&m68k_op_eor_32_aw},
+      {m68k_op_eor_32_al, &&m68k_op_eor_32_al},
+      {m68k_op_eori_8_d, &&m68k_op_eori_8_d},
+      {m68k_op_eori_8_ai, &&m68k_op_eori_8_ai},
+      {m68k_op_eori_8_pi, &&m68k_op_eori_8_pi},
+      {m68k_op_eori_8_pi7, &&m68k_op_eori_8_pi7},
+      {m68k_op_eori_8_pd, &&m68k_op_eori_8_pd},
+      {m68k_op_eori_8_pd7, &&m68k_op_eori_8_pd7},
+      {m68k_op_eori_8_di, &&m68k_op_eori_8_di},
+      {m68k_op_eori_8_ix, &&m68k_op_eori_8_ix},
+      {m68k_op_eori_8_aw, &&m68k_op_eori_8_aw},
+      {m68k_op_eori_8_al, &&m68k_op_eori_8_al},
+      {m68k_op_eori_16_d, &&m68k_op_eori_16_d},
+      {m68k_op_eori_16_ai, &&m68k_op_eori_16_ai},
+      {m68k_op_eori_16_pi, &&m68k_op_eori_16_pi},
+      {m68k_op_eori_16_pd, &&m68k_op_eori_16_pd},
+      {m68k_op_eori_16_di, &&m68k_op_eori_16_di},
+      {m68k_op_eori_16_ix, &&m68k_op_eori_16_ix},
+      {m68k_op_eori_16_aw, &&m68k_op_eori_16_aw},
+      {m68k_op_eori_16_al, &&m68k_op_eori_16_al},
+      {m68k_op_eori_32_d, &&m68k_op_eori_32_d},
+      {m68k_op_eori_32_ai, &&m68k_op_eori_32_ai},
+      {m68k_op_eori_32_pi, &&m68k_op_eori_32_pi},
+      {m68k_op_eori_32_pd, &&m68k_op_eori_32_pd},
+      {m68k_op_eori_32_di, &&m68k_op_eori_32_di},
+      {m68k_op_eori_32_ix, &&m68k_op_eori_32_ix},
+      {m68k_op_eori_32_aw, &&m68k_op_eori_32_aw},
+      {m68k_op_eori_32_al, &&m68k_op_eori_32_al},
+      {m68k_op_eori_8_toc, &&m68k_op_eori_8_toc},
+      {m68k_op_eori_16_tos, &&m68k_op_eori_16_tos},
+      {m68k_op_exg_32_dd, &&m68k_op_exg_32_dd},
+      {m68k_op_exg_32_aa, &&m68k_op_exg_32_aa},
+      {m68k_op_exg_32_da, &&m68k_op_exg_32_da},
+      {m68k_op_ext_16, &&m68k_op_ext_16},
+      {m68k_op_ext_32, &&m68k_op_ext_32},
+      {m68k_op_extb_32, &&m68k_op_extb_32},
+      {m68k_op_illegal, &&m68k_op_illegal},
+      {m68k_op_jmp_32_ai, &&m68k_op_jmp_32_ai},
+      {m68k_op_jmp_32_di, &&m68k_op_jmp_32_di},
+      {m68k_op_jmp_32_ix, &&m68k_op_jmp_32_ix},
+      {m68k_op_jmp_32_aw, &&m68k_op_jmp_32_aw},
+      {m68k_op_jmp_32_al, &&m68k_op_jmp_32_al},
+      {m68k_op_jmp_32_pcdi, &&m68k_op_jmp_32_pcdi},
+      {m68k_op_jmp_32_pcix, &&m68k_op_jmp_32_pcix},
+      {m68k_op_jsr_32_ai, &&m68k_op_jsr_32_ai},
+      {m68k_op_jsr_32_di, &&m68k_op_jsr_32_di},
+      {m68k_op_jsr_32_ix, &&m68k_op_jsr_32_ix},
+      {m68k_op_jsr_32_aw, &&m68k_op_jsr_32_aw},
+      {m68k_op_jsr_32_al, &&m68k_op_jsr_32_al},
+      {m68k_op_jsr_32_pcdi, &&m68k_op_jsr_32_pcdi},
+      {m68k_op_jsr_32_pcix, &&m68k_op_jsr_32_pcix},
+      {m68k_op_lea_32_ai, &&m68k_op_lea_32_ai},
+      {m68k_op_lea_32_di, &&m68k_op_lea_32_di},
+      {m68k_op_lea_32_ix, &&m68k_op_lea_32_ix},
+      {m68k_op_lea_32_aw, &&m68k_op_lea_32_aw},
+      {m68k_op_lea_32_al, &&m68k_op_lea_32_al},
+      {m68k_op_lea_32_pcdi, &&m68k_op_lea_32_pcdi},
+      {m68k_op_lea_32_pcix, &&m68k_op_lea_32_pcix},
+      {m68k_op_link_16_a7, &&m68k_op_link_16_a7},
+      {m68k_op_link_16, &&m68k_op_link_16},
+      {m68k_op_link_32_a7, &&m68k_op_link_32_a7},
+      {m68k_op_link_32, &&m68k_op_link_32},
+      {m68k_op_lsr_8_s, &&m68k_op_lsr_8_s},
+      {m68k_op_lsr_16_s, &&m68k_op_lsr_16_s},
+      {m68k_op_lsr_32_s, &&m68k_op_lsr_32_s},
+      {m68k_op_lsr_8_r, &&m68k_op_lsr_8_r},
+      {m68k_op_lsr_16_r, &&m68k_op_lsr_16_r},
+      {m68k_op_lsr_32_r, &&m68k_op_lsr_32_r},
+      {m68k_op_lsr_16_ai, &&m68k_op_lsr_16_ai},
+      {m68k_op_lsr_16_pi, &&m68k_op_lsr_16_pi},
+      {m68k_op_lsr_16_pd, &&m68k_op_lsr_16_pd},
+      {m68k_op_lsr_16_di, &&m68k_op_lsr_16_di},
+      {m68k_op_lsr_16_ix, &&m68k_op_lsr_16_ix},
+      {m68k_op_lsr_16_aw, &&m68k_op_lsr_16_aw},
+      {m68k_op_lsr_16_al, &&m68k_op_lsr_16_al},
+      {m68k_op_lsl_8_s, &&m68k_op_lsl_8_s},
+      {m68k_op_lsl_16_s, &&m68k_op_lsl_16_s},
+      {m68k_op_lsl_32_s, &&m68k_op_lsl_32_s},
+      {m68k_op_lsl_8_r, &&m68k_op_lsl_8_r},
+      {m68k_op_lsl_16_r, &&m68k_op_lsl_16_r},
+      {m68k_op_lsl_32_r, &&m68k_op_lsl_32_r},
+      {m68k_op_lsl_16_ai, &&m68k_op_lsl_16_ai},
+      {m68k_op_lsl_16_pi, &&m68k_op_lsl_16_pi},
+      {m68k_op_lsl_16_pd, &&m68k_op_lsl_16_pd},
+      {m68k_op_lsl_16_di, &&m68k_op_lsl_16_di},
+      {m68k_op_lsl_16_ix, &&m68k_op_lsl_16_ix},
+      {m68k_op_lsl_16_aw, &&m68k_op_lsl_16_aw},
+      {m68k_op_lsl_16_al, &&m68k_op_lsl_16_al},
+      {m68k_op_move_8_d_d, &&m68k_op_move_8_d_d},
+      {m68k_op_move_8_d_ai, &&m68k_op_move_8_d_ai},
+      {m68k_op_move_8_d_pi, &&m68k_op_move_8_d_pi},
+      {m68k_op_move_8_d_pi7, &&m68k_op_move_8_d_pi7},
+      {m68k_op_move_8_d_pd, &&m68k_op_move_8_d_pd},
+      {m68k_op_move_8_d_pd7, &&m68k_op_move_8_d_pd7},
+      {m68k_op_move_8_d_di, &&m68k_op_move_8_d_di},
+      {m68k_op_move_8_d_ix, &&m68k_op_move_8_d_ix},
+      {m68k_op_move_8_d_aw, &&m68k_op_move_8_d_aw},
+      {m68k_op_move_8_d_al, &&m68k_op_move_8_d_al},
+      {m68k_op_move_8_d_pcdi, &&m68k_op_move_8_d_pcdi},
+      {m68k_op_move_8_d_pcix, &&m68k_op_move_8_d_pcix},
+      {m68k_op_move_8_d_i, &&m68k_op_move_8_d_i},
+      {m68k_op_move_8_ai_d, &&m68k_op_move_8_ai_d},
+      {m68k_op_move_8_ai_ai, &&m68k_op_move_8_ai_ai},
+      {m68k_op_move_8_ai_pi, &&m68k_op_move_8_ai_pi},
+      {m68k_op_move_8_ai_pi7, &&m68k_op_move_8_ai_pi7},
+      {m68k_op_move_8_ai_pd, &&m68k_op_move_8_ai_pd},
+      {m68k_op_move_8_ai_pd7, &&m68k_op_move_8_ai_pd7},
+      {m68k_op_move_8_ai_di, &&m68k_op_move_8_ai_di},
+      {m68k_op_move_8_ai_ix, &&m68k_op_move_8_ai_ix},
+      {m68k_op_move_8_ai_aw, &&m68k_op_move_8_ai_aw},
+      {m68k_op_move_8_ai_al, &&m68k_op_move_8_ai_al},
+      {m68k_op_move_8_ai_pcdi, &&m68k_op_move_8_ai_pcdi},
+      {m68k_op_move_8_ai_pcix, &&m68k_op_move_8_ai_pcix},
+      {m68k_op_move_8_ai_i, &&m68k_op_move_8_ai_i},
+      {m68k_op_move_8_pi7_d, &&m68k_op_move_8_pi7_d},
+      {m68k_op_move_8_pi_d, &&m68k_op_move_8_pi_d},
+      {m68k_op_move_8_pi7_ai, &&m68k_op_move_8_pi7_ai},
+      {m68k_op_move_8_pi7_pi, &&m68k_op_move_8_pi7_pi},
+      {m68k_op_move_8_pi7_pi7, &&m68k_op_move_8_pi7_pi7},
+      {m68k_op_move_8_pi7_pd, &&m68k_op_move_8_pi7_pd},
+      {m68k_op_move_8_pi7_pd7, &&m68k_op_move_8_pi7_pd7},
+      {m68k_op_move_8_pi7_di, &&m68k_op_move_8_pi7_di},
+      {m68k_op_move_8_pi7_ix, &&m68k_op_move_8_pi7_ix},
+      {m68k_op_move_8_pi7_aw, &&m68k_op_move_8_pi7_aw},
+      {m68k_op_move_8_pi7_al, &&m68k_op_move_8_pi7_al},
+      {m68k_op_move_8_pi7_pcdi, &&m68k_op_move_8_pi7_pcdi},
+      {m68k_op_move_8_pi7_pcix, &&m68k_op_move_8_pi7_pcix},
+      {m68k_op_move_8_pi7_i, &&m68k_op_move_8_pi7_i},
+      {m68k_op_move_8_pi_ai, &&m68k_op_move_8_pi_ai},
+      {m68k_op_move_8_pi_pi, &&m68k_op_move_8_pi_pi},
+      {m68k_op_move_8_pi_pi7, &&m68k_op_move_8_pi_pi7},
+      {m68k_op_move_8_pi_pd, &&m68k_op_move_8_pi_pd},
+      {m68k_op_move_8_pi_pd7, &&m68k_op_move_8_pi_pd7},
+      {m68k_op_move_8_pi_di, &&m68k_op_move_8_pi_di},
+      {m68k_op_move_8_pi_ix, &&m68k_op_move_8_pi_ix},
+      {m68k_op_move_8_pi_aw, &&m68k_op_move_8_pi_aw},
+      {m68k_op_move_8_pi_al, &&m68k_op_move_8_pi_al},
+      {m68k_op_move_8_pi_pcdi, &&m68k_op_move_8_pi_pcdi},
+      {m68k_op_move_8_pi_pcix, &&m68k_op_move_8_pi_pcix},
+      {m68k_op_move_8_pi_i, &&m68k_op_move_8_pi_i},
+      {m68k_op_move_8_pd7_d, &&m68k_op_move_8_pd7_d},
+      {m68k_op_move_8_pd_d, &&m68k_op_move_8_pd_d},
+      {m68k_op_move_8_pd7_ai, &&m68k_op_move_8_pd7_ai},
+      {m68k_op_move_8_pd7_pi, &&m68k_op_move_8_pd7_pi},
+      {m68k_op_move_8_pd7_pi7, &&m68k_op_move_8_pd7_pi7},
+      {m68k_op_move_8_pd7_pd, &&m68k_op_move_8_pd7_pd},
+      {m68k_op_move_8_pd7_pd7, &&m68k_op_move_8_pd7_pd7},
+      {m68k_op_move_8_pd7_di, &&m68k_op_move_8_pd7_di},
+      {m68k_op_move_8_pd7_ix, &&m68k_op_move_8_pd7_ix},
+      {m68k_op_move_8_pd7_aw, &&m68k_op_move_8_pd7_aw},
+      {m68k_op_move_8_pd7_al, &&m68k_op_move_8_pd7_al},
+      {m68k_op_move_8_pd7_pcdi, &&m68k_op_move_8_pd7_pcdi},
+      {m68k_op_move_8_pd7_pcix, &&m68k_op_move_8_pd7_pcix},
+      {m68k_op_move_8_pd7_i, &&m68k_op_move_8_pd7_i},
+      {m68k_op_move_8_pd_ai, &&m68k_op_move_8_pd_ai},
+      {m68k_op_move_8_pd_pi, &&m68k_op_move_8_pd_pi},
+      {m68k_op_move_8_pd_pi7, &&m68k_op_move_8_pd_pi7},
+      {m68k_op_move_8_pd_pd, &&m68k_op_move_8_pd_pd},
+      {m68k_op_move_8_pd_pd7, &&m68k_op_move_8_pd_pd7},
+      {m68k_op_move_8_pd_di, &&m68k_op_move_8_pd_di},
+      {m68k_op_move_8_pd_ix, &&m68k_op_move_8_pd_ix},
+      {m68k_op_move_8_pd_aw, &&m68k_op_move_8_pd_aw},
+      {m68k_op_move_8_pd_al, &&m68k_op_move_8_pd_al},
+      {m68k_op_move_8_pd_pcdi, &&m68k_op_move_8_pd_pcdi},
+      {m68k_op_move_8_pd_pcix, &&m68k_op_move_8_pd_pcix},
+      {m68k_op_move_8_pd_i, &&m68k_op_move_8_pd_i},
+      {m68k_op_move_8_di_d, &&m68k_op_move_8_di_d},
+      {m68k_op_move_8_di_ai, &&m68k_op_move_8_di_ai},
+      {m68k_op_move_8_di_pi, &&m68k_op_move_8_di_pi},
+      {m68k_op_move_8_di_pi7, &&m68k_op_move_8_di_pi7},
+      {m68k_op_move_8_di_pd, &&m68k_op_move_8_di_pd},
+      {m68k_op_move_8_di_pd7, &&m68k_op_move_8_di_pd7},
+      {m68k_op_move_8_di_di, &&m68k_op_move_8_di_di},
+      {m68k_op_move_8_di_ix, &&m68k_op_move_8_di_ix},
+      {m68k_op_move_8_di_aw, &&m68k_op_move_8_di_aw},
+      {m68k_op_move_8_di_al, &&m68k_op_move_8_di_al},
+      {m68k_op_move_8_di_pcdi, &&m68k_op_move_8_di_pcdi},
+      {m68k_op_move_8_di_pcix, &&m68k_op_move_8_di_pcix},
+      {m68k_op_move_8_di_i, &&m68k_op_move_8_di_i},
+      {m68k_op_move_8_ix_d, &&m68k_op_move_8_ix_d},
+      {m68k_op_move_8_ix_ai, &&m68k_op_move_8_ix_ai},
+      {m68k_op_move_8_ix_pi, &&m68k_op_move_8_ix_pi},
+      {m68k_op_move_8_ix_pi7, &&m68k_op_move_8_ix_pi7},
+      {m68k_op_move_8_ix_pd, &&m68k_op_move_8_ix_pd},
+      {m68k_op_move_8_ix_pd7, &&m68k_op_move_8_ix_pd7},
+      {m68k_op_move_8_ix_di, &&m68k_op_move_8_ix_di},
+      {m68k_op_move_8_ix_ix, &&m68k_op_move_8_ix_ix},
+      {m68k_op_move_8_ix_aw, &&m68k_op_move_8_ix_aw},
+      {m68k_op_move_8_ix_al, &&m68k_op_move_8_ix_al},
+      {m68k_op_move_8_ix_pcdi, &&m68k_op_move_8_ix_pcdi},
+      {m68k_op_move_8_ix_pcix, &&m68k_op_move_8_ix_pcix},
+      {m68k_op_move_8_ix_i, &&m68k_op_move_8_ix_i},
+      {m68k_op_move_8_aw_d, &&m68k_op_move_8_aw_d},
+      {m68k_op_move_8_aw_ai, &&m68k_op_move_8_aw_ai},
+      {m68k_op_move_8_aw_pi, &&m68k_op_move_8_aw_pi},
+      {m68k_op_move_8_aw_pi7, &&m68k_op_move_8_aw_pi7},
+      {m68k_op_move_8_aw_pd, &&m68k_op_move_8_aw_pd},
+      {m68k_op_move_8_aw_pd7, &&m68k_op_move_8_aw_pd7},
+      {m68k_op_move_8_aw_di, &&m68k_op_move_8_aw_di},
+      {m68k_op_move_8_aw_ix, &&m68k_op_move_8_aw_ix},
+      {m68k_op_move_8_aw_aw, &&m68k_op_move_8_aw_aw},
+      {m68k_op_move_8_aw_al, &&m68k_op_move_8_aw_al},
+      {m68k_op_move_8_aw_pcdi, &&m68k_op_move_8_aw_pcdi},
+      {m68k_op_move_8_aw_pcix, &&m68k_op_move_8_aw_pcix},
+      {m68k_op_move_8_aw_i, &&m68k_op_move_8_aw_i},
+      {m68k_op_move_8_al_d, &&m68k_op_move_8_al_d},
+      {m68k_op_move_8_al_ai, &&m68k_op_move_8_al_ai},
+      {m68k_op_move_8_al_pi, &&m68k_op_move_8_al_pi},
+      {m68k_op_move_8_al_pi7, &&m68k_op_move_8_al_pi7},
+      {m68k_op_move_8_al_pd, &&m68k_op_move_8_al_pd},
+      {m68k_op_move_8_al_pd7, &&m68k_op_move_8_al_pd7},
+      {m68k_op_move_8_al_di, &&m68k_op_move_8_al_di},
+      {m68k_op_move_8_al_ix, &&m68k_op_move_8_al_ix},
+      {m68k_op_move_8_al_aw, &&m68k_op_move_8_al_aw},
+      {m68k_op_move_8_al_al, &&m68k_op_move_8_al_al},
+      {m68k_op_move_8_al_pcdi, &&m68k_op_move_8_al_pcdi},
+      {m68k_op_move_8_al_pcix, &&m68k_op_move_8_al_pcix},
+      {m68k_op_move_8_al_i, &&m68k_op_move_8_al_i},
+      {m68k_op_move_16_d_d, &&m68k_op_move_16_d_d},
+      {m68k_op_move_16_d_a, &&m68k_op_move_16_d_a},
+      {m68k_op_move_16_d_ai, &&m68k_op_move_16_d_ai},
+      {m68k_op_move_16_d_pi, &&m68k_op_move_16_d_pi},
+      {m68k_op_move_16_d_pd, &&m68k_op_move_16_d_pd},
+      {m68k_op_move_16_d_di, &&m68k_op_move_16_d_di},
+      {m68k_op_move_16_d_ix, &&m68k_op_move_16_d_ix},
+      {m68k_op_move_16_d_aw, &&m68k_op_move_16_d_aw},
+      {m68k_op_move_16_d_al, &&m68k_op_move_16_d_al},
+      {m68k_op_move_16_d_pcdi, &&m68k_op_move_16_d_pcdi},
+      {m68k_op_move_16_d_pcix, &&m68k_op_move_16_d_pcix},
+      {m68k_op_move_16_d_i, &&m68k_op_move_16_d_i},
+      {m68k_op_move_16_ai_d, &&m68k_op_move_16_ai_d},
+      {m68k_op_move_16_ai_a, &&m68k_op_move_16_ai_a},
+      {m68k_op_move_16_ai_ai, &&m68k_op_move_16_ai_ai},
+      {m68k_op_move_16_ai_pi, &&m68k_op_move_16_ai_pi},
+      {m68k_op_move_16_ai_pd, &&m68k_op_move_16_ai_pd},
+      {m68k_op_move_16_ai_di, &&m68k_op_move_16_ai_di},
+      {m68k_op_move_16_ai_ix, &&m68k_op_move_16_ai_ix},
+      {m68k_op_move_16_ai_aw, &&m68k_op_move_16_ai_aw},
+      {m68k_op_move_16_ai_al, &&m68k_op_move_16_ai_al},
+      {m68k_op_move_16_ai_pcdi, &&m68k_op_move_16_ai_pcdi},
+      {m68k_op_move_16_ai_pcix, &&m68k_op_move_16_ai_pcix},
+      {m68k_op_move_16_ai_i, &&m68k_op_move_16_ai_i},
+      {m68k_op_move_16_pi_d, &&m68k_op_move_16_pi_d},
+      {m68k_op_move_16_pi_a, &&m68k_op_move_16_pi_a},
+      {m68k_op_move_16_pi_ai, &&m68k_op_move_16_pi_ai},
+      {m68k_op_move_16_pi_pi, &&m68k_op_move_16_pi_pi},
+      {m68k_op_move_16_pi_pd, &&m68k_op_move_16_pi_pd},
+      {m68k_op_move_16_pi_di, &&m68k_op_move_16_pi_di},
+      {m68k_op_move_16_pi_ix, &&m68k_op_move_16_pi_ix},
+      {m68k_op_move_16_pi_aw, &&m68k_op_move_16_pi_aw},
+      {m68k_op_move_16_pi_al, &&m68k_op_move_16_pi_al},
+      {m68k_op_move_16_pi_pcdi, &&m68k_op_move_16_pi_pcdi},
+      {m68k_op_move_16_pi_pcix, &&m68k_op_move_16_pi_pcix},
+      {m68k_op_move_16_pi_i, &&m68k_op_move_16_pi_i},
+      {m68k_op_move_16_pd_d, &&m68k_op_move_16_pd_d},
+      {m68k_op_move_16_pd_a, &&m68k_op_move_16_pd_a},
+      {m68k_op_move_16_pd_ai, &&m68k_op_move_16_pd_ai},
+      {m68k_op_move_16_pd_pi, &&m68k_op_move_16_pd_pi},
+      {m68k_op_move_16_pd_pd, &&m68k_op_move_16_pd_pd},
+      {m68k_op_move_16_pd_di, &&m68k_op_move_16_pd_di},
+      {m68k_op_move_16_pd_ix, &&m68k_op_move_16_pd_ix},
+      {m68k_op_move_16_pd_aw, &&m68k_op_move_16_pd_aw},
+      {m68k_op_move_16_pd_al, &&m68k_op_move_16_pd_al},
+      {m68k_op_move_16_pd_pcdi, &&m68k_op_move_16_pd_pcdi},
+      {m68k_op_move_16_pd_pcix, &&m68k_op_move_16_pd_pcix},
+      {m68k_op_move_16_pd_i, &&m68k_op_move_16_pd_i},
+      {m68k_op_move_16_di_d, &&m68k_op_move_16_di_d},
+      {m68k_op_move_16_di_a, &&m68k_op_move_16_di_a},
+      {m68k_op_move_16_di_ai, &&m68k_op_move_16_di_ai},
+      {m68k_op_move_16_di_pi, &&m68k_op_move_16_di_pi},
+      {m68k_op_move_16_di_pd, &&m68k_op_move_16_di_pd},
+      {m68k_op_move_16_di_di, &&m68k_op_move_16_di_di},
+      {m68k_op_move_16_di_ix, &&m68k_op_move_16_di_ix},
+      {m68k_op_move_16_di_aw, &&m68k_op_move_16_di_aw},
+      {m68k_op_move_16_di_al, &&m68k_op_move_16_di_al},
+      {m68k_op_move_16_di_pcdi, &&m68k_op_move_16_di_pcdi},
+      {m68k_op_move_16_di_pcix, &&m68k_op_move_16_di_pcix},
+      {m68k_op_move_16_di_i, &&m68k_op_move_16_di_i},
+      {m68k_op_move_16_ix_d, &&m68k_op_move_16_ix_d},
+      {m68k_op_move_16_ix_a, &&m68k_op_move_16_ix_a},
+      {m68k_op_move_16_ix_ai, &&m68k_op_move_16_ix_ai},
+      {m68k_op_move_16_ix_pi, &&m68k_op_move_16_ix_pi},
+      {m68k_op_move_16_ix_pd, &&m68k_op_move_16_ix_pd},
+      {m68k_op_move_16_ix_di, &&m68k_op_move_16_ix_di},
+      {m68k_op_move_16_ix_ix, &&m68k_op_move_16_ix_ix},
+      {m68k_op_move_16_ix_aw, &&m68k_op_move_16_ix_aw},
+      {m68k_op_move_16_ix_al, &&m68k_op_move_16_ix_al},
+      {m68k_op_move_16_ix_pcdi, &&m68k_op_move_16_ix_pcdi},
+      {m68k_op_move_16_ix_pcix, &&m68k_op_move_16_ix_pcix},
+      {m68k_op_move_16_ix_i, &&m68k_op_move_16_ix_i},
+      {m68k_op_move_16_aw_d, &&m68k_op_move_16_aw_d},
+      {m68k_op_move_16_aw_a, &&m68k_op_move_16_aw_a},
+      {m68k_op_move_16_aw_ai, &&m68k_op_move_16_aw_ai},
+      {m68k_op_move_16_aw_pi, &&m68k_op_move_16_aw_pi},
+      {m68k_op_move_16_aw_pd, &&m68k_op_move_16_aw_pd},
+      {m68k_op_move_16_aw_di, &&m68k_op_move_16_aw_di},
+      {m68k_op_move_16_aw_ix, &&m68k_op_move_16_aw_ix},
+      {m68k_op_move_16_aw_aw, &&m68k_op_move_16_aw_aw},
+      {m68k_op_move_16_aw_al, &&m68k_op_move_16_aw_al},
+      {m68k_op_move_16_aw_pcdi, &&m68k_op_move_16_aw_pcdi},
+      {m68k_op_move_16_aw_pcix, &&m68k_op_move_16_aw_pcix},
+      {m68k_op_move_16_aw_i, &&m68k_op_move_16_aw_i},
+      {m68k_op_move_16_al_d, &&m68k_op_move_16_al_d},
+      {m68k_op_move_16_al_a, &&m68k_op_move_16_al_a},
+      {m68k_op_move_16_al_ai, &&m68k_op_move_16_al_ai},
+      {m68k_op_move_16_al_pi, &&m68k_op_move_16_al_pi},
+      {m68k_op_move_16_al_pd, &&m68k_op_move_16_al_pd},
+      {m68k_op_move_16_al_di, &&m68k_op_move_16_al_di},
+      {m68k_op_move_16_al_ix, &&m68k_op_move_16_al_ix},
+      {m68k_op_move_16_al_aw, &&m68k_op_move_16_al_aw},
+      {m68k_op_move_16_al_al, &&m68k_op_move_16_al_al},
+      {m68k_op_move_16_al_pcdi, &&m68k_op_move_16_al_pcdi},
+      {m68k_op_move_16_al_pcix, &&m68k_op_move_16_al_pcix},
+      {m68k_op_move_16_al_i, &&m68k_op_move_16_al_i},
+      {m68k_op_move_32_d_d, &&m68k_op_move_32_d_d},
+      {m68k_op_move_32_d_a, &&m68k_op_move_32_d_a},
+      {m68k_op_move_32_d_ai, &&m68k_op_move_32_d_ai},
+      {m68k_op_move_32_d_pi, &&m68k_op_move_32_d_pi},
+      {m68k_op_move_32_d_pd, &&m68k_op_move_32_d_pd},
+      {m68k_op_move_32_d_di, &&m68k_op_move_32_d_di},
+      {m68k_op_move_32_d_ix, &&m68k_op_move_32_d_ix},
+      {m68k_op_move_32_d_aw, &&m68k_op_move_32_d_aw},
+      {m68k_op_move_32_d_al, &&m68k_op_move_32_d_al},
+      {m68k_op_move_32_d_pcdi, &&m68k_op_move_32_d_pcdi},
+      {m68k_op_move_32_d_pcix, &&m68k_op_move_32_d_pcix},
+      {m68k_op_move_32_d_i, &&m68k_op_move_32_d_i},
+      {m68k_op_move_32_ai_d, &&m68k_op_move_32_ai_d},
+      {m68k_op_move_32_ai_a, &&m68k_op_move_32_ai_a},
+      {m68k_op_move_32_ai_ai, &&m68k_op_move_32_ai_ai},
+      {m68k_op_move_32_ai_pi, &&m68k_op_move_32_ai_pi},
+      {m68k_op_move_32_ai_pd, &&m68k_op_move_32_ai_pd},
+      {m68k_op_move_32_ai_di, &&m68k_op_move_32_ai_di},
+      {m68k_op_move_32_ai_ix, &&m68k_op_move_32_ai_ix},
+      {m68k_op_move_32_ai_aw, &&m68k_op_move_32_ai_aw},
+      {m68k_op_move_32_ai_al, &&m68k_op_move_32_ai_al},
+      {m68k_op_move_32_ai_pcdi, &&m68k_op_move_32_ai_pcdi},
+      {m68k_op_move_32_ai_pcix, &&m68k_op_move_32_ai_pcix},
+      {m68k_op_move_32_ai_i, &&m68k_op_move_32_ai_i},
+      {m68k_op_move_32_pi_d, &&m68k_op_move_32_pi_d},
+      {m68k_op_move_32_pi_a, &&m68k_op_move_32_pi_a},
+      {m68k_op_move_32_pi_ai, &&m68k_op_move_32_pi_ai},
+      {m68k_op_move_32_pi_pi, &&m68k_op_move_32_pi_pi},
+      {m68k_op_move_32_pi_pd, &&m68k_op_move_32_pi_pd},
+      {m68k_op_move_32_pi_di, &&m68k_op_move_32_pi_di},
+      {m68k_op_move_32_pi_ix, &&m68k_op_move_32_pi_ix},
+      {m68k_op_move_32_pi_aw, &&m68k_op_move_32_pi_aw},
+      {m68k_op_move_32_pi_al, &&m68k_op_move_32_pi_al},
+      {m68k_op_move_32_pi_pcdi, &&m68k_op_move_32_pi_pcdi},
+      {m68k_op_move_32_pi_pcix, &&m68k_op_move_32_pi_pcix},
+      {m68k_op_move_32_pi_i, &&m68k_op_move_32_pi_i},
+      {m68k_op_move_32_pd_d, &&m68k_op_move_32_pd_d},
+      {m68k_op_move_32_pd_a, &&m68k_op_move_32_pd_a},
+      {m68k_op_move_32_pd_ai, &&m68k_op_move_32_pd_ai},
+      {m68k_op_move_32_pd_pi, &&m68k_op_move_32_pd_pi},
+      {m68k_op_move_32_pd_pd, &&m68k_op_move_32_pd_pd},
+      {m68k_op_move_32_pd_di, &&m68k_op_move_32_pd_di},
+      {m68k_op_move_32_pd_ix, &&m68k_op_move_32_pd_ix},
+      {m68k_op_move_32_pd_aw, &&m68k_op_move_32_pd_aw},
+      {m68k_op_move_32_pd_al, &&m68k_op_move_32_pd_al},
+      {m68k_op_move_32_pd_pcdi, &&m68k_op_move_32_pd_pcdi},
+      {m68k_op_move_32_pd_pcix, &&m68k_op_move_32_pd_pcix},
+      {m68k_op_move_32_pd_i, &&m68k_op_move_32_pd_i},
+      {m68k_op_move_32_di_d, &&m68k_op_move_32_di_d},
+      {m68k_op_move_32_di_a, &&m68k_op_move_32_di_a},
+      {m68k_op_move_32_di_ai, &&m68k_op_move_32_di_ai},
+      {m68k_op_move_32_di_pi, &&m68k_op_move_32_di_pi},
+      {m68k_op_move_32_di_pd, &&m68k_op_move_32_di_pd},
+      {m68k_op_move_32_di_di, &&m68k_op_move_32_di_di},
+      {m68k_op_move_32_di_ix, &&m68k_op_move_32_di_ix},
+      {m68k_op_move_32_di_aw, &&m68k_op_move_32_di_aw},
+      {m68k_op_move_32_di_al, &&m68k_op_move_32_di_al},
+      {m68k_op_move_32_di_pcdi, &&m68k_op_move_32_di_pcdi},
+      {m68k_op_move_32_di_pcix, &&m68k_op_move_32_di_pcix},
+      {m68k_op_move_32_di_i, &&m68k_op_move_32_di_i},
+      {m68k_op_move_32_ix_d, &&m68k_op_move_32_ix_d},
+      {m68k_op_move_32_ix_a, &&m68k_op_move_32_ix_a},
+      {m68k_op_move_32_ix_ai, &&m68k_op_move_32_ix_ai},
+      {m68k_op_move_32_ix_pi, &&m68k_op_move_32_ix_pi},
+      {m68k_op_move_32_ix_pd, &&m68k_op_move_32_ix_pd},
+      {m68k_op_move_32_ix_di, &&m68k_op_move_32_ix_di},
+      {m68k_op_move_32_ix_ix, &&m68k_op_move_32_ix_ix},
+      {m68k_op_move_32_ix_aw, &&m68k_op_move_32_ix_aw},
+      {m68k_op_move_32_ix_al, &&m68k_op_move_32_ix_al},
+      {m68k_op_move_32_ix_pcdi, &&m68k_op_move_32_ix_pcdi},
+      {m68k_op_move_32_ix_pcix, &&m68k_op_move_32_ix_pcix},
+      {m68k_op_move_32_ix_i, &&m68k_op_move_32_ix_i},
+      {m68k_op_move_32_aw_d, &&m68k_op_move_32_aw_d},
+      {m68k_op_move_32_aw_a, &&m68k_op_move_32_aw_a},
+      {m68k_op_move_32_aw_ai, &&m68k_op_move_32_aw_ai},
+      {m68k_op_move_32_aw_pi, &&m68k_op_move_32_aw_pi},
+      {m68k_op_move_32_aw_pd, &&m68k_op_move_32_aw_pd},
+      {m68k_op_move_32_aw_di, &&m68k_op_move_32_aw_di},
+      {m68k_op_move_32_aw_ix, &&m68k_op_move_32_aw_ix},
+      {m68k_op_move_32_aw_aw, &&m68k_op_move_32_aw_aw},
+      {m68k_op_move_32_aw_al, &&m68k_op_move_32_aw_al},
+      {m68k_op_move_32_aw_pcdi, &&m68k_op_move_32_aw_pcdi},
+      {m68k_op_move_32_aw_pcix, &&m68k_op_move_32_aw_pcix},
+      {m68k_op_move_32_aw_i, &&m68k_op_move_32_aw_i},
+      {m68k_op_move_32_al_d, &&m68k_op_move_32_al_d},
+      {m68k_op_move_32_al_a, &&m68k_op_move_32_al_a},
+      {m68k_op_move_32_al_ai, &&m68k_op_move_32_al_ai},
+      {m68k_op_move_32_al_pi, &&m68k_op_move_32_al_pi},
+      {m68k_op_move_32_al_pd, &&m68k_op_move_32_al_pd},
+      {m68k_op_move_32_al_di, &&m68k_op_move_32_al_di},
+      {m68k_op_move_32_al_ix, &&m68k_op_move_32_al_ix},
+      {m68k_op_move_32_al_aw, &&m68k_op_move_32_al_aw},
+      {m68k_op_move_32_al_al, &&m68k_op_move_32_al_al},
+      {m68k_op_move_32_al_pcdi, &&m68k_op_move_32_al_pcdi},
+      {m68k_op_move_32_al_pcix, &&m68k_op_move_32_al_pcix},
+      {m68k_op_move_32_al_i, &&m68k_op_move_32_al_i},
+      {m68k_op_movea_16_d, &&m68k_op_movea_16_d},
+      {m68k_op_movea_16_a, &&m68k_op_movea_16_a},
+      {m68k_op_movea_16_ai, &&m68k_op_movea_16_ai},
+      {m68k_op_movea_16_pi, &&m68k_op_movea_16_pi},
+      {m68k_op_movea_16_pd, &&m68k_op_movea_16_pd},
+      {m68k_op_movea_16_di, &&m68k_op_movea_16_di},
+      {m68k_op_movea_16_ix, &&m68k_op_movea_16_ix},
+      {m68k_op_movea_16_aw, &&m68k_op_movea_16_aw},
+      {m68k_op_movea_16_al, &&m68k_op_movea_16_al},
+      {m68k_op_movea_16_pcdi, &&m68k_op_movea_16_pcdi},
+      {m68k_op_movea_16_pcix, &&m68k_op_movea_16_pcix},
+      {m68k_op_movea_16_i, &&m68k_op_movea_16_i},
+      {m68k_op_movea_32_d, &&m68k_op_movea_32_d},
+      {m68k_op_movea_32_a, &&m68k_op_movea_32_a},
+      {m68k_op_movea_32_ai, &&m68k_op_movea_32_ai},
+      {m68k_op_movea_32_pi, &&m68k_op_movea_32_pi},
+      {m68k_op_movea_32_pd, &&m68k_op_movea_32_pd},
+      {m68k_op_movea_32_di, &&m68k_op_movea_32_di},
+      {m68k_op_movea_32_ix, &&m68k_op_movea_32_ix},
+      {m68k_op_movea_32_aw, &&m68k_op_movea_32_aw},
+      {m68k_op_movea_32_al, &&m68k_op_movea_32_al},
+      {m68k_op_movea_32_pcdi, &&m68k_op_movea_32_pcdi},
+      {m68k_op_movea_32_pcix, &&m68k_op_movea_32_pcix},
+      {m68k_op_movea_32_i, &&m68k_op_movea_32_i},
+      {m68k_op_move_16_frc_d, &&m68k_op_move_16_frc_d},
+      {m68k_op_move_16_frc_ai, &&m68k_op_move_16_frc_ai},
+      {m68k_op_move_16_frc_pi, &&m68k_op_move_16_frc_pi},
+      {m68k_op_move_16_frc_pd, &&m68k_op_move_16_frc_pd},
+      {m68k_op_move_16_frc_di, &&m68k_op_move_16_frc_di},
+      {m68k_op_move_16_frc_ix, &&m68k_op_move_16_frc_ix},
+      {m68k_op_move_16_frc_aw, &&m68k_op_move_16_frc_aw},
+      {m68k_op_move_16_frc_al, &&m68k_op_move_16_frc_al},
+      {m68k_op_move_16_toc_d, &&m68k_op_move_16_toc_d},
+      {m68k_op_move_16_toc_ai, &&m68k_op_move_16_toc_ai},
+      {m68k_op_move_16_toc_pi, &&m68k_op_move_16_toc_pi},
+      {m68k_op_move_16_toc_pd, &&m68k_op_move_16_toc_pd},
+      {m68k_op_move_16_toc_di, &&m68k_op_move_16_toc_di},
+      {m68k_op_move_16_toc_ix, &&m68k_op_move_16_toc_ix},
+      {m68k_op_move_16_toc_aw, &&m68k_op_move_16_toc_aw},
+      {m68k_op_move_16_toc_al, &&m68k_op_move_16_toc_al},
+      {m68k_op_move_16_toc_pcdi, &&m68k_op_move_16_toc_pcdi},
+      {m68k_op_move_16_toc_pcix, &&m68k_op_move_16_toc_pcix},
+      {m68k_op_move_16_toc_i, &&m68k_op_move_16_toc_i},
+      {m68k_op_move_16_frs_d, &&m68k_op_move_16_frs_d},
+      {m68k_op_move_16_frs_ai, &&m68k_op_move_16_frs_ai},
+      {m68k_op_move_16_frs_pi, &&m68k_op_move_16_frs_pi},
+      {m68k_op_move_16_frs_pd, &&m68k_op_move_16_frs_pd},
+      {m68k_op_move_16_frs_di, &&m68k_op_move_16_frs_di},
+      {m68k_op_move_16_frs_ix, &&m68k_op_move_16_frs_ix},
+      {m68k_op_move_16_frs_aw, &&m68k_op_move_16_frs_aw},
+      {m68k_op_move_16_frs_al, &&m68k_op_move_16_frs_al},
+      {m68k_op_move_16_tos_d, &&m68k_op_move_16_tos_d},
+      {m68k_op_move_16_tos_ai, &&m68k_op_move_16_tos_ai},
+      {m68k_op_move_16_tos_pi, &&m68k_op_move_16_tos_pi},
+      {m68k_op_move_16_tos_pd, &&m68k_op_move_16_tos_pd},
+      {m68k_op_move_16_tos_di, &&m68k_op_move_16_tos_di},
+      {m68k_op_move_16_tos_ix, &&m68k_op_move_16_tos_ix},
+      {m68k_op_move_16_tos_aw, &&m68k_op_move_16_tos_aw},
+      {m68k_op_move_16_tos_al, &&m68k_op_move_16_tos_al},
+      {m68k_op_move_16_tos_pcdi, &&m68k_op_move_16_tos_pcdi},
+      {m68k_op_move_16_tos_pcix, &&m68k_op_move_16_tos_pcix},
+      {m68k_op_move_16_tos_i, &&m68k_op_move_16_tos_i},
+      {m68k_op_move_32_fru, &&m68k_op_move_32_fru},
+      {m68k_op_move_32_tou, &&m68k_op_move_32_tou},
+      {m68k_op_movec_32_cr, &&m68k_op_movec_32_cr},
+      {m68k_op_movec_32_rc, &&m68k_op_movec_32_rc},
+      {m68k_op_movem_16_re_pd, &&m68k_op_movem_16_re_pd},
+      {m68k_op_movem_16_re_ai, &&m68k_op_movem_16_re_ai},
+      {m68k_op_movem_16_re_di, &&m68k_op_movem_16_re_di},
+      {m68k_op_movem_16_re_ix, &&m68k_op_movem_16_re_ix},
+      {m68k_op_movem_16_re_aw, &&m68k_op_movem_16_re_aw},
+      {m68k_op_movem_16_re_al, &&m68k_op_movem_16_re_al},
+      {m68k_op_movem_32_re_pd, &&m68k_op_movem_32_re_pd},
+      {m68k_op_movem_32_re_ai, &&m68k_op_movem_32_re_ai},
+      {m68k_op_movem_32_re_di, &&m68k_op_movem_32_re_di},
+      {m68k_op_movem_32_re_ix, &&m68k_op_movem_32_re_ix},
+      {m68k_op_movem_32_re_aw, &&m68k_op_movem_32_re_aw},
+      {m68k_op_movem_32_re_al, &&m68k_op_movem_32_re_al},
+      {m68k_op_movem_16_er_pi, &&m68k_op_movem_16_er_pi},
+      {m68k_op_movem_16_er_pcdi, &&m68k_op_movem_16_er_pcdi},
+      {m68k_op_movem_16_er_pcix, &&m68k_op_movem_16_er_pcix},
+      {m68k_op_movem_16_er_ai, &&m68k_op_movem_16_er_ai},
+      {m68k_op_movem_16_er_di, &&m68k_op_movem_16_er_di},
+      {m68k_op_movem_16_er_ix, &&m68k_op_movem_16_er_ix},
+      {m68k_op_movem_16_er_aw, &&m68k_op_movem_16_er_aw},
+      {m68k_op_movem_16_er_al, &&m68k_op_movem_16_er_al},
+      {m68k_op_movem_32_er_pi, &&m68k_op_movem_32_er_pi},
+      {m68k_op_movem_32_er_pcdi, &&m68k_op_movem_32_er_pcdi},
+      {m68k_op_movem_32_er_pcix, &&m68k_op_movem_32_er_pcix},
+      {m68k_op_movem_32_er_ai, &&m68k_op_movem_32_er_ai},
+      {m68k_op_movem_32_er_di, &&m68k_op_movem_32_er_di},
+      {m68k_op_movem_32_er_ix, &&m68k_op_movem_32_er_ix},
+      {m68k_op_movem_32_er_aw, &&m68k_op_movem_32_er_aw},
+      {m68k_op_movem_32_er_al, &&m68k_op_movem_32_er_al},
+      {m68k_op_movep_16_re, &&m68k_op_movep_16_re},
+      {m68k_op_movep_32_re, &&m68k_op_movep_32_re},
+      {m68k_op_movep_16_er, &&m68k_op_movep_16_er},
+      {m68k_op_movep_32_er, &&m68k_op_movep_32_er},
+      {m68k_op_moves_8_ai, &&m68k_op_moves_8_ai},
+      {m68k_op_moves_8_pi, &&m68k_op_moves_8_pi},
+      {m68k_op_moves_8_pi7, &&m68k_op_moves_8_pi7},
+      {m68k_op_moves_8_pd, &&m68k_op_moves_8_pd},
+      {m68k_op_moves_8_pd7, &&m68k_op_moves_8_pd7},
+      {m68k_op_moves_8_di, &&m68k_op_moves_8_di},
+      {m68k_op_moves_8_ix, &&m68k_op_moves_8_ix},
+      {m68k_op_moves_8_aw, &&m68k_op_moves_8_aw},
+      {m68k_op_moves_8_al, &&m68k_op_moves_8_al},
+      {m68k_op_moves_16_ai, &&m68k_op_moves_16_ai},
+      {m68k_op_moves_16_pi, &&m68k_op_moves_16_pi},
+      {m68k_op_moves_16_pd, &&m68k_op_moves_16_pd},
+      {m68k_op_moves_16_di, &&m68k_op_moves_16_di},
+      {m68k_op_moves_16_ix, &&m68k_op_moves_16_ix},
+      {m68k_op_moves_16_aw, &&m68k_op_moves_16_aw},
+      {m68k_op_moves_16_al, &&m68k_op_moves_16_al},
+      {m68k_op_moves_32_ai, &&m68k_op_moves_32_ai},
+      {m68k_op_moves_32_pi, &&m68k_op_moves_32_pi},
+      {m68k_op_moves_32_pd, &&m68k_op_moves_32_pd},
+      {m68k_op_moves_32_di, &&m68k_op_moves_32_di},
+      {m68k_op_moves_32_ix, &&m68k_op_moves_32_ix},
+      {m68k_op_moves_32_aw, &&m68k_op_moves_32_aw},
+      {m68k_op_moves_32_al, &&m68k_op_moves_32_al},
+      {m68k_op_moveq_32, &&m68k_op_moveq_32},
+      {m68k_op_muls_16_d, &&m68k_op_muls_16_d},
+      {m68k_op_muls_16_ai, &&m68k_op_muls_16_ai},
+      {m68k_op_muls_16_pi, &&m68k_op_muls_16_pi},
+      {m68k_op_muls_16_pd, &&m68k_op_muls_16_pd},
+      {m68k_op_muls_16_di, &&m68k_op_muls_16_di},
+      {m68k_op_muls_16_ix, &&m68k_op_muls_16_ix},
+      {m68k_op_muls_16_aw, &&m68k_op_muls_16_aw},
+      {m68k_op_muls_16_al, &&m68k_op_muls_16_al},
+      {m68k_op_muls_16_pcdi, &&m68k_op_muls_16_pcdi},
+      {m68k_op_muls_16_pcix, &&m68k_op_muls_16_pcix},
+      {m68k_op_muls_16_i, &&m68k_op_muls_16_i},
+      {m68k_op_mulu_16_d, &&m68k_op_mulu_16_d},
+      {m68k_op_mulu_16_ai, &&m68k_op_mulu_16_ai},
+      {m68k_op_mulu_16_pi, &&m68k_op_mulu_16_pi},
+      {m68k_op_mulu_16_pd, &&m68k_op_mulu_16_pd},
+      {m68k_op_mulu_16_di, &&m68k_op_mulu_16_di},
+      {m68k_op_mulu_16_ix, &&m68k_op_mulu_16_ix},
+      {m68k_op_mulu_16_aw, &&m68k_op_mulu_16_aw},
+      {m68k_op_mulu_16_al, &&m68k_op_mulu_16_al},
+      {m68k_op_mulu_16_pcdi, &&m68k_op_mulu_16_pcdi},
+      {m68k_op_mulu_16_pcix, &&m68k_op_mulu_16_pcix},
+      {m68k_op_mulu_16_i, &&m68k_op_mulu_16_i},
+      {m68k_op_mull_32_d, &&m68k_op_mull_32_d},
+      {m68k_op_mull_32_ai, &&m68k_op_mull_32_ai},
+      {m68k_op_mull_32_pi, &&m68k_op_mull_32_pi},
+      {m68k_op_mull_32_pd, &&m68k_op_mull_32_pd},
+      {m68k_op_mull_32_di, &&m68k_op_mull_32_di},
+      {m68k_op_mull_32_ix, &&m68k_op_mull_32_ix},
+      {m68k_op_mull_32_aw, &&m68k_op_mull_32_aw},
+      {m68k_op_mull_32_al, &&m68k_op_mull_32_al},
+      {m68k_op_mull_32_pcdi, &&m68k_op_mull_32_pcdi},
+      {m68k_op_mull_32_pcix, &&m68k_op_mull_32_pcix},
+      {m68k_op_mull_32_i, &&m68k_op_mull_32_i},
+      {m68k_op_nbcd_8_d, &&m68k_op_nbcd_8_d},
+      {m68k_op_nbcd_8_ai, &&m68k_op_nbcd_8_ai},
+      {m68k_op_nbcd_8_pi, &&m68k_op_nbcd_8_pi},
+      {m68k_op_nbcd_8_pi7, &&m68k_op_nbcd_8_pi7},
+      {m68k_op_nbcd_8_pd, &&m68k_op_nbcd_8_pd},
+      {m68k_op_nbcd_8_pd7, &&m68k_op_nbcd_8_pd7},
+      {m68k_op_nbcd_8_di, &&m68k_op_nbcd_8_di},
+      {m68k_op_nbcd_8_ix, &&m68k_op_nbcd_8_ix},
+      {m68k_op_nbcd_8_aw, &&m68k_op_nbcd_8_aw},
+      {m68k_op_nbcd_8_al, &&m68k_op_nbcd_8_al},
+      {m68k_op_neg_8_d, &&m68k_op_neg_8_d},
+      {m68k_op_neg_8_ai, &&m68k_op_neg_8_ai},
+      {m68k_op_neg_8_pi, &&m68k_op_neg_8_pi},
+      {m68k_op_neg_8_pi7, &&m68k_op_neg_8_pi7},
+      {m68k_op_neg_8_pd, &&m68k_op_neg_8_pd},
+      {m68k_op_neg_8_pd7, &&m68k_op_neg_8_pd7},
+      {m68k_op_neg_8_di, &&m68k_op_neg_8_di},
+      {m68k_op_neg_8_ix, &&m68k_op_neg_8_ix},
+      {m68k_op_neg_8_aw, &&m68k_op_neg_8_aw},
+      {m68k_op_neg_8_al, &&m68k_op_neg_8_al},
+      {m68k_op_neg_16_d, &&m68k_op_neg_16_d},
+      {m68k_op_neg_16_ai, &&m68k_op_neg_16_ai},
+      {m68k_op_neg_16_pi, &&m68k_op_neg_16_pi},
+      {m68k_op_neg_16_pd, &&m68k_op_neg_16_pd},
+      {m68k_op_neg_16_di, &&m68k_op_neg_16_di},
+      {m68k_op_neg_16_ix, &&m68k_op_neg_16_ix},
+      {m68k_op_neg_16_aw, &&m68k_op_neg_16_aw},
+      {m68k_op_neg_16_al, &&m68k_op_neg_16_al},
+      {m68k_op_neg_32_d, &&m68k_op_neg_32_d},
+      {m68k_op_neg_32_ai, &&m68k_op_neg_32_ai},
+      {m68k_op_neg_32_pi, &&m68k_op_neg_32_pi},
+      {m68k_op_neg_32_pd, &&m68k_op_neg_32_pd},
+      {m68k_op_neg_32_di, &&m68k_op_neg_32_di},
+      {m68k_op_neg_32_ix, &&m68k_op_neg_32_ix},
+      {m68k_op_neg_32_aw, &&m68k_op_neg_32_aw},
+      {m68k_op_neg_32_al, &&m68k_op_neg_32_al},
+      {m68k_op_negx_8_d, &&m68k_op_negx_8_d},
+      {m68k_op_negx_8_ai, &&m68k_op_negx_8_ai},
+      {m68k_op_negx_8_pi, &&m68k_op_negx_8_pi},
+      {m68k_op_negx_8_pi7, &&m68k_op_negx_8_pi7},
+      {m68k_op_negx_8_pd, &&m68k_op_negx_8_pd},
+      {m68k_op_negx_8_pd7, &&m68k_op_negx_8_pd7},
+      {m68k_op_negx_8_di, &&m68k_op_negx_8_di},
+      {m68k_op_negx_8_ix, &&m68k_op_negx_8_ix},
+      {m68k_op_negx_8_aw, &&m68k_op_negx_8_aw},
+      {m68k_op_negx_8_al, &&m68k_op_negx_8_al},
+      {m68k_op_negx_16_d, &&m68k_op_negx_16_d},
+      {m68k_op_negx_16_ai, &&m68k_op_negx_16_ai},
+      {m68k_op_negx_16_pi, &&m68k_op_negx_16_pi},
+      {m68k_op_negx_16_pd, &&m68k_op_negx_16_pd},
+      {m68k_op_negx_16_di, &&m68k_op_negx_16_di},
+      {m68k_op_negx_16_ix, &&m68k_op_negx_16_ix},
+      {m68k_op_negx_16_aw, &&m68k_op_negx_16_aw},
+      {m68k_op_negx_16_al, &&m68k_op_negx_16_al},
+      {m68k_op_negx_32_d, &&m68k_op_negx_32_d},
+      {m68k_op_negx_32_ai, &&m68k_op_negx_32_ai},
+      {m68k_op_negx_32_pi, &&m68k_op_negx_32_pi},
+      {m68k_op_negx_32_pd, &&m68k_op_negx_32_pd},
+      {m68k_op_negx_32_di, &&m68k_op_negx_32_di},
+      {m68k_op_negx_32_ix, &&m68k_op_negx_32_ix},
+      {m68k_op_negx_32_aw, &&m68k_op_negx_32_aw},
+      {m68k_op_negx_32_al, &&m68k_op_negx_32_al},
+      {m68k_op_nop, &&m68k_op_nop},
+      {m68k_op_not_8_d, &&m68k_op_not_8_d},
+      {m68k_op_not_8_ai, &&m68k_op_not_8_ai},
+      {m68k_op_not_8_pi, &&m68k_op_not_8_pi},
+      {m68k_op_not_8_pi7, &&m68k_op_not_8_pi7},
+      {m68k_op_not_8_pd, &&m68k_op_not_8_pd},
+      {m68k_op_not_8_pd7, &&m68k_op_not_8_pd7},
+      {m68k_op_not_8_di, &&m68k_op_not_8_di},
+      {m68k_op_not_8_ix, &&m68k_op_not_8_ix},
+      {m68k_op_not_8_aw, &&m68k_op_not_8_aw},
+      {m68k_op_not_8_al, &&m68k_op_not_8_al},
+      {m68k_op_not_16_d, &&m68k_op_not_16_d},
+      {m68k_op_not_16_ai, &&m68k_op_not_16_ai},
+      {m68k_op_not_16_pi, &&m68k_op_not_16_pi},
+      {m68k_op_not_16_pd, &&m68k_op_not_16_pd},
+      {m68k_op_not_16_di, &&m68k_op_not_16_di},
+      {m68k_op_not_16_ix, &&m68k_op_not_16_ix},
+      {m68k_op_not_16_aw, &&m68k_op_not_16_aw},
+      {m68k_op_not_16_al, &&m68k_op_not_16_al},
+      {m68k_op_not_32_d, &&m68k_op_not_32_d},
+      {m68k_op_not_32_ai, &&m68k_op_not_32_ai},
+      {m68k_op_not_32_pi, &&m68k_op_not_32_pi},
+      {m68k_op_not_32_pd, &&m68k_op_not_32_pd},
+      {m68k_op_not_32_di, &&m68k_op_not_32_di},
+      {m68k_op_not_32_ix, &&m68k_op_not_32_ix},
+      {m68k_op_not_32_aw, &&m68k_op_not_32_aw},
+      {m68k_op_not_32_al, &&m68k_op_not_32_al},
+      {m68k_op_or_8_er_d, &&m68k_op_or_8_er_d},
+      {m68k_op_or_8_er_ai, &&m68k_op_or_8_er_ai},
+      {m68k_op_or_8_er_pi, &&m68k_op_or_8_er_pi},
+      {m68k_op_or_8_er_pi7, &&m68k_op_or_8_er_pi7},
+      {m68k_op_or_8_er_pd, &&m68k_op_or_8_er_pd},
+      {m68k_op_or_8_er_pd7, &&m68k_op_or_8_er_pd7},
+      {m68k_op_or_8_er_di, &&m68k_op_or_8_er_di},
+      {m68k_op_or_8_er_ix, &&m68k_op_or_8_er_ix},
+      {m68k_op_or_8_er_aw, &&m68k_op_or_8_er_aw},
+      {m68k_op_or_8_er_al, &&m68k_op_or_8_er_al},
+      {m68k_op_or_8_er_pcdi, &&m68k_op_or_8_er_pcdi},
+      {m68k_op_or_8_er_pcix, &&m68k_op_or_8_er_pcix},
+      {m68k_op_or_8_er_i, &&m68k_op_or_8_er_i},
+      {m68k_op_or_16_er_d, &&m68k_op_or_16_er_d},
+      {m68k_op_or_16_er_ai, &&m68k_op_or_16_er_ai},
+      {m68k_op_or_16_er_pi, &&m68k_op_or_16_er_pi},
+      {m68k_op_or_16_er_pd, &&m68k_op_or_16_er_pd},
+      {m68k_op_or_16_er_di, &&m68k_op_or_16_er_di},
+      {m68k_op_or_16_er_ix, &&m68k_op_or_16_er_ix},
+      {m68k_op_or_16_er_aw, &&m68k_op_or_16_er_aw},
+      {m68k_op_or_16_er_al, &&m68k_op_or_16_er_al},
+      {m68k_op_or_16_er_pcdi, &&m68k_op_or_16_er_pcdi},
+      {m68k_op_or_16_er_pcix, &&m68k_op_or_16_er_pcix},
+      {m68k_op_or_16_er_i, &&m68k_op_or_16_er_i},
+      {m68k_op_or_32_er_d, &&m68k_op_or_32_er_d},
+      {m68k_op_or_32_er_ai, &&m68k_op_or_32_er_ai},
+      {m68k_op_or_32_er_pi, &&m68k_op_or_32_er_pi},
+      {m68k_op_or_32_er_pd, &&m68k_op_or_32_er_pd},
+      {m68k_op_or_32_er_di, &&m68k_op_or_32_er_di},
+      {m68k_op_or_32_er_ix, &&m68k_op_or_32_er_ix},
+      {m68k_op_or_32_er_aw, &&m68k_op_or_32_er_aw},
+      {m68k_op_or_32_er_al, &&m68k_op_or_32_er_al},
+      {m68k_op_or_32_er_pcdi, &&m68k_op_or_32_er_pcdi},
+      {m68k_op_or_32_er_pcix, &&m68k_op_or_32_er_pcix},
+      {m68k_op_or_32_er_i, &&m68k_op_or_32_er_i},
+      {m68k_op_or_8_re_ai, &&m68k_op_or_8_re_ai},
+      {m68k_op_or_8_re_pi, &&m68k_op_or_8_re_pi},
+      {m68k_op_or_8_re_pi7, &&m68k_op_or_8_re_pi7},
+      {m68k_op_or_8_re_pd, &&m68k_op_or_8_re_pd},
+      {m68k_op_or_8_re_pd7, &&m68k_op_or_8_re_pd7},
+      {m68k_op_or_8_re_di, &&m68k_op_or_8_re_di},
+      {m68k_op_or_8_re_ix, &&m68k_op_or_8_re_ix},
+      {m68k_op_or_8_re_aw, &&m68k_op_or_8_re_aw},
+      {m68k_op_or_8_re_al, &&m68k_op_or_8_re_al},
+      {m68k_op_or_16_re_ai, &&m68k_op_or_16_re_ai},
+      {m68k_op_or_16_re_pi, &&m68k_op_or_16_re_pi},
+      {m68k_op_or_16_re_pd, &&m68k_op_or_16_re_pd},
+      {m68k_op_or_16_re_di, &&m68k_op_or_16_re_di},
+      {m68k_op_or_16_re_ix, &&m68k_op_or_16_re_ix},
+      {m68k_op_or_16_re_aw, &&m68k_op_or_16_re_aw},
+      {m68k_op_or_16_re_al, &&m68k_op_or_16_re_al},
+      {m68k_op_or_32_re_ai, &&m68k_op_or_32_re_ai},
+      {m68k_op_or_32_re_pi, &&m68k_op_or_32_re_pi},
+      {m68k_op_or_32_re_pd, &&m68k_op_or_32_re_pd},
+      {m68k_op_or_32_re_di, &&m68k_op_or_32_re_di},
+      {m68k_op_or_32_re_ix, &&m68k_op_or_32_re_ix},
+      {m68k_op_or_32_re_aw, &&m68k_op_or_32_re_aw},
+      {m68k_op_or_32_re_al, &&m68k_op_or_32_re_al},
+      {m68k_op_ori_8_d, &&m68k_op_ori_8_d},
+      {m68k_op_ori_8_ai, &&m68k_op_ori_8_ai},
+      {m68k_op_ori_8_pi, &&m68k_op_ori_8_pi},
+      {m68k_op_ori_8_pi7, &&m68k_op_ori_8_pi7},
+      {m68k_op_ori_8_pd, &&m68k_op_ori_8_pd},
+      {m68k_op_ori_8_pd7, &&m68k_op_ori_8_pd7},
+      {m68k_op_ori_8_di, &&m68k_op_ori_8_di},
+      {m68k_op_ori_8_ix, &&m68k_op_ori_8_ix},
+      {m68k_op_ori_8_aw, &&m68k_op_ori_8_aw},
+      {m68k_op_ori_8_al, &&m68k_op_ori_8_al},
+      {m68k_op_ori_16_d, &&m68k_op_ori_16_d},
+      {m68k_op_ori_16_ai, &&m68k_op_ori_16_ai},
+      {m68k_op_ori_16_pi, &&m68k_op_ori_16_pi},
+      {m68k_op_ori_16_pd, &&m68k_op_ori_16_pd},
+      {m68k_op_ori_16_di, &&m68k_op_ori_16_di},
+      {m68k_op_ori_16_ix, &&m68k_op_ori_16_ix},
+      {m68k_op_ori_16_aw, &&m68k_op_ori_16_aw},
+      {m68k_op_ori_16_al, &&m68k_op_ori_16_al},
+      {m68k_op_ori_32_d, &&m68k_op_ori_32_d},
+      {m68k_op_ori_32_ai, &&m68k_op_ori_32_ai},
+      {m68k_op_ori_32_pi, &&m68k_op_ori_32_pi},
+      {m68k_op_ori_32_pd, &&m68k_op_ori_32_pd},
+      {m68k_op_ori_32_di, &&m68k_op_ori_32_di},
+      {m68k_op_ori_32_ix, &&m68k_op_ori_32_ix},
+      {m68k_op_ori_32_aw, &&m68k_op_ori_32_aw},
+      {m68k_op_ori_32_al, &&m68k_op_ori_32_al},
+      {m68k_op_ori_8_toc, &&m68k_op_ori_8_toc},
+      {m68k_op_ori_16_tos, &&m68k_op_ori_16_tos},
+      {m68k_op_pack_16_rr, &&m68k_op_pack_16_rr},
+      {m68k_op_pack_16_mm_ax7, &&m68k_op_pack_16_mm_ax7},
+      {m68k_op_pack_16_mm_ay7, &&m68k_op_pack_16_mm_ay7},
+      {m68k_op_pack_16_mm_axy7, &&m68k_op_pack_16_mm_axy7},
+      {m68k_op_pack_16_mm, &&m68k_op_pack_16_mm},
+      {m68k_op_pea_32_ai, &&m68k_op_pea_32_ai},
+      {m68k_op_pea_32_di, &&m68k_op_pea_32_di},
+      {m68k_op_pea_32_ix, &&m68k_op_pea_32_ix},
+      {m68k_op_pea_32_aw, &&m68k_op_pea_32_aw},
+      {m68k_op_pea_32_al, &&m68k_op_pea_32_al},
+      {m68k_op_pea_32_pcdi, &&m68k_op_pea_32_pcdi},
+      {m68k_op_pea_32_pcix, &&m68k_op_pea_32_pcix},
+      {m68k_op_reset, &&m68k_op_reset},
+      {m68k_op_ror_8_s, &&m68k_op_ror_8_s},
+      {m68k_op_ror_16_s, &&m68k_op_ror_16_s},
+      {m68k_op_ror_32_s, &&m68k_op_ror_32_s},
+      {m68k_op_ror_8_r, &&m68k_op_ror_8_r},
+      {m68k_op_ror_16_r, &&m68k_op_ror_16_r},
+      {m68k_op_ror_32_r, &&m68k_op_ror_32_r},
+      {m68k_op_ror_16_ai, &&m68k_op_ror_16_ai},
+      {m68k_op_ror_16_pi, &&m68k_op_ror_16_pi},
+      {m68k_op_ror_16_pd, &&m68k_op_ror_16_pd},
+      {m68k_op_ror_16_di, &&m68k_op_ror_16_di},
+      {m68k_op_ror_16_ix, &&m68k_op_ror_16_ix},
+      {m68k_op_ror_16_aw, &&m68k_op_ror_16_aw},
+      {m68k_op_ror_16_al, &&m68k_op_ror_16_al},
+      {m68k_op_rol_8_s, &&m68k_op_rol_8_s},
+      {m68k_op_rol_16_s, &&m68k_op_rol_16_s},
+      {m68k_op_rol_32_s, &&m68k_op_rol_32_s},
+      {m68k_op_rol_8_r, &&m68k_op_rol_8_r},
+      {m68k_op_rol_16_r, &&m68k_op_rol_16_r},
+      {m68k_op_rol_32_r, &&m68k_op_rol_32_r},
+      {m68k_op_rol_16_ai, &&m68k_op_rol_16_ai},
+      {m68k_op_rol_16_pi, &&m68k_op_rol_16_pi},
+      {m68k_op_rol_16_pd, &&m68k_op_rol_16_pd},
+      {m68k_op_rol_16_di, &&m68k_op_rol_16_di},
+      {m68k_op_rol_16_ix, &&m68k_op_rol_16_ix},
+      {m68k_op_rol_16_aw, &&m68k_op_rol_16_aw},
+      {m68k_op_rol_16_al, &&m68k_op_rol_16_al},
+      {m68k_op_roxr_8_s, &&m68k_op_roxr_8_s},
+      {m68k_op_roxr_16_s, &&m68k_op_roxr_16_s},
+      {m68k_op_roxr_32_s, &&m68k_op_roxr_32_s},
+      {m68k_op_roxr_8_r, &&m68k_op_roxr_8_r},
+      {m68k_op_roxr_16_r, &&m68k_op_roxr_16_r},
+      {m68k_op_roxr_32_r, &&m68k_op_roxr_32_r},
+      {m68k_op_roxr_16_ai, &&m68k_op_roxr_16_ai},
+      {m68k_op_roxr_16_pi, &&m68k_op_roxr_16_pi},
+      {m68k_op_roxr_16_pd, &&m68k_op_roxr_16_pd},
+      {m68k_op_roxr_16_di, &&m68k_op_roxr_16_di},
+      {m68k_op_roxr_16_ix, &&m68k_op_roxr_16_ix},
+      {m68k_op_roxr_16_aw, &&m68k_op_roxr_16_aw},
+      {m68k_op_roxr_16_al, &&m68k_op_roxr_16_al},
+      {m68k_op_roxl_8_s, &&m68k_op_roxl_8_s},
+      {m68k_op_roxl_16_s, &&m68k_op_roxl_16_s},
+      {m68k_op_roxl_32_s, &&m68k_op_roxl_32_s},
+      {m68k_op_roxl_8_r, &&m68k_op_roxl_8_r},
+      {m68k_op_roxl_16_r, &&m68k_op_roxl_16_r},
+      {m68k_op_roxl_32_r, &&m68k_op_roxl_32_r},
+      {m68k_op_roxl_16_ai, &&m68k_op_roxl_16_ai},
+      {m68k_op_roxl_16_pi, &&m68k_op_roxl_16_pi},
+      {m68k_op_roxl_16_pd, &&m68k_op_roxl_16_pd},
+      {m68k_op_roxl_16_di, &&m68k_op_roxl_16_di},
+      {m68k_op_roxl_16_ix, &&m68k_op_roxl_16_ix},
+      {m68k_op_roxl_16_aw, &&m68k_op_roxl_16_aw},
+      {m68k_op_roxl_16_al, &&m68k_op_roxl_16_al},
+      {m68k_op_rtd_32, &&m68k_op_rtd_32},
+      {m68k_op_rte_32, &&m68k_op_rte_32},
+      {m68k_op_rtm_32, &&m68k_op_rtm_32},
+      {m68k_op_rtr_32, &&m68k_op_rtr_32},
+      {m68k_op_rts_32, &&m68k_op_rts_32},
+      {m68k_op_sbcd_8_rr, &&m68k_op_sbcd_8_rr},
+      {m68k_op_sbcd_8_mm_ax7, &&m68k_op_sbcd_8_mm_ax7},
+      {m68k_op_sbcd_8_mm_ay7, &&m68k_op_sbcd_8_mm_ay7},
+      {m68k_op_sbcd_8_mm_axy7, &&m68k_op_sbcd_8_mm_axy7},
+      {m68k_op_sbcd_8_mm, &&m68k_op_sbcd_8_mm},
+      {m68k_op_st_8_d, &&m68k_op_st_8_d},
+      {m68k_op_st_8_ai, &&m68k_op_st_8_ai},
+      {m68k_op_st_8_pi, &&m68k_op_st_8_pi},
+      {m68k_op_st_8_pi7, &&m68k_op_st_8_pi7},
+      {m68k_op_st_8_pd, &&m68k_op_st_8_pd},
+      {m68k_op_st_8_pd7, &&m68k_op_st_8_pd7},
+      {m68k_op_st_8_di, &&m68k_op_st_8_di},
+      {m68k_op_st_8_ix, &&m68k_op_st_8_ix},
+      {m68k_op_st_8_aw, &&m68k_op_st_8_aw},
+      {m68k_op_st_8_al, &&m68k_op_st_8_al},
+      {m68k_op_sf_8_d, &&m68k_op_sf_8_d},
+      {m68k_op_sf_8_ai, &&m68k_op_sf_8_ai},
+      {m68k_op_sf_8_pi, &&m68k_op_sf_8_pi},
+      {m68k_op_sf_8_pi7, &&m68k_op_sf_8_pi7},
+      {m68k_op_sf_8_pd, &&m68k_op_sf_8_pd},
+      {m68k_op_sf_8_pd7, &&m68k_op_sf_8_pd7},
+      {m68k_op_sf_8_di, &&m68k_op_sf_8_di},
+      {m68k_op_sf_8_ix, &&m68k_op_sf_8_ix},
+      {m68k_op_sf_8_aw, &&m68k_op_sf_8_aw},
+      {m68k_op_sf_8_al, &&m68k_op_sf_8_al},
+      {m68k_op_shi_8_d, &&m68k_op_shi_8_d},
+      {m68k_op_sls_8_d, &&m68k_op_sls_8_d},
+      {m68k_op_scc_8_d, &&m68k_op_scc_8_d},
+      {m68k_op_scs_8_d, &&m68k_op_scs_8_d},
+      {m68k_op_sne_8_d, &&m68k_op_sne_8_d},
+      {m68k_op_seq_8_d, &&m68k_op_seq_8_d},
+      {m68k_op_svc_8_d, &&m68k_op_svc_8_d},
+      {m68k_op_svs_8_d, &&m68k_op_svs_8_d},
+      {m68k_op_spl_8_d, &&m68k_op_spl_8_d},
+      {m68k_op_smi_8_d, &&m68k_op_smi_8_d},
+      {m68k_op_sge_8_d, &&m68k_op_sge_8_d},
+      {m68k_op_slt_8_d, &&m68k_op_slt_8_d},
+      {m68k_op_sgt_8_d, &&m68k_op_sgt_8_d},
+      {m68k_op_sle_8_d, &&m68k_op_sle_8_d},
+      {m68k_op_shi_8_ai, &&m68k_op_shi_8_ai},
+      {m68k_op_shi_8_pi, &&m68k_op_shi_8_pi},
+      {m68k_op_shi_8_pi7, &&m68k_op_shi_8_pi7},
+      {m68k_op_shi_8_pd, &&m68k_op_shi_8_pd},
+      {m68k_op_shi_8_pd7, &&m68k_op_shi_8_pd7},
+      {m68k_op_shi_8_di, &&m68k_op_shi_8_di},
+      {m68k_op_shi_8_ix, &&m68k_op_shi_8_ix},
+      {m68k_op_shi_8_aw, &&m68k_op_shi_8_aw},
+      {m68k_op_shi_8_al, &&m68k_op_shi_8_al},
+      {m68k_op_sls_8_ai, &&m68k_op_sls_8_ai},
+      {m68k_op_sls_8_pi, &&m68k_op_sls_8_pi},
+      {m68k_op_sls_8_pi7, &&m68k_op_sls_8_pi7},
+      {m68k_op_sls_8_pd, &&m68k_op_sls_8_pd},
+      {m68k_op_sls_8_pd7, &&m68k_op_sls_8_pd7},
+      {m68k_op_sls_8_di, &&m68k_op_sls_8_di},
+      {m68k_op_sls_8_ix, &&m68k_op_sls_8_ix},
+      {m68k_op_sls_8_aw, &&m68k_op_sls_8_aw},
+      {m68k_op_sls_8_al, &&m68k_op_sls_8_al},
+      {m68k_op_scc_8_ai, &&m68k_op_scc_8_ai},
+      {m68k_op_scc_8_pi, &&m68k_op_scc_8_pi},
+      {m68k_op_scc_8_pi7, &&m68k_op_scc_8_pi7},
+      {m68k_op_scc_8_pd, &&m68k_op_scc_8_pd},
+      {m68k_op_scc_8_pd7, &&m68k_op_scc_8_pd7},
+      {m68k_op_scc_8_di, &&m68k_op_scc_8_di},
+      {m68k_op_scc_8_ix, &&m68k_op_scc_8_ix},
+      {m68k_op_scc_8_aw, &&m68k_op_scc_8_aw},
+      {m68k_op_scc_8_al, &&m68k_op_scc_8_al},
+      {m68k_op_scs_8_ai, &&m68k_op_scs_8_ai},
+      {m68k_op_scs_8_pi, &&m68k_op_scs_8_pi},
+      {m68k_op_scs_8_pi7, &&m68k_op_scs_8_pi7},
+      {m68k_op_scs_8_pd, &&m68k_op_scs_8_pd},
+      {m68k_op_scs_8_pd7, &&m68k_op_scs_8_pd7},
+      {m68k_op_scs_8_di, &&m68k_op_scs_8_di},
+      {m68k_op_scs_8_ix, &&m68k_op_scs_8_ix},
+      {m68k_op_scs_8_aw, &&m68k_op_scs_8_aw},
+      {m68k_op_scs_8_al, &&m68k_op_scs_8_al},
+      {m68k_op_sne_8_ai, &&m68k_op_sne_8_ai},
+      {m68k_op_sne_8_pi, &&m68k_op_sne_8_pi},
+      {m68k_op_sne_8_pi7, &&m68k_op_sne_8_pi7},
+      {m68k_op_sne_8_pd, &&m68k_op_sne_8_pd},
+      {m68k_op_sne_8_pd7, &&m68k_op_sne_8_pd7},
+      {m68k_op_sne_8_di, &&m68k_op_sne_8_di},
+      {m68k_op_sne_8_ix, &&m68k_op_sne_8_ix},
+      {m68k_op_sne_8_aw, &&m68k_op_sne_8_aw},
+      {m68k_op_sne_8_al, &&m68k_op_sne_8_al},
+      {m68k_op_seq_8_ai, &&m68k_op_seq_8_ai},
+      {m68k_op_seq_8_pi, &&m68k_op_seq_8_pi},
+      {m68k_op_seq_8_pi7, &&m68k_op_seq_8_pi7},
+      {m68k_op_seq_8_pd, &&m68k_op_seq_8_pd},
+      {m68k_op_seq_8_pd7, &&m68k_op_seq_8_pd7},
+      {m68k_op_seq_8_di, &&m68k_op_seq_8_di},
+      {m68k_op_seq_8_ix, &&m68k_op_seq_8_ix},
+      {m68k_op_seq_8_aw, &&m68k_op_seq_8_aw},
+      {m68k_op_seq_8_al, &&m68k_op_seq_8_al},
+      {m68k_op_svc_8_ai, &&m68k_op_svc_8_ai},
+      {m68k_op_svc_8_pi, &&m68k_op_svc_8_pi},
+      {m68k_op_svc_8_pi7, &&m68k_op_svc_8_pi7},
+      {m68k_op_svc_8_pd, &&m68k_op_svc_8_pd},
+      {m68k_op_svc_8_pd7, &&m68k_op_svc_8_pd7},
+      {m68k_op_svc_8_di, &&m68k_op_svc_8_di},
+      {m68k_op_svc_8_ix, &&m68k_op_svc_8_ix},
+      {m68k_op_svc_8_aw, &&m68k_op_svc_8_aw},
+      {m68k_op_svc_8_al, &&m68k_op_svc_8_al},
+      {m68k_op_svs_8_ai, &&m68k_op_svs_8_ai},
+      {m68k_op_svs_8_pi, &&m68k_op_svs_8_pi},
+      {m68k_op_svs_8_pi7, &&m68k_op_svs_8_pi7},
+      {m68k_op_svs_8_pd, &&m68k_op_svs_8_pd},
+      {m68k_op_svs_8_pd7, &&m68k_op_svs_8_pd7},
+      {m68k_op_svs_8_di, &&m68k_op_svs_8_di},
+      {m68k_op_svs_8_ix, &&m68k_op_svs_8_ix},
+      {m68k_op_svs_8_aw, &&m68k_op_svs_8_aw},
+      {m68k_op_svs_8_al, &&m68k_op_svs_8_al},
+      {m68k_op_spl_8_ai, &&m68k_op_spl_8_ai},
+      {m68k_op_spl_8_pi, &&m68k_op_spl_8_pi},
+      {m68k_op_spl_8_pi7, &&m68k_op_spl_8_pi7},
+      {m68k_op_spl_8_pd, &&m68k_op_spl_8_pd},
+      {m68k_op_spl_8_pd7, &&m68k_op_spl_8_pd7},
+      {m68k_op_spl_8_di, &&m68k_op_spl_8_di},
+      {m68k_op_spl_8_ix, &&m68k_op_spl_8_ix},
+      {m68k_op_spl_8_aw, &&m68k_op_spl_8_aw},
+      {m68k_op_spl_8_al, &&m68k_op_spl_8_al},
+      {m68k_op_smi_8_ai, &&m68k_op_smi_8_ai},
+      {m68k_op_smi_8_pi, &&m68k_op_smi_8_pi},
+      {m68k_op_smi_8_pi7, &&m68k_op_smi_8_pi7},
+      {m68k_op_smi_8_pd, &&m68k_op_smi_8_pd},
+      {m68k_op_smi_8_pd7, &&m68k_op_smi_8_pd7},
+      {m68k_op_smi_8_di, &&m68k_op_smi_8_di},
+      {m68k_op_smi_8_ix, &&m68k_op_smi_8_ix},
+      {m68k_op_smi_8_aw, &&m68k_op_smi_8_aw},
+      {m68k_op_smi_8_al, &&m68k_op_smi_8_al},
+      {m68k_op_sge_8_ai, &&m68k_op_sge_8_ai},
+      {m68k_op_sge_8_pi, &&m68k_op_sge_8_pi},
+      {m68k_op_sge_8_pi7, &&m68k_op_sge_8_pi7},
+      {m68k_op_sge_8_pd, &&m68k_op_sge_8_pd},
+      {m68k_op_sge_8_pd7, &&m68k_op_sge_8_pd7},
+      {m68k_op_sge_8_di, &&m68k_op_sge_8_di},
+      {m68k_op_sge_8_ix, &&m68k_op_sge_8_ix},
+      {m68k_op_sge_8_aw, &&m68k_op_sge_8_aw},
+      {m68k_op_sge_8_al, &&m68k_op_sge_8_al},
+      {m68k_op_slt_8_ai, &&m68k_op_slt_8_ai},
+      {m68k_op_slt_8_pi, &&m68k_op_slt_8_pi},
+      {m68k_op_slt_8_pi7, &&m68k_op_slt_8_pi7},
+      {m68k_op_slt_8_pd, &&m68k_op_slt_8_pd},
+      {m68k_op_slt_8_pd7, &&m68k_op_slt_8_pd7},
+      {m68k_op_slt_8_di, &&m68k_op_slt_8_di},
+      {m68k_op_slt_8_ix, &&m68k_op_slt_8_ix},
+      {m68k_op_slt_8_aw, &&m68k_op_slt_8_aw},
+      {m68k_op_slt_8_al, &&m68k_op_slt_8_al},
+      {m68k_op_sgt_8_ai, &&m68k_op_sgt_8_ai},
+      {m68k_op_sgt_8_pi, &&m68k_op_sgt_8_pi},
+      {m68k_op_sgt_8_pi7, &&m68k_op_sgt_8_pi7},
+      {m68k_op_sgt_8_pd, &&m68k_op_sgt_8_pd},
+      {m68k_op_sgt_8_pd7, &&m68k_op_sgt_8_pd7},
+      {m68k_op_sgt_8_di, &&m68k_op_sgt_8_di},
+      {m68k_op_sgt_8_ix, &&m68k_op_sgt_8_ix},
+      {m68k_op_sgt_8_aw, &&m68k_op_sgt_8_aw},
+      {m68k_op_sgt_8_al, &&m68k_op_sgt_8_al},
+      {m68k_op_sle_8_ai, &&m68k_op_sle_8_ai},
+      {m68k_op_sle_8_pi, &&m68k_op_sle_8_pi},
+      {m68k_op_sle_8_pi7, &&m68k_op_sle_8_pi7},
+      {m68k_op_sle_8_pd, &&m68k_op_sle_8_pd},
+      {m68k_op_sle_8_pd7, &&m68k_op_sle_8_pd7},
+      {m68k_op_sle_8_di, &&m68k_op_sle_8_di},
+      {m68k_op_sle_8_ix, &&m68k_op_sle_8_ix},
+      {m68k_op_sle_8_aw, &&m68k_op_sle_8_aw},
+      {m68k_op_sle_8_al, &&m68k_op_sle_8_al},
+      {m68k_op_stop, &&m68k_op_stop},
+      {m68k_op_sub_8_er_d, &&m68k_op_sub_8_er_d},
+      {m68k_op_sub_8_er_ai, &&m68k_op_sub_8_er_ai},
+      {m68k_op_sub_8_er_pi, &&m68k_op_sub_8_er_pi},
+      {m68k_op_sub_8_er_pi7, &&m68k_op_sub_8_er_pi7},
+      {m68k_op_sub_8_er_pd, &&m68k_op_sub_8_er_pd},
+      {m68k_op_sub_8_er_pd7, &&m68k_op_sub_8_er_pd7},
+      {m68k_op_sub_8_er_di, &&m68k_op_sub_8_er_di},
+      {m68k_op_sub_8_er_ix, &&m68k_op_sub_8_er_ix},
+      {m68k_op_sub_8_er_aw, &&m68k_op_sub_8_er_aw},
+      {m68k_op_sub_8_er_al, &&m68k_op_sub_8_er_al},
+      {m68k_op_sub_8_er_pcdi, &&m68k_op_sub_8_er_pcdi},
+      {m68k_op_sub_8_er_pcix, &&m68k_op_sub_8_er_pcix},
+      {m68k_op_sub_8_er_i, &&m68k_op_sub_8_er_i},
+      {m68k_op_sub_16_er_d, &&m68k_op_sub_16_er_d},
+      {m68k_op_sub_16_er_a, &&m68k_op_sub_16_er_a},
+      {m68k_op_sub_16_er_ai, &&m68k_op_sub_16_er_ai},
+      {m68k_op_sub_16_er_pi, &&m68k_op_sub_16_er_pi},
+      {m68k_op_sub_16_er_pd, &&m68k_op_sub_16_er_pd},
+      {m68k_op_sub_16_er_di, &&m68k_op_sub_16_er_di},
+      {m68k_op_sub_16_er_ix, &&m68k_op_sub_16_er_ix},
+      {m68k_op_sub_16_er_aw, &&m68k_op_sub_16_er_aw},
+      {m68k_op_sub_16_er_al, &&m68k_op_sub_16_er_al},
+      {m68k_op_sub_16_er_pcdi, &&m68k_op_sub_16_er_pcdi},
+      {m68k_op_sub_16_er_pcix, &&m68k_op_sub_16_er_pcix},
+      {m68k_op_sub_16_er_i, &&m68k_op_sub_16_er_i},
+      {m68k_op_sub_32_er_d, &&m68k_op_sub_32_er_d},
+      {m68k_op_sub_32_er_a, &&m68k_op_sub_32_er_a},
+      {m68k_op_sub_32_er_ai, &&m68k_op_sub_32_er_ai},
+      {m68k_op_sub_32_er_pi, &&m68k_op_sub_32_er_pi},
+      {m68k_op_sub_32_er_pd, &&m68k_op_sub_32_er_pd},
+      {m68k_op_sub_32_er_di, &&m68k_op_sub_32_er_di},
+      {m68k_op_sub_32_er_ix, &&m68k_op_sub_32_er_ix},
+      {m68k_op_sub_32_er_aw, &&m68k_op_sub_32_er_aw},
+      {m68k_op_sub_32_er_al, &&m68k_op_sub_32_er_al},
+      {m68k_op_sub_32_er_pcdi, &&m68k_op_sub_32_er_pcdi},
+      {m68k_op_sub_32_er_pcix, &&m68k_op_sub_32_er_pcix},
+      {m68k_op_sub_32_er_i, &&m68k_op_sub_32_er_i},
+      {m68k_op_sub_8_re_ai, &&m68k_op_sub_8_re_ai},
+      {m68k_op_sub_8_re_pi, &&m68k_op_sub_8_re_pi},
+      {m68k_op_sub_8_re_pi7, &&m68k_op_sub_8_re_pi7},
+      {m68k_op_sub_8_re_pd, &&m68k_op_sub_8_re_pd},
+      {m68k_op_sub_8_re_pd7, &&m68k_op_sub_8_re_pd7},
+      {m68k_op_sub_8_re_di, &&m68k_op_sub_8_re_di},
+      {m68k_op_sub_8_re_ix, &&m68k_op_sub_8_re_ix},
+      {m68k_op_sub_8_re_aw, &&m68k_op_sub_8_re_aw},
+      {m68k_op_sub_8_re_al, &&m68k_op_sub_8_re_al},
+      {m68k_op_sub_16_re_ai, &&m68k_op_sub_16_re_ai},
+      {m68k_op_sub_16_re_pi, &&m68k_op_sub_16_re_pi},
+      {m68k_op_sub_16_re_pd, &&m68k_op_sub_16_re_pd},
+      {m68k_op_sub_16_re_di, &&m68k_op_sub_16_re_di},
+      {m68k_op_sub_16_re_ix, &&m68k_op_sub_16_re_ix},
+      {m68k_op_sub_16_re_aw, &&m68k_op_sub_16_re_aw},
+      {m68k_op_sub_16_re_al, &&m68k_op_sub_16_re_al},
+      {m68k_op_sub_32_re_ai, &&m68k_op_sub_32_re_ai},
+      {m68k_op_sub_32_re_pi, &&m68k_op_sub_32_re_pi},
+      {m68k_op_sub_32_re_pd, &&m68k_op_sub_32_re_pd},
+      {m68k_op_sub_32_re_di, &&m68k_op_sub_32_re_di},
+      {m68k_op_sub_32_re_ix, &&m68k_op_sub_32_re_ix},
+      {m68k_op_sub_32_re_aw, &&m68k_op_sub_32_re_aw},
+      {m68k_op_sub_32_re_al, &&m68k_op_sub_32_re_al},
+      {m68k_op_suba_16_d, &&m68k_op_suba_16_d},
+      {m68k_op_suba_16_a, &&m68k_op_suba_16_a},
+      {m68k_op_suba_16_ai, &&m68k_op_suba_16_ai},
+      {m68k_op_suba_16_pi, &&m68k_op_suba_16_pi},
+      {m68k_op_suba_16_pd, &&m68k_op_suba_16_pd},
+      {m68k_op_suba_16_di, &&m68k_op_suba_16_di},
+      {m68k_op_suba_16_ix, &&m68k_op_suba_16_ix},
+      {m68k_op_suba_16_aw, &&m68k_op_suba_16_aw},
+      {m68k_op_suba_16_al, &&m68k_op_suba_16_al},
+      {m68k_op_suba_16_pcdi, &&m68k_op_suba_16_pcdi},
+      {m68k_op_suba_16_pcix, &&m68k_op_suba_16_pcix},
+      {m68k_op_suba_16_i, &&m68k_op_suba_16_i},
+      {m68k_op_suba_32_d, &&m68k_op_suba_32_d},
+      {m68k_op_suba_32_a, &&m68k_op_suba_32_a},
+      {m68k_op_suba_32_ai, &&m68k_op_suba_32_ai},
+      {m68k_op_suba_32_pi, &&m68k_op_suba_32_pi},
+      {m68k_op_suba_32_pd, &&m68k_op_suba_32_pd},
+      {m68k_op_suba_32_di, &&m68k_op_suba_32_di},
+      {m68k_op_suba_32_ix, &&m68k_op_suba_32_ix},
+      {m68k_op_suba_32_aw, &&m68k_op_suba_32_aw},
+      {m68k_op_suba_32_al, &&m68k_op_suba_32_al},
+      {m68k_op_suba_32_pcdi, &&m68k_op_suba_32_pcdi},
+      {m68k_op_suba_32_pcix, &&m68k_op_suba_32_pcix},
+      {m68k_op_suba_32_i, &&m68k_op_suba_32_i},
+      {m68k_op_subi_8_d, &&m68k_op_subi_8_d},
+      {m68k_op_subi_8_ai, &&m68k_op_subi_8_ai},
+      {m68k_op_subi_8_pi, &&m68k_op_subi_8_pi},
+      {m68k_op_subi_8_pi7, &&m68k_op_subi_8_pi7},
+      {m68k_op_subi_8_pd, &&m68k_op_subi_8_pd},
+      {m68k_op_subi_8_pd7, &&m68k_op_subi_8_pd7},
+      {m68k_op_subi_8_di, &&m68k_op_subi_8_di},
+      {m68k_op_subi_8_ix, &&m68k_op_subi_8_ix},
+      {m68k_op_subi_8_aw, &&m68k_op_subi_8_aw},
+      {m68k_op_subi_8_al, &&m68k_op_subi_8_al},
+      {m68k_op_subi_16_d, &&m68k_op_subi_16_d},
+      {m68k_op_subi_16_ai, &&m68k_op_subi_16_ai},
+      {m68k_op_subi_16_pi, &&m68k_op_subi_16_pi},
+      {m68k_op_subi_16_pd, &&m68k_op_subi_16_pd},
+      {m68k_op_subi_16_di, &&m68k_op_subi_16_di},
+      {m68k_op_subi_16_ix, &&m68k_op_subi_16_ix},
+      {m68k_op_subi_16_aw, &&m68k_op_subi_16_aw},
+      {m68k_op_subi_16_al, &&m68k_op_subi_16_al},
+      {m68k_op_subi_32_d, &&m68k_op_subi_32_d},
+      {m68k_op_subi_32_ai, &&m68k_op_subi_32_ai},
+      {m68k_op_subi_32_pi, &&m68k_op_subi_32_pi},
+      {m68k_op_subi_32_pd, &&m68k_op_subi_32_pd},
+      {m68k_op_subi_32_di, &&m68k_op_subi_32_di},
+      {m68k_op_subi_32_ix, &&m68k_op_subi_32_ix},
+      {m68k_op_subi_32_aw, &&m68k_op_subi_32_aw},
+      {m68k_op_subi_32_al, &&m68k_op_subi_32_al},
+      {m68k_op_subq_8_d, &&m68k_op_subq_8_d},
+      {m68k_op_subq_8_ai, &&m68k_op_subq_8_ai},
+      {m68k_op_subq_8_pi, &&m68k_op_subq_8_pi},
+      {m68k_op_subq_8_pi7, &&m68k_op_subq_8_pi7},
+      {m68k_op_subq_8_pd, &&m68k_op_subq_8_pd},
+      {m68k_op_subq_8_pd7, &&m68k_op_subq_8_pd7},
+      {m68k_op_subq_8_di, &&m68k_op_subq_8_di},
+      {m68k_op_subq_8_ix, &&m68k_op_subq_8_ix},
+      {m68k_op_subq_8_aw, &&m68k_op_subq_8_aw},
+      {m68k_op_subq_8_al, &&m68k_op_subq_8_al},
+      {m68k_op_subq_16_d, &&m68k_op_subq_16_d},
+      {m68k_op_subq_16_a, &&m68k_op_subq_16_a},
+      {m68k_op_subq_16_ai, &&m68k_op_subq_16_ai},
+      {m68k_op_subq_16_pi, &&m68k_op_subq_16_pi},
+      {m68k_op_subq_16_pd, &&m68k_op_subq_16_pd},
+      {m68k_op_subq_16_di, &&m68k_op_subq_16_di},
+      {m68k_op_subq_16_ix, &&m68k_op_subq_16_ix},
+      {m68k_op_subq_16_aw, &&m68k_op_subq_16_aw},
+      {m68k_op_subq_16_al, &&m68k_op_subq_16_al},
+      {m68k_op_subq_32_d, &&m68k_op_subq_32_d},
+      {m68k_op_subq_32_a, &&m68k_op_subq_32_a},
+      {m68k_op_subq_32_ai, &&m68k_op_subq_32_ai},
+      {m68k_op_subq_32_pi, &&m68k_op_subq_32_pi},
+      {m68k_op_subq_32_pd, &&m68k_op_subq_32_pd},
+      {m68k_op_subq_32_di, &&m68k_op_subq_32_di},
+      {m68k_op_subq_32_ix, &&m68k_op_subq_32_ix},
+      {m68k_op_subq_32_aw, &&m68k_op_subq_32_aw},
+      {m68k_op_subq_32_al, &&m68k_op_subq_32_al},
+      {m68k_op_subx_8_rr, &&m68k_op_subx_8_rr},
+      {m68k_op_subx_16_rr, &&m68k_op_subx_16_rr},
+      {m68k_op_subx_32_rr, &&m68k_op_subx_32_rr},
+      {m68k_op_subx_8_mm_ax7, &&m68k_op_subx_8_mm_ax7},
+      {m68k_op_subx_8_mm_ay7, &&m68k_op_subx_8_mm_ay7},
+      {m68k_op_subx_8_mm_axy7, &&m68k_op_subx_8_mm_axy7},
+      {m68k_op_subx_8_mm, &&m68k_op_subx_8_mm},
+      {m68k_op_subx_16_mm, &&m68k_op_subx_16_mm},
+      {m68k_op_subx_32_mm, &&m68k_op_subx_32_mm},
+      {m68k_op_swap_32, &&m68k_op_swap_32},
+      {m68k_op_tas_8_d, &&m68k_op_tas_8_d},
+      {m68k_op_tas_8_ai, &&m68k_op_tas_8_ai},
+      {m68k_op_tas_8_pi, &&m68k_op_tas_8_pi},
+      {m68k_op_tas_8_pi7, &&m68k_op_tas_8_pi7},
+      {m68k_op_tas_8_pd, &&m68k_op_tas_8_pd},
+      {m68k_op_tas_8_pd7, &&m68k_op_tas_8_pd7},
+      {m68k_op_tas_8_di, &&m68k_op_tas_8_di},
+      {m68k_op_tas_8_ix, &&m68k_op_tas_8_ix},
+      {m68k_op_tas_8_aw, &&m68k_op_tas_8_aw},
+      {m68k_op_tas_8_al, &&m68k_op_tas_8_al},
+      {m68k_op_trap, &&m68k_op_trap},
+      {m68k_op_trapt, &&m68k_op_trapt},
+      {m68k_op_trapt_16, &&m68k_op_trapt_16},
+      {m68k_op_trapt_32, &&m68k_op_trapt_32},
+      {m68k_op_trapf, &&m68k_op_trapf},
+      {m68k_op_trapf_16, &&m68k_op_trapf_16},
+      {m68k_op_trapf_32, &&m68k_op_trapf_32},
+      {m68k_op_traphi, &&m68k_op_traphi},
+      {m68k_op_trapls, &&m68k_op_trapls},
+      {m68k_op_trapcc, &&m68k_op_trapcc},
+      {m68k_op_trapcs, &&m68k_op_trapcs},
+      {m68k_op_trapne, &&m68k_op_trapne},
+      {m68k_op_trapeq, &&m68k_op_trapeq},
+      {m68k_op_trapvc, &&m68k_op_trapvc},
+      {m68k_op_trapvs, &&m68k_op_trapvs},
+      {m68k_op_trappl, &&m68k_op_trappl},
+      {m68k_op_trapmi, &&m68k_op_trapmi},
+      {m68k_op_trapge, &&m68k_op_trapge},
+      {m68k_op_traplt, &&m68k_op_traplt},
+      {m68k_op_trapgt, &&m68k_op_trapgt},
+      {m68k_op_traple, &&m68k_op_traple},
+      {m68k_op_traphi_16, &&m68k_op_traphi_16},
+      {m68k_op_trapls_16, &&m68k_op_trapls_16},
+      {m68k_op_trapcc_16, &&m68k_op_trapcc_16},
+      {m68k_op_trapcs_16, &&m68k_op_trapcs_16},
+      {m68k_op_trapne_16, &&m68k_op_trapne_16},
+      {m68k_op_trapeq_16, &&m68k_op_trapeq_16},
+      {m68k_op_trapvc_16, &&m68k_op_trapvc_16},
+      {m68k_op_trapvs_16, &&m68k_op_trapvs_16},
+      {m68k_op_trappl_16, &&m68k_op_trappl_16},
+      {m68k_op_trapmi_16, &&m68k_op_trapmi_16},
+      {m68k_op_trapge_16, &&m68k_op_trapge_16},
+      {m68k_op_traplt_16, &&m68k_op_traplt_16},
+      {m68k_op_trapgt_16, &&m68k_op_trapgt_16},
+      {m68k_op_traple_16, &&m68k_op_traple_16},
+      {m68k_op_traphi_32, &&m68k_op_traphi_32},
+      {m68k_op_trapls_32, &&m68k_op_trapls_32},
+      {m68k_op_trapcc_32, &&m68k_op_trapcc_32},
+      {m68k_op_trapcs_32, &&m68k_op_trapcs_32},
+      {m68k_op_trapne_32, &&m68k_op_trapne_32},
+      {m68k_op_trapeq_32, &&m68k_op_trapeq_32},
+      {m68k_op_trapvc_32, &&m68k_op_trapvc_32},
+      {m68k_op_trapvs_32, &&m68k_op_trapvs_32},
+      {m68k_op_trappl_32, &&m68k_op_trappl_32},
+      {m68k_op_trapmi_32, &&m68k_op_trapmi_32},
+      {m68k_op_trapge_32, &&m68k_op_trapge_32},
+      {m68k_op_traplt_32, &&m68k_op_traplt_32},
+      {m68k_op_trapgt_32, &&m68k_op_trapgt_32},
+      {m68k_op_traple_32, &&m68k_op_traple_32},
+      {m68k_op_trapv, &&m68k_op_trapv},
+      {m68k_op_tst_8_d, &&m68k_op_tst_8_d},
+      {m68k_op_tst_8_ai, &&m68k_op_tst_8_ai},
+      {m68k_op_tst_8_pi, &&m68k_op_tst_8_pi},
+      {m68k_op_tst_8_pi7, &&m68k_op_tst_8_pi7},
+      {m68k_op_tst_8_pd, &&m68k_op_tst_8_pd},
+      {m68k_op_tst_8_pd7, &&m68k_op_tst_8_pd7},
+      {m68k_op_tst_8_di, &&m68k_op_tst_8_di},
+      {m68k_op_tst_8_ix, &&m68k_op_tst_8_ix},
+      {m68k_op_tst_8_aw, &&m68k_op_tst_8_aw},
+      {m68k_op_tst_8_al, &&m68k_op_tst_8_al},
+      {m68k_op_tst_8_pcdi, &&m68k_op_tst_8_pcdi},
+      {m68k_op_tst_8_pcix, &&m68k_op_tst_8_pcix},
+      {m68k_op_tst_8_i, &&m68k_op_tst_8_i},
+      {m68k_op_tst_16_d, &&m68k_op_tst_16_d},
+      {m68k_op_tst_16_a, &&m68k_op_tst_16_a},
+      {m68k_op_tst_16_ai, &&m68k_op_tst_16_ai},
+      {m68k_op_tst_16_pi, &&m68k_op_tst_16_pi},
+      {m68k_op_tst_16_pd, &&m68k_op_tst_16_pd},
+      {m68k_op_tst_16_di, &&m68k_op_tst_16_di},
+      {m68k_op_tst_16_ix, &&m68k_op_tst_16_ix},
+      {m68k_op_tst_16_aw, &&m68k_op_tst_16_aw},
+      {m68k_op_tst_16_al, &&m68k_op_tst_16_al},
+      {m68k_op_tst_16_pcdi, &&m68k_op_tst_16_pcdi},
+      {m68k_op_tst_16_pcix, &&m68k_op_tst_16_pcix},
+      {m68k_op_tst_16_i, &&m68k_op_tst_16_i},
+      {m68k_op_tst_32_d, &&m68k_op_tst_32_d},
+      {m68k_op_tst_32_a, &&m68k_op_tst_32_a},
+      {m68k_op_tst_32_ai, &&m68k_op_tst_32_ai},
+      {m68k_op_tst_32_pi, &&m68k_op_tst_32_pi},
+      {m68k_op_tst_32_pd, &&m68k_op_tst_32_pd},
+      {m68k_op_tst_32_di, &&m68k_op_tst_32_di},
+      {m68k_op_tst_32_ix, &&m68k_op_tst_32_ix},
+      {m68k_op_tst_32_aw, &&m68k_op_tst_32_aw},
+      {m68k_op_tst_32_al, &&m68k_op_tst_32_al},
+      {m68k_op_tst_32_pcdi, &&m68k_op_tst_32_pcdi},
+      {m68k_op_tst_32_pcix, &&m68k_op_tst_32_pcix},
+      {m68k_op_tst_32_i, &&m68k_op_tst_32_i},
+      {m68k_op_unlk_32_a7, &&m68k_op_unlk_32_a7},
+      {m68k_op_unlk_32, &&m68k_op_unlk_32},
+      {m68k_op_unpk_16_rr, &&m68k_op_unpk_16_rr},
+      {m68k_op_unpk_16_mm_ax7, &&m68k_op_unpk_16_mm_ax7},
+      {m68k_op_unpk_16_mm_ay7, &&m68k_op_unpk_16_mm_ay7},
+      {m68k_op_unpk_16_mm_axy7, &&m68k_op_unpk_16_mm_axy7},
+      {m68k_op_unpk_16_mm, &&m68k_op_unpk_16_mm},
+   };
+   static void* m68ki_threaded_jump_table[M68KI_INSTRUCTION_HANDLERS];
+   static int m68ki_threaded_built = 0;
+
+   if(!m68ki_threaded_built)
+   {
+      /* match every handler in m68ki_instruction_handlers[] to its label */
+      uint i;
+
+      qsort(m68ki_threaded_handlers, sizeof(m68ki_threaded_handlers) / sizeof(m68ki_threaded_handlers[0]), sizeof(m68ki_threaded_handler), m68ki_threaded_compare);
+      for(i = 0; i < M68KI_INSTRUCTION_HANDLERS; i++)
+      {
+         m68ki_threaded_handler key;
+         m68ki_threaded_handler* found;
+
+         key.handler = m68ki_instruction_handlers[i];
+         found = bsearch(&key, m68ki_threaded_handlers, sizeof(m68ki_threaded_handlers) / sizeof(m68ki_threaded_handlers[0]), sizeof(m68ki_threaded_handler), m68ki_threaded_compare);
+         m68ki_threaded_jump_table[i] = found ? found->label : &&m68k_op_illegal;
+      }
+      m68ki_threaded_built = 1;
+   }
+
+   M68KI_THREADED_DISPATCH();
+
+m68k_op_1010:
+   {
+      m68ki_exception_1010();
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_1111:
+   {
+      m68ki_exception_1111();
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_abcd_8_rr:
+   {
+      uint* r_dst = &DX;
+      uint src = DY;
+      uint dst = *r_dst;
+      uint res = LOW_NIBBLE(src) + LOW_NIBBLE(dst) + XFLAG_AS_1();
+
+      m68ki_resolve_flags();
+
+      FLAG_V = ~res; /* Undefined V behavior */
+
+      if(res > 9)
+         res += 6;
+      res += HIGH_NIBBLE(src) + HIGH_NIBBLE(dst);
+      FLAG_X = FLAG_C = (res > 0x99) << 8;
+      if(FLAG_C)
+         res -= 0xa0;
+
+      FLAG_V &= res; /* Undefined V behavior part II */
+      FLAG_N = NFLAG_8(res); /* Undefined N behavior */
+
+      res = MASK_OUT_ABOVE_8(res);
+      FLAG_Z |= res;
+
+      *r_dst = MASK_OUT_BELOW_8(*r_dst) | res;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_abcd_8_mm_ax7:
+   {
+      uint src = OPER_AY_PD_8();
+      uint ea  = EA_A7_PD_8();
+      uint dst = m68ki_read_8(ea);
+      uint res = LOW_NIBBLE(src) + LOW_NIBBLE(dst) + XFLAG_AS_1();
+
+      m68ki_resolve_flags();
+
+      FLAG_V = ~res; /* Undefined V behavior */
+
+      if(res > 9)
+         res += 6;
+      res += HIGH_NIBBLE(src) + HIGH_NIBBLE(dst);
+      FLAG_X = FLAG_C = (res > 0x99) << 8;
+      if(FLAG_C)
+         res -= 0xa0;
+
+      FLAG_V &= res; /* Undefined V behavior part II */
+      FLAG_N = NFLAG_8(res); /* Undefined N behavior */
+
+      res = MASK_OUT_ABOVE_8(res);
+      FLAG_Z |= res;
+
+      m68ki_write_8(ea, res);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_abcd_8_mm_ay7:
+   {
+      uint src = OPER_A7_PD_8();
+      uint ea  = EA_AX_PD_8();
+      uint dst = m68ki_read_8(ea);
+      uint res = LOW_NIBBLE(src) + LOW_NIBBLE(dst) + XFLAG_AS_1();
+
+      m68ki_resolve_flags();
+
+      FLAG_V = ~res; /* Undefined V behavior */
+
+      if(res > 9)
+         res += 6;
+      res += HIGH_NIBBLE(src) + HIGH_NIBBLE(dst);
+      FLAG_X = FLAG_C = (res > 0x99) << 8;
+      if(FLAG_C)
+         res -= 0xa0;
+
+      FLAG_V &= res; /* Undefined V behavior part II */
+      FLAG_N = NFLAG_8(res); /* Undefined N behavior */
+
+      res = MASK_OUT_ABOVE_8(res);
+      FLAG_Z |= res;
+
+      m68ki_write_8(ea, res);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_abcd_8_mm_axy7:
+   {
+      uint src = OPER_A7_PD_8();
+      uint ea  = EA_A7_PD_8();
+      uint dst = m68ki_read_8(ea);
+      uint res = LOW_NIBBLE(src) + LOW_NIBBLE(dst) + XFLAG_AS_1();
+
+      m68ki_resolve_flags();
+
+      FLAG_V = ~res; /* Undefined V behavior */
+
+      if(res > 9)
+         res += 6;
+      res += HIGH_NIBBLE(src) + HIGH_NIBBLE(dst);
+      FLAG_X = FLAG_C = (res > 0x99) << 8;
+      if(FLAG_C)
+         res -= 0xa0;
+
+      FLAG_V &= res; /* Undefined V behavior part II */
+      FLAG_N = NFLAG_8(res); /* Undefined N behavior */
+
+      res = MASK_OUT_ABOVE_8(res);
+      FLAG_Z |= res;
+
+      m68ki_write_8(ea, res);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_abcd_8_mm:
+   {
+      uint src = OPER_AY_PD_8();
+      uint ea  = EA_AX_PD_8();
+      uint dst = m68ki_read_8(ea);
+      uint res = LOW_NIBBLE(src) + LOW_NIBBLE(dst) + XFLAG_AS_1();
+
+      m68ki_resolve_flags();
+
+      FLAG_V = ~res; /* Undefined V behavior */
+
+      if(res > 9)
+         res += 6;
+      res += HIGH_NIBBLE(src) + HIGH_NIBBLE(dst);
+      FLAG_X = FLAG_C = (res > 0x99) << 8;
+      if(FLAG_C)
+         res -= 0xa0;
+
+      FLAG_V &= res; /* Undefined V behavior part II */
+      FLAG_N = NFLAG_8(res); /* Undefined N behavior */
+
+      res = MASK_OUT_ABOVE_8(res);
+      FLAG_Z |= res;
+
+      m68ki_write_8(ea, res);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_add_8_er_d:
+   {
+      uint* r_dst = &DX;
+      uint src = MASK_OUT_ABOVE_8(DY);
+      uint dst = MASK_OUT_ABOVE_8(*r_dst);
+      uint res = src + dst;
+
+      m68ki_set_xnzvc_add_8(src, dst, res);
+
+      *r_dst = MASK_OUT_BELOW_8(*r_dst) | MASK_OUT_ABOVE_8(res);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_add_8_er_ai:
+   {
+      uint* r_dst = &DX;
+      uint src = OPER_AY_AI_8();
+      uint dst = MASK_OUT_ABOVE_8(*r_dst);
+      uint res = src + dst;
+
+      m68ki_set_xnzvc_add_8(src, dst, res);
+
+      *r_dst = MASK_OUT_BELOW_8(*r_dst) | MASK_OUT_ABOVE_8(res);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_add_8_er_pi:
+   {
+      uint* r_dst = &DX;
+      uint src = OPER_AY_PI_8();
+      uint dst = MASK_OUT_ABOVE_8(*r_dst);
+      uint res = src + dst;
+
+      m68ki_set_xnzvc_add_8(src, dst, res);
+
+      *r_dst = MASK_OUT_BELOW_8(*r_dst) | MASK_OUT_ABOVE_8(res);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_add_8_er_pi7:
+   {
+      uint* r_dst = &DX;
+      uint src = OPER_A7_PI_8();
+      uint dst = MASK_OUT_ABOVE_8(*r_dst);
+      uint res = src + dst;
+
+      m68ki_set_xnzvc_add_8(src, dst, res);
+
+      *r_dst = MASK_OUT_BELOW_8(*r_dst) | MASK_OUT_ABOVE_8(res);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_add_8_er_pd:
+   {
+      uint* r_dst = &DX;
+      uint src = OPER_AY_PD_8();
+      uint dst = MASK_OUT_ABOVE_8(*r_dst);
+      uint res = src + dst;
+
+      m68ki_set_xnzvc_add_8(src, dst, res);
+
+      *r_dst = MASK_OUT_BELOW_8(*r_dst) | MASK_OUT_ABOVE_8(res);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_add_8_er_pd7:
+   {
+      uint* r_dst = &DX;
+      uint src = OPER_A7_PD_8();
+      uint dst = MASK_OUT_ABOVE_8(*r_dst);
+      uint res = src + dst;
+
+      m68ki_set_xnzvc_add_8(src, dst, res);
+
+      *r_dst = MASK_OUT_BELOW_8(*r_dst) | MASK_OUT_ABOVE_8(res);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_add_8_er_di:
+   {
+      uint* r_dst = &DX;
+      uint src = OPER_AY_DI_8();
+      uint dst = MASK_OUT_ABOVE_8(*r_dst);
+      uint res = src + dst;
+
+      m68ki_set_xnzvc_add_8(src, dst, res);
+
+      *r_dst = MASK_OUT_BELOW_8(*r_dst) | MASK_OUT_ABOVE_8(res);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_add_8_er_ix:
+   {
+      uint* r_dst = &DX;
+      uint src = OPER_AY_IX_8();
+      uint dst = MASK_OUT_ABOVE_8(*r_dst);
+      uint res = src + dst;
+
+      m68ki_set_xnzvc_add_8(src, dst, res);
+
+      *r_dst = MASK_OUT_BELOW_8(*r_dst) | MASK_OUT_ABOVE_8(res);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_add_8_er_aw:
+   {
+      uint* r_dst = &DX;
+      uint src = OPER_AW_8();
+      uint dst = MASK_OUT_ABOVE_8(*r_dst);
+      uint res = src + dst;
+
+      m68ki_set_xnzvc_add_8(src, dst, res);
+
+      *r_dst = MASK_OUT_BELOW_8(*r_dst) | MASK_OUT_ABOVE_8(res);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_add_8_er_al:
+   {
+      uint* r_dst = &DX;
+      uint src = OPER_AL_8();
+      uint dst = MASK_OUT_ABOVE_8(*r_dst);
+      uint res = src + dst;
+
+      m68ki_set_xnzvc_add_8(src, dst, res);
+
+      *r_dst = MASK_OUT_BELOW_8(*r_dst) | MASK_OUT_ABOVE_8(res);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_add_8_er_pcdi:
+   {
+      uint* r_dst = &DX;
+      uint src = OPER_PCDI_8();
+      uint dst = MASK_OUT_ABOVE_8(*r_dst);
+      uint res = src + dst;
+
+      m68ki_set_xnzvc_add_8(src, dst, res);
+
+      *r_dst = MASK_OUT_BELOW_8(*r_dst) | MASK_OUT_ABOVE_8(res);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_add_8_er_pcix:
+   {
+      uint* r_dst = &DX;
+      uint src = OPER_PCIX_8();
+      uint dst = MASK_OUT_ABOVE_8(*r_dst);
+      uint res = src + dst;
+
+      m68ki_set_xnzvc_add_8(src, dst, res);
+
+      *r_dst = MASK_OUT_BELOW_8(*r_dst) | MASK_OUT_ABOVE_8(res);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_add_8_er_i:
+   {
+      uint* r_dst = &DX;
+      uint src = OPER_I_8();
+      uint dst = MASK_OUT_ABOVE_8(*r_dst);
+      uint res = src + dst;
+
+      m68ki_set_xnzvc_add_8(src, dst, res);
+
+      *r_dst = MASK_OUT_BELOW_8(*r_dst) | MASK_OUT_ABOVE_8(res);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_add_16_er_d:
+   {
+      uint* r_dst = &DX;
+      uint src = MASK_OUT_ABOVE_16(DY);
+      uint dst = MASK_OUT_ABOVE_16(*r_dst);
+      uint res = src + dst;
+
+      m68ki_set_xnzvc_add_16(src, dst, res);
+
+      *r_dst = MASK_OUT_BELOW_16(*r_dst) | MASK_OUT_ABOVE_16(res);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_add_16_er_a:
+   {
+      uint* r_dst = &DX;
+      uint src = MASK_OUT_ABOVE_16(AY);
+      uint dst = MASK_OUT_ABOVE_16(*r_dst);
+      uint res = src + dst;
+
+      m68ki_set_xnzvc_add_16(src, dst, res);
+
+      *r_dst = MASK_OUT_BELOW_16(*r_dst) | MASK_OUT_ABOVE_16(res);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_add_16_er_ai:
+   {
+      uint* r_dst = &DX;
+      uint src = OPER_AY_AI_16();
+      uint dst = MASK_OUT_ABOVE_16(*r_dst);
+      uint res = src + dst;
+
+      m68ki_set_xnzvc_add_16(src, dst, res);
+
+      *r_dst = MASK_OUT_BELOW_16(*r_dst) | MASK_OUT_ABOVE_16(res);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_add_16_er_pi:
+   {
+      uint* r_dst = &DX;
+      uint src = OPER_AY_PI_16();
+      uint dst = MASK_OUT_ABOVE_16(*r_dst);
+      uint res = src + dst;
+
+      m68ki_set_xnzvc_add_16(src, dst, res);
+
+      *r_dst = MASK_OUT_BELOW_16(*r_dst) | MASK_OUT_ABOVE_16(res);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_add_16_er_pd:
+   {
+      uint* r_dst = &DX;
+      uint src = OPER_AY_PD_16();
+      uint dst = MASK_OUT_ABOVE_16(*r_dst);
+      uint res = src + dst;
+
+      m68ki_set_xnzvc_add_16(src, dst, res);
+
+      *r_dst = MASK_OUT_BELOW_16(*r_dst) | MASK_OUT_ABOVE_16(res);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_add_16_er_di:
+   {
+      uint* r_dst = &DX;
+      uint src = OPER_AY_DI_16();
+      uint dst = MASK_OUT_ABOVE_16(*r_dst);
+      uint res = src + dst;
+
+      m68ki_set_xnzvc_add_16(src, dst, res);
+
+      *r_dst = MASK_OUT_BELOW_16(*r_dst) | MASK_OUT_ABOVE_16(res);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_add_16_er_ix:
+   {
+      uint* r_dst = &DX;
+      uint src = OPER_AY_IX_16();
+      uint dst = MASK_OUT_ABOVE_16(*r_dst);
+      uint res = src + dst;
+
+      m68ki_set_xnzvc_add_16(src, dst, res);
+
+      *r_dst = MASK_OUT_BELOW_16(*r_dst) | MASK_OUT_ABOVE_16(res);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_add_16_er_aw:
+   {
+      uint* r_dst = &DX;
+      uint src = OPER_AW_16();
+      uint dst = MASK_OUT_ABOVE_16(*r_dst);
+      uint res = src + dst;
+
+      m68ki_set_xnzvc_add_16(src, dst, res);
+
+      *r_dst = MASK_OUT_BELOW_16(*r_dst) | MASK_OUT_ABOVE_16(res);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_add_16_er_al:
+   {
+      uint* r_dst = &DX;
+      uint src = OPER_AL_16();
+      uint dst = MASK_OUT_ABOVE_16(*r_dst);
+      uint res = src + dst;
+
+      m68ki_set_xnzvc_add_16(src, dst, res);
+
+      *r_dst = MASK_OUT_BELOW_16(*r_dst) | MASK_OUT_ABOVE_16(res);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_add_16_er_pcdi:
+   {
+      uint* r_dst = &DX;
+      uint src = OPER_PCDI_16();
+      uint dst = MASK_OUT_ABOVE_16(*r_dst);
+      uint res = src + dst;
+
+      m68ki_set_xnzvc_add_16(src, dst, res);
+
+      *r_dst = MASK_OUT_BELOW_16(*r_dst) | MASK_OUT_ABOVE_16(res);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_add_16_er_pcix:
+   {
+      uint* r_dst = &DX;
+      uint src = OPER_PCIX_16();
+      uint dst = MASK_OUT_ABOVE_16(*r_dst);
+      uint res = src + dst;
+
+      m68ki_set_xnzvc_add_16(src, dst, res);
+
+      *r_dst = MASK_OUT_BELOW_16(*r_dst) | MASK_OUT_ABOVE_16(res);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_add_16_er_i:
+   {
+      uint* r_dst = &DX;
+      uint src = OPER_I_16();
+      uint dst = MASK_OUT_ABOVE_16(*r_dst);
+      uint res = src + dst;
+
+      m68ki_set_xnzvc_add_16(src, dst, res);
+
+      *r_dst = MASK_OUT_BELOW_16(*r_dst) | MASK_OUT_ABOVE_16(res);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_add_32_er_d:
+   {
+      uint* r_dst = &DX;
+      uint src = DY;
+      uint dst = *r_dst;
+      uint res = src + dst;
+
+      m68ki_set_xnzvc_add_32(src, dst, res);
+
+      *r_dst = MASK_OUT_ABOVE_32(res);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_add_32_er_a:
+   {
+      uint* r_dst = &DX;
+      uint src = AY;
+      uint dst = *r_dst;
+      uint res = src + dst;
+
+      m68ki_set_xnzvc_add_32(src, dst, res);
+
+      *r_dst = MASK_OUT_ABOVE_32(res);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_add_32_er_ai:
+   {
+      uint* r_dst = &DX;
+      uint src = OPER_AY_AI_32();
+      uint dst = *r_dst;
+      uint res = src + dst;
+
+      m68ki_set_xnzvc_add_32(src, dst, res);
+
+      *r_dst = MASK_OUT_ABOVE_32(res);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_add_32_er_pi:
+   {
+      uint* r_dst = &DX;
+      uint src = OPER_AY_PI_32();
+      uint dst = *r_dst;
+      uint res = src + dst;
+
+      m68ki_set_xnzvc_add_32(src, dst, res);
+
+      *r_dst = MASK_OUT_ABOVE_32(res);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_add_32_er_pd:
+   {
+      uint* r_dst = &DX;
+      uint src = OPER_AY_PD_32();
+      uint dst = *r_dst;
+      uint res = src + dst;
+
+      m68ki_set_xnzvc_add_32(src, dst, res);
+
+      *r_dst = MASK_OUT_ABOVE_32(res);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_add_32_er_di:
+   {
+      uint* r_dst = &DX;
+      uint src = OPER_AY_DI_32();
+      uint dst = *r_dst;
+      uint res = src + dst;
+
+      m68ki_set_xnzvc_add_32(src, dst, res);
+
+      *r_dst = MASK_OUT_ABOVE_32(res);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_add_32_er_ix:
+   {
+      uint* r_dst = &DX;
+      uint src = OPER_AY_IX_32();
+      uint dst = *r_dst;
+      uint res = src + dst;
+
+      m68ki_set_xnzvc_add_32(src, dst, res);
+
+      *r_dst = MASK_OUT_ABOVE_32(res);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_add_32_er_aw:
+   {
+      uint* r_dst = &DX;
+      uint src = OPER_AW_32();
+      uint dst = *r_dst;
+      uint res = src + dst;
+
+      m68ki_set_xnzvc_add_32(src, dst, res);
+
+      *r_dst = MASK_OUT_ABOVE_32(res);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_add_32_er_al:
+   {
+      uint* r_dst = &DX;
+      uint src = OPER_AL_32();
+      uint dst = *r_dst;
+      uint res = src + dst;
+
+      m68ki_set_xnzvc_add_32(src, dst, res);
+
+      *r_dst = MASK_OUT_ABOVE_32(res);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_add_32_er_pcdi:
+   {
+      uint* r_dst = &DX;
+      uint src = OPER_PCDI_32();
+      uint dst = *r_dst;
+      uint res = src + dst;
+
+      m68ki_set_xnzvc_add_32(src, dst, res);
+
+      *r_dst = MASK_OUT_ABOVE_32(res);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_add_32_er_pcix:
+   {
+      uint* r_dst = &DX;
+      uint src = OPER_PCIX_32();
+      uint dst = *r_dst;
+      uint res = src + dst;
+
+      m68ki_set_xnzvc_add_32(src, dst, res);
+
+      *r_dst = MASK_OUT_ABOVE_32(res);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_add_32_er_i:
+   {
+      uint* r_dst = &DX;
+      uint src = OPER_I_32();
+      uint dst = *r_dst;
+      uint res = src + dst;
+
+      m68ki_set_xnzvc_add_32(src, dst, res);
+
+      *r_dst = MASK_OUT_ABOVE_32(res);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_add_8_re_ai:
+   {
+      uint ea = EA_AY_AI_8();
+      uint src = MASK_OUT_ABOVE_8(DX);
+      uint dst = m68ki_read_8(ea);
+      uint res = src + dst;
+
+      m68ki_set_xnzvc_add_8(src, dst, res);
+
+      m68ki_write_8(ea, MASK_OUT_ABOVE_8(res));
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_add_8_re_pi:
+   {
+      uint ea = EA_AY_PI_8();
+      uint src = MASK_OUT_ABOVE_8(DX);
+      uint dst = m68ki_read_8(ea);
+      uint res = src + dst;
+
+      m68ki_set_xnzvc_add_8(src, dst, res);
+
+      m68ki_write_8(ea, MASK_OUT_ABOVE_8(res));
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_add_8_re_pi7:
+   {
+      uint ea = EA_A7_PI_8();
+      uint src = MASK_OUT_ABOVE_8(DX);
+      uint dst = m68ki_read_8(ea);
+      uint res = src + dst;
+
+      m68ki_set_xnzvc_add_8(src, dst, res);
+
+      m68ki_write_8(ea, MASK_OUT_ABOVE_8(res));
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_add_8_re_pd:
+   {
+      uint ea = EA_AY_PD_8();
+      uint src = MASK_OUT_ABOVE_8(DX);
+      uint dst = m68ki_read_8(ea);
+      uint res = src + dst;
+
+      m68ki_set_xnzvc_add_8(src, dst, res);
+
+      m68ki_write_8(ea, MASK_OUT_ABOVE_8(res));
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_add_8_re_pd7:
+   {
+      uint ea = EA_A7_PD_8();
+      uint src = MASK_OUT_ABOVE_8(DX);
+      uint dst = m68ki_read_8(ea);
+      uint res = src + dst;
+
+      m68ki_set_xnzvc_add_8(src, dst, res);
+
+      m68ki_write_8(ea, MASK_OUT_ABOVE_8(res));
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_add_8_re_di:
+   {
+      uint ea = EA_AY_DI_8();
+      uint src = MASK_OUT_ABOVE_8(DX);
+      uint dst = m68ki_read_8(ea);
+      uint res = src + dst;
+
+      m68ki_set_xnzvc_add_8(src, dst, res);
+
+      m68ki_write_8(ea, MASK_OUT_ABOVE_8(res));
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_add_8_re_ix:
+   {
+      uint ea = EA_AY_IX_8();
+      uint src = MASK_OUT_ABOVE_8(DX);
+      uint dst = m68ki_read_8(ea);
+      uint res = src + dst;
+
+      m68ki_set_xnzvc_add_8(src, dst, res);
+
+      m68ki_write_8(ea, MASK_OUT_ABOVE_8(res));
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_add_8_re_aw:
+   {
+      uint ea = EA_AW_8();
+      uint src = MASK_OUT_ABOVE_8(DX);
+      uint dst = m68ki_read_8(ea);
+      uint res = src + dst;
+
+      m68ki_set_xnzvc_add_8(src, dst, res);
+
+      m68ki_write_8(ea, MASK_OUT_ABOVE_8(res));
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_add_8_re_al:
+   {
+      uint ea = EA_AL_8();
+      uint src = MASK_OUT_ABOVE_8(DX);
+      uint dst = m68ki_read_8(ea);
+      uint res = src + dst;
+
+      m68ki_set_xnzvc_add_8(src, dst, res);
+
+      m68ki_write_8(ea, MASK_OUT_ABOVE_8(res));
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_add_16_re_ai:
+   {
+      uint ea = EA_AY_AI_16();
+      uint src = MASK_OUT_ABOVE_16(DX);
+      uint dst = m68ki_read_16(ea);
+      uint res = src + dst;
+
+      m68ki_set_xnzvc_add_16(src, dst, res);
+
+      m68ki_write_16(ea, MASK_OUT_ABOVE_16(res));
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_add_16_re_pi:
+   {
+      uint ea = EA_AY_PI_16();
+      uint src = MASK_OUT_ABOVE_16(DX);
+      uint dst = m68ki_read_16(ea);
+      uint res = src + dst;
+
+      m68ki_set_xnzvc_add_16(src, dst, res);
+
+      m68ki_write_16(ea, MASK_OUT_ABOVE_16(res));
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_add_16_re_pd:
+   {
+      uint ea = EA_AY_PD_16();
+      uint src = MASK_OUT_ABOVE_16(DX);
+      uint dst = m68ki_read_16(ea);
+      uint res = src + dst;
+
+      m68ki_set_xnzvc_add_16(src, dst, res);
+
+      m68ki_write_16(ea, MASK_OUT_ABOVE_16(res));
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_add_16_re_di:
+   {
+      uint ea = EA_AY_DI_16();
+      uint src = MASK_OUT_ABOVE_16(DX);
+      uint dst = m68ki_read_16(ea);
+      uint res = src + dst;
+
+      m68ki_set_xnzvc_add_16(src, dst, res);
+
+      m68ki_write_16(ea, MASK_OUT_ABOVE_16(res));
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_add_16_re_ix:
+   {
+      uint ea = EA_AY_IX_16();
+      uint src = MASK_OUT_ABOVE_16(DX);
+      uint dst = m68ki_read_16(ea);
+      uint res = src + dst;
+
+      m68ki_set_xnzvc_add_16(src, dst, res);
+
+      m68ki_write_16(ea, MASK_OUT_ABOVE_16(res));
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_add_16_re_aw:
+   {
+      uint ea = EA_AW_16();
+      uint src = MASK_OUT_ABOVE_16(DX);
+      uint dst = m68ki_read_16(ea);
+      uint res = src + dst;
+
+      m68ki_set_xnzvc_add_16(src, dst, res);
+
+      m68ki_write_16(ea, MASK_OUT_ABOVE_16(res));
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_add_16_re_al:
+   {
+      uint ea = EA_AL_16();
+      uint src = MASK_OUT_ABOVE_16(DX);
+      uint dst = m68ki_read_16(ea);
+      uint res = src + dst;
+
+      m68ki_set_xnzvc_add_16(src, dst, res);
+
+      m68ki_write_16(ea, MASK_OUT_ABOVE_16(res));
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_add_32_re_ai:
+   {
+      uint ea = EA_AY_AI_32();
+      uint src = DX;
+      uint dst = m68ki_read_32(ea);
+      uint res = src + dst;
+
+      m68ki_set_xnzvc_add_32(src, dst, res);
+
+      m68ki_write_32(ea, MASK_OUT_ABOVE_32(res));
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_add_32_re_pi:
+   {
+      uint ea = EA_AY_PI_32();
+      uint src = DX;
+      uint dst = m68ki_read_32(ea);
+      uint res = src + dst;
+
+      m68ki_set_xnzvc_add_32(src, dst, res);
+
+      m68ki_write_32(ea, MASK_OUT_ABOVE_32(res));
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_add_32_re_pd:
+   {
+      uint ea = EA_AY_PD_32();
+      uint src = DX;
+      uint dst = m68ki_read_32(ea);
+      uint res = src + dst;
+
+      m68ki_set_xnzvc_add_32(src, dst, res);
+
+      m68ki_write_32(ea, MASK_OUT_ABOVE_32(res));
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_add_32_re_di:
+   {
+      uint ea = EA_AY_DI_32();
+      uint src = DX;
+      uint dst = m68ki_read_32(ea);
+      uint res = src + dst;
+
+      m68ki_set_xnzvc_add_32(src, dst, res);
+
+      m68ki_write_32(ea, MASK_OUT_ABOVE_32(res));
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_add_32_re_ix:
+   {
+      uint ea = EA_AY_IX_32();
+      uint src = DX;
+      uint dst = m68ki_read_32(ea);
+      uint res = src + dst;
+
+      m68ki_set_xnzvc_add_32(src, dst, res);
+
+      m68ki_write_32(ea, MASK_OUT_ABOVE_32(res));
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_add_32_re_aw:
+   {
+      uint ea = EA_AW_32();
+      uint src = DX;
+      uint dst = m68ki_read_32(ea);
+      uint res = src + dst;
+
+      m68ki_set_xnzvc_add_32(src, dst, res);
+
+      m68ki_write_32(ea, MASK_OUT_ABOVE_32(res));
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_add_32_re_al:
+   {
+      uint ea = EA_AL_32();
+      uint src = DX;
+      uint dst = m68ki_read_32(ea);
+      uint res = src + dst;
+
+      m68ki_set_xnzvc_add_32(src, dst, res);
+
+      m68ki_write_32(ea, MASK_OUT_ABOVE_32(res));
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_adda_16_d:
+   {
+      uint* r_dst = &AX;
+
+      *r_dst = MASK_OUT_ABOVE_32(*r_dst + MAKE_INT_16(DY));
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_adda_16_a:
+   {
+      uint* r_dst = &AX;
+
+      *r_dst = MASK_OUT_ABOVE_32(*r_dst + MAKE_INT_16(AY));
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_adda_16_ai:
+   {
+      signed short src = MAKE_INT_16(OPER_AY_AI_16());
+      uint* r_dst = &AX;
+
+      *r_dst = MASK_OUT_ABOVE_32(*r_dst + src);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_adda_16_pi:
+   {
+      signed short src = MAKE_INT_16(OPER_AY_PI_16());
+      uint* r_dst = &AX;
+
+      *r_dst = MASK_OUT_ABOVE_32(*r_dst + src);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_adda_16_pd:
+   {
+      signed short src = MAKE_INT_16(OPER_AY_PD_16());
+      uint* r_dst = &AX;
+
+      *r_dst = MASK_OUT_ABOVE_32(*r_dst + src);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_adda_16_di:
+   {
+      signed short src = MAKE_INT_16(OPER_AY_DI_16());
+      uint* r_dst = &AX;
+
+      *r_dst = MASK_OUT_ABOVE_32(*r_dst + src);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_adda_16_ix:
+   {
+      signed short src = MAKE_INT_16(OPER_AY_IX_16());
+      uint* r_dst = &AX;
+
+      *r_dst = MASK_OUT_ABOVE_32(*r_dst + src);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_adda_16_aw:
+   {
+      signed short src = MAKE_INT_16(OPER_AW_16());
+      uint* r_dst = &AX;
+
+      *r_dst = MASK_OUT_ABOVE_32(*r_dst + src);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_adda_16_al:
+   {
+      signed short src = MAKE_INT_16(OPER_AL_16());
+      uint* r_dst = &AX;
+
+      *r_dst = MASK_OUT_ABOVE_32(*r_dst + src);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_adda_16_pcdi:
+   {
+      signed short src = MAKE_INT_16(OPER_PCDI_16());
+      uint* r_dst = &AX;
+
+      *r_dst = MASK_OUT_ABOVE_32(*r_dst + src);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_adda_16_pcix:
+   {
+      signed short src = MAKE_INT_16(OPER_PCIX_16());
+      uint* r_dst = &AX;
+
+      *r_dst = MASK_OUT_ABOVE_32(*r_dst + src);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_adda_16_i:
+   {
+      signed short src = MAKE_INT_16(OPER_I_16());
+      uint* r_dst = &AX;
+
+      *r_dst = MASK_OUT_ABOVE_32(*r_dst + src);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_adda_32_d:
+   {
+      uint* r_dst = &AX;
+
+      *r_dst = MASK_OUT_ABOVE_32(*r_dst + DY);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_adda_32_a:
+   {
+      uint* r_dst = &AX;
+
+      *r_dst = MASK_OUT_ABOVE_32(*r_dst + AY);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_adda_32_ai:
+   {
+      uint src = OPER_AY_AI_32();
+      uint* r_dst = &AX;
+
+      *r_dst = MASK_OUT_ABOVE_32(*r_dst + src);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_adda_32_pi:
+   {
+      uint src = OPER_AY_PI_32();
+      uint* r_dst = &AX;
+
+      *r_dst = MASK_OUT_ABOVE_32(*r_dst + src);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_adda_32_pd:
+   {
+      uint src = OPER_AY_PD_32();
+      uint* r_dst = &AX;
+
+      *r_dst = MASK_OUT_ABOVE_32(*r_dst + src);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_adda_32_di:
+   {
+      uint src = OPER_AY_DI_32();
+      uint* r_dst = &AX;
+
+      *r_dst = MASK_OUT_ABOVE_32(*r_dst + src);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_adda_32_ix:
+   {
+      uint src = OPER_AY_IX_32();
+      uint* r_dst = &AX;
+
+      *r_dst = MASK_OUT_ABOVE_32(*r_dst + src);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_adda_32_aw:
+   {
+      uint src = OPER_AW_32();
+      uint* r_dst = &AX;
+
+      *r_dst = MASK_OUT_ABOVE_32(*r_dst + src);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_adda_32_al:
+   {
+      uint src = OPER_AL_32();
+      uint* r_dst = &AX;
+
+      *r_dst = MASK_OUT_ABOVE_32(*r_dst + src);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_adda_32_pcdi:
+   {
+      uint src = OPER_PCDI_32();
+      uint* r_dst = &AX;
+
+      *r_dst = MASK_OUT_ABOVE_32(*r_dst + src);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_adda_32_pcix:
+   {
+      uint src = OPER_PCIX_32();
+      uint* r_dst = &AX;
+
+      *r_dst = MASK_OUT_ABOVE_32(*r_dst + src);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_adda_32_i:
+   {
+      uint src = OPER_I_32();
+      uint* r_dst = &AX;
+
+      *r_dst = MASK_OUT_ABOVE_32(*r_dst + src);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_addi_8_d:
+   {
+      uint* r_dst = &DY;
+      uint src = OPER_I_8();
+      uint dst = MASK_OUT_ABOVE_8(*r_dst);
+      uint res = src + dst;
+
+      m68ki_set_xnzvc_add_8(src, dst, res);
+
+      *r_dst = MASK_OUT_BELOW_8(*r_dst) | MASK_OUT_ABOVE_8(res);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_addi_8_ai:
+   {
+      uint src = OPER_I_8();
+      uint ea = EA_AY_AI_8();
+      uint dst = m68ki_read_8(ea);
+      uint res = src + dst;
+
+      m68ki_set_xnzvc_add_8(src, dst, res);
+
+      m68ki_write_8(ea, MASK_OUT_ABOVE_8(res));
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_addi_8_pi:
+   {
+      uint src = OPER_I_8();
+      uint ea = EA_AY_PI_8();
+      uint dst = m68ki_read_8(ea);
+      uint res = src + dst;
+
+      m68ki_set_xnzvc_add_8(src, dst, res);
+
+      m68ki_write_8(ea, MASK_OUT_ABOVE_8(res));
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_addi_8_pi7:
+   {
+      uint src = OPER_I_8();
+      uint ea = EA_A7_PI_8();
+      uint dst = m68ki_read_8(ea);
+      uint res = src + dst;
+
+      m68ki_set_xnzvc_add_8(src, dst, res);
+
+      m68ki_write_8(ea, MASK_OUT_ABOVE_8(res));
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_addi_8_pd:
+   {
+      uint src = OPER_I_8();
+      uint ea = EA_AY_PD_8();
+      uint dst = m68ki_read_8(ea);
+      uint res = src + dst;
+
+      m68ki_set_xnzvc_add_8(src, dst, res);
+
+      m68ki_write_8(ea, MASK_OUT_ABOVE_8(res));
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_addi_8_pd7:
+   {
+      uint src = OPER_I_8();
+      uint ea = EA_A7_PD_8();
+      uint dst = m68ki_read_8(ea);
+      uint res = src + dst;
+
+      m68ki_set_xnzvc_add_8(src, dst, res);
+
+      m68ki_write_8(ea, MASK_OUT_ABOVE_8(res));
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_addi_8_di:
+   {
+      uint src = OPER_I_8();
+      uint ea = EA_AY_DI_8();
+      uint dst = m68ki_read_8(ea);
+      uint res = src + dst;
+
+      m68ki_set_xnzvc_add_8(src, dst, res);
+
+      m68ki_write_8(ea, MASK_OUT_ABOVE_8(res));
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_addi_8_ix:
+   {
+      uint src = OPER_I_8();
+      uint ea = EA_AY_IX_8();
+      uint dst = m68ki_read_8(ea);
+      uint res = src + dst;
+
+      m68ki_set_xnzvc_add_8(src, dst, res);
+
+      m68ki_write_8(ea, MASK_OUT_ABOVE_8(res));
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_addi_8_aw:
+   {
+      uint src = OPER_I_8();
+      uint ea = EA_AW_8();
+      uint dst = m68ki_read_8(ea);
+      uint res = src + dst;
+
+      m68ki_set_xnzvc_add_8(src, dst, res);
+
+      m68ki_write_8(ea, MASK_OUT_ABOVE_8(res));
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_addi_8_al:
+   {
+      uint src = OPER_I_8();
+      uint ea = EA_AL_8();
+      uint dst = m68ki_read_8(ea);
+      uint res = src + dst;
+
+      m68ki_set_xnzvc_add_8(src, dst, res);
+
+      m68ki_write_8(ea, MASK_OUT_ABOVE_8(res));
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_addi_16_d:
+   {
+      uint* r_dst = &DY;
+      uint src = OPER_I_16();
+      uint dst = MASK_OUT_ABOVE_16(*r_dst);
+      uint res = src + dst;
+
+      m68ki_set_xnzvc_add_16(src, dst, res);
+
+      *r_dst = MASK_OUT_BELOW_16(*r_dst) | MASK_OUT_ABOVE_16(res);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_addi_16_ai:
+   {
+      uint src = OPER_I_16();
+      uint ea = EA_AY_AI_16();
+      uint dst = m68ki_read_16(ea);
+      uint res = src + dst;
+
+      m68ki_set_xnzvc_add_16(src, dst, res);
+
+      m68ki_write_16(ea, MASK_OUT_ABOVE_16(res));
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_addi_16_pi:
+   {
+      uint src = OPER_I_16();
+      uint ea = EA_AY_PI_16();
+      uint dst = m68ki_read_16(ea);
+      uint res = src + dst;
+
+      m68ki_set_xnzvc_add_16(src, dst, res);
+
+      m68ki_write_16(ea, MASK_OUT_ABOVE_16(res));
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_addi_16_pd:
+   {
+      uint src = OPER_I_16();
+      uint ea = EA_AY_PD_16();
+      uint dst = m68ki_read_16(ea);
+      uint res = src + dst;
+
+      m68ki_set_xnzvc_add_16(src, dst, res);
+
+      m68ki_write_16(ea, MASK_OUT_ABOVE_16(res));
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_addi_16_di:
+   {
+      uint src = OPER_I_16();
+      uint ea = EA_AY_DI_16();
+      uint dst = m68ki_read_16(ea);
+      uint res = src + dst;
+
+      m68ki_set_xnzvc_add_16(src, dst, res);
+
+      m68ki_write_16(ea, MASK_OUT_ABOVE_16(res));
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_addi_16_ix:
+   {
+      uint src = OPER_I_16();
+      uint ea = EA_AY_IX_16();
+      uint dst = m68ki_read_16(ea);
+      uint res = src + dst;
+
+      m68ki_set_xnzvc_add_16(src, dst, res);
+
+      m68ki_write_16(ea, MASK_OUT_ABOVE_16(res));
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_addi_16_aw:
+   {
+      uint src = OPER_I_16();
+      uint ea = EA_AW_16();
+      uint dst = m68ki_read_16(ea);
+      uint res = src + dst;
+
+      m68ki_set_xnzvc_add_16(src, dst, res);
+
+      m68ki_write_16(ea, MASK_OUT_ABOVE_16(res));
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_addi_16_al:
+   {
+      uint src = OPER_I_16();
+      uint ea = EA_AL_16();
+      uint dst = m68ki_read_16(ea);
+      uint res = src + dst;
+
+      m68ki_set_xnzvc_add_16(src, dst, res);
+
+      m68ki_write_16(ea, MASK_OUT_ABOVE_16(res));
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_addi_32_d:
+   {
+      uint* r_dst = &DY;
+      uint src = OPER_I_32();
+      uint dst = *r_dst;
+      uint res = src + dst;
+
+      m68ki_set_xnzvc_add_32(src, dst, res);
+
+      *r_dst = MASK_OUT_ABOVE_32(res);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_addi_32_ai:
+   {
+      uint src = OPER_I_32();
+      uint ea = EA_AY_AI_32();
+      uint dst = m68ki_read_32(ea);
+      uint res = src + dst;
+
+      m68ki_set_xnzvc_add_32(src, dst, res);
+
+      m68ki_write_32(ea, MASK_OUT_ABOVE_32(res));
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_addi_32_pi:
+   {
+      uint src = OPER_I_32();
+      uint ea = EA_AY_PI_32();
+      uint dst = m68ki_read_32(ea);
+      uint res = src + dst;
+
+      m68ki_set_xnzvc_add_32(src, dst, res);
+
+      m68ki_write_32(ea, MASK_OUT_ABOVE_32(res));
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_addi_32_pd:
+   {
+      uint src = OPER_I_32();
+      uint ea = EA_AY_PD_32();
+      uint dst = m68ki_read_32(ea);
+      uint res = src + dst;
+
+      m68ki_set_xnzvc_add_32(src, dst, res);
+
+      m68ki_write_32(ea, MASK_OUT_ABOVE_32(res));
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_addi_32_di:
+   {
+      uint src = OPER_I_32();
+      uint ea = EA_AY_DI_32();
+      uint dst = m68ki_read_32(ea);
+      uint res = src + dst;
+
+      m68ki_set_xnzvc_add_32(src, dst, res);
+
+      m68ki_write_32(ea, MASK_OUT_ABOVE_32(res));
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_addi_32_ix:
+   {
+      uint src = OPER_I_32();
+      uint ea = EA_AY_IX_32();
+      uint dst = m68ki_read_32(ea);
+      uint res = src + dst;
+
+      m68ki_set_xnzvc_add_32(src, dst, res);
+
+      m68ki_write_32(ea, MASK_OUT_ABOVE_32(res));
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_addi_32_aw:
+   {
+      uint src = OPER_I_32();
+      uint ea = EA_AW_32();
+      uint dst = m68ki_read_32(ea);
+      uint res = src + dst;
+
+      m68ki_set_xnzvc_add_32(src, dst, res);
+
+      m68ki_write_32(ea, MASK_OUT_ABOVE_32(res));
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_addi_32_al:
+   {
+      uint src = OPER_I_32();
+      uint ea = EA_AL_32();
+      uint dst = m68ki_read_32(ea);
+      uint res = src + dst;
+
+      m68ki_set_xnzvc_add_32(src, dst, res);
+
+      m68ki_write_32(ea, MASK_OUT_ABOVE_32(res));
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_addq_8_d:
+   {
+      uint* r_dst = &DY;
+      uint src = (((REG_IR >> 9) - 1) & 7) + 1;
+      uint dst = MASK_OUT_ABOVE_8(*r_dst);
+      uint res = src + dst;
+
+      m68ki_set_xnzvc_add_8(src, dst, res);
+
+      *r_dst = MASK_OUT_BELOW_8(*r_dst) | MASK_OUT_ABOVE_8(res);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_addq_8_ai:
+   {
+      uint src = (((REG_IR >> 9) - 1) & 7) + 1;
+      uint ea = EA_AY_AI_8();
+      uint dst = m68ki_read_8(ea);
+      uint res = src + dst;
+
+      m68ki_set_xnzvc_add_8(src, dst, res);
+
+      m68ki_write_8(ea, MASK_OUT_ABOVE_8(res));
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_addq_8_pi:
+   {
+      uint src = (((REG_IR >> 9) - 1) & 7) + 1;
+      uint ea = EA_AY_PI_8();
+      uint dst = m68ki_read_8(ea);
+      uint res = src + dst;
+
+      m68ki_set_xnzvc_add_8(src, dst, res);
+
+      m68ki_write_8(ea, MASK_OUT_ABOVE_8(res));
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_addq_8_pi7:
+   {
+      uint src = (((REG_IR >> 9) - 1) & 7) + 1;
+      uint ea = EA_A7_PI_8();
+      uint dst = m68ki_read_8(ea);
+      uint res = src + dst;
+
+      m68ki_set_xnzvc_add_8(src, dst, res);
+
+      m68ki_write_8(ea, MASK_OUT_ABOVE_8(res));
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_addq_8_pd:
+   {
+      uint src = (((REG_IR >> 9) - 1) & 7) + 1;
+      uint ea = EA_AY_PD_8();
+      uint dst = m68ki_read_8(ea);
+      uint res = src + dst;
+
+      m68ki_set_xnzvc_add_8(src, dst, res);
+
+      m68ki_write_8(ea, MASK_OUT_ABOVE_8(res));
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_addq_8_pd7:
+   {
+      uint src = (((REG_IR >> 9) - 1) & 7) + 1;
+      uint ea = EA_A7_PD_8();
+      uint dst = m68ki_read_8(ea);
+      uint res = src + dst;
+
+      m68ki_set_xnzvc_add_8(src, dst, res);
+
+      m68ki_write_8(ea, MASK_OUT_ABOVE_8(res));
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_addq_8_di:
+   {
+      uint src = (((REG_IR >> 9) - 1) & 7) + 1;
+      uint ea = EA_AY_DI_8();
+      uint dst = m68ki_read_8(ea);
+      uint res = src + dst;
+
+      m68ki_set_xnzvc_add_8(src, dst, res);
+
+      m68ki_write_8(ea, MASK_OUT_ABOVE_8(res));
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_addq_8_ix:
+   {
+      uint src = (((REG_IR >> 9) - 1) & 7) + 1;
+      uint ea = EA_AY_IX_8();
+      uint dst = m68ki_read_8(ea);
+      uint res = src + dst;
+
+      m68ki_set_xnzvc_add_8(src, dst, res);
+
+      m68ki_write_8(ea, MASK_OUT_ABOVE_8(res));
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_addq_8_aw:
+   {
+      uint src = (((REG_IR >> 9) - 1) & 7) + 1;
+      uint ea = EA_AW_8();
+      uint dst = m68ki_read_8(ea);
+      uint res = src + dst;
+
+      m68ki_set_xnzvc_add_8(src, dst, res);
+
+      m68ki_write_8(ea, MASK_OUT_ABOVE_8(res));
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_addq_8_al:
+   {
+      uint src = (((REG_IR >> 9) - 1) & 7) + 1;
+      uint ea = EA_AL_8();
+      uint dst = m68ki_read_8(ea);
+      uint res = src + dst;
+
+      m68ki_set_xnzvc_add_8(src, dst, res);
+
+      m68ki_write_8(ea, MASK_OUT_ABOVE_8(res));
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_addq_16_d:
+   {
+      uint* r_dst = &DY;
+      uint src = (((REG_IR >> 9) - 1) & 7) + 1;
+      uint dst = MASK_OUT_ABOVE_16(*r_dst);
+      uint res = src + dst;
+
+      m68ki_set_xnzvc_add_16(src, dst, res);
+
+      *r_dst = MASK_OUT_BELOW_16(*r_dst) | MASK_OUT_ABOVE_16(res);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_addq_16_a:
+   {
+      uint* r_dst = &AY;
+
+      *r_dst = MASK_OUT_ABOVE_32(*r_dst + (((REG_IR >> 9) - 1) & 7) + 1);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_addq_16_ai:
+   {
+      uint src = (((REG_IR >> 9) - 1) & 7) + 1;
+      uint ea = EA_AY_AI_16();
+      uint dst = m68ki_read_16(ea);
+      uint res = src + dst;
+
+      m68ki_set_xnzvc_add_16(src, dst, res);
+
+      m68ki_write_16(ea, MASK_OUT_ABOVE_16(res));
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_addq_16_pi:
+   {
+      uint src = (((REG_IR >> 9) - 1) & 7) + 1;
+      uint ea = EA_AY_PI_16();
+      uint dst = m68ki_read_16(ea);
+      uint res = src + dst;
+
+      m68ki_set_xnzvc_add_16(src, dst, res);
+
+      m68ki_write_16(ea, MASK_OUT_ABOVE_16(res));
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_addq_16_pd:
+   {
+      uint src = (((REG_IR >> 9) - 1) & 7) + 1;
+      uint ea = EA_AY_PD_16();
+      uint dst = m68ki_read_16(ea);
+      uint res = src + dst;
+
+      m68ki_set_xnzvc_add_16(src, dst, res);
+
+      m68ki_write_16(ea, MASK_OUT_ABOVE_16(res));
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_addq_16_di:
+   {
+      uint src = (((REG_IR >> 9) - 1) & 7) + 1;
+      uint ea = EA_AY_DI_16();
+      uint dst = m68ki_read_16(ea);
+      uint res = src + dst;
+
+      m68ki_set_xnzvc_add_16(src, dst, res);
+
+      m68ki_write_16(ea, MASK_OUT_ABOVE_16(res));
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_addq_16_ix:
+   {
+      uint src = (((REG_IR >> 9) - 1) & 7) + 1;
+      uint ea = EA_AY_IX_16();
+      uint dst = m68ki_read_16(ea);
+      uint res = src + dst;
+
+      m68ki_set_xnzvc_add_16(src, dst, res);
+
+      m68ki_write_16(ea, MASK_OUT_ABOVE_16(res));
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_addq_16_aw:
+   {
+      uint src = (((REG_IR >> 9) - 1) & 7) + 1;
+      uint ea = EA_AW_16();
+      uint dst = m68ki_read_16(ea);
+      uint res = src + dst;
+
+      m68ki_set_xnzvc_add_16(src, dst, res);
+
+      m68ki_write_16(ea, MASK_OUT_ABOVE_16(res));
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_addq_16_al:
+   {
+      uint src = (((REG_IR >> 9) - 1) & 7) + 1;
+      uint ea = EA_AL_16();
+      uint dst = m68ki_read_16(ea);
+      uint res = src + dst;
+
+      m68ki_set_xnzvc_add_16(src, dst, res);
+
+      m68ki_write_16(ea, MASK_OUT_ABOVE_16(res));
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_addq_32_d:
+   {
+      uint* r_dst = &DY;
+      uint src = (((REG_IR >> 9) - 1) & 7) + 1;
+      uint dst = *r_dst;
+      uint res = src + dst;
+
+      m68ki_set_xnzvc_add_32(src, dst, res);
+
+      *r_dst = MASK_OUT_ABOVE_32(res);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_addq_32_a:
+   {
+      uint* r_dst = &AY;
+
+      *r_dst = MASK_OUT_ABOVE_32(*r_dst + (((REG_IR >> 9) - 1) & 7) + 1);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_addq_32_ai:
+   {
+      uint src = (((REG_IR >> 9) - 1) & 7) + 1;
+      uint ea = EA_AY_AI_32();
+      uint dst = m68ki_read_32(ea);
+      uint res = src + dst;
+
+
+      m68ki_set_xnzvc_add_32(src, dst, res);
+
+      m68ki_write_32(ea, MASK_OUT_ABOVE_32(res));
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_addq_32_pi:
+   {
+      uint src = (((REG_IR >> 9) - 1) & 7) + 1;
+      uint ea = EA_AY_PI_32();
+      uint dst = m68ki_read_32(ea);
+      uint res = src + dst;
+
+
+      m68ki_set_xnzvc_add_32(src, dst, res);
+
+      m68ki_write_32(ea, MASK_OUT_ABOVE_32(res));
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_addq_32_pd:
+   {
+      uint src = (((REG_IR >> 9) - 1) & 7) + 1;
+      uint ea = EA_AY_PD_32();
+      uint dst = m68ki_read_32(ea);
+      uint res = src + dst;
+
+
+      m68ki_set_xnzvc_add_32(src, dst, res);
+
+      m68ki_write_32(ea, MASK_OUT_ABOVE_32(res));
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_addq_32_di:
+   {
+      uint src = (((REG_IR >> 9) - 1) & 7) + 1;
+      uint ea = EA_AY_DI_32();
+      uint dst = m68ki_read_32(ea);
+      uint res = src + dst;
+
+
+      m68ki_set_xnzvc_add_32(src, dst, res);
+
+      m68ki_write_32(ea, MASK_OUT_ABOVE_32(res));
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_addq_32_ix:
+   {
+      uint src = (((REG_IR >> 9) - 1) & 7) + 1;
+      uint ea = EA_AY_IX_32();
+      uint dst = m68ki_read_32(ea);
+      uint res = src + dst;
+
+
+      m68ki_set_xnzvc_add_32(src, dst, res);
+
+      m68ki_write_32(ea, MASK_OUT_ABOVE_32(res));
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_addq_32_aw:
+   {
+      uint src = (((REG_IR >> 9) - 1) & 7) + 1;
+      uint ea = EA_AW_32();
+      uint dst = m68ki_read_32(ea);
+      uint res = src + dst;
+
+
+      m68ki_set_xnzvc_add_32(src, dst, res);
+
+      m68ki_write_32(ea, MASK_OUT_ABOVE_32(res));
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_addq_32_al:
+   {
+      uint src = (((REG_IR >> 9) - 1) & 7) + 1;
+      uint ea = EA_AL_32();
+      uint dst = m68ki_read_32(ea);
+      uint res = src + dst;
+
+
+      m68ki_set_xnzvc_add_32(src, dst, res);
+
+      m68ki_write_32(ea, MASK_OUT_ABOVE_32(res));
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_addx_8_rr:
+   {
+      uint* r_dst = &DX;
+      uint src = MASK_OUT_ABOVE_8(DY);
+      uint dst = MASK_OUT_ABOVE_8(*r_dst);
+      uint res = src + dst + XFLAG_AS_1();
+
+      m68ki_resolve_flags();
+
+      FLAG_N = NFLAG_8(res);
+      FLAG_V = VFLAG_ADD_8(src, dst, res);
+      FLAG_X = FLAG_C = CFLAG_8(res);
+
+      res = MASK_OUT_ABOVE_8(res);
+      FLAG_Z |= res;
+
+      *r_dst = MASK_OUT_BELOW_8(*r_dst) | res;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_addx_16_rr:
+   {
+      uint* r_dst = &DX;
+      uint src = MASK_OUT_ABOVE_16(DY);
+      uint dst = MASK_OUT_ABOVE_16(*r_dst);
+      uint res = src + dst + XFLAG_AS_1();
+
+      m68ki_resolve_flags();
+
+      FLAG_N = NFLAG_16(res);
+      FLAG_V = VFLAG_ADD_16(src, dst, res);
+      FLAG_X = FLAG_C = CFLAG_16(res);
+
+      res = MASK_OUT_ABOVE_16(res);
+      FLAG_Z |= res;
+
+      *r_dst = MASK_OUT_BELOW_16(*r_dst) | res;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_addx_32_rr:
+   {
+      uint* r_dst = &DX;
+      uint src = DY;
+      uint dst = *r_dst;
+      uint res = src + dst + XFLAG_AS_1();
+
+      m68ki_resolve_flags();
+
+      FLAG_N = NFLAG_32(res);
+      FLAG_V = VFLAG_ADD_32(src, dst, res);
+      FLAG_X = FLAG_C = CFLAG_ADD_32(src, dst, res);
+
+      res = MASK_OUT_ABOVE_32(res);
+      FLAG_Z |= res;
+
+      *r_dst = res;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_addx_8_mm_ax7:
+   {
+      uint src = OPER_AY_PD_8();
+      uint ea  = EA_A7_PD_8();
+      uint dst = m68ki_read_8(ea);
+      uint res = src + dst + XFLAG_AS_1();
+
+      m68ki_resolve_flags();
+
+      FLAG_N = NFLAG_8(res);
+      FLAG_V = VFLAG_ADD_8(src, dst, res);
+      FLAG_X = FLAG_C = CFLAG_8(res);
+
+      res = MASK_OUT_ABOVE_8(res);
+      FLAG_Z |= res;
+
+      m68ki_write_8(ea, res);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_addx_8_mm_ay7:
+   {
+      uint src = OPER_A7_PD_8();
+      uint ea  = EA_AX_PD_8();
+      uint dst = m68ki_read_8(ea);
+      uint res = src + dst + XFLAG_AS_1();
+
+      m68ki_resolve_flags();
+
+      FLAG_N = NFLAG_8(res);
+      FLAG_V = VFLAG_ADD_8(src, dst, res);
+      FLAG_X = FLAG_C = CFLAG_8(res);
+
+      res = MASK_OUT_ABOVE_8(res);
+      FLAG_Z |= res;
+
+      m68ki_write_8(ea, res);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_addx_8_mm_axy7:
+   {
+      uint src = OPER_A7_PD_8();
+      uint ea  = EA_A7_PD_8();
+      uint dst = m68ki_read_8(ea);
+      uint res = src + dst + XFLAG_AS_1();
+
+      m68ki_resolve_flags();
+
+      FLAG_N = NFLAG_8(res);
+      FLAG_V = VFLAG_ADD_8(src, dst, res);
+      FLAG_X = FLAG_C = CFLAG_8(res);
+
+      res = MASK_OUT_ABOVE_8(res);
+      FLAG_Z |= res;
+
+      m68ki_write_8(ea, res);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_addx_8_mm:
+   {
+      uint src = OPER_AY_PD_8();
+      uint ea  = EA_AX_PD_8();
+      uint dst = m68ki_read_8(ea);
+      uint res = src + dst + XFLAG_AS_1();
+
+      m68ki_resolve_flags();
+
+      FLAG_N = NFLAG_8(res);
+      FLAG_V = VFLAG_ADD_8(src, dst, res);
+      FLAG_X = FLAG_C = CFLAG_8(res);
+
+      res = MASK_OUT_ABOVE_8(res);
+      FLAG_Z |= res;
+
+      m68ki_write_8(ea, res);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_addx_16_mm:
+   {
+      uint src = OPER_AY_PD_16();
+      uint ea  = EA_AX_PD_16();
+      uint dst = m68ki_read_16(ea);
+      uint res = src + dst + XFLAG_AS_1();
+
+      m68ki_resolve_flags();
+
+      FLAG_N = NFLAG_16(res);
+      FLAG_V = VFLAG_ADD_16(src, dst, res);
+      FLAG_X = FLAG_C = CFLAG_16(res);
+
+      res = MASK_OUT_ABOVE_16(res);
+      FLAG_Z |= res;
+
+      m68ki_write_16(ea, res);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_addx_32_mm:
+   {
+      uint src = OPER_AY_PD_32();
+      uint ea  = EA_AX_PD_32();
+      uint dst = m68ki_read_32(ea);
+      uint res = src + dst + XFLAG_AS_1();
+
+      m68ki_resolve_flags();
+
+      FLAG_N = NFLAG_32(res);
+      FLAG_V = VFLAG_ADD_32(src, dst, res);
+      FLAG_X = FLAG_C = CFLAG_ADD_32(src, dst, res);
+
+      res = MASK_OUT_ABOVE_32(res);
+      FLAG_Z |= res;
+
+      m68ki_write_32(ea, res);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_and_8_er_d:
+   {
+      m68ki_discard_lazy_flags();
+      FLAG_Z = MASK_OUT_ABOVE_8(DX &= (DY | 0xffffff00));
+
+      FLAG_N = NFLAG_8(FLAG_Z);
+      FLAG_C = CFLAG_CLEAR;
+      FLAG_V = VFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_and_8_er_ai:
+   {
+      m68ki_discard_lazy_flags();
+      FLAG_Z = MASK_OUT_ABOVE_8(DX &= (OPER_AY_AI_8() | 0xffffff00));
+
+      FLAG_N = NFLAG_8(FLAG_Z);
+      FLAG_C = CFLAG_CLEAR;
+      FLAG_V = VFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_and_8_er_pi:
+   {
+      m68ki_discard_lazy_flags();
+      FLAG_Z = MASK_OUT_ABOVE_8(DX &= (OPER_AY_PI_8() | 0xffffff00));
+
+      FLAG_N = NFLAG_8(FLAG_Z);
+      FLAG_C = CFLAG_CLEAR;
+      FLAG_V = VFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_and_8_er_pi7:
+   {
+      m68ki_discard_lazy_flags();
+      FLAG_Z = MASK_OUT_ABOVE_8(DX &= (OPER_A7_PI_8() | 0xffffff00));
+
+      FLAG_N = NFLAG_8(FLAG_Z);
+      FLAG_C = CFLAG_CLEAR;
+      FLAG_V = VFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_and_8_er_pd:
+   {
+      m68ki_discard_lazy_flags();
+      FLAG_Z = MASK_OUT_ABOVE_8(DX &= (OPER_AY_PD_8() | 0xffffff00));
+
+      FLAG_N = NFLAG_8(FLAG_Z);
+      FLAG_C = CFLAG_CLEAR;
+      FLAG_V = VFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_and_8_er_pd7:
+   {
+      m68ki_discard_lazy_flags();
+      FLAG_Z = MASK_OUT_ABOVE_8(DX &= (OPER_A7_PD_8() | 0xffffff00));
+
+      FLAG_N = NFLAG_8(FLAG_Z);
+      FLAG_C = CFLAG_CLEAR;
+      FLAG_V = VFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_and_8_er_di:
+   {
+      m68ki_discard_lazy_flags();
+      FLAG_Z = MASK_OUT_ABOVE_8(DX &= (OPER_AY_DI_8() | 0xffffff00));
+
+      FLAG_N = NFLAG_8(FLAG_Z);
+      FLAG_C = CFLAG_CLEAR;
+      FLAG_V = VFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_and_8_er_ix:
+   {
+      m68ki_discard_lazy_flags();
+      FLAG_Z = MASK_OUT_ABOVE_8(DX &= (OPER_AY_IX_8() | 0xffffff00));
+
+      FLAG_N = NFLAG_8(FLAG_Z);
+      FLAG_C = CFLAG_CLEAR;
+      FLAG_V = VFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_and_8_er_aw:
+   {
+      m68ki_discard_lazy_flags();
+      FLAG_Z = MASK_OUT_ABOVE_8(DX &= (OPER_AW_8() | 0xffffff00));
+
+      FLAG_N = NFLAG_8(FLAG_Z);
+      FLAG_C = CFLAG_CLEAR;
+      FLAG_V = VFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_and_8_er_al:
+   {
+      m68ki_discard_lazy_flags();
+      FLAG_Z = MASK_OUT_ABOVE_8(DX &= (OPER_AL_8() | 0xffffff00));
+
+      FLAG_N = NFLAG_8(FLAG_Z);
+      FLAG_C = CFLAG_CLEAR;
+      FLAG_V = VFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_and_8_er_pcdi:
+   {
+      m68ki_discard_lazy_flags();
+      FLAG_Z = MASK_OUT_ABOVE_8(DX &= (OPER_PCDI_8() | 0xffffff00));
+
+      FLAG_N = NFLAG_8(FLAG_Z);
+      FLAG_C = CFLAG_CLEAR;
+      FLAG_V = VFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_and_8_er_pcix:
+   {
+      m68ki_discard_lazy_flags();
+      FLAG_Z = MASK_OUT_ABOVE_8(DX &= (OPER_PCIX_8() | 0xffffff00));
+
+      FLAG_N = NFLAG_8(FLAG_Z);
+      FLAG_C = CFLAG_CLEAR;
+      FLAG_V = VFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_and_8_er_i:
+   {
+      m68ki_discard_lazy_flags();
+      FLAG_Z = MASK_OUT_ABOVE_8(DX &= (OPER_I_8() | 0xffffff00));
+
+      FLAG_N = NFLAG_8(FLAG_Z);
+      FLAG_C = CFLAG_CLEAR;
+      FLAG_V = VFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_and_16_er_d:
+   {
+      m68ki_discard_lazy_flags();
+      FLAG_Z = MASK_OUT_ABOVE_16(DX &= (DY | 0xffff0000));
+
+      FLAG_N = NFLAG_16(FLAG_Z);
+      FLAG_C = CFLAG_CLEAR;
+      FLAG_V = VFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_and_16_er_ai:
+   {
+      m68ki_discard_lazy_flags();
+      FLAG_Z = MASK_OUT_ABOVE_16(DX &= (OPER_AY_AI_16() | 0xffff0000));
+
+      FLAG_N = NFLAG_16(FLAG_Z);
+      FLAG_C = CFLAG_CLEAR;
+      FLAG_V = VFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_and_16_er_pi:
+   {
+      m68ki_discard_lazy_flags();
+      FLAG_Z = MASK_OUT_ABOVE_16(DX &= (OPER_AY_PI_16() | 0xffff0000));
+
+      FLAG_N = NFLAG_16(FLAG_Z);
+      FLAG_C = CFLAG_CLEAR;
+      FLAG_V = VFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_and_16_er_pd:
+   {
+      m68ki_discard_lazy_flags();
+      FLAG_Z = MASK_OUT_ABOVE_16(DX &= (OPER_AY_PD_16() | 0xffff0000));
+
+      FLAG_N = NFLAG_16(FLAG_Z);
+      FLAG_C = CFLAG_CLEAR;
+      FLAG_V = VFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_and_16_er_di:
+   {
+      m68ki_discard_lazy_flags();
+      FLAG_Z = MASK_OUT_ABOVE_16(DX &= (OPER_AY_DI_16() | 0xffff0000));
+
+      FLAG_N = NFLAG_16(FLAG_Z);
+      FLAG_C = CFLAG_CLEAR;
+      FLAG_V = VFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_and_16_er_ix:
+   {
+      m68ki_discard_lazy_flags();
+      FLAG_Z = MASK_OUT_ABOVE_16(DX &= (OPER_AY_IX_16() | 0xffff0000));
+
+      FLAG_N = NFLAG_16(FLAG_Z);
+      FLAG_C = CFLAG_CLEAR;
+      FLAG_V = VFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_and_16_er_aw:
+   {
+      m68ki_discard_lazy_flags();
+      FLAG_Z = MASK_OUT_ABOVE_16(DX &= (OPER_AW_16() | 0xffff0000));
+
+      FLAG_N = NFLAG_16(FLAG_Z);
+      FLAG_C = CFLAG_CLEAR;
+      FLAG_V = VFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_and_16_er_al:
+   {
+      m68ki_discard_lazy_flags();
+      FLAG_Z = MASK_OUT_ABOVE_16(DX &= (OPER_AL_16() | 0xffff0000));
+
+      FLAG_N = NFLAG_16(FLAG_Z);
+      FLAG_C = CFLAG_CLEAR;
+      FLAG_V = VFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_and_16_er_pcdi:
+   {
+      m68ki_discard_lazy_flags();
+      FLAG_Z = MASK_OUT_ABOVE_16(DX &= (OPER_PCDI_16() | 0xffff0000));
+
+      FLAG_N = NFLAG_16(FLAG_Z);
+      FLAG_C = CFLAG_CLEAR;
+      FLAG_V = VFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_and_16_er_pcix:
+   {
+      m68ki_discard_lazy_flags();
+      FLAG_Z = MASK_OUT_ABOVE_16(DX &= (OPER_PCIX_16() | 0xffff0000));
+
+      FLAG_N = NFLAG_16(FLAG_Z);
+      FLAG_C = CFLAG_CLEAR;
+      FLAG_V = VFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_and_16_er_i:
+   {
+      m68ki_discard_lazy_flags();
+      FLAG_Z = MASK_OUT_ABOVE_16(DX &= (OPER_I_16() | 0xffff0000));
+
+      FLAG_N = NFLAG_16(FLAG_Z);
+      FLAG_C = CFLAG_CLEAR;
+      FLAG_V = VFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_and_32_er_d:
+   {
+      m68ki_discard_lazy_flags();
+      FLAG_Z = DX &= DY;
+
+      FLAG_N = NFLAG_32(FLAG_Z);
+      FLAG_C = CFLAG_CLEAR;
+      FLAG_V = VFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_and_32_er_ai:
+   {
+      m68ki_discard_lazy_flags();
+      FLAG_Z = DX &= OPER_AY_AI_32();
+
+      FLAG_N = NFLAG_32(FLAG_Z);
+      FLAG_C = CFLAG_CLEAR;
+      FLAG_V = VFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_and_32_er_pi:
+   {
+      m68ki_discard_lazy_flags();
+      FLAG_Z = DX &= OPER_AY_PI_32();
+
+      FLAG_N = NFLAG_32(FLAG_Z);
+      FLAG_C = CFLAG_CLEAR;
+      FLAG_V = VFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_and_32_er_pd:
+   {
+      m68ki_discard_lazy_flags();
+      FLAG_Z = DX &= OPER_AY_PD_32();
+
+      FLAG_N = NFLAG_32(FLAG_Z);
+      FLAG_C = CFLAG_CLEAR;
+      FLAG_V = VFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_and_32_er_di:
+   {
+      m68ki_discard_lazy_flags();
+      FLAG_Z = DX &= OPER_AY_DI_32();
+
+      FLAG_N = NFLAG_32(FLAG_Z);
+      FLAG_C = CFLAG_CLEAR;
+      FLAG_V = VFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_and_32_er_ix:
+   {
+      m68ki_discard_lazy_flags();
+      FLAG_Z = DX &= OPER_AY_IX_32();
+
+      FLAG_N = NFLAG_32(FLAG_Z);
+      FLAG_C = CFLAG_CLEAR;
+      FLAG_V = VFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_and_32_er_aw:
+   {
+      m68ki_discard_lazy_flags();
+      FLAG_Z = DX &= OPER_AW_32();
+
+      FLAG_N = NFLAG_32(FLAG_Z);
+      FLAG_C = CFLAG_CLEAR;
+      FLAG_V = VFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_and_32_er_al:
+   {
+      m68ki_discard_lazy_flags();
+      FLAG_Z = DX &= OPER_AL_32();
+
+      FLAG_N = NFLAG_32(FLAG_Z);
+      FLAG_C = CFLAG_CLEAR;
+      FLAG_V = VFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_and_32_er_pcdi:
+   {
+      m68ki_discard_lazy_flags();
+      FLAG_Z = DX &= OPER_PCDI_32();
+
+      FLAG_N = NFLAG_32(FLAG_Z);
+      FLAG_C = CFLAG_CLEAR;
+      FLAG_V = VFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_and_32_er_pcix:
+   {
+      m68ki_discard_lazy_flags();
+      FLAG_Z = DX &= OPER_PCIX_32();
+
+      FLAG_N = NFLAG_32(FLAG_Z);
+      FLAG_C = CFLAG_CLEAR;
+      FLAG_V = VFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_and_32_er_i:
+   {
+      m68ki_discard_lazy_flags();
+      FLAG_Z = DX &= OPER_I_32();
+
+      FLAG_N = NFLAG_32(FLAG_Z);
+      FLAG_C = CFLAG_CLEAR;
+      FLAG_V = VFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_and_8_re_ai:
+   {
+      uint ea = EA_AY_AI_8();
+      uint res = DX & m68ki_read_8(ea);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_8(res);
+      FLAG_C = CFLAG_CLEAR;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_Z = MASK_OUT_ABOVE_8(res);
+
+      m68ki_write_8(ea, FLAG_Z);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_and_8_re_pi:
+   {
+      uint ea = EA_AY_PI_8();
+      uint res = DX & m68ki_read_8(ea);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_8(res);
+      FLAG_C = CFLAG_CLEAR;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_Z = MASK_OUT_ABOVE_8(res);
+
+      m68ki_write_8(ea, FLAG_Z);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_and_8_re_pi7:
+   {
+      uint ea = EA_A7_PI_8();
+      uint res = DX & m68ki_read_8(ea);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_8(res);
+      FLAG_C = CFLAG_CLEAR;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_Z = MASK_OUT_ABOVE_8(res);
+
+      m68ki_write_8(ea, FLAG_Z);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_and_8_re_pd:
+   {
+      uint ea = EA_AY_PD_8();
+      uint res = DX & m68ki_read_8(ea);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_8(res);
+      FLAG_C = CFLAG_CLEAR;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_Z = MASK_OUT_ABOVE_8(res);
+
+      m68ki_write_8(ea, FLAG_Z);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_and_8_re_pd7:
+   {
+      uint ea = EA_A7_PD_8();
+      uint res = DX & m68ki_read_8(ea);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_8(res);
+      FLAG_C = CFLAG_CLEAR;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_Z = MASK_OUT_ABOVE_8(res);
+
+      m68ki_write_8(ea, FLAG_Z);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_and_8_re_di:
+   {
+      uint ea = EA_AY_DI_8();
+      uint res = DX & m68ki_read_8(ea);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_8(res);
+      FLAG_C = CFLAG_CLEAR;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_Z = MASK_OUT_ABOVE_8(res);
+
+      m68ki_write_8(ea, FLAG_Z);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_and_8_re_ix:
+   {
+      uint ea = EA_AY_IX_8();
+      uint res = DX & m68ki_read_8(ea);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_8(res);
+      FLAG_C = CFLAG_CLEAR;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_Z = MASK_OUT_ABOVE_8(res);
+
+      m68ki_write_8(ea, FLAG_Z);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_and_8_re_aw:
+   {
+      uint ea = EA_AW_8();
+      uint res = DX & m68ki_read_8(ea);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_8(res);
+      FLAG_C = CFLAG_CLEAR;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_Z = MASK_OUT_ABOVE_8(res);
+
+      m68ki_write_8(ea, FLAG_Z);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_and_8_re_al:
+   {
+      uint ea = EA_AL_8();
+      uint res = DX & m68ki_read_8(ea);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_8(res);
+      FLAG_C = CFLAG_CLEAR;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_Z = MASK_OUT_ABOVE_8(res);
+
+      m68ki_write_8(ea, FLAG_Z);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_and_16_re_ai:
+   {
+      uint ea = EA_AY_AI_16();
+      uint res = DX & m68ki_read_16(ea);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_16(res);
+      FLAG_C = CFLAG_CLEAR;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_Z = MASK_OUT_ABOVE_16(res);
+
+      m68ki_write_16(ea, FLAG_Z);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_and_16_re_pi:
+   {
+      uint ea = EA_AY_PI_16();
+      uint res = DX & m68ki_read_16(ea);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_16(res);
+      FLAG_C = CFLAG_CLEAR;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_Z = MASK_OUT_ABOVE_16(res);
+
+      m68ki_write_16(ea, FLAG_Z);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_and_16_re_pd:
+   {
+      uint ea = EA_AY_PD_16();
+      uint res = DX & m68ki_read_16(ea);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_16(res);
+      FLAG_C = CFLAG_CLEAR;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_Z = MASK_OUT_ABOVE_16(res);
+
+      m68ki_write_16(ea, FLAG_Z);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_and_16_re_di:
+   {
+      uint ea = EA_AY_DI_16();
+      uint res = DX & m68ki_read_16(ea);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_16(res);
+      FLAG_C = CFLAG_CLEAR;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_Z = MASK_OUT_ABOVE_16(res);
+
+      m68ki_write_16(ea, FLAG_Z);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_and_16_re_ix:
+   {
+      uint ea = EA_AY_IX_16();
+      uint res = DX & m68ki_read_16(ea);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_16(res);
+      FLAG_C = CFLAG_CLEAR;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_Z = MASK_OUT_ABOVE_16(res);
+
+      m68ki_write_16(ea, FLAG_Z);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_and_16_re_aw:
+   {
+      uint ea = EA_AW_16();
+      uint res = DX & m68ki_read_16(ea);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_16(res);
+      FLAG_C = CFLAG_CLEAR;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_Z = MASK_OUT_ABOVE_16(res);
+
+      m68ki_write_16(ea, FLAG_Z);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_and_16_re_al:
+   {
+      uint ea = EA_AL_16();
+      uint res = DX & m68ki_read_16(ea);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_16(res);
+      FLAG_C = CFLAG_CLEAR;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_Z = MASK_OUT_ABOVE_16(res);
+
+      m68ki_write_16(ea, FLAG_Z);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_and_32_re_ai:
+   {
+      uint ea = EA_AY_AI_32();
+      uint res = DX & m68ki_read_32(ea);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_32(res);
+      FLAG_Z = res;
+      FLAG_C = CFLAG_CLEAR;
+      FLAG_V = VFLAG_CLEAR;
+
+      m68ki_write_32(ea, res);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_and_32_re_pi:
+   {
+      uint ea = EA_AY_PI_32();
+      uint res = DX & m68ki_read_32(ea);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_32(res);
+      FLAG_Z = res;
+      FLAG_C = CFLAG_CLEAR;
+      FLAG_V = VFLAG_CLEAR;
+
+      m68ki_write_32(ea, res);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_and_32_re_pd:
+   {
+      uint ea = EA_AY_PD_32();
+      uint res = DX & m68ki_read_32(ea);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_32(res);
+      FLAG_Z = res;
+      FLAG_C = CFLAG_CLEAR;
+      FLAG_V = VFLAG_CLEAR;
+
+      m68ki_write_32(ea, res);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_and_32_re_di:
+   {
+      uint ea = EA_AY_DI_32();
+      uint res = DX & m68ki_read_32(ea);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_32(res);
+      FLAG_Z = res;
+      FLAG_C = CFLAG_CLEAR;
+      FLAG_V = VFLAG_CLEAR;
+
+      m68ki_write_32(ea, res);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_and_32_re_ix:
+   {
+      uint ea = EA_AY_IX_32();
+      uint res = DX & m68ki_read_32(ea);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_32(res);
+      FLAG_Z = res;
+      FLAG_C = CFLAG_CLEAR;
+      FLAG_V = VFLAG_CLEAR;
+
+      m68ki_write_32(ea, res);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_and_32_re_aw:
+   {
+      uint ea = EA_AW_32();
+      uint res = DX & m68ki_read_32(ea);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_32(res);
+      FLAG_Z = res;
+      FLAG_C = CFLAG_CLEAR;
+      FLAG_V = VFLAG_CLEAR;
+
+      m68ki_write_32(ea, res);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_and_32_re_al:
+   {
+      uint ea = EA_AL_32();
+      uint res = DX & m68ki_read_32(ea);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_32(res);
+      FLAG_Z = res;
+      FLAG_C = CFLAG_CLEAR;
+      FLAG_V = VFLAG_CLEAR;
+
+      m68ki_write_32(ea, res);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_andi_8_d:
+   {
+      m68ki_discard_lazy_flags();
+      FLAG_Z = MASK_OUT_ABOVE_8(DY &= (OPER_I_8() | 0xffffff00));
+
+      FLAG_N = NFLAG_8(FLAG_Z);
+      FLAG_C = CFLAG_CLEAR;
+      FLAG_V = VFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_andi_8_ai:
+   {
+      uint src = OPER_I_8();
+      uint ea = EA_AY_AI_8();
+      uint res = src & m68ki_read_8(ea);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_8(res);
+      FLAG_Z = res;
+      FLAG_C = CFLAG_CLEAR;
+      FLAG_V = VFLAG_CLEAR;
+
+      m68ki_write_8(ea, res);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_andi_8_pi:
+   {
+      uint src = OPER_I_8();
+      uint ea = EA_AY_PI_8();
+      uint res = src & m68ki_read_8(ea);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_8(res);
+      FLAG_Z = res;
+      FLAG_C = CFLAG_CLEAR;
+      FLAG_V = VFLAG_CLEAR;
+
+      m68ki_write_8(ea, res);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_andi_8_pi7:
+   {
+      uint src = OPER_I_8();
+      uint ea = EA_A7_PI_8();
+      uint res = src & m68ki_read_8(ea);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_8(res);
+      FLAG_Z = res;
+      FLAG_C = CFLAG_CLEAR;
+      FLAG_V = VFLAG_CLEAR;
+
+      m68ki_write_8(ea, res);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_andi_8_pd:
+   {
+      uint src = OPER_I_8();
+      uint ea = EA_AY_PD_8();
+      uint res = src & m68ki_read_8(ea);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_8(res);
+      FLAG_Z = res;
+      FLAG_C = CFLAG_CLEAR;
+      FLAG_V = VFLAG_CLEAR;
+
+      m68ki_write_8(ea, res);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_andi_8_pd7:
+   {
+      uint src = OPER_I_8();
+      uint ea = EA_A7_PD_8();
+      uint res = src & m68ki_read_8(ea);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_8(res);
+      FLAG_Z = res;
+      FLAG_C = CFLAG_CLEAR;
+      FLAG_V = VFLAG_CLEAR;
+
+      m68ki_write_8(ea, res);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_andi_8_di:
+   {
+      uint src = OPER_I_8();
+      uint ea = EA_AY_DI_8();
+      uint res = src & m68ki_read_8(ea);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_8(res);
+      FLAG_Z = res;
+      FLAG_C = CFLAG_CLEAR;
+      FLAG_V = VFLAG_CLEAR;
+
+      m68ki_write_8(ea, res);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_andi_8_ix:
+   {
+      uint src = OPER_I_8();
+      uint ea = EA_AY_IX_8();
+      uint res = src & m68ki_read_8(ea);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_8(res);
+      FLAG_Z = res;
+      FLAG_C = CFLAG_CLEAR;
+      FLAG_V = VFLAG_CLEAR;
+
+      m68ki_write_8(ea, res);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_andi_8_aw:
+   {
+      uint src = OPER_I_8();
+      uint ea = EA_AW_8();
+      uint res = src & m68ki_read_8(ea);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_8(res);
+      FLAG_Z = res;
+      FLAG_C = CFLAG_CLEAR;
+      FLAG_V = VFLAG_CLEAR;
+
+      m68ki_write_8(ea, res);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_andi_8_al:
+   {
+      uint src = OPER_I_8();
+      uint ea = EA_AL_8();
+      uint res = src & m68ki_read_8(ea);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_8(res);
+      FLAG_Z = res;
+      FLAG_C = CFLAG_CLEAR;
+      FLAG_V = VFLAG_CLEAR;
+
+      m68ki_write_8(ea, res);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_andi_16_d:
+   {
+      m68ki_discard_lazy_flags();
+      FLAG_Z = MASK_OUT_ABOVE_16(DY &= (OPER_I_16() | 0xffff0000));
+
+      FLAG_N = NFLAG_16(FLAG_Z);
+      FLAG_C = CFLAG_CLEAR;
+      FLAG_V = VFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_andi_16_ai:
+   {
+      uint src = OPER_I_16();
+      uint ea = EA_AY_AI_16();
+      uint res = src & m68ki_read_16(ea);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_16(res);
+      FLAG_Z = res;
+      FLAG_C = CFLAG_CLEAR;
+      FLAG_V = VFLAG_CLEAR;
+
+      m68ki_write_16(ea, res);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_andi_16_pi:
+   {
+      uint src = OPER_I_16();
+      uint ea = EA_AY_PI_16();
+      uint res = src & m68ki_read_16(ea);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_16(res);
+      FLAG_Z = res;
+      FLAG_C = CFLAG_CLEAR;
+      FLAG_V = VFLAG_CLEAR;
+
+      m68ki_write_16(ea, res);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_andi_16_pd:
+   {
+      uint src = OPER_I_16();
+      uint ea = EA_AY_PD_16();
+      uint res = src & m68ki_read_16(ea);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_16(res);
+      FLAG_Z = res;
+      FLAG_C = CFLAG_CLEAR;
+      FLAG_V = VFLAG_CLEAR;
+
+      m68ki_write_16(ea, res);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_andi_16_di:
+   {
+      uint src = OPER_I_16();
+      uint ea = EA_AY_DI_16();
+      uint res = src & m68ki_read_16(ea);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_16(res);
+      FLAG_Z = res;
+      FLAG_C = CFLAG_CLEAR;
+      FLAG_V = VFLAG_CLEAR;
+
+      m68ki_write_16(ea, res);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_andi_16_ix:
+   {
+      uint src = OPER_I_16();
+      uint ea = EA_AY_IX_16();
+      uint res = src & m68ki_read_16(ea);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_16(res);
+      FLAG_Z = res;
+      FLAG_C = CFLAG_CLEAR;
+      FLAG_V = VFLAG_CLEAR;
+
+      m68ki_write_16(ea, res);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_andi_16_aw:
+   {
+      uint src = OPER_I_16();
+      uint ea = EA_AW_16();
+      uint res = src & m68ki_read_16(ea);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_16(res);
+      FLAG_Z = res;
+      FLAG_C = CFLAG_CLEAR;
+      FLAG_V = VFLAG_CLEAR;
+
+      m68ki_write_16(ea, res);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_andi_16_al:
+   {
+      uint src = OPER_I_16();
+      uint ea = EA_AL_16();
+      uint res = src & m68ki_read_16(ea);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_16(res);
+      FLAG_Z = res;
+      FLAG_C = CFLAG_CLEAR;
+      FLAG_V = VFLAG_CLEAR;
+
+      m68ki_write_16(ea, res);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_andi_32_d:
+   {
+      m68ki_discard_lazy_flags();
+      FLAG_Z = DY &= (OPER_I_32());
+
+      FLAG_N = NFLAG_32(FLAG_Z);
+      FLAG_C = CFLAG_CLEAR;
+      FLAG_V = VFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_andi_32_ai:
+   {
+      uint src = OPER_I_32();
+      uint ea = EA_AY_AI_32();
+      uint res = src & m68ki_read_32(ea);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_32(res);
+      FLAG_Z = res;
+      FLAG_C = CFLAG_CLEAR;
+      FLAG_V = VFLAG_CLEAR;
+
+      m68ki_write_32(ea, res);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_andi_32_pi:
+   {
+      uint src = OPER_I_32();
+      uint ea = EA_AY_PI_32();
+      uint res = src & m68ki_read_32(ea);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_32(res);
+      FLAG_Z = res;
+      FLAG_C = CFLAG_CLEAR;
+      FLAG_V = VFLAG_CLEAR;
+
+      m68ki_write_32(ea, res);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_andi_32_pd:
+   {
+      uint src = OPER_I_32();
+      uint ea = EA_AY_PD_32();
+      uint res = src & m68ki_read_32(ea);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_32(res);
+      FLAG_Z = res;
+      FLAG_C = CFLAG_CLEAR;
+      FLAG_V = VFLAG_CLEAR;
+
+      m68ki_write_32(ea, res);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_andi_32_di:
+   {
+      uint src = OPER_I_32();
+      uint ea = EA_AY_DI_32();
+      uint res = src & m68ki_read_32(ea);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_32(res);
+      FLAG_Z = res;
+      FLAG_C = CFLAG_CLEAR;
+      FLAG_V = VFLAG_CLEAR;
+
+      m68ki_write_32(ea, res);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_andi_32_ix:
+   {
+      uint src = OPER_I_32();
+      uint ea = EA_AY_IX_32();
+      uint res = src & m68ki_read_32(ea);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_32(res);
+      FLAG_Z = res;
+      FLAG_C = CFLAG_CLEAR;
+      FLAG_V = VFLAG_CLEAR;
+
+      m68ki_write_32(ea, res);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_andi_32_aw:
+   {
+      uint src = OPER_I_32();
+      uint ea = EA_AW_32();
+      uint res = src & m68ki_read_32(ea);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_32(res);
+      FLAG_Z = res;
+      FLAG_C = CFLAG_CLEAR;
+      FLAG_V = VFLAG_CLEAR;
+
+      m68ki_write_32(ea, res);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_andi_32_al:
+   {
+      uint src = OPER_I_32();
+      uint ea = EA_AL_32();
+      uint res = src & m68ki_read_32(ea);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_32(res);
+      FLAG_Z = res;
+      FLAG_C = CFLAG_CLEAR;
+      FLAG_V = VFLAG_CLEAR;
+
+      m68ki_write_32(ea, res);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_andi_8_toc:
+   {
+      m68ki_set_ccr(m68ki_get_ccr() & OPER_I_8());
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_andi_16_tos:
+   {
+      if(FLAG_S)
+      {
+         uint src = OPER_I_16();
+         m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
+         m68ki_set_sr(m68ki_get_sr() & src);
+         goto m68k_op_andi_16_tos_done;
+      }
+      m68ki_exception_privilege_violation();
+   }
+m68k_op_andi_16_tos_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_asr_8_s:
+   {
+      uint* r_dst = &DY;
+      uint shift = (((REG_IR >> 9) - 1) & 7) + 1;
+      uint src = MASK_OUT_ABOVE_8(*r_dst);
+      uint res = src >> shift;
+
+      if(GET_MSB_8(src))
+         res |= m68ki_shift_8_table[shift];
+
+      *r_dst = MASK_OUT_BELOW_8(*r_dst) | res;
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_8(res);
+      FLAG_Z = res;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_X = FLAG_C = src << (9-shift);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_asr_16_s:
+   {
+      uint* r_dst = &DY;
+      uint shift = (((REG_IR >> 9) - 1) & 7) + 1;
+      uint src = MASK_OUT_ABOVE_16(*r_dst);
+      uint res = src >> shift;
+
+      if(GET_MSB_16(src))
+         res |= m68ki_shift_16_table[shift];
+
+      *r_dst = MASK_OUT_BELOW_16(*r_dst) | res;
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_16(res);
+      FLAG_Z = res;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_X = FLAG_C = src << (9-shift);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_asr_32_s:
+   {
+      uint* r_dst = &DY;
+      uint shift = (((REG_IR >> 9) - 1) & 7) + 1;
+      uint src = *r_dst;
+      uint res = src >> shift;
+
+      if(GET_MSB_32(src))
+         res |= m68ki_shift_32_table[shift];
+
+      *r_dst = res;
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_32(res);
+      FLAG_Z = res;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_X = FLAG_C = src << (9-shift);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_asr_8_r:
+   {
+      uint* r_dst = &DY;
+      uint shift = DX & 0x3f;
+      uint src = MASK_OUT_ABOVE_8(*r_dst);
+      uint res = src >> shift;
+
+      m68ki_resolve_flags();
+
+      if(shift != 0)
+      {
+         USE_CYCLES(shift<<CYC_SHIFT);
+
+         if(shift < 8)
+         {
+            if(GET_MSB_8(src))
+               res |= m68ki_shift_8_table[shift];
+
+            *r_dst = MASK_OUT_BELOW_8(*r_dst) | res;
+
+            FLAG_X = FLAG_C = src << (9-shift);
+            FLAG_N = NFLAG_8(res);
+            FLAG_Z = res;
+            FLAG_V = VFLAG_CLEAR;
+            goto m68k_op_asr_8_r_done;
+         }
+
+         if(GET_MSB_8(src))
+         {
+            *r_dst |= 0xff;
+            FLAG_C = CFLAG_SET;
+            FLAG_X = XFLAG_SET;
+            FLAG_N = NFLAG_SET;
+            FLAG_Z = ZFLAG_CLEAR;
+            FLAG_V = VFLAG_CLEAR;
+            goto m68k_op_asr_8_r_done;
+         }
+
+         *r_dst &= 0xffffff00;
+         FLAG_C = CFLAG_CLEAR;
+         FLAG_X = XFLAG_CLEAR;
+         FLAG_N = NFLAG_CLEAR;
+         FLAG_Z = ZFLAG_SET;
+         FLAG_V = VFLAG_CLEAR;
+         goto m68k_op_asr_8_r_done;
+      }
+
+      FLAG_C = CFLAG_CLEAR;
+      FLAG_N = NFLAG_8(src);
+      FLAG_Z = src;
+      FLAG_V = VFLAG_CLEAR;
+   }
+m68k_op_asr_8_r_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_asr_16_r:
+   {
+      uint* r_dst = &DY;
+      uint shift = DX & 0x3f;
+      uint src = MASK_OUT_ABOVE_16(*r_dst);
+      uint res = src >> shift;
+
+      m68ki_resolve_flags();
+
+      if(shift != 0)
+      {
+         USE_CYCLES(shift<<CYC_SHIFT);
+
+         if(shift < 16)
+         {
+            if(GET_MSB_16(src))
+               res |= m68ki_shift_16_table[shift];
+
+            *r_dst = MASK_OUT_BELOW_16(*r_dst) | res;
+
+            FLAG_C = FLAG_X = (src >> (shift - 1))<<8;
+            FLAG_N = NFLAG_16(res);
+            FLAG_Z = res;
+            FLAG_V = VFLAG_CLEAR;
+            goto m68k_op_asr_16_r_done;
+         }
+
+         if(GET_MSB_16(src))
+         {
+            *r_dst |= 0xffff;
+            FLAG_C = CFLAG_SET;
+            FLAG_X = XFLAG_SET;
+            FLAG_N = NFLAG_SET;
+            FLAG_Z = ZFLAG_CLEAR;
+            FLAG_V = VFLAG_CLEAR;
+            goto m68k_op_asr_16_r_done;
+         }
+
+         *r_dst &= 0xffff0000;
+         FLAG_C = CFLAG_CLEAR;
+         FLAG_X = XFLAG_CLEAR;
+         FLAG_N = NFLAG_CLEAR;
+         FLAG_Z = ZFLAG_SET;
+         FLAG_V = VFLAG_CLEAR;
+         goto m68k_op_asr_16_r_done;
+      }
+
+      FLAG_C = CFLAG_CLEAR;
+      FLAG_N = NFLAG_16(src);
+      FLAG_Z = src;
+      FLAG_V = VFLAG_CLEAR;
+   }
+m68k_op_asr_16_r_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_asr_32_r:
+   {
+      uint* r_dst = &DY;
+      uint shift = DX & 0x3f;
+      uint src = *r_dst;
+      uint res = src >> shift;
+
+      m68ki_resolve_flags();
+
+      if(shift != 0)
+      {
+         USE_CYCLES(shift<<CYC_SHIFT);
+
+         if(shift < 32)
+         {
+            if(GET_MSB_32(src))
+               res |= m68ki_shift_32_table[shift];
+
+            *r_dst = res;
+
+            FLAG_C = FLAG_X = (src >> (shift - 1))<<8;
+            FLAG_N = NFLAG_32(res);
+            FLAG_Z = res;
+            FLAG_V = VFLAG_CLEAR;
+            goto m68k_op_asr_32_r_done;
+         }
+
+         if(GET_MSB_32(src))
+         {
+            *r_dst = 0xffffffff;
+            FLAG_C = CFLAG_SET;
+            FLAG_X = XFLAG_SET;
+            FLAG_N = NFLAG_SET;
+            FLAG_Z = ZFLAG_CLEAR;
+            FLAG_V = VFLAG_CLEAR;
+            goto m68k_op_asr_32_r_done;
+         }
+
+         *r_dst = 0;
+         FLAG_C = CFLAG_CLEAR;
+         FLAG_X = XFLAG_CLEAR;
+         FLAG_N = NFLAG_CLEAR;
+         FLAG_Z = ZFLAG_SET;
+         FLAG_V = VFLAG_CLEAR;
+         goto m68k_op_asr_32_r_done;
+      }
+
+      FLAG_C = CFLAG_CLEAR;
+      FLAG_N = NFLAG_32(src);
+      FLAG_Z = src;
+      FLAG_V = VFLAG_CLEAR;
+   }
+m68k_op_asr_32_r_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_asr_16_ai:
+   {
+      uint ea = EA_AY_AI_16();
+      uint src = m68ki_read_16(ea);
+      uint res = src >> 1;
+
+      if(GET_MSB_16(src))
+         res |= 0x8000;
+
+      m68ki_write_16(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_16(res);
+      FLAG_Z = res;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = FLAG_X = src << 8;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_asr_16_pi:
+   {
+      uint ea = EA_AY_PI_16();
+      uint src = m68ki_read_16(ea);
+      uint res = src >> 1;
+
+      if(GET_MSB_16(src))
+         res |= 0x8000;
+
+      m68ki_write_16(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_16(res);
+      FLAG_Z = res;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = FLAG_X = src << 8;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_asr_16_pd:
+   {
+      uint ea = EA_AY_PD_16();
+      uint src = m68ki_read_16(ea);
+      uint res = src >> 1;
+
+      if(GET_MSB_16(src))
+         res |= 0x8000;
+
+      m68ki_write_16(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_16(res);
+      FLAG_Z = res;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = FLAG_X = src << 8;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_asr_16_di:
+   {
+      uint ea = EA_AY_DI_16();
+      uint src = m68ki_read_16(ea);
+      uint res = src >> 1;
+
+      if(GET_MSB_16(src))
+         res |= 0x8000;
+
+      m68ki_write_16(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_16(res);
+      FLAG_Z = res;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = FLAG_X = src << 8;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_asr_16_ix:
+   {
+      uint ea = EA_AY_IX_16();
+      uint src = m68ki_read_16(ea);
+      uint res = src >> 1;
+
+      if(GET_MSB_16(src))
+         res |= 0x8000;
+
+      m68ki_write_16(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_16(res);
+      FLAG_Z = res;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = FLAG_X = src << 8;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_asr_16_aw:
+   {
+      uint ea = EA_AW_16();
+      uint src = m68ki_read_16(ea);
+      uint res = src >> 1;
+
+      if(GET_MSB_16(src))
+         res |= 0x8000;
+
+      m68ki_write_16(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_16(res);
+      FLAG_Z = res;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = FLAG_X = src << 8;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_asr_16_al:
+   {
+      uint ea = EA_AL_16();
+      uint src = m68ki_read_16(ea);
+      uint res = src >> 1;
+
+      if(GET_MSB_16(src))
+         res |= 0x8000;
+
+      m68ki_write_16(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_16(res);
+      FLAG_Z = res;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = FLAG_X = src << 8;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_asl_8_s:
+   {
+      uint* r_dst = &DY;
+      uint shift = (((REG_IR >> 9) - 1) & 7) + 1;
+      uint src = MASK_OUT_ABOVE_8(*r_dst);
+      uint res = MASK_OUT_ABOVE_8(src << shift);
+
+      m68ki_resolve_flags();
+
+      *r_dst = MASK_OUT_BELOW_8(*r_dst) | res;
+
+      FLAG_X = FLAG_C = src << shift;
+      FLAG_N = NFLAG_8(res);
+      FLAG_Z = res;
+      src &= m68ki_shift_8_table[shift + 1];
+      FLAG_V = (!(src == 0 || (src == m68ki_shift_8_table[shift + 1] && shift < 8)))<<7;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_asl_16_s:
+   {
+      uint* r_dst = &DY;
+      uint shift = (((REG_IR >> 9) - 1) & 7) + 1;
+      uint src = MASK_OUT_ABOVE_16(*r_dst);
+      uint res = MASK_OUT_ABOVE_16(src << shift);
+
+      m68ki_resolve_flags();
+
+      *r_dst = MASK_OUT_BELOW_16(*r_dst) | res;
+
+      FLAG_N = NFLAG_16(res);
+      FLAG_Z = res;
+      FLAG_X = FLAG_C = src >> (8-shift);
+      src &= m68ki_shift_16_table[shift + 1];
+      FLAG_V = (!(src == 0 || src == m68ki_shift_16_table[shift + 1]))<<7;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_asl_32_s:
+   {
+      uint* r_dst = &DY;
+      uint shift = (((REG_IR >> 9) - 1) & 7) + 1;
+      uint src = *r_dst;
+      uint res = MASK_OUT_ABOVE_32(src << shift);
+
+      m68ki_resolve_flags();
+
+      *r_dst = res;
+
+      FLAG_N = NFLAG_32(res);
+      FLAG_Z = res;
+      FLAG_X = FLAG_C = src >> (24-shift);
+      src &= m68ki_shift_32_table[shift + 1];
+      FLAG_V = (!(src == 0 || src == m68ki_shift_32_table[shift + 1]))<<7;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_asl_8_r:
+   {
+      uint* r_dst = &DY;
+      uint shift = DX & 0x3f;
+      uint src = MASK_OUT_ABOVE_8(*r_dst);
+      uint res = MASK_OUT_ABOVE_8(src << shift);
+
+      m68ki_resolve_flags();
+
+      if(shift != 0)
+      {
+         USE_CYCLES(shift<<CYC_SHIFT);
+
+         if(shift < 8)
+         {
+            *r_dst = MASK_OUT_BELOW_8(*r_dst) | res;
+            FLAG_X = FLAG_C = src << shift;
+            FLAG_N = NFLAG_8(res);
+            FLAG_Z = res;
+            src &= m68ki_shift_8_table[shift + 1];
+            FLAG_V = (!(src == 0 || src == m68ki_shift_8_table[shift + 1]))<<7;
+            goto m68k_op_asl_8_r_done;
+         }
+
+         *r_dst &= 0xffffff00;
+         FLAG_X = FLAG_C = ((shift == 8 ? src & 1 : 0))<<8;
+         FLAG_N = NFLAG_CLEAR;
+         FLAG_Z = ZFLAG_SET;
+         FLAG_V = (!(src == 0))<<7;
+         goto m68k_op_asl_8_r_done;
+      }
+
+      FLAG_C = CFLAG_CLEAR;
+      FLAG_N = NFLAG_8(src);
+      FLAG_Z = src;
+      FLAG_V = VFLAG_CLEAR;
+   }
+m68k_op_asl_8_r_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_asl_16_r:
+   {
+      uint* r_dst = &DY;
+      uint shift = DX & 0x3f;
+      uint src = MASK_OUT_ABOVE_16(*r_dst);
+      uint res = MASK_OUT_ABOVE_16(src << shift);
+
+      m68ki_resolve_flags();
+
+      if(shift != 0)
+      {
+         USE_CYCLES(shift<<CYC_SHIFT);
+
+         if(shift < 16)
+         {
+            *r_dst = MASK_OUT_BELOW_16(*r_dst) | res;
+            FLAG_X = FLAG_C = (src << shift) >> 8;
+            FLAG_N = NFLAG_16(res);
+            FLAG_Z = res;
+            src &= m68ki_shift_16_table[shift + 1];
+            FLAG_V = (!(src == 0 || src == m68ki_shift_16_table[shift + 1]))<<7;
+            goto m68k_op_asl_16_r_done;
+         }
+
+         *r_dst &= 0xffff0000;
+         FLAG_X = FLAG_C = ((shift == 16 ? src & 1 : 0))<<8;
+         FLAG_N = NFLAG_CLEAR;
+         FLAG_Z = ZFLAG_SET;
+         FLAG_V = (!(src == 0))<<7;
+         goto m68k_op_asl_16_r_done;
+      }
+
+      FLAG_C = CFLAG_CLEAR;
+      FLAG_N = NFLAG_16(src);
+      FLAG_Z = src;
+      FLAG_V = VFLAG_CLEAR;
+   }
+m68k_op_asl_16_r_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_asl_32_r:
+   {
+      uint* r_dst = &DY;
+      uint shift = DX & 0x3f;
+      uint src = *r_dst;
+      uint res = MASK_OUT_ABOVE_32(src << shift);
+
+      m68ki_resolve_flags();
+
+      if(shift != 0)
+      {
+         USE_CYCLES(shift<<CYC_SHIFT);
+
+         if(shift < 32)
+         {
+            *r_dst = res;
+            FLAG_X = FLAG_C = (src >> (32 - shift)) << 8;
+            FLAG_N = NFLAG_32(res);
+            FLAG_Z = res;
+            src &= m68ki_shift_32_table[shift + 1];
+            FLAG_V = (!(src == 0 || src == m68ki_shift_32_table[shift + 1]))<<7;
+            goto m68k_op_asl_32_r_done;
+         }
+
+         *r_dst = 0;
+         FLAG_X = FLAG_C = ((shift == 32 ? src & 1 : 0))<<8;
+         FLAG_N = NFLAG_CLEAR;
+         FLAG_Z = ZFLAG_SET;
+         FLAG_V = (!(src == 0))<<7;
+         goto m68k_op_asl_32_r_done;
+      }
+
+      FLAG_C = CFLAG_CLEAR;
+      FLAG_N = NFLAG_32(src);
+      FLAG_Z = src;
+      FLAG_V = VFLAG_CLEAR;
+   }
+m68k_op_asl_32_r_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_asl_16_ai:
+   {
+      uint ea = EA_AY_AI_16();
+      uint src = m68ki_read_16(ea);
+      uint res = MASK_OUT_ABOVE_16(src << 1);
+
+      m68ki_resolve_flags();
+
+      m68ki_write_16(ea, res);
+
+      FLAG_N = NFLAG_16(res);
+      FLAG_Z = res;
+      FLAG_X = FLAG_C = src >> 7;
+      src &= 0xc000;
+      FLAG_V = (!(src == 0 || src == 0xc000))<<7;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_asl_16_pi:
+   {
+      uint ea = EA_AY_PI_16();
+      uint src = m68ki_read_16(ea);
+      uint res = MASK_OUT_ABOVE_16(src << 1);
+
+      m68ki_resolve_flags();
+
+      m68ki_write_16(ea, res);
+
+      FLAG_N = NFLAG_16(res);
+      FLAG_Z = res;
+      FLAG_X = FLAG_C = src >> 7;
+      src &= 0xc000;
+      FLAG_V = (!(src == 0 || src == 0xc000))<<7;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_asl_16_pd:
+   {
+      uint ea = EA_AY_PD_16();
+      uint src = m68ki_read_16(ea);
+      uint res = MASK_OUT_ABOVE_16(src << 1);
+
+      m68ki_resolve_flags();
+
+      m68ki_write_16(ea, res);
+
+      FLAG_N = NFLAG_16(res);
+      FLAG_Z = res;
+      FLAG_X = FLAG_C = src >> 7;
+      src &= 0xc000;
+      FLAG_V = (!(src == 0 || src == 0xc000))<<7;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_asl_16_di:
+   {
+      uint ea = EA_AY_DI_16();
+      uint src = m68ki_read_16(ea);
+      uint res = MASK_OUT_ABOVE_16(src << 1);
+
+      m68ki_resolve_flags();
+
+      m68ki_write_16(ea, res);
+
+      FLAG_N = NFLAG_16(res);
+      FLAG_Z = res;
+      FLAG_X = FLAG_C = src >> 7;
+      src &= 0xc000;
+      FLAG_V = (!(src == 0 || src == 0xc000))<<7;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_asl_16_ix:
+   {
+      uint ea = EA_AY_IX_16();
+      uint src = m68ki_read_16(ea);
+      uint res = MASK_OUT_ABOVE_16(src << 1);
+
+      m68ki_resolve_flags();
+
+      m68ki_write_16(ea, res);
+
+      FLAG_N = NFLAG_16(res);
+      FLAG_Z = res;
+      FLAG_X = FLAG_C = src >> 7;
+      src &= 0xc000;
+      FLAG_V = (!(src == 0 || src == 0xc000))<<7;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_asl_16_aw:
+   {
+      uint ea = EA_AW_16();
+      uint src = m68ki_read_16(ea);
+      uint res = MASK_OUT_ABOVE_16(src << 1);
+
+      m68ki_resolve_flags();
+
+      m68ki_write_16(ea, res);
+
+      FLAG_N = NFLAG_16(res);
+      FLAG_Z = res;
+      FLAG_X = FLAG_C = src >> 7;
+      src &= 0xc000;
+      FLAG_V = (!(src == 0 || src == 0xc000))<<7;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_asl_16_al:
+   {
+      uint ea = EA_AL_16();
+      uint src = m68ki_read_16(ea);
+      uint res = MASK_OUT_ABOVE_16(src << 1);
+
+      m68ki_resolve_flags();
+
+      m68ki_write_16(ea, res);
+
+      FLAG_N = NFLAG_16(res);
+      FLAG_Z = res;
+      FLAG_X = FLAG_C = src >> 7;
+      src &= 0xc000;
+      FLAG_V = (!(src == 0 || src == 0xc000))<<7;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_bhi_8:
+   {
+      m68ki_resolve_flags();
+      if(COND_HI())
+      {
+         m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
+         m68ki_branch_8(MASK_OUT_ABOVE_8(REG_IR));
+         goto m68k_op_bhi_8_done;
+      }
+      USE_CYCLES(CYC_BCC_NOTAKE_B);
+   }
+m68k_op_bhi_8_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_bls_8:
+   {
+      m68ki_resolve_flags();
+      if(COND_LS())
+      {
+         m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
+         m68ki_branch_8(MASK_OUT_ABOVE_8(REG_IR));
+         goto m68k_op_bls_8_done;
+      }
+      USE_CYCLES(CYC_BCC_NOTAKE_B);
+   }
+m68k_op_bls_8_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_bcc_8:
+   {
+      m68ki_resolve_flags();
+      if(COND_CC())
+      {
+         m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
+         m68ki_branch_8(MASK_OUT_ABOVE_8(REG_IR));
+         goto m68k_op_bcc_8_done;
+      }
+      USE_CYCLES(CYC_BCC_NOTAKE_B);
+   }
+m68k_op_bcc_8_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_bcs_8:
+   {
+      m68ki_resolve_flags();
+      if(COND_CS())
+      {
+         m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
+         m68ki_branch_8(MASK_OUT_ABOVE_8(REG_IR));
+         goto m68k_op_bcs_8_done;
+      }
+      USE_CYCLES(CYC_BCC_NOTAKE_B);
+   }
+m68k_op_bcs_8_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_bne_8:
+   {
+      m68ki_resolve_flags();
+      if(COND_NE())
+      {
+         m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
+         m68ki_branch_8(MASK_OUT_ABOVE_8(REG_IR));
+         goto m68k_op_bne_8_done;
+      }
+      USE_CYCLES(CYC_BCC_NOTAKE_B);
+   }
+m68k_op_bne_8_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_beq_8:
+   {
+      m68ki_resolve_flags();
+      if(COND_EQ())
+      {
+         m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
+         m68ki_branch_8(MASK_OUT_ABOVE_8(REG_IR));
+         goto m68k_op_beq_8_done;
+      }
+      USE_CYCLES(CYC_BCC_NOTAKE_B);
+   }
+m68k_op_beq_8_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_bvc_8:
+   {
+      m68ki_resolve_flags();
+      if(COND_VC())
+      {
+         m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
+         m68ki_branch_8(MASK_OUT_ABOVE_8(REG_IR));
+         goto m68k_op_bvc_8_done;
+      }
+      USE_CYCLES(CYC_BCC_NOTAKE_B);
+   }
+m68k_op_bvc_8_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_bvs_8:
+   {
+      m68ki_resolve_flags();
+      if(COND_VS())
+      {
+         m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
+         m68ki_branch_8(MASK_OUT_ABOVE_8(REG_IR));
+         goto m68k_op_bvs_8_done;
+      }
+      USE_CYCLES(CYC_BCC_NOTAKE_B);
+   }
+m68k_op_bvs_8_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_bpl_8:
+   {
+      m68ki_resolve_flags();
+      if(COND_PL())
+      {
+         m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
+         m68ki_branch_8(MASK_OUT_ABOVE_8(REG_IR));
+         goto m68k_op_bpl_8_done;
+      }
+      USE_CYCLES(CYC_BCC_NOTAKE_B);
+   }
+m68k_op_bpl_8_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_bmi_8:
+   {
+      m68ki_resolve_flags();
+      if(COND_MI())
+      {
+         m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
+         m68ki_branch_8(MASK_OUT_ABOVE_8(REG_IR));
+         goto m68k_op_bmi_8_done;
+      }
+      USE_CYCLES(CYC_BCC_NOTAKE_B);
+   }
+m68k_op_bmi_8_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_bge_8:
+   {
+      m68ki_resolve_flags();
+      if(COND_GE())
+      {
+         m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
+         m68ki_branch_8(MASK_OUT_ABOVE_8(REG_IR));
+         goto m68k_op_bge_8_done;
+      }
+      USE_CYCLES(CYC_BCC_NOTAKE_B);
+   }
+m68k_op_bge_8_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_blt_8:
+   {
+      m68ki_resolve_flags();
+      if(COND_LT())
+      {
+         m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
+         m68ki_branch_8(MASK_OUT_ABOVE_8(REG_IR));
+         goto m68k_op_blt_8_done;
+      }
+      USE_CYCLES(CYC_BCC_NOTAKE_B);
+   }
+m68k_op_blt_8_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_bgt_8:
+   {
+      m68ki_resolve_flags();
+      if(COND_GT())
+      {
+         m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
+         m68ki_branch_8(MASK_OUT_ABOVE_8(REG_IR));
+         goto m68k_op_bgt_8_done;
+      }
+      USE_CYCLES(CYC_BCC_NOTAKE_B);
+   }
+m68k_op_bgt_8_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_ble_8:
+   {
+      m68ki_resolve_flags();
+      if(COND_LE())
+      {
+         m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
+         m68ki_branch_8(MASK_OUT_ABOVE_8(REG_IR));
+         goto m68k_op_ble_8_done;
+      }
+      USE_CYCLES(CYC_BCC_NOTAKE_B);
+   }
+m68k_op_ble_8_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_bhi_16:
+   {
+      m68ki_resolve_flags();
+      if(COND_HI())
+      {
+         uint offset = OPER_I_16();
+         REG_PC -= 2;
+         m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
+         m68ki_branch_16(offset);
+         goto m68k_op_bhi_16_done;
+      }
+      REG_PC += 2;
+      USE_CYCLES(CYC_BCC_NOTAKE_W);
+   }
+m68k_op_bhi_16_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_bls_16:
+   {
+      m68ki_resolve_flags();
+      if(COND_LS())
+      {
+         uint offset = OPER_I_16();
+         REG_PC -= 2;
+         m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
+         m68ki_branch_16(offset);
+         goto m68k_op_bls_16_done;
+      }
+      REG_PC += 2;
+      USE_CYCLES(CYC_BCC_NOTAKE_W);
+   }
+m68k_op_bls_16_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_bcc_16:
+   {
+      m68ki_resolve_flags();
+      if(COND_CC())
+      {
+         uint offset = OPER_I_16();
+         REG_PC -= 2;
+         m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
+         m68ki_branch_16(offset);
+         goto m68k_op_bcc_16_done;
+      }
+      REG_PC += 2;
+      USE_CYCLES(CYC_BCC_NOTAKE_W);
+   }
+m68k_op_bcc_16_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_bcs_16:
+   {
+      m68ki_resolve_flags();
+      if(COND_CS())
+      {
+         uint offset = OPER_I_16();
+         REG_PC -= 2;
+         m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
+         m68ki_branch_16(offset);
+         goto m68k_op_bcs_16_done;
+      }
+      REG_PC += 2;
+      USE_CYCLES(CYC_BCC_NOTAKE_W);
+   }
+m68k_op_bcs_16_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_bne_16:
+   {
+      m68ki_resolve_flags();
+      if(COND_NE())
+      {
+         uint offset = OPER_I_16();
+         REG_PC -= 2;
+         m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
+         m68ki_branch_16(offset);
+         goto m68k_op_bne_16_done;
+      }
+      REG_PC += 2;
+      USE_CYCLES(CYC_BCC_NOTAKE_W);
+   }
+m68k_op_bne_16_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_beq_16:
+   {
+      m68ki_resolve_flags();
+      if(COND_EQ())
+      {
+         uint offset = OPER_I_16();
+         REG_PC -= 2;
+         m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
+         m68ki_branch_16(offset);
+         goto m68k_op_beq_16_done;
+      }
+      REG_PC += 2;
+      USE_CYCLES(CYC_BCC_NOTAKE_W);
+   }
+m68k_op_beq_16_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_bvc_16:
+   {
+      m68ki_resolve_flags();
+      if(COND_VC())
+      {
+         uint offset = OPER_I_16();
+         REG_PC -= 2;
+         m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
+         m68ki_branch_16(offset);
+         goto m68k_op_bvc_16_done;
+      }
+      REG_PC += 2;
+      USE_CYCLES(CYC_BCC_NOTAKE_W);
+   }
+m68k_op_bvc_16_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_bvs_16:
+   {
+      m68ki_resolve_flags();
+      if(COND_VS())
+      {
+         uint offset = OPER_I_16();
+         REG_PC -= 2;
+         m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
+         m68ki_branch_16(offset);
+         goto m68k_op_bvs_16_done;
+      }
+      REG_PC += 2;
+      USE_CYCLES(CYC_BCC_NOTAKE_W);
+   }
+m68k_op_bvs_16_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_bpl_16:
+   {
+      m68ki_resolve_flags();
+      if(COND_PL())
+      {
+         uint offset = OPER_I_16();
+         REG_PC -= 2;
+         m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
+         m68ki_branch_16(offset);
+         goto m68k_op_bpl_16_done;
+      }
+      REG_PC += 2;
+      USE_CYCLES(CYC_BCC_NOTAKE_W);
+   }
+m68k_op_bpl_16_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_bmi_16:
+   {
+      m68ki_resolve_flags();
+      if(COND_MI())
+      {
+         uint offset = OPER_I_16();
+         REG_PC -= 2;
+         m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
+         m68ki_branch_16(offset);
+         goto m68k_op_bmi_16_done;
+      }
+      REG_PC += 2;
+      USE_CYCLES(CYC_BCC_NOTAKE_W);
+   }
+m68k_op_bmi_16_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_bge_16:
+   {
+      m68ki_resolve_flags();
+      if(COND_GE())
+      {
+         uint offset = OPER_I_16();
+         REG_PC -= 2;
+         m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
+         m68ki_branch_16(offset);
+         goto m68k_op_bge_16_done;
+      }
+      REG_PC += 2;
+      USE_CYCLES(CYC_BCC_NOTAKE_W);
+   }
+m68k_op_bge_16_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_blt_16:
+   {
+      m68ki_resolve_flags();
+      if(COND_LT())
+      {
+         uint offset = OPER_I_16();
+         REG_PC -= 2;
+         m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
+         m68ki_branch_16(offset);
+         goto m68k_op_blt_16_done;
+      }
+      REG_PC += 2;
+      USE_CYCLES(CYC_BCC_NOTAKE_W);
+   }
+m68k_op_blt_16_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_bgt_16:
+   {
+      m68ki_resolve_flags();
+      if(COND_GT())
+      {
+         uint offset = OPER_I_16();
+         REG_PC -= 2;
+         m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
+         m68ki_branch_16(offset);
+         goto m68k_op_bgt_16_done;
+      }
+      REG_PC += 2;
+      USE_CYCLES(CYC_BCC_NOTAKE_W);
+   }
+m68k_op_bgt_16_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_ble_16:
+   {
+      m68ki_resolve_flags();
+      if(COND_LE())
+      {
+         uint offset = OPER_I_16();
+         REG_PC -= 2;
+         m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
+         m68ki_branch_16(offset);
+         goto m68k_op_ble_16_done;
+      }
+      REG_PC += 2;
+      USE_CYCLES(CYC_BCC_NOTAKE_W);
+   }
+m68k_op_ble_16_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_bhi_32:
+   {
+      m68ki_resolve_flags();
+      if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+      {
+         if(COND_HI())
+         {
+            uint offset = OPER_I_32();
+            REG_PC -= 4;
+            m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
+            m68ki_branch_32(offset);
+            goto m68k_op_bhi_32_done;
+         }
+         REG_PC += 4;
+         goto m68k_op_bhi_32_done;
+      }
+      m68ki_exception_illegal();
+   }
+m68k_op_bhi_32_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_bls_32:
+   {
+      m68ki_resolve_flags();
+      if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+      {
+         if(COND_LS())
+         {
+            uint offset = OPER_I_32();
+            REG_PC -= 4;
+            m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
+            m68ki_branch_32(offset);
+            goto m68k_op_bls_32_done;
+         }
+         REG_PC += 4;
+         goto m68k_op_bls_32_done;
+      }
+      m68ki_exception_illegal();
+   }
+m68k_op_bls_32_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_bcc_32:
+   {
+      m68ki_resolve_flags();
+      if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+      {
+         if(COND_CC())
+         {
+            uint offset = OPER_I_32();
+            REG_PC -= 4;
+            m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
+            m68ki_branch_32(offset);
+            goto m68k_op_bcc_32_done;
+         }
+         REG_PC += 4;
+         goto m68k_op_bcc_32_done;
+      }
+      m68ki_exception_illegal();
+   }
+m68k_op_bcc_32_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_bcs_32:
+   {
+      m68ki_resolve_flags();
+      if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+      {
+         if(COND_CS())
+         {
+            uint offset = OPER_I_32();
+            REG_PC -= 4;
+            m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
+            m68ki_branch_32(offset);
+            goto m68k_op_bcs_32_done;
+         }
+         REG_PC += 4;
+         goto m68k_op_bcs_32_done;
+      }
+      m68ki_exception_illegal();
+   }
+m68k_op_bcs_32_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_bne_32:
+   {
+      m68ki_resolve_flags();
+      if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+      {
+         if(COND_NE())
+         {
+            uint offset = OPER_I_32();
+            REG_PC -= 4;
+            m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
+            m68ki_branch_32(offset);
+            goto m68k_op_bne_32_done;
+         }
+         REG_PC += 4;
+         goto m68k_op_bne_32_done;
+      }
+      m68ki_exception_illegal();
+   }
+m68k_op_bne_32_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_beq_32:
+   {
+      m68ki_resolve_flags();
+      if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+      {
+         if(COND_EQ())
+         {
+            uint offset = OPER_I_32();
+            REG_PC -= 4;
+            m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
+            m68ki_branch_32(offset);
+            goto m68k_op_beq_32_done;
+         }
+         REG_PC += 4;
+         goto m68k_op_beq_32_done;
+      }
+      m68ki_exception_illegal();
+   }
+m68k_op_beq_32_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_bvc_32:
+   {
+      m68ki_resolve_flags();
+      if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+      {
+         if(COND_VC())
+         {
+            uint offset = OPER_I_32();
+            REG_PC -= 4;
+            m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
+            m68ki_branch_32(offset);
+            goto m68k_op_bvc_32_done;
+         }
+         REG_PC += 4;
+         goto m68k_op_bvc_32_done;
+      }
+      m68ki_exception_illegal();
+   }
+m68k_op_bvc_32_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_bvs_32:
+   {
+      m68ki_resolve_flags();
+      if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+      {
+         if(COND_VS())
+         {
+            uint offset = OPER_I_32();
+            REG_PC -= 4;
+            m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
+            m68ki_branch_32(offset);
+            goto m68k_op_bvs_32_done;
+         }
+         REG_PC += 4;
+         goto m68k_op_bvs_32_done;
+      }
+      m68ki_exception_illegal();
+   }
+m68k_op_bvs_32_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_bpl_32:
+   {
+      m68ki_resolve_flags();
+      if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+      {
+         if(COND_PL())
+         {
+            uint offset = OPER_I_32();
+            REG_PC -= 4;
+            m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
+            m68ki_branch_32(offset);
+            goto m68k_op_bpl_32_done;
+         }
+         REG_PC += 4;
+         goto m68k_op_bpl_32_done;
+      }
+      m68ki_exception_illegal();
+   }
+m68k_op_bpl_32_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_bmi_32:
+   {
+      m68ki_resolve_flags();
+      if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+      {
+         if(COND_MI())
+         {
+            uint offset = OPER_I_32();
+            REG_PC -= 4;
+            m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
+            m68ki_branch_32(offset);
+            goto m68k_op_bmi_32_done;
+         }
+         REG_PC += 4;
+         goto m68k_op_bmi_32_done;
+      }
+      m68ki_exception_illegal();
+   }
+m68k_op_bmi_32_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_bge_32:
+   {
+      m68ki_resolve_flags();
+      if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+      {
+         if(COND_GE())
+         {
+            uint offset = OPER_I_32();
+            REG_PC -= 4;
+            m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
+            m68ki_branch_32(offset);
+            goto m68k_op_bge_32_done;
+         }
+         REG_PC += 4;
+         goto m68k_op_bge_32_done;
+      }
+      m68ki_exception_illegal();
+   }
+m68k_op_bge_32_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_blt_32:
+   {
+      m68ki_resolve_flags();
+      if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+      {
+         if(COND_LT())
+         {
+            uint offset = OPER_I_32();
+            REG_PC -= 4;
+            m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
+            m68ki_branch_32(offset);
+            goto m68k_op_blt_32_done;
+         }
+         REG_PC += 4;
+         goto m68k_op_blt_32_done;
+      }
+      m68ki_exception_illegal();
+   }
+m68k_op_blt_32_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_bgt_32:
+   {
+      m68ki_resolve_flags();
+      if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+      {
+         if(COND_GT())
+         {
+            uint offset = OPER_I_32();
+            REG_PC -= 4;
+            m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
+            m68ki_branch_32(offset);
+            goto m68k_op_bgt_32_done;
+         }
+         REG_PC += 4;
+         goto m68k_op_bgt_32_done;
+      }
+      m68ki_exception_illegal();
+   }
+m68k_op_bgt_32_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_ble_32:
+   {
+      m68ki_resolve_flags();
+      if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+      {
+         if(COND_LE())
+         {
+            uint offset = OPER_I_32();
+            REG_PC -= 4;
+            m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
+            m68ki_branch_32(offset);
+            goto m68k_op_ble_32_done;
+         }
+         REG_PC += 4;
+         goto m68k_op_ble_32_done;
+      }
+      m68ki_exception_illegal();
+   }
+m68k_op_ble_32_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_bchg_32_r_d:
+   {
+      uint* r_dst = &DY;
+      uint mask = 1 << (DX & 0x1f);
+
+      m68ki_resolve_flags();
+
+      FLAG_Z = *r_dst & mask;
+      *r_dst ^= mask;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_bchg_8_r_ai:
+   {
+      uint ea = EA_AY_AI_8();
+      uint src = m68ki_read_8(ea);
+      uint mask = 1 << (DX & 7);
+
+      m68ki_resolve_flags();
+
+      FLAG_Z = src & mask;
+      m68ki_write_8(ea, src ^ mask);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_bchg_8_r_pi:
+   {
+      uint ea = EA_AY_PI_8();
+      uint src = m68ki_read_8(ea);
+      uint mask = 1 << (DX & 7);
+
+      m68ki_resolve_flags();
+
+      FLAG_Z = src & mask;
+      m68ki_write_8(ea, src ^ mask);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_bchg_8_r_pi7:
+   {
+      uint ea = EA_A7_PI_8();
+      uint src = m68ki_read_8(ea);
+      uint mask = 1 << (DX & 7);
+
+      m68ki_resolve_flags();
+
+      FLAG_Z = src & mask;
+      m68ki_write_8(ea, src ^ mask);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_bchg_8_r_pd:
+   {
+      uint ea = EA_AY_PD_8();
+      uint src = m68ki_read_8(ea);
+      uint mask = 1 << (DX & 7);
+
+      m68ki_resolve_flags();
+
+      FLAG_Z = src & mask;
+      m68ki_write_8(ea, src ^ mask);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_bchg_8_r_pd7:
+   {
+      uint ea = EA_A7_PD_8();
+      uint src = m68ki_read_8(ea);
+      uint mask = 1 << (DX & 7);
+
+      m68ki_resolve_flags();
+
+      FLAG_Z = src & mask;
+      m68ki_write_8(ea, src ^ mask);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_bchg_8_r_di:
+   {
+      uint ea = EA_AY_DI_8();
+      uint src = m68ki_read_8(ea);
+      uint mask = 1 << (DX & 7);
+
+      m68ki_resolve_flags();
+
+      FLAG_Z = src & mask;
+      m68ki_write_8(ea, src ^ mask);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_bchg_8_r_ix:
+   {
+      uint ea = EA_AY_IX_8();
+      uint src = m68ki_read_8(ea);
+      uint mask = 1 << (DX & 7);
+
+      m68ki_resolve_flags();
+
+      FLAG_Z = src & mask;
+      m68ki_write_8(ea, src ^ mask);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_bchg_8_r_aw:
+   {
+      uint ea = EA_AW_8();
+      uint src = m68ki_read_8(ea);
+      uint mask = 1 << (DX & 7);
+
+      m68ki_resolve_flags();
+
+      FLAG_Z = src & mask;
+      m68ki_write_8(ea, src ^ mask);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_bchg_8_r_al:
+   {
+      uint ea = EA_AL_8();
+      uint src = m68ki_read_8(ea);
+      uint mask = 1 << (DX & 7);
+
+      m68ki_resolve_flags();
+
+      FLAG_Z = src & mask;
+      m68ki_write_8(ea, src ^ mask);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_bchg_32_s_d:
+   {
+      uint* r_dst = &DY;
+      uint mask = 1 << (OPER_I_8() & 0x1f);
+
+      m68ki_resolve_flags();
+
+      FLAG_Z = *r_dst & mask;
+      *r_dst ^= mask;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_bchg_8_s_ai:
+   {
+      uint mask = 1 << (OPER_I_8() & 7);
+      uint ea = EA_AY_AI_8();
+      uint src = m68ki_read_8(ea);
+
+      m68ki_resolve_flags();
+
+      FLAG_Z = src & mask;
+      m68ki_write_8(ea, src ^ mask);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_bchg_8_s_pi:
+   {
+      uint mask = 1 << (OPER_I_8() & 7);
+      uint ea = EA_AY_PI_8();
+      uint src = m68ki_read_8(ea);
+
+      m68ki_resolve_flags();
+
+      FLAG_Z = src & mask;
+      m68ki_write_8(ea, src ^ mask);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_bchg_8_s_pi7:
+   {
+      uint mask = 1 << (OPER_I_8() & 7);
+      uint ea = EA_A7_PI_8();
+      uint src = m68ki_read_8(ea);
+
+      m68ki_resolve_flags();
+
+      FLAG_Z = src & mask;
+      m68ki_write_8(ea, src ^ mask);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_bchg_8_s_pd:
+   {
+      uint mask = 1 << (OPER_I_8() & 7);
+      uint ea = EA_AY_PD_8();
+      uint src = m68ki_read_8(ea);
+
+      m68ki_resolve_flags();
+
+      FLAG_Z = src & mask;
+      m68ki_write_8(ea, src ^ mask);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_bchg_8_s_pd7:
+   {
+      uint mask = 1 << (OPER_I_8() & 7);
+      uint ea = EA_A7_PD_8();
+      uint src = m68ki_read_8(ea);
+
+      m68ki_resolve_flags();
+
+      FLAG_Z = src & mask;
+      m68ki_write_8(ea, src ^ mask);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_bchg_8_s_di:
+   {
+      uint mask = 1 << (OPER_I_8() & 7);
+      uint ea = EA_AY_DI_8();
+      uint src = m68ki_read_8(ea);
+
+      m68ki_resolve_flags();
+
+      FLAG_Z = src & mask;
+      m68ki_write_8(ea, src ^ mask);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_bchg_8_s_ix:
+   {
+      uint mask = 1 << (OPER_I_8() & 7);
+      uint ea = EA_AY_IX_8();
+      uint src = m68ki_read_8(ea);
+
+      m68ki_resolve_flags();
+
+      FLAG_Z = src & mask;
+      m68ki_write_8(ea, src ^ mask);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_bchg_8_s_aw:
+   {
+      uint mask = 1 << (OPER_I_8() & 7);
+      uint ea = EA_AW_8();
+      uint src = m68ki_read_8(ea);
+
+      m68ki_resolve_flags();
+
+      FLAG_Z = src & mask;
+      m68ki_write_8(ea, src ^ mask);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_bchg_8_s_al:
+   {
+      uint mask = 1 << (OPER_I_8() & 7);
+      uint ea = EA_AL_8();
+      uint src = m68ki_read_8(ea);
+
+      m68ki_resolve_flags();
+
+      FLAG_Z = src & mask;
+      m68ki_write_8(ea, src ^ mask);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_bclr_32_r_d:
+   {
+      uint* r_dst = &DY;
+      uint mask = 1 << (DX & 0x1f);
+
+      m68ki_resolve_flags();
+
+      FLAG_Z = *r_dst & mask;
+      *r_dst &= ~mask;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_bclr_8_r_ai:
+   {
+      uint ea = EA_AY_AI_8();
+      uint src = m68ki_read_8(ea);
+      uint mask = 1 << (DX & 7);
+
+      m68ki_resolve_flags();
+
+      FLAG_Z = src & mask;
+      m68ki_write_8(ea, src & ~mask);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_bclr_8_r_pi:
+   {
+      uint ea = EA_AY_PI_8();
+      uint src = m68ki_read_8(ea);
+      uint mask = 1 << (DX & 7);
+
+      m68ki_resolve_flags();
+
+      FLAG_Z = src & mask;
+      m68ki_write_8(ea, src & ~mask);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_bclr_8_r_pi7:
+   {
+      uint ea = EA_A7_PI_8();
+      uint src = m68ki_read_8(ea);
+      uint mask = 1 << (DX & 7);
+
+      m68ki_resolve_flags();
+
+      FLAG_Z = src & mask;
+      m68ki_write_8(ea, src & ~mask);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_bclr_8_r_pd:
+   {
+      uint ea = EA_AY_PD_8();
+      uint src = m68ki_read_8(ea);
+      uint mask = 1 << (DX & 7);
+
+      m68ki_resolve_flags();
+
+      FLAG_Z = src & mask;
+      m68ki_write_8(ea, src & ~mask);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_bclr_8_r_pd7:
+   {
+      uint ea = EA_A7_PD_8();
+      uint src = m68ki_read_8(ea);
+      uint mask = 1 << (DX & 7);
+
+      m68ki_resolve_flags();
+
+      FLAG_Z = src & mask;
+      m68ki_write_8(ea, src & ~mask);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_bclr_8_r_di:
+   {
+      uint ea = EA_AY_DI_8();
+      uint src = m68ki_read_8(ea);
+      uint mask = 1 << (DX & 7);
+
+      m68ki_resolve_flags();
+
+      FLAG_Z = src & mask;
+      m68ki_write_8(ea, src & ~mask);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_bclr_8_r_ix:
+   {
+      uint ea = EA_AY_IX_8();
+      uint src = m68ki_read_8(ea);
+      uint mask = 1 << (DX & 7);
+
+      m68ki_resolve_flags();
+
+      FLAG_Z = src & mask;
+      m68ki_write_8(ea, src & ~mask);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_bclr_8_r_aw:
+   {
+      uint ea = EA_AW_8();
+      uint src = m68ki_read_8(ea);
+      uint mask = 1 << (DX & 7);
+
+      m68ki_resolve_flags();
+
+      FLAG_Z = src & mask;
+      m68ki_write_8(ea, src & ~mask);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_bclr_8_r_al:
+   {
+      uint ea = EA_AL_8();
+      uint src = m68ki_read_8(ea);
+      uint mask = 1 << (DX & 7);
+
+      m68ki_resolve_flags();
+
+      FLAG_Z = src & mask;
+      m68ki_write_8(ea, src & ~mask);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_bclr_32_s_d:
+   {
+      uint* r_dst = &DY;
+      uint mask = 1 << (OPER_I_8() & 0x1f);
+
+      m68ki_resolve_flags();
+
+      FLAG_Z = *r_dst & mask;
+      *r_dst &= ~mask;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_bclr_8_s_ai:
+   {
+      uint mask = 1 << (OPER_I_8() & 7);
+      uint ea = EA_AY_AI_8();
+      uint src = m68ki_read_8(ea);
+
+      m68ki_resolve_flags();
+
+      FLAG_Z = src & mask;
+      m68ki_write_8(ea, src & ~mask);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_bclr_8_s_pi:
+   {
+      uint mask = 1 << (OPER_I_8() & 7);
+      uint ea = EA_AY_PI_8();
+      uint src = m68ki_read_8(ea);
+
+      m68ki_resolve_flags();
+
+      FLAG_Z = src & mask;
+      m68ki_write_8(ea, src & ~mask);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_bclr_8_s_pi7:
+   {
+      uint mask = 1 << (OPER_I_8() & 7);
+      uint ea = EA_A7_PI_8();
+      uint src = m68ki_read_8(ea);
+
+      m68ki_resolve_flags();
+
+      FLAG_Z = src & mask;
+      m68ki_write_8(ea, src & ~mask);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_bclr_8_s_pd:
+   {
+      uint mask = 1 << (OPER_I_8() & 7);
+      uint ea = EA_AY_PD_8();
+      uint src = m68ki_read_8(ea);
+
+      m68ki_resolve_flags();
+
+      FLAG_Z = src & mask;
+      m68ki_write_8(ea, src & ~mask);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_bclr_8_s_pd7:
+   {
+      uint mask = 1 << (OPER_I_8() & 7);
+      uint ea = EA_A7_PD_8();
+      uint src = m68ki_read_8(ea);
+
+      m68ki_resolve_flags();
+
+      FLAG_Z = src & mask;
+      m68ki_write_8(ea, src & ~mask);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_bclr_8_s_di:
+   {
+      uint mask = 1 << (OPER_I_8() & 7);
+      uint ea = EA_AY_DI_8();
+      uint src = m68ki_read_8(ea);
+
+      m68ki_resolve_flags();
+
+      FLAG_Z = src & mask;
+      m68ki_write_8(ea, src & ~mask);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_bclr_8_s_ix:
+   {
+      uint mask = 1 << (OPER_I_8() & 7);
+      uint ea = EA_AY_IX_8();
+      uint src = m68ki_read_8(ea);
+
+      m68ki_resolve_flags();
+
+      FLAG_Z = src & mask;
+      m68ki_write_8(ea, src & ~mask);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_bclr_8_s_aw:
+   {
+      uint mask = 1 << (OPER_I_8() & 7);
+      uint ea = EA_AW_8();
+      uint src = m68ki_read_8(ea);
+
+      m68ki_resolve_flags();
+
+      FLAG_Z = src & mask;
+      m68ki_write_8(ea, src & ~mask);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_bclr_8_s_al:
+   {
+      uint mask = 1 << (OPER_I_8() & 7);
+      uint ea = EA_AL_8();
+      uint src = m68ki_read_8(ea);
+
+      m68ki_resolve_flags();
+
+      FLAG_Z = src & mask;
+      m68ki_write_8(ea, src & ~mask);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_bfchg_32_d:
+   {
+      m68ki_resolve_flags();
+      if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+      {
+         uint word2 = OPER_I_16();
+         uint offset = (word2>>6)&31;
+         uint width = word2;
+         uint* data = &DY;
+         uint64 mask;
+
+
+         if(BIT_B(word2))
+            offset = REG_D[offset&7];
+         if(BIT_5(word2))
+            width = REG_D[width&7];
+
+         offset &= 31;
+         width = ((width-1) & 31) + 1;
+
+         mask = MASK_OUT_ABOVE_32(0xffffffff << (32 - width));
+         mask = ROR_32(mask, offset);
+
+         FLAG_N = NFLAG_32(*data<<offset);
+         FLAG_Z = *data & mask;
+         FLAG_V = VFLAG_CLEAR;
+         FLAG_C = CFLAG_CLEAR;
+
+         *data ^= mask;
+
+         goto m68k_op_bfchg_32_d_done;
+      }
+      m68ki_exception_illegal();
+   }
+m68k_op_bfchg_32_d_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_bfchg_32_ai:
+   {
+      m68ki_resolve_flags();
+      if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+      {
+         uint word2 = OPER_I_16();
+         sint offset = (word2>>6)&31;
+         uint width = word2;
+         uint mask_base;
+         uint data_long;
+         uint mask_long;
+         uint data_byte = 0;
+         uint mask_byte = 0;
+         uint ea = EA_AY_AI_8();
+
+
+         if(BIT_B(word2))
+            offset = MAKE_INT_32(REG_D[offset&7]);
+         if(BIT_5(word2))
+            width = REG_D[width&7];
+
+         /* Offset is signed so we have to use ugly math =( */
+         ea += offset / 8;
+         offset %= 8;
+         if(offset < 0)
+         {
+            offset += 8;
+            ea--;
+         }
+         width = ((width-1) & 31) + 1;
+
+         mask_base = MASK_OUT_ABOVE_32(0xffffffff << (32 - width));
+         mask_long = mask_base >> offset;
+
+         data_long = m68ki_read_32(ea);
+         FLAG_N = NFLAG_32(data_long << offset);
+         FLAG_Z = data_long & mask_long;
+         FLAG_V = VFLAG_CLEAR;
+         FLAG_C = CFLAG_CLEAR;
+
+         m68ki_write_32(ea, data_long ^ mask_long);
+
+         if((width + offset) > 32)
+         {
+            mask_byte = MASK_OUT_ABOVE_8(mask_base);
+            data_byte = m68ki_read_8(ea+4);
+            FLAG_Z |= (data_byte & mask_byte);
+            m68ki_write_8(ea+4, data_byte ^ mask_byte);
+         }
+         goto m68k_op_bfchg_32_ai_done;
+      }
+      m68ki_exception_illegal();
+   }
+m68k_op_bfchg_32_ai_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_bfchg_32_di:
+   {
+      m68ki_resolve_flags();
+      if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+      {
+         uint word2 = OPER_I_16();
+         sint offset = (word2>>6)&31;
+         uint width = word2;
+         uint mask_base;
+         uint data_long;
+         uint mask_long;
+         uint data_byte = 0;
+         uint mask_byte = 0;
+         uint ea = EA_AY_DI_8();
+
+
+         if(BIT_B(word2))
+            offset = MAKE_INT_32(REG_D[offset&7]);
+         if(BIT_5(word2))
+            width = REG_D[width&7];
+
+         /* Offset is signed so we have to use ugly math =( */
+         ea += offset / 8;
+         offset %= 8;
+         if(offset < 0)
+         {
+            offset += 8;
+            ea--;
+         }
+         width = ((width-1) & 31) + 1;
+
+         mask_base = MASK_OUT_ABOVE_32(0xffffffff << (32 - width));
+         mask_long = mask_base >> offset;
+
+         data_long = m68ki_read_32(ea);
+         FLAG_N = NFLAG_32(data_long << offset);
+         FLAG_Z = data_long & mask_long;
+         FLAG_V = VFLAG_CLEAR;
+         FLAG_C = CFLAG_CLEAR;
+
+         m68ki_write_32(ea, data_long ^ mask_long);
+
+         if((width + offset) > 32)
+         {
+            mask_byte = MASK_OUT_ABOVE_8(mask_base);
+            data_byte = m68ki_read_8(ea+4);
+            FLAG_Z |= (data_byte & mask_byte);
+            m68ki_write_8(ea+4, data_byte ^ mask_byte);
+         }
+         goto m68k_op_bfchg_32_di_done;
+      }
+      m68ki_exception_illegal();
+   }
+m68k_op_bfchg_32_di_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_bfchg_32_ix:
+   {
+      m68ki_resolve_flags();
+      if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+      {
+         uint word2 = OPER_I_16();
+         sint offset = (word2>>6)&31;
+         uint width = word2;
+         uint mask_base;
+         uint data_long;
+         uint mask_long;
+         uint data_byte = 0;
+         uint mask_byte = 0;
+         uint ea = EA_AY_IX_8();
+
+
+         if(BIT_B(word2))
+            offset = MAKE_INT_32(REG_D[offset&7]);
+         if(BIT_5(word2))
+            width = REG_D[width&7];
+
+         /* Offset is signed so we have to use ugly math =( */
+         ea += offset / 8;
+         offset %= 8;
+         if(offset < 0)
+         {
+            offset += 8;
+            ea--;
+         }
+         width = ((width-1) & 31) + 1;
+
+         mask_base = MASK_OUT_ABOVE_32(0xffffffff << (32 - width));
+         mask_long = mask_base >> offset;
+
+         data_long = m68ki_read_32(ea);
+         FLAG_N = NFLAG_32(data_long << offset);
+         FLAG_Z = data_long & mask_long;
+         FLAG_V = VFLAG_CLEAR;
+         FLAG_C = CFLAG_CLEAR;
+
+         m68ki_write_32(ea, data_long ^ mask_long);
+
+         if((width + offset) > 32)
+         {
+            mask_byte = MASK_OUT_ABOVE_8(mask_base);
+            data_byte = m68ki_read_8(ea+4);
+            FLAG_Z |= (data_byte & mask_byte);
+            m68ki_write_8(ea+4, data_byte ^ mask_byte);
+         }
+         goto m68k_op_bfchg_32_ix_done;
+      }
+      m68ki_exception_illegal();
+   }
+m68k_op_bfchg_32_ix_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_bfchg_32_aw:
+   {
+      m68ki_resolve_flags();
+      if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+      {
+         uint word2 = OPER_I_16();
+         sint offset = (word2>>6)&31;
+         uint width = word2;
+         uint mask_base;
+         uint data_long;
+         uint mask_long;
+         uint data_byte = 0;
+         uint mask_byte = 0;
+         uint ea = EA_AW_8();
+
+
+         if(BIT_B(word2))
+            offset = MAKE_INT_32(REG_D[offset&7]);
+         if(BIT_5(word2))
+            width = REG_D[width&7];
+
+         /* Offset is signed so we have to use ugly math =( */
+         ea += offset / 8;
+         offset %= 8;
+         if(offset < 0)
+         {
+            offset += 8;
+            ea--;
+         }
+         width = ((width-1) & 31) + 1;
+
+         mask_base = MASK_OUT_ABOVE_32(0xffffffff << (32 - width));
+         mask_long = mask_base >> offset;
+
+         data_long = m68ki_read_32(ea);
+         FLAG_N = NFLAG_32(data_long << offset);
+         FLAG_Z = data_long & mask_long;
+         FLAG_V = VFLAG_CLEAR;
+         FLAG_C = CFLAG_CLEAR;
+
+         m68ki_write_32(ea, data_long ^ mask_long);
+
+         if((width + offset) > 32)
+         {
+            mask_byte = MASK_OUT_ABOVE_8(mask_base);
+            data_byte = m68ki_read_8(ea+4);
+            FLAG_Z |= (data_byte & mask_byte);
+            m68ki_write_8(ea+4, data_byte ^ mask_byte);
+         }
+         goto m68k_op_bfchg_32_aw_done;
+      }
+      m68ki_exception_illegal();
+   }
+m68k_op_bfchg_32_aw_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_bfchg_32_al:
+   {
+      m68ki_resolve_flags();
+      if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+      {
+         uint word2 = OPER_I_16();
+         sint offset = (word2>>6)&31;
+         uint width = word2;
+         uint mask_base;
+         uint data_long;
+         uint mask_long;
+         uint data_byte = 0;
+         uint mask_byte = 0;
+         uint ea = EA_AL_8();
+
+
+         if(BIT_B(word2))
+            offset = MAKE_INT_32(REG_D[offset&7]);
+         if(BIT_5(word2))
+            width = REG_D[width&7];
+
+         /* Offset is signed so we have to use ugly math =( */
+         ea += offset / 8;
+         offset %= 8;
+         if(offset < 0)
+         {
+            offset += 8;
+            ea--;
+         }
+         width = ((width-1) & 31) + 1;
+
+         mask_base = MASK_OUT_ABOVE_32(0xffffffff << (32 - width));
+         mask_long = mask_base >> offset;
+
+         data_long = m68ki_read_32(ea);
+         FLAG_N = NFLAG_32(data_long << offset);
+         FLAG_Z = data_long & mask_long;
+         FLAG_V = VFLAG_CLEAR;
+         FLAG_C = CFLAG_CLEAR;
+
+         m68ki_write_32(ea, data_long ^ mask_long);
+
+         if((width + offset) > 32)
+         {
+            mask_byte = MASK_OUT_ABOVE_8(mask_base);
+            data_byte = m68ki_read_8(ea+4);
+            FLAG_Z |= (data_byte & mask_byte);
+            m68ki_write_8(ea+4, data_byte ^ mask_byte);
+         }
+         goto m68k_op_bfchg_32_al_done;
+      }
+      m68ki_exception_illegal();
+   }
+m68k_op_bfchg_32_al_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_bfclr_32_d:
+   {
+      m68ki_resolve_flags();
+      if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+      {
+         uint word2 = OPER_I_16();
+         uint offset = (word2>>6)&31;
+         uint width = word2;
+         uint* data = &DY;
+         uint64 mask;
+
+
+         if(BIT_B(word2))
+            offset = REG_D[offset&7];
+         if(BIT_5(word2))
+            width = REG_D[width&7];
+
+
+         offset &= 31;
+         width = ((width-1) & 31) + 1;
+
+
+         mask = MASK_OUT_ABOVE_32(0xffffffff << (32 - width));
+         mask = ROR_32(mask, offset);
+
+         FLAG_N = NFLAG_32(*data<<offset);
+         FLAG_Z = *data & mask;
+         FLAG_V = VFLAG_CLEAR;
+         FLAG_C = CFLAG_CLEAR;
+
+         *data &= ~mask;
+
+         goto m68k_op_bfclr_32_d_done;
+      }
+      m68ki_exception_illegal();
+   }
+m68k_op_bfclr_32_d_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_bfclr_32_ai:
+   {
+      m68ki_resolve_flags();
+      if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+      {
+         uint word2 = OPER_I_16();
+         sint offset = (word2>>6)&31;
+         uint width = word2;
+         uint mask_base;
+         uint data_long;
+         uint mask_long;
+         uint data_byte = 0;
+         uint mask_byte = 0;
+         uint ea = EA_AY_AI_8();
+
+
+         if(BIT_B(word2))
+            offset = MAKE_INT_32(REG_D[offset&7]);
+         if(BIT_5(word2))
+            width = REG_D[width&7];
+
+         /* Offset is signed so we have to use ugly math =( */
+         ea += offset / 8;
+         offset %= 8;
+         if(offset < 0)
+         {
+            offset += 8;
+            ea--;
+         }
+         width = ((width-1) & 31) + 1;
+
+         mask_base = MASK_OUT_ABOVE_32(0xffffffff << (32 - width));
+         mask_long = mask_base >> offset;
+
+         data_long = m68ki_read_32(ea);
+         FLAG_N = NFLAG_32(data_long << offset);
+         FLAG_Z = data_long & mask_long;
+         FLAG_V = VFLAG_CLEAR;
+         FLAG_C = CFLAG_CLEAR;
+
+         m68ki_write_32(ea, data_long & ~mask_long);
+
+         if((width + offset) > 32)
+         {
+            mask_byte = MASK_OUT_ABOVE_8(mask_base);
+            data_byte = m68ki_read_8(ea+4);
+            FLAG_Z |= (data_byte & mask_byte);
+            m68ki_write_8(ea+4, data_byte & ~mask_byte);
+         }
+         goto m68k_op_bfclr_32_ai_done;
+      }
+      m68ki_exception_illegal();
+   }
+m68k_op_bfclr_32_ai_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_bfclr_32_di:
+   {
+      m68ki_resolve_flags();
+      if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+      {
+         uint word2 = OPER_I_16();
+         sint offset = (word2>>6)&31;
+         uint width = word2;
+         uint mask_base;
+         uint data_long;
+         uint mask_long;
+         uint data_byte = 0;
+         uint mask_byte = 0;
+         uint ea = EA_AY_DI_8();
+
+
+         if(BIT_B(word2))
+            offset = MAKE_INT_32(REG_D[offset&7]);
+         if(BIT_5(word2))
+            width = REG_D[width&7];
+
+         /* Offset is signed so we have to use ugly math =( */
+         ea += offset / 8;
+         offset %= 8;
+         if(offset < 0)
+         {
+            offset += 8;
+            ea--;
+         }
+         width = ((width-1) & 31) + 1;
+
+         mask_base = MASK_OUT_ABOVE_32(0xffffffff << (32 - width));
+         mask_long = mask_base >> offset;
+
+         data_long = m68ki_read_32(ea);
+         FLAG_N = NFLAG_32(data_long << offset);
+         FLAG_Z = data_long & mask_long;
+         FLAG_V = VFLAG_CLEAR;
+         FLAG_C = CFLAG_CLEAR;
+
+         m68ki_write_32(ea, data_long & ~mask_long);
+
+         if((width + offset) > 32)
+         {
+            mask_byte = MASK_OUT_ABOVE_8(mask_base);
+            data_byte = m68ki_read_8(ea+4);
+            FLAG_Z |= (data_byte & mask_byte);
+            m68ki_write_8(ea+4, data_byte & ~mask_byte);
+         }
+         goto m68k_op_bfclr_32_di_done;
+      }
+      m68ki_exception_illegal();
+   }
+m68k_op_bfclr_32_di_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_bfclr_32_ix:
+   {
+      m68ki_resolve_flags();
+      if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+      {
+         uint word2 = OPER_I_16();
+         sint offset = (word2>>6)&31;
+         uint width = word2;
+         uint mask_base;
+         uint data_long;
+         uint mask_long;
+         uint data_byte = 0;
+         uint mask_byte = 0;
+         uint ea = EA_AY_IX_8();
+
+
+         if(BIT_B(word2))
+            offset = MAKE_INT_32(REG_D[offset&7]);
+         if(BIT_5(word2))
+            width = REG_D[width&7];
+
+         /* Offset is signed so we have to use ugly math =( */
+         ea += offset / 8;
+         offset %= 8;
+         if(offset < 0)
+         {
+            offset += 8;
+            ea--;
+         }
+         width = ((width-1) & 31) + 1;
+
+         mask_base = MASK_OUT_ABOVE_32(0xffffffff << (32 - width));
+         mask_long = mask_base >> offset;
+
+         data_long = m68ki_read_32(ea);
+         FLAG_N = NFLAG_32(data_long << offset);
+         FLAG_Z = data_long & mask_long;
+         FLAG_V = VFLAG_CLEAR;
+         FLAG_C = CFLAG_CLEAR;
+
+         m68ki_write_32(ea, data_long & ~mask_long);
+
+         if((width + offset) > 32)
+         {
+            mask_byte = MASK_OUT_ABOVE_8(mask_base);
+            data_byte = m68ki_read_8(ea+4);
+            FLAG_Z |= (data_byte & mask_byte);
+            m68ki_write_8(ea+4, data_byte & ~mask_byte);
+         }
+         goto m68k_op_bfclr_32_ix_done;
+      }
+      m68ki_exception_illegal();
+   }
+m68k_op_bfclr_32_ix_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_bfclr_32_aw:
+   {
+      m68ki_resolve_flags();
+      if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+      {
+         uint word2 = OPER_I_16();
+         sint offset = (word2>>6)&31;
+         uint width = word2;
+         uint mask_base;
+         uint data_long;
+         uint mask_long;
+         uint data_byte = 0;
+         uint mask_byte = 0;
+         uint ea = EA_AW_8();
+
+
+         if(BIT_B(word2))
+            offset = MAKE_INT_32(REG_D[offset&7]);
+         if(BIT_5(word2))
+            width = REG_D[width&7];
+
+         /* Offset is signed so we have to use ugly math =( */
+         ea += offset / 8;
+         offset %= 8;
+         if(offset < 0)
+         {
+            offset += 8;
+            ea--;
+         }
+         width = ((width-1) & 31) + 1;
+
+         mask_base = MASK_OUT_ABOVE_32(0xffffffff << (32 - width));
+         mask_long = mask_base >> offset;
+
+         data_long = m68ki_read_32(ea);
+         FLAG_N = NFLAG_32(data_long << offset);
+         FLAG_Z = data_long & mask_long;
+         FLAG_V = VFLAG_CLEAR;
+         FLAG_C = CFLAG_CLEAR;
+
+         m68ki_write_32(ea, data_long & ~mask_long);
+
+         if((width + offset) > 32)
+         {
+            mask_byte = MASK_OUT_ABOVE_8(mask_base);
+            data_byte = m68ki_read_8(ea+4);
+            FLAG_Z |= (data_byte & mask_byte);
+            m68ki_write_8(ea+4, data_byte & ~mask_byte);
+         }
+         goto m68k_op_bfclr_32_aw_done;
+      }
+      m68ki_exception_illegal();
+   }
+m68k_op_bfclr_32_aw_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_bfclr_32_al:
+   {
+      m68ki_resolve_flags();
+      if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+      {
+         uint word2 = OPER_I_16();
+         sint offset = (word2>>6)&31;
+         uint width = word2;
+         uint mask_base;
+         uint data_long;
+         uint mask_long;
+         uint data_byte = 0;
+         uint mask_byte = 0;
+         uint ea = EA_AL_8();
+
+
+         if(BIT_B(word2))
+            offset = MAKE_INT_32(REG_D[offset&7]);
+         if(BIT_5(word2))
+            width = REG_D[width&7];
+
+         /* Offset is signed so we have to use ugly math =( */
+         ea += offset / 8;
+         offset %= 8;
+         if(offset < 0)
+         {
+            offset += 8;
+            ea--;
+         }
+         width = ((width-1) & 31) + 1;
+
+         mask_base = MASK_OUT_ABOVE_32(0xffffffff << (32 - width));
+         mask_long = mask_base >> offset;
+
+         data_long = m68ki_read_32(ea);
+         FLAG_N = NFLAG_32(data_long << offset);
+         FLAG_Z = data_long & mask_long;
+         FLAG_V = VFLAG_CLEAR;
+         FLAG_C = CFLAG_CLEAR;
+
+         m68ki_write_32(ea, data_long & ~mask_long);
+
+         if((width + offset) > 32)
+         {
+            mask_byte = MASK_OUT_ABOVE_8(mask_base);
+            data_byte = m68ki_read_8(ea+4);
+            FLAG_Z |= (data_byte & mask_byte);
+            m68ki_write_8(ea+4, data_byte & ~mask_byte);
+         }
+         goto m68k_op_bfclr_32_al_done;
+      }
+      m68ki_exception_illegal();
+   }
+m68k_op_bfclr_32_al_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_bfexts_32_d:
+   {
+      m68ki_resolve_flags();
+      if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+      {
+         uint word2 = OPER_I_16();
+         uint offset = (word2>>6)&31;
+         uint width = word2;
+         uint64 data = DY;
+
+
+         if(BIT_B(word2))
+            offset = REG_D[offset&7];
+         if(BIT_5(word2))
+            width = REG_D[width&7];
+
+         offset &= 31;
+         width = ((width-1) & 31) + 1;
+
+         data = ROL_32(data, offset);
+         FLAG_N = NFLAG_32(data);
+         data = MAKE_INT_32(data) >> (32 - width);
+
+         FLAG_Z = data;
+         FLAG_V = VFLAG_CLEAR;
+         FLAG_C = CFLAG_CLEAR;
+
+         REG_D[(word2>>12)&7] = data;
+
+         goto m68k_op_bfexts_32_d_done;
+      }
+      m68ki_exception_illegal();
+   }
+m68k_op_bfexts_32_d_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_bfexts_32_ai:
+   {
+      m68ki_resolve_flags();
+      if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+      {
+         uint word2 = OPER_I_16();
+         sint offset = (word2>>6)&31;
+         uint width = word2;
+         uint data;
+         uint ea = EA_AY_AI_8();
+
+
+         if(BIT_B(word2))
+            offset = MAKE_INT_32(REG_D[offset&7]);
+         if(BIT_5(word2))
+            width = REG_D[width&7];
+
+         /* Offset is signed so we have to use ugly math =( */
+         ea += offset / 8;
+         offset %= 8;
+         if(offset < 0)
+         {
+            offset += 8;
+            ea--;
+         }
+         width = ((width-1) & 31) + 1;
+
+         data = m68ki_read_32(ea);
+
+         data = MASK_OUT_ABOVE_32(data<<offset);
+
+         if((offset+width) > 32)
+            data |= (m68ki_read_8(ea+4) << offset) >> 8;
+
+         FLAG_N = NFLAG_32(data);
+         data  = MAKE_INT_32(data) >> (32 - width);
+
+         FLAG_Z = data;
+         FLAG_V = VFLAG_CLEAR;
+         FLAG_C = CFLAG_CLEAR;
+
+         REG_D[(word2 >> 12) & 7] = data;
+
+         goto m68k_op_bfexts_32_ai_done;
+      }
+      m68ki_exception_illegal();
+   }
+m68k_op_bfexts_32_ai_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_bfexts_32_di:
+   {
+      m68ki_resolve_flags();
+      if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+      {
+         uint word2 = OPER_I_16();
+         sint offset = (word2>>6)&31;
+         uint width = word2;
+         uint data;
+         uint ea = EA_AY_DI_8();
+
+
+         if(BIT_B(word2))
+            offset = MAKE_INT_32(REG_D[offset&7]);
+         if(BIT_5(word2))
+            width = REG_D[width&7];
+
+         /* Offset is signed so we have to use ugly math =( */
+         ea += offset / 8;
+         offset %= 8;
+         if(offset < 0)
+         {
+            offset += 8;
+            ea--;
+         }
+         width = ((width-1) & 31) + 1;
+
+         data = m68ki_read_32(ea);
+
+         data = MASK_OUT_ABOVE_32(data<<offset);
+
+         if((offset+width) > 32)
+            data |= (m68ki_read_8(ea+4) << offset) >> 8;
+
+         FLAG_N = NFLAG_32(data);
+         data  = MAKE_INT_32(data) >> (32 - width);
+
+         FLAG_Z = data;
+         FLAG_V = VFLAG_CLEAR;
+         FLAG_C = CFLAG_CLEAR;
+
+         REG_D[(word2 >> 12) & 7] = data;
+
+         goto m68k_op_bfexts_32_di_done;
+      }
+      m68ki_exception_illegal();
+   }
+m68k_op_bfexts_32_di_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_bfexts_32_ix:
+   {
+      m68ki_resolve_flags();
+      if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+      {
+         uint word2 = OPER_I_16();
+         sint offset = (word2>>6)&31;
+         uint width = word2;
+         uint data;
+         uint ea = EA_AY_IX_8();
+
+
+         if(BIT_B(word2))
+            offset = MAKE_INT_32(REG_D[offset&7]);
+         if(BIT_5(word2))
+            width = REG_D[width&7];
+
+         /* Offset is signed so we have to use ugly math =( */
+         ea += offset / 8;
+         offset %= 8;
+         if(offset < 0)
+         {
+            offset += 8;
+            ea--;
+         }
+         width = ((width-1) & 31) + 1;
+
+         data = m68ki_read_32(ea);
+
+         data = MASK_OUT_ABOVE_32(data<<offset);
+
+         if((offset+width) > 32)
+            data |= (m68ki_read_8(ea+4) << offset) >> 8;
+
+         FLAG_N = NFLAG_32(data);
+         data  = MAKE_INT_32(data) >> (32 - width);
+
+         FLAG_Z = data;
+         FLAG_V = VFLAG_CLEAR;
+         FLAG_C = CFLAG_CLEAR;
+
+         REG_D[(word2 >> 12) & 7] = data;
+
+         goto m68k_op_bfexts_32_ix_done;
+      }
+      m68ki_exception_illegal();
+   }
+m68k_op_bfexts_32_ix_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_bfexts_32_aw:
+   {
+      m68ki_resolve_flags();
+      if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+      {
+         uint word2 = OPER_I_16();
+         sint offset = (word2>>6)&31;
+         uint width = word2;
+         uint data;
+         uint ea = EA_AW_8();
+
+
+         if(BIT_B(word2))
+            offset = MAKE_INT_32(REG_D[offset&7]);
+         if(BIT_5(word2))
+            width = REG_D[width&7];
+
+         /* Offset is signed so we have to use ugly math =( */
+         ea += offset / 8;
+         offset %= 8;
+         if(offset < 0)
+         {
+            offset += 8;
+            ea--;
+         }
+         width = ((width-1) & 31) + 1;
+
+         data = m68ki_read_32(ea);
+
+         data = MASK_OUT_ABOVE_32(data<<offset);
+
+         if((offset+width) > 32)
+            data |= (m68ki_read_8(ea+4) << offset) >> 8;
+
+         FLAG_N = NFLAG_32(data);
+         data  = MAKE_INT_32(data) >> (32 - width);
+
+         FLAG_Z = data;
+         FLAG_V = VFLAG_CLEAR;
+         FLAG_C = CFLAG_CLEAR;
+
+         REG_D[(word2 >> 12) & 7] = data;
+
+         goto m68k_op_bfexts_32_aw_done;
+      }
+      m68ki_exception_illegal();
+   }
+m68k_op_bfexts_32_aw_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_bfexts_32_al:
+   {
+      m68ki_resolve_flags();
+      if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+      {
+         uint word2 = OPER_I_16();
+         sint offset = (word2>>6)&31;
+         uint width = word2;
+         uint data;
+         uint ea = EA_AL_8();
+
+
+         if(BIT_B(word2))
+            offset = MAKE_INT_32(REG_D[offset&7]);
+         if(BIT_5(word2))
+            width = REG_D[width&7];
+
+         /* Offset is signed so we have to use ugly math =( */
+         ea += offset / 8;
+         offset %= 8;
+         if(offset < 0)
+         {
+            offset += 8;
+            ea--;
+         }
+         width = ((width-1) & 31) + 1;
+
+         data = m68ki_read_32(ea);
+
+         data = MASK_OUT_ABOVE_32(data<<offset);
+
+         if((offset+width) > 32)
+            data |= (m68ki_read_8(ea+4) << offset) >> 8;
+
+         FLAG_N = NFLAG_32(data);
+         data  = MAKE_INT_32(data) >> (32 - width);
+
+         FLAG_Z = data;
+         FLAG_V = VFLAG_CLEAR;
+         FLAG_C = CFLAG_CLEAR;
+
+         REG_D[(word2 >> 12) & 7] = data;
+
+         goto m68k_op_bfexts_32_al_done;
+      }
+      m68ki_exception_illegal();
+   }
+m68k_op_bfexts_32_al_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_bfexts_32_pcdi:
+   {
+      m68ki_resolve_flags();
+      if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+      {
+         uint word2 = OPER_I_16();
+         sint offset = (word2>>6)&31;
+         uint width = word2;
+         uint data;
+         uint ea = EA_PCDI_8();
+
+
+         if(BIT_B(word2))
+            offset = MAKE_INT_32(REG_D[offset&7]);
+         if(BIT_5(word2))
+            width = REG_D[width&7];
+
+         /* Offset is signed so we have to use ugly math =( */
+         ea += offset / 8;
+         offset %= 8;
+         if(offset < 0)
+         {
+            offset += 8;
+            ea--;
+         }
+         width = ((width-1) & 31) + 1;
+
+         data = m68ki_read_32(ea);
+
+         data = MASK_OUT_ABOVE_32(data<<offset);
+
+         if((offset+width) > 32)
+            data |= (m68ki_read_8(ea+4) << offset) >> 8;
+
+         FLAG_N = NFLAG_32(data);
+         data  = MAKE_INT_32(data) >> (32 - width);
+
+         FLAG_Z = data;
+         FLAG_V = VFLAG_CLEAR;
+         FLAG_C = CFLAG_CLEAR;
+
+         REG_D[(word2 >> 12) & 7] = data;
+
+         goto m68k_op_bfexts_32_pcdi_done;
+      }
+      m68ki_exception_illegal();
+   }
+m68k_op_bfexts_32_pcdi_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_bfexts_32_pcix:
+   {
+      m68ki_resolve_flags();
+      if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+      {
+         uint word2 = OPER_I_16();
+         sint offset = (word2>>6)&31;
+         uint width = word2;
+         uint data;
+         uint ea = EA_PCIX_8();
+
+
+         if(BIT_B(word2))
+            offset = MAKE_INT_32(REG_D[offset&7]);
+         if(BIT_5(word2))
+            width = REG_D[width&7];
+
+         /* Offset is signed so we have to use ugly math =( */
+         ea += offset / 8;
+         offset %= 8;
+         if(offset < 0)
+         {
+            offset += 8;
+            ea--;
+         }
+         width = ((width-1) & 31) + 1;
+
+         data = m68ki_read_32(ea);
+
+         data = MASK_OUT_ABOVE_32(data<<offset);
+
+         if((offset+width) > 32)
+            data |= (m68ki_read_8(ea+4) << offset) >> 8;
+
+         FLAG_N = NFLAG_32(data);
+         data  = MAKE_INT_32(data) >> (32 - width);
+
+         FLAG_Z = data;
+         FLAG_V = VFLAG_CLEAR;
+         FLAG_C = CFLAG_CLEAR;
+
+         REG_D[(word2 >> 12) & 7] = data;
+
+         goto m68k_op_bfexts_32_pcix_done;
+      }
+      m68ki_exception_illegal();
+   }
+m68k_op_bfexts_32_pcix_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_bfextu_32_d:
+   {
+      m68ki_resolve_flags();
+      if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+      {
+         uint word2 = OPER_I_16();
+         uint offset = (word2>>6)&31;
+         uint width = word2;
+         uint64 data = DY;
+
+
+         if(BIT_B(word2))
+            offset = REG_D[offset&7];
+         if(BIT_5(word2))
+            width = REG_D[width&7];
+
+         offset &= 31;
+         width = ((width-1) & 31) + 1;
+
+         data = ROL_32(data, offset);
+         FLAG_N = NFLAG_32(data);
+         data >>= 32 - width;
+
+         FLAG_Z = data;
+         FLAG_V = VFLAG_CLEAR;
+         FLAG_C = CFLAG_CLEAR;
+
+         REG_D[(word2>>12)&7] = data;
+
+         goto m68k_op_bfextu_32_d_done;
+      }
+      m68ki_exception_illegal();
+   }
+m68k_op_bfextu_32_d_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_bfextu_32_ai:
+   {
+      m68ki_resolve_flags();
+      if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+      {
+         uint word2 = OPER_I_16();
+         sint offset = (word2>>6)&31;
+         uint width = word2;
+         uint data;
+         uint ea = EA_AY_AI_8();
+
+
+         if(BIT_B(word2))
+         offset = MAKE_INT_32(REG_D[offset&7]);
+         if(BIT_5(word2))
+            width = REG_D[width&7];
+
+         /* Offset is signed so we have to use ugly math =( */
+         ea += offset / 8;
+         offset %= 8;
+         if(offset < 0)
+         {
+            offset += 8;
+            ea--;
+         }
+         width = ((width-1) & 31) + 1;
+
+         data = m68ki_read_32(ea);
+         data = MASK_OUT_ABOVE_32(data<<offset);
+
+         if((offset+width) > 32)
+            data |= (m68ki_read_8(ea+4) << offset) >> 8;
+
+         FLAG_N = NFLAG_32(data);
+         data  >>= (32 - width);
+
+         FLAG_Z = data;
+         FLAG_V = VFLAG_CLEAR;
+         FLAG_C = CFLAG_CLEAR;
+
+         REG_D[(word2 >> 12) & 7] = data;
+
+         goto m68k_op_bfextu_32_ai_done;
+      }
+      m68ki_exception_illegal();
+   }
+m68k_op_bfextu_32_ai_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_bfextu_32_di:
+   {
+      m68ki_resolve_flags();
+      if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+      {
+         uint word2 = OPER_I_16();
+         sint offset = (word2>>6)&31;
+         uint width = word2;
+         uint data;
+         uint ea = EA_AY_DI_8();
+
+
+         if(BIT_B(word2))
+         offset = MAKE_INT_32(REG_D[offset&7]);
+         if(BIT_5(word2))
+            width = REG_D[width&7];
+
+         /* Offset is signed so we have to use ugly math =( */
+         ea += offset / 8;
+         offset %= 8;
+         if(offset < 0)
+         {
+            offset += 8;
+            ea--;
+         }
+         width = ((width-1) & 31) + 1;
+
+         data = m68ki_read_32(ea);
+         data = MASK_OUT_ABOVE_32(data<<offset);
+
+         if((offset+width) > 32)
+            data |= (m68ki_read_8(ea+4) << offset) >> 8;
+
+         FLAG_N = NFLAG_32(data);
+         data  >>= (32 - width);
+
+         FLAG_Z = data;
+         FLAG_V = VFLAG_CLEAR;
+         FLAG_C = CFLAG_CLEAR;
+
+         REG_D[(word2 >> 12) & 7] = data;
+
+         goto m68k_op_bfextu_32_di_done;
+      }
+      m68ki_exception_illegal();
+   }
+m68k_op_bfextu_32_di_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_bfextu_32_ix:
+   {
+      m68ki_resolve_flags();
+      if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+      {
+         uint word2 = OPER_I_16();
+         sint offset = (word2>>6)&31;
+         uint width = word2;
+         uint data;
+         uint ea = EA_AY_IX_8();
+
+
+         if(BIT_B(word2))
+         offset = MAKE_INT_32(REG_D[offset&7]);
+         if(BIT_5(word2))
+            width = REG_D[width&7];
+
+         /* Offset is signed so we have to use ugly math =( */
+         ea += offset / 8;
+         offset %= 8;
+         if(offset < 0)
+         {
+            offset += 8;
+            ea--;
+         }
+         width = ((width-1) & 31) + 1;
+
+         data = m68ki_read_32(ea);
+         data = MASK_OUT_ABOVE_32(data<<offset);
+
+         if((offset+width) > 32)
+            data |= (m68ki_read_8(ea+4) << offset) >> 8;
+
+         FLAG_N = NFLAG_32(data);
+         data  >>= (32 - width);
+
+         FLAG_Z = data;
+         FLAG_V = VFLAG_CLEAR;
+         FLAG_C = CFLAG_CLEAR;
+
+         REG_D[(word2 >> 12) & 7] = data;
+
+         goto m68k_op_bfextu_32_ix_done;
+      }
+      m68ki_exception_illegal();
+   }
+m68k_op_bfextu_32_ix_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_bfextu_32_aw:
+   {
+      m68ki_resolve_flags();
+      if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+      {
+         uint word2 = OPER_I_16();
+         sint offset = (word2>>6)&31;
+         uint width = word2;
+         uint data;
+         uint ea = EA_AW_8();
+
+
+         if(BIT_B(word2))
+         offset = MAKE_INT_32(REG_D[offset&7]);
+         if(BIT_5(word2))
+            width = REG_D[width&7];
+
+         /* Offset is signed so we have to use ugly math =( */
+         ea += offset / 8;
+         offset %= 8;
+         if(offset < 0)
+         {
+            offset += 8;
+            ea--;
+         }
+         width = ((width-1) & 31) + 1;
+
+         data = m68ki_read_32(ea);
+         data = MASK_OUT_ABOVE_32(data<<offset);
+
+         if((offset+width) > 32)
+            data |= (m68ki_read_8(ea+4) << offset) >> 8;
+
+         FLAG_N = NFLAG_32(data);
+         data  >>= (32 - width);
+
+         FLAG_Z = data;
+         FLAG_V = VFLAG_CLEAR;
+         FLAG_C = CFLAG_CLEAR;
+
+         REG_D[(word2 >> 12) & 7] = data;
+
+         goto m68k_op_bfextu_32_aw_done;
+      }
+      m68ki_exception_illegal();
+   }
+m68k_op_bfextu_32_aw_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_bfextu_32_al:
+   {
+      m68ki_resolve_flags();
+      if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+      {
+         uint word2 = OPER_I_16();
+         sint offset = (word2>>6)&31;
+         uint width = word2;
+         uint data;
+         uint ea = EA_AL_8();
+
+
+         if(BIT_B(word2))
+         offset = MAKE_INT_32(REG_D[offset&7]);
+         if(BIT_5(word2))
+            width = REG_D[width&7];
+
+         /* Offset is signed so we have to use ugly math =( */
+         ea += offset / 8;
+         offset %= 8;
+         if(offset < 0)
+         {
+            offset += 8;
+            ea--;
+         }
+         width = ((width-1) & 31) + 1;
+
+         data = m68ki_read_32(ea);
+         data = MASK_OUT_ABOVE_32(data<<offset);
+
+         if((offset+width) > 32)
+            data |= (m68ki_read_8(ea+4) << offset) >> 8;
+
+         FLAG_N = NFLAG_32(data);
+         data  >>= (32 - width);
+
+         FLAG_Z = data;
+         FLAG_V = VFLAG_CLEAR;
+         FLAG_C = CFLAG_CLEAR;
+
+         REG_D[(word2 >> 12) & 7] = data;
+
+         goto m68k_op_bfextu_32_al_done;
+      }
+      m68ki_exception_illegal();
+   }
+m68k_op_bfextu_32_al_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_bfextu_32_pcdi:
+   {
+      m68ki_resolve_flags();
+      if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+      {
+         uint word2 = OPER_I_16();
+         sint offset = (word2>>6)&31;
+         uint width = word2;
+         uint data;
+         uint ea = EA_PCDI_8();
+
+
+         if(BIT_B(word2))
+         offset = MAKE_INT_32(REG_D[offset&7]);
+         if(BIT_5(word2))
+            width = REG_D[width&7];
+
+         /* Offset is signed so we have to use ugly math =( */
+         ea += offset / 8;
+         offset %= 8;
+         if(offset < 0)
+         {
+            offset += 8;
+            ea--;
+         }
+         width = ((width-1) & 31) + 1;
+
+         data = m68ki_read_32(ea);
+         data = MASK_OUT_ABOVE_32(data<<offset);
+
+         if((offset+width) > 32)
+            data |= (m68ki_read_8(ea+4) << offset) >> 8;
+
+         FLAG_N = NFLAG_32(data);
+         data  >>= (32 - width);
+
+         FLAG_Z = data;
+         FLAG_V = VFLAG_CLEAR;
+         FLAG_C = CFLAG_CLEAR;
+
+         REG_D[(word2 >> 12) & 7] = data;
+
+         goto m68k_op_bfextu_32_pcdi_done;
+      }
+      m68ki_exception_illegal();
+   }
+m68k_op_bfextu_32_pcdi_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_bfextu_32_pcix:
+   {
+      m68ki_resolve_flags();
+      if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+      {
+         uint word2 = OPER_I_16();
+         sint offset = (word2>>6)&31;
+         uint width = word2;
+         uint data;
+         uint ea = EA_PCIX_8();
+
+
+         if(BIT_B(word2))
+         offset = MAKE_INT_32(REG_D[offset&7]);
+         if(BIT_5(word2))
+            width = REG_D[width&7];
+
+         /* Offset is signed so we have to use ugly math =( */
+         ea += offset / 8;
+         offset %= 8;
+         if(offset < 0)
+         {
+            offset += 8;
+            ea--;
+         }
+         width = ((width-1) & 31) + 1;
+
+         data = m68ki_read_32(ea);
+         data = MASK_OUT_ABOVE_32(data<<offset);
+
+         if((offset+width) > 32)
+            data |= (m68ki_read_8(ea+4) << offset) >> 8;
+
+         FLAG_N = NFLAG_32(data);
+         data  >>= (32 - width);
+
+         FLAG_Z = data;
+         FLAG_V = VFLAG_CLEAR;
+         FLAG_C = CFLAG_CLEAR;
+
+         REG_D[(word2 >> 12) & 7] = data;
+
+         goto m68k_op_bfextu_32_pcix_done;
+      }
+      m68ki_exception_illegal();
+   }
+m68k_op_bfextu_32_pcix_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_bfffo_32_d:
+   {
+      m68ki_resolve_flags();
+      if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+      {
+         uint word2 = OPER_I_16();
+         uint offset = (word2>>6)&31;
+         uint width = word2;
+         uint64 data = DY;
+         uint bit;
+
+
+         if(BIT_B(word2))
+            offset = REG_D[offset&7];
+         if(BIT_5(word2))
+            width = REG_D[width&7];
+
+         offset &= 31;
+         width = ((width-1) & 31) + 1;
+
+         data = ROL_32(data, offset);
+         FLAG_N = NFLAG_32(data);
+         data >>= 32 - width;
+
+         FLAG_Z = data;
+         FLAG_V = VFLAG_CLEAR;
+         FLAG_C = CFLAG_CLEAR;
+
+         for(bit = 1<<(width-1);bit && !(data & bit);bit>>= 1)
+            offset++;
+
+         REG_D[(word2>>12)&7] = offset;
+
+         goto m68k_op_bfffo_32_d_done;
+      }
+      m68ki_exception_illegal();
+   }
+m68k_op_bfffo_32_d_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_bfffo_32_ai:
+   {
+      m68ki_resolve_flags();
+      if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+      {
+         uint word2 = OPER_I_16();
+         sint offset = (word2>>6)&31;
+         sint local_offset;
+         uint width = word2;
+         uint data;
+         uint bit;
+         uint ea = EA_AY_AI_8();
+
+
+         if(BIT_B(word2))
+            offset = MAKE_INT_32(REG_D[offset&7]);
+         if(BIT_5(word2))
+            width = REG_D[width&7];
+
+         /* Offset is signed so we have to use ugly math =( */
+         ea += offset / 8;
+         local_offset = offset % 8;
+         if(local_offset < 0)
+         {
+            local_offset += 8;
+            ea--;
+         }
+         width = ((width-1) & 31) + 1;
+
+         data = m68ki_read_32(ea);
+         data = MASK_OUT_ABOVE_32(data<<local_offset);
+
+         if((local_offset+width) > 32)
+            data |= (m68ki_read_8(ea+4) << local_offset) >> 8;
+
+         FLAG_N = NFLAG_32(data);
+         data  >>= (32 - width);
+
+         FLAG_Z = data;
+         FLAG_V = VFLAG_CLEAR;
+         FLAG_C = CFLAG_CLEAR;
+
+         for(bit = 1<<(width-1);bit && !(data & bit);bit>>= 1)
+            offset++;
+
+         REG_D[(word2>>12)&7] = offset;
+
+         goto m68k_op_bfffo_32_ai_done;
+      }
+      m68ki_exception_illegal();
+   }
+m68k_op_bfffo_32_ai_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_bfffo_32_di:
+   {
+      m68ki_resolve_flags();
+      if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+      {
+         uint word2 = OPER_I_16();
+         sint offset = (word2>>6)&31;
+         sint local_offset;
+         uint width = word2;
+         uint data;
+         uint bit;
+         uint ea = EA_AY_DI_8();
+
+
+         if(BIT_B(word2))
+            offset = MAKE_INT_32(REG_D[offset&7]);
+         if(BIT_5(word2))
+            width = REG_D[width&7];
+
+         /* Offset is signed so we have to use ugly math =( */
+         ea += offset / 8;
+         local_offset = offset % 8;
+         if(local_offset < 0)
+         {
+            local_offset += 8;
+            ea--;
+         }
+         width = ((width-1) & 31) + 1;
+
+         data = m68ki_read_32(ea);
+         data = MASK_OUT_ABOVE_32(data<<local_offset);
+
+         if((local_offset+width) > 32)
+            data |= (m68ki_read_8(ea+4) << local_offset) >> 8;
+
+         FLAG_N = NFLAG_32(data);
+         data  >>= (32 - width);
+
+         FLAG_Z = data;
+         FLAG_V = VFLAG_CLEAR;
+         FLAG_C = CFLAG_CLEAR;
+
+         for(bit = 1<<(width-1);bit && !(data & bit);bit>>= 1)
+            offset++;
+
+         REG_D[(word2>>12)&7] = offset;
+
+         goto m68k_op_bfffo_32_di_done;
+      }
+      m68ki_exception_illegal();
+   }
+m68k_op_bfffo_32_di_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_bfffo_32_ix:
+   {
+      m68ki_resolve_flags();
+      if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+      {
+         uint word2 = OPER_I_16();
+         sint offset = (word2>>6)&31;
+         sint local_offset;
+         uint width = word2;
+         uint data;
+         uint bit;
+         uint ea = EA_AY_IX_8();
+
+
+         if(BIT_B(word2))
+            offset = MAKE_INT_32(REG_D[offset&7]);
+         if(BIT_5(word2))
+            width = REG_D[width&7];
+
+         /* Offset is signed so we have to use ugly math =( */
+         ea += offset / 8;
+         local_offset = offset % 8;
+         if(local_offset < 0)
+         {
+            local_offset += 8;
+            ea--;
+         }
+         width = ((width-1) & 31) + 1;
+
+         data = m68ki_read_32(ea);
+         data = MASK_OUT_ABOVE_32(data<<local_offset);
+
+         if((local_offset+width) > 32)
+            data |= (m68ki_read_8(ea+4) << local_offset) >> 8;
+
+         FLAG_N = NFLAG_32(data);
+         data  >>= (32 - width);
+
+         FLAG_Z = data;
+         FLAG_V = VFLAG_CLEAR;
+         FLAG_C = CFLAG_CLEAR;
+
+         for(bit = 1<<(width-1);bit && !(data & bit);bit>>= 1)
+            offset++;
+
+         REG_D[(word2>>12)&7] = offset;
+
+         goto m68k_op_bfffo_32_ix_done;
+      }
+      m68ki_exception_illegal();
+   }
+m68k_op_bfffo_32_ix_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_bfffo_32_aw:
+   {
+      m68ki_resolve_flags();
+      if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+      {
+         uint word2 = OPER_I_16();
+         sint offset = (word2>>6)&31;
+         sint local_offset;
+         uint width = word2;
+         uint data;
+         uint bit;
+         uint ea = EA_AW_8();
+
+
+         if(BIT_B(word2))
+            offset = MAKE_INT_32(REG_D[offset&7]);
+         if(BIT_5(word2))
+            width = REG_D[width&7];
+
+         /* Offset is signed so we have to use ugly math =( */
+         ea += offset / 8;
+         local_offset = offset % 8;
+         if(local_offset < 0)
+         {
+            local_offset += 8;
+            ea--;
+         }
+         width = ((width-1) & 31) + 1;
+
+         data = m68ki_read_32(ea);
+         data = MASK_OUT_ABOVE_32(data<<local_offset);
+
+         if((local_offset+width) > 32)
+            data |= (m68ki_read_8(ea+4) << local_offset) >> 8;
+
+         FLAG_N = NFLAG_32(data);
+         data  >>= (32 - width);
+
+         FLAG_Z = data;
+         FLAG_V = VFLAG_CLEAR;
+         FLAG_C = CFLAG_CLEAR;
+
+         for(bit = 1<<(width-1);bit && !(data & bit);bit>>= 1)
+            offset++;
+
+         REG_D[(word2>>12)&7] = offset;
+
+         goto m68k_op_bfffo_32_aw_done;
+      }
+      m68ki_exception_illegal();
+   }
+m68k_op_bfffo_32_aw_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_bfffo_32_al:
+   {
+      m68ki_resolve_flags();
+      if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+      {
+         uint word2 = OPER_I_16();
+         sint offset = (word2>>6)&31;
+         sint local_offset;
+         uint width = word2;
+         uint data;
+         uint bit;
+         uint ea = EA_AL_8();
+
+
+         if(BIT_B(word2))
+            offset = MAKE_INT_32(REG_D[offset&7]);
+         if(BIT_5(word2))
+            width = REG_D[width&7];
+
+         /* Offset is signed so we have to use ugly math =( */
+         ea += offset / 8;
+         local_offset = offset % 8;
+         if(local_offset < 0)
+         {
+            local_offset += 8;
+            ea--;
+         }
+         width = ((width-1) & 31) + 1;
+
+         data = m68ki_read_32(ea);
+         data = MASK_OUT_ABOVE_32(data<<local_offset);
+
+         if((local_offset+width) > 32)
+            data |= (m68ki_read_8(ea+4) << local_offset) >> 8;
+
+         FLAG_N = NFLAG_32(data);
+         data  >>= (32 - width);
+
+         FLAG_Z = data;
+         FLAG_V = VFLAG_CLEAR;
+         FLAG_C = CFLAG_CLEAR;
+
+         for(bit = 1<<(width-1);bit && !(data & bit);bit>>= 1)
+            offset++;
+
+         REG_D[(word2>>12)&7] = offset;
+
+         goto m68k_op_bfffo_32_al_done;
+      }
+      m68ki_exception_illegal();
+   }
+m68k_op_bfffo_32_al_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_bfffo_32_pcdi:
+   {
+      m68ki_resolve_flags();
+      if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+      {
+         uint word2 = OPER_I_16();
+         sint offset = (word2>>6)&31;
+         sint local_offset;
+         uint width = word2;
+         uint data;
+         uint bit;
+         uint ea = EA_PCDI_8();
+
+
+         if(BIT_B(word2))
+            offset = MAKE_INT_32(REG_D[offset&7]);
+         if(BIT_5(word2))
+            width = REG_D[width&7];
+
+         /* Offset is signed so we have to use ugly math =( */
+         ea += offset / 8;
+         local_offset = offset % 8;
+         if(local_offset < 0)
+         {
+            local_offset += 8;
+            ea--;
+         }
+         width = ((width-1) & 31) + 1;
+
+         data = m68ki_read_32(ea);
+         data = MASK_OUT_ABOVE_32(data<<local_offset);
+
+         if((local_offset+width) > 32)
+            data |= (m68ki_read_8(ea+4) << local_offset) >> 8;
+
+         FLAG_N = NFLAG_32(data);
+         data  >>= (32 - width);
+
+         FLAG_Z = data;
+         FLAG_V = VFLAG_CLEAR;
+         FLAG_C = CFLAG_CLEAR;
+
+         for(bit = 1<<(width-1);bit && !(data & bit);bit>>= 1)
+            offset++;
+
+         REG_D[(word2>>12)&7] = offset;
+
+         goto m68k_op_bfffo_32_pcdi_done;
+      }
+      m68ki_exception_illegal();
+   }
+m68k_op_bfffo_32_pcdi_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_bfffo_32_pcix:
+   {
+      m68ki_resolve_flags();
+      if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+      {
+         uint word2 = OPER_I_16();
+         sint offset = (word2>>6)&31;
+         sint local_offset;
+         uint width = word2;
+         uint data;
+         uint bit;
+         uint ea = EA_PCIX_8();
+
+
+         if(BIT_B(word2))
+            offset = MAKE_INT_32(REG_D[offset&7]);
+         if(BIT_5(word2))
+            width = REG_D[width&7];
+
+         /* Offset is signed so we have to use ugly math =( */
+         ea += offset / 8;
+         local_offset = offset % 8;
+         if(local_offset < 0)
+         {
+            local_offset += 8;
+            ea--;
+         }
+         width = ((width-1) & 31) + 1;
+
+         data = m68ki_read_32(ea);
+         data = MASK_OUT_ABOVE_32(data<<local_offset);
+
+         if((local_offset+width) > 32)
+            data |= (m68ki_read_8(ea+4) << local_offset) >> 8;
+
+         FLAG_N = NFLAG_32(data);
+         data  >>= (32 - width);
+
+         FLAG_Z = data;
+         FLAG_V = VFLAG_CLEAR;
+         FLAG_C = CFLAG_CLEAR;
+
+         for(bit = 1<<(width-1);bit && !(data & bit);bit>>= 1)
+            offset++;
+
+         REG_D[(word2>>12)&7] = offset;
+
+         goto m68k_op_bfffo_32_pcix_done;
+      }
+      m68ki_exception_illegal();
+   }
+m68k_op_bfffo_32_pcix_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_bfins_32_d:
+   {
+      m68ki_resolve_flags();
+      if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+      {
+         uint word2 = OPER_I_16();
+         uint offset = (word2>>6)&31;
+         uint width = word2;
+         uint* data = &DY;
+         uint64 mask;
+         uint64 insert = REG_D[(word2>>12)&7];
+
+
+         if(BIT_B(word2))
+            offset = REG_D[offset&7];
+         if(BIT_5(word2))
+            width = REG_D[width&7];
+
+
+         offset &= 31;
+         width = ((width-1) & 31) + 1;
+
+
+         mask = MASK_OUT_ABOVE_32(0xffffffff << (32 - width));
+         mask = ROR_32(mask, offset);
+
+         insert = MASK_OUT_ABOVE_32(insert << (32 - width));
+         FLAG_N = NFLAG_32(insert);
+         FLAG_Z = insert;
+         insert = ROR_32(insert, offset);
+
+         FLAG_V = VFLAG_CLEAR;
+         FLAG_C = CFLAG_CLEAR;
+
+         *data &= ~mask;
+         *data |= insert;
+
+         goto m68k_op_bfins_32_d_done;
+      }
+      m68ki_exception_illegal();
+   }
+m68k_op_bfins_32_d_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_bfins_32_ai:
+   {
+      m68ki_resolve_flags();
+      if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+      {
+         uint word2 = OPER_I_16();
+         sint offset = (word2>>6)&31;
+         uint width = word2;
+         uint insert_base = REG_D[(word2>>12)&7];
+         uint insert_long;
+         uint insert_byte;
+         uint mask_base;
+         uint data_long;
+         uint mask_long;
+         uint data_byte = 0;
+         uint mask_byte = 0;
+         uint ea = EA_AY_AI_8();
+
+
+         if(BIT_B(word2))
+            offset = MAKE_INT_32(REG_D[offset&7]);
+         if(BIT_5(word2))
+            width = REG_D[width&7];
+
+         /* Offset is signed so we have to use ugly math =( */
+         ea += offset / 8;
+         offset %= 8;
+         if(offset < 0)
+         {
+            offset += 8;
+            ea--;
+         }
+         width = ((width-1) & 31) + 1;
+
+         mask_base = MASK_OUT_ABOVE_32(0xffffffff << (32 - width));
+         mask_long = mask_base >> offset;
+
+         insert_base = MASK_OUT_ABOVE_32(insert_base << (32 - width));
+         FLAG_N = NFLAG_32(insert_base);
+         FLAG_Z = insert_base;
+         insert_long = insert_base >> offset;
+
+         data_long = m68ki_read_32(ea);
+         FLAG_V = VFLAG_CLEAR;
+         FLAG_C = CFLAG_CLEAR;
+
+         m68ki_write_32(ea, (data_long & ~mask_long) | insert_long);
+
+         if((width + offset) > 32)
+         {
+            mask_byte = MASK_OUT_ABOVE_8(mask_base);
+            insert_byte = MASK_OUT_ABOVE_8(insert_base);
+            data_byte = m68ki_read_8(ea+4);
+            FLAG_Z |= (data_byte & mask_byte);
+            m68ki_write_8(ea+4, (data_byte & ~mask_byte) | insert_byte);
+         }
+         goto m68k_op_bfins_32_ai_done;
+      }
+      m68ki_exception_illegal();
+   }
+m68k_op_bfins_32_ai_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_bfins_32_di:
+   {
+      m68ki_resolve_flags();
+      if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+      {
+         uint word2 = OPER_I_16();
+         sint offset = (word2>>6)&31;
+         uint width = word2;
+         uint insert_base = REG_D[(word2>>12)&7];
+         uint insert_long;
+         uint insert_byte;
+         uint mask_base;
+         uint data_long;
+         uint mask_long;
+         uint data_byte = 0;
+         uint mask_byte = 0;
+         uint ea = EA_AY_DI_8();
+
+
+         if(BIT_B(word2))
+            offset = MAKE_INT_32(REG_D[offset&7]);
+         if(BIT_5(word2))
+            width = REG_D[width&7];
+
+         /* Offset is signed so we have to use ugly math =( */
+         ea += offset / 8;
+         offset %= 8;
+         if(offset < 0)
+         {
+            offset += 8;
+            ea--;
+         }
+         width = ((width-1) & 31) + 1;
+
+         mask_base = MASK_OUT_ABOVE_32(0xffffffff << (32 - width));
+         mask_long = mask_base >> offset;
+
+         insert_base = MASK_OUT_ABOVE_32(insert_base << (32 - width));
+         FLAG_N = NFLAG_32(insert_base);
+         FLAG_Z = insert_base;
+         insert_long = insert_base >> offset;
+
+         data_long = m68ki_read_32(ea);
+         FLAG_V = VFLAG_CLEAR;
+         FLAG_C = CFLAG_CLEAR;
+
+         m68ki_write_32(ea, (data_long & ~mask_long) | insert_long);
+
+         if((width + offset) > 32)
+         {
+            mask_byte = MASK_OUT_ABOVE_8(mask_base);
+            insert_byte = MASK_OUT_ABOVE_8(insert_base);
+            data_byte = m68ki_read_8(ea+4);
+            FLAG_Z |= (data_byte & mask_byte);
+            m68ki_write_8(ea+4, (data_byte & ~mask_byte) | insert_byte);
+         }
+         goto m68k_op_bfins_32_di_done;
+      }
+      m68ki_exception_illegal();
+   }
+m68k_op_bfins_32_di_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_bfins_32_ix:
+   {
+      m68ki_resolve_flags();
+      if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+      {
+         uint word2 = OPER_I_16();
+         sint offset = (word2>>6)&31;
+         uint width = word2;
+         uint insert_base = REG_D[(word2>>12)&7];
+         uint insert_long;
+         uint insert_byte;
+         uint mask_base;
+         uint data_long;
+         uint mask_long;
+         uint data_byte = 0;
+         uint mask_byte = 0;
+         uint ea = EA_AY_IX_8();
+
+
+         if(BIT_B(word2))
+            offset = MAKE_INT_32(REG_D[offset&7]);
+         if(BIT_5(word2))
+            width = REG_D[width&7];
+
+         /* Offset is signed so we have to use ugly math =( */
+         ea += offset / 8;
+         offset %= 8;
+         if(offset < 0)
+         {
+            offset += 8;
+            ea--;
+         }
+         width = ((width-1) & 31) + 1;
+
+         mask_base = MASK_OUT_ABOVE_32(0xffffffff << (32 - width));
+         mask_long = mask_base >> offset;
+
+         insert_base = MASK_OUT_ABOVE_32(insert_base << (32 - width));
+         FLAG_N = NFLAG_32(insert_base);
+         FLAG_Z = insert_base;
+         insert_long = insert_base >> offset;
+
+         data_long = m68ki_read_32(ea);
+         FLAG_V = VFLAG_CLEAR;
+         FLAG_C = CFLAG_CLEAR;
+
+         m68ki_write_32(ea, (data_long & ~mask_long) | insert_long);
+
+         if((width + offset) > 32)
+         {
+            mask_byte = MASK_OUT_ABOVE_8(mask_base);
+            insert_byte = MASK_OUT_ABOVE_8(insert_base);
+            data_byte = m68ki_read_8(ea+4);
+            FLAG_Z |= (data_byte & mask_byte);
+            m68ki_write_8(ea+4, (data_byte & ~mask_byte) | insert_byte);
+         }
+         goto m68k_op_bfins_32_ix_done;
+      }
+      m68ki_exception_illegal();
+   }
+m68k_op_bfins_32_ix_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_bfins_32_aw:
+   {
+      m68ki_resolve_flags();
+      if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+      {
+         uint word2 = OPER_I_16();
+         sint offset = (word2>>6)&31;
+         uint width = word2;
+         uint insert_base = REG_D[(word2>>12)&7];
+         uint insert_long;
+         uint insert_byte;
+         uint mask_base;
+         uint data_long;
+         uint mask_long;
+         uint data_byte = 0;
+         uint mask_byte = 0;
+         uint ea = EA_AW_8();
+
+
+         if(BIT_B(word2))
+            offset = MAKE_INT_32(REG_D[offset&7]);
+         if(BIT_5(word2))
+            width = REG_D[width&7];
+
+         /* Offset is signed so we have to use ugly math =( */
+         ea += offset / 8;
+         offset %= 8;
+         if(offset < 0)
+         {
+            offset += 8;
+            ea--;
+         }
+         width = ((width-1) & 31) + 1;
+
+         mask_base = MASK_OUT_ABOVE_32(0xffffffff << (32 - width));
+         mask_long = mask_base >> offset;
+
+         insert_base = MASK_OUT_ABOVE_32(insert_base << (32 - width));
+         FLAG_N = NFLAG_32(insert_base);
+         FLAG_Z = insert_base;
+         insert_long = insert_base >> offset;
+
+         data_long = m68ki_read_32(ea);
+         FLAG_V = VFLAG_CLEAR;
+         FLAG_C = CFLAG_CLEAR;
+
+         m68ki_write_32(ea, (data_long & ~mask_long) | insert_long);
+
+         if((width + offset) > 32)
+         {
+            mask_byte = MASK_OUT_ABOVE_8(mask_base);
+            insert_byte = MASK_OUT_ABOVE_8(insert_base);
+            data_byte = m68ki_read_8(ea+4);
+            FLAG_Z |= (data_byte & mask_byte);
+            m68ki_write_8(ea+4, (data_byte & ~mask_byte) | insert_byte);
+         }
+         goto m68k_op_bfins_32_aw_done;
+      }
+      m68ki_exception_illegal();
+   }
+m68k_op_bfins_32_aw_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_bfins_32_al:
+   {
+      m68ki_resolve_flags();
+      if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+      {
+         uint word2 = OPER_I_16();
+         sint offset = (word2>>6)&31;
+         uint width = word2;
+         uint insert_base = REG_D[(word2>>12)&7];
+         uint insert_long;
+         uint insert_byte;
+         uint mask_base;
+         uint data_long;
+         uint mask_long;
+         uint data_byte = 0;
+         uint mask_byte = 0;
+         uint ea = EA_AL_8();
+
+
+         if(BIT_B(word2))
+            offset = MAKE_INT_32(REG_D[offset&7]);
+         if(BIT_5(word2))
+            width = REG_D[width&7];
+
+         /* Offset is signed so we have to use ugly math =( */
+         ea += offset / 8;
+         offset %= 8;
+         if(offset < 0)
+         {
+            offset += 8;
+            ea--;
+         }
+         width = ((width-1) & 31) + 1;
+
+         mask_base = MASK_OUT_ABOVE_32(0xffffffff << (32 - width));
+         mask_long = mask_base >> offset;
+
+         insert_base = MASK_OUT_ABOVE_32(insert_base << (32 - width));
+         FLAG_N = NFLAG_32(insert_base);
+         FLAG_Z = insert_base;
+         insert_long = insert_base >> offset;
+
+         data_long = m68ki_read_32(ea);
+         FLAG_V = VFLAG_CLEAR;
+         FLAG_C = CFLAG_CLEAR;
+
+         m68ki_write_32(ea, (data_long & ~mask_long) | insert_long);
+
+         if((width + offset) > 32)
+         {
+            mask_byte = MASK_OUT_ABOVE_8(mask_base);
+            insert_byte = MASK_OUT_ABOVE_8(insert_base);
+            data_byte = m68ki_read_8(ea+4);
+            FLAG_Z |= (data_byte & mask_byte);
+            m68ki_write_8(ea+4, (data_byte & ~mask_byte) | insert_byte);
+         }
+         goto m68k_op_bfins_32_al_done;
+      }
+      m68ki_exception_illegal();
+   }
+m68k_op_bfins_32_al_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_bfset_32_d:
+   {
+      m68ki_resolve_flags();
+      if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+      {
+         uint word2 = OPER_I_16();
+         uint offset = (word2>>6)&31;
+         uint width = word2;
+         uint* data = &DY;
+         uint64 mask;
+
+
+         if(BIT_B(word2))
+            offset = REG_D[offset&7];
+         if(BIT_5(word2))
+            width = REG_D[width&7];
+
+
+         offset &= 31;
+         width = ((width-1) & 31) + 1;
+
+
+         mask = MASK_OUT_ABOVE_32(0xffffffff << (32 - width));
+         mask = ROR_32(mask, offset);
+
+         FLAG_N = NFLAG_32(*data<<offset);
+         FLAG_Z = *data & mask;
+         FLAG_V = VFLAG_CLEAR;
+         FLAG_C = CFLAG_CLEAR;
+
+         *data |= mask;
+
+         goto m68k_op_bfset_32_d_done;
+      }
+      m68ki_exception_illegal();
+   }
+m68k_op_bfset_32_d_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_bfset_32_ai:
+   {
+      m68ki_resolve_flags();
+      if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+      {
+         uint word2 = OPER_I_16();
+         sint offset = (word2>>6)&31;
+         uint width = word2;
+         uint mask_base;
+         uint data_long;
+         uint mask_long;
+         uint data_byte = 0;
+         uint mask_byte = 0;
+         uint ea = EA_AY_AI_8();
+
+
+         if(BIT_B(word2))
+            offset = MAKE_INT_32(REG_D[offset&7]);
+         if(BIT_5(word2))
+            width = REG_D[width&7];
+
+         /* Offset is signed so we have to use ugly math =( */
+         ea += offset / 8;
+         offset %= 8;
+         if(offset < 0)
+         {
+            offset += 8;
+            ea--;
+         }
+         width = ((width-1) & 31) + 1;
+
+
+         mask_base = MASK_OUT_ABOVE_32(0xffffffff << (32 - width));
+         mask_long = mask_base >> offset;
+
+         data_long = m68ki_read_32(ea);
+         FLAG_N = NFLAG_32(data_long << offset);
+         FLAG_Z = data_long & mask_long;
+         FLAG_V = VFLAG_CLEAR;
+         FLAG_C = CFLAG_CLEAR;
+
+         m68ki_write_32(ea, data_long | mask_long);
+
+         if((width + offset) > 32)
+         {
+            mask_byte = MASK_OUT_ABOVE_8(mask_base);
+            data_byte = m68ki_read_8(ea+4);
+            FLAG_Z |= (data_byte & mask_byte);
+            m68ki_write_8(ea+4, data_byte | mask_byte);
+         }
+         goto m68k_op_bfset_32_ai_done;
+      }
+      m68ki_exception_illegal();
+   }
+m68k_op_bfset_32_ai_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_bfset_32_di:
+   {
+      m68ki_resolve_flags();
+      if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+      {
+         uint word2 = OPER_I_16();
+         sint offset = (word2>>6)&31;
+         uint width = word2;
+         uint mask_base;
+         uint data_long;
+         uint mask_long;
+         uint data_byte = 0;
+         uint mask_byte = 0;
+         uint ea = EA_AY_DI_8();
+
+
+         if(BIT_B(word2))
+            offset = MAKE_INT_32(REG_D[offset&7]);
+         if(BIT_5(word2))
+            width = REG_D[width&7];
+
+         /* Offset is signed so we have to use ugly math =( */
+         ea += offset / 8;
+         offset %= 8;
+         if(offset < 0)
+         {
+            offset += 8;
+            ea--;
+         }
+         width = ((width-1) & 31) + 1;
+
+
+         mask_base = MASK_OUT_ABOVE_32(0xffffffff << (32 - width));
+         mask_long = mask_base >> offset;
+
+         data_long = m68ki_read_32(ea);
+         FLAG_N = NFLAG_32(data_long << offset);
+         FLAG_Z = data_long & mask_long;
+         FLAG_V = VFLAG_CLEAR;
+         FLAG_C = CFLAG_CLEAR;
+
+         m68ki_write_32(ea, data_long | mask_long);
+
+         if((width + offset) > 32)
+         {
+            mask_byte = MASK_OUT_ABOVE_8(mask_base);
+            data_byte = m68ki_read_8(ea+4);
+            FLAG_Z |= (data_byte & mask_byte);
+            m68ki_write_8(ea+4, data_byte | mask_byte);
+         }
+         goto m68k_op_bfset_32_di_done;
+      }
+      m68ki_exception_illegal();
+   }
+m68k_op_bfset_32_di_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_bfset_32_ix:
+   {
+      m68ki_resolve_flags();
+      if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+      {
+         uint word2 = OPER_I_16();
+         sint offset = (word2>>6)&31;
+         uint width = word2;
+         uint mask_base;
+         uint data_long;
+         uint mask_long;
+         uint data_byte = 0;
+         uint mask_byte = 0;
+         uint ea = EA_AY_IX_8();
+
+
+         if(BIT_B(word2))
+            offset = MAKE_INT_32(REG_D[offset&7]);
+         if(BIT_5(word2))
+            width = REG_D[width&7];
+
+         /* Offset is signed so we have to use ugly math =( */
+         ea += offset / 8;
+         offset %= 8;
+         if(offset < 0)
+         {
+            offset += 8;
+            ea--;
+         }
+         width = ((width-1) & 31) + 1;
+
+
+         mask_base = MASK_OUT_ABOVE_32(0xffffffff << (32 - width));
+         mask_long = mask_base >> offset;
+
+         data_long = m68ki_read_32(ea);
+         FLAG_N = NFLAG_32(data_long << offset);
+         FLAG_Z = data_long & mask_long;
+         FLAG_V = VFLAG_CLEAR;
+         FLAG_C = CFLAG_CLEAR;
+
+         m68ki_write_32(ea, data_long | mask_long);
+
+         if((width + offset) > 32)
+         {
+            mask_byte = MASK_OUT_ABOVE_8(mask_base);
+            data_byte = m68ki_read_8(ea+4);
+            FLAG_Z |= (data_byte & mask_byte);
+            m68ki_write_8(ea+4, data_byte | mask_byte);
+         }
+         goto m68k_op_bfset_32_ix_done;
+      }
+      m68ki_exception_illegal();
+   }
+m68k_op_bfset_32_ix_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_bfset_32_aw:
+   {
+      m68ki_resolve_flags();
+      if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+      {
+         uint word2 = OPER_I_16();
+         sint offset = (word2>>6)&31;
+         uint width = word2;
+         uint mask_base;
+         uint data_long;
+         uint mask_long;
+         uint data_byte = 0;
+         uint mask_byte = 0;
+         uint ea = EA_AW_8();
+
+
+         if(BIT_B(word2))
+            offset = MAKE_INT_32(REG_D[offset&7]);
+         if(BIT_5(word2))
+            width = REG_D[width&7];
+
+         /* Offset is signed so we have to use ugly math =( */
+         ea += offset / 8;
+         offset %= 8;
+         if(offset < 0)
+         {
+            offset += 8;
+            ea--;
+         }
+         width = ((width-1) & 31) + 1;
+
+
+         mask_base = MASK_OUT_ABOVE_32(0xffffffff << (32 - width));
+         mask_long = mask_base >> offset;
+
+         data_long = m68ki_read_32(ea);
+         FLAG_N = NFLAG_32(data_long << offset);
+         FLAG_Z = data_long & mask_long;
+         FLAG_V = VFLAG_CLEAR;
+         FLAG_C = CFLAG_CLEAR;
+
+         m68ki_write_32(ea, data_long | mask_long);
+
+         if((width + offset) > 32)
+         {
+            mask_byte = MASK_OUT_ABOVE_8(mask_base);
+            data_byte = m68ki_read_8(ea+4);
+            FLAG_Z |= (data_byte & mask_byte);
+            m68ki_write_8(ea+4, data_byte | mask_byte);
+         }
+         goto m68k_op_bfset_32_aw_done;
+      }
+      m68ki_exception_illegal();
+   }
+m68k_op_bfset_32_aw_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_bfset_32_al:
+   {
+      m68ki_resolve_flags();
+      if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+      {
+         uint word2 = OPER_I_16();
+         sint offset = (word2>>6)&31;
+         uint width = word2;
+         uint mask_base;
+         uint data_long;
+         uint mask_long;
+         uint data_byte = 0;
+         uint mask_byte = 0;
+         uint ea = EA_AL_8();
+
+
+         if(BIT_B(word2))
+            offset = MAKE_INT_32(REG_D[offset&7]);
+         if(BIT_5(word2))
+            width = REG_D[width&7];
+
+         /* Offset is signed so we have to use ugly math =( */
+         ea += offset / 8;
+         offset %= 8;
+         if(offset < 0)
+         {
+            offset += 8;
+            ea--;
+         }
+         width = ((width-1) & 31) + 1;
+
+
+         mask_base = MASK_OUT_ABOVE_32(0xffffffff << (32 - width));
+         mask_long = mask_base >> offset;
+
+         data_long = m68ki_read_32(ea);
+         FLAG_N = NFLAG_32(data_long << offset);
+         FLAG_Z = data_long & mask_long;
+         FLAG_V = VFLAG_CLEAR;
+         FLAG_C = CFLAG_CLEAR;
+
+         m68ki_write_32(ea, data_long | mask_long);
+
+         if((width + offset) > 32)
+         {
+            mask_byte = MASK_OUT_ABOVE_8(mask_base);
+            data_byte = m68ki_read_8(ea+4);
+            FLAG_Z |= (data_byte & mask_byte);
+            m68ki_write_8(ea+4, data_byte | mask_byte);
+         }
+         goto m68k_op_bfset_32_al_done;
+      }
+      m68ki_exception_illegal();
+   }
+m68k_op_bfset_32_al_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_bftst_32_d:
+   {
+      m68ki_resolve_flags();
+      if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+      {
+         uint word2 = OPER_I_16();
+         uint offset = (word2>>6)&31;
+         uint width = word2;
+         uint* data = &DY;
+         uint64 mask;
+
+
+         if(BIT_B(word2))
+            offset = REG_D[offset&7];
+         if(BIT_5(word2))
+            width = REG_D[width&7];
+
+
+         offset &= 31;
+         width = ((width-1) & 31) + 1;
+
+
+         mask = MASK_OUT_ABOVE_32(0xffffffff << (32 - width));
+         mask = ROR_32(mask, offset);
+
+         FLAG_N = NFLAG_32(*data<<offset);
+         FLAG_Z = *data & mask;
+         FLAG_V = VFLAG_CLEAR;
+         FLAG_C = CFLAG_CLEAR;
+
+         goto m68k_op_bftst_32_d_done;
+      }
+      m68ki_exception_illegal();
+   }
+m68k_op_bftst_32_d_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_bftst_32_ai:
+   {
+      m68ki_resolve_flags();
+      if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+      {
+         uint word2 = OPER_I_16();
+         sint offset = (word2>>6)&31;
+         uint width = word2;
+         uint mask_base;
+         uint data_long;
+         uint mask_long;
+         uint data_byte = 0;
+         uint mask_byte = 0;
+         uint ea = EA_AY_AI_8();
+
+         if(BIT_B(word2))
+            offset = MAKE_INT_32(REG_D[offset&7]);
+         if(BIT_5(word2))
+            width = REG_D[width&7];
+
+         /* Offset is signed so we have to use ugly math =( */
+         ea += offset / 8;
+         offset %= 8;
+         if(offset < 0)
+         {
+            offset += 8;
+            ea--;
+         }
+         width = ((width-1) & 31) + 1;
+
+
+         mask_base = MASK_OUT_ABOVE_32(0xffffffff << (32 - width));
+         mask_long = mask_base >> offset;
+
+         data_long = m68ki_read_32(ea);
+         FLAG_N = ((data_long & (0x80000000 >> offset))<<offset)>>24;
+         FLAG_Z = data_long & mask_long;
+         FLAG_V = VFLAG_CLEAR;
+         FLAG_C = CFLAG_CLEAR;
+
+         if((width + offset) > 32)
+         {
+            mask_byte = MASK_OUT_ABOVE_8(mask_base);
+            data_byte = m68ki_read_8(ea+4);
+            FLAG_Z |= (data_byte & mask_byte);
+         }
+         goto m68k_op_bftst_32_ai_done;
+      }
+      m68ki_exception_illegal();
+   }
+m68k_op_bftst_32_ai_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_bftst_32_di:
+   {
+      m68ki_resolve_flags();
+      if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+      {
+         uint word2 = OPER_I_16();
+         sint offset = (word2>>6)&31;
+         uint width = word2;
+         uint mask_base;
+         uint data_long;
+         uint mask_long;
+         uint data_byte = 0;
+         uint mask_byte = 0;
+         uint ea = EA_AY_DI_8();
+
+         if(BIT_B(word2))
+            offset = MAKE_INT_32(REG_D[offset&7]);
+         if(BIT_5(word2))
+            width = REG_D[width&7];
+
+         /* Offset is signed so we have to use ugly math =( */
+         ea += offset / 8;
+         offset %= 8;
+         if(offset < 0)
+         {
+            offset += 8;
+            ea--;
+         }
+         width = ((width-1) & 31) + 1;
+
+
+         mask_base = MASK_OUT_ABOVE_32(0xffffffff << (32 - width));
+         mask_long = mask_base >> offset;
+
+         data_long = m68ki_read_32(ea);
+         FLAG_N = ((data_long & (0x80000000 >> offset))<<offset)>>24;
+         FLAG_Z = data_long & mask_long;
+         FLAG_V = VFLAG_CLEAR;
+         FLAG_C = CFLAG_CLEAR;
+
+         if((width + offset) > 32)
+         {
+            mask_byte = MASK_OUT_ABOVE_8(mask_base);
+            data_byte = m68ki_read_8(ea+4);
+            FLAG_Z |= (data_byte & mask_byte);
+         }
+         goto m68k_op_bftst_32_di_done;
+      }
+      m68ki_exception_illegal();
+   }
+m68k_op_bftst_32_di_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_bftst_32_ix:
+   {
+      m68ki_resolve_flags();
+      if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+      {
+         uint word2 = OPER_I_16();
+         sint offset = (word2>>6)&31;
+         uint width = word2;
+         uint mask_base;
+         uint data_long;
+         uint mask_long;
+         uint data_byte = 0;
+         uint mask_byte = 0;
+         uint ea = EA_AY_IX_8();
+
+         if(BIT_B(word2))
+            offset = MAKE_INT_32(REG_D[offset&7]);
+         if(BIT_5(word2))
+            width = REG_D[width&7];
+
+         /* Offset is signed so we have to use ugly math =( */
+         ea += offset / 8;
+         offset %= 8;
+         if(offset < 0)
+         {
+            offset += 8;
+            ea--;
+         }
+         width = ((width-1) & 31) + 1;
+
+
+         mask_base = MASK_OUT_ABOVE_32(0xffffffff << (32 - width));
+         mask_long = mask_base >> offset;
+
+         data_long = m68ki_read_32(ea);
+         FLAG_N = ((data_long & (0x80000000 >> offset))<<offset)>>24;
+         FLAG_Z = data_long & mask_long;
+         FLAG_V = VFLAG_CLEAR;
+         FLAG_C = CFLAG_CLEAR;
+
+         if((width + offset) > 32)
+         {
+            mask_byte = MASK_OUT_ABOVE_8(mask_base);
+            data_byte = m68ki_read_8(ea+4);
+            FLAG_Z |= (data_byte & mask_byte);
+         }
+         goto m68k_op_bftst_32_ix_done;
+      }
+      m68ki_exception_illegal();
+   }
+m68k_op_bftst_32_ix_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_bftst_32_aw:
+   {
+      m68ki_resolve_flags();
+      if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+      {
+         uint word2 = OPER_I_16();
+         sint offset = (word2>>6)&31;
+         uint width = word2;
+         uint mask_base;
+         uint data_long;
+         uint mask_long;
+         uint data_byte = 0;
+         uint mask_byte = 0;
+         uint ea = EA_AW_8();
+
+         if(BIT_B(word2))
+            offset = MAKE_INT_32(REG_D[offset&7]);
+         if(BIT_5(word2))
+            width = REG_D[width&7];
+
+         /* Offset is signed so we have to use ugly math =( */
+         ea += offset / 8;
+         offset %= 8;
+         if(offset < 0)
+         {
+            offset += 8;
+            ea--;
+         }
+         width = ((width-1) & 31) + 1;
+
+
+         mask_base = MASK_OUT_ABOVE_32(0xffffffff << (32 - width));
+         mask_long = mask_base >> offset;
+
+         data_long = m68ki_read_32(ea);
+         FLAG_N = ((data_long & (0x80000000 >> offset))<<offset)>>24;
+         FLAG_Z = data_long & mask_long;
+         FLAG_V = VFLAG_CLEAR;
+         FLAG_C = CFLAG_CLEAR;
+
+         if((width + offset) > 32)
+         {
+            mask_byte = MASK_OUT_ABOVE_8(mask_base);
+            data_byte = m68ki_read_8(ea+4);
+            FLAG_Z |= (data_byte & mask_byte);
+         }
+         goto m68k_op_bftst_32_aw_done;
+      }
+      m68ki_exception_illegal();
+   }
+m68k_op_bftst_32_aw_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_bftst_32_al:
+   {
+      m68ki_resolve_flags();
+      if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+      {
+         uint word2 = OPER_I_16();
+         sint offset = (word2>>6)&31;
+         uint width = word2;
+         uint mask_base;
+         uint data_long;
+         uint mask_long;
+         uint data_byte = 0;
+         uint mask_byte = 0;
+         uint ea = EA_AL_8();
+
+         if(BIT_B(word2))
+            offset = MAKE_INT_32(REG_D[offset&7]);
+         if(BIT_5(word2))
+            width = REG_D[width&7];
+
+         /* Offset is signed so we have to use ugly math =( */
+         ea += offset / 8;
+         offset %= 8;
+         if(offset < 0)
+         {
+            offset += 8;
+            ea--;
+         }
+         width = ((width-1) & 31) + 1;
+
+
+         mask_base = MASK_OUT_ABOVE_32(0xffffffff << (32 - width));
+         mask_long = mask_base >> offset;
+
+         data_long = m68ki_read_32(ea);
+         FLAG_N = ((data_long & (0x80000000 >> offset))<<offset)>>24;
+         FLAG_Z = data_long & mask_long;
+         FLAG_V = VFLAG_CLEAR;
+         FLAG_C = CFLAG_CLEAR;
+
+         if((width + offset) > 32)
+         {
+            mask_byte = MASK_OUT_ABOVE_8(mask_base);
+            data_byte = m68ki_read_8(ea+4);
+            FLAG_Z |= (data_byte & mask_byte);
+         }
+         goto m68k_op_bftst_32_al_done;
+      }
+      m68ki_exception_illegal();
+   }
+m68k_op_bftst_32_al_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_bftst_32_pcdi:
+   {
+      m68ki_resolve_flags();
+      if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+      {
+         uint word2 = OPER_I_16();
+         sint offset = (word2>>6)&31;
+         uint width = word2;
+         uint mask_base;
+         uint data_long;
+         uint mask_long;
+         uint data_byte = 0;
+         uint mask_byte = 0;
+         uint ea = EA_PCDI_8();
+
+         if(BIT_B(word2))
+            offset = MAKE_INT_32(REG_D[offset&7]);
+         if(BIT_5(word2))
+            width = REG_D[width&7];
+
+         /* Offset is signed so we have to use ugly math =( */
+         ea += offset / 8;
+         offset %= 8;
+         if(offset < 0)
+         {
+            offset += 8;
+            ea--;
+         }
+         width = ((width-1) & 31) + 1;
+
+
+         mask_base = MASK_OUT_ABOVE_32(0xffffffff << (32 - width));
+         mask_long = mask_base >> offset;
+
+         data_long = m68ki_read_32(ea);
+         FLAG_N = ((data_long & (0x80000000 >> offset))<<offset)>>24;
+         FLAG_Z = data_long & mask_long;
+         FLAG_V = VFLAG_CLEAR;
+         FLAG_C = CFLAG_CLEAR;
+
+         if((width + offset) > 32)
+         {
+            mask_byte = MASK_OUT_ABOVE_8(mask_base);
+            data_byte = m68ki_read_8(ea+4);
+            FLAG_Z |= (data_byte & mask_byte);
+         }
+         goto m68k_op_bftst_32_pcdi_done;
+      }
+      m68ki_exception_illegal();
+   }
+m68k_op_bftst_32_pcdi_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_bftst_32_pcix:
+   {
+      m68ki_resolve_flags();
+      if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+      {
+         uint word2 = OPER_I_16();
+         sint offset = (word2>>6)&31;
+         uint width = word2;
+         uint mask_base;
+         uint data_long;
+         uint mask_long;
+         uint data_byte = 0;
+         uint mask_byte = 0;
+         uint ea = EA_PCIX_8();
+
+         if(BIT_B(word2))
+            offset = MAKE_INT_32(REG_D[offset&7]);
+         if(BIT_5(word2))
+            width = REG_D[width&7];
+
+         /* Offset is signed so we have to use ugly math =( */
+         ea += offset / 8;
+         offset %= 8;
+         if(offset < 0)
+         {
+            offset += 8;
+            ea--;
+         }
+         width = ((width-1) & 31) + 1;
+
+
+         mask_base = MASK_OUT_ABOVE_32(0xffffffff << (32 - width));
+         mask_long = mask_base >> offset;
+
+         data_long = m68ki_read_32(ea);
+         FLAG_N = ((data_long & (0x80000000 >> offset))<<offset)>>24;
+         FLAG_Z = data_long & mask_long;
+         FLAG_V = VFLAG_CLEAR;
+         FLAG_C = CFLAG_CLEAR;
+
+         if((width + offset) > 32)
+         {
+            mask_byte = MASK_OUT_ABOVE_8(mask_base);
+            data_byte = m68ki_read_8(ea+4);
+            FLAG_Z |= (data_byte & mask_byte);
+         }
+         goto m68k_op_bftst_32_pcix_done;
+      }
+      m68ki_exception_illegal();
+   }
+m68k_op_bftst_32_pcix_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_bkpt:
+   {
+      if(CPU_TYPE_IS_010_PLUS(CPU_TYPE))
+      {
+         m68ki_bkpt_ack(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE) ? REG_IR & 7 : 0);	/* auto-disable (see m68kcpu.h) */
+      }
+      m68ki_exception_illegal();
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_bra_8:
+   {
+      m68ki_trace_t0();				   /* auto-disable (see m68kcpu.h) */
+      m68ki_branch_8(MASK_OUT_ABOVE_8(REG_IR));
+      if(REG_PC == REG_PPC)
+         USE_ALL_CYCLES();
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_bra_16:
+   {
+      uint offset = OPER_I_16();
+      REG_PC -= 2;
+      m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
+      m68ki_branch_16(offset);
+      if(REG_PC == REG_PPC)
+         USE_ALL_CYCLES();
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_bra_32:
+   {
+      if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+      {
+         uint offset = OPER_I_32();
+         REG_PC -= 4;
+         m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
+         m68ki_branch_32(offset);
+         if(REG_PC == REG_PPC)
+            USE_ALL_CYCLES();
+         goto m68k_op_bra_32_done;
+      }
+      m68ki_exception_illegal();
+   }
+m68k_op_bra_32_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_bset_32_r_d:
+   {
+      uint* r_dst = &DY;
+      uint mask = 1 << (DX & 0x1f);
+
+      m68ki_resolve_flags();
+
+      FLAG_Z = *r_dst & mask;
+      *r_dst |= mask;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_bset_8_r_ai:
+   {
+      uint ea = EA_AY_AI_8();
+      uint src = m68ki_read_8(ea);
+      uint mask = 1 << (DX & 7);
+
+      m68ki_resolve_flags();
+
+      FLAG_Z = src & mask;
+      m68ki_write_8(ea, src | mask);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_bset_8_r_pi:
+   {
+      uint ea = EA_AY_PI_8();
+      uint src = m68ki_read_8(ea);
+      uint mask = 1 << (DX & 7);
+
+      m68ki_resolve_flags();
+
+      FLAG_Z = src & mask;
+      m68ki_write_8(ea, src | mask);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_bset_8_r_pi7:
+   {
+      uint ea = EA_A7_PI_8();
+      uint src = m68ki_read_8(ea);
+      uint mask = 1 << (DX & 7);
+
+      m68ki_resolve_flags();
+
+      FLAG_Z = src & mask;
+      m68ki_write_8(ea, src | mask);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_bset_8_r_pd:
+   {
+      uint ea = EA_AY_PD_8();
+      uint src = m68ki_read_8(ea);
+      uint mask = 1 << (DX & 7);
+
+      m68ki_resolve_flags();
+
+      FLAG_Z = src & mask;
+      m68ki_write_8(ea, src | mask);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_bset_8_r_pd7:
+   {
+      uint ea = EA_A7_PD_8();
+      uint src = m68ki_read_8(ea);
+      uint mask = 1 << (DX & 7);
+
+      m68ki_resolve_flags();
+
+      FLAG_Z = src & mask;
+      m68ki_write_8(ea, src | mask);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_bset_8_r_di:
+   {
+      uint ea = EA_AY_DI_8();
+      uint src = m68ki_read_8(ea);
+      uint mask = 1 << (DX & 7);
+
+      m68ki_resolve_flags();
+
+      FLAG_Z = src & mask;
+      m68ki_write_8(ea, src | mask);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_bset_8_r_ix:
+   {
+      uint ea = EA_AY_IX_8();
+      uint src = m68ki_read_8(ea);
+      uint mask = 1 << (DX & 7);
+
+      m68ki_resolve_flags();
+
+      FLAG_Z = src & mask;
+      m68ki_write_8(ea, src | mask);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_bset_8_r_aw:
+   {
+      uint ea = EA_AW_8();
+      uint src = m68ki_read_8(ea);
+      uint mask = 1 << (DX & 7);
+
+      m68ki_resolve_flags();
+
+      FLAG_Z = src & mask;
+      m68ki_write_8(ea, src | mask);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_bset_8_r_al:
+   {
+      uint ea = EA_AL_8();
+      uint src = m68ki_read_8(ea);
+      uint mask = 1 << (DX & 7);
+
+      m68ki_resolve_flags();
+
+      FLAG_Z = src & mask;
+      m68ki_write_8(ea, src | mask);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_bset_32_s_d:
+   {
+      uint* r_dst = &DY;
+      uint mask = 1 << (OPER_I_8() & 0x1f);
+
+      m68ki_resolve_flags();
+
+      FLAG_Z = *r_dst & mask;
+      *r_dst |= mask;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_bset_8_s_ai:
+   {
+      uint mask = 1 << (OPER_I_8() & 7);
+      uint ea = EA_AY_AI_8();
+      uint src = m68ki_read_8(ea);
+
+      m68ki_resolve_flags();
+
+      FLAG_Z = src & mask;
+      m68ki_write_8(ea, src | mask);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_bset_8_s_pi:
+   {
+      uint mask = 1 << (OPER_I_8() & 7);
+      uint ea = EA_AY_PI_8();
+      uint src = m68ki_read_8(ea);
+
+      m68ki_resolve_flags();
+
+      FLAG_Z = src & mask;
+      m68ki_write_8(ea, src | mask);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_bset_8_s_pi7:
+   {
+      uint mask = 1 << (OPER_I_8() & 7);
+      uint ea = EA_A7_PI_8();
+      uint src = m68ki_read_8(ea);
+
+      m68ki_resolve_flags();
+
+      FLAG_Z = src & mask;
+      m68ki_write_8(ea, src | mask);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_bset_8_s_pd:
+   {
+      uint mask = 1 << (OPER_I_8() & 7);
+      uint ea = EA_AY_PD_8();
+      uint src = m68ki_read_8(ea);
+
+      m68ki_resolve_flags();
+
+      FLAG_Z = src & mask;
+      m68ki_write_8(ea, src | mask);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_bset_8_s_pd7:
+   {
+      uint mask = 1 << (OPER_I_8() & 7);
+      uint ea = EA_A7_PD_8();
+      uint src = m68ki_read_8(ea);
+
+      m68ki_resolve_flags();
+
+      FLAG_Z = src & mask;
+      m68ki_write_8(ea, src | mask);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_bset_8_s_di:
+   {
+      uint mask = 1 << (OPER_I_8() & 7);
+      uint ea = EA_AY_DI_8();
+      uint src = m68ki_read_8(ea);
+
+      m68ki_resolve_flags();
+
+      FLAG_Z = src & mask;
+      m68ki_write_8(ea, src | mask);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_bset_8_s_ix:
+   {
+      uint mask = 1 << (OPER_I_8() & 7);
+      uint ea = EA_AY_IX_8();
+      uint src = m68ki_read_8(ea);
+
+      m68ki_resolve_flags();
+
+      FLAG_Z = src & mask;
+      m68ki_write_8(ea, src | mask);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_bset_8_s_aw:
+   {
+      uint mask = 1 << (OPER_I_8() & 7);
+      uint ea = EA_AW_8();
+      uint src = m68ki_read_8(ea);
+
+      m68ki_resolve_flags();
+
+      FLAG_Z = src & mask;
+      m68ki_write_8(ea, src | mask);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_bset_8_s_al:
+   {
+      uint mask = 1 << (OPER_I_8() & 7);
+      uint ea = EA_AL_8();
+      uint src = m68ki_read_8(ea);
+
+      m68ki_resolve_flags();
+
+      FLAG_Z = src & mask;
+      m68ki_write_8(ea, src | mask);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_bsr_8:
+   {
+      m68ki_trace_t0();				   /* auto-disable (see m68kcpu.h) */
+      m68ki_push_32(REG_PC);
+      m68ki_branch_8(MASK_OUT_ABOVE_8(REG_IR));
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_bsr_16:
+   {
+      uint offset = OPER_I_16();
+      m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
+      m68ki_push_32(REG_PC);
+      REG_PC -= 2;
+      m68ki_branch_16(offset);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_bsr_32:
+   {
+      if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+      {
+         uint offset = OPER_I_32();
+         m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
+         m68ki_push_32(REG_PC);
+         REG_PC -= 4;
+         m68ki_branch_32(offset);
+         goto m68k_op_bsr_32_done;
+      }
+      m68ki_exception_illegal();
+   }
+m68k_op_bsr_32_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_btst_32_r_d:
+   {
+      m68ki_resolve_flags();
+      FLAG_Z = DY & (1 << (DX & 0x1f));
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_btst_8_r_ai:
+   {
+      m68ki_resolve_flags();
+      FLAG_Z = OPER_AY_AI_8() & (1 << (DX & 7));
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_btst_8_r_pi:
+   {
+      m68ki_resolve_flags();
+      FLAG_Z = OPER_AY_PI_8() & (1 << (DX & 7));
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_btst_8_r_pi7:
+   {
+      m68ki_resolve_flags();
+      FLAG_Z = OPER_A7_PI_8() & (1 << (DX & 7));
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_btst_8_r_pd:
+   {
+      m68ki_resolve_flags();
+      FLAG_Z = OPER_AY_PD_8() & (1 << (DX & 7));
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_btst_8_r_pd7:
+   {
+      m68ki_resolve_flags();
+      FLAG_Z = OPER_A7_PD_8() & (1 << (DX & 7));
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_btst_8_r_di:
+   {
+      m68ki_resolve_flags();
+      FLAG_Z = OPER_AY_DI_8() & (1 << (DX & 7));
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_btst_8_r_ix:
+   {
+      m68ki_resolve_flags();
+      FLAG_Z = OPER_AY_IX_8() & (1 << (DX & 7));
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_btst_8_r_aw:
+   {
+      m68ki_resolve_flags();
+      FLAG_Z = OPER_AW_8() & (1 << (DX & 7));
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_btst_8_r_al:
+   {
+      m68ki_resolve_flags();
+      FLAG_Z = OPER_AL_8() & (1 << (DX & 7));
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_btst_8_r_pcdi:
+   {
+      m68ki_resolve_flags();
+      FLAG_Z = OPER_PCDI_8() & (1 << (DX & 7));
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_btst_8_r_pcix:
+   {
+      m68ki_resolve_flags();
+      FLAG_Z = OPER_PCIX_8() & (1 << (DX & 7));
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_btst_8_r_i:
+   {
+      m68ki_resolve_flags();
+      FLAG_Z = OPER_I_8() & (1 << (DX & 7));
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_btst_32_s_d:
+   {
+      m68ki_resolve_flags();
+      FLAG_Z = DY & (1 << (OPER_I_8() & 0x1f));
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_btst_8_s_ai:
+   {
+      uint bit = OPER_I_8() & 7;
+
+      m68ki_resolve_flags();
+
+      FLAG_Z = OPER_AY_AI_8() & (1 << bit);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_btst_8_s_pi:
+   {
+      uint bit = OPER_I_8() & 7;
+
+      m68ki_resolve_flags();
+
+      FLAG_Z = OPER_AY_PI_8() & (1 << bit);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_btst_8_s_pi7:
+   {
+      uint bit = OPER_I_8() & 7;
+
+      m68ki_resolve_flags();
+
+      FLAG_Z = OPER_A7_PI_8() & (1 << bit);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_btst_8_s_pd:
+   {
+      uint bit = OPER_I_8() & 7;
+
+      m68ki_resolve_flags();
+
+      FLAG_Z = OPER_AY_PD_8() & (1 << bit);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_btst_8_s_pd7:
+   {
+      uint bit = OPER_I_8() & 7;
+
+      m68ki_resolve_flags();
+
+      FLAG_Z = OPER_A7_PD_8() & (1 << bit);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_btst_8_s_di:
+   {
+      uint bit = OPER_I_8() & 7;
+
+      m68ki_resolve_flags();
+
+      FLAG_Z = OPER_AY_DI_8() & (1 << bit);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_btst_8_s_ix:
+   {
+      uint bit = OPER_I_8() & 7;
+
+      m68ki_resolve_flags();
+
+      FLAG_Z = OPER_AY_IX_8() & (1 << bit);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_btst_8_s_aw:
+   {
+      uint bit = OPER_I_8() & 7;
+
+      m68ki_resolve_flags();
+
+      FLAG_Z = OPER_AW_8() & (1 << bit);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_btst_8_s_al:
+   {
+      uint bit = OPER_I_8() & 7;
+
+      m68ki_resolve_flags();
+
+      FLAG_Z = OPER_AL_8() & (1 << bit);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_btst_8_s_pcdi:
+   {
+      uint bit = OPER_I_8() & 7;
+
+      m68ki_resolve_flags();
+
+      FLAG_Z = OPER_PCDI_8() & (1 << bit);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_btst_8_s_pcix:
+   {
+      uint bit = OPER_I_8() & 7;
+
+      m68ki_resolve_flags();
+
+      FLAG_Z = OPER_PCIX_8() & (1 << bit);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_callm_32_ai:
+   {
+      /* note: watch out for pcrelative modes */
+      if(CPU_TYPE_IS_020_VARIANT(CPU_TYPE))
+      {
+         uint ea = EA_AY_AI_32();
+
+         m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
+         REG_PC += 2;
+   (void)ea;	/* just to avoid an 'unused variable' warning */
+         M68K_DO_LOG((M68K_LOG_FILEHANDLE "%s at %08x: called unimplemented instruction %04x (%s)\n",
+                   m68ki_cpu_names[CPU_TYPE], ADDRESS_68K(REG_PC - 2), REG_IR,
+                   m68k_disassemble_quick(ADDRESS_68K(REG_PC - 2))));
+         goto m68k_op_callm_32_ai_done;
+      }
+      m68ki_exception_illegal();
+   }
+m68k_op_callm_32_ai_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_callm_32_di:
+   {
+      /* note: watch out for pcrelative modes */
+      if(CPU_TYPE_IS_020_VARIANT(CPU_TYPE))
+      {
+         uint ea = EA_AY_DI_32();
+
+         m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
+         REG_PC += 2;
+   (void)ea;	/* just to avoid an 'unused variable' warning */
+         M68K_DO_LOG((M68K_LOG_FILEHANDLE "%s at %08x: called unimplemented instruction %04x (%s)\n",
+                   m68ki_cpu_names[CPU_TYPE], ADDRESS_68K(REG_PC - 2), REG_IR,
+                   m68k_disassemble_quick(ADDRESS_68K(REG_PC - 2))));
+         goto m68k_op_callm_32_di_done;
+      }
+      m68ki_exception_illegal();
+   }
+m68k_op_callm_32_di_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_callm_32_ix:
+   {
+      /* note: watch out for pcrelative modes */
+      if(CPU_TYPE_IS_020_VARIANT(CPU_TYPE))
+      {
+         uint ea = EA_AY_IX_32();
+
+         m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
+         REG_PC += 2;
+   (void)ea;	/* just to avoid an 'unused variable' warning */
+         M68K_DO_LOG((M68K_LOG_FILEHANDLE "%s at %08x: called unimplemented instruction %04x (%s)\n",
+                   m68ki_cpu_names[CPU_TYPE], ADDRESS_68K(REG_PC - 2), REG_IR,
+                   m68k_disassemble_quick(ADDRESS_68K(REG_PC - 2))));
+         goto m68k_op_callm_32_ix_done;
+      }
+      m68ki_exception_illegal();
+   }
+m68k_op_callm_32_ix_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_callm_32_aw:
+   {
+      /* note: watch out for pcrelative modes */
+      if(CPU_TYPE_IS_020_VARIANT(CPU_TYPE))
+      {
+         uint ea = EA_AW_32();
+
+         m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
+         REG_PC += 2;
+   (void)ea;	/* just to avoid an 'unused variable' warning */
+         M68K_DO_LOG((M68K_LOG_FILEHANDLE "%s at %08x: called unimplemented instruction %04x (%s)\n",
+                   m68ki_cpu_names[CPU_TYPE], ADDRESS_68K(REG_PC - 2), REG_IR,
+                   m68k_disassemble_quick(ADDRESS_68K(REG_PC - 2))));
+         goto m68k_op_callm_32_aw_done;
+      }
+      m68ki_exception_illegal();
+   }
+m68k_op_callm_32_aw_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_callm_32_al:
+   {
+      /* note: watch out for pcrelative modes */
+      if(CPU_TYPE_IS_020_VARIANT(CPU_TYPE))
+      {
+         uint ea = EA_AL_32();
+
+         m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
+         REG_PC += 2;
+   (void)ea;	/* just to avoid an 'unused variable' warning */
+         M68K_DO_LOG((M68K_LOG_FILEHANDLE "%s at %08x: called unimplemented instruction %04x (%s)\n",
+                   m68ki_cpu_names[CPU_TYPE], ADDRESS_68K(REG_PC - 2), REG_IR,
+                   m68k_disassemble_quick(ADDRESS_68K(REG_PC - 2))));
+         goto m68k_op_callm_32_al_done;
+      }
+      m68ki_exception_illegal();
+   }
+m68k_op_callm_32_al_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_callm_32_pcdi:
+   {
+      /* note: watch out for pcrelative modes */
+      if(CPU_TYPE_IS_020_VARIANT(CPU_TYPE))
+      {
+         uint ea = EA_PCDI_32();
+
+         m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
+         REG_PC += 2;
+   (void)ea;	/* just to avoid an 'unused variable' warning */
+         M68K_DO_LOG((M68K_LOG_FILEHANDLE "%s at %08x: called unimplemented instruction %04x (%s)\n",
+                   m68ki_cpu_names[CPU_TYPE], ADDRESS_68K(REG_PC - 2), REG_IR,
+                   m68k_disassemble_quick(ADDRESS_68K(REG_PC - 2))));
+         goto m68k_op_callm_32_pcdi_done;
+      }
+      m68ki_exception_illegal();
+   }
+m68k_op_callm_32_pcdi_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_callm_32_pcix:
+   {
+      /* note: watch out for pcrelative modes */
+      if(CPU_TYPE_IS_020_VARIANT(CPU_TYPE))
+      {
+         uint ea = EA_PCIX_32();
+
+         m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
+         REG_PC += 2;
+   (void)ea;	/* just to avoid an 'unused variable' warning */
+         M68K_DO_LOG((M68K_LOG_FILEHANDLE "%s at %08x: called unimplemented instruction %04x (%s)\n",
+                   m68ki_cpu_names[CPU_TYPE], ADDRESS_68K(REG_PC - 2), REG_IR,
+                   m68k_disassemble_quick(ADDRESS_68K(REG_PC - 2))));
+         goto m68k_op_callm_32_pcix_done;
+      }
+      m68ki_exception_illegal();
+   }
+m68k_op_callm_32_pcix_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_cas_8_ai:
+   {
+      m68ki_resolve_flags();
+      if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+      {
+         uint word2 = OPER_I_16();
+         uint ea = EA_AY_AI_8();
+         uint dest = m68ki_read_8(ea);
+         uint* compare = &REG_D[word2 & 7];
+         uint res = dest - MASK_OUT_ABOVE_8(*compare);
+
+         m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
+         FLAG_N = NFLAG_8(res);
+         FLAG_Z = MASK_OUT_ABOVE_8(res);
+         FLAG_V = VFLAG_SUB_8(*compare, dest, res);
+         FLAG_C = CFLAG_8(res);
+
+         if(COND_NE())
+            *compare = MASK_OUT_BELOW_8(*compare) | dest;
+         else
+         {
+            USE_CYCLES(3);
+            m68ki_write_8(ea, MASK_OUT_ABOVE_8(REG_D[(word2 >> 6) & 7]));
+         }
+         goto m68k_op_cas_8_ai_done;
+      }
+      m68ki_exception_illegal();
+   }
+m68k_op_cas_8_ai_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_cas_8_pi:
+   {
+      m68ki_resolve_flags();
+      if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+      {
+         uint word2 = OPER_I_16();
+         uint ea = EA_AY_PI_8();
+         uint dest = m68ki_read_8(ea);
+         uint* compare = &REG_D[word2 & 7];
+         uint res = dest - MASK_OUT_ABOVE_8(*compare);
+
+         m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
+         FLAG_N = NFLAG_8(res);
+         FLAG_Z = MASK_OUT_ABOVE_8(res);
+         FLAG_V = VFLAG_SUB_8(*compare, dest, res);
+         FLAG_C = CFLAG_8(res);
+
+         if(COND_NE())
+            *compare = MASK_OUT_BELOW_8(*compare) | dest;
+         else
+         {
+            USE_CYCLES(3);
+            m68ki_write_8(ea, MASK_OUT_ABOVE_8(REG_D[(word2 >> 6) & 7]));
+         }
+         goto m68k_op_cas_8_pi_done;
+      }
+      m68ki_exception_illegal();
+   }
+m68k_op_cas_8_pi_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_cas_8_pi7:
+   {
+      m68ki_resolve_flags();
+      if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+      {
+         uint word2 = OPER_I_16();
+         uint ea = EA_A7_PI_8();
+         uint dest = m68ki_read_8(ea);
+         uint* compare = &REG_D[word2 & 7];
+         uint res = dest - MASK_OUT_ABOVE_8(*compare);
+
+         m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
+         FLAG_N = NFLAG_8(res);
+         FLAG_Z = MASK_OUT_ABOVE_8(res);
+         FLAG_V = VFLAG_SUB_8(*compare, dest, res);
+         FLAG_C = CFLAG_8(res);
+
+         if(COND_NE())
+            *compare = MASK_OUT_BELOW_8(*compare) | dest;
+         else
+         {
+            USE_CYCLES(3);
+            m68ki_write_8(ea, MASK_OUT_ABOVE_8(REG_D[(word2 >> 6) & 7]));
+         }
+         goto m68k_op_cas_8_pi7_done;
+      }
+      m68ki_exception_illegal();
+   }
+m68k_op_cas_8_pi7_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_cas_8_pd:
+   {
+      m68ki_resolve_flags();
+      if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+      {
+         uint word2 = OPER_I_16();
+         uint ea = EA_AY_PD_8();
+         uint dest = m68ki_read_8(ea);
+         uint* compare = &REG_D[word2 & 7];
+         uint res = dest - MASK_OUT_ABOVE_8(*compare);
+
+         m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
+         FLAG_N = NFLAG_8(res);
+         FLAG_Z = MASK_OUT_ABOVE_8(res);
+         FLAG_V = VFLAG_SUB_8(*compare, dest, res);
+         FLAG_C = CFLAG_8(res);
+
+         if(COND_NE())
+            *compare = MASK_OUT_BELOW_8(*compare) | dest;
+         else
+         {
+            USE_CYCLES(3);
+            m68ki_write_8(ea, MASK_OUT_ABOVE_8(REG_D[(word2 >> 6) & 7]));
+         }
+         goto m68k_op_cas_8_pd_done;
+      }
+      m68ki_exception_illegal();
+   }
+m68k_op_cas_8_pd_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_cas_8_pd7:
+   {
+      m68ki_resolve_flags();
+      if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+      {
+         uint word2 = OPER_I_16();
+         uint ea = EA_A7_PD_8();
+         uint dest = m68ki_read_8(ea);
+         uint* compare = &REG_D[word2 & 7];
+         uint res = dest - MASK_OUT_ABOVE_8(*compare);
+
+         m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
+         FLAG_N = NFLAG_8(res);
+         FLAG_Z = MASK_OUT_ABOVE_8(res);
+         FLAG_V = VFLAG_SUB_8(*compare, dest, res);
+         FLAG_C = CFLAG_8(res);
+
+         if(COND_NE())
+            *compare = MASK_OUT_BELOW_8(*compare) | dest;
+         else
+         {
+            USE_CYCLES(3);
+            m68ki_write_8(ea, MASK_OUT_ABOVE_8(REG_D[(word2 >> 6) & 7]));
+         }
+         goto m68k_op_cas_8_pd7_done;
+      }
+      m68ki_exception_illegal();
+   }
+m68k_op_cas_8_pd7_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_cas_8_di:
+   {
+      m68ki_resolve_flags();
+      if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+      {
+         uint word2 = OPER_I_16();
+         uint ea = EA_AY_DI_8();
+         uint dest = m68ki_read_8(ea);
+         uint* compare = &REG_D[word2 & 7];
+         uint res = dest - MASK_OUT_ABOVE_8(*compare);
+
+         m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
+         FLAG_N = NFLAG_8(res);
+         FLAG_Z = MASK_OUT_ABOVE_8(res);
+         FLAG_V = VFLAG_SUB_8(*compare, dest, res);
+         FLAG_C = CFLAG_8(res);
+
+         if(COND_NE())
+            *compare = MASK_OUT_BELOW_8(*compare) | dest;
+         else
+         {
+            USE_CYCLES(3);
+            m68ki_write_8(ea, MASK_OUT_ABOVE_8(REG_D[(word2 >> 6) & 7]));
+         }
+         goto m68k_op_cas_8_di_done;
+      }
+      m68ki_exception_illegal();
+   }
+m68k_op_cas_8_di_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_cas_8_ix:
+   {
+      m68ki_resolve_flags();
+      if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+      {
+         uint word2 = OPER_I_16();
+         uint ea = EA_AY_IX_8();
+         uint dest = m68ki_read_8(ea);
+         uint* compare = &REG_D[word2 & 7];
+         uint res = dest - MASK_OUT_ABOVE_8(*compare);
+
+         m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
+         FLAG_N = NFLAG_8(res);
+         FLAG_Z = MASK_OUT_ABOVE_8(res);
+         FLAG_V = VFLAG_SUB_8(*compare, dest, res);
+         FLAG_C = CFLAG_8(res);
+
+         if(COND_NE())
+            *compare = MASK_OUT_BELOW_8(*compare) | dest;
+         else
+         {
+            USE_CYCLES(3);
+            m68ki_write_8(ea, MASK_OUT_ABOVE_8(REG_D[(word2 >> 6) & 7]));
+         }
+         goto m68k_op_cas_8_ix_done;
+      }
+      m68ki_exception_illegal();
+   }
+m68k_op_cas_8_ix_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_cas_8_aw:
+   {
+      m68ki_resolve_flags();
+      if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+      {
+         uint word2 = OPER_I_16();
+         uint ea = EA_AW_8();
+         uint dest = m68ki_read_8(ea);
+         uint* compare = &REG_D[word2 & 7];
+         uint res = dest - MASK_OUT_ABOVE_8(*compare);
+
+         m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
+         FLAG_N = NFLAG_8(res);
+         FLAG_Z = MASK_OUT_ABOVE_8(res);
+         FLAG_V = VFLAG_SUB_8(*compare, dest, res);
+         FLAG_C = CFLAG_8(res);
+
+         if(COND_NE())
+            *compare = MASK_OUT_BELOW_8(*compare) | dest;
+         else
+         {
+            USE_CYCLES(3);
+            m68ki_write_8(ea, MASK_OUT_ABOVE_8(REG_D[(word2 >> 6) & 7]));
+         }
+         goto m68k_op_cas_8_aw_done;
+      }
+      m68ki_exception_illegal();
+   }
+m68k_op_cas_8_aw_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_cas_8_al:
+   {
+      m68ki_resolve_flags();
+      if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+      {
+         uint word2 = OPER_I_16();
+         uint ea = EA_AL_8();
+         uint dest = m68ki_read_8(ea);
+         uint* compare = &REG_D[word2 & 7];
+         uint res = dest - MASK_OUT_ABOVE_8(*compare);
+
+         m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
+         FLAG_N = NFLAG_8(res);
+         FLAG_Z = MASK_OUT_ABOVE_8(res);
+         FLAG_V = VFLAG_SUB_8(*compare, dest, res);
+         FLAG_C = CFLAG_8(res);
+
+         if(COND_NE())
+            *compare = MASK_OUT_BELOW_8(*compare) | dest;
+         else
+         {
+            USE_CYCLES(3);
+            m68ki_write_8(ea, MASK_OUT_ABOVE_8(REG_D[(word2 >> 6) & 7]));
+         }
+         goto m68k_op_cas_8_al_done;
+      }
+      m68ki_exception_illegal();
+   }
+m68k_op_cas_8_al_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_cas_16_ai:
+   {
+      m68ki_resolve_flags();
+      if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+      {
+         uint word2 = OPER_I_16();
+         uint ea = EA_AY_AI_16();
+         uint dest = m68ki_read_16(ea);
+         uint* compare = &REG_D[word2 & 7];
+         uint res = dest - MASK_OUT_ABOVE_16(*compare);
+
+         m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
+         FLAG_N = NFLAG_16(res);
+         FLAG_Z = MASK_OUT_ABOVE_16(res);
+         FLAG_V = VFLAG_SUB_16(*compare, dest, res);
+         FLAG_C = CFLAG_16(res);
+
+         if(COND_NE())
+            *compare = MASK_OUT_BELOW_16(*compare) | dest;
+         else
+         {
+            USE_CYCLES(3);
+            m68ki_write_16(ea, MASK_OUT_ABOVE_16(REG_D[(word2 >> 6) & 7]));
+         }
+         goto m68k_op_cas_16_ai_done;
+      }
+      m68ki_exception_illegal();
+   }
+m68k_op_cas_16_ai_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_cas_16_pi:
+   {
+      m68ki_resolve_flags();
+      if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+      {
+         uint word2 = OPER_I_16();
+         uint ea = EA_AY_PI_16();
+         uint dest = m68ki_read_16(ea);
+         uint* compare = &REG_D[word2 & 7];
+         uint res = dest - MASK_OUT_ABOVE_16(*compare);
+
+         m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
+         FLAG_N = NFLAG_16(res);
+         FLAG_Z = MASK_OUT_ABOVE_16(res);
+         FLAG_V = VFLAG_SUB_16(*compare, dest, res);
+         FLAG_C = CFLAG_16(res);
+
+         if(COND_NE())
+            *compare = MASK_OUT_BELOW_16(*compare) | dest;
+         else
+         {
+            USE_CYCLES(3);
+            m68ki_write_16(ea, MASK_OUT_ABOVE_16(REG_D[(word2 >> 6) & 7]));
+         }
+         goto m68k_op_cas_16_pi_done;
+      }
+      m68ki_exception_illegal();
+   }
+m68k_op_cas_16_pi_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_cas_16_pd:
+   {
+      m68ki_resolve_flags();
+      if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+      {
+         uint word2 = OPER_I_16();
+         uint ea = EA_AY_PD_16();
+         uint dest = m68ki_read_16(ea);
+         uint* compare = &REG_D[word2 & 7];
+         uint res = dest - MASK_OUT_ABOVE_16(*compare);
+
+         m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
+         FLAG_N = NFLAG_16(res);
+         FLAG_Z = MASK_OUT_ABOVE_16(res);
+         FLAG_V = VFLAG_SUB_16(*compare, dest, res);
+         FLAG_C = CFLAG_16(res);
+
+         if(COND_NE())
+            *compare = MASK_OUT_BELOW_16(*compare) | dest;
+         else
+         {
+            USE_CYCLES(3);
+            m68ki_write_16(ea, MASK_OUT_ABOVE_16(REG_D[(word2 >> 6) & 7]));
+         }
+         goto m68k_op_cas_16_pd_done;
+      }
+      m68ki_exception_illegal();
+   }
+m68k_op_cas_16_pd_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_cas_16_di:
+   {
+      m68ki_resolve_flags();
+      if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+      {
+         uint word2 = OPER_I_16();
+         uint ea = EA_AY_DI_16();
+         uint dest = m68ki_read_16(ea);
+         uint* compare = &REG_D[word2 & 7];
+         uint res = dest - MASK_OUT_ABOVE_16(*compare);
+
+         m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
+         FLAG_N = NFLAG_16(res);
+         FLAG_Z = MASK_OUT_ABOVE_16(res);
+         FLAG_V = VFLAG_SUB_16(*compare, dest, res);
+         FLAG_C = CFLAG_16(res);
+
+         if(COND_NE())
+            *compare = MASK_OUT_BELOW_16(*compare) | dest;
+         else
+         {
+            USE_CYCLES(3);
+            m68ki_write_16(ea, MASK_OUT_ABOVE_16(REG_D[(word2 >> 6) & 7]));
+         }
+         goto m68k_op_cas_16_di_done;
+      }
+      m68ki_exception_illegal();
+   }
+m68k_op_cas_16_di_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_cas_16_ix:
+   {
+      m68ki_resolve_flags();
+      if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+      {
+         uint word2 = OPER_I_16();
+         uint ea = EA_AY_IX_16();
+         uint dest = m68ki_read_16(ea);
+         uint* compare = &REG_D[word2 & 7];
+         uint res = dest - MASK_OUT_ABOVE_16(*compare);
+
+         m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
+         FLAG_N = NFLAG_16(res);
+         FLAG_Z = MASK_OUT_ABOVE_16(res);
+         FLAG_V = VFLAG_SUB_16(*compare, dest, res);
+         FLAG_C = CFLAG_16(res);
+
+         if(COND_NE())
+            *compare = MASK_OUT_BELOW_16(*compare) | dest;
+         else
+         {
+            USE_CYCLES(3);
+            m68ki_write_16(ea, MASK_OUT_ABOVE_16(REG_D[(word2 >> 6) & 7]));
+         }
+         goto m68k_op_cas_16_ix_done;
+      }
+      m68ki_exception_illegal();
+   }
+m68k_op_cas_16_ix_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_cas_16_aw:
+   {
+      m68ki_resolve_flags();
+      if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+      {
+         uint word2 = OPER_I_16();
+         uint ea = EA_AW_16();
+         uint dest = m68ki_read_16(ea);
+         uint* compare = &REG_D[word2 & 7];
+         uint res = dest - MASK_OUT_ABOVE_16(*compare);
+
+         m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
+         FLAG_N = NFLAG_16(res);
+         FLAG_Z = MASK_OUT_ABOVE_16(res);
+         FLAG_V = VFLAG_SUB_16(*compare, dest, res);
+         FLAG_C = CFLAG_16(res);
+
+         if(COND_NE())
+            *compare = MASK_OUT_BELOW_16(*compare) | dest;
+         else
+         {
+            USE_CYCLES(3);
+            m68ki_write_16(ea, MASK_OUT_ABOVE_16(REG_D[(word2 >> 6) & 7]));
+         }
+         goto m68k_op_cas_16_aw_done;
+      }
+      m68ki_exception_illegal();
+   }
+m68k_op_cas_16_aw_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_cas_16_al:
+   {
+      m68ki_resolve_flags();
+      if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+      {
+         uint word2 = OPER_I_16();
+         uint ea = EA_AL_16();
+         uint dest = m68ki_read_16(ea);
+         uint* compare = &REG_D[word2 & 7];
+         uint res = dest - MASK_OUT_ABOVE_16(*compare);
+
+         m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
+         FLAG_N = NFLAG_16(res);
+         FLAG_Z = MASK_OUT_ABOVE_16(res);
+         FLAG_V = VFLAG_SUB_16(*compare, dest, res);
+         FLAG_C = CFLAG_16(res);
+
+         if(COND_NE())
+            *compare = MASK_OUT_BELOW_16(*compare) | dest;
+         else
+         {
+            USE_CYCLES(3);
+            m68ki_write_16(ea, MASK_OUT_ABOVE_16(REG_D[(word2 >> 6) & 7]));
+         }
+         goto m68k_op_cas_16_al_done;
+      }
+      m68ki_exception_illegal();
+   }
+m68k_op_cas_16_al_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_cas_32_ai:
+   {
+      m68ki_resolve_flags();
+      if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+      {
+         uint word2 = OPER_I_16();
+         uint ea = EA_AY_AI_32();
+         uint dest = m68ki_read_32(ea);
+         uint* compare = &REG_D[word2 & 7];
+         uint res = dest - *compare;
+
+         m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
+         FLAG_N = NFLAG_32(res);
+         FLAG_Z = MASK_OUT_ABOVE_32(res);
+         FLAG_V = VFLAG_SUB_32(*compare, dest, res);
+         FLAG_C = CFLAG_SUB_32(*compare, dest, res);
+
+         if(COND_NE())
+            *compare = dest;
+         else
+         {
+            USE_CYCLES(3);
+            m68ki_write_32(ea, REG_D[(word2 >> 6) & 7]);
+         }
+         goto m68k_op_cas_32_ai_done;
+      }
+      m68ki_exception_illegal();
+   }
+m68k_op_cas_32_ai_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_cas_32_pi:
+   {
+      m68ki_resolve_flags();
+      if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+      {
+         uint word2 = OPER_I_16();
+         uint ea = EA_AY_PI_32();
+         uint dest = m68ki_read_32(ea);
+         uint* compare = &REG_D[word2 & 7];
+         uint res = dest - *compare;
+
+         m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
+         FLAG_N = NFLAG_32(res);
+         FLAG_Z = MASK_OUT_ABOVE_32(res);
+         FLAG_V = VFLAG_SUB_32(*compare, dest, res);
+         FLAG_C = CFLAG_SUB_32(*compare, dest, res);
+
+         if(COND_NE())
+            *compare = dest;
+         else
+         {
+            USE_CYCLES(3);
+            m68ki_write_32(ea, REG_D[(word2 >> 6) & 7]);
+         }
+         goto m68k_op_cas_32_pi_done;
+      }
+      m68ki_exception_illegal();
+   }
+m68k_op_cas_32_pi_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_cas_32_pd:
+   {
+      m68ki_resolve_flags();
+      if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+      {
+         uint word2 = OPER_I_16();
+         uint ea = EA_AY_PD_32();
+         uint dest = m68ki_read_32(ea);
+         uint* compare = &REG_D[word2 & 7];
+         uint res = dest - *compare;
+
+         m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
+         FLAG_N = NFLAG_32(res);
+         FLAG_Z = MASK_OUT_ABOVE_32(res);
+         FLAG_V = VFLAG_SUB_32(*compare, dest, res);
+         FLAG_C = CFLAG_SUB_32(*compare, dest, res);
+
+         if(COND_NE())
+            *compare = dest;
+         else
+         {
+            USE_CYCLES(3);
+            m68ki_write_32(ea, REG_D[(word2 >> 6) & 7]);
+         }
+         goto m68k_op_cas_32_pd_done;
+      }
+      m68ki_exception_illegal();
+   }
+m68k_op_cas_32_pd_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_cas_32_di:
+   {
+      m68ki_resolve_flags();
+      if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+      {
+         uint word2 = OPER_I_16();
+         uint ea = EA_AY_DI_32();
+         uint dest = m68ki_read_32(ea);
+         uint* compare = &REG_D[word2 & 7];
+         uint res = dest - *compare;
+
+         m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
+         FLAG_N = NFLAG_32(res);
+         FLAG_Z = MASK_OUT_ABOVE_32(res);
+         FLAG_V = VFLAG_SUB_32(*compare, dest, res);
+         FLAG_C = CFLAG_SUB_32(*compare, dest, res);
+
+         if(COND_NE())
+            *compare = dest;
+         else
+         {
+            USE_CYCLES(3);
+            m68ki_write_32(ea, REG_D[(word2 >> 6) & 7]);
+         }
+         goto m68k_op_cas_32_di_done;
+      }
+      m68ki_exception_illegal();
+   }
+m68k_op_cas_32_di_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_cas_32_ix:
+   {
+      m68ki_resolve_flags();
+      if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+      {
+         uint word2 = OPER_I_16();
+         uint ea = EA_AY_IX_32();
+         uint dest = m68ki_read_32(ea);
+         uint* compare = &REG_D[word2 & 7];
+         uint res = dest - *compare;
+
+         m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
+         FLAG_N = NFLAG_32(res);
+         FLAG_Z = MASK_OUT_ABOVE_32(res);
+         FLAG_V = VFLAG_SUB_32(*compare, dest, res);
+         FLAG_C = CFLAG_SUB_32(*compare, dest, res);
+
+         if(COND_NE())
+            *compare = dest;
+         else
+         {
+            USE_CYCLES(3);
+            m68ki_write_32(ea, REG_D[(word2 >> 6) & 7]);
+         }
+         goto m68k_op_cas_32_ix_done;
+      }
+      m68ki_exception_illegal();
+   }
+m68k_op_cas_32_ix_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_cas_32_aw:
+   {
+      m68ki_resolve_flags();
+      if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+      {
+         uint word2 = OPER_I_16();
+         uint ea = EA_AW_32();
+         uint dest = m68ki_read_32(ea);
+         uint* compare = &REG_D[word2 & 7];
+         uint res = dest - *compare;
+
+         m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
+         FLAG_N = NFLAG_32(res);
+         FLAG_Z = MASK_OUT_ABOVE_32(res);
+         FLAG_V = VFLAG_SUB_32(*compare, dest, res);
+         FLAG_C = CFLAG_SUB_32(*compare, dest, res);
+
+         if(COND_NE())
+            *compare = dest;
+         else
+         {
+            USE_CYCLES(3);
+            m68ki_write_32(ea, REG_D[(word2 >> 6) & 7]);
+         }
+         goto m68k_op_cas_32_aw_done;
+      }
+      m68ki_exception_illegal();
+   }
+m68k_op_cas_32_aw_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_cas_32_al:
+   {
+      m68ki_resolve_flags();
+      if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+      {
+         uint word2 = OPER_I_16();
+         uint ea = EA_AL_32();
+         uint dest = m68ki_read_32(ea);
+         uint* compare = &REG_D[word2 & 7];
+         uint res = dest - *compare;
+
+         m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
+         FLAG_N = NFLAG_32(res);
+         FLAG_Z = MASK_OUT_ABOVE_32(res);
+         FLAG_V = VFLAG_SUB_32(*compare, dest, res);
+         FLAG_C = CFLAG_SUB_32(*compare, dest, res);
+
+         if(COND_NE())
+            *compare = dest;
+         else
+         {
+            USE_CYCLES(3);
+            m68ki_write_32(ea, REG_D[(word2 >> 6) & 7]);
+         }
+         goto m68k_op_cas_32_al_done;
+      }
+      m68ki_exception_illegal();
+   }
+m68k_op_cas_32_al_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_cas2_16:
+   {
+      m68ki_resolve_flags();
+      if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+      {
+         uint word2 = OPER_I_32();
+         uint* compare1 = &REG_D[(word2 >> 16) & 7];
+         uint ea1 = REG_DA[(word2 >> 28) & 15];
+         uint dest1 = m68ki_read_16(ea1);
+         uint res1 = dest1 - MASK_OUT_ABOVE_16(*compare1);
+         uint* compare2 = &REG_D[word2 & 7];
+         uint ea2 = REG_DA[(word2 >> 12) & 15];
+         uint dest2 = m68ki_read_16(ea2);
+         uint res2;
+
+         m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
+         FLAG_N = NFLAG_16(res1);
+         FLAG_Z = MASK_OUT_ABOVE_16(res1);
+         FLAG_V = VFLAG_SUB_16(*compare1, dest1, res1);
+         FLAG_C = CFLAG_16(res1);
+
+         if(COND_EQ())
+         {
+            res2 = dest2 - MASK_OUT_ABOVE_16(*compare2);
+
+            FLAG_N = NFLAG_16(res2);
+            FLAG_Z = MASK_OUT_ABOVE_16(res2);
+            FLAG_V = VFLAG_SUB_16(*compare2, dest2, res2);
+            FLAG_C = CFLAG_16(res2);
+
+            if(COND_EQ())
+            {
+               USE_CYCLES(3);
+               m68ki_write_16(ea1, REG_D[(word2 >> 22) & 7]);
+               m68ki_write_16(ea2, REG_D[(word2 >> 6) & 7]);
+               goto m68k_op_cas2_16_done;
+            }
+         }
+         *compare1 = BIT_1F(word2) ? MAKE_INT_16(dest1) : MASK_OUT_BELOW_16(*compare1) | dest1;
+         *compare2 = BIT_F(word2) ? MAKE_INT_16(dest2) : MASK_OUT_BELOW_16(*compare2) | dest2;
+         goto m68k_op_cas2_16_done;
+      }
+      m68ki_exception_illegal();
+   }
+m68k_op_cas2_16_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_cas2_32:
+   {
+      m68ki_resolve_flags();
+      if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+      {
+         uint word2 = OPER_I_32();
+         uint* compare1 = &REG_D[(word2 >> 16) & 7];
+         uint ea1 = REG_DA[(word2 >> 28) & 15];
+         uint dest1 = m68ki_read_32(ea1);
+         uint res1 = dest1 - *compare1;
+         uint* compare2 = &REG_D[word2 & 7];
+         uint ea2 = REG_DA[(word2 >> 12) & 15];
+         uint dest2 = m68ki_read_32(ea2);
+         uint res2;
+
+         m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
+         FLAG_N = NFLAG_32(res1);
+         FLAG_Z = MASK_OUT_ABOVE_32(res1);
+         FLAG_V = VFLAG_SUB_32(*compare1, dest1, res1);
+         FLAG_C = CFLAG_SUB_32(*compare1, dest1, res1);
+
+         if(COND_EQ())
+         {
+            res2 = dest2 - *compare2;
+
+            FLAG_N = NFLAG_32(res2);
+            FLAG_Z = MASK_OUT_ABOVE_32(res2);
+            FLAG_V = VFLAG_SUB_32(*compare2, dest2, res2);
+            FLAG_C = CFLAG_SUB_32(*compare2, dest2, res2);
+
+            if(COND_EQ())
+            {
+               USE_CYCLES(3);
+               m68ki_write_32(ea1, REG_D[(word2 >> 22) & 7]);
+               m68ki_write_32(ea2, REG_D[(word2 >> 6) & 7]);
+               goto m68k_op_cas2_32_done;
+            }
+         }
+         *compare1 = dest1;
+         *compare2 = dest2;
+         goto m68k_op_cas2_32_done;
+      }
+      m68ki_exception_illegal();
+   }
+m68k_op_cas2_32_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_chk_16_d:
+   {
+      sint src = MAKE_INT_16(DX);
+      sint bound = MAKE_INT_16(DY);
+
+      m68ki_resolve_flags();
+
+      FLAG_Z = ZFLAG_16(src); /* Undocumented */
+      FLAG_V = VFLAG_CLEAR;   /* Undocumented */
+      FLAG_C = CFLAG_CLEAR;   /* Undocumented */
+
+      if(src >= 0 && src <= bound)
+      {
+         goto m68k_op_chk_16_d_done;
+      }
+      FLAG_N = (src < 0)<<7;
+      m68ki_exception_trap(EXCEPTION_CHK);
+   }
+m68k_op_chk_16_d_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_chk_16_ai:
+   {
+      sint src = MAKE_INT_16(DX);
+      sint bound = MAKE_INT_16(OPER_AY_AI_16());
+
+      m68ki_resolve_flags();
+
+      FLAG_Z = ZFLAG_16(src); /* Undocumented */
+      FLAG_V = VFLAG_CLEAR;   /* Undocumented */
+      FLAG_C = CFLAG_CLEAR;   /* Undocumented */
+
+      if(src >= 0 && src <= bound)
+      {
+         goto m68k_op_chk_16_ai_done;
+      }
+      FLAG_N = (src < 0)<<7;
+      m68ki_exception_trap(EXCEPTION_CHK);
+   }
+m68k_op_chk_16_ai_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_chk_16_pi:
+   {
+      sint src = MAKE_INT_16(DX);
+      sint bound = MAKE_INT_16(OPER_AY_PI_16());
+
+      m68ki_resolve_flags();
+
+      FLAG_Z = ZFLAG_16(src); /* Undocumented */
+      FLAG_V = VFLAG_CLEAR;   /* Undocumented */
+      FLAG_C = CFLAG_CLEAR;   /* Undocumented */
+
+      if(src >= 0 && src <= bound)
+      {
+         goto m68k_op_chk_16_pi_done;
+      }
+      FLAG_N = (src < 0)<<7;
+      m68ki_exception_trap(EXCEPTION_CHK);
+   }
+m68k_op_chk_16_pi_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_chk_16_pd:
+   {
+      sint src = MAKE_INT_16(DX);
+      sint bound = MAKE_INT_16(OPER_AY_PD_16());
+
+      m68ki_resolve_flags();
+
+      FLAG_Z = ZFLAG_16(src); /* Undocumented */
+      FLAG_V = VFLAG_CLEAR;   /* Undocumented */
+      FLAG_C = CFLAG_CLEAR;   /* Undocumented */
+
+      if(src >= 0 && src <= bound)
+      {
+         goto m68k_op_chk_16_pd_done;
+      }
+      FLAG_N = (src < 0)<<7;
+      m68ki_exception_trap(EXCEPTION_CHK);
+   }
+m68k_op_chk_16_pd_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_chk_16_di:
+   {
+      sint src = MAKE_INT_16(DX);
+      sint bound = MAKE_INT_16(OPER_AY_DI_16());
+
+      m68ki_resolve_flags();
+
+      FLAG_Z = ZFLAG_16(src); /* Undocumented */
+      FLAG_V = VFLAG_CLEAR;   /* Undocumented */
+      FLAG_C = CFLAG_CLEAR;   /* Undocumented */
+
+      if(src >= 0 && src <= bound)
+      {
+         goto m68k_op_chk_16_di_done;
+      }
+      FLAG_N = (src < 0)<<7;
+      m68ki_exception_trap(EXCEPTION_CHK);
+   }
+m68k_op_chk_16_di_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_chk_16_ix:
+   {
+      sint src = MAKE_INT_16(DX);
+      sint bound = MAKE_INT_16(OPER_AY_IX_16());
+
+      m68ki_resolve_flags();
+
+      FLAG_Z = ZFLAG_16(src); /* Undocumented */
+      FLAG_V = VFLAG_CLEAR;   /* Undocumented */
+      FLAG_C = CFLAG_CLEAR;   /* Undocumented */
+
+      if(src >= 0 && src <= bound)
+      {
+         goto m68k_op_chk_16_ix_done;
+      }
+      FLAG_N = (src < 0)<<7;
+      m68ki_exception_trap(EXCEPTION_CHK);
+   }
+m68k_op_chk_16_ix_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_chk_16_aw:
+   {
+      sint src = MAKE_INT_16(DX);
+      sint bound = MAKE_INT_16(OPER_AW_16());
+
+      m68ki_resolve_flags();
+
+      FLAG_Z = ZFLAG_16(src); /* Undocumented */
+      FLAG_V = VFLAG_CLEAR;   /* Undocumented */
+      FLAG_C = CFLAG_CLEAR;   /* Undocumented */
+
+      if(src >= 0 && src <= bound)
+      {
+         goto m68k_op_chk_16_aw_done;
+      }
+      FLAG_N = (src < 0)<<7;
+      m68ki_exception_trap(EXCEPTION_CHK);
+   }
+m68k_op_chk_16_aw_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_chk_16_al:
+   {
+      sint src = MAKE_INT_16(DX);
+      sint bound = MAKE_INT_16(OPER_AL_16());
+
+      m68ki_resolve_flags();
+
+      FLAG_Z = ZFLAG_16(src); /* Undocumented */
+      FLAG_V = VFLAG_CLEAR;   /* Undocumented */
+      FLAG_C = CFLAG_CLEAR;   /* Undocumented */
+
+      if(src >= 0 && src <= bound)
+      {
+         goto m68k_op_chk_16_al_done;
+      }
+      FLAG_N = (src < 0)<<7;
+      m68ki_exception_trap(EXCEPTION_CHK);
+   }
+m68k_op_chk_16_al_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_chk_16_pcdi:
+   {
+      sint src = MAKE_INT_16(DX);
+      sint bound = MAKE_INT_16(OPER_PCDI_16());
+
+      m68ki_resolve_flags();
+
+      FLAG_Z = ZFLAG_16(src); /* Undocumented */
+      FLAG_V = VFLAG_CLEAR;   /* Undocumented */
+      FLAG_C = CFLAG_CLEAR;   /* Undocumented */
+
+      if(src >= 0 && src <= bound)
+      {
+         goto m68k_op_chk_16_pcdi_done;
+      }
+      FLAG_N = (src < 0)<<7;
+      m68ki_exception_trap(EXCEPTION_CHK);
+   }
+m68k_op_chk_16_pcdi_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_chk_16_pcix:
+   {
+      sint src = MAKE_INT_16(DX);
+      sint bound = MAKE_INT_16(OPER_PCIX_16());
+
+      m68ki_resolve_flags();
+
+      FLAG_Z = ZFLAG_16(src); /* Undocumented */
+      FLAG_V = VFLAG_CLEAR;   /* Undocumented */
+      FLAG_C = CFLAG_CLEAR;   /* Undocumented */
+
+      if(src >= 0 && src <= bound)
+      {
+         goto m68k_op_chk_16_pcix_done;
+      }
+      FLAG_N = (src < 0)<<7;
+      m68ki_exception_trap(EXCEPTION_CHK);
+   }
+m68k_op_chk_16_pcix_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_chk_16_i:
+   {
+      sint src = MAKE_INT_16(DX);
+      sint bound = MAKE_INT_16(OPER_I_16());
+
+      m68ki_resolve_flags();
+
+      FLAG_Z = ZFLAG_16(src); /* Undocumented */
+      FLAG_V = VFLAG_CLEAR;   /* Undocumented */
+      FLAG_C = CFLAG_CLEAR;   /* Undocumented */
+
+      if(src >= 0 && src <= bound)
+      {
+         goto m68k_op_chk_16_i_done;
+      }
+      FLAG_N = (src < 0)<<7;
+      m68ki_exception_trap(EXCEPTION_CHK);
+   }
+m68k_op_chk_16_i_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_chk_32_d:
+   {
+      m68ki_resolve_flags();
+      if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+      {
+         sint src = MAKE_INT_32(DX);
+         sint bound = MAKE_INT_32(DY);
+
+         FLAG_Z = ZFLAG_32(src); /* Undocumented */
+         FLAG_V = VFLAG_CLEAR;   /* Undocumented */
+         FLAG_C = CFLAG_CLEAR;   /* Undocumented */
+
+         if(src >= 0 && src <= bound)
+         {
+            goto m68k_op_chk_32_d_done;
+         }
+         FLAG_N = (src < 0)<<7;
+         m68ki_exception_trap(EXCEPTION_CHK);
+         goto m68k_op_chk_32_d_done;
+      }
+      m68ki_exception_illegal();
+   }
+m68k_op_chk_32_d_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_chk_32_ai:
+   {
+      m68ki_resolve_flags();
+      if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+      {
+         sint src = MAKE_INT_32(DX);
+         sint bound = MAKE_INT_32(OPER_AY_AI_32());
+
+         FLAG_Z = ZFLAG_32(src); /* Undocumented */
+         FLAG_V = VFLAG_CLEAR;   /* Undocumented */
+         FLAG_C = CFLAG_CLEAR;   /* Undocumented */
+
+         if(src >= 0 && src <= bound)
+         {
+            goto m68k_op_chk_32_ai_done;
+         }
+         FLAG_N = (src < 0)<<7;
+         m68ki_exception_trap(EXCEPTION_CHK);
+         goto m68k_op_chk_32_ai_done;
+      }
+      m68ki_exception_illegal();
+   }
+m68k_op_chk_32_ai_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_chk_32_pi:
+   {
+      m68ki_resolve_flags();
+      if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+      {
+         sint src = MAKE_INT_32(DX);
+         sint bound = MAKE_INT_32(OPER_AY_PI_32());
+
+         FLAG_Z = ZFLAG_32(src); /* Undocumented */
+         FLAG_V = VFLAG_CLEAR;   /* Undocumented */
+         FLAG_C = CFLAG_CLEAR;   /* Undocumented */
+
+         if(src >= 0 && src <= bound)
+         {
+            goto m68k_op_chk_32_pi_done;
+         }
+         FLAG_N = (src < 0)<<7;
+         m68ki_exception_trap(EXCEPTION_CHK);
+         goto m68k_op_chk_32_pi_done;
+      }
+      m68ki_exception_illegal();
+   }
+m68k_op_chk_32_pi_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_chk_32_pd:
+   {
+      m68ki_resolve_flags();
+      if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+      {
+         sint src = MAKE_INT_32(DX);
+         sint bound = MAKE_INT_32(OPER_AY_PD_32());
+
+         FLAG_Z = ZFLAG_32(src); /* Undocumented */
+         FLAG_V = VFLAG_CLEAR;   /* Undocumented */
+         FLAG_C = CFLAG_CLEAR;   /* Undocumented */
+
+         if(src >= 0 && src <= bound)
+         {
+            goto m68k_op_chk_32_pd_done;
+         }
+         FLAG_N = (src < 0)<<7;
+         m68ki_exception_trap(EXCEPTION_CHK);
+         goto m68k_op_chk_32_pd_done;
+      }
+      m68ki_exception_illegal();
+   }
+m68k_op_chk_32_pd_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_chk_32_di:
+   {
+      m68ki_resolve_flags();
+      if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+      {
+         sint src = MAKE_INT_32(DX);
+         sint bound = MAKE_INT_32(OPER_AY_DI_32());
+
+         FLAG_Z = ZFLAG_32(src); /* Undocumented */
+         FLAG_V = VFLAG_CLEAR;   /* Undocumented */
+         FLAG_C = CFLAG_CLEAR;   /* Undocumented */
+
+         if(src >= 0 && src <= bound)
+         {
+            goto m68k_op_chk_32_di_done;
+         }
+         FLAG_N = (src < 0)<<7;
+         m68ki_exception_trap(EXCEPTION_CHK);
+         goto m68k_op_chk_32_di_done;
+      }
+      m68ki_exception_illegal();
+   }
+m68k_op_chk_32_di_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_chk_32_ix:
+   {
+      m68ki_resolve_flags();
+      if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+      {
+         sint src = MAKE_INT_32(DX);
+         sint bound = MAKE_INT_32(OPER_AY_IX_32());
+
+         FLAG_Z = ZFLAG_32(src); /* Undocumented */
+         FLAG_V = VFLAG_CLEAR;   /* Undocumented */
+         FLAG_C = CFLAG_CLEAR;   /* Undocumented */
+
+         if(src >= 0 && src <= bound)
+         {
+            goto m68k_op_chk_32_ix_done;
+         }
+         FLAG_N = (src < 0)<<7;
+         m68ki_exception_trap(EXCEPTION_CHK);
+         goto m68k_op_chk_32_ix_done;
+      }
+      m68ki_exception_illegal();
+   }
+m68k_op_chk_32_ix_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_chk_32_aw:
+   {
+      m68ki_resolve_flags();
+      if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+      {
+         sint src = MAKE_INT_32(DX);
+         sint bound = MAKE_INT_32(OPER_AW_32());
+
+         FLAG_Z = ZFLAG_32(src); /* Undocumented */
+         FLAG_V = VFLAG_CLEAR;   /* Undocumented */
+         FLAG_C = CFLAG_CLEAR;   /* Undocumented */
+
+         if(src >= 0 && src <= bound)
+         {
+            goto m68k_op_chk_32_aw_done;
+         }
+         FLAG_N = (src < 0)<<7;
+         m68ki_exception_trap(EXCEPTION_CHK);
+         goto m68k_op_chk_32_aw_done;
+      }
+      m68ki_exception_illegal();
+   }
+m68k_op_chk_32_aw_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_chk_32_al:
+   {
+      m68ki_resolve_flags();
+      if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+      {
+         sint src = MAKE_INT_32(DX);
+         sint bound = MAKE_INT_32(OPER_AL_32());
+
+         FLAG_Z = ZFLAG_32(src); /* Undocumented */
+         FLAG_V = VFLAG_CLEAR;   /* Undocumented */
+         FLAG_C = CFLAG_CLEAR;   /* Undocumented */
+
+         if(src >= 0 && src <= bound)
+         {
+            goto m68k_op_chk_32_al_done;
+         }
+         FLAG_N = (src < 0)<<7;
+         m68ki_exception_trap(EXCEPTION_CHK);
+         goto m68k_op_chk_32_al_done;
+      }
+      m68ki_exception_illegal();
+   }
+m68k_op_chk_32_al_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_chk_32_pcdi:
+   {
+      m68ki_resolve_flags();
+      if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+      {
+         sint src = MAKE_INT_32(DX);
+         sint bound = MAKE_INT_32(OPER_PCDI_32());
+
+         FLAG_Z = ZFLAG_32(src); /* Undocumented */
+         FLAG_V = VFLAG_CLEAR;   /* Undocumented */
+         FLAG_C = CFLAG_CLEAR;   /* Undocumented */
+
+         if(src >= 0 && src <= bound)
+         {
+            goto m68k_op_chk_32_pcdi_done;
+         }
+         FLAG_N = (src < 0)<<7;
+         m68ki_exception_trap(EXCEPTION_CHK);
+         goto m68k_op_chk_32_pcdi_done;
+      }
+      m68ki_exception_illegal();
+   }
+m68k_op_chk_32_pcdi_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_chk_32_pcix:
+   {
+      m68ki_resolve_flags();
+      if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+      {
+         sint src = MAKE_INT_32(DX);
+         sint bound = MAKE_INT_32(OPER_PCIX_32());
+
+         FLAG_Z = ZFLAG_32(src); /* Undocumented */
+         FLAG_V = VFLAG_CLEAR;   /* Undocumented */
+         FLAG_C = CFLAG_CLEAR;   /* Undocumented */
+
+         if(src >= 0 && src <= bound)
+         {
+            goto m68k_op_chk_32_pcix_done;
+         }
+         FLAG_N = (src < 0)<<7;
+         m68ki_exception_trap(EXCEPTION_CHK);
+         goto m68k_op_chk_32_pcix_done;
+      }
+      m68ki_exception_illegal();
+   }
+m68k_op_chk_32_pcix_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_chk_32_i:
+   {
+      m68ki_resolve_flags();
+      if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+      {
+         sint src = MAKE_INT_32(DX);
+         sint bound = MAKE_INT_32(OPER_I_32());
+
+         FLAG_Z = ZFLAG_32(src); /* Undocumented */
+         FLAG_V = VFLAG_CLEAR;   /* Undocumented */
+         FLAG_C = CFLAG_CLEAR;   /* Undocumented */
+
+         if(src >= 0 && src <= bound)
+         {
+            goto m68k_op_chk_32_i_done;
+         }
+         FLAG_N = (src < 0)<<7;
+         m68ki_exception_trap(EXCEPTION_CHK);
+         goto m68k_op_chk_32_i_done;
+      }
+      m68ki_exception_illegal();
+   }
+m68k_op_chk_32_i_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_chk2cmp2_8_pcdi:
+   {
+      m68ki_resolve_flags();
+      if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+      {
+         uint word2 = OPER_I_16();
+         uint compare = REG_DA[(word2 >> 12) & 15]&0xff;
+         uint ea = EA_PCDI_8();
+         uint lower_bound = m68ki_read_pcrel_8(ea);
+         uint upper_bound = m68ki_read_pcrel_8(ea + 1);
+
+         if(!BIT_F(word2))
+            FLAG_C = MAKE_INT_8(compare) - MAKE_INT_8(lower_bound);
+         else
+            FLAG_C = compare - lower_bound;
+         FLAG_Z = !((upper_bound==compare) | (lower_bound==compare));
+         if(COND_CS())
+         {
+            if(BIT_B(word2))
+               m68ki_exception_trap(EXCEPTION_CHK);
+            goto m68k_op_chk2cmp2_8_pcdi_done;
+         }
+
+         FLAG_C = upper_bound - compare;
+         if(COND_CS() && BIT_B(word2))
+               m68ki_exception_trap(EXCEPTION_CHK);
+         goto m68k_op_chk2cmp2_8_pcdi_done;
+      }
+      m68ki_exception_illegal();
+   }
+m68k_op_chk2cmp2_8_pcdi_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_chk2cmp2_8_pcix:
+   {
+      m68ki_resolve_flags();
+      if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+      {
+         uint word2 = OPER_I_16();
+         uint compare = REG_DA[(word2 >> 12) & 15]&0xff;
+         uint ea = EA_PCIX_8();
+         uint lower_bound = m68ki_read_pcrel_8(ea);
+         uint upper_bound = m68ki_read_pcrel_8(ea + 1);
+
+         if(!BIT_F(word2))
+            FLAG_C = MAKE_INT_8(compare) - MAKE_INT_8(lower_bound);
+         else
+            FLAG_C = compare - lower_bound;
+         FLAG_Z = !((upper_bound==compare) | (lower_bound==compare));
+         if(COND_CS())
+         {
+            if(BIT_B(word2))
+               m68ki_exception_trap(EXCEPTION_CHK);
+            goto m68k_op_chk2cmp2_8_pcix_done;
+         }
+
+         FLAG_C = upper_bound - compare;
+         if(COND_CS() && BIT_B(word2))
+               m68ki_exception_trap(EXCEPTION_CHK);
+         goto m68k_op_chk2cmp2_8_pcix_done;
+      }
+      m68ki_exception_illegal();
+   }
+m68k_op_chk2cmp2_8_pcix_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_chk2cmp2_8_ai:
+   {
+      m68ki_resolve_flags();
+      if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+      {
+         uint word2 = OPER_I_16();
+         uint compare = REG_DA[(word2 >> 12) & 15]&0xff;
+         uint ea = EA_AY_AI_8();
+         uint lower_bound = m68ki_read_8(ea);
+         uint upper_bound = m68ki_read_8(ea + 1);
+
+         if(!BIT_F(word2))
+            FLAG_C = MAKE_INT_8(compare) - MAKE_INT_8(lower_bound);
+         else
+            FLAG_C = compare - lower_bound;
+         FLAG_Z = !((upper_bound==compare) | (lower_bound==compare));
+         if(COND_CS())
+         {
+            if(BIT_B(word2))
+               m68ki_exception_trap(EXCEPTION_CHK);
+            goto m68k_op_chk2cmp2_8_ai_done;
+         }
+
+         FLAG_C = upper_bound - compare;
+         if(COND_CS() && BIT_B(word2))
+               m68ki_exception_trap(EXCEPTION_CHK);
+         goto m68k_op_chk2cmp2_8_ai_done;
+      }
+      m68ki_exception_illegal();
+   }
+m68k_op_chk2cmp2_8_ai_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_chk2cmp2_8_di:
+   {
+      m68ki_resolve_flags();
+      if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+      {
+         uint word2 = OPER_I_16();
+         uint compare = REG_DA[(word2 >> 12) & 15]&0xff;
+         uint ea = EA_AY_DI_8();
+         uint lower_bound = m68ki_read_8(ea);
+         uint upper_bound = m68ki_read_8(ea + 1);
+
+         if(!BIT_F(word2))
+            FLAG_C = MAKE_INT_8(compare) - MAKE_INT_8(lower_bound);
+         else
+            FLAG_C = compare - lower_bound;
+         FLAG_Z = !((upper_bound==compare) | (lower_bound==compare));
+         if(COND_CS())
+         {
+            if(BIT_B(word2))
+               m68ki_exception_trap(EXCEPTION_CHK);
+            goto m68k_op_chk2cmp2_8_di_done;
+         }
+
+         FLAG_C = upper_bound - compare;
+         if(COND_CS() && BIT_B(word2))
+               m68ki_exception_trap(EXCEPTION_CHK);
+         goto m68k_op_chk2cmp2_8_di_done;
+      }
+      m68ki_exception_illegal();
+   }
+m68k_op_chk2cmp2_8_di_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_chk2cmp2_8_ix:
+   {
+      m68ki_resolve_flags();
+      if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+      {
+         uint word2 = OPER_I_16();
+         uint compare = REG_DA[(word2 >> 12) & 15]&0xff;
+         uint ea = EA_AY_IX_8();
+         uint lower_bound = m68ki_read_8(ea);
+         uint upper_bound = m68ki_read_8(ea + 1);
+
+         if(!BIT_F(word2))
+            FLAG_C = MAKE_INT_8(compare) - MAKE_INT_8(lower_bound);
+         else
+            FLAG_C = compare - lower_bound;
+         FLAG_Z = !((upper_bound==compare) | (lower_bound==compare));
+         if(COND_CS())
+         {
+            if(BIT_B(word2))
+               m68ki_exception_trap(EXCEPTION_CHK);
+            goto m68k_op_chk2cmp2_8_ix_done;
+         }
+
+         FLAG_C = upper_bound - compare;
+         if(COND_CS() && BIT_B(word2))
+               m68ki_exception_trap(EXCEPTION_CHK);
+         goto m68k_op_chk2cmp2_8_ix_done;
+      }
+      m68ki_exception_illegal();
+   }
+m68k_op_chk2cmp2_8_ix_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_chk2cmp2_8_aw:
+   {
+      m68ki_resolve_flags();
+      if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+      {
+         uint word2 = OPER_I_16();
+         uint compare = REG_DA[(word2 >> 12) & 15]&0xff;
+         uint ea = EA_AW_8();
+         uint lower_bound = m68ki_read_8(ea);
+         uint upper_bound = m68ki_read_8(ea + 1);
+
+         if(!BIT_F(word2))
+            FLAG_C = MAKE_INT_8(compare) - MAKE_INT_8(lower_bound);
+         else
+            FLAG_C = compare - lower_bound;
+         FLAG_Z = !((upper_bound==compare) | (lower_bound==compare));
+         if(COND_CS())
+         {
+            if(BIT_B(word2))
+               m68ki_exception_trap(EXCEPTION_CHK);
+            goto m68k_op_chk2cmp2_8_aw_done;
+         }
+
+         FLAG_C = upper_bound - compare;
+         if(COND_CS() && BIT_B(word2))
+               m68ki_exception_trap(EXCEPTION_CHK);
+         goto m68k_op_chk2cmp2_8_aw_done;
+      }
+      m68ki_exception_illegal();
+   }
+m68k_op_chk2cmp2_8_aw_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_chk2cmp2_8_al:
+   {
+      m68ki_resolve_flags();
+      if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+      {
+         uint word2 = OPER_I_16();
+         uint compare = REG_DA[(word2 >> 12) & 15]&0xff;
+         uint ea = EA_AL_8();
+         uint lower_bound = m68ki_read_8(ea);
+         uint upper_bound = m68ki_read_8(ea + 1);
+
+         if(!BIT_F(word2))
+            FLAG_C = MAKE_INT_8(compare) - MAKE_INT_8(lower_bound);
+         else
+            FLAG_C = compare - lower_bound;
+         FLAG_Z = !((upper_bound==compare) | (lower_bound==compare));
+         if(COND_CS())
+         {
+            if(BIT_B(word2))
+               m68ki_exception_trap(EXCEPTION_CHK);
+            goto m68k_op_chk2cmp2_8_al_done;
+         }
+
+         FLAG_C = upper_bound - compare;
+         if(COND_CS() && BIT_B(word2))
+               m68ki_exception_trap(EXCEPTION_CHK);
+         goto m68k_op_chk2cmp2_8_al_done;
+      }
+      m68ki_exception_illegal();
+   }
+m68k_op_chk2cmp2_8_al_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_chk2cmp2_16_pcdi:
+   {
+      m68ki_resolve_flags();
+      if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+      {
+         uint word2 = OPER_I_16();
+         uint compare = REG_DA[(word2 >> 12) & 15]&0xffff;
+         uint ea = EA_PCDI_16();
+         uint lower_bound = m68ki_read_pcrel_16(ea);
+         uint upper_bound = m68ki_read_pcrel_16(ea + 2);
+
+         if(!BIT_F(word2))
+            FLAG_C = MAKE_INT_16(compare) - MAKE_INT_16(lower_bound);
+         else
+            FLAG_C = compare - lower_bound;
+         FLAG_Z = !((upper_bound==compare) | (lower_bound==compare));
+         FLAG_C = CFLAG_16(FLAG_C);
+         if(COND_CS())
+         {
+            if(BIT_B(word2))
+               m68ki_exception_trap(EXCEPTION_CHK);
+            goto m68k_op_chk2cmp2_16_pcdi_done;
+         }
+
+         if(!BIT_F(word2))
+            FLAG_C = MAKE_INT_16(upper_bound) - MAKE_INT_16(compare);
+         else
+            FLAG_C = upper_bound - compare;
+         FLAG_C = CFLAG_16(FLAG_C);
+         if(COND_CS() && BIT_B(word2))
+               m68ki_exception_trap(EXCEPTION_CHK);
+         goto m68k_op_chk2cmp2_16_pcdi_done;
+      }
+      m68ki_exception_illegal();
+   }
+m68k_op_chk2cmp2_16_pcdi_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_chk2cmp2_16_pcix:
+   {
+      m68ki_resolve_flags();
+      if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+      {
+         uint word2 = OPER_I_16();
+         uint compare = REG_DA[(word2 >> 12) & 15]&0xffff;
+         uint ea = EA_PCIX_16();
+         uint lower_bound = m68ki_read_pcrel_16(ea);
+         uint upper_bound = m68ki_read_pcrel_16(ea + 2);
+
+         if(!BIT_F(word2))
+            FLAG_C = MAKE_INT_16(compare) - MAKE_INT_16(lower_bound);
+         else
+            FLAG_C = compare - lower_bound;
+         FLAG_Z = !((upper_bound==compare) | (lower_bound==compare));
+         FLAG_C = CFLAG_16(FLAG_C);
+         if(COND_CS())
+         {
+            if(BIT_B(word2))
+               m68ki_exception_trap(EXCEPTION_CHK);
+            goto m68k_op_chk2cmp2_16_pcix_done;
+         }
+
+         if(!BIT_F(word2))
+            FLAG_C = MAKE_INT_16(upper_bound) - MAKE_INT_16(compare);
+         else
+            FLAG_C = upper_bound - compare;
+         FLAG_C = CFLAG_16(FLAG_C);
+         if(COND_CS() && BIT_B(word2))
+               m68ki_exception_trap(EXCEPTION_CHK);
+         goto m68k_op_chk2cmp2_16_pcix_done;
+      }
+      m68ki_exception_illegal();
+   }
+m68k_op_chk2cmp2_16_pcix_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_chk2cmp2_16_ai:
+   {
+      m68ki_resolve_flags();
+      if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+      {
+         uint word2 = OPER_I_16();
+         uint compare = REG_DA[(word2 >> 12) & 15]&0xffff;
+         uint ea = EA_AY_AI_16();
+         uint lower_bound = m68ki_read_16(ea);
+         uint upper_bound = m68ki_read_16(ea + 2);
+
+         if(!BIT_F(word2))
+            FLAG_C = MAKE_INT_16(compare) - MAKE_INT_16(lower_bound);
+         else
+            FLAG_C = compare - lower_bound;
+
+         FLAG_Z = !((upper_bound==compare) | (lower_bound==compare));
+         FLAG_C = CFLAG_16(FLAG_C);
+         if(COND_CS())
+         {
+            if(BIT_B(word2))
+               m68ki_exception_trap(EXCEPTION_CHK);
+            goto m68k_op_chk2cmp2_16_ai_done;
+         }
+         if(!BIT_F(word2))
+            FLAG_C = MAKE_INT_16(upper_bound) - MAKE_INT_16(compare);
+         else
+            FLAG_C = upper_bound - compare;
+
+         FLAG_C = CFLAG_16(FLAG_C);
+         if(COND_CS() && BIT_B(word2))
+               m68ki_exception_trap(EXCEPTION_CHK);
+         goto m68k_op_chk2cmp2_16_ai_done;
+      }
+      m68ki_exception_illegal();
+   }
+m68k_op_chk2cmp2_16_ai_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_chk2cmp2_16_di:
+   {
+      m68ki_resolve_flags();
+      if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+      {
+         uint word2 = OPER_I_16();
+         uint compare = REG_DA[(word2 >> 12) & 15]&0xffff;
+         uint ea = EA_AY_DI_16();
+         uint lower_bound = m68ki_read_16(ea);
+         uint upper_bound = m68ki_read_16(ea + 2);
+
+         if(!BIT_F(word2))
+            FLAG_C = MAKE_INT_16(compare) - MAKE_INT_16(lower_bound);
+         else
+            FLAG_C = compare - lower_bound;
+
+         FLAG_Z = !((upper_bound==compare) | (lower_bound==compare));
+         FLAG_C = CFLAG_16(FLAG_C);
+         if(COND_CS())
+         {
+            if(BIT_B(word2))
+               m68ki_exception_trap(EXCEPTION_CHK);
+            goto m68k_op_chk2cmp2_16_di_done;
+         }
+         if(!BIT_F(word2))
+            FLAG_C = MAKE_INT_16(upper_bound) - MAKE_INT_16(compare);
+         else
+            FLAG_C = upper_bound - compare;
+
+         FLAG_C = CFLAG_16(FLAG_C);
+         if(COND_CS() && BIT_B(word2))
+               m68ki_exception_trap(EXCEPTION_CHK);
+         goto m68k_op_chk2cmp2_16_di_done;
+      }
+      m68ki_exception_illegal();
+   }
+m68k_op_chk2cmp2_16_di_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_chk2cmp2_16_ix:
+   {
+      m68ki_resolve_flags();
+      if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+      {
+         uint word2 = OPER_I_16();
+         uint compare = REG_DA[(word2 >> 12) & 15]&0xffff;
+         uint ea = EA_AY_IX_16();
+         uint lower_bound = m68ki_read_16(ea);
+         uint upper_bound = m68ki_read_16(ea + 2);
+
+         if(!BIT_F(word2))
+            FLAG_C = MAKE_INT_16(compare) - MAKE_INT_16(lower_bound);
+         else
+            FLAG_C = compare - lower_bound;
+
+         FLAG_Z = !((upper_bound==compare) | (lower_bound==compare));
+         FLAG_C = CFLAG_16(FLAG_C);
+         if(COND_CS())
+         {
+            if(BIT_B(word2))
+               m68ki_exception_trap(EXCEPTION_CHK);
+            goto m68k_op_chk2cmp2_16_ix_done;
+         }
+         if(!BIT_F(word2))
+            FLAG_C = MAKE_INT_16(upper_bound) - MAKE_INT_16(compare);
+         else
+            FLAG_C = upper_bound - compare;
+
+         FLAG_C = CFLAG_16(FLAG_C);
+         if(COND_CS() && BIT_B(word2))
+               m68ki_exception_trap(EXCEPTION_CHK);
+         goto m68k_op_chk2cmp2_16_ix_done;
+      }
+      m68ki_exception_illegal();
+   }
+m68k_op_chk2cmp2_16_ix_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_chk2cmp2_16_aw:
+   {
+      m68ki_resolve_flags();
+      if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+      {
+         uint word2 = OPER_I_16();
+         uint compare = REG_DA[(word2 >> 12) & 15]&0xffff;
+         uint ea = EA_AW_16();
+         uint lower_bound = m68ki_read_16(ea);
+         uint upper_bound = m68ki_read_16(ea + 2);
+
+         if(!BIT_F(word2))
+            FLAG_C = MAKE_INT_16(compare) - MAKE_INT_16(lower_bound);
+         else
+            FLAG_C = compare - lower_bound;
+
+         FLAG_Z = !((upper_bound==compare) | (lower_bound==compare));
+         FLAG_C = CFLAG_16(FLAG_C);
+         if(COND_CS())
+         {
+            if(BIT_B(word2))
+               m68ki_exception_trap(EXCEPTION_CHK);
+            goto m68k_op_chk2cmp2_16_aw_done;
+         }
+         if(!BIT_F(word2))
+            FLAG_C = MAKE_INT_16(upper_bound) - MAKE_INT_16(compare);
+         else
+            FLAG_C = upper_bound - compare;
+
+         FLAG_C = CFLAG_16(FLAG_C);
+         if(COND_CS() && BIT_B(word2))
+               m68ki_exception_trap(EXCEPTION_CHK);
+         goto m68k_op_chk2cmp2_16_aw_done;
+      }
+      m68ki_exception_illegal();
+   }
+m68k_op_chk2cmp2_16_aw_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_chk2cmp2_16_al:
+   {
+      m68ki_resolve_flags();
+      if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+      {
+         uint word2 = OPER_I_16();
+         uint compare = REG_DA[(word2 >> 12) & 15]&0xffff;
+         uint ea = EA_AL_16();
+         uint lower_bound = m68ki_read_16(ea);
+         uint upper_bound = m68ki_read_16(ea + 2);
+
+         if(!BIT_F(word2))
+            FLAG_C = MAKE_INT_16(compare) - MAKE_INT_16(lower_bound);
+         else
+            FLAG_C = compare - lower_bound;
+
+         FLAG_Z = !((upper_bound==compare) | (lower_bound==compare));
+         FLAG_C = CFLAG_16(FLAG_C);
+         if(COND_CS())
+         {
+            if(BIT_B(word2))
+               m68ki_exception_trap(EXCEPTION_CHK);
+            goto m68k_op_chk2cmp2_16_al_done;
+         }
+         if(!BIT_F(word2))
+            FLAG_C = MAKE_INT_16(upper_bound) - MAKE_INT_16(compare);
+         else
+            FLAG_C = upper_bound - compare;
+
+         FLAG_C = CFLAG_16(FLAG_C);
+         if(COND_CS() && BIT_B(word2))
+               m68ki_exception_trap(EXCEPTION_CHK);
+         goto m68k_op_chk2cmp2_16_al_done;
+      }
+      m68ki_exception_illegal();
+   }
+m68k_op_chk2cmp2_16_al_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_chk2cmp2_32_pcdi:
+   {
+      m68ki_resolve_flags();
+      if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+      {
+         uint word2 = OPER_I_16();
+         uint compare = REG_DA[(word2 >> 12) & 15];
+         uint ea = EA_PCDI_32();
+         uint lower_bound = m68ki_read_pcrel_32(ea);
+         uint upper_bound = m68ki_read_pcrel_32(ea + 4);
+
+         FLAG_C = compare - lower_bound;
+         FLAG_Z = !((upper_bound==compare) | (lower_bound==compare));
+         FLAG_C = CFLAG_SUB_32(lower_bound, compare, FLAG_C);
+         if(COND_CS())
+         {
+            if(BIT_B(word2))
+               m68ki_exception_trap(EXCEPTION_CHK);
+            goto m68k_op_chk2cmp2_32_pcdi_done;
+         }
+
+         FLAG_C = upper_bound - compare;
+         FLAG_C = CFLAG_SUB_32(compare, upper_bound, FLAG_C);
+         if(COND_CS() && BIT_B(word2))
+               m68ki_exception_trap(EXCEPTION_CHK);
+         goto m68k_op_chk2cmp2_32_pcdi_done;
+      }
+      m68ki_exception_illegal();
+   }
+m68k_op_chk2cmp2_32_pcdi_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_chk2cmp2_32_pcix:
+   {
+      m68ki_resolve_flags();
+      if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+      {
+         uint word2 = OPER_I_16();
+         uint compare = REG_DA[(word2 >> 12) & 15];
+         uint ea = EA_PCIX_32();
+         uint lower_bound = m68ki_read_pcrel_32(ea);
+         uint upper_bound = m68ki_read_pcrel_32(ea + 4);
+
+         FLAG_C = compare - lower_bound;
+         FLAG_Z = !((upper_bound==compare) | (lower_bound==compare));
+         FLAG_C = CFLAG_SUB_32(lower_bound, compare, FLAG_C);
+         if(COND_CS())
+         {
+            if(BIT_B(word2))
+               m68ki_exception_trap(EXCEPTION_CHK);
+            goto m68k_op_chk2cmp2_32_pcix_done;
+         }
+
+         FLAG_C = upper_bound - compare;
+         FLAG_C = CFLAG_SUB_32(compare, upper_bound, FLAG_C);
+         if(COND_CS() && BIT_B(word2))
+               m68ki_exception_trap(EXCEPTION_CHK);
+         goto m68k_op_chk2cmp2_32_pcix_done;
+      }
+      m68ki_exception_illegal();
+   }
+m68k_op_chk2cmp2_32_pcix_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_chk2cmp2_32_ai:
+   {
+      m68ki_resolve_flags();
+      if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+      {
+         uint word2 = OPER_I_16();
+         uint compare = REG_DA[(word2 >> 12) & 15];
+         uint ea = EA_AY_AI_32();
+         uint lower_bound = m68ki_read_32(ea);
+         uint upper_bound = m68ki_read_32(ea + 4);
+
+         FLAG_C = compare - lower_bound;
+         FLAG_Z = !((upper_bound==compare) | (lower_bound==compare));
+         FLAG_C = CFLAG_SUB_32(lower_bound, compare, FLAG_C);
+         if(COND_CS())
+         {
+            if(BIT_B(word2))
+               m68ki_exception_trap(EXCEPTION_CHK);
+            goto m68k_op_chk2cmp2_32_ai_done;
+         }
+
+         FLAG_C = upper_bound - compare;
+         FLAG_C = CFLAG_SUB_32(compare, upper_bound, FLAG_C);
+         if(COND_CS() && BIT_B(word2))
+               m68ki_exception_trap(EXCEPTION_CHK);
+         goto m68k_op_chk2cmp2_32_ai_done;
+      }
+      m68ki_exception_illegal();
+   }
+m68k_op_chk2cmp2_32_ai_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_chk2cmp2_32_di:
+   {
+      m68ki_resolve_flags();
+      if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+      {
+         uint word2 = OPER_I_16();
+         uint compare = REG_DA[(word2 >> 12) & 15];
+         uint ea = EA_AY_DI_32();
+         uint lower_bound = m68ki_read_32(ea);
+         uint upper_bound = m68ki_read_32(ea + 4);
+
+         FLAG_C = compare - lower_bound;
+         FLAG_Z = !((upper_bound==compare) | (lower_bound==compare));
+         FLAG_C = CFLAG_SUB_32(lower_bound, compare, FLAG_C);
+         if(COND_CS())
+         {
+            if(BIT_B(word2))
+               m68ki_exception_trap(EXCEPTION_CHK);
+            goto m68k_op_chk2cmp2_32_di_done;
+         }
+
+         FLAG_C = upper_bound - compare;
+         FLAG_C = CFLAG_SUB_32(compare, upper_bound, FLAG_C);
+         if(COND_CS() && BIT_B(word2))
+               m68ki_exception_trap(EXCEPTION_CHK);
+         goto m68k_op_chk2cmp2_32_di_done;
+      }
+      m68ki_exception_illegal();
+   }
+m68k_op_chk2cmp2_32_di_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_chk2cmp2_32_ix:
+   {
+      m68ki_resolve_flags();
+      if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+      {
+         uint word2 = OPER_I_16();
+         uint compare = REG_DA[(word2 >> 12) & 15];
+         uint ea = EA_AY_IX_32();
+         uint lower_bound = m68ki_read_32(ea);
+         uint upper_bound = m68ki_read_32(ea + 4);
+
+         FLAG_C = compare - lower_bound;
+         FLAG_Z = !((upper_bound==compare) | (lower_bound==compare));
+         FLAG_C = CFLAG_SUB_32(lower_bound, compare, FLAG_C);
+         if(COND_CS())
+         {
+            if(BIT_B(word2))
+               m68ki_exception_trap(EXCEPTION_CHK);
+            goto m68k_op_chk2cmp2_32_ix_done;
+         }
+
+         FLAG_C = upper_bound - compare;
+         FLAG_C = CFLAG_SUB_32(compare, upper_bound, FLAG_C);
+         if(COND_CS() && BIT_B(word2))
+               m68ki_exception_trap(EXCEPTION_CHK);
+         goto m68k_op_chk2cmp2_32_ix_done;
+      }
+      m68ki_exception_illegal();
+   }
+m68k_op_chk2cmp2_32_ix_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_chk2cmp2_32_aw:
+   {
+      m68ki_resolve_flags();
+      if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+      {
+         uint word2 = OPER_I_16();
+         uint compare = REG_DA[(word2 >> 12) & 15];
+         uint ea = EA_AW_32();
+         uint lower_bound = m68ki_read_32(ea);
+         uint upper_bound = m68ki_read_32(ea + 4);
+
+         FLAG_C = compare - lower_bound;
+         FLAG_Z = !((upper_bound==compare) | (lower_bound==compare));
+         FLAG_C = CFLAG_SUB_32(lower_bound, compare, FLAG_C);
+         if(COND_CS())
+         {
+            if(BIT_B(word2))
+               m68ki_exception_trap(EXCEPTION_CHK);
+            goto m68k_op_chk2cmp2_32_aw_done;
+         }
+
+         FLAG_C = upper_bound - compare;
+         FLAG_C = CFLAG_SUB_32(compare, upper_bound, FLAG_C);
+         if(COND_CS() && BIT_B(word2))
+               m68ki_exception_trap(EXCEPTION_CHK);
+         goto m68k_op_chk2cmp2_32_aw_done;
+      }
+      m68ki_exception_illegal();
+   }
+m68k_op_chk2cmp2_32_aw_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_chk2cmp2_32_al:
+   {
+      m68ki_resolve_flags();
+      if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+      {
+         uint word2 = OPER_I_16();
+         uint compare = REG_DA[(word2 >> 12) & 15];
+         uint ea = EA_AL_32();
+         uint lower_bound = m68ki_read_32(ea);
+         uint upper_bound = m68ki_read_32(ea + 4);
+
+         FLAG_C = compare - lower_bound;
+         FLAG_Z = !((upper_bound==compare) | (lower_bound==compare));
+         FLAG_C = CFLAG_SUB_32(lower_bound, compare, FLAG_C);
+         if(COND_CS())
+         {
+            if(BIT_B(word2))
+               m68ki_exception_trap(EXCEPTION_CHK);
+            goto m68k_op_chk2cmp2_32_al_done;
+         }
+
+         FLAG_C = upper_bound - compare;
+         FLAG_C = CFLAG_SUB_32(compare, upper_bound, FLAG_C);
+         if(COND_CS() && BIT_B(word2))
+               m68ki_exception_trap(EXCEPTION_CHK);
+         goto m68k_op_chk2cmp2_32_al_done;
+      }
+      m68ki_exception_illegal();
+   }
+m68k_op_chk2cmp2_32_al_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_clr_8_d:
+   {
+      DY &= 0xffffff00;
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_CLEAR;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+      FLAG_Z = ZFLAG_SET;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_clr_8_ai:
+   {
+      m68ki_write_8(EA_AY_AI_8(), 0);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_CLEAR;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+      FLAG_Z = ZFLAG_SET;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_clr_8_pi:
+   {
+      m68ki_write_8(EA_AY_PI_8(), 0);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_CLEAR;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+      FLAG_Z = ZFLAG_SET;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_clr_8_pi7:
+   {
+      m68ki_write_8(EA_A7_PI_8(), 0);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_CLEAR;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+      FLAG_Z = ZFLAG_SET;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_clr_8_pd:
+   {
+      m68ki_write_8(EA_AY_PD_8(), 0);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_CLEAR;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+      FLAG_Z = ZFLAG_SET;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_clr_8_pd7:
+   {
+      m68ki_write_8(EA_A7_PD_8(), 0);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_CLEAR;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+      FLAG_Z = ZFLAG_SET;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_clr_8_di:
+   {
+      m68ki_write_8(EA_AY_DI_8(), 0);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_CLEAR;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+      FLAG_Z = ZFLAG_SET;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_clr_8_ix:
+   {
+      m68ki_write_8(EA_AY_IX_8(), 0);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_CLEAR;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+      FLAG_Z = ZFLAG_SET;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_clr_8_aw:
+   {
+      m68ki_write_8(EA_AW_8(), 0);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_CLEAR;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+      FLAG_Z = ZFLAG_SET;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_clr_8_al:
+   {
+      m68ki_write_8(EA_AL_8(), 0);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_CLEAR;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+      FLAG_Z = ZFLAG_SET;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_clr_16_d:
+   {
+      DY &= 0xffff0000;
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_CLEAR;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+      FLAG_Z = ZFLAG_SET;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_clr_16_ai:
+   {
+      m68ki_write_16(EA_AY_AI_16(), 0);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_CLEAR;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+      FLAG_Z = ZFLAG_SET;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_clr_16_pi:
+   {
+      m68ki_write_16(EA_AY_PI_16(), 0);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_CLEAR;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+      FLAG_Z = ZFLAG_SET;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_clr_16_pd:
+   {
+      m68ki_write_16(EA_AY_PD_16(), 0);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_CLEAR;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+      FLAG_Z = ZFLAG_SET;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_clr_16_di:
+   {
+      m68ki_write_16(EA_AY_DI_16(), 0);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_CLEAR;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+      FLAG_Z = ZFLAG_SET;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_clr_16_ix:
+   {
+      m68ki_write_16(EA_AY_IX_16(), 0);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_CLEAR;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+      FLAG_Z = ZFLAG_SET;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_clr_16_aw:
+   {
+      m68ki_write_16(EA_AW_16(), 0);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_CLEAR;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+      FLAG_Z = ZFLAG_SET;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_clr_16_al:
+   {
+      m68ki_write_16(EA_AL_16(), 0);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_CLEAR;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+      FLAG_Z = ZFLAG_SET;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_clr_32_d:
+   {
+      DY = 0;
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_CLEAR;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+      FLAG_Z = ZFLAG_SET;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_clr_32_ai:
+   {
+      m68ki_write_32(EA_AY_AI_32(), 0);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_CLEAR;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+      FLAG_Z = ZFLAG_SET;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_clr_32_pi:
+   {
+      m68ki_write_32(EA_AY_PI_32(), 0);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_CLEAR;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+      FLAG_Z = ZFLAG_SET;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_clr_32_pd:
+   {
+      m68ki_write_32(EA_AY_PD_32(), 0);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_CLEAR;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+      FLAG_Z = ZFLAG_SET;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_clr_32_di:
+   {
+      m68ki_write_32(EA_AY_DI_32(), 0);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_CLEAR;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+      FLAG_Z = ZFLAG_SET;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_clr_32_ix:
+   {
+      m68ki_write_32(EA_AY_IX_32(), 0);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_CLEAR;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+      FLAG_Z = ZFLAG_SET;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_clr_32_aw:
+   {
+      m68ki_write_32(EA_AW_32(), 0);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_CLEAR;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+      FLAG_Z = ZFLAG_SET;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_clr_32_al:
+   {
+      m68ki_write_32(EA_AL_32(), 0);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_CLEAR;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+      FLAG_Z = ZFLAG_SET;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_cmp_8_d:
+   {
+      uint src = MASK_OUT_ABOVE_8(DY);
+      uint dst = MASK_OUT_ABOVE_8(DX);
+      uint res = dst - src;
+
+      m68ki_set_nzvc_sub_8(src, dst, res);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_cmp_8_ai:
+   {
+      uint src = OPER_AY_AI_8();
+      uint dst = MASK_OUT_ABOVE_8(DX);
+      uint res = dst - src;
+
+      m68ki_set_nzvc_sub_8(src, dst, res);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_cmp_8_pi:
+   {
+      uint src = OPER_AY_PI_8();
+      uint dst = MASK_OUT_ABOVE_8(DX);
+      uint res = dst - src;
+
+      m68ki_set_nzvc_sub_8(src, dst, res);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_cmp_8_pi7:
+   {
+      uint src = OPER_A7_PI_8();
+      uint dst = MASK_OUT_ABOVE_8(DX);
+      uint res = dst - src;
+
+      m68ki_set_nzvc_sub_8(src, dst, res);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_cmp_8_pd:
+   {
+      uint src = OPER_AY_PD_8();
+      uint dst = MASK_OUT_ABOVE_8(DX);
+      uint res = dst - src;
+
+      m68ki_set_nzvc_sub_8(src, dst, res);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_cmp_8_pd7:
+   {
+      uint src = OPER_A7_PD_8();
+      uint dst = MASK_OUT_ABOVE_8(DX);
+      uint res = dst - src;
+
+      m68ki_set_nzvc_sub_8(src, dst, res);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_cmp_8_di:
+   {
+      uint src = OPER_AY_DI_8();
+      uint dst = MASK_OUT_ABOVE_8(DX);
+      uint res = dst - src;
+
+      m68ki_set_nzvc_sub_8(src, dst, res);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_cmp_8_ix:
+   {
+      uint src = OPER_AY_IX_8();
+      uint dst = MASK_OUT_ABOVE_8(DX);
+      uint res = dst - src;
+
+      m68ki_set_nzvc_sub_8(src, dst, res);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_cmp_8_aw:
+   {
+      uint src = OPER_AW_8();
+      uint dst = MASK_OUT_ABOVE_8(DX);
+      uint res = dst - src;
+
+      m68ki_set_nzvc_sub_8(src, dst, res);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_cmp_8_al:
+   {
+      uint src = OPER_AL_8();
+      uint dst = MASK_OUT_ABOVE_8(DX);
+      uint res = dst - src;
+
+      m68ki_set_nzvc_sub_8(src, dst, res);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_cmp_8_pcdi:
+   {
+      uint src = OPER_PCDI_8();
+      uint dst = MASK_OUT_ABOVE_8(DX);
+      uint res = dst - src;
+
+      m68ki_set_nzvc_sub_8(src, dst, res);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_cmp_8_pcix:
+   {
+      uint src = OPER_PCIX_8();
+      uint dst = MASK_OUT_ABOVE_8(DX);
+      uint res = dst - src;
+
+      m68ki_set_nzvc_sub_8(src, dst, res);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_cmp_8_i:
+   {
+      uint src = OPER_I_8();
+      uint dst = MASK_OUT_ABOVE_8(DX);
+      uint res = dst - src;
+
+      m68ki_set_nzvc_sub_8(src, dst, res);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_cmp_16_d:
+   {
+      uint src = MASK_OUT_ABOVE_16(DY);
+      uint dst = MASK_OUT_ABOVE_16(DX);
+      uint res = dst - src;
+
+      m68ki_set_nzvc_sub_16(src, dst, res);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_cmp_16_a:
+   {
+      uint src = MASK_OUT_ABOVE_16(AY);
+      uint dst = MASK_OUT_ABOVE_16(DX);
+      uint res = dst - src;
+
+      m68ki_set_nzvc_sub_16(src, dst, res);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_cmp_16_ai:
+   {
+      uint src = OPER_AY_AI_16();
+      uint dst = MASK_OUT_ABOVE_16(DX);
+      uint res = dst - src;
+
+      m68ki_set_nzvc_sub_16(src, dst, res);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_cmp_16_pi:
+   {
+      uint src = OPER_AY_PI_16();
+      uint dst = MASK_OUT_ABOVE_16(DX);
+      uint res = dst - src;
+
+      m68ki_set_nzvc_sub_16(src, dst, res);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_cmp_16_pd:
+   {
+      uint src = OPER_AY_PD_16();
+      uint dst = MASK_OUT_ABOVE_16(DX);
+      uint res = dst - src;
+
+      m68ki_set_nzvc_sub_16(src, dst, res);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_cmp_16_di:
+   {
+      uint src = OPER_AY_DI_16();
+      uint dst = MASK_OUT_ABOVE_16(DX);
+      uint res = dst - src;
+
+      m68ki_set_nzvc_sub_16(src, dst, res);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_cmp_16_ix:
+   {
+      uint src = OPER_AY_IX_16();
+      uint dst = MASK_OUT_ABOVE_16(DX);
+      uint res = dst - src;
+
+      m68ki_set_nzvc_sub_16(src, dst, res);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_cmp_16_aw:
+   {
+      uint src = OPER_AW_16();
+      uint dst = MASK_OUT_ABOVE_16(DX);
+      uint res = dst - src;
+
+      m68ki_set_nzvc_sub_16(src, dst, res);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_cmp_16_al:
+   {
+      uint src = OPER_AL_16();
+      uint dst = MASK_OUT_ABOVE_16(DX);
+      uint res = dst - src;
+
+      m68ki_set_nzvc_sub_16(src, dst, res);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_cmp_16_pcdi:
+   {
+      uint src = OPER_PCDI_16();
+      uint dst = MASK_OUT_ABOVE_16(DX);
+      uint res = dst - src;
+
+      m68ki_set_nzvc_sub_16(src, dst, res);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_cmp_16_pcix:
+   {
+      uint src = OPER_PCIX_16();
+      uint dst = MASK_OUT_ABOVE_16(DX);
+      uint res = dst - src;
+
+      m68ki_set_nzvc_sub_16(src, dst, res);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_cmp_16_i:
+   {
+      uint src = OPER_I_16();
+      uint dst = MASK_OUT_ABOVE_16(DX);
+      uint res = dst - src;
+
+      m68ki_set_nzvc_sub_16(src, dst, res);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_cmp_32_d:
+   {
+      uint src = DY;
+      uint dst = DX;
+      uint res = dst - src;
+
+      m68ki_set_nzvc_sub_32(src, dst, res);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_cmp_32_a:
+   {
+      uint src = AY;
+      uint dst = DX;
+      uint res = dst - src;
+
+      m68ki_set_nzvc_sub_32(src, dst, res);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_cmp_32_ai:
+   {
+      uint src = OPER_AY_AI_32();
+      uint dst = DX;
+      uint res = dst - src;
+
+      m68ki_set_nzvc_sub_32(src, dst, res);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_cmp_32_pi:
+   {
+      uint src = OPER_AY_PI_32();
+      uint dst = DX;
+      uint res = dst - src;
+
+      m68ki_set_nzvc_sub_32(src, dst, res);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_cmp_32_pd:
+   {
+      uint src = OPER_AY_PD_32();
+      uint dst = DX;
+      uint res = dst - src;
+
+      m68ki_set_nzvc_sub_32(src, dst, res);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_cmp_32_di:
+   {
+      uint src = OPER_AY_DI_32();
+      uint dst = DX;
+      uint res = dst - src;
+
+      m68ki_set_nzvc_sub_32(src, dst, res);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_cmp_32_ix:
+   {
+      uint src = OPER_AY_IX_32();
+      uint dst = DX;
+      uint res = dst - src;
+
+      m68ki_set_nzvc_sub_32(src, dst, res);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_cmp_32_aw:
+   {
+      uint src = OPER_AW_32();
+      uint dst = DX;
+      uint res = dst - src;
+
+      m68ki_set_nzvc_sub_32(src, dst, res);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_cmp_32_al:
+   {
+      uint src = OPER_AL_32();
+      uint dst = DX;
+      uint res = dst - src;
+
+      m68ki_set_nzvc_sub_32(src, dst, res);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_cmp_32_pcdi:
+   {
+      uint src = OPER_PCDI_32();
+      uint dst = DX;
+      uint res = dst - src;
+
+      m68ki_set_nzvc_sub_32(src, dst, res);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_cmp_32_pcix:
+   {
+      uint src = OPER_PCIX_32();
+      uint dst = DX;
+      uint res = dst - src;
+
+      m68ki_set_nzvc_sub_32(src, dst, res);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_cmp_32_i:
+   {
+      uint src = OPER_I_32();
+      uint dst = DX;
+      uint res = dst - src;
+
+      m68ki_set_nzvc_sub_32(src, dst, res);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_cmpa_16_d:
+   {
+      uint src = MAKE_INT_16(DY);
+      uint dst = AX;
+      uint res = dst - src;
+
+      m68ki_set_nzvc_sub_32(src, dst, res);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_cmpa_16_a:
+   {
+      uint src = MAKE_INT_16(AY);
+      uint dst = AX;
+      uint res = dst - src;
+
+      m68ki_set_nzvc_sub_32(src, dst, res);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_cmpa_16_ai:
+   {
+      uint src = MAKE_INT_16(OPER_AY_AI_16());
+      uint dst = AX;
+      uint res = dst - src;
+
+      m68ki_set_nzvc_sub_32(src, dst, res);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_cmpa_16_pi:
+   {
+      uint src = MAKE_INT_16(OPER_AY_PI_16());
+      uint dst = AX;
+      uint res = dst - src;
+
+      m68ki_set_nzvc_sub_32(src, dst, res);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_cmpa_16_pd:
+   {
+      uint src = MAKE_INT_16(OPER_AY_PD_16());
+      uint dst = AX;
+      uint res = dst - src;
+
+      m68ki_set_nzvc_sub_32(src, dst, res);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_cmpa_16_di:
+   {
+      uint src = MAKE_INT_16(OPER_AY_DI_16());
+      uint dst = AX;
+      uint res = dst - src;
+
+      m68ki_set_nzvc_sub_32(src, dst, res);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_cmpa_16_ix:
+   {
+      uint src = MAKE_INT_16(OPER_AY_IX_16());
+      uint dst = AX;
+      uint res = dst - src;
+
+      m68ki_set_nzvc_sub_32(src, dst, res);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_cmpa_16_aw:
+   {
+      uint src = MAKE_INT_16(OPER_AW_16());
+      uint dst = AX;
+      uint res = dst - src;
+
+      m68ki_set_nzvc_sub_32(src, dst, res);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_cmpa_16_al:
+   {
+      uint src = MAKE_INT_16(OPER_AL_16());
+      uint dst = AX;
+      uint res = dst - src;
+
+      m68ki_set_nzvc_sub_32(src, dst, res);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_cmpa_16_pcdi:
+   {
+      uint src = MAKE_INT_16(OPER_PCDI_16());
+      uint dst = AX;
+      uint res = dst - src;
+
+      m68ki_set_nzvc_sub_32(src, dst, res);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_cmpa_16_pcix:
+   {
+      uint src = MAKE_INT_16(OPER_PCIX_16());
+      uint dst = AX;
+      uint res = dst - src;
+
+      m68ki_set_nzvc_sub_32(src, dst, res);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_cmpa_16_i:
+   {
+      uint src = MAKE_INT_16(OPER_I_16());
+      uint dst = AX;
+      uint res = dst - src;
+
+      m68ki_set_nzvc_sub_32(src, dst, res);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_cmpa_32_d:
+   {
+      uint src = DY;
+      uint dst = AX;
+      uint res = dst - src;
+
+      m68ki_set_nzvc_sub_32(src, dst, res);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_cmpa_32_a:
+   {
+      uint src = AY;
+      uint dst = AX;
+      uint res = dst - src;
+
+      m68ki_set_nzvc_sub_32(src, dst, res);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_cmpa_32_ai:
+   {
+      uint src = OPER_AY_AI_32();
+      uint dst = AX;
+      uint res = dst - src;
+
+      m68ki_set_nzvc_sub_32(src, dst, res);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_cmpa_32_pi:
+   {
+      uint src = OPER_AY_PI_32();
+      uint dst = AX;
+      uint res = dst - src;
+
+      m68ki_set_nzvc_sub_32(src, dst, res);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_cmpa_32_pd:
+   {
+      uint src = OPER_AY_PD_32();
+      uint dst = AX;
+      uint res = dst - src;
+
+      m68ki_set_nzvc_sub_32(src, dst, res);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_cmpa_32_di:
+   {
+      uint src = OPER_AY_DI_32();
+      uint dst = AX;
+      uint res = dst - src;
+
+      m68ki_set_nzvc_sub_32(src, dst, res);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_cmpa_32_ix:
+   {
+      uint src = OPER_AY_IX_32();
+      uint dst = AX;
+      uint res = dst - src;
+
+      m68ki_set_nzvc_sub_32(src, dst, res);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_cmpa_32_aw:
+   {
+      uint src = OPER_AW_32();
+      uint dst = AX;
+      uint res = dst - src;
+
+      m68ki_set_nzvc_sub_32(src, dst, res);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_cmpa_32_al:
+   {
+      uint src = OPER_AL_32();
+      uint dst = AX;
+      uint res = dst - src;
+
+      m68ki_set_nzvc_sub_32(src, dst, res);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_cmpa_32_pcdi:
+   {
+      uint src = OPER_PCDI_32();
+      uint dst = AX;
+      uint res = dst - src;
+
+      m68ki_set_nzvc_sub_32(src, dst, res);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_cmpa_32_pcix:
+   {
+      uint src = OPER_PCIX_32();
+      uint dst = AX;
+      uint res = dst - src;
+
+      m68ki_set_nzvc_sub_32(src, dst, res);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_cmpa_32_i:
+   {
+      uint src = OPER_I_32();
+      uint dst = AX;
+      uint res = dst - src;
+
+      m68ki_set_nzvc_sub_32(src, dst, res);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_cmpi_8_d:
+   {
+      uint src = OPER_I_8();
+      uint dst = MASK_OUT_ABOVE_8(DY);
+      uint res = dst - src;
+
+      m68ki_set_nzvc_sub_8(src, dst, res);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_cmpi_8_ai:
+   {
+      uint src = OPER_I_8();
+      uint dst = OPER_AY_AI_8();
+      uint res = dst - src;
+
+      m68ki_set_nzvc_sub_8(src, dst, res);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_cmpi_8_pi:
+   {
+      uint src = OPER_I_8();
+      uint dst = OPER_AY_PI_8();
+      uint res = dst - src;
+
+      m68ki_set_nzvc_sub_8(src, dst, res);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_cmpi_8_pi7:
+   {
+      uint src = OPER_I_8();
+      uint dst = OPER_A7_PI_8();
+      uint res = dst - src;
+
+      m68ki_set_nzvc_sub_8(src, dst, res);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_cmpi_8_pd:
+   {
+      uint src = OPER_I_8();
+      uint dst = OPER_AY_PD_8();
+      uint res = dst - src;
+
+      m68ki_set_nzvc_sub_8(src, dst, res);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_cmpi_8_pd7:
+   {
+      uint src = OPER_I_8();
+      uint dst = OPER_A7_PD_8();
+      uint res = dst - src;
+
+      m68ki_set_nzvc_sub_8(src, dst, res);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_cmpi_8_di:
+   {
+      uint src = OPER_I_8();
+      uint dst = OPER_AY_DI_8();
+      uint res = dst - src;
+
+      m68ki_set_nzvc_sub_8(src, dst, res);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_cmpi_8_ix:
+   {
+      uint src = OPER_I_8();
+      uint dst = OPER_AY_IX_8();
+      uint res = dst - src;
+
+      m68ki_set_nzvc_sub_8(src, dst, res);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_cmpi_8_aw:
+   {
+      uint src = OPER_I_8();
+      uint dst = OPER_AW_8();
+      uint res = dst - src;
+
+      m68ki_set_nzvc_sub_8(src, dst, res);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_cmpi_8_al:
+   {
+      uint src = OPER_I_8();
+      uint dst = OPER_AL_8();
+      uint res = dst - src;
+
+      m68ki_set_nzvc_sub_8(src, dst, res);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_cmpi_8_pcdi:
+   {
+      if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+      {
+         uint src = OPER_I_8();
+         uint dst = OPER_PCDI_8();
+         uint res = dst - src;
+
+         m68ki_set_nzvc_sub_8(src, dst, res);
+         goto m68k_op_cmpi_8_pcdi_done;
+      }
+      m68ki_exception_illegal();
+   }
+m68k_op_cmpi_8_pcdi_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_cmpi_8_pcix:
+   {
+      if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+      {
+         uint src = OPER_I_8();
+         uint dst = OPER_PCIX_8();
+         uint res = dst - src;
+
+         m68ki_set_nzvc_sub_8(src, dst, res);
+         goto m68k_op_cmpi_8_pcix_done;
+      }
+      m68ki_exception_illegal();
+   }
+m68k_op_cmpi_8_pcix_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_cmpi_16_d:
+   {
+      uint src = OPER_I_16();
+      uint dst = MASK_OUT_ABOVE_16(DY);
+      uint res = dst - src;
+
+      m68ki_set_nzvc_sub_16(src, dst, res);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_cmpi_16_ai:
+   {
+      uint src = OPER_I_16();
+      uint dst = OPER_AY_AI_16();
+      uint res = dst - src;
+
+      m68ki_set_nzvc_sub_16(src, dst, res);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_cmpi_16_pi:
+   {
+      uint src = OPER_I_16();
+      uint dst = OPER_AY_PI_16();
+      uint res = dst - src;
+
+      m68ki_set_nzvc_sub_16(src, dst, res);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_cmpi_16_pd:
+   {
+      uint src = OPER_I_16();
+      uint dst = OPER_AY_PD_16();
+      uint res = dst - src;
+
+      m68ki_set_nzvc_sub_16(src, dst, res);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_cmpi_16_di:
+   {
+      uint src = OPER_I_16();
+      uint dst = OPER_AY_DI_16();
+      uint res = dst - src;
+
+      m68ki_set_nzvc_sub_16(src, dst, res);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_cmpi_16_ix:
+   {
+      uint src = OPER_I_16();
+      uint dst = OPER_AY_IX_16();
+      uint res = dst - src;
+
+      m68ki_set_nzvc_sub_16(src, dst, res);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_cmpi_16_aw:
+   {
+      uint src = OPER_I_16();
+      uint dst = OPER_AW_16();
+      uint res = dst - src;
+
+      m68ki_set_nzvc_sub_16(src, dst, res);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_cmpi_16_al:
+   {
+      uint src = OPER_I_16();
+      uint dst = OPER_AL_16();
+      uint res = dst - src;
+
+      m68ki_set_nzvc_sub_16(src, dst, res);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_cmpi_16_pcdi:
+   {
+      if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+      {
+         uint src = OPER_I_16();
+         uint dst = OPER_PCDI_16();
+         uint res = dst - src;
+
+         m68ki_set_nzvc_sub_16(src, dst, res);
+         goto m68k_op_cmpi_16_pcdi_done;
+      }
+      m68ki_exception_illegal();
+   }
+m68k_op_cmpi_16_pcdi_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_cmpi_16_pcix:
+   {
+      if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+      {
+         uint src = OPER_I_16();
+         uint dst = OPER_PCIX_16();
+         uint res = dst - src;
+
+         m68ki_set_nzvc_sub_16(src, dst, res);
+         goto m68k_op_cmpi_16_pcix_done;
+      }
+      m68ki_exception_illegal();
+   }
+m68k_op_cmpi_16_pcix_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_cmpi_32_d:
+   {
+      uint src = OPER_I_32();
+      uint dst = DY;
+      uint res = dst - src;
+
+      m68ki_set_nzvc_sub_32(src, dst, res);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_cmpi_32_ai:
+   {
+      uint src = OPER_I_32();
+      uint dst = OPER_AY_AI_32();
+      uint res = dst - src;
+
+      m68ki_set_nzvc_sub_32(src, dst, res);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_cmpi_32_pi:
+   {
+      uint src = OPER_I_32();
+      uint dst = OPER_AY_PI_32();
+      uint res = dst - src;
+
+      m68ki_set_nzvc_sub_32(src, dst, res);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_cmpi_32_pd:
+   {
+      uint src = OPER_I_32();
+      uint dst = OPER_AY_PD_32();
+      uint res = dst - src;
+
+      m68ki_set_nzvc_sub_32(src, dst, res);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_cmpi_32_di:
+   {
+      uint src = OPER_I_32();
+      uint dst = OPER_AY_DI_32();
+      uint res = dst - src;
+
+      m68ki_set_nzvc_sub_32(src, dst, res);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_cmpi_32_ix:
+   {
+      uint src = OPER_I_32();
+      uint dst = OPER_AY_IX_32();
+      uint res = dst - src;
+
+      m68ki_set_nzvc_sub_32(src, dst, res);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_cmpi_32_aw:
+   {
+      uint src = OPER_I_32();
+      uint dst = OPER_AW_32();
+      uint res = dst - src;
+
+      m68ki_set_nzvc_sub_32(src, dst, res);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_cmpi_32_al:
+   {
+      uint src = OPER_I_32();
+      uint dst = OPER_AL_32();
+      uint res = dst - src;
+
+      m68ki_set_nzvc_sub_32(src, dst, res);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_cmpi_32_pcdi:
+   {
+      if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+      {
+         uint src = OPER_I_32();
+         uint dst = OPER_PCDI_32();
+         uint res = dst - src;
+
+         m68ki_set_nzvc_sub_32(src, dst, res);
+         goto m68k_op_cmpi_32_pcdi_done;
+      }
+      m68ki_exception_illegal();
+   }
+m68k_op_cmpi_32_pcdi_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_cmpi_32_pcix:
+   {
+      if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+      {
+         uint src = OPER_I_32();
+         uint dst = OPER_PCIX_32();
+         uint res = dst - src;
+
+         m68ki_set_nzvc_sub_32(src, dst, res);
+         goto m68k_op_cmpi_32_pcix_done;
+      }
+      m68ki_exception_illegal();
+   }
+m68k_op_cmpi_32_pcix_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_cmpm_8_ax7:
+   {
+      uint src = OPER_AY_PI_8();
+      uint dst = OPER_A7_PI_8();
+      uint res = dst - src;
+
+      m68ki_set_nzvc_sub_8(src, dst, res);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_cmpm_8_ay7:
+   {
+      uint src = OPER_A7_PI_8();
+      uint dst = OPER_AX_PI_8();
+      uint res = dst - src;
+
+      m68ki_set_nzvc_sub_8(src, dst, res);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_cmpm_8_axy7:
+   {
+      uint src = OPER_A7_PI_8();
+      uint dst = OPER_A7_PI_8();
+      uint res = dst - src;
+
+      m68ki_set_nzvc_sub_8(src, dst, res);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_cmpm_8:
+   {
+      uint src = OPER_AY_PI_8();
+      uint dst = OPER_AX_PI_8();
+      uint res = dst - src;
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_8(res);
+      FLAG_Z = MASK_OUT_ABOVE_8(res);
+      FLAG_V = VFLAG_SUB_8(src, dst, res);
+      FLAG_C = CFLAG_8(res);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_cmpm_16:
+   {
+      uint src = OPER_AY_PI_16();
+      uint dst = OPER_AX_PI_16();
+      uint res = dst - src;
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_16(res);
+      FLAG_Z = MASK_OUT_ABOVE_16(res);
+      FLAG_V = VFLAG_SUB_16(src, dst, res);
+      FLAG_C = CFLAG_16(res);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_cmpm_32:
+   {
+      uint src = OPER_AY_PI_32();
+      uint dst = OPER_AX_PI_32();
+      uint res = dst - src;
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_32(res);
+      FLAG_Z = MASK_OUT_ABOVE_32(res);
+      FLAG_V = VFLAG_SUB_32(src, dst, res);
+      FLAG_C = CFLAG_SUB_32(src, dst, res);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_cpbcc_32:
+   {
+      if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+      {
+         M68K_DO_LOG((M68K_LOG_FILEHANDLE "%s at %08x: called unimplemented instruction %04x (%s)\n",
+                   m68ki_cpu_names[CPU_TYPE], ADDRESS_68K(REG_PC - 2), REG_IR,
+                   m68k_disassemble_quick(ADDRESS_68K(REG_PC - 2))));
+         goto m68k_op_cpbcc_32_done;
+      }
+      m68ki_exception_1111();
+   }
+m68k_op_cpbcc_32_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_cpdbcc_32:
+   {
+      if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+      {
+         M68K_DO_LOG((M68K_LOG_FILEHANDLE "%s at %08x: called unimplemented instruction %04x (%s)\n",
+                   m68ki_cpu_names[CPU_TYPE], ADDRESS_68K(REG_PC - 2), REG_IR,
+                   m68k_disassemble_quick(ADDRESS_68K(REG_PC - 2))));
+         goto m68k_op_cpdbcc_32_done;
+      }
+      m68ki_exception_1111();
+   }
+m68k_op_cpdbcc_32_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_cpgen_32:
+   {
+      if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+      {
+         M68K_DO_LOG((M68K_LOG_FILEHANDLE "%s at %08x: called unimplemented instruction %04x (%s)\n",
+                   m68ki_cpu_names[CPU_TYPE], ADDRESS_68K(REG_PC - 2), REG_IR,
+                   m68k_disassemble_quick(ADDRESS_68K(REG_PC - 2))));
+         goto m68k_op_cpgen_32_done;
+      }
+      m68ki_exception_1111();
+   }
+m68k_op_cpgen_32_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_cpscc_32:
+   {
+      if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+      {
+         M68K_DO_LOG((M68K_LOG_FILEHANDLE "%s at %08x: called unimplemented instruction %04x (%s)\n",
+                   m68ki_cpu_names[CPU_TYPE], ADDRESS_68K(REG_PC - 2), REG_IR,
+                   m68k_disassemble_quick(ADDRESS_68K(REG_PC - 2))));
+         goto m68k_op_cpscc_32_done;
+      }
+      m68ki_exception_1111();
+   }
+m68k_op_cpscc_32_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_cptrapcc_32:
+   {
+      if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+      {
+         M68K_DO_LOG((M68K_LOG_FILEHANDLE "%s at %08x: called unimplemented instruction %04x (%s)\n",
+                   m68ki_cpu_names[CPU_TYPE], ADDRESS_68K(REG_PC - 2), REG_IR,
+                   m68k_disassemble_quick(ADDRESS_68K(REG_PC - 2))));
+         goto m68k_op_cptrapcc_32_done;
+      }
+      m68ki_exception_1111();
+   }
+m68k_op_cptrapcc_32_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_dbt_16:
+   {
+      REG_PC += 2;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_dbf_16:
+   {
+      uint* r_dst = &DY;
+      uint res = MASK_OUT_ABOVE_16(*r_dst - 1);
+
+      *r_dst = MASK_OUT_BELOW_16(*r_dst) | res;
+      if(res != 0xffff)
+      {
+         uint offset = OPER_I_16();
+         REG_PC -= 2;
+         m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
+         m68ki_branch_16(offset);
+         USE_CYCLES(CYC_DBCC_F_NOEXP);
+         if(offset == 0xfffc)
+            m68ki_bulk_move_loop(r_dst); /* auto-disable (see m68kcpu.h) */
+         goto m68k_op_dbf_16_done;
+      }
+      REG_PC += 2;
+      USE_CYCLES(CYC_DBCC_F_EXP);
+   }
+m68k_op_dbf_16_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_dbhi_16:
+   {
+      m68ki_resolve_flags();
+      if(COND_NOT_HI())
+      {
+         uint* r_dst = &DY;
+         uint res = MASK_OUT_ABOVE_16(*r_dst - 1);
+
+         *r_dst = MASK_OUT_BELOW_16(*r_dst) | res;
+         if(res != 0xffff)
+         {
+            uint offset = OPER_I_16();
+            REG_PC -= 2;
+            m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
+            m68ki_branch_16(offset);
+            USE_CYCLES(CYC_DBCC_F_NOEXP);
+            goto m68k_op_dbhi_16_done;
+         }
+         REG_PC += 2;
+         USE_CYCLES(CYC_DBCC_F_EXP);
+         goto m68k_op_dbhi_16_done;
+      }
+      REG_PC += 2;
+   }
+m68k_op_dbhi_16_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_dbls_16:
+   {
+      m68ki_resolve_flags();
+      if(COND_NOT_LS())
+      {
+         uint* r_dst = &DY;
+         uint res = MASK_OUT_ABOVE_16(*r_dst - 1);
+
+         *r_dst = MASK_OUT_BELOW_16(*r_dst) | res;
+         if(res != 0xffff)
+         {
+            uint offset = OPER_I_16();
+            REG_PC -= 2;
+            m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
+            m68ki_branch_16(offset);
+            USE_CYCLES(CYC_DBCC_F_NOEXP);
+            goto m68k_op_dbls_16_done;
+         }
+         REG_PC += 2;
+         USE_CYCLES(CYC_DBCC_F_EXP);
+         goto m68k_op_dbls_16_done;
+      }
+      REG_PC += 2;
+   }
+m68k_op_dbls_16_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_dbcc_16:
+   {
+      m68ki_resolve_flags();
+      if(COND_NOT_CC())
+      {
+         uint* r_dst = &DY;
+         uint res = MASK_OUT_ABOVE_16(*r_dst - 1);
+
+         *r_dst = MASK_OUT_BELOW_16(*r_dst) | res;
+         if(res != 0xffff)
+         {
+            uint offset = OPER_I_16();
+            REG_PC -= 2;
+            m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
+            m68ki_branch_16(offset);
+            USE_CYCLES(CYC_DBCC_F_NOEXP);
+            goto m68k_op_dbcc_16_done;
+         }
+         REG_PC += 2;
+         USE_CYCLES(CYC_DBCC_F_EXP);
+         goto m68k_op_dbcc_16_done;
+      }
+      REG_PC += 2;
+   }
+m68k_op_dbcc_16_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_dbcs_16:
+   {
+      m68ki_resolve_flags();
+      if(COND_NOT_CS())
+      {
+         uint* r_dst = &DY;
+         uint res = MASK_OUT_ABOVE_16(*r_dst - 1);
+
+         *r_dst = MASK_OUT_BELOW_16(*r_dst) | res;
+         if(res != 0xffff)
+         {
+            uint offset = OPER_I_16();
+            REG_PC -= 2;
+            m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
+            m68ki_branch_16(offset);
+            USE_CYCLES(CYC_DBCC_F_NOEXP);
+            goto m68k_op_dbcs_16_done;
+         }
+         REG_PC += 2;
+         USE_CYCLES(CYC_DBCC_F_EXP);
+         goto m68k_op_dbcs_16_done;
+      }
+      REG_PC += 2;
+   }
+m68k_op_dbcs_16_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_dbne_16:
+   {
+      m68ki_resolve_flags();
+      if(COND_NOT_NE())
+      {
+         uint* r_dst = &DY;
+         uint res = MASK_OUT_ABOVE_16(*r_dst - 1);
+
+         *r_dst = MASK_OUT_BELOW_16(*r_dst) | res;
+         if(res != 0xffff)
+         {
+            uint offset = OPER_I_16();
+            REG_PC -= 2;
+            m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
+            m68ki_branch_16(offset);
+            USE_CYCLES(CYC_DBCC_F_NOEXP);
+            goto m68k_op_dbne_16_done;
+         }
+         REG_PC += 2;
+         USE_CYCLES(CYC_DBCC_F_EXP);
+         goto m68k_op_dbne_16_done;
+      }
+      REG_PC += 2;
+   }
+m68k_op_dbne_16_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_dbeq_16:
+   {
+      m68ki_resolve_flags();
+      if(COND_NOT_EQ())
+      {
+         uint* r_dst = &DY;
+         uint res = MASK_OUT_ABOVE_16(*r_dst - 1);
+
+         *r_dst = MASK_OUT_BELOW_16(*r_dst) | res;
+         if(res != 0xffff)
+         {
+            uint offset = OPER_I_16();
+            REG_PC -= 2;
+            m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
+            m68ki_branch_16(offset);
+            USE_CYCLES(CYC_DBCC_F_NOEXP);
+            goto m68k_op_dbeq_16_done;
+         }
+         REG_PC += 2;
+         USE_CYCLES(CYC_DBCC_F_EXP);
+         goto m68k_op_dbeq_16_done;
+      }
+      REG_PC += 2;
+   }
+m68k_op_dbeq_16_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_dbvc_16:
+   {
+      m68ki_resolve_flags();
+      if(COND_NOT_VC())
+      {
+         uint* r_dst = &DY;
+         uint res = MASK_OUT_ABOVE_16(*r_dst - 1);
+
+         *r_dst = MASK_OUT_BELOW_16(*r_dst) | res;
+         if(res != 0xffff)
+         {
+            uint offset = OPER_I_16();
+            REG_PC -= 2;
+            m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
+            m68ki_branch_16(offset);
+            USE_CYCLES(CYC_DBCC_F_NOEXP);
+            goto m68k_op_dbvc_16_done;
+         }
+         REG_PC += 2;
+         USE_CYCLES(CYC_DBCC_F_EXP);
+         goto m68k_op_dbvc_16_done;
+      }
+      REG_PC += 2;
+   }
+m68k_op_dbvc_16_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_dbvs_16:
+   {
+      m68ki_resolve_flags();
+      if(COND_NOT_VS())
+      {
+         uint* r_dst = &DY;
+         uint res = MASK_OUT_ABOVE_16(*r_dst - 1);
+
+         *r_dst = MASK_OUT_BELOW_16(*r_dst) | res;
+         if(res != 0xffff)
+         {
+            uint offset = OPER_I_16();
+            REG_PC -= 2;
+            m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
+            m68ki_branch_16(offset);
+            USE_CYCLES(CYC_DBCC_F_NOEXP);
+            goto m68k_op_dbvs_16_done;
+         }
+         REG_PC += 2;
+         USE_CYCLES(CYC_DBCC_F_EXP);
+         goto m68k_op_dbvs_16_done;
+      }
+      REG_PC += 2;
+   }
+m68k_op_dbvs_16_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_dbpl_16:
+   {
+      m68ki_resolve_flags();
+      if(COND_NOT_PL())
+      {
+         uint* r_dst = &DY;
+         uint res = MASK_OUT_ABOVE_16(*r_dst - 1);
+
+         *r_dst = MASK_OUT_BELOW_16(*r_dst) | res;
+         if(res != 0xffff)
+         {
+            uint offset = OPER_I_16();
+            REG_PC -= 2;
+            m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
+            m68ki_branch_16(offset);
+            USE_CYCLES(CYC_DBCC_F_NOEXP);
+            goto m68k_op_dbpl_16_done;
+         }
+         REG_PC += 2;
+         USE_CYCLES(CYC_DBCC_F_EXP);
+         goto m68k_op_dbpl_16_done;
+      }
+      REG_PC += 2;
+   }
+m68k_op_dbpl_16_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_dbmi_16:
+   {
+      m68ki_resolve_flags();
+      if(COND_NOT_MI())
+      {
+         uint* r_dst = &DY;
+         uint res = MASK_OUT_ABOVE_16(*r_dst - 1);
+
+         *r_dst = MASK_OUT_BELOW_16(*r_dst) | res;
+         if(res != 0xffff)
+         {
+            uint offset = OPER_I_16();
+            REG_PC -= 2;
+            m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
+            m68ki_branch_16(offset);
+            USE_CYCLES(CYC_DBCC_F_NOEXP);
+            goto m68k_op_dbmi_16_done;
+         }
+         REG_PC += 2;
+         USE_CYCLES(CYC_DBCC_F_EXP);
+         goto m68k_op_dbmi_16_done;
+      }
+      REG_PC += 2;
+   }
+m68k_op_dbmi_16_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_dbge_16:
+   {
+      m68ki_resolve_flags();
+      if(COND_NOT_GE())
+      {
+         uint* r_dst = &DY;
+         uint res = MASK_OUT_ABOVE_16(*r_dst - 1);
+
+         *r_dst = MASK_OUT_BELOW_16(*r_dst) | res;
+         if(res != 0xffff)
+         {
+            uint offset = OPER_I_16();
+            REG_PC -= 2;
+            m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
+            m68ki_branch_16(offset);
+            USE_CYCLES(CYC_DBCC_F_NOEXP);
+            goto m68k_op_dbge_16_done;
+         }
+         REG_PC += 2;
+         USE_CYCLES(CYC_DBCC_F_EXP);
+         goto m68k_op_dbge_16_done;
+      }
+      REG_PC += 2;
+   }
+m68k_op_dbge_16_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_dblt_16:
+   {
+      m68ki_resolve_flags();
+      if(COND_NOT_LT())
+      {
+         uint* r_dst = &DY;
+         uint res = MASK_OUT_ABOVE_16(*r_dst - 1);
+
+         *r_dst = MASK_OUT_BELOW_16(*r_dst) | res;
+         if(res != 0xffff)
+         {
+            uint offset = OPER_I_16();
+            REG_PC -= 2;
+            m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
+            m68ki_branch_16(offset);
+            USE_CYCLES(CYC_DBCC_F_NOEXP);
+            goto m68k_op_dblt_16_done;
+         }
+         REG_PC += 2;
+         USE_CYCLES(CYC_DBCC_F_EXP);
+         goto m68k_op_dblt_16_done;
+      }
+      REG_PC += 2;
+   }
+m68k_op_dblt_16_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_dbgt_16:
+   {
+      m68ki_resolve_flags();
+      if(COND_NOT_GT())
+      {
+         uint* r_dst = &DY;
+         uint res = MASK_OUT_ABOVE_16(*r_dst - 1);
+
+         *r_dst = MASK_OUT_BELOW_16(*r_dst) | res;
+         if(res != 0xffff)
+         {
+            uint offset = OPER_I_16();
+            REG_PC -= 2;
+            m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
+            m68ki_branch_16(offset);
+            USE_CYCLES(CYC_DBCC_F_NOEXP);
+            goto m68k_op_dbgt_16_done;
+         }
+         REG_PC += 2;
+         USE_CYCLES(CYC_DBCC_F_EXP);
+         goto m68k_op_dbgt_16_done;
+      }
+      REG_PC += 2;
+   }
+m68k_op_dbgt_16_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_dble_16:
+   {
+      m68ki_resolve_flags();
+      if(COND_NOT_LE())
+      {
+         uint* r_dst = &DY;
+         uint res = MASK_OUT_ABOVE_16(*r_dst - 1);
+
+         *r_dst = MASK_OUT_BELOW_16(*r_dst) | res;
+         if(res != 0xffff)
+         {
+            uint offset = OPER_I_16();
+            REG_PC -= 2;
+            m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
+            m68ki_branch_16(offset);
+            USE_CYCLES(CYC_DBCC_F_NOEXP);
+            goto m68k_op_dble_16_done;
+         }
+         REG_PC += 2;
+         USE_CYCLES(CYC_DBCC_F_EXP);
+         goto m68k_op_dble_16_done;
+      }
+      REG_PC += 2;
+   }
+m68k_op_dble_16_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_divs_16_d:
+   {
+      uint* r_dst = &DX;
+      sint src = MAKE_INT_16(DY);
+      sint quotient;
+      sint remainder;
+
+      m68ki_resolve_flags();
+
+      if(src != 0)
+      {
+         if((uint32)*r_dst == 0x80000000 && src == -1)
+         {
+            FLAG_Z = 0;
+            FLAG_N = NFLAG_CLEAR;
+            FLAG_V = VFLAG_CLEAR;
+            FLAG_C = CFLAG_CLEAR;
+            *r_dst = 0;
+            goto m68k_op_divs_16_d_done;
+         }
+
+         quotient = MAKE_INT_32(*r_dst) / src;
+         remainder = MAKE_INT_32(*r_dst) % src;
+
+         if(quotient == MAKE_INT_16(quotient))
+         {
+            FLAG_Z = quotient;
+            FLAG_N = NFLAG_16(quotient);
+            FLAG_V = VFLAG_CLEAR;
+            FLAG_C = CFLAG_CLEAR;
+            *r_dst = MASK_OUT_ABOVE_32(MASK_OUT_ABOVE_16(quotient) | (remainder << 16));
+            goto m68k_op_divs_16_d_done;
+         }
+         FLAG_V = VFLAG_SET;
+         goto m68k_op_divs_16_d_done;
+      }
+      m68ki_exception_trap(EXCEPTION_ZERO_DIVIDE);
+   }
+m68k_op_divs_16_d_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_divs_16_ai:
+   {
+      uint* r_dst = &DX;
+      sint src = MAKE_INT_16(OPER_AY_AI_16());
+      sint quotient;
+      sint remainder;
+
+      m68ki_resolve_flags();
+
+      if(src != 0)
+      {
+         if((uint32)*r_dst == 0x80000000 && src == -1)
+         {
+            FLAG_Z = 0;
+            FLAG_N = NFLAG_CLEAR;
+            FLAG_V = VFLAG_CLEAR;
+            FLAG_C = CFLAG_CLEAR;
+            *r_dst = 0;
+            goto m68k_op_divs_16_ai_done;
+         }
+
+         quotient = MAKE_INT_32(*r_dst) / src;
+         remainder = MAKE_INT_32(*r_dst) % src;
+
+         if(quotient == MAKE_INT_16(quotient))
+         {
+            FLAG_Z = quotient;
+            FLAG_N = NFLAG_16(quotient);
+            FLAG_V = VFLAG_CLEAR;
+            FLAG_C = CFLAG_CLEAR;
+            *r_dst = MASK_OUT_ABOVE_32(MASK_OUT_ABOVE_16(quotient) | (remainder << 16));
+            goto m68k_op_divs_16_ai_done;
+         }
+         FLAG_V = VFLAG_SET;
+         goto m68k_op_divs_16_ai_done;
+      }
+      m68ki_exception_trap(EXCEPTION_ZERO_DIVIDE);
+   }
+m68k_op_divs_16_ai_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_divs_16_pi:
+   {
+      uint* r_dst = &DX;
+      sint src = MAKE_INT_16(OPER_AY_PI_16());
+      sint quotient;
+      sint remainder;
+
+      m68ki_resolve_flags();
+
+      if(src != 0)
+      {
+         if((uint32)*r_dst == 0x80000000 && src == -1)
+         {
+            FLAG_Z = 0;
+            FLAG_N = NFLAG_CLEAR;
+            FLAG_V = VFLAG_CLEAR;
+            FLAG_C = CFLAG_CLEAR;
+            *r_dst = 0;
+            goto m68k_op_divs_16_pi_done;
+         }
+
+         quotient = MAKE_INT_32(*r_dst) / src;
+         remainder = MAKE_INT_32(*r_dst) % src;
+
+         if(quotient == MAKE_INT_16(quotient))
+         {
+            FLAG_Z = quotient;
+            FLAG_N = NFLAG_16(quotient);
+            FLAG_V = VFLAG_CLEAR;
+            FLAG_C = CFLAG_CLEAR;
+            *r_dst = MASK_OUT_ABOVE_32(MASK_OUT_ABOVE_16(quotient) | (remainder << 16));
+            goto m68k_op_divs_16_pi_done;
+         }
+         FLAG_V = VFLAG_SET;
+         goto m68k_op_divs_16_pi_done;
+      }
+      m68ki_exception_trap(EXCEPTION_ZERO_DIVIDE);
+   }
+m68k_op_divs_16_pi_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_divs_16_pd:
+   {
+      uint* r_dst = &DX;
+      sint src = MAKE_INT_16(OPER_AY_PD_16());
+      sint quotient;
+      sint remainder;
+
+      m68ki_resolve_flags();
+
+      if(src != 0)
+      {
+         if((uint32)*r_dst == 0x80000000 && src == -1)
+         {
+            FLAG_Z = 0;
+            FLAG_N = NFLAG_CLEAR;
+            FLAG_V = VFLAG_CLEAR;
+            FLAG_C = CFLAG_CLEAR;
+            *r_dst = 0;
+            goto m68k_op_divs_16_pd_done;
+         }
+
+         quotient = MAKE_INT_32(*r_dst) / src;
+         remainder = MAKE_INT_32(*r_dst) % src;
+
+         if(quotient == MAKE_INT_16(quotient))
+         {
+            FLAG_Z = quotient;
+            FLAG_N = NFLAG_16(quotient);
+            FLAG_V = VFLAG_CLEAR;
+            FLAG_C = CFLAG_CLEAR;
+            *r_dst = MASK_OUT_ABOVE_32(MASK_OUT_ABOVE_16(quotient) | (remainder << 16));
+            goto m68k_op_divs_16_pd_done;
+         }
+         FLAG_V = VFLAG_SET;
+         goto m68k_op_divs_16_pd_done;
+      }
+      m68ki_exception_trap(EXCEPTION_ZERO_DIVIDE);
+   }
+m68k_op_divs_16_pd_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_divs_16_di:
+   {
+      uint* r_dst = &DX;
+      sint src = MAKE_INT_16(OPER_AY_DI_16());
+      sint quotient;
+      sint remainder;
+
+      m68ki_resolve_flags();
+
+      if(src != 0)
+      {
+         if((uint32)*r_dst == 0x80000000 && src == -1)
+         {
+            FLAG_Z = 0;
+            FLAG_N = NFLAG_CLEAR;
+            FLAG_V = VFLAG_CLEAR;
+            FLAG_C = CFLAG_CLEAR;
+            *r_dst = 0;
+            goto m68k_op_divs_16_di_done;
+         }
+
+         quotient = MAKE_INT_32(*r_dst) / src;
+         remainder = MAKE_INT_32(*r_dst) % src;
+
+         if(quotient == MAKE_INT_16(quotient))
+         {
+            FLAG_Z = quotient;
+            FLAG_N = NFLAG_16(quotient);
+            FLAG_V = VFLAG_CLEAR;
+            FLAG_C = CFLAG_CLEAR;
+            *r_dst = MASK_OUT_ABOVE_32(MASK_OUT_ABOVE_16(quotient) | (remainder << 16));
+            goto m68k_op_divs_16_di_done;
+         }
+         FLAG_V = VFLAG_SET;
+         goto m68k_op_divs_16_di_done;
+      }
+      m68ki_exception_trap(EXCEPTION_ZERO_DIVIDE);
+   }
+m68k_op_divs_16_di_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_divs_16_ix:
+   {
+      uint* r_dst = &DX;
+      sint src = MAKE_INT_16(OPER_AY_IX_16());
+      sint quotient;
+      sint remainder;
+
+      m68ki_resolve_flags();
+
+      if(src != 0)
+      {
+         if((uint32)*r_dst == 0x80000000 && src == -1)
+         {
+            FLAG_Z = 0;
+            FLAG_N = NFLAG_CLEAR;
+            FLAG_V = VFLAG_CLEAR;
+            FLAG_C = CFLAG_CLEAR;
+            *r_dst = 0;
+            goto m68k_op_divs_16_ix_done;
+         }
+
+         quotient = MAKE_INT_32(*r_dst) / src;
+         remainder = MAKE_INT_32(*r_dst) % src;
+
+         if(quotient == MAKE_INT_16(quotient))
+         {
+            FLAG_Z = quotient;
+            FLAG_N = NFLAG_16(quotient);
+            FLAG_V = VFLAG_CLEAR;
+            FLAG_C = CFLAG_CLEAR;
+            *r_dst = MASK_OUT_ABOVE_32(MASK_OUT_ABOVE_16(quotient) | (remainder << 16));
+            goto m68k_op_divs_16_ix_done;
+         }
+         FLAG_V = VFLAG_SET;
+         goto m68k_op_divs_16_ix_done;
+      }
+      m68ki_exception_trap(EXCEPTION_ZERO_DIVIDE);
+   }
+m68k_op_divs_16_ix_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_divs_16_aw:
+   {
+      uint* r_dst = &DX;
+      sint src = MAKE_INT_16(OPER_AW_16());
+      sint quotient;
+      sint remainder;
+
+      m68ki_resolve_flags();
+
+      if(src != 0)
+      {
+         if((uint32)*r_dst == 0x80000000 && src == -1)
+         {
+            FLAG_Z = 0;
+            FLAG_N = NFLAG_CLEAR;
+            FLAG_V = VFLAG_CLEAR;
+            FLAG_C = CFLAG_CLEAR;
+            *r_dst = 0;
+            goto m68k_op_divs_16_aw_done;
+         }
+
+         quotient = MAKE_INT_32(*r_dst) / src;
+         remainder = MAKE_INT_32(*r_dst) % src;
+
+         if(quotient == MAKE_INT_16(quotient))
+         {
+            FLAG_Z = quotient;
+            FLAG_N = NFLAG_16(quotient);
+            FLAG_V = VFLAG_CLEAR;
+            FLAG_C = CFLAG_CLEAR;
+            *r_dst = MASK_OUT_ABOVE_32(MASK_OUT_ABOVE_16(quotient) | (remainder << 16));
+            goto m68k_op_divs_16_aw_done;
+         }
+         FLAG_V = VFLAG_SET;
+         goto m68k_op_divs_16_aw_done;
+      }
+      m68ki_exception_trap(EXCEPTION_ZERO_DIVIDE);
+   }
+m68k_op_divs_16_aw_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_divs_16_al:
+   {
+      uint* r_dst = &DX;
+      sint src = MAKE_INT_16(OPER_AL_16());
+      sint quotient;
+      sint remainder;
+
+      m68ki_resolve_flags();
+
+      if(src != 0)
+      {
+         if((uint32)*r_dst == 0x80000000 && src == -1)
+         {
+            FLAG_Z = 0;
+            FLAG_N = NFLAG_CLEAR;
+            FLAG_V = VFLAG_CLEAR;
+            FLAG_C = CFLAG_CLEAR;
+            *r_dst = 0;
+            goto m68k_op_divs_16_al_done;
+         }
+
+         quotient = MAKE_INT_32(*r_dst) / src;
+         remainder = MAKE_INT_32(*r_dst) % src;
+
+         if(quotient == MAKE_INT_16(quotient))
+         {
+            FLAG_Z = quotient;
+            FLAG_N = NFLAG_16(quotient);
+            FLAG_V = VFLAG_CLEAR;
+            FLAG_C = CFLAG_CLEAR;
+            *r_dst = MASK_OUT_ABOVE_32(MASK_OUT_ABOVE_16(quotient) | (remainder << 16));
+            goto m68k_op_divs_16_al_done;
+         }
+         FLAG_V = VFLAG_SET;
+         goto m68k_op_divs_16_al_done;
+      }
+      m68ki_exception_trap(EXCEPTION_ZERO_DIVIDE);
+   }
+m68k_op_divs_16_al_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_divs_16_pcdi:
+   {
+      uint* r_dst = &DX;
+      sint src = MAKE_INT_16(OPER_PCDI_16());
+      sint quotient;
+      sint remainder;
+
+      m68ki_resolve_flags();
+
+      if(src != 0)
+      {
+         if((uint32)*r_dst == 0x80000000 && src == -1)
+         {
+            FLAG_Z = 0;
+            FLAG_N = NFLAG_CLEAR;
+            FLAG_V = VFLAG_CLEAR;
+            FLAG_C = CFLAG_CLEAR;
+            *r_dst = 0;
+            goto m68k_op_divs_16_pcdi_done;
+         }
+
+         quotient = MAKE_INT_32(*r_dst) / src;
+         remainder = MAKE_INT_32(*r_dst) % src;
+
+         if(quotient == MAKE_INT_16(quotient))
+         {
+            FLAG_Z = quotient;
+            FLAG_N = NFLAG_16(quotient);
+            FLAG_V = VFLAG_CLEAR;
+            FLAG_C = CFLAG_CLEAR;
+            *r_dst = MASK_OUT_ABOVE_32(MASK_OUT_ABOVE_16(quotient) | (remainder << 16));
+            goto m68k_op_divs_16_pcdi_done;
+         }
+         FLAG_V = VFLAG_SET;
+         goto m68k_op_divs_16_pcdi_done;
+      }
+      m68ki_exception_trap(EXCEPTION_ZERO_DIVIDE);
+   }
+m68k_op_divs_16_pcdi_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_divs_16_pcix:
+   {
+      uint* r_dst = &DX;
+      sint src = MAKE_INT_16(OPER_PCIX_16());
+      sint quotient;
+      sint remainder;
+
+      m68ki_resolve_flags();
+
+      if(src != 0)
+      {
+         if((uint32)*r_dst == 0x80000000 && src == -1)
+         {
+            FLAG_Z = 0;
+            FLAG_N = NFLAG_CLEAR;
+            FLAG_V = VFLAG_CLEAR;
+            FLAG_C = CFLAG_CLEAR;
+            *r_dst = 0;
+            goto m68k_op_divs_16_pcix_done;
+         }
+
+         quotient = MAKE_INT_32(*r_dst) / src;
+         remainder = MAKE_INT_32(*r_dst) % src;
+
+         if(quotient == MAKE_INT_16(quotient))
+         {
+            FLAG_Z = quotient;
+            FLAG_N = NFLAG_16(quotient);
+            FLAG_V = VFLAG_CLEAR;
+            FLAG_C = CFLAG_CLEAR;
+            *r_dst = MASK_OUT_ABOVE_32(MASK_OUT_ABOVE_16(quotient) | (remainder << 16));
+            goto m68k_op_divs_16_pcix_done;
+         }
+         FLAG_V = VFLAG_SET;
+         goto m68k_op_divs_16_pcix_done;
+      }
+      m68ki_exception_trap(EXCEPTION_ZERO_DIVIDE);
+   }
+m68k_op_divs_16_pcix_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_divs_16_i:
+   {
+      uint* r_dst = &DX;
+      sint src = MAKE_INT_16(OPER_I_16());
+      sint quotient;
+      sint remainder;
+
+      m68ki_resolve_flags();
+
+      if(src != 0)
+      {
+         if((uint32)*r_dst == 0x80000000 && src == -1)
+         {
+            FLAG_Z = 0;
+            FLAG_N = NFLAG_CLEAR;
+            FLAG_V = VFLAG_CLEAR;
+            FLAG_C = CFLAG_CLEAR;
+            *r_dst = 0;
+            goto m68k_op_divs_16_i_done;
+         }
+
+         quotient = MAKE_INT_32(*r_dst) / src;
+         remainder = MAKE_INT_32(*r_dst) % src;
+
+         if(quotient == MAKE_INT_16(quotient))
+         {
+            FLAG_Z = quotient;
+            FLAG_N = NFLAG_16(quotient);
+            FLAG_V = VFLAG_CLEAR;
+            FLAG_C = CFLAG_CLEAR;
+            *r_dst = MASK_OUT_ABOVE_32(MASK_OUT_ABOVE_16(quotient) | (remainder << 16));
+            goto m68k_op_divs_16_i_done;
+         }
+         FLAG_V = VFLAG_SET;
+         goto m68k_op_divs_16_i_done;
+      }
+      m68ki_exception_trap(EXCEPTION_ZERO_DIVIDE);
+   }
+m68k_op_divs_16_i_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_divu_16_d:
+   {
+      uint* r_dst = &DX;
+      uint src = MASK_OUT_ABOVE_16(DY);
+
+      m68ki_resolve_flags();
+
+      if(src != 0)
+      {
+         uint quotient = *r_dst / src;
+         uint remainder = *r_dst % src;
+
+         if(quotient < 0x10000)
+         {
+            FLAG_Z = quotient;
+            FLAG_N = NFLAG_16(quotient);
+            FLAG_V = VFLAG_CLEAR;
+            FLAG_C = CFLAG_CLEAR;
+            *r_dst = MASK_OUT_ABOVE_32(MASK_OUT_ABOVE_16(quotient) | (remainder << 16));
+            goto m68k_op_divu_16_d_done;
+         }
+         FLAG_V = VFLAG_SET;
+         goto m68k_op_divu_16_d_done;
+      }
+      m68ki_exception_trap(EXCEPTION_ZERO_DIVIDE);
+   }
+m68k_op_divu_16_d_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_divu_16_ai:
+   {
+      uint* r_dst = &DX;
+      uint src = OPER_AY_AI_16();
+
+      m68ki_resolve_flags();
+
+      if(src != 0)
+      {
+         uint quotient = *r_dst / src;
+         uint remainder = *r_dst % src;
+
+         if(quotient < 0x10000)
+         {
+            FLAG_Z = quotient;
+            FLAG_N = NFLAG_16(quotient);
+            FLAG_V = VFLAG_CLEAR;
+            FLAG_C = CFLAG_CLEAR;
+            *r_dst = MASK_OUT_ABOVE_32(MASK_OUT_ABOVE_16(quotient) | (remainder << 16));
+            goto m68k_op_divu_16_ai_done;
+         }
+         FLAG_V = VFLAG_SET;
+         goto m68k_op_divu_16_ai_done;
+      }
+      m68ki_exception_trap(EXCEPTION_ZERO_DIVIDE);
+   }
+m68k_op_divu_16_ai_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_divu_16_pi:
+   {
+      uint* r_dst = &DX;
+      uint src = OPER_AY_PI_16();
+
+      m68ki_resolve_flags();
+
+      if(src != 0)
+      {
+         uint quotient = *r_dst / src;
+         uint remainder = *r_dst % src;
+
+         if(quotient < 0x10000)
+         {
+            FLAG_Z = quotient;
+            FLAG_N = NFLAG_16(quotient);
+            FLAG_V = VFLAG_CLEAR;
+            FLAG_C = CFLAG_CLEAR;
+            *r_dst = MASK_OUT_ABOVE_32(MASK_OUT_ABOVE_16(quotient) | (remainder << 16));
+            goto m68k_op_divu_16_pi_done;
+         }
+         FLAG_V = VFLAG_SET;
+         goto m68k_op_divu_16_pi_done;
+      }
+      m68ki_exception_trap(EXCEPTION_ZERO_DIVIDE);
+   }
+m68k_op_divu_16_pi_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_divu_16_pd:
+   {
+      uint* r_dst = &DX;
+      uint src = OPER_AY_PD_16();
+
+      m68ki_resolve_flags();
+
+      if(src != 0)
+      {
+         uint quotient = *r_dst / src;
+         uint remainder = *r_dst % src;
+
+         if(quotient < 0x10000)
+         {
+            FLAG_Z = quotient;
+            FLAG_N = NFLAG_16(quotient);
+            FLAG_V = VFLAG_CLEAR;
+            FLAG_C = CFLAG_CLEAR;
+            *r_dst = MASK_OUT_ABOVE_32(MASK_OUT_ABOVE_16(quotient) | (remainder << 16));
+            goto m68k_op_divu_16_pd_done;
+         }
+         FLAG_V = VFLAG_SET;
+         goto m68k_op_divu_16_pd_done;
+      }
+      m68ki_exception_trap(EXCEPTION_ZERO_DIVIDE);
+   }
+m68k_op_divu_16_pd_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_divu_16_di:
+   {
+      uint* r_dst = &DX;
+      uint src = OPER_AY_DI_16();
+
+      m68ki_resolve_flags();
+
+      if(src != 0)
+      {
+         uint quotient = *r_dst / src;
+         uint remainder = *r_dst % src;
+
+         if(quotient < 0x10000)
+         {
+            FLAG_Z = quotient;
+            FLAG_N = NFLAG_16(quotient);
+            FLAG_V = VFLAG_CLEAR;
+            FLAG_C = CFLAG_CLEAR;
+            *r_dst = MASK_OUT_ABOVE_32(MASK_OUT_ABOVE_16(quotient) | (remainder << 16));
+            goto m68k_op_divu_16_di_done;
+         }
+         FLAG_V = VFLAG_SET;
+         goto m68k_op_divu_16_di_done;
+      }
+      m68ki_exception_trap(EXCEPTION_ZERO_DIVIDE);
+   }
+m68k_op_divu_16_di_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_divu_16_ix:
+   {
+      uint* r_dst = &DX;
+      uint src = OPER_AY_IX_16();
+
+      m68ki_resolve_flags();
+
+      if(src != 0)
+      {
+         uint quotient = *r_dst / src;
+         uint remainder = *r_dst % src;
+
+         if(quotient < 0x10000)
+         {
+            FLAG_Z = quotient;
+            FLAG_N = NFLAG_16(quotient);
+            FLAG_V = VFLAG_CLEAR;
+            FLAG_C = CFLAG_CLEAR;
+            *r_dst = MASK_OUT_ABOVE_32(MASK_OUT_ABOVE_16(quotient) | (remainder << 16));
+            goto m68k_op_divu_16_ix_done;
+         }
+         FLAG_V = VFLAG_SET;
+         goto m68k_op_divu_16_ix_done;
+      }
+      m68ki_exception_trap(EXCEPTION_ZERO_DIVIDE);
+   }
+m68k_op_divu_16_ix_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_divu_16_aw:
+   {
+      uint* r_dst = &DX;
+      uint src = OPER_AW_16();
+
+      m68ki_resolve_flags();
+
+      if(src != 0)
+      {
+         uint quotient = *r_dst / src;
+         uint remainder = *r_dst % src;
+
+         if(quotient < 0x10000)
+         {
+            FLAG_Z = quotient;
+            FLAG_N = NFLAG_16(quotient);
+            FLAG_V = VFLAG_CLEAR;
+            FLAG_C = CFLAG_CLEAR;
+            *r_dst = MASK_OUT_ABOVE_32(MASK_OUT_ABOVE_16(quotient) | (remainder << 16));
+            goto m68k_op_divu_16_aw_done;
+         }
+         FLAG_V = VFLAG_SET;
+         goto m68k_op_divu_16_aw_done;
+      }
+      m68ki_exception_trap(EXCEPTION_ZERO_DIVIDE);
+   }
+m68k_op_divu_16_aw_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_divu_16_al:
+   {
+      uint* r_dst = &DX;
+      uint src = OPER_AL_16();
+
+      m68ki_resolve_flags();
+
+      if(src != 0)
+      {
+         uint quotient = *r_dst / src;
+         uint remainder = *r_dst % src;
+
+         if(quotient < 0x10000)
+         {
+            FLAG_Z = quotient;
+            FLAG_N = NFLAG_16(quotient);
+            FLAG_V = VFLAG_CLEAR;
+            FLAG_C = CFLAG_CLEAR;
+            *r_dst = MASK_OUT_ABOVE_32(MASK_OUT_ABOVE_16(quotient) | (remainder << 16));
+            goto m68k_op_divu_16_al_done;
+         }
+         FLAG_V = VFLAG_SET;
+         goto m68k_op_divu_16_al_done;
+      }
+      m68ki_exception_trap(EXCEPTION_ZERO_DIVIDE);
+   }
+m68k_op_divu_16_al_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_divu_16_pcdi:
+   {
+      uint* r_dst = &DX;
+      uint src = OPER_PCDI_16();
+
+      m68ki_resolve_flags();
+
+      if(src != 0)
+      {
+         uint quotient = *r_dst / src;
+         uint remainder = *r_dst % src;
+
+         if(quotient < 0x10000)
+         {
+            FLAG_Z = quotient;
+            FLAG_N = NFLAG_16(quotient);
+            FLAG_V = VFLAG_CLEAR;
+            FLAG_C = CFLAG_CLEAR;
+            *r_dst = MASK_OUT_ABOVE_32(MASK_OUT_ABOVE_16(quotient) | (remainder << 16));
+            goto m68k_op_divu_16_pcdi_done;
+         }
+         FLAG_V = VFLAG_SET;
+         goto m68k_op_divu_16_pcdi_done;
+      }
+      m68ki_exception_trap(EXCEPTION_ZERO_DIVIDE);
+   }
+m68k_op_divu_16_pcdi_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_divu_16_pcix:
+   {
+      uint* r_dst = &DX;
+      uint src = OPER_PCIX_16();
+
+      m68ki_resolve_flags();
+
+      if(src != 0)
+      {
+         uint quotient = *r_dst / src;
+         uint remainder = *r_dst % src;
+
+         if(quotient < 0x10000)
+         {
+            FLAG_Z = quotient;
+            FLAG_N = NFLAG_16(quotient);
+            FLAG_V = VFLAG_CLEAR;
+            FLAG_C = CFLAG_CLEAR;
+            *r_dst = MASK_OUT_ABOVE_32(MASK_OUT_ABOVE_16(quotient) | (remainder << 16));
+            goto m68k_op_divu_16_pcix_done;
+         }
+         FLAG_V = VFLAG_SET;
+         goto m68k_op_divu_16_pcix_done;
+      }
+      m68ki_exception_trap(EXCEPTION_ZERO_DIVIDE);
+   }
+m68k_op_divu_16_pcix_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_divu_16_i:
+   {
+      uint* r_dst = &DX;
+      uint src = OPER_I_16();
+
+      m68ki_resolve_flags();
+
+      if(src != 0)
+      {
+         uint quotient = *r_dst / src;
+         uint remainder = *r_dst % src;
+
+         if(quotient < 0x10000)
+         {
+            FLAG_Z = quotient;
+            FLAG_N = NFLAG_16(quotient);
+            FLAG_V = VFLAG_CLEAR;
+            FLAG_C = CFLAG_CLEAR;
+            *r_dst = MASK_OUT_ABOVE_32(MASK_OUT_ABOVE_16(quotient) | (remainder << 16));
+            goto m68k_op_divu_16_i_done;
+         }
+         FLAG_V = VFLAG_SET;
+         goto m68k_op_divu_16_i_done;
+      }
+      m68ki_exception_trap(EXCEPTION_ZERO_DIVIDE);
+   }
+m68k_op_divu_16_i_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_divl_32_d:
+   {
+      m68ki_resolve_flags();
+   #if M68K_USE_64_BIT
+
+      if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+      {
+         uint word2 = OPER_I_16();
+         uint64 divisor   = DY;
+         uint64 dividend  = 0;
+         uint64 quotient  = 0;
+         uint64 remainder = 0;
+
+         if(divisor != 0)
+         {
+            if(BIT_A(word2))	/* 64 bit */
+            {
+               dividend = REG_D[word2 & 7];
+               dividend <<= 32;
+               dividend |= REG_D[(word2 >> 12) & 7];
+
+               if(BIT_B(word2))	   /* signed */
+               {
+                  quotient  = (uint64)((sint64)dividend / (sint64)((sint32)divisor));
+                  remainder = (uint64)((sint64)dividend % (sint64)((sint32)divisor));
+                  if((sint64)quotient != (sint64)((sint32)quotient))
+                  {
+                     FLAG_V = VFLAG_SET;
+                     goto m68k_op_divl_32_d_done;
+                  }
+               }
+               else					/* unsigned */
+               {
+                  quotient = dividend / divisor;
+                  if(quotient > 0xffffffff)
+                  {
+                     FLAG_V = VFLAG_SET;
+                     goto m68k_op_divl_32_d_done;
+                  }
+                  remainder = dividend % divisor;
+               }
+            }
+            else	/* 32 bit */
+            {
+               dividend = REG_D[(word2 >> 12) & 7];
+               if(BIT_B(word2))	   /* signed */
+               {
+                  quotient  = (uint64)((sint64)((sint32)dividend) / (sint64)((sint32)divisor));
+                  remainder = (uint64)((sint64)((sint32)dividend) % (sint64)((sint32)divisor));
+               }
+               else					/* unsigned */
+               {
+                  quotient = dividend / divisor;
+                  remainder = dividend % divisor;
+               }
+            }
+
+            REG_D[word2 & 7] = remainder;
+            REG_D[(word2 >> 12) & 7] = quotient;
+
+            FLAG_N = NFLAG_32(quotient);
+            FLAG_Z = quotient;
+            FLAG_V = VFLAG_CLEAR;
+            FLAG_C = CFLAG_CLEAR;
+            goto m68k_op_divl_32_d_done;
+         }
+         m68ki_exception_trap(EXCEPTION_ZERO_DIVIDE);
+         goto m68k_op_divl_32_d_done;
+      }
+      m68ki_exception_illegal();
+
+   #else
+
+      if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+      {
+         uint word2 = OPER_I_16();
+         uint divisor = DY;
+         uint dividend_hi = REG_D[word2 & 7];
+         uint dividend_lo = REG_D[(word2 >> 12) & 7];
+         uint quotient = 0;
+         uint remainder = 0;
+         uint dividend_neg = 0;
+         uint divisor_neg = 0;
+         sint i;
+         uint overflow;
+
+         if(divisor != 0)
+         {
+            /* quad / long : long quotient, long remainder */
+            if(BIT_A(word2))
+            {
+               if(BIT_B(word2))	   /* signed */
+               {
+                  /* special case in signed divide */
+                  if(dividend_hi == 0 && dividend_lo == 0x80000000 && divisor == 0xffffffff)
+                  {
+                     REG_D[word2 & 7] = 0;
+                     REG_D[(word2 >> 12) & 7] = 0x80000000;
+
+                     FLAG_N = NFLAG_SET;
+                     FLAG_Z = ZFLAG_CLEAR;
+                     FLAG_V = VFLAG_CLEAR;
+                     FLAG_C = CFLAG_CLEAR;
+                     goto m68k_op_divl_32_d_done;
+                  }
+                  if(GET_MSB_32(dividend_hi))
+                  {
+                     dividend_neg = 1;
+                     dividend_hi = (uint)MASK_OUT_ABOVE_32((-(sint)dividend_hi) - (dividend_lo != 0));
+                     dividend_lo = (uint)MASK_OUT_ABOVE_32(-(sint)dividend_lo);
+                  }
+                  if(GET_MSB_32(divisor))
+                  {
+                     divisor_neg = 1;
+                     divisor = (uint)MASK_OUT_ABOVE_32(-(sint)divisor);
+
+                  }
+               }
+
+               /* if the upper long is greater than the divisor, we're overflowing. */
+               if(dividend_hi >= divisor)
+               {
+                  FLAG_V = VFLAG_SET;
+                  goto m68k_op_divl_32_d_done;
+               }
+
+               for(i = 31; i >= 0; i--)
+               {
+                  quotient <<= 1;
+                  remainder = (remainder << 1) + ((dividend_hi >> i) & 1);
+                  if(remainder >= divisor)
+                  {
+                     remainder -= divisor;
+                     quotient++;
+                  }
+               }
+               for(i = 31; i >= 0; i--)
+               {
+                  quotient <<= 1;
+                  overflow = GET_MSB_32(remainder);
+                  remainder = (remainder << 1) + ((dividend_lo >> i) & 1);
+                  if(remainder >= divisor || overflow)
+                  {
+                     remainder -= divisor;
+                     quotient++;
+                  }
+               }
+
+               if(BIT_B(word2))	   /* signed */
+               {
+                  if(quotient > 0x7fffffff)
+                  {
+                     FLAG_V = VFLAG_SET;
+                     goto m68k_op_divl_32_d_done;
+                  }
+                  if(dividend_neg)
+                  {
+                     remainder = (uint)MASK_OUT_ABOVE_32(-(sint)remainder);
+                     quotient = (uint)MASK_OUT_ABOVE_32(-(sint)quotient);
+                  }
+                  if(divisor_neg)
+                     quotient = (uint)MASK_OUT_ABOVE_32(-(sint)quotient);
+               }
+
+               REG_D[word2 & 7] = remainder;
+               REG_D[(word2 >> 12) & 7] = quotient;
+
+               FLAG_N = NFLAG_32(quotient);
+               FLAG_Z = quotient;
+               FLAG_V = VFLAG_CLEAR;
+               FLAG_C = CFLAG_CLEAR;
+               goto m68k_op_divl_32_d_done;
+            }
+
+            /* long / long: long quotient, maybe long remainder */
+            if(BIT_B(word2))	   /* signed */
+            {
+               /* Special case in divide */
+               if(dividend_lo == 0x80000000 && divisor == 0xffffffff)
+               {
+                  FLAG_N = NFLAG_SET;
+                  FLAG_Z = ZFLAG_CLEAR;
+                  FLAG_V = VFLAG_CLEAR;
+                  FLAG_C = CFLAG_CLEAR;
+                  REG_D[(word2 >> 12) & 7] = 0x80000000;
+                  REG_D[word2 & 7] = 0;
+                  goto m68k_op_divl_32_d_done;
+               }
+               REG_D[word2 & 7] = MAKE_INT_32(dividend_lo) % MAKE_INT_32(divisor);
+               quotient = REG_D[(word2 >> 12) & 7] = MAKE_INT_32(dividend_lo) / MAKE_INT_32(divisor);
+            }
+            else
+            {
+               REG_D[word2 & 7] = MASK_OUT_ABOVE_32(dividend_lo) % MASK_OUT_ABOVE_32(divisor);
+               quotient = REG_D[(word2 >> 12) & 7] = MASK_OUT_ABOVE_32(dividend_lo) / MASK_OUT_ABOVE_32(divisor);
+            }
+
+            FLAG_N = NFLAG_32(quotient);
+            FLAG_Z = quotient;
+            FLAG_V = VFLAG_CLEAR;
+            FLAG_C = CFLAG_CLEAR;
+            goto m68k_op_divl_32_d_done;
+         }
+         m68ki_exception_trap(EXCEPTION_ZERO_DIVIDE);
+         goto m68k_op_divl_32_d_done;
+      }
+      m68ki_exception_illegal();
+
+   #endif
+   }
+m68k_op_divl_32_d_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_divl_32_ai:
+   {
+      m68ki_resolve_flags();
+   #if M68K_USE_64_BIT
+
+      if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+      {
+         uint word2 = OPER_I_16();
+         uint64 divisor = OPER_AY_AI_32();
+         uint64 dividend  = 0;
+         uint64 quotient  = 0;
+         uint64 remainder = 0;
+
+         if(divisor != 0)
+         {
+            if(BIT_A(word2))	/* 64 bit */
+            {
+               dividend = REG_D[word2 & 7];
+               dividend <<= 32;
+               dividend |= REG_D[(word2 >> 12) & 7];
+
+               if(BIT_B(word2))	   /* signed */
+               {
+                  quotient  = (uint64)((sint64)dividend / (sint64)((sint32)divisor));
+                  remainder = (uint64)((sint64)dividend % (sint64)((sint32)divisor));
+                  if((sint64)quotient != (sint64)((sint32)quotient))
+                  {
+                     FLAG_V = VFLAG_SET;
+                     goto m68k_op_divl_32_ai_done;
+                  }
+               }
+               else					/* unsigned */
+               {
+                  quotient = dividend / divisor;
+                  if(quotient > 0xffffffff)
+                  {
+                     FLAG_V = VFLAG_SET;
+                     goto m68k_op_divl_32_ai_done;
+                  }
+                  remainder = dividend % divisor;
+               }
+            }
+            else	/* 32 bit */
+            {
+               dividend = REG_D[(word2 >> 12) & 7];
+               if(BIT_B(word2))	   /* signed */
+               {
+                  quotient  = (uint64)((sint64)((sint32)dividend) / (sint64)((sint32)divisor));
+                  remainder = (uint64)((sint64)((sint32)dividend) % (sint64)((sint32)divisor));
+               }
+               else					/* unsigned */
+               {
+                  quotient = dividend / divisor;
+                  remainder = dividend % divisor;
+               }
+            }
+
+            REG_D[word2 & 7] = remainder;
+            REG_D[(word2 >> 12) & 7] = quotient;
+
+            FLAG_N = NFLAG_32(quotient);
+            FLAG_Z = quotient;
+            FLAG_V = VFLAG_CLEAR;
+            FLAG_C = CFLAG_CLEAR;
+            goto m68k_op_divl_32_ai_done;
+         }
+         m68ki_exception_trap(EXCEPTION_ZERO_DIVIDE);
+         goto m68k_op_divl_32_ai_done;
+      }
+      m68ki_exception_illegal();
+
+   #else
+
+      if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+      {
+         uint word2 = OPER_I_16();
+         uint divisor = OPER_AY_AI_32();
+         uint dividend_hi = REG_D[word2 & 7];
+         uint dividend_lo = REG_D[(word2 >> 12) & 7];
+         uint quotient = 0;
+         uint remainder = 0;
+         uint dividend_neg = 0;
+         uint divisor_neg = 0;
+         sint i;
+         uint overflow;
+
+         if(divisor != 0)
+         {
+            /* quad / long : long quotient, long remainder */
+            if(BIT_A(word2))
+            {
+               if(BIT_B(word2))	   /* signed */
+               {
+                  /* special case in signed divide */
+                  if(dividend_hi == 0 && dividend_lo == 0x80000000 && divisor == 0xffffffff)
+                  {
+                     REG_D[word2 & 7] = 0;
+                     REG_D[(word2 >> 12) & 7] = 0x80000000;
+
+                     FLAG_N = NFLAG_SET;
+                     FLAG_Z = ZFLAG_CLEAR;
+                     FLAG_V = VFLAG_CLEAR;
+                     FLAG_C = CFLAG_CLEAR;
+                     goto m68k_op_divl_32_ai_done;
+                  }
+                  if(GET_MSB_32(dividend_hi))
+                  {
+                     dividend_neg = 1;
+                     dividend_hi = (uint)MASK_OUT_ABOVE_32((-(sint)dividend_hi) - (dividend_lo != 0));
+                     dividend_lo = (uint)MASK_OUT_ABOVE_32(-(sint)dividend_lo);
+                  }
+                  if(GET_MSB_32(divisor))
+                  {
+                     divisor_neg = 1;
+                     divisor = (uint)MASK_OUT_ABOVE_32(-(sint)divisor);
+
+                  }
+               }
+
+               /* if the upper long is greater than the divisor, we're overflowing. */
+               if(dividend_hi >= divisor)
+               {
+                  FLAG_V = VFLAG_SET;
+                  goto m68k_op_divl_32_ai_done;
+               }
+
+               for(i = 31; i >= 0; i--)
+               {
+                  quotient <<= 1;
+                  remainder = (remainder << 1) + ((dividend_hi >> i) & 1);
+                  if(remainder >= divisor)
+                  {
+                     remainder -= divisor;
+                     quotient++;
+                  }
+               }
+               for(i = 31; i >= 0; i--)
+               {
+                  quotient <<= 1;
+                  overflow = GET_MSB_32(remainder);
+                  remainder = (remainder << 1) + ((dividend_lo >> i) & 1);
+                  if(remainder >= divisor || overflow)
+                  {
+                     remainder -= divisor;
+                     quotient++;
+                  }
+               }
+
+               if(BIT_B(word2))	   /* signed */
+               {
+                  if(quotient > 0x7fffffff)
+                  {
+                     FLAG_V = VFLAG_SET;
+                     goto m68k_op_divl_32_ai_done;
+                  }
+                  if(dividend_neg)
+                  {
+                     remainder = (uint)MASK_OUT_ABOVE_32(-(sint)remainder);
+                     quotient = (uint)MASK_OUT_ABOVE_32(-(sint)quotient);
+                  }
+                  if(divisor_neg)
+                     quotient = (uint)MASK_OUT_ABOVE_32(-(sint)quotient);
+               }
+
+               REG_D[word2 & 7] = remainder;
+               REG_D[(word2 >> 12) & 7] = quotient;
+
+               FLAG_N = NFLAG_32(quotient);
+               FLAG_Z = quotient;
+               FLAG_V = VFLAG_CLEAR;
+               FLAG_C = CFLAG_CLEAR;
+               goto m68k_op_divl_32_ai_done;
+            }
+
+            /* long / long: long quotient, maybe long remainder */
+            if(BIT_B(word2))	   /* signed */
+            {
+               /* Special case in divide */
+               if(dividend_lo == 0x80000000 && divisor == 0xffffffff)
+               {
+                  FLAG_N = NFLAG_SET;
+                  FLAG_Z = ZFLAG_CLEAR;
+                  FLAG_V = VFLAG_CLEAR;
+                  FLAG_C = CFLAG_CLEAR;
+                  REG_D[(word2 >> 12) & 7] = 0x80000000;
+                  REG_D[word2 & 7] = 0;
+                  goto m68k_op_divl_32_ai_done;
+               }
+               REG_D[word2 & 7] = MAKE_INT_32(dividend_lo) % MAKE_INT_32(divisor);
+               quotient = REG_D[(word2 >> 12) & 7] = MAKE_INT_32(dividend_lo) / MAKE_INT_32(divisor);
+            }
+            else
+            {
+               REG_D[word2 & 7] = MASK_OUT_ABOVE_32(dividend_lo) % MASK_OUT_ABOVE_32(divisor);
+               quotient = REG_D[(word2 >> 12) & 7] = MASK_OUT_ABOVE_32(dividend_lo) / MASK_OUT_ABOVE_32(divisor);
+            }
+
+            FLAG_N = NFLAG_32(quotient);
+            FLAG_Z = quotient;
+            FLAG_V = VFLAG_CLEAR;
+            FLAG_C = CFLAG_CLEAR;
+            goto m68k_op_divl_32_ai_done;
+         }
+         m68ki_exception_trap(EXCEPTION_ZERO_DIVIDE);
+         goto m68k_op_divl_32_ai_done;
+      }
+      m68ki_exception_illegal();
+
+   #endif
+   }
+m68k_op_divl_32_ai_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_divl_32_pi:
+   {
+      m68ki_resolve_flags();
+   #if M68K_USE_64_BIT
+
+      if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+      {
+         uint word2 = OPER_I_16();
+         uint64 divisor = OPER_AY_PI_32();
+         uint64 dividend  = 0;
+         uint64 quotient  = 0;
+         uint64 remainder = 0;
+
+         if(divisor != 0)
+         {
+            if(BIT_A(word2))	/* 64 bit */
+            {
+               dividend = REG_D[word2 & 7];
+               dividend <<= 32;
+               dividend |= REG_D[(word2 >> 12) & 7];
+
+               if(BIT_B(word2))	   /* signed */
+               {
+                  quotient  = (uint64)((sint64)dividend / (sint64)((sint32)divisor));
+                  remainder = (uint64)((sint64)dividend % (sint64)((sint32)divisor));
+                  if((sint64)quotient != (sint64)((sint32)quotient))
+                  {
+                     FLAG_V = VFLAG_SET;
+                     goto m68k_op_divl_32_pi_done;
+                  }
+               }
+               else					/* unsigned */
+               {
+                  quotient = dividend / divisor;
+                  if(quotient > 0xffffffff)
+                  {
+                     FLAG_V = VFLAG_SET;
+                     goto m68k_op_divl_32_pi_done;
+                  }
+                  remainder = dividend % divisor;
+               }
+            }
+            else	/* 32 bit */
+            {
+               dividend = REG_D[(word2 >> 12) & 7];
+               if(BIT_B(word2))	   /* signed */
+               {
+                  quotient  = (uint64)((sint64)((sint32)dividend) / (sint64)((sint32)divisor));
+                  remainder = (uint64)((sint64)((sint32)dividend) % (sint64)((sint32)divisor));
+               }
+               else					/* unsigned */
+               {
+                  quotient = dividend / divisor;
+                  remainder = dividend % divisor;
+               }
+            }
+
+            REG_D[word2 & 7] = remainder;
+            REG_D[(word2 >> 12) & 7] = quotient;
+
+            FLAG_N = NFLAG_32(quotient);
+            FLAG_Z = quotient;
+            FLAG_V = VFLAG_CLEAR;
+            FLAG_C = CFLAG_CLEAR;
+            goto m68k_op_divl_32_pi_done;
+         }
+         m68ki_exception_trap(EXCEPTION_ZERO_DIVIDE);
+         goto m68k_op_divl_32_pi_done;
+      }
+      m68ki_exception_illegal();
+
+   #else
+
+      if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+      {
+         uint word2 = OPER_I_16();
+         uint divisor = OPER_AY_PI_32();
+         uint dividend_hi = REG_D[word2 & 7];
+         uint dividend_lo = REG_D[(word2 >> 12) & 7];
+         uint quotient = 0;
+         uint remainder = 0;
+         uint dividend_neg = 0;
+         uint divisor_neg = 0;
+         sint i;
+         uint overflow;
+
+         if(divisor != 0)
+         {
+            /* quad / long : long quotient, long remainder */
+            if(BIT_A(word2))
+            {
+               if(BIT_B(word2))	   /* signed */
+               {
+                  /* special case in signed divide */
+                  if(dividend_hi == 0 && dividend_lo == 0x80000000 && divisor == 0xffffffff)
+                  {
+                     REG_D[word2 & 7] = 0;
+                     REG_D[(word2 >> 12) & 7] = 0x80000000;
+
+                     FLAG_N = NFLAG_SET;
+                     FLAG_Z = ZFLAG_CLEAR;
+                     FLAG_V = VFLAG_CLEAR;
+                     FLAG_C = CFLAG_CLEAR;
+                     goto m68k_op_divl_32_pi_done;
+                  }
+                  if(GET_MSB_32(dividend_hi))
+                  {
+                     dividend_neg = 1;
+                     dividend_hi = (uint)MASK_OUT_ABOVE_32((-(sint)dividend_hi) - (dividend_lo != 0));
+                     dividend_lo = (uint)MASK_OUT_ABOVE_32(-(sint)dividend_lo);
+                  }
+                  if(GET_MSB_32(divisor))
+                  {
+                     divisor_neg = 1;
+                     divisor = (uint)MASK_OUT_ABOVE_32(-(sint)divisor);
+
+                  }
+               }
+
+               /* if the upper long is greater than the divisor, we're overflowing. */
+               if(dividend_hi >= divisor)
+               {
+                  FLAG_V = VFLAG_SET;
+                  goto m68k_op_divl_32_pi_done;
+               }
+
+               for(i = 31; i >= 0; i--)
+               {
+                  quotient <<= 1;
+                  remainder = (remainder << 1) + ((dividend_hi >> i) & 1);
+                  if(remainder >= divisor)
+                  {
+                     remainder -= divisor;
+                     quotient++;
+                  }
+               }
+               for(i = 31; i >= 0; i--)
+               {
+                  quotient <<= 1;
+                  overflow = GET_MSB_32(remainder);
+                  remainder = (remainder << 1) + ((dividend_lo >> i) & 1);
+                  if(remainder >= divisor || overflow)
+                  {
+                     remainder -= divisor;
+                     quotient++;
+                  }
+               }
+
+               if(BIT_B(word2))	   /* signed */
+               {
+                  if(quotient > 0x7fffffff)
+                  {
+                     FLAG_V = VFLAG_SET;
+                     goto m68k_op_divl_32_pi_done;
+                  }
+                  if(dividend_neg)
+                  {
+                     remainder = (uint)MASK_OUT_ABOVE_32(-(sint)remainder);
+                     quotient = (uint)MASK_OUT_ABOVE_32(-(sint)quotient);
+                  }
+                  if(divisor_neg)
+                     quotient = (uint)MASK_OUT_ABOVE_32(-(sint)quotient);
+               }
+
+               REG_D[word2 & 7] = remainder;
+               REG_D[(word2 >> 12) & 7] = quotient;
+
+               FLAG_N = NFLAG_32(quotient);
+               FLAG_Z = quotient;
+               FLAG_V = VFLAG_CLEAR;
+               FLAG_C = CFLAG_CLEAR;
+               goto m68k_op_divl_32_pi_done;
+            }
+
+            /* long / long: long quotient, maybe long remainder */
+            if(BIT_B(word2))	   /* signed */
+            {
+               /* Special case in divide */
+               if(dividend_lo == 0x80000000 && divisor == 0xffffffff)
+               {
+                  FLAG_N = NFLAG_SET;
+                  FLAG_Z = ZFLAG_CLEAR;
+                  FLAG_V = VFLAG_CLEAR;
+                  FLAG_C = CFLAG_CLEAR;
+                  REG_D[(word2 >> 12) & 7] = 0x80000000;
+                  REG_D[word2 & 7] = 0;
+                  goto m68k_op_divl_32_pi_done;
+               }
+               REG_D[word2 & 7] = MAKE_INT_32(dividend_lo) % MAKE_INT_32(divisor);
+               quotient = REG_D[(word2 >> 12) & 7] = MAKE_INT_32(dividend_lo) / MAKE_INT_32(divisor);
+            }
+            else
+            {
+               REG_D[word2 & 7] = MASK_OUT_ABOVE_32(dividend_lo) % MASK_OUT_ABOVE_32(divisor);
+               quotient = REG_D[(word2 >> 12) & 7] = MASK_OUT_ABOVE_32(dividend_lo) / MASK_OUT_ABOVE_32(divisor);
+            }
+
+            FLAG_N = NFLAG_32(quotient);
+            FLAG_Z = quotient;
+            FLAG_V = VFLAG_CLEAR;
+            FLAG_C = CFLAG_CLEAR;
+            goto m68k_op_divl_32_pi_done;
+         }
+         m68ki_exception_trap(EXCEPTION_ZERO_DIVIDE);
+         goto m68k_op_divl_32_pi_done;
+      }
+      m68ki_exception_illegal();
+
+   #endif
+   }
+m68k_op_divl_32_pi_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_divl_32_pd:
+   {
+      m68ki_resolve_flags();
+   #if M68K_USE_64_BIT
+
+      if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+      {
+         uint word2 = OPER_I_16();
+         uint64 divisor = OPER_AY_PD_32();
+         uint64 dividend  = 0;
+         uint64 quotient  = 0;
+         uint64 remainder = 0;
+
+         if(divisor != 0)
+         {
+            if(BIT_A(word2))	/* 64 bit */
+            {
+               dividend = REG_D[word2 & 7];
+               dividend <<= 32;
+               dividend |= REG_D[(word2 >> 12) & 7];
+
+               if(BIT_B(word2))	   /* signed */
+               {
+                  quotient  = (uint64)((sint64)dividend / (sint64)((sint32)divisor));
+                  remainder = (uint64)((sint64)dividend % (sint64)((sint32)divisor));
+                  if((sint64)quotient != (sint64)((sint32)quotient))
+                  {
+                     FLAG_V = VFLAG_SET;
+                     goto m68k_op_divl_32_pd_done;
+                  }
+               }
+               else					/* unsigned */
+               {
+                  quotient = dividend / divisor;
+                  if(quotient > 0xffffffff)
+                  {
+                     FLAG_V = VFLAG_SET;
+                     goto m68k_op_divl_32_pd_done;
+                  }
+                  remainder = dividend % divisor;
+               }
+            }
+            else	/* 32 bit */
+            {
+               dividend = REG_D[(word2 >> 12) & 7];
+               if(BIT_B(word2))	   /* signed */
+               {
+                  quotient  = (uint64)((sint64)((sint32)dividend) / (sint64)((sint32)divisor));
+                  remainder = (uint64)((sint64)((sint32)dividend) % (sint64)((sint32)divisor));
+               }
+               else					/* unsigned */
+               {
+                  quotient = dividend / divisor;
+                  remainder = dividend % divisor;
+               }
+            }
+
+            REG_D[word2 & 7] = remainder;
+            REG_D[(word2 >> 12) & 7] = quotient;
+
+            FLAG_N = NFLAG_32(quotient);
+            FLAG_Z = quotient;
+            FLAG_V = VFLAG_CLEAR;
+            FLAG_C = CFLAG_CLEAR;
+            goto m68k_op_divl_32_pd_done;
+         }
+         m68ki_exception_trap(EXCEPTION_ZERO_DIVIDE);
+         goto m68k_op_divl_32_pd_done;
+      }
+      m68ki_exception_illegal();
+
+   #else
+
+      if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+      {
+         uint word2 = OPER_I_16();
+         uint divisor = OPER_AY_PD_32();
+         uint dividend_hi = REG_D[word2 & 7];
+         uint dividend_lo = REG_D[(word2 >> 12) & 7];
+         uint quotient = 0;
+         uint remainder = 0;
+         uint dividend_neg = 0;
+         uint divisor_neg = 0;
+         sint i;
+         uint overflow;
+
+         if(divisor != 0)
+         {
+            /* quad / long : long quotient, long remainder */
+            if(BIT_A(word2))
+            {
+               if(BIT_B(word2))	   /* signed */
+               {
+                  /* special case in signed divide */
+                  if(dividend_hi == 0 && dividend_lo == 0x80000000 && divisor == 0xffffffff)
+                  {
+                     REG_D[word2 & 7] = 0;
+                     REG_D[(word2 >> 12) & 7] = 0x80000000;
+
+                     FLAG_N = NFLAG_SET;
+                     FLAG_Z = ZFLAG_CLEAR;
+                     FLAG_V = VFLAG_CLEAR;
+                     FLAG_C = CFLAG_CLEAR;
+                     goto m68k_op_divl_32_pd_done;
+                  }
+                  if(GET_MSB_32(dividend_hi))
+                  {
+                     dividend_neg = 1;
+                     dividend_hi = (uint)MASK_OUT_ABOVE_32((-(sint)dividend_hi) - (dividend_lo != 0));
+                     dividend_lo = (uint)MASK_OUT_ABOVE_32(-(sint)dividend_lo);
+                  }
+                  if(GET_MSB_32(divisor))
+                  {
+                     divisor_neg = 1;
+                     divisor = (uint)MASK_OUT_ABOVE_32(-(sint)divisor);
+
+                  }
+               }
+
+               /* if the upper long is greater than the divisor, we're overflowing. */
+               if(dividend_hi >= divisor)
+               {
+                  FLAG_V = VFLAG_SET;
+                  goto m68k_op_divl_32_pd_done;
+               }
+
+               for(i = 31; i >= 0; i--)
+               {
+                  quotient <<= 1;
+                  remainder = (remainder << 1) + ((dividend_hi >> i) & 1);
+                  if(remainder >= divisor)
+                  {
+                     remainder -= divisor;
+                     quotient++;
+                  }
+               }
+               for(i = 31; i >= 0; i--)
+               {
+                  quotient <<= 1;
+                  overflow = GET_MSB_32(remainder);
+                  remainder = (remainder << 1) + ((dividend_lo >> i) & 1);
+                  if(remainder >= divisor || overflow)
+                  {
+                     remainder -= divisor;
+                     quotient++;
+                  }
+               }
+
+               if(BIT_B(word2))	   /* signed */
+               {
+                  if(quotient > 0x7fffffff)
+                  {
+                     FLAG_V = VFLAG_SET;
+                     goto m68k_op_divl_32_pd_done;
+                  }
+                  if(dividend_neg)
+                  {
+                     remainder = (uint)MASK_OUT_ABOVE_32(-(sint)remainder);
+                     quotient = (uint)MASK_OUT_ABOVE_32(-(sint)quotient);
+                  }
+                  if(divisor_neg)
+                     quotient = (uint)MASK_OUT_ABOVE_32(-(sint)quotient);
+               }
+
+               REG_D[word2 & 7] = remainder;
+               REG_D[(word2 >> 12) & 7] = quotient;
+
+               FLAG_N = NFLAG_32(quotient);
+               FLAG_Z = quotient;
+               FLAG_V = VFLAG_CLEAR;
+               FLAG_C = CFLAG_CLEAR;
+               goto m68k_op_divl_32_pd_done;
+            }
+
+            /* long / long: long quotient, maybe long remainder */
+            if(BIT_B(word2))	   /* signed */
+            {
+               /* Special case in divide */
+               if(dividend_lo == 0x80000000 && divisor == 0xffffffff)
+               {
+                  FLAG_N = NFLAG_SET;
+                  FLAG_Z = ZFLAG_CLEAR;
+                  FLAG_V = VFLAG_CLEAR;
+                  FLAG_C = CFLAG_CLEAR;
+                  REG_D[(word2 >> 12) & 7] = 0x80000000;
+                  REG_D[word2 & 7] = 0;
+                  goto m68k_op_divl_32_pd_done;
+               }
+               REG_D[word2 & 7] = MAKE_INT_32(dividend_lo) % MAKE_INT_32(divisor);
+               quotient = REG_D[(word2 >> 12) & 7] = MAKE_INT_32(dividend_lo) / MAKE_INT_32(divisor);
+            }
+            else
+            {
+               REG_D[word2 & 7] = MASK_OUT_ABOVE_32(dividend_lo) % MASK_OUT_ABOVE_32(divisor);
+               quotient = REG_D[(word2 >> 12) & 7] = MASK_OUT_ABOVE_32(dividend_lo) / MASK_OUT_ABOVE_32(divisor);
+            }
+
+            FLAG_N = NFLAG_32(quotient);
+            FLAG_Z = quotient;
+            FLAG_V = VFLAG_CLEAR;
+            FLAG_C = CFLAG_CLEAR;
+            goto m68k_op_divl_32_pd_done;
+         }
+         m68ki_exception_trap(EXCEPTION_ZERO_DIVIDE);
+         goto m68k_op_divl_32_pd_done;
+      }
+      m68ki_exception_illegal();
+
+   #endif
+   }
+m68k_op_divl_32_pd_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_divl_32_di:
+   {
+      m68ki_resolve_flags();
+   #if M68K_USE_64_BIT
+
+      if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+      {
+         uint word2 = OPER_I_16();
+         uint64 divisor = OPER_AY_DI_32();
+         uint64 dividend  = 0;
+         uint64 quotient  = 0;
+         uint64 remainder = 0;
+
+         if(divisor != 0)
+         {
+            if(BIT_A(word2))	/* 64 bit */
+            {
+               dividend = REG_D[word2 & 7];
+               dividend <<= 32;
+               dividend |= REG_D[(word2 >> 12) & 7];
+
+               if(BIT_B(word2))	   /* signed */
+               {
+                  quotient  = (uint64)((sint64)dividend / (sint64)((sint32)divisor));
+                  remainder = (uint64)((sint64)dividend % (sint64)((sint32)divisor));
+                  if((sint64)quotient != (sint64)((sint32)quotient))
+                  {
+                     FLAG_V = VFLAG_SET;
+                     goto m68k_op_divl_32_di_done;
+                  }
+               }
+               else					/* unsigned */
+               {
+                  quotient = dividend / divisor;
+                  if(quotient > 0xffffffff)
+                  {
+                     FLAG_V = VFLAG_SET;
+                     goto m68k_op_divl_32_di_done;
+                  }
+                  remainder = dividend % divisor;
+               }
+            }
+            else	/* 32 bit */
+            {
+               dividend = REG_D[(word2 >> 12) & 7];
+               if(BIT_B(word2))	   /* signed */
+               {
+                  quotient  = (uint64)((sint64)((sint32)dividend) / (sint64)((sint32)divisor));
+                  remainder = (uint64)((sint64)((sint32)dividend) % (sint64)((sint32)divisor));
+               }
+               else					/* unsigned */
+               {
+                  quotient = dividend / divisor;
+                  remainder = dividend % divisor;
+               }
+            }
+
+            REG_D[word2 & 7] = remainder;
+            REG_D[(word2 >> 12) & 7] = quotient;
+
+            FLAG_N = NFLAG_32(quotient);
+            FLAG_Z = quotient;
+            FLAG_V = VFLAG_CLEAR;
+            FLAG_C = CFLAG_CLEAR;
+            goto m68k_op_divl_32_di_done;
+         }
+         m68ki_exception_trap(EXCEPTION_ZERO_DIVIDE);
+         goto m68k_op_divl_32_di_done;
+      }
+      m68ki_exception_illegal();
+
+   #else
+
+      if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+      {
+         uint word2 = OPER_I_16();
+         uint divisor = OPER_AY_DI_32();
+         uint dividend_hi = REG_D[word2 & 7];
+         uint dividend_lo = REG_D[(word2 >> 12) & 7];
+         uint quotient = 0;
+         uint remainder = 0;
+         uint dividend_neg = 0;
+         uint divisor_neg = 0;
+         sint i;
+         uint overflow;
+
+         if(divisor != 0)
+         {
+            /* quad / long : long quotient, long remainder */
+            if(BIT_A(word2))
+            {
+               if(BIT_B(word2))	   /* signed */
+               {
+                  /* special case in signed divide */
+                  if(dividend_hi == 0 && dividend_lo == 0x80000000 && divisor == 0xffffffff)
+                  {
+                     REG_D[word2 & 7] = 0;
+                     REG_D[(word2 >> 12) & 7] = 0x80000000;
+
+                     FLAG_N = NFLAG_SET;
+                     FLAG_Z = ZFLAG_CLEAR;
+                     FLAG_V = VFLAG_CLEAR;
+                     FLAG_C = CFLAG_CLEAR;
+                     goto m68k_op_divl_32_di_done;
+                  }
+                  if(GET_MSB_32(dividend_hi))
+                  {
+                     dividend_neg = 1;
+                     dividend_hi = (uint)MASK_OUT_ABOVE_32((-(sint)dividend_hi) - (dividend_lo != 0));
+                     dividend_lo = (uint)MASK_OUT_ABOVE_32(-(sint)dividend_lo);
+                  }
+                  if(GET_MSB_32(divisor))
+                  {
+                     divisor_neg = 1;
+                     divisor = (uint)MASK_OUT_ABOVE_32(-(sint)divisor);
+
+                  }
+               }
+
+               /* if the upper long is greater than the divisor, we're overflowing. */
+               if(dividend_hi >= divisor)
+               {
+                  FLAG_V = VFLAG_SET;
+                  goto m68k_op_divl_32_di_done;
+               }
+
+               for(i = 31; i >= 0; i--)
+               {
+                  quotient <<= 1;
+                  remainder = (remainder << 1) + ((dividend_hi >> i) & 1);
+                  if(remainder >= divisor)
+                  {
+                     remainder -= divisor;
+                     quotient++;
+                  }
+               }
+               for(i = 31; i >= 0; i--)
+               {
+                  quotient <<= 1;
+                  overflow = GET_MSB_32(remainder);
+                  remainder = (remainder << 1) + ((dividend_lo >> i) & 1);
+                  if(remainder >= divisor || overflow)
+                  {
+                     remainder -= divisor;
+                     quotient++;
+                  }
+               }
+
+               if(BIT_B(word2))	   /* signed */
+               {
+                  if(quotient > 0x7fffffff)
+                  {
+                     FLAG_V = VFLAG_SET;
+                     goto m68k_op_divl_32_di_done;
+                  }
+                  if(dividend_neg)
+                  {
+                     remainder = (uint)MASK_OUT_ABOVE_32(-(sint)remainder);
+                     quotient = (uint)MASK_OUT_ABOVE_32(-(sint)quotient);
+                  }
+                  if(divisor_neg)
+                     quotient = (uint)MASK_OUT_ABOVE_32(-(sint)quotient);
+               }
+
+               REG_D[word2 & 7] = remainder;
+               REG_D[(word2 >> 12) & 7] = quotient;
+
+               FLAG_N = NFLAG_32(quotient);
+               FLAG_Z = quotient;
+               FLAG_V = VFLAG_CLEAR;
+               FLAG_C = CFLAG_CLEAR;
+               goto m68k_op_divl_32_di_done;
+            }
+
+            /* long / long: long quotient, maybe long remainder */
+            if(BIT_B(word2))	   /* signed */
+            {
+               /* Special case in divide */
+               if(dividend_lo == 0x80000000 && divisor == 0xffffffff)
+               {
+                  FLAG_N = NFLAG_SET;
+                  FLAG_Z = ZFLAG_CLEAR;
+                  FLAG_V = VFLAG_CLEAR;
+                  FLAG_C = CFLAG_CLEAR;
+                  REG_D[(word2 >> 12) & 7] = 0x80000000;
+                  REG_D[word2 & 7] = 0;
+                  goto m68k_op_divl_32_di_done;
+               }
+               REG_D[word2 & 7] = MAKE_INT_32(dividend_lo) % MAKE_INT_32(divisor);
+               quotient = REG_D[(word2 >> 12) & 7] = MAKE_INT_32(dividend_lo) / MAKE_INT_32(divisor);
+            }
+            else
+            {
+               REG_D[word2 & 7] = MASK_OUT_ABOVE_32(dividend_lo) % MASK_OUT_ABOVE_32(divisor);
+               quotient = REG_D[(word2 >> 12) & 7] = MASK_OUT_ABOVE_32(dividend_lo) / MASK_OUT_ABOVE_32(divisor);
+            }
+
+            FLAG_N = NFLAG_32(quotient);
+            FLAG_Z = quotient;
+            FLAG_V = VFLAG_CLEAR;
+            FLAG_C = CFLAG_CLEAR;
+            goto m68k_op_divl_32_di_done;
+         }
+         m68ki_exception_trap(EXCEPTION_ZERO_DIVIDE);
+         goto m68k_op_divl_32_di_done;
+      }
+      m68ki_exception_illegal();
+
+   #endif
+   }
+m68k_op_divl_32_di_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_divl_32_ix:
+   {
+      m68ki_resolve_flags();
+   #if M68K_USE_64_BIT
+
+      if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+      {
+         uint word2 = OPER_I_16();
+         uint64 divisor = OPER_AY_IX_32();
+         uint64 dividend  = 0;
+         uint64 quotient  = 0;
+         uint64 remainder = 0;
+
+         if(divisor != 0)
+         {
+            if(BIT_A(word2))	/* 64 bit */
+            {
+               dividend = REG_D[word2 & 7];
+               dividend <<= 32;
+               dividend |= REG_D[(word2 >> 12) & 7];
+
+               if(BIT_B(word2))	   /* signed */
+               {
+                  quotient  = (uint64)((sint64)dividend / (sint64)((sint32)divisor));
+                  remainder = (uint64)((sint64)dividend % (sint64)((sint32)divisor));
+                  if((sint64)quotient != (sint64)((sint32)quotient))
+                  {
+                     FLAG_V = VFLAG_SET;
+                     goto m68k_op_divl_32_ix_done;
+                  }
+               }
+               else					/* unsigned */
+               {
+                  quotient = dividend / divisor;
+                  if(quotient > 0xffffffff)
+                  {
+                     FLAG_V = VFLAG_SET;
+                     goto m68k_op_divl_32_ix_done;
+                  }
+                  remainder = dividend % divisor;
+               }
+            }
+            else	/* 32 bit */
+            {
+               dividend = REG_D[(word2 >> 12) & 7];
+               if(BIT_B(word2))	   /* signed */
+               {
+                  quotient  = (uint64)((sint64)((sint32)dividend) / (sint64)((sint32)divisor));
+                  remainder = (uint64)((sint64)((sint32)dividend) % (sint64)((sint32)divisor));
+               }
+               else					/* unsigned */
+               {
+                  quotient = dividend / divisor;
+                  remainder = dividend % divisor;
+               }
+            }
+
+            REG_D[word2 & 7] = remainder;
+            REG_D[(word2 >> 12) & 7] = quotient;
+
+            FLAG_N = NFLAG_32(quotient);
+            FLAG_Z = quotient;
+            FLAG_V = VFLAG_CLEAR;
+            FLAG_C = CFLAG_CLEAR;
+            goto m68k_op_divl_32_ix_done;
+         }
+         m68ki_exception_trap(EXCEPTION_ZERO_DIVIDE);
+         goto m68k_op_divl_32_ix_done;
+      }
+      m68ki_exception_illegal();
+
+   #else
+
+      if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+      {
+         uint word2 = OPER_I_16();
+         uint divisor = OPER_AY_IX_32();
+         uint dividend_hi = REG_D[word2 & 7];
+         uint dividend_lo = REG_D[(word2 >> 12) & 7];
+         uint quotient = 0;
+         uint remainder = 0;
+         uint dividend_neg = 0;
+         uint divisor_neg = 0;
+         sint i;
+         uint overflow;
+
+         if(divisor != 0)
+         {
+            /* quad / long : long quotient, long remainder */
+            if(BIT_A(word2))
+            {
+               if(BIT_B(word2))	   /* signed */
+               {
+                  /* special case in signed divide */
+                  if(dividend_hi == 0 && dividend_lo == 0x80000000 && divisor == 0xffffffff)
+                  {
+                     REG_D[word2 & 7] = 0;
+                     REG_D[(word2 >> 12) & 7] = 0x80000000;
+
+                     FLAG_N = NFLAG_SET;
+                     FLAG_Z = ZFLAG_CLEAR;
+                     FLAG_V = VFLAG_CLEAR;
+                     FLAG_C = CFLAG_CLEAR;
+                     goto m68k_op_divl_32_ix_done;
+                  }
+                  if(GET_MSB_32(dividend_hi))
+                  {
+                     dividend_neg = 1;
+                     dividend_hi = (uint)MASK_OUT_ABOVE_32((-(sint)dividend_hi) - (dividend_lo != 0));
+                     dividend_lo = (uint)MASK_OUT_ABOVE_32(-(sint)dividend_lo);
+                  }
+                  if(GET_MSB_32(divisor))
+                  {
+                     divisor_neg = 1;
+                     divisor = (uint)MASK_OUT_ABOVE_32(-(sint)divisor);
+
+                  }
+               }
+
+               /* if the upper long is greater than the divisor, we're overflowing. */
+               if(dividend_hi >= divisor)
+               {
+                  FLAG_V = VFLAG_SET;
+                  goto m68k_op_divl_32_ix_done;
+               }
+
+               for(i = 31; i >= 0; i--)
+               {
+                  quotient <<= 1;
+                  remainder = (remainder << 1) + ((dividend_hi >> i) & 1);
+                  if(remainder >= divisor)
+                  {
+                     remainder -= divisor;
+                     quotient++;
+                  }
+               }
+               for(i = 31; i >= 0; i--)
+               {
+                  quotient <<= 1;
+                  overflow = GET_MSB_32(remainder);
+                  remainder = (remainder << 1) + ((dividend_lo >> i) & 1);
+                  if(remainder >= divisor || overflow)
+                  {
+                     remainder -= divisor;
+                     quotient++;
+                  }
+               }
+
+               if(BIT_B(word2))	   /* signed */
+               {
+                  if(quotient > 0x7fffffff)
+                  {
+                     FLAG_V = VFLAG_SET;
+                     goto m68k_op_divl_32_ix_done;
+                  }
+                  if(dividend_neg)
+                  {
+                     remainder = (uint)MASK_OUT_ABOVE_32(-(sint)remainder);
+                     quotient = (uint)MASK_OUT_ABOVE_32(-(sint)quotient);
+                  }
+                  if(divisor_neg)
+                     quotient = (uint)MASK_OUT_ABOVE_32(-(sint)quotient);
+               }
+
+               REG_D[word2 & 7] = remainder;
+               REG_D[(word2 >> 12) & 7] = quotient;
+
+               FLAG_N = NFLAG_32(quotient);
+               FLAG_Z = quotient;
+               FLAG_V = VFLAG_CLEAR;
+               FLAG_C = CFLAG_CLEAR;
+               goto m68k_op_divl_32_ix_done;
+            }
+
+            /* long / long: long quotient, maybe long remainder */
+            if(BIT_B(word2))	   /* signed */
+            {
+               /* Special case in divide */
+               if(dividend_lo == 0x80000000 && divisor == 0xffffffff)
+               {
+                  FLAG_N = NFLAG_SET;
+                  FLAG_Z = ZFLAG_CLEAR;
+                  FLAG_V = VFLAG_CLEAR;
+                  FLAG_C = CFLAG_CLEAR;
+                  REG_D[(word2 >> 12) & 7] = 0x80000000;
+                  REG_D[word2 & 7] = 0;
+                  goto m68k_op_divl_32_ix_done;
+               }
+               REG_D[word2 & 7] = MAKE_INT_32(dividend_lo) % MAKE_INT_32(divisor);
+               quotient = REG_D[(word2 >> 12) & 7] = MAKE_INT_32(dividend_lo) / MAKE_INT_32(divisor);
+            }
+            else
+            {
+               REG_D[word2 & 7] = MASK_OUT_ABOVE_32(dividend_lo) % MASK_OUT_ABOVE_32(divisor);
+               quotient = REG_D[(word2 >> 12) & 7] = MASK_OUT_ABOVE_32(dividend_lo) / MASK_OUT_ABOVE_32(divisor);
+            }
+
+            FLAG_N = NFLAG_32(quotient);
+            FLAG_Z = quotient;
+            FLAG_V = VFLAG_CLEAR;
+            FLAG_C = CFLAG_CLEAR;
+            goto m68k_op_divl_32_ix_done;
+         }
+         m68ki_exception_trap(EXCEPTION_ZERO_DIVIDE);
+         goto m68k_op_divl_32_ix_done;
+      }
+      m68ki_exception_illegal();
+
+   #endif
+   }
+m68k_op_divl_32_ix_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_divl_32_aw:
+   {
+      m68ki_resolve_flags();
+   #if M68K_USE_64_BIT
+
+      if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+      {
+         uint word2 = OPER_I_16();
+         uint64 divisor = OPER_AW_32();
+         uint64 dividend  = 0;
+         uint64 quotient  = 0;
+         uint64 remainder = 0;
+
+         if(divisor != 0)
+         {
+            if(BIT_A(word2))	/* 64 bit */
+            {
+               dividend = REG_D[word2 & 7];
+               dividend <<= 32;
+               dividend |= REG_D[(word2 >> 12) & 7];
+
+               if(BIT_B(word2))	   /* signed */
+               {
+                  quotient  = (uint64)((sint64)dividend / (sint64)((sint32)divisor));
+                  remainder = (uint64)((sint64)dividend % (sint64)((sint32)divisor));
+                  if((sint64)quotient != (sint64)((sint32)quotient))
+                  {
+                     FLAG_V = VFLAG_SET;
+                     goto m68k_op_divl_32_aw_done;
+                  }
+               }
+               else					/* unsigned */
+               {
+                  quotient = dividend / divisor;
+                  if(quotient > 0xffffffff)
+                  {
+                     FLAG_V = VFLAG_SET;
+                     goto m68k_op_divl_32_aw_done;
+                  }
+                  remainder = dividend % divisor;
+               }
+            }
+            else	/* 32 bit */
+            {
+               dividend = REG_D[(word2 >> 12) & 7];
+               if(BIT_B(word2))	   /* signed */
+               {
+                  quotient  = (uint64)((sint64)((sint32)dividend) / (sint64)((sint32)divisor));
+                  remainder = (uint64)((sint64)((sint32)dividend) % (sint64)((sint32)divisor));
+               }
+               else					/* unsigned */
+               {
+                  quotient = dividend / divisor;
+                  remainder = dividend % divisor;
+               }
+            }
+
+            REG_D[word2 & 7] = remainder;
+            REG_D[(word2 >> 12) & 7] = quotient;
+
+            FLAG_N = NFLAG_32(quotient);
+            FLAG_Z = quotient;
+            FLAG_V = VFLAG_CLEAR;
+            FLAG_C = CFLAG_CLEAR;
+            goto m68k_op_divl_32_aw_done;
+         }
+         m68ki_exception_trap(EXCEPTION_ZERO_DIVIDE);
+         goto m68k_op_divl_32_aw_done;
+      }
+      m68ki_exception_illegal();
+
+   #else
+
+      if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+      {
+         uint word2 = OPER_I_16();
+         uint divisor = OPER_AW_32();
+         uint dividend_hi = REG_D[word2 & 7];
+         uint dividend_lo = REG_D[(word2 >> 12) & 7];
+         uint quotient = 0;
+         uint remainder = 0;
+         uint dividend_neg = 0;
+         uint divisor_neg = 0;
+         sint i;
+         uint overflow;
+
+         if(divisor != 0)
+         {
+            /* quad / long : long quotient, long remainder */
+            if(BIT_A(word2))
+            {
+               if(BIT_B(word2))	   /* signed */
+               {
+                  /* special case in signed divide */
+                  if(dividend_hi == 0 && dividend_lo == 0x80000000 && divisor == 0xffffffff)
+                  {
+                     REG_D[word2 & 7] = 0;
+                     REG_D[(word2 >> 12) & 7] = 0x80000000;
+
+                     FLAG_N = NFLAG_SET;
+                     FLAG_Z = ZFLAG_CLEAR;
+                     FLAG_V = VFLAG_CLEAR;
+                     FLAG_C = CFLAG_CLEAR;
+                     goto m68k_op_divl_32_aw_done;
+                  }
+                  if(GET_MSB_32(dividend_hi))
+                  {
+                     dividend_neg = 1;
+                     dividend_hi = (uint)MASK_OUT_ABOVE_32((-(sint)dividend_hi) - (dividend_lo != 0));
+                     dividend_lo = (uint)MASK_OUT_ABOVE_32(-(sint)dividend_lo);
+                  }
+                  if(GET_MSB_32(divisor))
+                  {
+                     divisor_neg = 1;
+                     divisor = (uint)MASK_OUT_ABOVE_32(-(sint)divisor);
+
+                  }
+               }
+
+               /* if the upper long is greater than the divisor, we're overflowing. */
+               if(dividend_hi >= divisor)
+               {
+                  FLAG_V = VFLAG_SET;
+                  goto m68k_op_divl_32_aw_done;
+               }
+
+               for(i = 31; i >= 0; i--)
+               {
+                  quotient <<= 1;
+                  remainder = (remainder << 1) + ((dividend_hi >> i) & 1);
+                  if(remainder >= divisor)
+                  {
+                     remainder -= divisor;
+                     quotient++;
+                  }
+               }
+               for(i = 31; i >= 0; i--)
+               {
+                  quotient <<= 1;
+                  overflow = GET_MSB_32(remainder);
+                  remainder = (remainder << 1) + ((dividend_lo >> i) & 1);
+                  if(remainder >= divisor || overflow)
+                  {
+                     remainder -= divisor;
+                     quotient++;
+                  }
+               }
+
+               if(BIT_B(word2))	   /* signed */
+               {
+                  if(quotient > 0x7fffffff)
+                  {
+                     FLAG_V = VFLAG_SET;
+                     goto m68k_op_divl_32_aw_done;
+                  }
+                  if(dividend_neg)
+                  {
+                     remainder = (uint)MASK_OUT_ABOVE_32(-(sint)remainder);
+                     quotient = (uint)MASK_OUT_ABOVE_32(-(sint)quotient);
+                  }
+                  if(divisor_neg)
+                     quotient = (uint)MASK_OUT_ABOVE_32(-(sint)quotient);
+               }
+
+               REG_D[word2 & 7] = remainder;
+               REG_D[(word2 >> 12) & 7] = quotient;
+
+               FLAG_N = NFLAG_32(quotient);
+               FLAG_Z = quotient;
+               FLAG_V = VFLAG_CLEAR;
+               FLAG_C = CFLAG_CLEAR;
+               goto m68k_op_divl_32_aw_done;
+            }
+
+            /* long / long: long quotient, maybe long remainder */
+            if(BIT_B(word2))	   /* signed */
+            {
+               /* Special case in divide */
+               if(dividend_lo == 0x80000000 && divisor == 0xffffffff)
+               {
+                  FLAG_N = NFLAG_SET;
+                  FLAG_Z = ZFLAG_CLEAR;
+                  FLAG_V = VFLAG_CLEAR;
+                  FLAG_C = CFLAG_CLEAR;
+                  REG_D[(word2 >> 12) & 7] = 0x80000000;
+                  REG_D[word2 & 7] = 0;
+                  goto m68k_op_divl_32_aw_done;
+               }
+               REG_D[word2 & 7] = MAKE_INT_32(dividend_lo) % MAKE_INT_32(divisor);
+               quotient = REG_D[(word2 >> 12) & 7] = MAKE_INT_32(dividend_lo) / MAKE_INT_32(divisor);
+            }
+            else
+            {
+               REG_D[word2 & 7] = MASK_OUT_ABOVE_32(dividend_lo) % MASK_OUT_ABOVE_32(divisor);
+               quotient = REG_D[(word2 >> 12) & 7] = MASK_OUT_ABOVE_32(dividend_lo) / MASK_OUT_ABOVE_32(divisor);
+            }
+
+            FLAG_N = NFLAG_32(quotient);
+            FLAG_Z = quotient;
+            FLAG_V = VFLAG_CLEAR;
+            FLAG_C = CFLAG_CLEAR;
+            goto m68k_op_divl_32_aw_done;
+         }
+         m68ki_exception_trap(EXCEPTION_ZERO_DIVIDE);
+         goto m68k_op_divl_32_aw_done;
+      }
+      m68ki_exception_illegal();
+
+   #endif
+   }
+m68k_op_divl_32_aw_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_divl_32_al:
+   {
+      m68ki_resolve_flags();
+   #if M68K_USE_64_BIT
+
+      if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+      {
+         uint word2 = OPER_I_16();
+         uint64 divisor = OPER_AL_32();
+         uint64 dividend  = 0;
+         uint64 quotient  = 0;
+         uint64 remainder = 0;
+
+         if(divisor != 0)
+         {
+            if(BIT_A(word2))	/* 64 bit */
+            {
+               dividend = REG_D[word2 & 7];
+               dividend <<= 32;
+               dividend |= REG_D[(word2 >> 12) & 7];
+
+               if(BIT_B(word2))	   /* signed */
+               {
+                  quotient  = (uint64)((sint64)dividend / (sint64)((sint32)divisor));
+                  remainder = (uint64)((sint64)dividend % (sint64)((sint32)divisor));
+                  if((sint64)quotient != (sint64)((sint32)quotient))
+                  {
+                     FLAG_V = VFLAG_SET;
+                     goto m68k_op_divl_32_al_done;
+                  }
+               }
+               else					/* unsigned */
+               {
+                  quotient = dividend / divisor;
+                  if(quotient > 0xffffffff)
+                  {
+                     FLAG_V = VFLAG_SET;
+                     goto m68k_op_divl_32_al_done;
+                  }
+                  remainder = dividend % divisor;
+               }
+            }
+            else	/* 32 bit */
+            {
+               dividend = REG_D[(word2 >> 12) & 7];
+               if(BIT_B(word2))	   /* signed */
+               {
+                  quotient  = (uint64)((sint64)((sint32)dividend) / (sint64)((sint32)divisor));
+                  remainder = (uint64)((sint64)((sint32)dividend) % (sint64)((sint32)divisor));
+               }
+               else					/* unsigned */
+               {
+                  quotient = dividend / divisor;
+                  remainder = dividend % divisor;
+               }
+            }
+
+            REG_D[word2 & 7] = remainder;
+            REG_D[(word2 >> 12) & 7] = quotient;
+
+            FLAG_N = NFLAG_32(quotient);
+            FLAG_Z = quotient;
+            FLAG_V = VFLAG_CLEAR;
+            FLAG_C = CFLAG_CLEAR;
+            goto m68k_op_divl_32_al_done;
+         }
+         m68ki_exception_trap(EXCEPTION_ZERO_DIVIDE);
+         goto m68k_op_divl_32_al_done;
+      }
+      m68ki_exception_illegal();
+
+   #else
+
+      if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+      {
+         uint word2 = OPER_I_16();
+         uint divisor = OPER_AL_32();
+         uint dividend_hi = REG_D[word2 & 7];
+         uint dividend_lo = REG_D[(word2 >> 12) & 7];
+         uint quotient = 0;
+         uint remainder = 0;
+         uint dividend_neg = 0;
+         uint divisor_neg = 0;
+         sint i;
+         uint overflow;
+
+         if(divisor != 0)
+         {
+            /* quad / long : long quotient, long remainder */
+            if(BIT_A(word2))
+            {
+               if(BIT_B(word2))	   /* signed */
+               {
+                  /* special case in signed divide */
+                  if(dividend_hi == 0 && dividend_lo == 0x80000000 && divisor == 0xffffffff)
+                  {
+                     REG_D[word2 & 7] = 0;
+                     REG_D[(word2 >> 12) & 7] = 0x80000000;
+
+                     FLAG_N = NFLAG_SET;
+                     FLAG_Z = ZFLAG_CLEAR;
+                     FLAG_V = VFLAG_CLEAR;
+                     FLAG_C = CFLAG_CLEAR;
+                     goto m68k_op_divl_32_al_done;
+                  }
+                  if(GET_MSB_32(dividend_hi))
+                  {
+                     dividend_neg = 1;
+                     dividend_hi = (uint)MASK_OUT_ABOVE_32((-(sint)dividend_hi) - (dividend_lo != 0));
+                     dividend_lo = (uint)MASK_OUT_ABOVE_32(-(sint)dividend_lo);
+                  }
+                  if(GET_MSB_32(divisor))
+                  {
+                     divisor_neg = 1;
+                     divisor = (uint)MASK_OUT_ABOVE_32(-(sint)divisor);
+
+                  }
+               }
+
+               /* if the upper long is greater than the divisor, we're overflowing. */
+               if(dividend_hi >= divisor)
+               {
+                  FLAG_V = VFLAG_SET;
+                  goto m68k_op_divl_32_al_done;
+               }
+
+               for(i = 31; i >= 0; i--)
+               {
+                  quotient <<= 1;
+                  remainder = (remainder << 1) + ((dividend_hi >> i) & 1);
+                  if(remainder >= divisor)
+                  {
+                     remainder -= divisor;
+                     quotient++;
+                  }
+               }
+               for(i = 31; i >= 0; i--)
+               {
+                  quotient <<= 1;
+                  overflow = GET_MSB_32(remainder);
+                  remainder = (remainder << 1) + ((dividend_lo >> i) & 1);
+                  if(remainder >= divisor || overflow)
+                  {
+                     remainder -= divisor;
+                     quotient++;
+                  }
+               }
+
+               if(BIT_B(word2))	   /* signed */
+               {
+                  if(quotient > 0x7fffffff)
+                  {
+                     FLAG_V = VFLAG_SET;
+                     goto m68k_op_divl_32_al_done;
+                  }
+                  if(dividend_neg)
+                  {
+                     remainder = (uint)MASK_OUT_ABOVE_32(-(sint)remainder);
+                     quotient = (uint)MASK_OUT_ABOVE_32(-(sint)quotient);
+                  }
+                  if(divisor_neg)
+                     quotient = (uint)MASK_OUT_ABOVE_32(-(sint)quotient);
+               }
+
+               REG_D[word2 & 7] = remainder;
+               REG_D[(word2 >> 12) & 7] = quotient;
+
+               FLAG_N = NFLAG_32(quotient);
+               FLAG_Z = quotient;
+               FLAG_V = VFLAG_CLEAR;
+               FLAG_C = CFLAG_CLEAR;
+               goto m68k_op_divl_32_al_done;
+            }
+
+            /* long / long: long quotient, maybe long remainder */
+            if(BIT_B(word2))	   /* signed */
+            {
+               /* Special case in divide */
+               if(dividend_lo == 0x80000000 && divisor == 0xffffffff)
+               {
+                  FLAG_N = NFLAG_SET;
+                  FLAG_Z = ZFLAG_CLEAR;
+                  FLAG_V = VFLAG_CLEAR;
+                  FLAG_C = CFLAG_CLEAR;
+                  REG_D[(word2 >> 12) & 7] = 0x80000000;
+                  REG_D[word2 & 7] = 0;
+                  goto m68k_op_divl_32_al_done;
+               }
+               REG_D[word2 & 7] = MAKE_INT_32(dividend_lo) % MAKE_INT_32(divisor);
+               quotient = REG_D[(word2 >> 12) & 7] = MAKE_INT_32(dividend_lo) / MAKE_INT_32(divisor);
+            }
+            else
+            {
+               REG_D[word2 & 7] = MASK_OUT_ABOVE_32(dividend_lo) % MASK_OUT_ABOVE_32(divisor);
+               quotient = REG_D[(word2 >> 12) & 7] = MASK_OUT_ABOVE_32(dividend_lo) / MASK_OUT_ABOVE_32(divisor);
+            }
+
+            FLAG_N = NFLAG_32(quotient);
+            FLAG_Z = quotient;
+            FLAG_V = VFLAG_CLEAR;
+            FLAG_C = CFLAG_CLEAR;
+            goto m68k_op_divl_32_al_done;
+         }
+         m68ki_exception_trap(EXCEPTION_ZERO_DIVIDE);
+         goto m68k_op_divl_32_al_done;
+      }
+      m68ki_exception_illegal();
+
+   #endif
+   }
+m68k_op_divl_32_al_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_divl_32_pcdi:
+   {
+      m68ki_resolve_flags();
+   #if M68K_USE_64_BIT
+
+      if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+      {
+         uint word2 = OPER_I_16();
+         uint64 divisor = OPER_PCDI_32();
+         uint64 dividend  = 0;
+         uint64 quotient  = 0;
+         uint64 remainder = 0;
+
+         if(divisor != 0)
+         {
+            if(BIT_A(word2))	/* 64 bit */
+            {
+               dividend = REG_D[word2 & 7];
+               dividend <<= 32;
+               dividend |= REG_D[(word2 >> 12) & 7];
+
+               if(BIT_B(word2))	   /* signed */
+               {
+                  quotient  = (uint64)((sint64)dividend / (sint64)((sint32)divisor));
+                  remainder = (uint64)((sint64)dividend % (sint64)((sint32)divisor));
+                  if((sint64)quotient != (sint64)((sint32)quotient))
+                  {
+                     FLAG_V = VFLAG_SET;
+                     goto m68k_op_divl_32_pcdi_done;
+                  }
+               }
+               else					/* unsigned */
+               {
+                  quotient = dividend / divisor;
+                  if(quotient > 0xffffffff)
+                  {
+                     FLAG_V = VFLAG_SET;
+                     goto m68k_op_divl_32_pcdi_done;
+                  }
+                  remainder = dividend % divisor;
+               }
+            }
+            else	/* 32 bit */
+            {
+               dividend = REG_D[(word2 >> 12) & 7];
+               if(BIT_B(word2))	   /* signed */
+               {
+                  quotient  = (uint64)((sint64)((sint32)dividend) / (sint64)((sint32)divisor));
+                  remainder = (uint64)((sint64)((sint32)dividend) % (sint64)((sint32)divisor));
+               }
+               else					/* unsigned */
+               {
+                  quotient = dividend / divisor;
+                  remainder = dividend % divisor;
+               }
+            }
+
+            REG_D[word2 & 7] = remainder;
+            REG_D[(word2 >> 12) & 7] = quotient;
+
+            FLAG_N = NFLAG_32(quotient);
+            FLAG_Z = quotient;
+            FLAG_V = VFLAG_CLEAR;
+            FLAG_C = CFLAG_CLEAR;
+            goto m68k_op_divl_32_pcdi_done;
+         }
+         m68ki_exception_trap(EXCEPTION_ZERO_DIVIDE);
+         goto m68k_op_divl_32_pcdi_done;
+      }
+      m68ki_exception_illegal();
+
+   #else
+
+      if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+      {
+         uint word2 = OPER_I_16();
+         uint divisor = OPER_PCDI_32();
+         uint dividend_hi = REG_D[word2 & 7];
+         uint dividend_lo = REG_D[(word2 >> 12) & 7];
+         uint quotient = 0;
+         uint remainder = 0;
+         uint dividend_neg = 0;
+         uint divisor_neg = 0;
+         sint i;
+         uint overflow;
+
+         if(divisor != 0)
+         {
+            /* quad / long : long quotient, long remainder */
+            if(BIT_A(word2))
+            {
+               if(BIT_B(word2))	   /* signed */
+               {
+                  /* special case in signed divide */
+                  if(dividend_hi == 0 && dividend_lo == 0x80000000 && divisor == 0xffffffff)
+                  {
+                     REG_D[word2 & 7] = 0;
+                     REG_D[(word2 >> 12) & 7] = 0x80000000;
+
+                     FLAG_N = NFLAG_SET;
+                     FLAG_Z = ZFLAG_CLEAR;
+                     FLAG_V = VFLAG_CLEAR;
+                     FLAG_C = CFLAG_CLEAR;
+                     goto m68k_op_divl_32_pcdi_done;
+                  }
+                  if(GET_MSB_32(dividend_hi))
+                  {
+                     dividend_neg = 1;
+                     dividend_hi = (uint)MASK_OUT_ABOVE_32((-(sint)dividend_hi) - (dividend_lo != 0));
+                     dividend_lo = (uint)MASK_OUT_ABOVE_32(-(sint)dividend_lo);
+                  }
+                  if(GET_MSB_32(divisor))
+                  {
+                     divisor_neg = 1;
+                     divisor = (uint)MASK_OUT_ABOVE_32(-(sint)divisor);
+
+                  }
+               }
+
+               /* if the upper long is greater than the divisor, we're overflowing. */
+               if(dividend_hi >= divisor)
+               {
+                  FLAG_V = VFLAG_SET;
+                  goto m68k_op_divl_32_pcdi_done;
+               }
+
+               for(i = 31; i >= 0; i--)
+               {
+                  quotient <<= 1;
+                  remainder = (remainder << 1) + ((dividend_hi >> i) & 1);
+                  if(remainder >= divisor)
+                  {
+                     remainder -= divisor;
+                     quotient++;
+                  }
+               }
+               for(i = 31; i >= 0; i--)
+               {
+                  quotient <<= 1;
+                  overflow = GET_MSB_32(remainder);
+                  remainder = (remainder << 1) + ((dividend_lo >> i) & 1);
+                  if(remainder >= divisor || overflow)
+                  {
+                     remainder -= divisor;
+                     quotient++;
+                  }
+               }
+
+               if(BIT_B(word2))	   /* signed */
+               {
+                  if(quotient > 0x7fffffff)
+                  {
+                     FLAG_V = VFLAG_SET;
+                     goto m68k_op_divl_32_pcdi_done;
+                  }
+                  if(dividend_neg)
+                  {
+                     remainder = (uint)MASK_OUT_ABOVE_32(-(sint)remainder);
+                     quotient = (uint)MASK_OUT_ABOVE_32(-(sint)quotient);
+                  }
+                  if(divisor_neg)
+                     quotient = (uint)MASK_OUT_ABOVE_32(-(sint)quotient);
+               }
+
+               REG_D[word2 & 7] = remainder;
+               REG_D[(word2 >> 12) & 7] = quotient;
+
+               FLAG_N = NFLAG_32(quotient);
+               FLAG_Z = quotient;
+               FLAG_V = VFLAG_CLEAR;
+               FLAG_C = CFLAG_CLEAR;
+               goto m68k_op_divl_32_pcdi_done;
+            }
+
+            /* long / long: long quotient, maybe long remainder */
+            if(BIT_B(word2))	   /* signed */
+            {
+               /* Special case in divide */
+               if(dividend_lo == 0x80000000 && divisor == 0xffffffff)
+               {
+                  FLAG_N = NFLAG_SET;
+                  FLAG_Z = ZFLAG_CLEAR;
+                  FLAG_V = VFLAG_CLEAR;
+                  FLAG_C = CFLAG_CLEAR;
+                  REG_D[(word2 >> 12) & 7] = 0x80000000;
+                  REG_D[word2 & 7] = 0;
+                  goto m68k_op_divl_32_pcdi_done;
+               }
+               REG_D[word2 & 7] = MAKE_INT_32(dividend_lo) % MAKE_INT_32(divisor);
+               quotient = REG_D[(word2 >> 12) & 7] = MAKE_INT_32(dividend_lo) / MAKE_INT_32(divisor);
+            }
+            else
+            {
+               REG_D[word2 & 7] = MASK_OUT_ABOVE_32(dividend_lo) % MASK_OUT_ABOVE_32(divisor);
+               quotient = REG_D[(word2 >> 12) & 7] = MASK_OUT_ABOVE_32(dividend_lo) / MASK_OUT_ABOVE_32(divisor);
+            }
+
+            FLAG_N = NFLAG_32(quotient);
+            FLAG_Z = quotient;
+            FLAG_V = VFLAG_CLEAR;
+            FLAG_C = CFLAG_CLEAR;
+            goto m68k_op_divl_32_pcdi_done;
+         }
+         m68ki_exception_trap(EXCEPTION_ZERO_DIVIDE);
+         goto m68k_op_divl_32_pcdi_done;
+      }
+      m68ki_exception_illegal();
+
+   #endif
+   }
+m68k_op_divl_32_pcdi_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_divl_32_pcix:
+   {
+      m68ki_resolve_flags();
+   #if M68K_USE_64_BIT
+
+      if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+      {
+         uint word2 = OPER_I_16();
+         uint64 divisor = OPER_PCIX_32();
+         uint64 dividend  = 0;
+         uint64 quotient  = 0;
+         uint64 remainder = 0;
+
+         if(divisor != 0)
+         {
+            if(BIT_A(word2))	/* 64 bit */
+            {
+               dividend = REG_D[word2 & 7];
+               dividend <<= 32;
+               dividend |= REG_D[(word2 >> 12) & 7];
+
+               if(BIT_B(word2))	   /* signed */
+               {
+                  quotient  = (uint64)((sint64)dividend / (sint64)((sint32)divisor));
+                  remainder = (uint64)((sint64)dividend % (sint64)((sint32)divisor));
+                  if((sint64)quotient != (sint64)((sint32)quotient))
+                  {
+                     FLAG_V = VFLAG_SET;
+                     goto m68k_op_divl_32_pcix_done;
+                  }
+               }
+               else					/* unsigned */
+               {
+                  quotient = dividend / divisor;
+                  if(quotient > 0xffffffff)
+                  {
+                     FLAG_V = VFLAG_SET;
+                     goto m68k_op_divl_32_pcix_done;
+                  }
+                  remainder = dividend % divisor;
+               }
+            }
+            else	/* 32 bit */
+            {
+               dividend = REG_D[(word2 >> 12) & 7];
+               if(BIT_B(word2))	   /* signed */
+               {
+                  quotient  = (uint64)((sint64)((sint32)dividend) / (sint64)((sint32)divisor));
+                  remainder = (uint64)((sint64)((sint32)dividend) % (sint64)((sint32)divisor));
+               }
+               else					/* unsigned */
+               {
+                  quotient = dividend / divisor;
+                  remainder = dividend % divisor;
+               }
+            }
+
+            REG_D[word2 & 7] = remainder;
+            REG_D[(word2 >> 12) & 7] = quotient;
+
+            FLAG_N = NFLAG_32(quotient);
+            FLAG_Z = quotient;
+            FLAG_V = VFLAG_CLEAR;
+            FLAG_C = CFLAG_CLEAR;
+            goto m68k_op_divl_32_pcix_done;
+         }
+         m68ki_exception_trap(EXCEPTION_ZERO_DIVIDE);
+         goto m68k_op_divl_32_pcix_done;
+      }
+      m68ki_exception_illegal();
+
+   #else
+
+      if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+      {
+         uint word2 = OPER_I_16();
+         uint divisor = OPER_PCIX_32();
+         uint dividend_hi = REG_D[word2 & 7];
+         uint dividend_lo = REG_D[(word2 >> 12) & 7];
+         uint quotient = 0;
+         uint remainder = 0;
+         uint dividend_neg = 0;
+         uint divisor_neg = 0;
+         sint i;
+         uint overflow;
+
+         if(divisor != 0)
+         {
+            /* quad / long : long quotient, long remainder */
+            if(BIT_A(word2))
+            {
+               if(BIT_B(word2))	   /* signed */
+               {
+                  /* special case in signed divide */
+                  if(dividend_hi == 0 && dividend_lo == 0x80000000 && divisor == 0xffffffff)
+                  {
+                     REG_D[word2 & 7] = 0;
+                     REG_D[(word2 >> 12) & 7] = 0x80000000;
+
+                     FLAG_N = NFLAG_SET;
+                     FLAG_Z = ZFLAG_CLEAR;
+                     FLAG_V = VFLAG_CLEAR;
+                     FLAG_C = CFLAG_CLEAR;
+                     goto m68k_op_divl_32_pcix_done;
+                  }
+                  if(GET_MSB_32(dividend_hi))
+                  {
+                     dividend_neg = 1;
+                     dividend_hi = (uint)MASK_OUT_ABOVE_32((-(sint)dividend_hi) - (dividend_lo != 0));
+                     dividend_lo = (uint)MASK_OUT_ABOVE_32(-(sint)dividend_lo);
+                  }
+                  if(GET_MSB_32(divisor))
+                  {
+                     divisor_neg = 1;
+                     divisor = (uint)MASK_OUT_ABOVE_32(-(sint)divisor);
+
+                  }
+               }
+
+               /* if the upper long is greater than the divisor, we're overflowing. */
+               if(dividend_hi >= divisor)
+               {
+                  FLAG_V = VFLAG_SET;
+                  goto m68k_op_divl_32_pcix_done;
+               }
+
+               for(i = 31; i >= 0; i--)
+               {
+                  quotient <<= 1;
+                  remainder = (remainder << 1) + ((dividend_hi >> i) & 1);
+                  if(remainder >= divisor)
+                  {
+                     remainder -= divisor;
+                     quotient++;
+                  }
+               }
+               for(i = 31; i >= 0; i--)
+               {
+                  quotient <<= 1;
+                  overflow = GET_MSB_32(remainder);
+                  remainder = (remainder << 1) + ((dividend_lo >> i) & 1);
+                  if(remainder >= divisor || overflow)
+                  {
+                     remainder -= divisor;
+                     quotient++;
+                  }
+               }
+
+               if(BIT_B(word2))	   /* signed */
+               {
+                  if(quotient > 0x7fffffff)
+                  {
+                     FLAG_V = VFLAG_SET;
+                     goto m68k_op_divl_32_pcix_done;
+                  }
+                  if(dividend_neg)
+                  {
+                     remainder = (uint)MASK_OUT_ABOVE_32(-(sint)remainder);
+                     quotient = (uint)MASK_OUT_ABOVE_32(-(sint)quotient);
+                  }
+                  if(divisor_neg)
+                     quotient = (uint)MASK_OUT_ABOVE_32(-(sint)quotient);
+               }
+
+               REG_D[word2 & 7] = remainder;
+               REG_D[(word2 >> 12) & 7] = quotient;
+
+               FLAG_N = NFLAG_32(quotient);
+               FLAG_Z = quotient;
+               FLAG_V = VFLAG_CLEAR;
+               FLAG_C = CFLAG_CLEAR;
+               goto m68k_op_divl_32_pcix_done;
+            }
+
+            /* long / long: long quotient, maybe long remainder */
+            if(BIT_B(word2))	   /* signed */
+            {
+               /* Special case in divide */
+               if(dividend_lo == 0x80000000 && divisor == 0xffffffff)
+               {
+                  FLAG_N = NFLAG_SET;
+                  FLAG_Z = ZFLAG_CLEAR;
+                  FLAG_V = VFLAG_CLEAR;
+                  FLAG_C = CFLAG_CLEAR;
+                  REG_D[(word2 >> 12) & 7] = 0x80000000;
+                  REG_D[word2 & 7] = 0;
+                  goto m68k_op_divl_32_pcix_done;
+               }
+               REG_D[word2 & 7] = MAKE_INT_32(dividend_lo) % MAKE_INT_32(divisor);
+               quotient = REG_D[(word2 >> 12) & 7] = MAKE_INT_32(dividend_lo) / MAKE_INT_32(divisor);
+            }
+            else
+            {
+               REG_D[word2 & 7] = MASK_OUT_ABOVE_32(dividend_lo) % MASK_OUT_ABOVE_32(divisor);
+               quotient = REG_D[(word2 >> 12) & 7] = MASK_OUT_ABOVE_32(dividend_lo) / MASK_OUT_ABOVE_32(divisor);
+            }
+
+            FLAG_N = NFLAG_32(quotient);
+            FLAG_Z = quotient;
+            FLAG_V = VFLAG_CLEAR;
+            FLAG_C = CFLAG_CLEAR;
+            goto m68k_op_divl_32_pcix_done;
+         }
+         m68ki_exception_trap(EXCEPTION_ZERO_DIVIDE);
+         goto m68k_op_divl_32_pcix_done;
+      }
+      m68ki_exception_illegal();
+
+   #endif
+   }
+m68k_op_divl_32_pcix_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_divl_32_i:
+   {
+      m68ki_resolve_flags();
+   #if M68K_USE_64_BIT
+
+      if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+      {
+         uint word2 = OPER_I_16();
+         uint64 divisor = OPER_I_32();
+         uint64 dividend  = 0;
+         uint64 quotient  = 0;
+         uint64 remainder = 0;
+
+         if(divisor != 0)
+         {
+            if(BIT_A(word2))	/* 64 bit */
+            {
+               dividend = REG_D[word2 & 7];
+               dividend <<= 32;
+               dividend |= REG_D[(word2 >> 12) & 7];
+
+               if(BIT_B(word2))	   /* signed */
+               {
+                  quotient  = (uint64)((sint64)dividend / (sint64)((sint32)divisor));
+                  remainder = (uint64)((sint64)dividend % (sint64)((sint32)divisor));
+                  if((sint64)quotient != (sint64)((sint32)quotient))
+                  {
+                     FLAG_V = VFLAG_SET;
+                     goto m68k_op_divl_32_i_done;
+                  }
+               }
+               else					/* unsigned */
+               {
+                  quotient = dividend / divisor;
+                  if(quotient > 0xffffffff)
+                  {
+                     FLAG_V = VFLAG_SET;
+                     goto m68k_op_divl_32_i_done;
+                  }
+                  remainder = dividend % divisor;
+               }
+            }
+            else	/* 32 bit */
+            {
+               dividend = REG_D[(word2 >> 12) & 7];
+               if(BIT_B(word2))	   /* signed */
+               {
+                  quotient  = (uint64)((sint64)((sint32)dividend) / (sint64)((sint32)divisor));
+                  remainder = (uint64)((sint64)((sint32)dividend) % (sint64)((sint32)divisor));
+               }
+               else					/* unsigned */
+               {
+                  quotient = dividend / divisor;
+                  remainder = dividend % divisor;
+               }
+            }
+
+            REG_D[word2 & 7] = remainder;
+            REG_D[(word2 >> 12) & 7] = quotient;
+
+            FLAG_N = NFLAG_32(quotient);
+            FLAG_Z = quotient;
+            FLAG_V = VFLAG_CLEAR;
+            FLAG_C = CFLAG_CLEAR;
+            goto m68k_op_divl_32_i_done;
+         }
+         m68ki_exception_trap(EXCEPTION_ZERO_DIVIDE);
+         goto m68k_op_divl_32_i_done;
+      }
+      m68ki_exception_illegal();
+
+   #else
+
+      if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+      {
+         uint word2 = OPER_I_16();
+         uint divisor = OPER_I_32();
+         uint dividend_hi = REG_D[word2 & 7];
+         uint dividend_lo = REG_D[(word2 >> 12) & 7];
+         uint quotient = 0;
+         uint remainder = 0;
+         uint dividend_neg = 0;
+         uint divisor_neg = 0;
+         sint i;
+         uint overflow;
+
+         if(divisor != 0)
+         {
+            /* quad / long : long quotient, long remainder */
+            if(BIT_A(word2))
+            {
+               if(BIT_B(word2))	   /* signed */
+               {
+                  /* special case in signed divide */
+                  if(dividend_hi == 0 && dividend_lo == 0x80000000 && divisor == 0xffffffff)
+                  {
+                     REG_D[word2 & 7] = 0;
+                     REG_D[(word2 >> 12) & 7] = 0x80000000;
+
+                     FLAG_N = NFLAG_SET;
+                     FLAG_Z = ZFLAG_CLEAR;
+                     FLAG_V = VFLAG_CLEAR;
+                     FLAG_C = CFLAG_CLEAR;
+                     goto m68k_op_divl_32_i_done;
+                  }
+                  if(GET_MSB_32(dividend_hi))
+                  {
+                     dividend_neg = 1;
+                     dividend_hi = (uint)MASK_OUT_ABOVE_32((-(sint)dividend_hi) - (dividend_lo != 0));
+                     dividend_lo = (uint)MASK_OUT_ABOVE_32(-(sint)dividend_lo);
+                  }
+                  if(GET_MSB_32(divisor))
+                  {
+                     divisor_neg = 1;
+                     divisor = (uint)MASK_OUT_ABOVE_32(-(sint)divisor);
+
+                  }
+               }
+
+               /* if the upper long is greater than the divisor, we're overflowing. */
+               if(dividend_hi >= divisor)
+               {
+                  FLAG_V = VFLAG_SET;
+                  goto m68k_op_divl_32_i_done;
+               }
+
+               for(i = 31; i >= 0; i--)
+               {
+                  quotient <<= 1;
+                  remainder = (remainder << 1) + ((dividend_hi >> i) & 1);
+                  if(remainder >= divisor)
+                  {
+                     remainder -= divisor;
+                     quotient++;
+                  }
+               }
+               for(i = 31; i >= 0; i--)
+               {
+                  quotient <<= 1;
+                  overflow = GET_MSB_32(remainder);
+                  remainder = (remainder << 1) + ((dividend_lo >> i) & 1);
+                  if(remainder >= divisor || overflow)
+                  {
+                     remainder -= divisor;
+                     quotient++;
+                  }
+               }
+
+               if(BIT_B(word2))	   /* signed */
+               {
+                  if(quotient > 0x7fffffff)
+                  {
+                     FLAG_V = VFLAG_SET;
+                     goto m68k_op_divl_32_i_done;
+                  }
+                  if(dividend_neg)
+                  {
+                     remainder = (uint)MASK_OUT_ABOVE_32(-(sint)remainder);
+                     quotient = (uint)MASK_OUT_ABOVE_32(-(sint)quotient);
+                  }
+                  if(divisor_neg)
+                     quotient = (uint)MASK_OUT_ABOVE_32(-(sint)quotient);
+               }
+
+               REG_D[word2 & 7] = remainder;
+               REG_D[(word2 >> 12) & 7] = quotient;
+
+               FLAG_N = NFLAG_32(quotient);
+               FLAG_Z = quotient;
+               FLAG_V = VFLAG_CLEAR;
+               FLAG_C = CFLAG_CLEAR;
+               goto m68k_op_divl_32_i_done;
+            }
+
+            /* long / long: long quotient, maybe long remainder */
+            if(BIT_B(word2))	   /* signed */
+            {
+               /* Special case in divide */
+               if(dividend_lo == 0x80000000 && divisor == 0xffffffff)
+               {
+                  FLAG_N = NFLAG_SET;
+                  FLAG_Z = ZFLAG_CLEAR;
+                  FLAG_V = VFLAG_CLEAR;
+                  FLAG_C = CFLAG_CLEAR;
+                  REG_D[(word2 >> 12) & 7] = 0x80000000;
+                  REG_D[word2 & 7] = 0;
+                  goto m68k_op_divl_32_i_done;
+               }
+               REG_D[word2 & 7] = MAKE_INT_32(dividend_lo) % MAKE_INT_32(divisor);
+               quotient = REG_D[(word2 >> 12) & 7] = MAKE_INT_32(dividend_lo) / MAKE_INT_32(divisor);
+            }
+            else
+            {
+               REG_D[word2 & 7] = MASK_OUT_ABOVE_32(dividend_lo) % MASK_OUT_ABOVE_32(divisor);
+               quotient = REG_D[(word2 >> 12) & 7] = MASK_OUT_ABOVE_32(dividend_lo) / MASK_OUT_ABOVE_32(divisor);
+            }
+
+            FLAG_N = NFLAG_32(quotient);
+            FLAG_Z = quotient;
+            FLAG_V = VFLAG_CLEAR;
+            FLAG_C = CFLAG_CLEAR;
+            goto m68k_op_divl_32_i_done;
+         }
+         m68ki_exception_trap(EXCEPTION_ZERO_DIVIDE);
+         goto m68k_op_divl_32_i_done;
+      }
+      m68ki_exception_illegal();
+
+   #endif
+   }
+m68k_op_divl_32_i_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_eor_8_d:
+   {
+      uint res = MASK_OUT_ABOVE_8(DY ^= MASK_OUT_ABOVE_8(DX));
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_8(res);
+      FLAG_Z = res;
+      FLAG_C = CFLAG_CLEAR;
+      FLAG_V = VFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_eor_8_ai:
+   {
+      uint ea = EA_AY_AI_8();
+      uint res = MASK_OUT_ABOVE_8(DX ^ m68ki_read_8(ea));
+
+      m68ki_write_8(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_8(res);
+      FLAG_Z = res;
+      FLAG_C = CFLAG_CLEAR;
+      FLAG_V = VFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_eor_8_pi:
+   {
+      uint ea = EA_AY_PI_8();
+      uint res = MASK_OUT_ABOVE_8(DX ^ m68ki_read_8(ea));
+
+      m68ki_write_8(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_8(res);
+      FLAG_Z = res;
+      FLAG_C = CFLAG_CLEAR;
+      FLAG_V = VFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_eor_8_pi7:
+   {
+      uint ea = EA_A7_PI_8();
+      uint res = MASK_OUT_ABOVE_8(DX ^ m68ki_read_8(ea));
+
+      m68ki_write_8(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_8(res);
+      FLAG_Z = res;
+      FLAG_C = CFLAG_CLEAR;
+      FLAG_V = VFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_eor_8_pd:
+   {
+      uint ea = EA_AY_PD_8();
+      uint res = MASK_OUT_ABOVE_8(DX ^ m68ki_read_8(ea));
+
+      m68ki_write_8(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_8(res);
+      FLAG_Z = res;
+      FLAG_C = CFLAG_CLEAR;
+      FLAG_V = VFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_eor_8_pd7:
+   {
+      uint ea = EA_A7_PD_8();
+      uint res = MASK_OUT_ABOVE_8(DX ^ m68ki_read_8(ea));
+
+      m68ki_write_8(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_8(res);
+      FLAG_Z = res;
+      FLAG_C = CFLAG_CLEAR;
+      FLAG_V = VFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_eor_8_di:
+   {
+      uint ea = EA_AY_DI_8();
+      uint res = MASK_OUT_ABOVE_8(DX ^ m68ki_read_8(ea));
+
+      m68ki_write_8(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_8(res);
+      FLAG_Z = res;
+      FLAG_C = CFLAG_CLEAR;
+      FLAG_V = VFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_eor_8_ix:
+   {
+      uint ea = EA_AY_IX_8();
+      uint res = MASK_OUT_ABOVE_8(DX ^ m68ki_read_8(ea));
+
+      m68ki_write_8(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_8(res);
+      FLAG_Z = res;
+      FLAG_C = CFLAG_CLEAR;
+      FLAG_V = VFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_eor_8_aw:
+   {
+      uint ea = EA_AW_8();
+      uint res = MASK_OUT_ABOVE_8(DX ^ m68ki_read_8(ea));
+
+      m68ki_write_8(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_8(res);
+      FLAG_Z = res;
+      FLAG_C = CFLAG_CLEAR;
+      FLAG_V = VFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_eor_8_al:
+   {
+      uint ea = EA_AL_8();
+      uint res = MASK_OUT_ABOVE_8(DX ^ m68ki_read_8(ea));
+
+      m68ki_write_8(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_8(res);
+      FLAG_Z = res;
+      FLAG_C = CFLAG_CLEAR;
+      FLAG_V = VFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_eor_16_d:
+   {
+      uint res = MASK_OUT_ABOVE_16(DY ^= MASK_OUT_ABOVE_16(DX));
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_16(res);
+      FLAG_Z = res;
+      FLAG_C = CFLAG_CLEAR;
+      FLAG_V = VFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_eor_16_ai:
+   {
+      uint ea = EA_AY_AI_16();
+      uint res = MASK_OUT_ABOVE_16(DX ^ m68ki_read_16(ea));
+
+      m68ki_write_16(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_16(res);
+      FLAG_Z = res;
+      FLAG_C = CFLAG_CLEAR;
+      FLAG_V = VFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_eor_16_pi:
+   {
+      uint ea = EA_AY_PI_16();
+      uint res = MASK_OUT_ABOVE_16(DX ^ m68ki_read_16(ea));
+
+      m68ki_write_16(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_16(res);
+      FLAG_Z = res;
+      FLAG_C = CFLAG_CLEAR;
+      FLAG_V = VFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_eor_16_pd:
+   {
+      uint ea = EA_AY_PD_16();
+      uint res = MASK_OUT_ABOVE_16(DX ^ m68ki_read_16(ea));
+
+      m68ki_write_16(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_16(res);
+      FLAG_Z = res;
+      FLAG_C = CFLAG_CLEAR;
+      FLAG_V = VFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_eor_16_di:
+   {
+      uint ea = EA_AY_DI_16();
+      uint res = MASK_OUT_ABOVE_16(DX ^ m68ki_read_16(ea));
+
+      m68ki_write_16(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_16(res);
+      FLAG_Z = res;
+      FLAG_C = CFLAG_CLEAR;
+      FLAG_V = VFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_eor_16_ix:
+   {
+      uint ea = EA_AY_IX_16();
+      uint res = MASK_OUT_ABOVE_16(DX ^ m68ki_read_16(ea));
+
+      m68ki_write_16(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_16(res);
+      FLAG_Z = res;
+      FLAG_C = CFLAG_CLEAR;
+      FLAG_V = VFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_eor_16_aw:
+   {
+      uint ea = EA_AW_16();
+      uint res = MASK_OUT_ABOVE_16(DX ^ m68ki_read_16(ea));
+
+      m68ki_write_16(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_16(res);
+      FLAG_Z = res;
+      FLAG_C = CFLAG_CLEAR;
+      FLAG_V = VFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_eor_16_al:
+   {
+      uint ea = EA_AL_16();
+      uint res = MASK_OUT_ABOVE_16(DX ^ m68ki_read_16(ea));
+
+      m68ki_write_16(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_16(res);
+      FLAG_Z = res;
+      FLAG_C = CFLAG_CLEAR;
+      FLAG_V = VFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_eor_32_d:
+   {
+      uint res = DY ^= DX;
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_32(res);
+      FLAG_Z = res;
+      FLAG_C = CFLAG_CLEAR;
+      FLAG_V = VFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_eor_32_ai:
+   {
+      uint ea = EA_AY_AI_32();
+      uint res = DX ^ m68ki_read_32(ea);
+
+      m68ki_write_32(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_32(res);
+      FLAG_Z = res;
+      FLAG_C = CFLAG_CLEAR;
+      FLAG_V = VFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_eor_32_pi:
+   {
+      uint ea = EA_AY_PI_32();
+      uint res = DX ^ m68ki_read_32(ea);
+
+      m68ki_write_32(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_32(res);
+      FLAG_Z = res;
+      FLAG_C = CFLAG_CLEAR;
+      FLAG_V = VFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_eor_32_pd:
+   {
+      uint ea = EA_AY_PD_32();
+      uint res = DX ^ m68ki_read_32(ea);
+
+      m68ki_write_32(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_32(res);
+      FLAG_Z = res;
+      FLAG_C = CFLAG_CLEAR;
+      FLAG_V = VFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_eor_32_di:
+   {
+      uint ea = EA_AY_DI_32();
+      uint res = DX ^ m68ki_read_32(ea);
+
+      m68ki_write_32(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_32(res);
+      FLAG_Z = res;
+      FLAG_C = CFLAG_CLEAR;
+      FLAG_V = VFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_eor_32_ix:
+   {
+      uint ea = EA_AY_IX_32();
+      uint res = DX ^ m68ki_read_32(ea);
+
+      m68ki_write_32(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_32(res);
+      FLAG_Z = res;
+      FLAG_C = CFLAG_CLEAR;
+      FLAG_V = VFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_eor_32_aw:
+   {
+      uint ea = EA_AW_32();
+      uint res = DX ^ m68ki_read_32(ea);
+
+      m68ki_write_32(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_32(res);
+      FLAG_Z = res;
+      FLAG_C = CFLAG_CLEAR;
+      FLAG_V = VFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_eor_32_al:
+   {
+      uint ea = EA_AL_32();
+      uint res = DX ^ m68ki_read_32(ea);
+
+      m68ki_write_32(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_32(res);
+      FLAG_Z = res;
+      FLAG_C = CFLAG_CLEAR;
+      FLAG_V = VFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_eori_8_d:
+   {
+      uint res = MASK_OUT_ABOVE_8(DY ^= OPER_I_8());
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_8(res);
+      FLAG_Z = res;
+      FLAG_C = CFLAG_CLEAR;
+      FLAG_V = VFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_eori_8_ai:
+   {
+      uint src = OPER_I_8();
+      uint ea = EA_AY_AI_8();
+      uint res = src ^ m68ki_read_8(ea);
+
+      m68ki_write_8(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_8(res);
+      FLAG_Z = res;
+      FLAG_C = CFLAG_CLEAR;
+      FLAG_V = VFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_eori_8_pi:
+   {
+      uint src = OPER_I_8();
+      uint ea = EA_AY_PI_8();
+      uint res = src ^ m68ki_read_8(ea);
+
+      m68ki_write_8(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_8(res);
+      FLAG_Z = res;
+      FLAG_C = CFLAG_CLEAR;
+      FLAG_V = VFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_eori_8_pi7:
+   {
+      uint src = OPER_I_8();
+      uint ea = EA_A7_PI_8();
+      uint res = src ^ m68ki_read_8(ea);
+
+      m68ki_write_8(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_8(res);
+      FLAG_Z = res;
+      FLAG_C = CFLAG_CLEAR;
+      FLAG_V = VFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_eori_8_pd:
+   {
+      uint src = OPER_I_8();
+      uint ea = EA_AY_PD_8();
+      uint res = src ^ m68ki_read_8(ea);
+
+      m68ki_write_8(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_8(res);
+      FLAG_Z = res;
+      FLAG_C = CFLAG_CLEAR;
+      FLAG_V = VFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_eori_8_pd7:
+   {
+      uint src = OPER_I_8();
+      uint ea = EA_A7_PD_8();
+      uint res = src ^ m68ki_read_8(ea);
+
+      m68ki_write_8(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_8(res);
+      FLAG_Z = res;
+      FLAG_C = CFLAG_CLEAR;
+      FLAG_V = VFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_eori_8_di:
+   {
+      uint src = OPER_I_8();
+      uint ea = EA_AY_DI_8();
+      uint res = src ^ m68ki_read_8(ea);
+
+      m68ki_write_8(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_8(res);
+      FLAG_Z = res;
+      FLAG_C = CFLAG_CLEAR;
+      FLAG_V = VFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_eori_8_ix:
+   {
+      uint src = OPER_I_8();
+      uint ea = EA_AY_IX_8();
+      uint res = src ^ m68ki_read_8(ea);
+
+      m68ki_write_8(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_8(res);
+      FLAG_Z = res;
+      FLAG_C = CFLAG_CLEAR;
+      FLAG_V = VFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_eori_8_aw:
+   {
+      uint src = OPER_I_8();
+      uint ea = EA_AW_8();
+      uint res = src ^ m68ki_read_8(ea);
+
+      m68ki_write_8(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_8(res);
+      FLAG_Z = res;
+      FLAG_C = CFLAG_CLEAR;
+      FLAG_V = VFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_eori_8_al:
+   {
+      uint src = OPER_I_8();
+      uint ea = EA_AL_8();
+      uint res = src ^ m68ki_read_8(ea);
+
+      m68ki_write_8(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_8(res);
+      FLAG_Z = res;
+      FLAG_C = CFLAG_CLEAR;
+      FLAG_V = VFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_eori_16_d:
+   {
+      uint res = MASK_OUT_ABOVE_16(DY ^= OPER_I_16());
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_16(res);
+      FLAG_Z = res;
+      FLAG_C = CFLAG_CLEAR;
+      FLAG_V = VFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_eori_16_ai:
+   {
+      uint src = OPER_I_16();
+      uint ea = EA_AY_AI_16();
+      uint res = src ^ m68ki_read_16(ea);
+
+      m68ki_write_16(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_16(res);
+      FLAG_Z = res;
+      FLAG_C = CFLAG_CLEAR;
+      FLAG_V = VFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_eori_16_pi:
+   {
+      uint src = OPER_I_16();
+      uint ea = EA_AY_PI_16();
+      uint res = src ^ m68ki_read_16(ea);
+
+      m68ki_write_16(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_16(res);
+      FLAG_Z = res;
+      FLAG_C = CFLAG_CLEAR;
+      FLAG_V = VFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_eori_16_pd:
+   {
+      uint src = OPER_I_16();
+      uint ea = EA_AY_PD_16();
+      uint res = src ^ m68ki_read_16(ea);
+
+      m68ki_write_16(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_16(res);
+      FLAG_Z = res;
+      FLAG_C = CFLAG_CLEAR;
+      FLAG_V = VFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_eori_16_di:
+   {
+      uint src = OPER_I_16();
+      uint ea = EA_AY_DI_16();
+      uint res = src ^ m68ki_read_16(ea);
+
+      m68ki_write_16(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_16(res);
+      FLAG_Z = res;
+      FLAG_C = CFLAG_CLEAR;
+      FLAG_V = VFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_eori_16_ix:
+   {
+      uint src = OPER_I_16();
+      uint ea = EA_AY_IX_16();
+      uint res = src ^ m68ki_read_16(ea);
+
+      m68ki_write_16(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_16(res);
+      FLAG_Z = res;
+      FLAG_C = CFLAG_CLEAR;
+      FLAG_V = VFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_eori_16_aw:
+   {
+      uint src = OPER_I_16();
+      uint ea = EA_AW_16();
+      uint res = src ^ m68ki_read_16(ea);
+
+      m68ki_write_16(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_16(res);
+      FLAG_Z = res;
+      FLAG_C = CFLAG_CLEAR;
+      FLAG_V = VFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_eori_16_al:
+   {
+      uint src = OPER_I_16();
+      uint ea = EA_AL_16();
+      uint res = src ^ m68ki_read_16(ea);
+
+      m68ki_write_16(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_16(res);
+      FLAG_Z = res;
+      FLAG_C = CFLAG_CLEAR;
+      FLAG_V = VFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_eori_32_d:
+   {
+      uint res = DY ^= OPER_I_32();
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_32(res);
+      FLAG_Z = res;
+      FLAG_C = CFLAG_CLEAR;
+      FLAG_V = VFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_eori_32_ai:
+   {
+      uint src = OPER_I_32();
+      uint ea = EA_AY_AI_32();
+      uint res = src ^ m68ki_read_32(ea);
+
+      m68ki_write_32(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_32(res);
+      FLAG_Z = res;
+      FLAG_C = CFLAG_CLEAR;
+      FLAG_V = VFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_eori_32_pi:
+   {
+      uint src = OPER_I_32();
+      uint ea = EA_AY_PI_32();
+      uint res = src ^ m68ki_read_32(ea);
+
+      m68ki_write_32(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_32(res);
+      FLAG_Z = res;
+      FLAG_C = CFLAG_CLEAR;
+      FLAG_V = VFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_eori_32_pd:
+   {
+      uint src = OPER_I_32();
+      uint ea = EA_AY_PD_32();
+      uint res = src ^ m68ki_read_32(ea);
+
+      m68ki_write_32(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_32(res);
+      FLAG_Z = res;
+      FLAG_C = CFLAG_CLEAR;
+      FLAG_V = VFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_eori_32_di:
+   {
+      uint src = OPER_I_32();
+      uint ea = EA_AY_DI_32();
+      uint res = src ^ m68ki_read_32(ea);
+
+      m68ki_write_32(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_32(res);
+      FLAG_Z = res;
+      FLAG_C = CFLAG_CLEAR;
+      FLAG_V = VFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_eori_32_ix:
+   {
+      uint src = OPER_I_32();
+      uint ea = EA_AY_IX_32();
+      uint res = src ^ m68ki_read_32(ea);
+
+      m68ki_write_32(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_32(res);
+      FLAG_Z = res;
+      FLAG_C = CFLAG_CLEAR;
+      FLAG_V = VFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_eori_32_aw:
+   {
+      uint src = OPER_I_32();
+      uint ea = EA_AW_32();
+      uint res = src ^ m68ki_read_32(ea);
+
+      m68ki_write_32(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_32(res);
+      FLAG_Z = res;
+      FLAG_C = CFLAG_CLEAR;
+      FLAG_V = VFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_eori_32_al:
+   {
+      uint src = OPER_I_32();
+      uint ea = EA_AL_32();
+      uint res = src ^ m68ki_read_32(ea);
+
+      m68ki_write_32(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_32(res);
+      FLAG_Z = res;
+      FLAG_C = CFLAG_CLEAR;
+      FLAG_V = VFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_eori_8_toc:
+   {
+      m68ki_set_ccr(m68ki_get_ccr() ^ OPER_I_8());
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_eori_16_tos:
+   {
+      if(FLAG_S)
+      {
+         uint src = OPER_I_16();
+         m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
+         m68ki_set_sr(m68ki_get_sr() ^ src);
+         goto m68k_op_eori_16_tos_done;
+      }
+      m68ki_exception_privilege_violation();
+   }
+m68k_op_eori_16_tos_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_exg_32_dd:
+   {
+      uint* reg_a = &DX;
+      uint* reg_b = &DY;
+      uint tmp = *reg_a;
+      *reg_a = *reg_b;
+      *reg_b = tmp;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_exg_32_aa:
+   {
+      uint* reg_a = &AX;
+      uint* reg_b = &AY;
+      uint tmp = *reg_a;
+      *reg_a = *reg_b;
+      *reg_b = tmp;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_exg_32_da:
+   {
+      uint* reg_a = &DX;
+      uint* reg_b = &AY;
+      uint tmp = *reg_a;
+      *reg_a = *reg_b;
+      *reg_b = tmp;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_ext_16:
+   {
+      uint* r_dst = &DY;
+
+      *r_dst = MASK_OUT_BELOW_16(*r_dst) | MASK_OUT_ABOVE_8(*r_dst) | (GET_MSB_8(*r_dst) ? 0xff00 : 0);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_16(*r_dst);
+      FLAG_Z = MASK_OUT_ABOVE_16(*r_dst);
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_ext_32:
+   {
+      uint* r_dst = &DY;
+
+      *r_dst = MASK_OUT_ABOVE_16(*r_dst) | (GET_MSB_16(*r_dst) ? 0xffff0000 : 0);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_32(*r_dst);
+      FLAG_Z = *r_dst;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_extb_32:
+   {
+      m68ki_resolve_flags();
+      if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+      {
+         uint* r_dst = &DY;
+
+         *r_dst = MASK_OUT_ABOVE_8(*r_dst) | (GET_MSB_8(*r_dst) ? 0xffffff00 : 0);
+
+         FLAG_N = NFLAG_32(*r_dst);
+         FLAG_Z = *r_dst;
+         FLAG_V = VFLAG_CLEAR;
+         FLAG_C = CFLAG_CLEAR;
+         goto m68k_op_extb_32_done;
+      }
+      m68ki_exception_illegal();
+   }
+m68k_op_extb_32_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_illegal:
+   {
+      m68ki_exception_illegal();
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_jmp_32_ai:
+   {
+      m68ki_jump(EA_AY_AI_32());
+      m68ki_trace_t0();				   /* auto-disable (see m68kcpu.h) */
+      if(REG_PC == REG_PPC)
+         USE_ALL_CYCLES();
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_jmp_32_di:
+   {
+      m68ki_jump(EA_AY_DI_32());
+      m68ki_trace_t0();				   /* auto-disable (see m68kcpu.h) */
+      if(REG_PC == REG_PPC)
+         USE_ALL_CYCLES();
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_jmp_32_ix:
+   {
+      m68ki_jump(EA_AY_IX_32());
+      m68ki_trace_t0();				   /* auto-disable (see m68kcpu.h) */
+      if(REG_PC == REG_PPC)
+         USE_ALL_CYCLES();
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_jmp_32_aw:
+   {
+      m68ki_jump(EA_AW_32());
+      m68ki_trace_t0();				   /* auto-disable (see m68kcpu.h) */
+      if(REG_PC == REG_PPC)
+         USE_ALL_CYCLES();
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_jmp_32_al:
+   {
+      m68ki_jump(EA_AL_32());
+      m68ki_trace_t0();				   /* auto-disable (see m68kcpu.h) */
+      if(REG_PC == REG_PPC)
+         USE_ALL_CYCLES();
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_jmp_32_pcdi:
+   {
+      m68ki_jump(EA_PCDI_32());
+      m68ki_trace_t0();				   /* auto-disable (see m68kcpu.h) */
+      if(REG_PC == REG_PPC)
+         USE_ALL_CYCLES();
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_jmp_32_pcix:
+   {
+      m68ki_jump(EA_PCIX_32());
+      m68ki_trace_t0();				   /* auto-disable (see m68kcpu.h) */
+      if(REG_PC == REG_PPC)
+         USE_ALL_CYCLES();
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_jsr_32_ai:
+   {
+      uint ea = EA_AY_AI_32();
+      m68ki_trace_t0();				   /* auto-disable (see m68kcpu.h) */
+      m68ki_push_32(REG_PC);
+      m68ki_jump(ea);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_jsr_32_di:
+   {
+      uint ea = EA_AY_DI_32();
+      m68ki_trace_t0();				   /* auto-disable (see m68kcpu.h) */
+      m68ki_push_32(REG_PC);
+      m68ki_jump(ea);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_jsr_32_ix:
+   {
+      uint ea = EA_AY_IX_32();
+      m68ki_trace_t0();				   /* auto-disable (see m68kcpu.h) */
+      m68ki_push_32(REG_PC);
+      m68ki_jump(ea);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_jsr_32_aw:
+   {
+      uint ea = EA_AW_32();
+      m68ki_trace_t0();				   /* auto-disable (see m68kcpu.h) */
+      m68ki_push_32(REG_PC);
+      m68ki_jump(ea);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_jsr_32_al:
+   {
+      uint ea = EA_AL_32();
+      m68ki_trace_t0();				   /* auto-disable (see m68kcpu.h) */
+      m68ki_push_32(REG_PC);
+      m68ki_jump(ea);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_jsr_32_pcdi:
+   {
+      uint ea = EA_PCDI_32();
+      m68ki_trace_t0();				   /* auto-disable (see m68kcpu.h) */
+      m68ki_push_32(REG_PC);
+      m68ki_jump(ea);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_jsr_32_pcix:
+   {
+      uint ea = EA_PCIX_32();
+      m68ki_trace_t0();				   /* auto-disable (see m68kcpu.h) */
+      m68ki_push_32(REG_PC);
+      m68ki_jump(ea);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_lea_32_ai:
+   {
+      AX = EA_AY_AI_32();
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_lea_32_di:
+   {
+      AX = EA_AY_DI_32();
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_lea_32_ix:
+   {
+      AX = EA_AY_IX_32();
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_lea_32_aw:
+   {
+      AX = EA_AW_32();
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_lea_32_al:
+   {
+      AX = EA_AL_32();
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_lea_32_pcdi:
+   {
+      AX = EA_PCDI_32();
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_lea_32_pcix:
+   {
+      AX = EA_PCIX_32();
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_link_16_a7:
+   {
+      REG_A[7] -= 4;
+      m68ki_write_32(REG_A[7], REG_A[7]);
+      REG_A[7] = MASK_OUT_ABOVE_32(REG_A[7] + MAKE_INT_16(OPER_I_16()));
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_link_16:
+   {
+      uint* r_dst = &AY;
+
+      m68ki_push_32(*r_dst);
+      *r_dst = REG_A[7];
+      REG_A[7] = MASK_OUT_ABOVE_32(REG_A[7] + MAKE_INT_16(OPER_I_16()));
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_link_32_a7:
+   {
+      if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+      {
+         REG_A[7] -= 4;
+         m68ki_write_32(REG_A[7], REG_A[7]);
+         REG_A[7] = MASK_OUT_ABOVE_32(REG_A[7] + OPER_I_32());
+         goto m68k_op_link_32_a7_done;
+      }
+      m68ki_exception_illegal();
+   }
+m68k_op_link_32_a7_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_link_32:
+   {
+      if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+      {
+         uint* r_dst = &AY;
+
+         m68ki_push_32(*r_dst);
+         *r_dst = REG_A[7];
+         REG_A[7] = MASK_OUT_ABOVE_32(REG_A[7] + OPER_I_32());
+         goto m68k_op_link_32_done;
+      }
+      m68ki_exception_illegal();
+   }
+m68k_op_link_32_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_lsr_8_s:
+   {
+      uint* r_dst = &DY;
+      uint shift = (((REG_IR >> 9) - 1) & 7) + 1;
+      uint src = MASK_OUT_ABOVE_8(*r_dst);
+      uint res = src >> shift;
+
+      *r_dst = MASK_OUT_BELOW_8(*r_dst) | res;
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_CLEAR;
+      FLAG_Z = res;
+      FLAG_X = FLAG_C = src << (9-shift);
+      FLAG_V = VFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_lsr_16_s:
+   {
+      uint* r_dst = &DY;
+      uint shift = (((REG_IR >> 9) - 1) & 7) + 1;
+      uint src = MASK_OUT_ABOVE_16(*r_dst);
+      uint res = src >> shift;
+
+      *r_dst = MASK_OUT_BELOW_16(*r_dst) | res;
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_CLEAR;
+      FLAG_Z = res;
+      FLAG_X = FLAG_C = src << (9-shift);
+      FLAG_V = VFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_lsr_32_s:
+   {
+      uint* r_dst = &DY;
+      uint shift = (((REG_IR >> 9) - 1) & 7) + 1;
+      uint src = *r_dst;
+      uint res = src >> shift;
+
+      *r_dst = res;
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_CLEAR;
+      FLAG_Z = res;
+      FLAG_X = FLAG_C = src << (9-shift);
+      FLAG_V = VFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_lsr_8_r:
+   {
+      uint* r_dst = &DY;
+      uint shift = DX & 0x3f;
+      uint src = MASK_OUT_ABOVE_8(*r_dst);
+      uint res = src >> shift;
+
+      m68ki_resolve_flags();
+
+      if(shift != 0)
+      {
+         USE_CYCLES(shift<<CYC_SHIFT);
+
+         if(shift <= 8)
+         {
+            *r_dst = MASK_OUT_BELOW_8(*r_dst) | res;
+            FLAG_X = FLAG_C = src << (9-shift);
+            FLAG_N = NFLAG_CLEAR;
+            FLAG_Z = res;
+            FLAG_V = VFLAG_CLEAR;
+            goto m68k_op_lsr_8_r_done;
+         }
+
+         *r_dst &= 0xffffff00;
+         FLAG_X = XFLAG_CLEAR;
+         FLAG_C = CFLAG_CLEAR;
+         FLAG_N = NFLAG_CLEAR;
+         FLAG_Z = ZFLAG_SET;
+         FLAG_V = VFLAG_CLEAR;
+         goto m68k_op_lsr_8_r_done;
+      }
+
+      FLAG_C = CFLAG_CLEAR;
+      FLAG_N = NFLAG_8(src);
+      FLAG_Z = src;
+      FLAG_V = VFLAG_CLEAR;
+   }
+m68k_op_lsr_8_r_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_lsr_16_r:
+   {
+      uint* r_dst = &DY;
+      uint shift = DX & 0x3f;
+      uint src = MASK_OUT_ABOVE_16(*r_dst);
+      uint res = src >> shift;
+
+      m68ki_resolve_flags();
+
+      if(shift != 0)
+      {
+         USE_CYCLES(shift<<CYC_SHIFT);
+
+         if(shift <= 16)
+         {
+            *r_dst = MASK_OUT_BELOW_16(*r_dst) | res;
+            FLAG_C = FLAG_X = (src >> (shift - 1))<<8;
+            FLAG_N = NFLAG_CLEAR;
+            FLAG_Z = res;
+            FLAG_V = VFLAG_CLEAR;
+            goto m68k_op_lsr_16_r_done;
+         }
+
+         *r_dst &= 0xffff0000;
+         FLAG_X = XFLAG_CLEAR;
+         FLAG_C = CFLAG_CLEAR;
+         FLAG_N = NFLAG_CLEAR;
+         FLAG_Z = ZFLAG_SET;
+         FLAG_V = VFLAG_CLEAR;
+         goto m68k_op_lsr_16_r_done;
+      }
+
+      FLAG_C = CFLAG_CLEAR;
+      FLAG_N = NFLAG_16(src);
+      FLAG_Z = src;
+      FLAG_V = VFLAG_CLEAR;
+   }
+m68k_op_lsr_16_r_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_lsr_32_r:
+   {
+      uint* r_dst = &DY;
+      uint shift = DX & 0x3f;
+      uint src = *r_dst;
+      uint res = src >> shift;
+
+      m68ki_resolve_flags();
+
+      if(shift != 0)
+      {
+         USE_CYCLES(shift<<CYC_SHIFT);
+
+         if(shift < 32)
+         {
+            *r_dst = res;
+            FLAG_C = FLAG_X = (src >> (shift - 1))<<8;
+            FLAG_N = NFLAG_CLEAR;
+            FLAG_Z = res;
+            FLAG_V = VFLAG_CLEAR;
+            goto m68k_op_lsr_32_r_done;
+         }
+
+         *r_dst = 0;
+         FLAG_X = FLAG_C = (shift == 32 ? GET_MSB_32(src)>>23 : 0);
+         FLAG_N = NFLAG_CLEAR;
+         FLAG_Z = ZFLAG_SET;
+         FLAG_V = VFLAG_CLEAR;
+         goto m68k_op_lsr_32_r_done;
+      }
+
+      FLAG_C = CFLAG_CLEAR;
+      FLAG_N = NFLAG_32(src);
+      FLAG_Z = src;
+      FLAG_V = VFLAG_CLEAR;
+   }
+m68k_op_lsr_32_r_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_lsr_16_ai:
+   {
+      uint ea = EA_AY_AI_16();
+      uint src = m68ki_read_16(ea);
+      uint res = src >> 1;
+
+      m68ki_write_16(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_CLEAR;
+      FLAG_Z = res;
+      FLAG_C = FLAG_X = src << 8;
+      FLAG_V = VFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_lsr_16_pi:
+   {
+      uint ea = EA_AY_PI_16();
+      uint src = m68ki_read_16(ea);
+      uint res = src >> 1;
+
+      m68ki_write_16(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_CLEAR;
+      FLAG_Z = res;
+      FLAG_C = FLAG_X = src << 8;
+      FLAG_V = VFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_lsr_16_pd:
+   {
+      uint ea = EA_AY_PD_16();
+      uint src = m68ki_read_16(ea);
+      uint res = src >> 1;
+
+      m68ki_write_16(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_CLEAR;
+      FLAG_Z = res;
+      FLAG_C = FLAG_X = src << 8;
+      FLAG_V = VFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_lsr_16_di:
+   {
+      uint ea = EA_AY_DI_16();
+      uint src = m68ki_read_16(ea);
+      uint res = src >> 1;
+
+      m68ki_write_16(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_CLEAR;
+      FLAG_Z = res;
+      FLAG_C = FLAG_X = src << 8;
+      FLAG_V = VFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_lsr_16_ix:
+   {
+      uint ea = EA_AY_IX_16();
+      uint src = m68ki_read_16(ea);
+      uint res = src >> 1;
+
+      m68ki_write_16(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_CLEAR;
+      FLAG_Z = res;
+      FLAG_C = FLAG_X = src << 8;
+      FLAG_V = VFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_lsr_16_aw:
+   {
+      uint ea = EA_AW_16();
+      uint src = m68ki_read_16(ea);
+      uint res = src >> 1;
+
+      m68ki_write_16(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_CLEAR;
+      FLAG_Z = res;
+      FLAG_C = FLAG_X = src << 8;
+      FLAG_V = VFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_lsr_16_al:
+   {
+      uint ea = EA_AL_16();
+      uint src = m68ki_read_16(ea);
+      uint res = src >> 1;
+
+      m68ki_write_16(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_CLEAR;
+      FLAG_Z = res;
+      FLAG_C = FLAG_X = src << 8;
+      FLAG_V = VFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_lsl_8_s:
+   {
+      uint* r_dst = &DY;
+      uint shift = (((REG_IR >> 9) - 1) & 7) + 1;
+      uint src = MASK_OUT_ABOVE_8(*r_dst);
+      uint res = MASK_OUT_ABOVE_8(src << shift);
+
+      *r_dst = MASK_OUT_BELOW_8(*r_dst) | res;
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_8(res);
+      FLAG_Z = res;
+      FLAG_X = FLAG_C = src << shift;
+      FLAG_V = VFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_lsl_16_s:
+   {
+      uint* r_dst = &DY;
+      uint shift = (((REG_IR >> 9) - 1) & 7) + 1;
+      uint src = MASK_OUT_ABOVE_16(*r_dst);
+      uint res = MASK_OUT_ABOVE_16(src << shift);
+
+      *r_dst = MASK_OUT_BELOW_16(*r_dst) | res;
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_16(res);
+      FLAG_Z = res;
+      FLAG_X = FLAG_C = src >> (8-shift);
+      FLAG_V = VFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_lsl_32_s:
+   {
+      uint* r_dst = &DY;
+      uint shift = (((REG_IR >> 9) - 1) & 7) + 1;
+      uint src = *r_dst;
+      uint res = MASK_OUT_ABOVE_32(src << shift);
+
+      *r_dst = res;
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_32(res);
+      FLAG_Z = res;
+      FLAG_X = FLAG_C = src >> (24-shift);
+      FLAG_V = VFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_lsl_8_r:
+   {
+      uint* r_dst = &DY;
+      uint shift = DX & 0x3f;
+      uint src = MASK_OUT_ABOVE_8(*r_dst);
+      uint res = MASK_OUT_ABOVE_8(src << shift);
+
+      m68ki_resolve_flags();
+
+      if(shift != 0)
+      {
+         USE_CYCLES(shift<<CYC_SHIFT);
+
+         if(shift <= 8)
+         {
+            *r_dst = MASK_OUT_BELOW_8(*r_dst) | res;
+            FLAG_X = FLAG_C = src << shift;
+            FLAG_N = NFLAG_8(res);
+            FLAG_Z = res;
+            FLAG_V = VFLAG_CLEAR;
+            goto m68k_op_lsl_8_r_done;
+         }
+
+         *r_dst &= 0xffffff00;
+         FLAG_X = XFLAG_CLEAR;
+         FLAG_C = CFLAG_CLEAR;
+         FLAG_N = NFLAG_CLEAR;
+         FLAG_Z = ZFLAG_SET;
+         FLAG_V = VFLAG_CLEAR;
+         goto m68k_op_lsl_8_r_done;
+      }
+
+      FLAG_C = CFLAG_CLEAR;
+      FLAG_N = NFLAG_8(src);
+      FLAG_Z = src;
+      FLAG_V = VFLAG_CLEAR;
+   }
+m68k_op_lsl_8_r_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_lsl_16_r:
+   {
+      uint* r_dst = &DY;
+      uint shift = DX & 0x3f;
+      uint src = MASK_OUT_ABOVE_16(*r_dst);
+      uint res = MASK_OUT_ABOVE_16(src << shift);
+
+      m68ki_resolve_flags();
+
+      if(shift != 0)
+      {
+         USE_CYCLES(shift<<CYC_SHIFT);
+
+         if(shift <= 16)
+         {
+            *r_dst = MASK_OUT_BELOW_16(*r_dst) | res;
+            FLAG_X = FLAG_C = (src << shift) >> 8;
+            FLAG_N = NFLAG_16(res);
+            FLAG_Z = res;
+            FLAG_V = VFLAG_CLEAR;
+            goto m68k_op_lsl_16_r_done;
+         }
+
+         *r_dst &= 0xffff0000;
+         FLAG_X = XFLAG_CLEAR;
+         FLAG_C = CFLAG_CLEAR;
+         FLAG_N = NFLAG_CLEAR;
+         FLAG_Z = ZFLAG_SET;
+         FLAG_V = VFLAG_CLEAR;
+         goto m68k_op_lsl_16_r_done;
+      }
+
+      FLAG_C = CFLAG_CLEAR;
+      FLAG_N = NFLAG_16(src);
+      FLAG_Z = src;
+      FLAG_V = VFLAG_CLEAR;
+   }
+m68k_op_lsl_16_r_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_lsl_32_r:
+   {
+      uint* r_dst = &DY;
+      uint shift = DX & 0x3f;
+      uint src = *r_dst;
+      uint res = MASK_OUT_ABOVE_32(src << shift);
+
+      m68ki_resolve_flags();
+
+      if(shift != 0)
+      {
+         USE_CYCLES(shift<<CYC_SHIFT);
+
+         if(shift < 32)
+         {
+            *r_dst = res;
+            FLAG_X = FLAG_C = (src >> (32 - shift)) << 8;
+            FLAG_N = NFLAG_32(res);
+            FLAG_Z = res;
+            FLAG_V = VFLAG_CLEAR;
+            goto m68k_op_lsl_32_r_done;
+         }
+
+         *r_dst = 0;
+         FLAG_X = FLAG_C = ((shift == 32 ? src & 1 : 0))<<8;
+         FLAG_N = NFLAG_CLEAR;
+         FLAG_Z = ZFLAG_SET;
+         FLAG_V = VFLAG_CLEAR;
+         goto m68k_op_lsl_32_r_done;
+      }
+
+      FLAG_C = CFLAG_CLEAR;
+      FLAG_N = NFLAG_32(src);
+      FLAG_Z = src;
+      FLAG_V = VFLAG_CLEAR;
+   }
+m68k_op_lsl_32_r_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_lsl_16_ai:
+   {
+      uint ea = EA_AY_AI_16();
+      uint src = m68ki_read_16(ea);
+      uint res = MASK_OUT_ABOVE_16(src << 1);
+
+      m68ki_write_16(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_16(res);
+      FLAG_Z = res;
+      FLAG_X = FLAG_C = src >> 7;
+      FLAG_V = VFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_lsl_16_pi:
+   {
+      uint ea = EA_AY_PI_16();
+      uint src = m68ki_read_16(ea);
+      uint res = MASK_OUT_ABOVE_16(src << 1);
+
+      m68ki_write_16(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_16(res);
+      FLAG_Z = res;
+      FLAG_X = FLAG_C = src >> 7;
+      FLAG_V = VFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_lsl_16_pd:
+   {
+      uint ea = EA_AY_PD_16();
+      uint src = m68ki_read_16(ea);
+      uint res = MASK_OUT_ABOVE_16(src << 1);
+
+      m68ki_write_16(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_16(res);
+      FLAG_Z = res;
+      FLAG_X = FLAG_C = src >> 7;
+      FLAG_V = VFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_lsl_16_di:
+   {
+      uint ea = EA_AY_DI_16();
+      uint src = m68ki_read_16(ea);
+      uint res = MASK_OUT_ABOVE_16(src << 1);
+
+      m68ki_write_16(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_16(res);
+      FLAG_Z = res;
+      FLAG_X = FLAG_C = src >> 7;
+      FLAG_V = VFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_lsl_16_ix:
+   {
+      uint ea = EA_AY_IX_16();
+      uint src = m68ki_read_16(ea);
+      uint res = MASK_OUT_ABOVE_16(src << 1);
+
+      m68ki_write_16(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_16(res);
+      FLAG_Z = res;
+      FLAG_X = FLAG_C = src >> 7;
+      FLAG_V = VFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_lsl_16_aw:
+   {
+      uint ea = EA_AW_16();
+      uint src = m68ki_read_16(ea);
+      uint res = MASK_OUT_ABOVE_16(src << 1);
+
+      m68ki_write_16(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_16(res);
+      FLAG_Z = res;
+      FLAG_X = FLAG_C = src >> 7;
+      FLAG_V = VFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_lsl_16_al:
+   {
+      uint ea = EA_AL_16();
+      uint src = m68ki_read_16(ea);
+      uint res = MASK_OUT_ABOVE_16(src << 1);
+
+      m68ki_write_16(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_16(res);
+      FLAG_Z = res;
+      FLAG_X = FLAG_C = src >> 7;
+      FLAG_V = VFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_move_8_d_d:
+   {
+      uint res = MASK_OUT_ABOVE_8(DY);
+      uint* r_dst = &DX;
+
+      *r_dst = MASK_OUT_BELOW_8(*r_dst) | res;
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_8(res);
+      FLAG_Z = res;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_move_8_d_ai:
+   {
+      uint res = OPER_AY_AI_8();
+      uint* r_dst = &DX;
+
+      *r_dst = MASK_OUT_BELOW_8(*r_dst) | res;
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_8(res);
+      FLAG_Z = res;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_move_8_d_pi:
+   {
+      uint res = OPER_AY_PI_8();
+      uint* r_dst = &DX;
+
+      *r_dst = MASK_OUT_BELOW_8(*r_dst) | res;
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_8(res);
+      FLAG_Z = res;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_move_8_d_pi7:
+   {
+      uint res = OPER_A7_PI_8();
+      uint* r_dst = &DX;
+
+      *r_dst = MASK_OUT_BELOW_8(*r_dst) | res;
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_8(res);
+      FLAG_Z = res;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_move_8_d_pd:
+   {
+      uint res = OPER_AY_PD_8();
+      uint* r_dst = &DX;
+
+      *r_dst = MASK_OUT_BELOW_8(*r_dst) | res;
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_8(res);
+      FLAG_Z = res;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_move_8_d_pd7:
+   {
+      uint res = OPER_A7_PD_8();
+      uint* r_dst = &DX;
+
+      *r_dst = MASK_OUT_BELOW_8(*r_dst) | res;
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_8(res);
+      FLAG_Z = res;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_move_8_d_di:
+   {
+      uint res = OPER_AY_DI_8();
+      uint* r_dst = &DX;
+
+      *r_dst = MASK_OUT_BELOW_8(*r_dst) | res;
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_8(res);
+      FLAG_Z = res;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_move_8_d_ix:
+   {
+      uint res = OPER_AY_IX_8();
+      uint* r_dst = &DX;
+
+      *r_dst = MASK_OUT_BELOW_8(*r_dst) | res;
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_8(res);
+      FLAG_Z = res;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_move_8_d_aw:
+   {
+      uint res = OPER_AW_8();
+      uint* r_dst = &DX;
+
+      *r_dst = MASK_OUT_BELOW_8(*r_dst) | res;
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_8(res);
+      FLAG_Z = res;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_move_8_d_al:
+   {
+      uint res = OPER_AL_8();
+      uint* r_dst = &DX;
+
+      *r_dst = MASK_OUT_BELOW_8(*r_dst) | res;
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_8(res);
+      FLAG_Z = res;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_move_8_d_pcdi:
+   {
+      uint res = OPER_PCDI_8();
+      uint* r_dst = &DX;
+
+      *r_dst = MASK_OUT_BELOW_8(*r_dst) | res;
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_8(res);
+      FLAG_Z = res;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_move_8_d_pcix:
+   {
+      uint res = OPER_PCIX_8();
+      uint* r_dst = &DX;
+
+      *r_dst = MASK_OUT_BELOW_8(*r_dst) | res;
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_8(res);
+      FLAG_Z = res;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_move_8_d_i:
+   {
+      uint res = OPER_I_8();
+      uint* r_dst = &DX;
+
+      *r_dst = MASK_OUT_BELOW_8(*r_dst) | res;
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_8(res);
+      FLAG_Z = res;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_move_8_ai_d:
+   {
+      uint res = MASK_OUT_ABOVE_8(DY);
+      uint ea = EA_AX_AI_8();
+
+      m68ki_write_8(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_8(res);
+      FLAG_Z = res;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_move_8_ai_ai:
+   {
+      uint res = OPER_AY_AI_8();
+      uint ea = EA_AX_AI_8();
+
+      m68ki_write_8(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_8(res);
+      FLAG_Z = res;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_move_8_ai_pi:
+   {
+      uint res = OPER_AY_PI_8();
+      uint ea = EA_AX_AI_8();
+
+      m68ki_write_8(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_8(res);
+      FLAG_Z = res;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_move_8_ai_pi7:
+   {
+      uint res = OPER_A7_PI_8();
+      uint ea = EA_AX_AI_8();
+
+      m68ki_write_8(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_8(res);
+      FLAG_Z = res;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_move_8_ai_pd:
+   {
+      uint res = OPER_AY_PD_8();
+      uint ea = EA_AX_AI_8();
+
+      m68ki_write_8(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_8(res);
+      FLAG_Z = res;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_move_8_ai_pd7:
+   {
+      uint res = OPER_A7_PD_8();
+      uint ea = EA_AX_AI_8();
+
+      m68ki_write_8(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_8(res);
+      FLAG_Z = res;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_move_8_ai_di:
+   {
+      uint res = OPER_AY_DI_8();
+      uint ea = EA_AX_AI_8();
+
+      m68ki_write_8(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_8(res);
+      FLAG_Z = res;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_move_8_ai_ix:
+   {
+      uint res = OPER_AY_IX_8();
+      uint ea = EA_AX_AI_8();
+
+      m68ki_write_8(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_8(res);
+      FLAG_Z = res;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_move_8_ai_aw:
+   {
+      uint res = OPER_AW_8();
+      uint ea = EA_AX_AI_8();
+
+      m68ki_write_8(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_8(res);
+      FLAG_Z = res;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_move_8_ai_al:
+   {
+      uint res = OPER_AL_8();
+      uint ea = EA_AX_AI_8();
+
+      m68ki_write_8(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_8(res);
+      FLAG_Z = res;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_move_8_ai_pcdi:
+   {
+      uint res = OPER_PCDI_8();
+      uint ea = EA_AX_AI_8();
+
+      m68ki_write_8(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_8(res);
+      FLAG_Z = res;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_move_8_ai_pcix:
+   {
+      uint res = OPER_PCIX_8();
+      uint ea = EA_AX_AI_8();
+
+      m68ki_write_8(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_8(res);
+      FLAG_Z = res;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_move_8_ai_i:
+   {
+      uint res = OPER_I_8();
+      uint ea = EA_AX_AI_8();
+
+      m68ki_write_8(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_8(res);
+      FLAG_Z = res;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_move_8_pi7_d:
+   {
+      uint res = MASK_OUT_ABOVE_8(DY);
+      uint ea = EA_A7_PI_8();
+
+      m68ki_write_8(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_8(res);
+      FLAG_Z = res;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_move_8_pi_d:
+   {
+      uint res = MASK_OUT_ABOVE_8(DY);
+      uint ea = EA_AX_PI_8();
+
+      m68ki_write_8(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_8(res);
+      FLAG_Z = res;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_move_8_pi7_ai:
+   {
+      uint res = OPER_AY_AI_8();
+      uint ea = EA_A7_PI_8();
+
+      m68ki_write_8(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_8(res);
+      FLAG_Z = res;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_move_8_pi7_pi:
+   {
+      uint res = OPER_AY_PI_8();
+      uint ea = EA_A7_PI_8();
+
+      m68ki_write_8(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_8(res);
+      FLAG_Z = res;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_move_8_pi7_pi7:
+   {
+      uint res = OPER_A7_PI_8();
+      uint ea = EA_A7_PI_8();
+
+      m68ki_write_8(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_8(res);
+      FLAG_Z = res;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_move_8_pi7_pd:
+   {
+      uint res = OPER_AY_PD_8();
+      uint ea = EA_A7_PI_8();
+
+      m68ki_write_8(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_8(res);
+      FLAG_Z = res;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_move_8_pi7_pd7:
+   {
+      uint res = OPER_A7_PD_8();
+      uint ea = EA_A7_PI_8();
+
+      m68ki_write_8(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_8(res);
+      FLAG_Z = res;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_move_8_pi7_di:
+   {
+      uint res = OPER_AY_DI_8();
+      uint ea = EA_A7_PI_8();
+
+      m68ki_write_8(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_8(res);
+      FLAG_Z = res;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_move_8_pi7_ix:
+   {
+      uint res = OPER_AY_IX_8();
+      uint ea = EA_A7_PI_8();
+
+      m68ki_write_8(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_8(res);
+      FLAG_Z = res;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_move_8_pi7_aw:
+   {
+      uint res = OPER_AW_8();
+      uint ea = EA_A7_PI_8();
+
+      m68ki_write_8(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_8(res);
+      FLAG_Z = res;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_move_8_pi7_al:
+   {
+      uint res = OPER_AL_8();
+      uint ea = EA_A7_PI_8();
+
+      m68ki_write_8(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_8(res);
+      FLAG_Z = res;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_move_8_pi7_pcdi:
+   {
+      uint res = OPER_PCDI_8();
+      uint ea = EA_A7_PI_8();
+
+      m68ki_write_8(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_8(res);
+      FLAG_Z = res;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_move_8_pi7_pcix:
+   {
+      uint res = OPER_PCIX_8();
+      uint ea = EA_A7_PI_8();
+
+      m68ki_write_8(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_8(res);
+      FLAG_Z = res;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_move_8_pi7_i:
+   {
+      uint res = OPER_I_8();
+      uint ea = EA_A7_PI_8();
+
+      m68ki_write_8(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_8(res);
+      FLAG_Z = res;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_move_8_pi_ai:
+   {
+      uint res = OPER_AY_AI_8();
+      uint ea = EA_AX_PI_8();
+
+      m68ki_write_8(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_8(res);
+      FLAG_Z = res;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_move_8_pi_pi:
+   {
+      uint res = OPER_AY_PI_8();
+      uint ea = EA_AX_PI_8();
+
+      m68ki_write_8(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_8(res);
+      FLAG_Z = res;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_move_8_pi_pi7:
+   {
+      uint res = OPER_A7_PI_8();
+      uint ea = EA_AX_PI_8();
+
+      m68ki_write_8(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_8(res);
+      FLAG_Z = res;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_move_8_pi_pd:
+   {
+      uint res = OPER_AY_PD_8();
+      uint ea = EA_AX_PI_8();
+
+      m68ki_write_8(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_8(res);
+      FLAG_Z = res;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_move_8_pi_pd7:
+   {
+      uint res = OPER_A7_PD_8();
+      uint ea = EA_AX_PI_8();
+
+      m68ki_write_8(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_8(res);
+      FLAG_Z = res;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_move_8_pi_di:
+   {
+      uint res = OPER_AY_DI_8();
+      uint ea = EA_AX_PI_8();
+
+      m68ki_write_8(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_8(res);
+      FLAG_Z = res;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_move_8_pi_ix:
+   {
+      uint res = OPER_AY_IX_8();
+      uint ea = EA_AX_PI_8();
+
+      m68ki_write_8(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_8(res);
+      FLAG_Z = res;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_move_8_pi_aw:
+   {
+      uint res = OPER_AW_8();
+      uint ea = EA_AX_PI_8();
+
+      m68ki_write_8(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_8(res);
+      FLAG_Z = res;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_move_8_pi_al:
+   {
+      uint res = OPER_AL_8();
+      uint ea = EA_AX_PI_8();
+
+      m68ki_write_8(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_8(res);
+      FLAG_Z = res;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_move_8_pi_pcdi:
+   {
+      uint res = OPER_PCDI_8();
+      uint ea = EA_AX_PI_8();
+
+      m68ki_write_8(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_8(res);
+      FLAG_Z = res;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_move_8_pi_pcix:
+   {
+      uint res = OPER_PCIX_8();
+      uint ea = EA_AX_PI_8();
+
+      m68ki_write_8(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_8(res);
+      FLAG_Z = res;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_move_8_pi_i:
+   {
+      uint res = OPER_I_8();
+      uint ea = EA_AX_PI_8();
+
+      m68ki_write_8(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_8(res);
+      FLAG_Z = res;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_move_8_pd7_d:
+   {
+      uint res = MASK_OUT_ABOVE_8(DY);
+      uint ea = EA_A7_PD_8();
+
+      m68ki_write_8(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_8(res);
+      FLAG_Z = res;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_move_8_pd_d:
+   {
+      uint res = MASK_OUT_ABOVE_8(DY);
+      uint ea = EA_AX_PD_8();
+
+      m68ki_write_8(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_8(res);
+      FLAG_Z = res;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_move_8_pd7_ai:
+   {
+      uint res = OPER_AY_AI_8();
+      uint ea = EA_A7_PD_8();
+
+      m68ki_write_8(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_8(res);
+      FLAG_Z = res;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_move_8_pd7_pi:
+   {
+      uint res = OPER_AY_PI_8();
+      uint ea = EA_A7_PD_8();
+
+      m68ki_write_8(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_8(res);
+      FLAG_Z = res;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_move_8_pd7_pi7:
+   {
+      uint res = OPER_A7_PI_8();
+      uint ea = EA_A7_PD_8();
+
+      m68ki_write_8(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_8(res);
+      FLAG_Z = res;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_move_8_pd7_pd:
+   {
+      uint res = OPER_AY_PD_8();
+      uint ea = EA_A7_PD_8();
+
+      m68ki_write_8(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_8(res);
+      FLAG_Z = res;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_move_8_pd7_pd7:
+   {
+      uint res = OPER_A7_PD_8();
+      uint ea = EA_A7_PD_8();
+
+      m68ki_write_8(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_8(res);
+      FLAG_Z = res;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_move_8_pd7_di:
+   {
+      uint res = OPER_AY_DI_8();
+      uint ea = EA_A7_PD_8();
+
+      m68ki_write_8(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_8(res);
+      FLAG_Z = res;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_move_8_pd7_ix:
+   {
+      uint res = OPER_AY_IX_8();
+      uint ea = EA_A7_PD_8();
+
+      m68ki_write_8(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_8(res);
+      FLAG_Z = res;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_move_8_pd7_aw:
+   {
+      uint res = OPER_AW_8();
+      uint ea = EA_A7_PD_8();
+
+      m68ki_write_8(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_8(res);
+      FLAG_Z = res;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_move_8_pd7_al:
+   {
+      uint res = OPER_AL_8();
+      uint ea = EA_A7_PD_8();
+
+      m68ki_write_8(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_8(res);
+      FLAG_Z = res;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_move_8_pd7_pcdi:
+   {
+      uint res = OPER_PCDI_8();
+      uint ea = EA_A7_PD_8();
+
+      m68ki_write_8(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_8(res);
+      FLAG_Z = res;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_move_8_pd7_pcix:
+   {
+      uint res = OPER_PCIX_8();
+      uint ea = EA_A7_PD_8();
+
+      m68ki_write_8(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_8(res);
+      FLAG_Z = res;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_move_8_pd7_i:
+   {
+      uint res = OPER_I_8();
+      uint ea = EA_A7_PD_8();
+
+      m68ki_write_8(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_8(res);
+      FLAG_Z = res;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_move_8_pd_ai:
+   {
+      uint res = OPER_AY_AI_8();
+      uint ea = EA_AX_PD_8();
+
+      m68ki_write_8(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_8(res);
+      FLAG_Z = res;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_move_8_pd_pi:
+   {
+      uint res = OPER_AY_PI_8();
+      uint ea = EA_AX_PD_8();
+
+      m68ki_write_8(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_8(res);
+      FLAG_Z = res;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_move_8_pd_pi7:
+   {
+      uint res = OPER_A7_PI_8();
+      uint ea = EA_AX_PD_8();
+
+      m68ki_write_8(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_8(res);
+      FLAG_Z = res;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_move_8_pd_pd:
+   {
+      uint res = OPER_AY_PD_8();
+      uint ea = EA_AX_PD_8();
+
+      m68ki_write_8(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_8(res);
+      FLAG_Z = res;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_move_8_pd_pd7:
+   {
+      uint res = OPER_A7_PD_8();
+      uint ea = EA_AX_PD_8();
+
+      m68ki_write_8(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_8(res);
+      FLAG_Z = res;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_move_8_pd_di:
+   {
+      uint res = OPER_AY_DI_8();
+      uint ea = EA_AX_PD_8();
+
+      m68ki_write_8(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_8(res);
+      FLAG_Z = res;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_move_8_pd_ix:
+   {
+      uint res = OPER_AY_IX_8();
+      uint ea = EA_AX_PD_8();
+
+      m68ki_write_8(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_8(res);
+      FLAG_Z = res;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_move_8_pd_aw:
+   {
+      uint res = OPER_AW_8();
+      uint ea = EA_AX_PD_8();
+
+      m68ki_write_8(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_8(res);
+      FLAG_Z = res;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_move_8_pd_al:
+   {
+      uint res = OPER_AL_8();
+      uint ea = EA_AX_PD_8();
+
+      m68ki_write_8(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_8(res);
+      FLAG_Z = res;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_move_8_pd_pcdi:
+   {
+      uint res = OPER_PCDI_8();
+      uint ea = EA_AX_PD_8();
+
+      m68ki_write_8(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_8(res);
+      FLAG_Z = res;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_move_8_pd_pcix:
+   {
+      uint res = OPER_PCIX_8();
+      uint ea = EA_AX_PD_8();
+
+      m68ki_write_8(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_8(res);
+      FLAG_Z = res;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_move_8_pd_i:
+   {
+      uint res = OPER_I_8();
+      uint ea = EA_AX_PD_8();
+
+      m68ki_write_8(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_8(res);
+      FLAG_Z = res;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_move_8_di_d:
+   {
+      uint res = MASK_OUT_ABOVE_8(DY);
+      uint ea = EA_AX_DI_8();
+
+      m68ki_write_8(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_8(res);
+      FLAG_Z = res;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_move_8_di_ai:
+   {
+      uint res = OPER_AY_AI_8();
+      uint ea = EA_AX_DI_8();
+
+      m68ki_write_8(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_8(res);
+      FLAG_Z = res;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_move_8_di_pi:
+   {
+      uint res = OPER_AY_PI_8();
+      uint ea = EA_AX_DI_8();
+
+      m68ki_write_8(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_8(res);
+      FLAG_Z = res;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_move_8_di_pi7:
+   {
+      uint res = OPER_A7_PI_8();
+      uint ea = EA_AX_DI_8();
+
+      m68ki_write_8(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_8(res);
+      FLAG_Z = res;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_move_8_di_pd:
+   {
+      uint res = OPER_AY_PD_8();
+      uint ea = EA_AX_DI_8();
+
+      m68ki_write_8(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_8(res);
+      FLAG_Z = res;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_move_8_di_pd7:
+   {
+      uint res = OPER_A7_PD_8();
+      uint ea = EA_AX_DI_8();
+
+      m68ki_write_8(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_8(res);
+      FLAG_Z = res;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_move_8_di_di:
+   {
+      uint res = OPER_AY_DI_8();
+      uint ea = EA_AX_DI_8();
+
+      m68ki_write_8(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_8(res);
+      FLAG_Z = res;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_move_8_di_ix:
+   {
+      uint res = OPER_AY_IX_8();
+      uint ea = EA_AX_DI_8();
+
+      m68ki_write_8(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_8(res);
+      FLAG_Z = res;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_move_8_di_aw:
+   {
+      uint res = OPER_AW_8();
+      uint ea = EA_AX_DI_8();
+
+      m68ki_write_8(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_8(res);
+      FLAG_Z = res;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_move_8_di_al:
+   {
+      uint res = OPER_AL_8();
+      uint ea = EA_AX_DI_8();
+
+      m68ki_write_8(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_8(res);
+      FLAG_Z = res;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_move_8_di_pcdi:
+   {
+      uint res = OPER_PCDI_8();
+      uint ea = EA_AX_DI_8();
+
+      m68ki_write_8(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_8(res);
+      FLAG_Z = res;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_move_8_di_pcix:
+   {
+      uint res = OPER_PCIX_8();
+      uint ea = EA_AX_DI_8();
+
+      m68ki_write_8(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_8(res);
+      FLAG_Z = res;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_move_8_di_i:
+   {
+      uint res = OPER_I_8();
+      uint ea = EA_AX_DI_8();
+
+      m68ki_write_8(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_8(res);
+      FLAG_Z = res;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_move_8_ix_d:
+   {
+      uint res = MASK_OUT_ABOVE_8(DY);
+      uint ea = EA_AX_IX_8();
+
+      m68ki_write_8(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_8(res);
+      FLAG_Z = res;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_move_8_ix_ai:
+   {
+      uint res = OPER_AY_AI_8();
+      uint ea = EA_AX_IX_8();
+
+      m68ki_write_8(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_8(res);
+      FLAG_Z = res;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_move_8_ix_pi:
+   {
+      uint res = OPER_AY_PI_8();
+      uint ea = EA_AX_IX_8();
+
+      m68ki_write_8(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_8(res);
+      FLAG_Z = res;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_move_8_ix_pi7:
+   {
+      uint res = OPER_A7_PI_8();
+      uint ea = EA_AX_IX_8();
+
+      m68ki_write_8(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_8(res);
+      FLAG_Z = res;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_move_8_ix_pd:
+   {
+      uint res = OPER_AY_PD_8();
+      uint ea = EA_AX_IX_8();
+
+      m68ki_write_8(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_8(res);
+      FLAG_Z = res;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_move_8_ix_pd7:
+   {
+      uint res = OPER_A7_PD_8();
+      uint ea = EA_AX_IX_8();
+
+      m68ki_write_8(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_8(res);
+      FLAG_Z = res;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_move_8_ix_di:
+   {
+      uint res = OPER_AY_DI_8();
+      uint ea = EA_AX_IX_8();
+
+      m68ki_write_8(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_8(res);
+      FLAG_Z = res;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_move_8_ix_ix:
+   {
+      uint res = OPER_AY_IX_8();
+      uint ea = EA_AX_IX_8();
+
+      m68ki_write_8(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_8(res);
+      FLAG_Z = res;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_move_8_ix_aw:
+   {
+      uint res = OPER_AW_8();
+      uint ea = EA_AX_IX_8();
+
+      m68ki_write_8(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_8(res);
+      FLAG_Z = res;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_move_8_ix_al:
+   {
+      uint res = OPER_AL_8();
+      uint ea = EA_AX_IX_8();
+
+      m68ki_write_8(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_8(res);
+      FLAG_Z = res;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_move_8_ix_pcdi:
+   {
+      uint res = OPER_PCDI_8();
+      uint ea = EA_AX_IX_8();
+
+      m68ki_write_8(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_8(res);
+      FLAG_Z = res;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_move_8_ix_pcix:
+   {
+      uint res = OPER_PCIX_8();
+      uint ea = EA_AX_IX_8();
+
+      m68ki_write_8(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_8(res);
+      FLAG_Z = res;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_move_8_ix_i:
+   {
+      uint res = OPER_I_8();
+      uint ea = EA_AX_IX_8();
+
+      m68ki_write_8(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_8(res);
+      FLAG_Z = res;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_move_8_aw_d:
+   {
+      uint res = MASK_OUT_ABOVE_8(DY);
+      uint ea = EA_AW_8();
+
+      m68ki_write_8(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_8(res);
+      FLAG_Z = res;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_move_8_aw_ai:
+   {
+      uint res = OPER_AY_AI_8();
+      uint ea = EA_AW_8();
+
+      m68ki_write_8(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_8(res);
+      FLAG_Z = res;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_move_8_aw_pi:
+   {
+      uint res = OPER_AY_PI_8();
+      uint ea = EA_AW_8();
+
+      m68ki_write_8(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_8(res);
+      FLAG_Z = res;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_move_8_aw_pi7:
+   {
+      uint res = OPER_A7_PI_8();
+      uint ea = EA_AW_8();
+
+      m68ki_write_8(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_8(res);
+      FLAG_Z = res;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_move_8_aw_pd:
+   {
+      uint res = OPER_AY_PD_8();
+      uint ea = EA_AW_8();
+
+      m68ki_write_8(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_8(res);
+      FLAG_Z = res;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_move_8_aw_pd7:
+   {
+      uint res = OPER_A7_PD_8();
+      uint ea = EA_AW_8();
+
+      m68ki_write_8(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_8(res);
+      FLAG_Z = res;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_move_8_aw_di:
+   {
+      uint res = OPER_AY_DI_8();
+      uint ea = EA_AW_8();
+
+      m68ki_write_8(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_8(res);
+      FLAG_Z = res;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_move_8_aw_ix:
+   {
+      uint res = OPER_AY_IX_8();
+      uint ea = EA_AW_8();
+
+      m68ki_write_8(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_8(res);
+      FLAG_Z = res;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_move_8_aw_aw:
+   {
+      uint res = OPER_AW_8();
+      uint ea = EA_AW_8();
+
+      m68ki_write_8(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_8(res);
+      FLAG_Z = res;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_move_8_aw_al:
+   {
+      uint res = OPER_AL_8();
+      uint ea = EA_AW_8();
+
+      m68ki_write_8(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_8(res);
+      FLAG_Z = res;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_move_8_aw_pcdi:
+   {
+      uint res = OPER_PCDI_8();
+      uint ea = EA_AW_8();
+
+      m68ki_write_8(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_8(res);
+      FLAG_Z = res;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_move_8_aw_pcix:
+   {
+      uint res = OPER_PCIX_8();
+      uint ea = EA_AW_8();
+
+      m68ki_write_8(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_8(res);
+      FLAG_Z = res;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_move_8_aw_i:
+   {
+      uint res = OPER_I_8();
+      uint ea = EA_AW_8();
+
+      m68ki_write_8(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_8(res);
+      FLAG_Z = res;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_move_8_al_d:
+   {
+      uint res = MASK_OUT_ABOVE_8(DY);
+      uint ea = EA_AL_8();
+
+      m68ki_write_8(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_8(res);
+      FLAG_Z = res;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_move_8_al_ai:
+   {
+      uint res = OPER_AY_AI_8();
+      uint ea = EA_AL_8();
+
+      m68ki_write_8(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_8(res);
+      FLAG_Z = res;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_move_8_al_pi:
+   {
+      uint res = OPER_AY_PI_8();
+      uint ea = EA_AL_8();
+
+      m68ki_write_8(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_8(res);
+      FLAG_Z = res;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_move_8_al_pi7:
+   {
+      uint res = OPER_A7_PI_8();
+      uint ea = EA_AL_8();
+
+      m68ki_write_8(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_8(res);
+      FLAG_Z = res;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_move_8_al_pd:
+   {
+      uint res = OPER_AY_PD_8();
+      uint ea = EA_AL_8();
+
+      m68ki_write_8(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_8(res);
+      FLAG_Z = res;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_move_8_al_pd7:
+   {
+      uint res = OPER_A7_PD_8();
+      uint ea = EA_AL_8();
+
+      m68ki_write_8(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_8(res);
+      FLAG_Z = res;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_move_8_al_di:
+   {
+      uint res = OPER_AY_DI_8();
+      uint ea = EA_AL_8();
+
+      m68ki_write_8(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_8(res);
+      FLAG_Z = res;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_move_8_al_ix:
+   {
+      uint res = OPER_AY_IX_8();
+      uint ea = EA_AL_8();
+
+      m68ki_write_8(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_8(res);
+      FLAG_Z = res;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_move_8_al_aw:
+   {
+      uint res = OPER_AW_8();
+      uint ea = EA_AL_8();
+
+      m68ki_write_8(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_8(res);
+      FLAG_Z = res;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_move_8_al_al:
+   {
+      uint res = OPER_AL_8();
+      uint ea = EA_AL_8();
+
+      m68ki_write_8(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_8(res);
+      FLAG_Z = res;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_move_8_al_pcdi:
+   {
+      uint res = OPER_PCDI_8();
+      uint ea = EA_AL_8();
+
+      m68ki_write_8(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_8(res);
+      FLAG_Z = res;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_move_8_al_pcix:
+   {
+      uint res = OPER_PCIX_8();
+      uint ea = EA_AL_8();
+
+      m68ki_write_8(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_8(res);
+      FLAG_Z = res;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_move_8_al_i:
+   {
+      uint res = OPER_I_8();
+      uint ea = EA_AL_8();
+
+      m68ki_write_8(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_8(res);
+      FLAG_Z = res;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_move_16_d_d:
+   {
+      uint res = MASK_OUT_ABOVE_16(DY);
+      uint* r_dst = &DX;
+
+      *r_dst = MASK_OUT_BELOW_16(*r_dst) | res;
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_16(res);
+      FLAG_Z = res;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_move_16_d_a:
+   {
+      uint res = MASK_OUT_ABOVE_16(AY);
+      uint* r_dst = &DX;
+
+      *r_dst = MASK_OUT_BELOW_16(*r_dst) | res;
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_16(res);
+      FLAG_Z = res;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_move_16_d_ai:
+   {
+      uint res = OPER_AY_AI_16();
+      uint* r_dst = &DX;
+
+      *r_dst = MASK_OUT_BELOW_16(*r_dst) | res;
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_16(res);
+      FLAG_Z = res;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_move_16_d_pi:
+   {
+      uint res = OPER_AY_PI_16();
+      uint* r_dst = &DX;
+
+      *r_dst = MASK_OUT_BELOW_16(*r_dst) | res;
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_16(res);
+      FLAG_Z = res;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_move_16_d_pd:
+   {
+      uint res = OPER_AY_PD_16();
+      uint* r_dst = &DX;
+
+      *r_dst = MASK_OUT_BELOW_16(*r_dst) | res;
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_16(res);
+      FLAG_Z = res;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_move_16_d_di:
+   {
+      uint res = OPER_AY_DI_16();
+      uint* r_dst = &DX;
+
+      *r_dst = MASK_OUT_BELOW_16(*r_dst) | res;
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_16(res);
+      FLAG_Z = res;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_move_16_d_ix:
+   {
+      uint res = OPER_AY_IX_16();
+      uint* r_dst = &DX;
+
+      *r_dst = MASK_OUT_BELOW_16(*r_dst) | res;
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_16(res);
+      FLAG_Z = res;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_move_16_d_aw:
+   {
+      uint res = OPER_AW_16();
+      uint* r_dst = &DX;
+
+      *r_dst = MASK_OUT_BELOW_16(*r_dst) | res;
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_16(res);
+      FLAG_Z = res;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_move_16_d_al:
+   {
+      uint res = OPER_AL_16();
+      uint* r_dst = &DX;
+
+      *r_dst = MASK_OUT_BELOW_16(*r_dst) | res;
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_16(res);
+      FLAG_Z = res;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_move_16_d_pcdi:
+   {
+      uint res = OPER_PCDI_16();
+      uint* r_dst = &DX;
+
+      *r_dst = MASK_OUT_BELOW_16(*r_dst) | res;
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_16(res);
+      FLAG_Z = res;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_move_16_d_pcix:
+   {
+      uint res = OPER_PCIX_16();
+      uint* r_dst = &DX;
+
+      *r_dst = MASK_OUT_BELOW_16(*r_dst) | res;
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_16(res);
+      FLAG_Z = res;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_move_16_d_i:
+   {
+      uint res = OPER_I_16();
+      uint* r_dst = &DX;
+
+      *r_dst = MASK_OUT_BELOW_16(*r_dst) | res;
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_16(res);
+      FLAG_Z = res;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_move_16_ai_d:
+   {
+      uint res = MASK_OUT_ABOVE_16(DY);
+      uint ea = EA_AX_AI_16();
+
+      m68ki_write_16(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_16(res);
+      FLAG_Z = res;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_move_16_ai_a:
+   {
+      uint res = MASK_OUT_ABOVE_16(AY);
+      uint ea = EA_AX_AI_16();
+
+      m68ki_write_16(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_16(res);
+      FLAG_Z = res;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_move_16_ai_ai:
+   {
+      uint res = OPER_AY_AI_16();
+      uint ea = EA_AX_AI_16();
+
+      m68ki_write_16(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_16(res);
+      FLAG_Z = res;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_move_16_ai_pi:
+   {
+      uint res = OPER_AY_PI_16();
+      uint ea = EA_AX_AI_16();
+
+      m68ki_write_16(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_16(res);
+      FLAG_Z = res;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_move_16_ai_pd:
+   {
+      uint res = OPER_AY_PD_16();
+      uint ea = EA_AX_AI_16();
+
+      m68ki_write_16(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_16(res);
+      FLAG_Z = res;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_move_16_ai_di:
+   {
+      uint res = OPER_AY_DI_16();
+      uint ea = EA_AX_AI_16();
+
+      m68ki_write_16(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_16(res);
+      FLAG_Z = res;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_move_16_ai_ix:
+   {
+      uint res = OPER_AY_IX_16();
+      uint ea = EA_AX_AI_16();
+
+      m68ki_write_16(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_16(res);
+      FLAG_Z = res;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_move_16_ai_aw:
+   {
+      uint res = OPER_AW_16();
+      uint ea = EA_AX_AI_16();
+
+      m68ki_write_16(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_16(res);
+      FLAG_Z = res;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_move_16_ai_al:
+   {
+      uint res = OPER_AL_16();
+      uint ea = EA_AX_AI_16();
+
+      m68ki_write_16(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_16(res);
+      FLAG_Z = res;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_move_16_ai_pcdi:
+   {
+      uint res = OPER_PCDI_16();
+      uint ea = EA_AX_AI_16();
+
+      m68ki_write_16(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_16(res);
+      FLAG_Z = res;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_move_16_ai_pcix:
+   {
+      uint res = OPER_PCIX_16();
+      uint ea = EA_AX_AI_16();
+
+      m68ki_write_16(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_16(res);
+      FLAG_Z = res;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_move_16_ai_i:
+   {
+      uint res = OPER_I_16();
+      uint ea = EA_AX_AI_16();
+
+      m68ki_write_16(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_16(res);
+      FLAG_Z = res;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_move_16_pi_d:
+   {
+      uint res = MASK_OUT_ABOVE_16(DY);
+      uint ea = EA_AX_PI_16();
+
+      m68ki_write_16(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_16(res);
+      FLAG_Z = res;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_move_16_pi_a:
+   {
+      uint res = MASK_OUT_ABOVE_16(AY);
+      uint ea = EA_AX_PI_16();
+
+      m68ki_write_16(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_16(res);
+      FLAG_Z = res;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_move_16_pi_ai:
+   {
+      uint res = OPER_AY_AI_16();
+      uint ea = EA_AX_PI_16();
+
+      m68ki_write_16(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_16(res);
+      FLAG_Z = res;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_move_16_pi_pi:
+   {
+      uint res = OPER_AY_PI_16();
+      uint ea = EA_AX_PI_16();
+
+      m68ki_write_16(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_16(res);
+      FLAG_Z = res;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_move_16_pi_pd:
+   {
+      uint res = OPER_AY_PD_16();
+      uint ea = EA_AX_PI_16();
+
+      m68ki_write_16(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_16(res);
+      FLAG_Z = res;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_move_16_pi_di:
+   {
+      uint res = OPER_AY_DI_16();
+      uint ea = EA_AX_PI_16();
+
+      m68ki_write_16(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_16(res);
+      FLAG_Z = res;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_move_16_pi_ix:
+   {
+      uint res = OPER_AY_IX_16();
+      uint ea = EA_AX_PI_16();
+
+      m68ki_write_16(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_16(res);
+      FLAG_Z = res;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_move_16_pi_aw:
+   {
+      uint res = OPER_AW_16();
+      uint ea = EA_AX_PI_16();
+
+      m68ki_write_16(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_16(res);
+      FLAG_Z = res;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_move_16_pi_al:
+   {
+      uint res = OPER_AL_16();
+      uint ea = EA_AX_PI_16();
+
+      m68ki_write_16(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_16(res);
+      FLAG_Z = res;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_move_16_pi_pcdi:
+   {
+      uint res = OPER_PCDI_16();
+      uint ea = EA_AX_PI_16();
+
+      m68ki_write_16(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_16(res);
+      FLAG_Z = res;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_move_16_pi_pcix:
+   {
+      uint res = OPER_PCIX_16();
+      uint ea = EA_AX_PI_16();
+
+      m68ki_write_16(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_16(res);
+      FLAG_Z = res;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_move_16_pi_i:
+   {
+      uint res = OPER_I_16();
+      uint ea = EA_AX_PI_16();
+
+      m68ki_write_16(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_16(res);
+      FLAG_Z = res;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_move_16_pd_d:
+   {
+      uint res = MASK_OUT_ABOVE_16(DY);
+      uint ea = EA_AX_PD_16();
+
+      m68ki_write_16(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_16(res);
+      FLAG_Z = res;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_move_16_pd_a:
+   {
+      uint res = MASK_OUT_ABOVE_16(AY);
+      uint ea = EA_AX_PD_16();
+
+      m68ki_write_16(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_16(res);
+      FLAG_Z = res;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_move_16_pd_ai:
+   {
+      uint res = OPER_AY_AI_16();
+      uint ea = EA_AX_PD_16();
+
+      m68ki_write_16(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_16(res);
+      FLAG_Z = res;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_move_16_pd_pi:
+   {
+      uint res = OPER_AY_PI_16();
+      uint ea = EA_AX_PD_16();
+
+      m68ki_write_16(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_16(res);
+      FLAG_Z = res;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_move_16_pd_pd:
+   {
+      uint res = OPER_AY_PD_16();
+      uint ea = EA_AX_PD_16();
+
+      m68ki_write_16(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_16(res);
+      FLAG_Z = res;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_move_16_pd_di:
+   {
+      uint res = OPER_AY_DI_16();
+      uint ea = EA_AX_PD_16();
+
+      m68ki_write_16(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_16(res);
+      FLAG_Z = res;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_move_16_pd_ix:
+   {
+      uint res = OPER_AY_IX_16();
+      uint ea = EA_AX_PD_16();
+
+      m68ki_write_16(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_16(res);
+      FLAG_Z = res;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_move_16_pd_aw:
+   {
+      uint res = OPER_AW_16();
+      uint ea = EA_AX_PD_16();
+
+      m68ki_write_16(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_16(res);
+      FLAG_Z = res;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_move_16_pd_al:
+   {
+      uint res = OPER_AL_16();
+      uint ea = EA_AX_PD_16();
+
+      m68ki_write_16(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_16(res);
+      FLAG_Z = res;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_move_16_pd_pcdi:
+   {
+      uint res = OPER_PCDI_16();
+      uint ea = EA_AX_PD_16();
+
+      m68ki_write_16(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_16(res);
+      FLAG_Z = res;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_move_16_pd_pcix:
+   {
+      uint res = OPER_PCIX_16();
+      uint ea = EA_AX_PD_16();
+
+      m68ki_write_16(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_16(res);
+      FLAG_Z = res;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_move_16_pd_i:
+   {
+      uint res = OPER_I_16();
+      uint ea = EA_AX_PD_16();
+
+      m68ki_write_16(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_16(res);
+      FLAG_Z = res;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_move_16_di_d:
+   {
+      uint res = MASK_OUT_ABOVE_16(DY);
+      uint ea = EA_AX_DI_16();
+
+      m68ki_write_16(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_16(res);
+      FLAG_Z = res;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_move_16_di_a:
+   {
+      uint res = MASK_OUT_ABOVE_16(AY);
+      uint ea = EA_AX_DI_16();
+
+      m68ki_write_16(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_16(res);
+      FLAG_Z = res;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_move_16_di_ai:
+   {
+      uint res = OPER_AY_AI_16();
+      uint ea = EA_AX_DI_16();
+
+      m68ki_write_16(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_16(res);
+      FLAG_Z = res;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_move_16_di_pi:
+   {
+      uint res = OPER_AY_PI_16();
+      uint ea = EA_AX_DI_16();
+
+      m68ki_write_16(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_16(res);
+      FLAG_Z = res;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_move_16_di_pd:
+   {
+      uint res = OPER_AY_PD_16();
+      uint ea = EA_AX_DI_16();
+
+      m68ki_write_16(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_16(res);
+      FLAG_Z = res;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_move_16_di_di:
+   {
+      uint res = OPER_AY_DI_16();
+      uint ea = EA_AX_DI_16();
+
+      m68ki_write_16(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_16(res);
+      FLAG_Z = res;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_move_16_di_ix:
+   {
+      uint res = OPER_AY_IX_16();
+      uint ea = EA_AX_DI_16();
+
+      m68ki_write_16(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_16(res);
+      FLAG_Z = res;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_move_16_di_aw:
+   {
+      uint res = OPER_AW_16();
+      uint ea = EA_AX_DI_16();
+
+      m68ki_write_16(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_16(res);
+      FLAG_Z = res;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_move_16_di_al:
+   {
+      uint res = OPER_AL_16();
+      uint ea = EA_AX_DI_16();
+
+      m68ki_write_16(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_16(res);
+      FLAG_Z = res;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_move_16_di_pcdi:
+   {
+      uint res = OPER_PCDI_16();
+      uint ea = EA_AX_DI_16();
+
+      m68ki_write_16(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_16(res);
+      FLAG_Z = res;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_move_16_di_pcix:
+   {
+      uint res = OPER_PCIX_16();
+      uint ea = EA_AX_DI_16();
+
+      m68ki_write_16(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_16(res);
+      FLAG_Z = res;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_move_16_di_i:
+   {
+      uint res = OPER_I_16();
+      uint ea = EA_AX_DI_16();
+
+      m68ki_write_16(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_16(res);
+      FLAG_Z = res;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_move_16_ix_d:
+   {
+      uint res = MASK_OUT_ABOVE_16(DY);
+      uint ea = EA_AX_IX_16();
+
+      m68ki_write_16(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_16(res);
+      FLAG_Z = res;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_move_16_ix_a:
+   {
+      uint res = MASK_OUT_ABOVE_16(AY);
+      uint ea = EA_AX_IX_16();
+
+      m68ki_write_16(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_16(res);
+      FLAG_Z = res;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_move_16_ix_ai:
+   {
+      uint res = OPER_AY_AI_16();
+      uint ea = EA_AX_IX_16();
+
+      m68ki_write_16(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_16(res);
+      FLAG_Z = res;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_move_16_ix_pi:
+   {
+      uint res = OPER_AY_PI_16();
+      uint ea = EA_AX_IX_16();
+
+      m68ki_write_16(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_16(res);
+      FLAG_Z = res;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_move_16_ix_pd:
+   {
+      uint res = OPER_AY_PD_16();
+      uint ea = EA_AX_IX_16();
+
+      m68ki_write_16(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_16(res);
+      FLAG_Z = res;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_move_16_ix_di:
+   {
+      uint res = OPER_AY_DI_16();
+      uint ea = EA_AX_IX_16();
+
+      m68ki_write_16(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_16(res);
+      FLAG_Z = res;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_move_16_ix_ix:
+   {
+      uint res = OPER_AY_IX_16();
+      uint ea = EA_AX_IX_16();
+
+      m68ki_write_16(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_16(res);
+      FLAG_Z = res;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_move_16_ix_aw:
+   {
+      uint res = OPER_AW_16();
+      uint ea = EA_AX_IX_16();
+
+      m68ki_write_16(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_16(res);
+      FLAG_Z = res;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_move_16_ix_al:
+   {
+      uint res = OPER_AL_16();
+      uint ea = EA_AX_IX_16();
+
+      m68ki_write_16(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_16(res);
+      FLAG_Z = res;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_move_16_ix_pcdi:
+   {
+      uint res = OPER_PCDI_16();
+      uint ea = EA_AX_IX_16();
+
+      m68ki_write_16(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_16(res);
+      FLAG_Z = res;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_move_16_ix_pcix:
+   {
+      uint res = OPER_PCIX_16();
+      uint ea = EA_AX_IX_16();
+
+      m68ki_write_16(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_16(res);
+      FLAG_Z = res;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_move_16_ix_i:
+   {
+      uint res = OPER_I_16();
+      uint ea = EA_AX_IX_16();
+
+      m68ki_write_16(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_16(res);
+      FLAG_Z = res;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_move_16_aw_d:
+   {
+      uint res = MASK_OUT_ABOVE_16(DY);
+      uint ea = EA_AW_16();
+
+      m68ki_write_16(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_16(res);
+      FLAG_Z = res;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_move_16_aw_a:
+   {
+      uint res = MASK_OUT_ABOVE_16(AY);
+      uint ea = EA_AW_16();
+
+      m68ki_write_16(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_16(res);
+      FLAG_Z = res;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_move_16_aw_ai:
+   {
+      uint res = OPER_AY_AI_16();
+      uint ea = EA_AW_16();
+
+      m68ki_write_16(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_16(res);
+      FLAG_Z = res;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_move_16_aw_pi:
+   {
+      uint res = OPER_AY_PI_16();
+      uint ea = EA_AW_16();
+
+      m68ki_write_16(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_16(res);
+      FLAG_Z = res;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_move_16_aw_pd:
+   {
+      uint res = OPER_AY_PD_16();
+      uint ea = EA_AW_16();
+
+      m68ki_write_16(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_16(res);
+      FLAG_Z = res;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_move_16_aw_di:
+   {
+      uint res = OPER_AY_DI_16();
+      uint ea = EA_AW_16();
+
+      m68ki_write_16(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_16(res);
+      FLAG_Z = res;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_move_16_aw_ix:
+   {
+      uint res = OPER_AY_IX_16();
+      uint ea = EA_AW_16();
+
+      m68ki_write_16(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_16(res);
+      FLAG_Z = res;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_move_16_aw_aw:
+   {
+      uint res = OPER_AW_16();
+      uint ea = EA_AW_16();
+
+      m68ki_write_16(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_16(res);
+      FLAG_Z = res;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_move_16_aw_al:
+   {
+      uint res = OPER_AL_16();
+      uint ea = EA_AW_16();
+
+      m68ki_write_16(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_16(res);
+      FLAG_Z = res;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_move_16_aw_pcdi:
+   {
+      uint res = OPER_PCDI_16();
+      uint ea = EA_AW_16();
+
+      m68ki_write_16(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_16(res);
+      FLAG_Z = res;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_move_16_aw_pcix:
+   {
+      uint res = OPER_PCIX_16();
+      uint ea = EA_AW_16();
+
+      m68ki_write_16(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_16(res);
+      FLAG_Z = res;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_move_16_aw_i:
+   {
+      uint res = OPER_I_16();
+      uint ea = EA_AW_16();
+
+      m68ki_write_16(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_16(res);
+      FLAG_Z = res;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_move_16_al_d:
+   {
+      uint res = MASK_OUT_ABOVE_16(DY);
+      uint ea = EA_AL_16();
+
+      m68ki_write_16(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_16(res);
+      FLAG_Z = res;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_move_16_al_a:
+   {
+      uint res = MASK_OUT_ABOVE_16(AY);
+      uint ea = EA_AL_16();
+
+      m68ki_write_16(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_16(res);
+      FLAG_Z = res;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_move_16_al_ai:
+   {
+      uint res = OPER_AY_AI_16();
+      uint ea = EA_AL_16();
+
+      m68ki_write_16(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_16(res);
+      FLAG_Z = res;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_move_16_al_pi:
+   {
+      uint res = OPER_AY_PI_16();
+      uint ea = EA_AL_16();
+
+      m68ki_write_16(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_16(res);
+      FLAG_Z = res;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_move_16_al_pd:
+   {
+      uint res = OPER_AY_PD_16();
+      uint ea = EA_AL_16();
+
+      m68ki_write_16(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_16(res);
+      FLAG_Z = res;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_move_16_al_di:
+   {
+      uint res = OPER_AY_DI_16();
+      uint ea = EA_AL_16();
+
+      m68ki_write_16(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_16(res);
+      FLAG_Z = res;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_move_16_al_ix:
+   {
+      uint res = OPER_AY_IX_16();
+      uint ea = EA_AL_16();
+
+      m68ki_write_16(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_16(res);
+      FLAG_Z = res;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_move_16_al_aw:
+   {
+      uint res = OPER_AW_16();
+      uint ea = EA_AL_16();
+
+      m68ki_write_16(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_16(res);
+      FLAG_Z = res;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_move_16_al_al:
+   {
+      uint res = OPER_AL_16();
+      uint ea = EA_AL_16();
+
+      m68ki_write_16(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_16(res);
+      FLAG_Z = res;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_move_16_al_pcdi:
+   {
+      uint res = OPER_PCDI_16();
+      uint ea = EA_AL_16();
+
+      m68ki_write_16(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_16(res);
+      FLAG_Z = res;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_move_16_al_pcix:
+   {
+      uint res = OPER_PCIX_16();
+      uint ea = EA_AL_16();
+
+      m68ki_write_16(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_16(res);
+      FLAG_Z = res;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_move_16_al_i:
+   {
+      uint res = OPER_I_16();
+      uint ea = EA_AL_16();
+
+      m68ki_write_16(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_16(res);
+      FLAG_Z = res;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_move_32_d_d:
+   {
+      uint res = DY;
+      uint* r_dst = &DX;
+
+      *r_dst = res;
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_32(res);
+      FLAG_Z = res;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_move_32_d_a:
+   {
+      uint res = AY;
+      uint* r_dst = &DX;
+
+      *r_dst = res;
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_32(res);
+      FLAG_Z = res;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_move_32_d_ai:
+   {
+      uint res = OPER_AY_AI_32();
+      uint* r_dst = &DX;
+
+      *r_dst = res;
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_32(res);
+      FLAG_Z = res;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_move_32_d_pi:
+   {
+      uint res = OPER_AY_PI_32();
+      uint* r_dst = &DX;
+
+      *r_dst = res;
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_32(res);
+      FLAG_Z = res;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_move_32_d_pd:
+   {
+      uint res = OPER_AY_PD_32();
+      uint* r_dst = &DX;
+
+      *r_dst = res;
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_32(res);
+      FLAG_Z = res;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_move_32_d_di:
+   {
+      uint res = OPER_AY_DI_32();
+      uint* r_dst = &DX;
+
+      *r_dst = res;
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_32(res);
+      FLAG_Z = res;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_move_32_d_ix:
+   {
+      uint res = OPER_AY_IX_32();
+      uint* r_dst = &DX;
+
+      *r_dst = res;
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_32(res);
+      FLAG_Z = res;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_move_32_d_aw:
+   {
+      uint res = OPER_AW_32();
+      uint* r_dst = &DX;
+
+      *r_dst = res;
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_32(res);
+      FLAG_Z = res;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_move_32_d_al:
+   {
+      uint res = OPER_AL_32();
+      uint* r_dst = &DX;
+
+      *r_dst = res;
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_32(res);
+      FLAG_Z = res;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_move_32_d_pcdi:
+   {
+      uint res = OPER_PCDI_32();
+      uint* r_dst = &DX;
+
+      *r_dst = res;
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_32(res);
+      FLAG_Z = res;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_move_32_d_pcix:
+   {
+      uint res = OPER_PCIX_32();
+      uint* r_dst = &DX;
+
+      *r_dst = res;
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_32(res);
+      FLAG_Z = res;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_move_32_d_i:
+   {
+      uint res = OPER_I_32();
+      uint* r_dst = &DX;
+
+      *r_dst = res;
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_32(res);
+      FLAG_Z = res;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_move_32_ai_d:
+   {
+      uint res = DY;
+      uint ea = EA_AX_AI_32();
+
+      m68ki_write_32(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_32(res);
+      FLAG_Z = res;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_move_32_ai_a:
+   {
+      uint res = AY;
+      uint ea = EA_AX_AI_32();
+
+      m68ki_write_32(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_32(res);
+      FLAG_Z = res;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_move_32_ai_ai:
+   {
+      uint res = OPER_AY_AI_32();
+      uint ea = EA_AX_AI_32();
+
+      m68ki_write_32(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_32(res);
+      FLAG_Z = res;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_move_32_ai_pi:
+   {
+      uint res = OPER_AY_PI_32();
+      uint ea = EA_AX_AI_32();
+
+      m68ki_write_32(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_32(res);
+      FLAG_Z = res;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_move_32_ai_pd:
+   {
+      uint res = OPER_AY_PD_32();
+      uint ea = EA_AX_AI_32();
+
+      m68ki_write_32(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_32(res);
+      FLAG_Z = res;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_move_32_ai_di:
+   {
+      uint res = OPER_AY_DI_32();
+      uint ea = EA_AX_AI_32();
+
+      m68ki_write_32(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_32(res);
+      FLAG_Z = res;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_move_32_ai_ix:
+   {
+      uint res = OPER_AY_IX_32();
+      uint ea = EA_AX_AI_32();
+
+      m68ki_write_32(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_32(res);
+      FLAG_Z = res;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_move_32_ai_aw:
+   {
+      uint res = OPER_AW_32();
+      uint ea = EA_AX_AI_32();
+
+      m68ki_write_32(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_32(res);
+      FLAG_Z = res;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_move_32_ai_al:
+   {
+      uint res = OPER_AL_32();
+      uint ea = EA_AX_AI_32();
+
+      m68ki_write_32(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_32(res);
+      FLAG_Z = res;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_move_32_ai_pcdi:
+   {
+      uint res = OPER_PCDI_32();
+      uint ea = EA_AX_AI_32();
+
+      m68ki_write_32(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_32(res);
+      FLAG_Z = res;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_move_32_ai_pcix:
+   {
+      uint res = OPER_PCIX_32();
+      uint ea = EA_AX_AI_32();
+
+      m68ki_write_32(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_32(res);
+      FLAG_Z = res;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_move_32_ai_i:
+   {
+      uint res = OPER_I_32();
+      uint ea = EA_AX_AI_32();
+
+      m68ki_write_32(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_32(res);
+      FLAG_Z = res;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_move_32_pi_d:
+   {
+      uint res = DY;
+      uint ea = EA_AX_PI_32();
+
+      m68ki_write_32(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_32(res);
+      FLAG_Z = res;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_move_32_pi_a:
+   {
+      uint res = AY;
+      uint ea = EA_AX_PI_32();
+
+      m68ki_write_32(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_32(res);
+      FLAG_Z = res;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_move_32_pi_ai:
+   {
+      uint res = OPER_AY_AI_32();
+      uint ea = EA_AX_PI_32();
+
+      m68ki_write_32(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_32(res);
+      FLAG_Z = res;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_move_32_pi_pi:
+   {
+      uint res = OPER_AY_PI_32();
+      uint ea = EA_AX_PI_32();
+
+      m68ki_write_32(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_32(res);
+      FLAG_Z = res;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_move_32_pi_pd:
+   {
+      uint res = OPER_AY_PD_32();
+      uint ea = EA_AX_PI_32();
+
+      m68ki_write_32(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_32(res);
+      FLAG_Z = res;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_move_32_pi_di:
+   {
+      uint res = OPER_AY_DI_32();
+      uint ea = EA_AX_PI_32();
+
+      m68ki_write_32(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_32(res);
+      FLAG_Z = res;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_move_32_pi_ix:
+   {
+      uint res = OPER_AY_IX_32();
+      uint ea = EA_AX_PI_32();
+
+      m68ki_write_32(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_32(res);
+      FLAG_Z = res;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_move_32_pi_aw:
+   {
+      uint res = OPER_AW_32();
+      uint ea = EA_AX_PI_32();
+
+      m68ki_write_32(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_32(res);
+      FLAG_Z = res;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_move_32_pi_al:
+   {
+      uint res = OPER_AL_32();
+      uint ea = EA_AX_PI_32();
+
+      m68ki_write_32(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_32(res);
+      FLAG_Z = res;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_move_32_pi_pcdi:
+   {
+      uint res = OPER_PCDI_32();
+      uint ea = EA_AX_PI_32();
+
+      m68ki_write_32(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_32(res);
+      FLAG_Z = res;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_move_32_pi_pcix:
+   {
+      uint res = OPER_PCIX_32();
+      uint ea = EA_AX_PI_32();
+
+      m68ki_write_32(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_32(res);
+      FLAG_Z = res;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_move_32_pi_i:
+   {
+      uint res = OPER_I_32();
+      uint ea = EA_AX_PI_32();
+
+      m68ki_write_32(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_32(res);
+      FLAG_Z = res;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_move_32_pd_d:
+   {
+      uint res = DY;
+      uint ea = EA_AX_PD_32();
+
+      m68ki_write_32(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_32(res);
+      FLAG_Z = res;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_move_32_pd_a:
+   {
+      uint res = AY;
+      uint ea = EA_AX_PD_32();
+
+      m68ki_write_32(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_32(res);
+      FLAG_Z = res;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_move_32_pd_ai:
+   {
+      uint res = OPER_AY_AI_32();
+      uint ea = EA_AX_PD_32();
+
+      m68ki_write_32(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_32(res);
+      FLAG_Z = res;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_move_32_pd_pi:
+   {
+      uint res = OPER_AY_PI_32();
+      uint ea = EA_AX_PD_32();
+
+      m68ki_write_32(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_32(res);
+      FLAG_Z = res;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_move_32_pd_pd:
+   {
+      uint res = OPER_AY_PD_32();
+      uint ea = EA_AX_PD_32();
+
+      m68ki_write_32(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_32(res);
+      FLAG_Z = res;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_move_32_pd_di:
+   {
+      uint res = OPER_AY_DI_32();
+      uint ea = EA_AX_PD_32();
+
+      m68ki_write_32(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_32(res);
+      FLAG_Z = res;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_move_32_pd_ix:
+   {
+      uint res = OPER_AY_IX_32();
+      uint ea = EA_AX_PD_32();
+
+      m68ki_write_32(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_32(res);
+      FLAG_Z = res;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_move_32_pd_aw:
+   {
+      uint res = OPER_AW_32();
+      uint ea = EA_AX_PD_32();
+
+      m68ki_write_32(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_32(res);
+      FLAG_Z = res;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_move_32_pd_al:
+   {
+      uint res = OPER_AL_32();
+      uint ea = EA_AX_PD_32();
+
+      m68ki_write_32(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_32(res);
+      FLAG_Z = res;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_move_32_pd_pcdi:
+   {
+      uint res = OPER_PCDI_32();
+      uint ea = EA_AX_PD_32();
+
+      m68ki_write_32(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_32(res);
+      FLAG_Z = res;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_move_32_pd_pcix:
+   {
+      uint res = OPER_PCIX_32();
+      uint ea = EA_AX_PD_32();
+
+      m68ki_write_32(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_32(res);
+      FLAG_Z = res;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_move_32_pd_i:
+   {
+      uint res = OPER_I_32();
+      uint ea = EA_AX_PD_32();
+
+      m68ki_write_32(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_32(res);
+      FLAG_Z = res;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_move_32_di_d:
+   {
+      uint res = DY;
+      uint ea = EA_AX_DI_32();
+
+      m68ki_write_32(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_32(res);
+      FLAG_Z = res;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_move_32_di_a:
+   {
+      uint res = AY;
+      uint ea = EA_AX_DI_32();
+
+      m68ki_write_32(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_32(res);
+      FLAG_Z = res;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_move_32_di_ai:
+   {
+      uint res = OPER_AY_AI_32();
+      uint ea = EA_AX_DI_32();
+
+      m68ki_write_32(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_32(res);
+      FLAG_Z = res;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_move_32_di_pi:
+   {
+      uint res = OPER_AY_PI_32();
+      uint ea = EA_AX_DI_32();
+
+      m68ki_write_32(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_32(res);
+      FLAG_Z = res;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_move_32_di_pd:
+   {
+      uint res = OPER_AY_PD_32();
+      uint ea = EA_AX_DI_32();
+
+      m68ki_write_32(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_32(res);
+      FLAG_Z = res;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_move_32_di_di:
+   {
+      uint res = OPER_AY_DI_32();
+      uint ea = EA_AX_DI_32();
+
+      m68ki_write_32(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_32(res);
+      FLAG_Z = res;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_move_32_di_ix:
+   {
+      uint res = OPER_AY_IX_32();
+      uint ea = EA_AX_DI_32();
+
+      m68ki_write_32(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_32(res);
+      FLAG_Z = res;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_move_32_di_aw:
+   {
+      uint res = OPER_AW_32();
+      uint ea = EA_AX_DI_32();
+
+      m68ki_write_32(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_32(res);
+      FLAG_Z = res;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_move_32_di_al:
+   {
+      uint res = OPER_AL_32();
+      uint ea = EA_AX_DI_32();
+
+      m68ki_write_32(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_32(res);
+      FLAG_Z = res;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_move_32_di_pcdi:
+   {
+      uint res = OPER_PCDI_32();
+      uint ea = EA_AX_DI_32();
+
+      m68ki_write_32(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_32(res);
+      FLAG_Z = res;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_move_32_di_pcix:
+   {
+      uint res = OPER_PCIX_32();
+      uint ea = EA_AX_DI_32();
+
+      m68ki_write_32(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_32(res);
+      FLAG_Z = res;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_move_32_di_i:
+   {
+      uint res = OPER_I_32();
+      uint ea = EA_AX_DI_32();
+
+      m68ki_write_32(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_32(res);
+      FLAG_Z = res;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_move_32_ix_d:
+   {
+      uint res = DY;
+      uint ea = EA_AX_IX_32();
+
+      m68ki_write_32(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_32(res);
+      FLAG_Z = res;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_move_32_ix_a:
+   {
+      uint res = AY;
+      uint ea = EA_AX_IX_32();
+
+      m68ki_write_32(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_32(res);
+      FLAG_Z = res;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_move_32_ix_ai:
+   {
+      uint res = OPER_AY_AI_32();
+      uint ea = EA_AX_IX_32();
+
+      m68ki_write_32(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_32(res);
+      FLAG_Z = res;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_move_32_ix_pi:
+   {
+      uint res = OPER_AY_PI_32();
+      uint ea = EA_AX_IX_32();
+
+      m68ki_write_32(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_32(res);
+      FLAG_Z = res;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_move_32_ix_pd:
+   {
+      uint res = OPER_AY_PD_32();
+      uint ea = EA_AX_IX_32();
+
+      m68ki_write_32(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_32(res);
+      FLAG_Z = res;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_move_32_ix_di:
+   {
+      uint res = OPER_AY_DI_32();
+      uint ea = EA_AX_IX_32();
+
+      m68ki_write_32(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_32(res);
+      FLAG_Z = res;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_move_32_ix_ix:
+   {
+      uint res = OPER_AY_IX_32();
+      uint ea = EA_AX_IX_32();
+
+      m68ki_write_32(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_32(res);
+      FLAG_Z = res;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_move_32_ix_aw:
+   {
+      uint res = OPER_AW_32();
+      uint ea = EA_AX_IX_32();
+
+      m68ki_write_32(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_32(res);
+      FLAG_Z = res;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_move_32_ix_al:
+   {
+      uint res = OPER_AL_32();
+      uint ea = EA_AX_IX_32();
+
+      m68ki_write_32(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_32(res);
+      FLAG_Z = res;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_move_32_ix_pcdi:
+   {
+      uint res = OPER_PCDI_32();
+      uint ea = EA_AX_IX_32();
+
+      m68ki_write_32(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_32(res);
+      FLAG_Z = res;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_move_32_ix_pcix:
+   {
+      uint res = OPER_PCIX_32();
+      uint ea = EA_AX_IX_32();
+
+      m68ki_write_32(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_32(res);
+      FLAG_Z = res;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_move_32_ix_i:
+   {
+      uint res = OPER_I_32();
+      uint ea = EA_AX_IX_32();
+
+      m68ki_write_32(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_32(res);
+      FLAG_Z = res;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_move_32_aw_d:
+   {
+      uint res = DY;
+      uint ea = EA_AW_32();
+
+      m68ki_write_32(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_32(res);
+      FLAG_Z = res;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_move_32_aw_a:
+   {
+      uint res = AY;
+      uint ea = EA_AW_32();
+
+      m68ki_write_32(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_32(res);
+      FLAG_Z = res;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_move_32_aw_ai:
+   {
+      uint res = OPER_AY_AI_32();
+      uint ea = EA_AW_32();
+
+      m68ki_write_32(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_32(res);
+      FLAG_Z = res;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_move_32_aw_pi:
+   {
+      uint res = OPER_AY_PI_32();
+      uint ea = EA_AW_32();
+
+      m68ki_write_32(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_32(res);
+      FLAG_Z = res;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_move_32_aw_pd:
+   {
+      uint res = OPER_AY_PD_32();
+      uint ea = EA_AW_32();
+
+      m68ki_write_32(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_32(res);
+      FLAG_Z = res;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_move_32_aw_di:
+   {
+      uint res = OPER_AY_DI_32();
+      uint ea = EA_AW_32();
+
+      m68ki_write_32(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_32(res);
+      FLAG_Z = res;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_move_32_aw_ix:
+   {
+      uint res = OPER_AY_IX_32();
+      uint ea = EA_AW_32();
+
+      m68ki_write_32(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_32(res);
+      FLAG_Z = res;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_move_32_aw_aw:
+   {
+      uint res = OPER_AW_32();
+      uint ea = EA_AW_32();
+
+      m68ki_write_32(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_32(res);
+      FLAG_Z = res;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_move_32_aw_al:
+   {
+      uint res = OPER_AL_32();
+      uint ea = EA_AW_32();
+
+      m68ki_write_32(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_32(res);
+      FLAG_Z = res;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_move_32_aw_pcdi:
+   {
+      uint res = OPER_PCDI_32();
+      uint ea = EA_AW_32();
+
+      m68ki_write_32(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_32(res);
+      FLAG_Z = res;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_move_32_aw_pcix:
+   {
+      uint res = OPER_PCIX_32();
+      uint ea = EA_AW_32();
+
+      m68ki_write_32(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_32(res);
+      FLAG_Z = res;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_move_32_aw_i:
+   {
+      uint res = OPER_I_32();
+      uint ea = EA_AW_32();
+
+      m68ki_write_32(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_32(res);
+      FLAG_Z = res;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_move_32_al_d:
+   {
+      uint res = DY;
+      uint ea = EA_AL_32();
+
+      m68ki_write_32(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_32(res);
+      FLAG_Z = res;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_move_32_al_a:
+   {
+      uint res = AY;
+      uint ea = EA_AL_32();
+
+      m68ki_write_32(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_32(res);
+      FLAG_Z = res;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_move_32_al_ai:
+   {
+      uint res = OPER_AY_AI_32();
+      uint ea = EA_AL_32();
+
+      m68ki_write_32(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_32(res);
+      FLAG_Z = res;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_move_32_al_pi:
+   {
+      uint res = OPER_AY_PI_32();
+      uint ea = EA_AL_32();
+
+      m68ki_write_32(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_32(res);
+      FLAG_Z = res;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_move_32_al_pd:
+   {
+      uint res = OPER_AY_PD_32();
+      uint ea = EA_AL_32();
+
+      m68ki_write_32(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_32(res);
+      FLAG_Z = res;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_move_32_al_di:
+   {
+      uint res = OPER_AY_DI_32();
+      uint ea = EA_AL_32();
+
+      m68ki_write_32(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_32(res);
+      FLAG_Z = res;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_move_32_al_ix:
+   {
+      uint res = OPER_AY_IX_32();
+      uint ea = EA_AL_32();
+
+      m68ki_write_32(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_32(res);
+      FLAG_Z = res;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_move_32_al_aw:
+   {
+      uint res = OPER_AW_32();
+      uint ea = EA_AL_32();
+
+      m68ki_write_32(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_32(res);
+      FLAG_Z = res;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_move_32_al_al:
+   {
+      uint res = OPER_AL_32();
+      uint ea = EA_AL_32();
+
+      m68ki_write_32(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_32(res);
+      FLAG_Z = res;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_move_32_al_pcdi:
+   {
+      uint res = OPER_PCDI_32();
+      uint ea = EA_AL_32();
+
+      m68ki_write_32(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_32(res);
+      FLAG_Z = res;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_move_32_al_pcix:
+   {
+      uint res = OPER_PCIX_32();
+      uint ea = EA_AL_32();
+
+      m68ki_write_32(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_32(res);
+      FLAG_Z = res;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_move_32_al_i:
+   {
+      uint res = OPER_I_32();
+      uint ea = EA_AL_32();
+
+      m68ki_write_32(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_32(res);
+      FLAG_Z = res;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_movea_16_d:
+   {
+      AX = MAKE_INT_16(DY);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_movea_16_a:
+   {
+      AX = MAKE_INT_16(AY);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_movea_16_ai:
+   {
+      AX = MAKE_INT_16(OPER_AY_AI_16());
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_movea_16_pi:
+   {
+      AX = MAKE_INT_16(OPER_AY_PI_16());
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_movea_16_pd:
+   {
+      AX = MAKE_INT_16(OPER_AY_PD_16());
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_movea_16_di:
+   {
+      AX = MAKE_INT_16(OPER_AY_DI_16());
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_movea_16_ix:
+   {
+      AX = MAKE_INT_16(OPER_AY_IX_16());
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_movea_16_aw:
+   {
+      AX = MAKE_INT_16(OPER_AW_16());
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_movea_16_al:
+   {
+      AX = MAKE_INT_16(OPER_AL_16());
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_movea_16_pcdi:
+   {
+      AX = MAKE_INT_16(OPER_PCDI_16());
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_movea_16_pcix:
+   {
+      AX = MAKE_INT_16(OPER_PCIX_16());
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_movea_16_i:
+   {
+      AX = MAKE_INT_16(OPER_I_16());
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_movea_32_d:
+   {
+      AX = DY;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_movea_32_a:
+   {
+      AX = AY;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_movea_32_ai:
+   {
+      AX = OPER_AY_AI_32();
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_movea_32_pi:
+   {
+      AX = OPER_AY_PI_32();
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_movea_32_pd:
+   {
+      AX = OPER_AY_PD_32();
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_movea_32_di:
+   {
+      AX = OPER_AY_DI_32();
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_movea_32_ix:
+   {
+      AX = OPER_AY_IX_32();
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_movea_32_aw:
+   {
+      AX = OPER_AW_32();
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_movea_32_al:
+   {
+      AX = OPER_AL_32();
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_movea_32_pcdi:
+   {
+      AX = OPER_PCDI_32();
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_movea_32_pcix:
+   {
+      AX = OPER_PCIX_32();
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_movea_32_i:
+   {
+      AX = OPER_I_32();
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_move_16_frc_d:
+   {
+      if(CPU_TYPE_IS_010_PLUS(CPU_TYPE))
+      {
+         DY = MASK_OUT_BELOW_16(DY) | m68ki_get_ccr();
+         goto m68k_op_move_16_frc_d_done;
+      }
+      m68ki_exception_illegal();
+   }
+m68k_op_move_16_frc_d_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_move_16_frc_ai:
+   {
+      if(CPU_TYPE_IS_010_PLUS(CPU_TYPE))
+      {
+         m68ki_write_16(EA_AY_AI_16(), m68ki_get_ccr());
+         goto m68k_op_move_16_frc_ai_done;
+      }
+      m68ki_exception_illegal();
+   }
+m68k_op_move_16_frc_ai_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_move_16_frc_pi:
+   {
+      if(CPU_TYPE_IS_010_PLUS(CPU_TYPE))
+      {
+         m68ki_write_16(EA_AY_PI_16(), m68ki_get_ccr());
+         goto m68k_op_move_16_frc_pi_done;
+      }
+      m68ki_exception_illegal();
+   }
+m68k_op_move_16_frc_pi_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_move_16_frc_pd:
+   {
+      if(CPU_TYPE_IS_010_PLUS(CPU_TYPE))
+      {
+         m68ki_write_16(EA_AY_PD_16(), m68ki_get_ccr());
+         goto m68k_op_move_16_frc_pd_done;
+      }
+      m68ki_exception_illegal();
+   }
+m68k_op_move_16_frc_pd_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_move_16_frc_di:
+   {
+      if(CPU_TYPE_IS_010_PLUS(CPU_TYPE))
+      {
+         m68ki_write_16(EA_AY_DI_16(), m68ki_get_ccr());
+         goto m68k_op_move_16_frc_di_done;
+      }
+      m68ki_exception_illegal();
+   }
+m68k_op_move_16_frc_di_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_move_16_frc_ix:
+   {
+      if(CPU_TYPE_IS_010_PLUS(CPU_TYPE))
+      {
+         m68ki_write_16(EA_AY_IX_16(), m68ki_get_ccr());
+         goto m68k_op_move_16_frc_ix_done;
+      }
+      m68ki_exception_illegal();
+   }
+m68k_op_move_16_frc_ix_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_move_16_frc_aw:
+   {
+      if(CPU_TYPE_IS_010_PLUS(CPU_TYPE))
+      {
+         m68ki_write_16(EA_AW_16(), m68ki_get_ccr());
+         goto m68k_op_move_16_frc_aw_done;
+      }
+      m68ki_exception_illegal();
+   }
+m68k_op_move_16_frc_aw_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_move_16_frc_al:
+   {
+      if(CPU_TYPE_IS_010_PLUS(CPU_TYPE))
+      {
+         m68ki_write_16(EA_AL_16(), m68ki_get_ccr());
+         goto m68k_op_move_16_frc_al_done;
+      }
+      m68ki_exception_illegal();
+   }
+m68k_op_move_16_frc_al_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_move_16_toc_d:
+   {
+      m68ki_set_ccr(DY);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_move_16_toc_ai:
+   {
+      m68ki_set_ccr(OPER_AY_AI_16());
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_move_16_toc_pi:
+   {
+      m68ki_set_ccr(OPER_AY_PI_16());
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_move_16_toc_pd:
+   {
+      m68ki_set_ccr(OPER_AY_PD_16());
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_move_16_toc_di:
+   {
+      m68ki_set_ccr(OPER_AY_DI_16());
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_move_16_toc_ix:
+   {
+      m68ki_set_ccr(OPER_AY_IX_16());
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_move_16_toc_aw:
+   {
+      m68ki_set_ccr(OPER_AW_16());
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_move_16_toc_al:
+   {
+      m68ki_set_ccr(OPER_AL_16());
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_move_16_toc_pcdi:
+   {
+      m68ki_set_ccr(OPER_PCDI_16());
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_move_16_toc_pcix:
+   {
+      m68ki_set_ccr(OPER_PCIX_16());
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_move_16_toc_i:
+   {
+      m68ki_set_ccr(OPER_I_16());
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_move_16_frs_d:
+   {
+      if(CPU_TYPE_IS_000(CPU_TYPE) || FLAG_S)	/* NS990408 */
+      {
+         DY = MASK_OUT_BELOW_16(DY) | m68ki_get_sr();
+         goto m68k_op_move_16_frs_d_done;
+      }
+      m68ki_exception_privilege_violation();
+   }
+m68k_op_move_16_frs_d_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_move_16_frs_ai:
+   {
+      if(CPU_TYPE_IS_000(CPU_TYPE) || FLAG_S)	/* NS990408 */
+      {
+         uint ea = EA_AY_AI_16();
+         m68ki_write_16(ea, m68ki_get_sr());
+         goto m68k_op_move_16_frs_ai_done;
+      }
+      m68ki_exception_privilege_violation();
+   }
+m68k_op_move_16_frs_ai_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_move_16_frs_pi:
+   {
+      if(CPU_TYPE_IS_000(CPU_TYPE) || FLAG_S)	/* NS990408 */
+      {
+         uint ea = EA_AY_PI_16();
+         m68ki_write_16(ea, m68ki_get_sr());
+         goto m68k_op_move_16_frs_pi_done;
+      }
+      m68ki_exception_privilege_violation();
+   }
+m68k_op_move_16_frs_pi_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_move_16_frs_pd:
+   {
+      if(CPU_TYPE_IS_000(CPU_TYPE) || FLAG_S)	/* NS990408 */
+      {
+         uint ea = EA_AY_PD_16();
+         m68ki_write_16(ea, m68ki_get_sr());
+         goto m68k_op_move_16_frs_pd_done;
+      }
+      m68ki_exception_privilege_violation();
+   }
+m68k_op_move_16_frs_pd_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_move_16_frs_di:
+   {
+      if(CPU_TYPE_IS_000(CPU_TYPE) || FLAG_S)	/* NS990408 */
+      {
+         uint ea = EA_AY_DI_16();
+         m68ki_write_16(ea, m68ki_get_sr());
+         goto m68k_op_move_16_frs_di_done;
+      }
+      m68ki_exception_privilege_violation();
+   }
+m68k_op_move_16_frs_di_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_move_16_frs_ix:
+   {
+      if(CPU_TYPE_IS_000(CPU_TYPE) || FLAG_S)	/* NS990408 */
+      {
+         uint ea = EA_AY_IX_16();
+         m68ki_write_16(ea, m68ki_get_sr());
+         goto m68k_op_move_16_frs_ix_done;
+      }
+      m68ki_exception_privilege_violation();
+   }
+m68k_op_move_16_frs_ix_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_move_16_frs_aw:
+   {
+      if(CPU_TYPE_IS_000(CPU_TYPE) || FLAG_S)	/* NS990408 */
+      {
+         uint ea = EA_AW_16();
+         m68ki_write_16(ea, m68ki_get_sr());
+         goto m68k_op_move_16_frs_aw_done;
+      }
+      m68ki_exception_privilege_violation();
+   }
+m68k_op_move_16_frs_aw_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_move_16_frs_al:
+   {
+      if(CPU_TYPE_IS_000(CPU_TYPE) || FLAG_S)	/* NS990408 */
+      {
+         uint ea = EA_AL_16();
+         m68ki_write_16(ea, m68ki_get_sr());
+         goto m68k_op_move_16_frs_al_done;
+      }
+      m68ki_exception_privilege_violation();
+   }
+m68k_op_move_16_frs_al_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_move_16_tos_d:
+   {
+      if(FLAG_S)
+      {
+         m68ki_set_sr(DY);
+         goto m68k_op_move_16_tos_d_done;
+      }
+      m68ki_exception_privilege_violation();
+   }
+m68k_op_move_16_tos_d_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_move_16_tos_ai:
+   {
+      if(FLAG_S)
+      {
+         uint new_sr = OPER_AY_AI_16();
+         m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
+         m68ki_set_sr(new_sr);
+         goto m68k_op_move_16_tos_ai_done;
+      }
+      m68ki_exception_privilege_violation();
+   }
+m68k_op_move_16_tos_ai_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_move_16_tos_pi:
+   {
+      if(FLAG_S)
+      {
+         uint new_sr = OPER_AY_PI_16();
+         m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
+         m68ki_set_sr(new_sr);
+         goto m68k_op_move_16_tos_pi_done;
+      }
+      m68ki_exception_privilege_violation();
+   }
+m68k_op_move_16_tos_pi_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_move_16_tos_pd:
+   {
+      if(FLAG_S)
+      {
+         uint new_sr = OPER_AY_PD_16();
+         m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
+         m68ki_set_sr(new_sr);
+         goto m68k_op_move_16_tos_pd_done;
+      }
+      m68ki_exception_privilege_violation();
+   }
+m68k_op_move_16_tos_pd_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_move_16_tos_di:
+   {
+      if(FLAG_S)
+      {
+         uint new_sr = OPER_AY_DI_16();
+         m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
+         m68ki_set_sr(new_sr);
+         goto m68k_op_move_16_tos_di_done;
+      }
+      m68ki_exception_privilege_violation();
+   }
+m68k_op_move_16_tos_di_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_move_16_tos_ix:
+   {
+      if(FLAG_S)
+      {
+         uint new_sr = OPER_AY_IX_16();
+         m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
+         m68ki_set_sr(new_sr);
+         goto m68k_op_move_16_tos_ix_done;
+      }
+      m68ki_exception_privilege_violation();
+   }
+m68k_op_move_16_tos_ix_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_move_16_tos_aw:
+   {
+      if(FLAG_S)
+      {
+         uint new_sr = OPER_AW_16();
+         m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
+         m68ki_set_sr(new_sr);
+         goto m68k_op_move_16_tos_aw_done;
+      }
+      m68ki_exception_privilege_violation();
+   }
+m68k_op_move_16_tos_aw_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_move_16_tos_al:
+   {
+      if(FLAG_S)
+      {
+         uint new_sr = OPER_AL_16();
+         m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
+         m68ki_set_sr(new_sr);
+         goto m68k_op_move_16_tos_al_done;
+      }
+      m68ki_exception_privilege_violation();
+   }
+m68k_op_move_16_tos_al_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_move_16_tos_pcdi:
+   {
+      if(FLAG_S)
+      {
+         uint new_sr = OPER_PCDI_16();
+         m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
+         m68ki_set_sr(new_sr);
+         goto m68k_op_move_16_tos_pcdi_done;
+      }
+      m68ki_exception_privilege_violation();
+   }
+m68k_op_move_16_tos_pcdi_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_move_16_tos_pcix:
+   {
+      if(FLAG_S)
+      {
+         uint new_sr = OPER_PCIX_16();
+         m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
+         m68ki_set_sr(new_sr);
+         goto m68k_op_move_16_tos_pcix_done;
+      }
+      m68ki_exception_privilege_violation();
+   }
+m68k_op_move_16_tos_pcix_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_move_16_tos_i:
+   {
+      if(FLAG_S)
+      {
+         uint new_sr = OPER_I_16();
+         m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
+         m68ki_set_sr(new_sr);
+         goto m68k_op_move_16_tos_i_done;
+      }
+      m68ki_exception_privilege_violation();
+   }
+m68k_op_move_16_tos_i_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_move_32_fru:
+   {
+      if(FLAG_S)
+      {
+         AY = REG_USP;
+         goto m68k_op_move_32_fru_done;
+      }
+      m68ki_exception_privilege_violation();
+   }
+m68k_op_move_32_fru_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_move_32_tou:
+   {
+      if(FLAG_S)
+      {
+         m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
+         REG_USP = AY;
+         goto m68k_op_move_32_tou_done;
+      }
+      m68ki_exception_privilege_violation();
+   }
+m68k_op_move_32_tou_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_movec_32_cr:
+   {
+      if(CPU_TYPE_IS_010_PLUS(CPU_TYPE))
+      {
+         if(FLAG_S)
+         {
+            uint word2 = OPER_I_16();
+
+            m68ki_trace_t0();		   /* auto-disable (see m68kcpu.h) */
+            switch (word2 & 0xfff)
+            {
+            case 0x000:			   /* SFC */
+               REG_DA[(word2 >> 12) & 15] = REG_SFC;
+               goto m68k_op_movec_32_cr_done;
+            case 0x001:			   /* DFC */
+               REG_DA[(word2 >> 12) & 15] = REG_DFC;
+               goto m68k_op_movec_32_cr_done;
+            case 0x002:			   /* CACR */
+               if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+               {
+                  REG_DA[(word2 >> 12) & 15] = REG_CACR;
+                  goto m68k_op_movec_32_cr_done;
+               }
+               goto m68k_op_movec_32_cr_done;
+            case 0x800:			   /* USP */
+               REG_DA[(word2 >> 12) & 15] = REG_USP;
+               goto m68k_op_movec_32_cr_done;
+            case 0x801:			   /* VBR */
+               REG_DA[(word2 >> 12) & 15] = REG_VBR;
+               goto m68k_op_movec_32_cr_done;
+            case 0x802:			   /* CAAR */
+               if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+               {
+                  REG_DA[(word2 >> 12) & 15] = REG_CAAR;
+                  goto m68k_op_movec_32_cr_done;
+               }
+               m68ki_exception_illegal();
+               break;
+            case 0x803:			   /* MSP */
+               if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+               {
+                  REG_DA[(word2 >> 12) & 15] = FLAG_M ? REG_SP : REG_MSP;
+                  goto m68k_op_movec_32_cr_done;
+               }
+               m68ki_exception_illegal();
+               goto m68k_op_movec_32_cr_done;
+            case 0x804:			   /* ISP */
+               if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+               {
+                  REG_DA[(word2 >> 12) & 15] = FLAG_M ? REG_ISP : REG_SP;
+                  goto m68k_op_movec_32_cr_done;
+               }
+               m68ki_exception_illegal();
+               goto m68k_op_movec_32_cr_done;
+            default:
+               m68ki_exception_illegal();
+               goto m68k_op_movec_32_cr_done;
+            }
+         }
+         m68ki_exception_privilege_violation();
+         goto m68k_op_movec_32_cr_done;
+      }
+      m68ki_exception_illegal();
+   }
+m68k_op_movec_32_cr_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_movec_32_rc:
+   {
+      if(CPU_TYPE_IS_010_PLUS(CPU_TYPE))
+      {
+         if(FLAG_S)
+         {
+            uint word2 = OPER_I_16();
+
+            m68ki_trace_t0();		   /* auto-disable (see m68kcpu.h) */
+            switch (word2 & 0xfff)
+            {
+            case 0x000:			   /* SFC */
+               REG_SFC = REG_DA[(word2 >> 12) & 15] & 7;
+               goto m68k_op_movec_32_rc_done;
+            case 0x001:			   /* DFC */
+               REG_DFC = REG_DA[(word2 >> 12) & 15] & 7;
+               goto m68k_op_movec_32_rc_done;
+            case 0x002:			   /* CACR */
+               if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+               {
+                  REG_CACR = REG_DA[(word2 >> 12) & 15];
+                  goto m68k_op_movec_32_rc_done;
+               }
+               m68ki_exception_illegal();
+               goto m68k_op_movec_32_rc_done;
+            case 0x800:			   /* USP */
+               REG_USP = REG_DA[(word2 >> 12) & 15];
+               goto m68k_op_movec_32_rc_done;
+            case 0x801:			   /* VBR */
+               REG_VBR = REG_DA[(word2 >> 12) & 15];
+               goto m68k_op_movec_32_rc_done;
+            case 0x802:			   /* CAAR */
+               if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+               {
+                  REG_CAAR = REG_DA[(word2 >> 12) & 15];
+                  goto m68k_op_movec_32_rc_done;
+               }
+               m68ki_exception_illegal();
+               goto m68k_op_movec_32_rc_done;
+            case 0x803:			   /* MSP */
+               if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+               {
+                  /* we are in supervisor mode so just check for M flag */
+                  if(!FLAG_M)
+                  {
+                     REG_MSP = REG_DA[(word2 >> 12) & 15];
+                     goto m68k_op_movec_32_rc_done;
+                  }
+                  REG_SP = REG_DA[(word2 >> 12) & 15];
+                  goto m68k_op_movec_32_rc_done;
+               }
+               m68ki_exception_illegal();
+               goto m68k_op_movec_32_rc_done;
+            case 0x804:			   /* ISP */
+               if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+               {
+                  if(!FLAG_M)
+                  {
+                     REG_SP = REG_DA[(word2 >> 12) & 15];
+                     goto m68k_op_movec_32_rc_done;
+                  }
+                  REG_ISP = REG_DA[(word2 >> 12) & 15];
+                  goto m68k_op_movec_32_rc_done;
+               }
+               m68ki_exception_illegal();
+               goto m68k_op_movec_32_rc_done;
+            default:
+               m68ki_exception_illegal();
+               goto m68k_op_movec_32_rc_done;
+            }
+         }
+         m68ki_exception_privilege_violation();
+         goto m68k_op_movec_32_rc_done;
+      }
+      m68ki_exception_illegal();
+   }
+m68k_op_movec_32_rc_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_movem_16_re_pd:
+   {
+      uint i = 0;
+      uint register_list = OPER_I_16();
+      uint ea = AY;
+      uint count = 0;
+
+      for(; i < 16; i++)
+         if(register_list & (1 << i))
+         {
+            ea -= 2;
+            m68ki_write_16(ea, MASK_OUT_ABOVE_16(REG_DA[15-i]));
+            count++;
+         }
+      AY = ea;
+
+      USE_CYCLES(count<<CYC_MOVEM_W);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_movem_16_re_ai:
+   {
+      uint i = 0;
+      uint register_list = OPER_I_16();
+      uint ea = EA_AY_AI_16();
+      uint count = 0;
+
+      for(; i < 16; i++)
+         if(register_list & (1 << i))
+         {
+            m68ki_write_16(ea, MASK_OUT_ABOVE_16(REG_DA[i]));
+            ea += 2;
+            count++;
+         }
+
+      USE_CYCLES(count<<CYC_MOVEM_W);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_movem_16_re_di:
+   {
+      uint i = 0;
+      uint register_list = OPER_I_16();
+      uint ea = EA_AY_DI_16();
+      uint count = 0;
+
+      for(; i < 16; i++)
+         if(register_list & (1 << i))
+         {
+            m68ki_write_16(ea, MASK_OUT_ABOVE_16(REG_DA[i]));
+            ea += 2;
+            count++;
+         }
+
+      USE_CYCLES(count<<CYC_MOVEM_W);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_movem_16_re_ix:
+   {
+      uint i = 0;
+      uint register_list = OPER_I_16();
+      uint ea = EA_AY_IX_16();
+      uint count = 0;
+
+      for(; i < 16; i++)
+         if(register_list & (1 << i))
+         {
+            m68ki_write_16(ea, MASK_OUT_ABOVE_16(REG_DA[i]));
+            ea += 2;
+            count++;
+         }
+
+      USE_CYCLES(count<<CYC_MOVEM_W);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_movem_16_re_aw:
+   {
+      uint i = 0;
+      uint register_list = OPER_I_16();
+      uint ea = EA_AW_16();
+      uint count = 0;
+
+      for(; i < 16; i++)
+         if(register_list & (1 << i))
+         {
+            m68ki_write_16(ea, MASK_OUT_ABOVE_16(REG_DA[i]));
+            ea += 2;
+            count++;
+         }
+
+      USE_CYCLES(count<<CYC_MOVEM_W);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_movem_16_re_al:
+   {
+      uint i = 0;
+      uint register_list = OPER_I_16();
+      uint ea = EA_AL_16();
+      uint count = 0;
+
+      for(; i < 16; i++)
+         if(register_list & (1 << i))
+         {
+            m68ki_write_16(ea, MASK_OUT_ABOVE_16(REG_DA[i]));
+            ea += 2;
+            count++;
+         }
+
+      USE_CYCLES(count<<CYC_MOVEM_W);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_movem_32_re_pd:
+   {
+      uint i = 0;
+      uint register_list = OPER_I_16();
+      uint ea = AY;
+      uint count = 0;
+
+      for(; i < 16; i++)
+         if(register_list & (1 << i))
+         {
+            ea -= 4;
+            m68ki_write_32(ea, REG_DA[15-i]);
+            count++;
+         }
+      AY = ea;
+
+      USE_CYCLES(count<<CYC_MOVEM_L);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_movem_32_re_ai:
+   {
+      uint i = 0;
+      uint register_list = OPER_I_16();
+      uint ea = EA_AY_AI_32();
+      uint count = 0;
+
+      for(; i < 16; i++)
+         if(register_list & (1 << i))
+         {
+            m68ki_write_32(ea, REG_DA[i]);
+            ea += 4;
+            count++;
+         }
+
+      USE_CYCLES(count<<CYC_MOVEM_L);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_movem_32_re_di:
+   {
+      uint i = 0;
+      uint register_list = OPER_I_16();
+      uint ea = EA_AY_DI_32();
+      uint count = 0;
+
+      for(; i < 16; i++)
+         if(register_list & (1 << i))
+         {
+            m68ki_write_32(ea, REG_DA[i]);
+            ea += 4;
+            count++;
+         }
+
+      USE_CYCLES(count<<CYC_MOVEM_L);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_movem_32_re_ix:
+   {
+      uint i = 0;
+      uint register_list = OPER_I_16();
+      uint ea = EA_AY_IX_32();
+      uint count = 0;
+
+      for(; i < 16; i++)
+         if(register_list & (1 << i))
+         {
+            m68ki_write_32(ea, REG_DA[i]);
+            ea += 4;
+            count++;
+         }
+
+      USE_CYCLES(count<<CYC_MOVEM_L);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_movem_32_re_aw:
+   {
+      uint i = 0;
+      uint register_list = OPER_I_16();
+      uint ea = EA_AW_32();
+      uint count = 0;
+
+      for(; i < 16; i++)
+         if(register_list & (1 << i))
+         {
+            m68ki_write_32(ea, REG_DA[i]);
+            ea += 4;
+            count++;
+         }
+
+      USE_CYCLES(count<<CYC_MOVEM_L);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_movem_32_re_al:
+   {
+      uint i = 0;
+      uint register_list = OPER_I_16();
+      uint ea = EA_AL_32();
+      uint count = 0;
+
+      for(; i < 16; i++)
+         if(register_list & (1 << i))
+         {
+            m68ki_write_32(ea, REG_DA[i]);
+            ea += 4;
+            count++;
+         }
+
+      USE_CYCLES(count<<CYC_MOVEM_L);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_movem_16_er_pi:
+   {
+      uint i = 0;
+      uint register_list = OPER_I_16();
+      uint ea = AY;
+      uint count = 0;
+
+      for(; i < 16; i++)
+         if(register_list & (1 << i))
+         {
+            REG_DA[i] = MAKE_INT_16(MASK_OUT_ABOVE_16(m68ki_read_16(ea)));
+            ea += 2;
+            count++;
+         }
+      AY = ea;
+
+      USE_CYCLES(count<<CYC_MOVEM_W);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_movem_16_er_pcdi:
+   {
+      uint i = 0;
+      uint register_list = OPER_I_16();
+      uint ea = EA_PCDI_16();
+      uint count = 0;
+
+      for(; i < 16; i++)
+         if(register_list & (1 << i))
+         {
+            REG_DA[i] = MAKE_INT_16(MASK_OUT_ABOVE_16(m68ki_read_pcrel_16(ea)));
+            ea += 2;
+            count++;
+         }
+
+      USE_CYCLES(count<<CYC_MOVEM_W);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_movem_16_er_pcix:
+   {
+      uint i = 0;
+      uint register_list = OPER_I_16();
+      uint ea = EA_PCIX_16();
+      uint count = 0;
+
+      for(; i < 16; i++)
+         if(register_list & (1 << i))
+         {
+            REG_DA[i] = MAKE_INT_16(MASK_OUT_ABOVE_16(m68ki_read_pcrel_16(ea)));
+            ea += 2;
+            count++;
+         }
+
+      USE_CYCLES(count<<CYC_MOVEM_W);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_movem_16_er_ai:
+   {
+      uint i = 0;
+      uint register_list = OPER_I_16();
+      uint ea = EA_AY_AI_16();
+      uint count = 0;
+
+      for(; i < 16; i++)
+         if(register_list & (1 << i))
+         {
+            REG_DA[i] = MAKE_INT_16(MASK_OUT_ABOVE_16(m68ki_read_16(ea)));
+            ea += 2;
+            count++;
+         }
+
+      USE_CYCLES(count<<CYC_MOVEM_W);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_movem_16_er_di:
+   {
+      uint i = 0;
+      uint register_list = OPER_I_16();
+      uint ea = EA_AY_DI_16();
+      uint count = 0;
+
+      for(; i < 16; i++)
+         if(register_list & (1 << i))
+         {
+            REG_DA[i] = MAKE_INT_16(MASK_OUT_ABOVE_16(m68ki_read_16(ea)));
+            ea += 2;
+            count++;
+         }
+
+      USE_CYCLES(count<<CYC_MOVEM_W);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_movem_16_er_ix:
+   {
+      uint i = 0;
+      uint register_list = OPER_I_16();
+      uint ea = EA_AY_IX_16();
+      uint count = 0;
+
+      for(; i < 16; i++)
+         if(register_list & (1 << i))
+         {
+            REG_DA[i] = MAKE_INT_16(MASK_OUT_ABOVE_16(m68ki_read_16(ea)));
+            ea += 2;
+            count++;
+         }
+
+      USE_CYCLES(count<<CYC_MOVEM_W);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_movem_16_er_aw:
+   {
+      uint i = 0;
+      uint register_list = OPER_I_16();
+      uint ea = EA_AW_16();
+      uint count = 0;
+
+      for(; i < 16; i++)
+         if(register_list & (1 << i))
+         {
+            REG_DA[i] = MAKE_INT_16(MASK_OUT_ABOVE_16(m68ki_read_16(ea)));
+            ea += 2;
+            count++;
+         }
+
+      USE_CYCLES(count<<CYC_MOVEM_W);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_movem_16_er_al:
+   {
+      uint i = 0;
+      uint register_list = OPER_I_16();
+      uint ea = EA_AL_16();
+      uint count = 0;
+
+      for(; i < 16; i++)
+         if(register_list & (1 << i))
+         {
+            REG_DA[i] = MAKE_INT_16(MASK_OUT_ABOVE_16(m68ki_read_16(ea)));
+            ea += 2;
+            count++;
+         }
+
+      USE_CYCLES(count<<CYC_MOVEM_W);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_movem_32_er_pi:
+   {
+      uint i = 0;
+      uint register_list = OPER_I_16();
+      uint ea = AY;
+      uint count = 0;
+
+      for(; i < 16; i++)
+         if(register_list & (1 << i))
+         {
+            REG_DA[i] = m68ki_read_32(ea);
+            ea += 4;
+            count++;
+         }
+      AY = ea;
+
+      USE_CYCLES(count<<CYC_MOVEM_L);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_movem_32_er_pcdi:
+   {
+      uint i = 0;
+      uint register_list = OPER_I_16();
+      uint ea = EA_PCDI_32();
+      uint count = 0;
+
+      for(; i < 16; i++)
+         if(register_list & (1 << i))
+         {
+            REG_DA[i] = m68ki_read_pcrel_32(ea);
+            ea += 4;
+            count++;
+         }
+
+      USE_CYCLES(count<<CYC_MOVEM_L);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_movem_32_er_pcix:
+   {
+      uint i = 0;
+      uint register_list = OPER_I_16();
+      uint ea = EA_PCIX_32();
+      uint count = 0;
+
+      for(; i < 16; i++)
+         if(register_list & (1 << i))
+         {
+            REG_DA[i] = m68ki_read_pcrel_32(ea);
+            ea += 4;
+            count++;
+         }
+
+      USE_CYCLES(count<<CYC_MOVEM_L);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_movem_32_er_ai:
+   {
+      uint i = 0;
+      uint register_list = OPER_I_16();
+      uint ea = EA_AY_AI_32();
+      uint count = 0;
+
+      for(; i < 16; i++)
+         if(register_list & (1 << i))
+         {
+            REG_DA[i] = m68ki_read_32(ea);
+            ea += 4;
+            count++;
+         }
+
+      USE_CYCLES(count<<CYC_MOVEM_L);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_movem_32_er_di:
+   {
+      uint i = 0;
+      uint register_list = OPER_I_16();
+      uint ea = EA_AY_DI_32();
+      uint count = 0;
+
+      for(; i < 16; i++)
+         if(register_list & (1 << i))
+         {
+            REG_DA[i] = m68ki_read_32(ea);
+            ea += 4;
+            count++;
+         }
+
+      USE_CYCLES(count<<CYC_MOVEM_L);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_movem_32_er_ix:
+   {
+      uint i = 0;
+      uint register_list = OPER_I_16();
+      uint ea = EA_AY_IX_32();
+      uint count = 0;
+
+      for(; i < 16; i++)
+         if(register_list & (1 << i))
+         {
+            REG_DA[i] = m68ki_read_32(ea);
+            ea += 4;
+            count++;
+         }
+
+      USE_CYCLES(count<<CYC_MOVEM_L);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_movem_32_er_aw:
+   {
+      uint i = 0;
+      uint register_list = OPER_I_16();
+      uint ea = EA_AW_32();
+      uint count = 0;
+
+      for(; i < 16; i++)
+         if(register_list & (1 << i))
+         {
+            REG_DA[i] = m68ki_read_32(ea);
+            ea += 4;
+            count++;
+         }
+
+      USE_CYCLES(count<<CYC_MOVEM_L);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_movem_32_er_al:
+   {
+      uint i = 0;
+      uint register_list = OPER_I_16();
+      uint ea = EA_AL_32();
+      uint count = 0;
+
+      for(; i < 16; i++)
+         if(register_list & (1 << i))
+         {
+            REG_DA[i] = m68ki_read_32(ea);
+            ea += 4;
+            count++;
+         }
+
+      USE_CYCLES(count<<CYC_MOVEM_L);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_movep_16_re:
+   {
+      uint ea = EA_AY_DI_16();
+      uint src = DX;
+
+      m68ki_write_8(ea, MASK_OUT_ABOVE_8(src >> 8));
+      m68ki_write_8(ea += 2, MASK_OUT_ABOVE_8(src));
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_movep_32_re:
+   {
+      uint ea = EA_AY_DI_32();
+      uint src = DX;
+
+      m68ki_write_8(ea, MASK_OUT_ABOVE_8(src >> 24));
+      m68ki_write_8(ea += 2, MASK_OUT_ABOVE_8(src >> 16));
+      m68ki_write_8(ea += 2, MASK_OUT_ABOVE_8(src >> 8));
+      m68ki_write_8(ea += 2, MASK_OUT_ABOVE_8(src));
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_movep_16_er:
+   {
+      uint ea = EA_AY_DI_16();
+      uint* r_dst = &DX;
+
+      *r_dst = MASK_OUT_BELOW_16(*r_dst) | ((m68ki_read_8(ea) << 8) + m68ki_read_8(ea + 2));
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_movep_32_er:
+   {
+      uint ea = EA_AY_DI_32();
+
+      DX = (m68ki_read_8(ea) << 24) + (m68ki_read_8(ea + 2) << 16)
+         + (m68ki_read_8(ea + 4) << 8) + m68ki_read_8(ea + 6);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_moves_8_ai:
+   {
+      if(CPU_TYPE_IS_010_PLUS(CPU_TYPE))
+      {
+         if(FLAG_S)
+         {
+            uint word2 = OPER_I_16();
+            uint ea = EA_AY_AI_8();
+
+            m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
+            if(BIT_B(word2))		   /* Register to memory */
+            {
+               m68ki_write_8_fc(ea, REG_DFC, MASK_OUT_ABOVE_8(REG_DA[(word2 >> 12) & 15]));
+               goto m68k_op_moves_8_ai_done;
+            }
+            if(BIT_F(word2))		   /* Memory to address register */
+            {
+               REG_A[(word2 >> 12) & 7] = MAKE_INT_8(m68ki_read_8_fc(ea, REG_SFC));
+               if(CPU_TYPE_IS_020_VARIANT(CPU_TYPE))
+                  USE_CYCLES(2);
+               goto m68k_op_moves_8_ai_done;
+            }
+            /* Memory to data register */
+            REG_D[(word2 >> 12) & 7] = MASK_OUT_BELOW_8(REG_D[(word2 >> 12) & 7]) | m68ki_read_8_fc(ea, REG_SFC);
+            if(CPU_TYPE_IS_020_VARIANT(CPU_TYPE))
+               USE_CYCLES(2);
+            goto m68k_op_moves_8_ai_done;
+         }
+         m68ki_exception_privilege_violation();
+         goto m68k_op_moves_8_ai_done;
+      }
+      m68ki_exception_illegal();
+   }
+m68k_op_moves_8_ai_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_moves_8_pi:
+   {
+      if(CPU_TYPE_IS_010_PLUS(CPU_TYPE))
+      {
+         if(FLAG_S)
+         {
+            uint word2 = OPER_I_16();
+            uint ea = EA_AY_PI_8();
+
+            m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
+            if(BIT_B(word2))		   /* Register to memory */
+            {
+               m68ki_write_8_fc(ea, REG_DFC, MASK_OUT_ABOVE_8(REG_DA[(word2 >> 12) & 15]));
+               goto m68k_op_moves_8_pi_done;
+            }
+            if(BIT_F(word2))		   /* Memory to address register */
+            {
+               REG_A[(word2 >> 12) & 7] = MAKE_INT_8(m68ki_read_8_fc(ea, REG_SFC));
+               if(CPU_TYPE_IS_020_VARIANT(CPU_TYPE))
+                  USE_CYCLES(2);
+               goto m68k_op_moves_8_pi_done;
+            }
+            /* Memory to data register */
+            REG_D[(word2 >> 12) & 7] = MASK_OUT_BELOW_8(REG_D[(word2 >> 12) & 7]) | m68ki_read_8_fc(ea, REG_SFC);
+            if(CPU_TYPE_IS_020_VARIANT(CPU_TYPE))
+               USE_CYCLES(2);
+            goto m68k_op_moves_8_pi_done;
+         }
+         m68ki_exception_privilege_violation();
+         goto m68k_op_moves_8_pi_done;
+      }
+      m68ki_exception_illegal();
+   }
+m68k_op_moves_8_pi_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_moves_8_pi7:
+   {
+      if(CPU_TYPE_IS_010_PLUS(CPU_TYPE))
+      {
+         if(FLAG_S)
+         {
+            uint word2 = OPER_I_16();
+            uint ea = EA_A7_PI_8();
+
+            m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
+            if(BIT_B(word2))		   /* Register to memory */
+            {
+               m68ki_write_8_fc(ea, REG_DFC, MASK_OUT_ABOVE_8(REG_DA[(word2 >> 12) & 15]));
+               goto m68k_op_moves_8_pi7_done;
+            }
+            if(BIT_F(word2))		   /* Memory to address register */
+            {
+               REG_A[(word2 >> 12) & 7] = MAKE_INT_8(m68ki_read_8_fc(ea, REG_SFC));
+               if(CPU_TYPE_IS_020_VARIANT(CPU_TYPE))
+                  USE_CYCLES(2);
+               goto m68k_op_moves_8_pi7_done;
+            }
+            /* Memory to data register */
+            REG_D[(word2 >> 12) & 7] = MASK_OUT_BELOW_8(REG_D[(word2 >> 12) & 7]) | m68ki_read_8_fc(ea, REG_SFC);
+            if(CPU_TYPE_IS_020_VARIANT(CPU_TYPE))
+               USE_CYCLES(2);
+            goto m68k_op_moves_8_pi7_done;
+         }
+         m68ki_exception_privilege_violation();
+         goto m68k_op_moves_8_pi7_done;
+      }
+      m68ki_exception_illegal();
+   }
+m68k_op_moves_8_pi7_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_moves_8_pd:
+   {
+      if(CPU_TYPE_IS_010_PLUS(CPU_TYPE))
+      {
+         if(FLAG_S)
+         {
+            uint word2 = OPER_I_16();
+            uint ea = EA_AY_PD_8();
+
+            m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
+            if(BIT_B(word2))		   /* Register to memory */
+            {
+               m68ki_write_8_fc(ea, REG_DFC, MASK_OUT_ABOVE_8(REG_DA[(word2 >> 12) & 15]));
+               goto m68k_op_moves_8_pd_done;
+            }
+            if(BIT_F(word2))		   /* Memory to address register */
+            {
+               REG_A[(word2 >> 12) & 7] = MAKE_INT_8(m68ki_read_8_fc(ea, REG_SFC));
+               if(CPU_TYPE_IS_020_VARIANT(CPU_TYPE))
+                  USE_CYCLES(2);
+               goto m68k_op_moves_8_pd_done;
+            }
+            /* Memory to data register */
+            REG_D[(word2 >> 12) & 7] = MASK_OUT_BELOW_8(REG_D[(word2 >> 12) & 7]) | m68ki_read_8_fc(ea, REG_SFC);
+            if(CPU_TYPE_IS_020_VARIANT(CPU_TYPE))
+               USE_CYCLES(2);
+            goto m68k_op_moves_8_pd_done;
+         }
+         m68ki_exception_privilege_violation();
+         goto m68k_op_moves_8_pd_done;
+      }
+      m68ki_exception_illegal();
+   }
+m68k_op_moves_8_pd_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_moves_8_pd7:
+   {
+      if(CPU_TYPE_IS_010_PLUS(CPU_TYPE))
+      {
+         if(FLAG_S)
+         {
+            uint word2 = OPER_I_16();
+            uint ea = EA_A7_PD_8();
+
+            m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
+            if(BIT_B(word2))		   /* Register to memory */
+            {
+               m68ki_write_8_fc(ea, REG_DFC, MASK_OUT_ABOVE_8(REG_DA[(word2 >> 12) & 15]));
+               goto m68k_op_moves_8_pd7_done;
+            }
+            if(BIT_F(word2))		   /* Memory to address register */
+            {
+               REG_A[(word2 >> 12) & 7] = MAKE_INT_8(m68ki_read_8_fc(ea, REG_SFC));
+               if(CPU_TYPE_IS_020_VARIANT(CPU_TYPE))
+                  USE_CYCLES(2);
+               goto m68k_op_moves_8_pd7_done;
+            }
+            /* Memory to data register */
+            REG_D[(word2 >> 12) & 7] = MASK_OUT_BELOW_8(REG_D[(word2 >> 12) & 7]) | m68ki_read_8_fc(ea, REG_SFC);
+            if(CPU_TYPE_IS_020_VARIANT(CPU_TYPE))
+               USE_CYCLES(2);
+            goto m68k_op_moves_8_pd7_done;
+         }
+         m68ki_exception_privilege_violation();
+         goto m68k_op_moves_8_pd7_done;
+      }
+      m68ki_exception_illegal();
+   }
+m68k_op_moves_8_pd7_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_moves_8_di:
+   {
+      if(CPU_TYPE_IS_010_PLUS(CPU_TYPE))
+      {
+         if(FLAG_S)
+         {
+            uint word2 = OPER_I_16();
+            uint ea = EA_AY_DI_8();
+
+            m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
+            if(BIT_B(word2))		   /* Register to memory */
+            {
+               m68ki_write_8_fc(ea, REG_DFC, MASK_OUT_ABOVE_8(REG_DA[(word2 >> 12) & 15]));
+               goto m68k_op_moves_8_di_done;
+            }
+            if(BIT_F(word2))		   /* Memory to address register */
+            {
+               REG_A[(word2 >> 12) & 7] = MAKE_INT_8(m68ki_read_8_fc(ea, REG_SFC));
+               if(CPU_TYPE_IS_020_VARIANT(CPU_TYPE))
+                  USE_CYCLES(2);
+               goto m68k_op_moves_8_di_done;
+            }
+            /* Memory to data register */
+            REG_D[(word2 >> 12) & 7] = MASK_OUT_BELOW_8(REG_D[(word2 >> 12) & 7]) | m68ki_read_8_fc(ea, REG_SFC);
+            if(CPU_TYPE_IS_020_VARIANT(CPU_TYPE))
+               USE_CYCLES(2);
+            goto m68k_op_moves_8_di_done;
+         }
+         m68ki_exception_privilege_violation();
+         goto m68k_op_moves_8_di_done;
+      }
+      m68ki_exception_illegal();
+   }
+m68k_op_moves_8_di_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_moves_8_ix:
+   {
+      if(CPU_TYPE_IS_010_PLUS(CPU_TYPE))
+      {
+         if(FLAG_S)
+         {
+            uint word2 = OPER_I_16();
+            uint ea = EA_AY_IX_8();
+
+            m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
+            if(BIT_B(word2))		   /* Register to memory */
+            {
+               m68ki_write_8_fc(ea, REG_DFC, MASK_OUT_ABOVE_8(REG_DA[(word2 >> 12) & 15]));
+               goto m68k_op_moves_8_ix_done;
+            }
+            if(BIT_F(word2))		   /* Memory to address register */
+            {
+               REG_A[(word2 >> 12) & 7] = MAKE_INT_8(m68ki_read_8_fc(ea, REG_SFC));
+               if(CPU_TYPE_IS_020_VARIANT(CPU_TYPE))
+                  USE_CYCLES(2);
+               goto m68k_op_moves_8_ix_done;
+            }
+            /* Memory to data register */
+            REG_D[(word2 >> 12) & 7] = MASK_OUT_BELOW_8(REG_D[(word2 >> 12) & 7]) | m68ki_read_8_fc(ea, REG_SFC);
+            if(CPU_TYPE_IS_020_VARIANT(CPU_TYPE))
+               USE_CYCLES(2);
+            goto m68k_op_moves_8_ix_done;
+         }
+         m68ki_exception_privilege_violation();
+         goto m68k_op_moves_8_ix_done;
+      }
+      m68ki_exception_illegal();
+   }
+m68k_op_moves_8_ix_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_moves_8_aw:
+   {
+      if(CPU_TYPE_IS_010_PLUS(CPU_TYPE))
+      {
+         if(FLAG_S)
+         {
+            uint word2 = OPER_I_16();
+            uint ea = EA_AW_8();
+
+            m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
+            if(BIT_B(word2))		   /* Register to memory */
+            {
+               m68ki_write_8_fc(ea, REG_DFC, MASK_OUT_ABOVE_8(REG_DA[(word2 >> 12) & 15]));
+               goto m68k_op_moves_8_aw_done;
+            }
+            if(BIT_F(word2))		   /* Memory to address register */
+            {
+               REG_A[(word2 >> 12) & 7] = MAKE_INT_8(m68ki_read_8_fc(ea, REG_SFC));
+               if(CPU_TYPE_IS_020_VARIANT(CPU_TYPE))
+                  USE_CYCLES(2);
+               goto m68k_op_moves_8_aw_done;
+            }
+            /* Memory to data register */
+            REG_D[(word2 >> 12) & 7] = MASK_OUT_BELOW_8(REG_D[(word2 >> 12) & 7]) | m68ki_read_8_fc(ea, REG_SFC);
+            if(CPU_TYPE_IS_020_VARIANT(CPU_TYPE))
+               USE_CYCLES(2);
+            goto m68k_op_moves_8_aw_done;
+         }
+         m68ki_exception_privilege_violation();
+         goto m68k_op_moves_8_aw_done;
+      }
+      m68ki_exception_illegal();
+   }
+m68k_op_moves_8_aw_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_moves_8_al:
+   {
+      if(CPU_TYPE_IS_010_PLUS(CPU_TYPE))
+      {
+         if(FLAG_S)
+         {
+            uint word2 = OPER_I_16();
+            uint ea = EA_AL_8();
+
+            m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
+            if(BIT_B(word2))		   /* Register to memory */
+            {
+               m68ki_write_8_fc(ea, REG_DFC, MASK_OUT_ABOVE_8(REG_DA[(word2 >> 12) & 15]));
+               goto m68k_op_moves_8_al_done;
+            }
+            if(BIT_F(word2))		   /* Memory to address register */
+            {
+               REG_A[(word2 >> 12) & 7] = MAKE_INT_8(m68ki_read_8_fc(ea, REG_SFC));
+               if(CPU_TYPE_IS_020_VARIANT(CPU_TYPE))
+                  USE_CYCLES(2);
+               goto m68k_op_moves_8_al_done;
+            }
+            /* Memory to data register */
+            REG_D[(word2 >> 12) & 7] = MASK_OUT_BELOW_8(REG_D[(word2 >> 12) & 7]) | m68ki_read_8_fc(ea, REG_SFC);
+            if(CPU_TYPE_IS_020_VARIANT(CPU_TYPE))
+               USE_CYCLES(2);
+            goto m68k_op_moves_8_al_done;
+         }
+         m68ki_exception_privilege_violation();
+         goto m68k_op_moves_8_al_done;
+      }
+      m68ki_exception_illegal();
+   }
+m68k_op_moves_8_al_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_moves_16_ai:
+   {
+      if(CPU_TYPE_IS_010_PLUS(CPU_TYPE))
+      {
+         if(FLAG_S)
+         {
+            uint word2 = OPER_I_16();
+            uint ea = EA_AY_AI_16();
+
+            m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
+            if(BIT_B(word2))		   /* Register to memory */
+            {
+               m68ki_write_16_fc(ea, REG_DFC, MASK_OUT_ABOVE_16(REG_DA[(word2 >> 12) & 15]));
+               goto m68k_op_moves_16_ai_done;
+            }
+            if(BIT_F(word2))		   /* Memory to address register */
+            {
+               REG_A[(word2 >> 12) & 7] = MAKE_INT_16(m68ki_read_16_fc(ea, REG_SFC));
+               if(CPU_TYPE_IS_020_VARIANT(CPU_TYPE))
+                  USE_CYCLES(2);
+               goto m68k_op_moves_16_ai_done;
+            }
+            /* Memory to data register */
+            REG_D[(word2 >> 12) & 7] = MASK_OUT_BELOW_16(REG_D[(word2 >> 12) & 7]) | m68ki_read_16_fc(ea, REG_SFC);
+            if(CPU_TYPE_IS_020_VARIANT(CPU_TYPE))
+               USE_CYCLES(2);
+            goto m68k_op_moves_16_ai_done;
+         }
+         m68ki_exception_privilege_violation();
+         goto m68k_op_moves_16_ai_done;
+      }
+      m68ki_exception_illegal();
+   }
+m68k_op_moves_16_ai_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_moves_16_pi:
+   {
+      if(CPU_TYPE_IS_010_PLUS(CPU_TYPE))
+      {
+         if(FLAG_S)
+         {
+            uint word2 = OPER_I_16();
+            uint ea = EA_AY_PI_16();
+
+            m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
+            if(BIT_B(word2))		   /* Register to memory */
+            {
+               m68ki_write_16_fc(ea, REG_DFC, MASK_OUT_ABOVE_16(REG_DA[(word2 >> 12) & 15]));
+               goto m68k_op_moves_16_pi_done;
+            }
+            if(BIT_F(word2))		   /* Memory to address register */
+            {
+               REG_A[(word2 >> 12) & 7] = MAKE_INT_16(m68ki_read_16_fc(ea, REG_SFC));
+               if(CPU_TYPE_IS_020_VARIANT(CPU_TYPE))
+                  USE_CYCLES(2);
+               goto m68k_op_moves_16_pi_done;
+            }
+            /* Memory to data register */
+            REG_D[(word2 >> 12) & 7] = MASK_OUT_BELOW_16(REG_D[(word2 >> 12) & 7]) | m68ki_read_16_fc(ea, REG_SFC);
+            if(CPU_TYPE_IS_020_VARIANT(CPU_TYPE))
+               USE_CYCLES(2);
+            goto m68k_op_moves_16_pi_done;
+         }
+         m68ki_exception_privilege_violation();
+         goto m68k_op_moves_16_pi_done;
+      }
+      m68ki_exception_illegal();
+   }
+m68k_op_moves_16_pi_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_moves_16_pd:
+   {
+      if(CPU_TYPE_IS_010_PLUS(CPU_TYPE))
+      {
+         if(FLAG_S)
+         {
+            uint word2 = OPER_I_16();
+            uint ea = EA_AY_PD_16();
+
+            m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
+            if(BIT_B(word2))		   /* Register to memory */
+            {
+               m68ki_write_16_fc(ea, REG_DFC, MASK_OUT_ABOVE_16(REG_DA[(word2 >> 12) & 15]));
+               goto m68k_op_moves_16_pd_done;
+            }
+            if(BIT_F(word2))		   /* Memory to address register */
+            {
+               REG_A[(word2 >> 12) & 7] = MAKE_INT_16(m68ki_read_16_fc(ea, REG_SFC));
+               if(CPU_TYPE_IS_020_VARIANT(CPU_TYPE))
+                  USE_CYCLES(2);
+               goto m68k_op_moves_16_pd_done;
+            }
+            /* Memory to data register */
+            REG_D[(word2 >> 12) & 7] = MASK_OUT_BELOW_16(REG_D[(word2 >> 12) & 7]) | m68ki_read_16_fc(ea, REG_SFC);
+            if(CPU_TYPE_IS_020_VARIANT(CPU_TYPE))
+               USE_CYCLES(2);
+            goto m68k_op_moves_16_pd_done;
+         }
+         m68ki_exception_privilege_violation();
+         goto m68k_op_moves_16_pd_done;
+      }
+      m68ki_exception_illegal();
+   }
+m68k_op_moves_16_pd_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_moves_16_di:
+   {
+      if(CPU_TYPE_IS_010_PLUS(CPU_TYPE))
+      {
+         if(FLAG_S)
+         {
+            uint word2 = OPER_I_16();
+            uint ea = EA_AY_DI_16();
+
+            m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
+            if(BIT_B(word2))		   /* Register to memory */
+            {
+               m68ki_write_16_fc(ea, REG_DFC, MASK_OUT_ABOVE_16(REG_DA[(word2 >> 12) & 15]));
+               goto m68k_op_moves_16_di_done;
+            }
+            if(BIT_F(word2))		   /* Memory to address register */
+            {
+               REG_A[(word2 >> 12) & 7] = MAKE_INT_16(m68ki_read_16_fc(ea, REG_SFC));
+               if(CPU_TYPE_IS_020_VARIANT(CPU_TYPE))
+                  USE_CYCLES(2);
+               goto m68k_op_moves_16_di_done;
+            }
+            /* Memory to data register */
+            REG_D[(word2 >> 12) & 7] = MASK_OUT_BELOW_16(REG_D[(word2 >> 12) & 7]) | m68ki_read_16_fc(ea, REG_SFC);
+            if(CPU_TYPE_IS_020_VARIANT(CPU_TYPE))
+               USE_CYCLES(2);
+            goto m68k_op_moves_16_di_done;
+         }
+         m68ki_exception_privilege_violation();
+         goto m68k_op_moves_16_di_done;
+      }
+      m68ki_exception_illegal();
+   }
+m68k_op_moves_16_di_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_moves_16_ix:
+   {
+      if(CPU_TYPE_IS_010_PLUS(CPU_TYPE))
+      {
+         if(FLAG_S)
+         {
+            uint word2 = OPER_I_16();
+            uint ea = EA_AY_IX_16();
+
+            m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
+            if(BIT_B(word2))		   /* Register to memory */
+            {
+               m68ki_write_16_fc(ea, REG_DFC, MASK_OUT_ABOVE_16(REG_DA[(word2 >> 12) & 15]));
+               goto m68k_op_moves_16_ix_done;
+            }
+            if(BIT_F(word2))		   /* Memory to address register */
+            {
+               REG_A[(word2 >> 12) & 7] = MAKE_INT_16(m68ki_read_16_fc(ea, REG_SFC));
+               if(CPU_TYPE_IS_020_VARIANT(CPU_TYPE))
+                  USE_CYCLES(2);
+               goto m68k_op_moves_16_ix_done;
+            }
+            /* Memory to data register */
+            REG_D[(word2 >> 12) & 7] = MASK_OUT_BELOW_16(REG_D[(word2 >> 12) & 7]) | m68ki_read_16_fc(ea, REG_SFC);
+            if(CPU_TYPE_IS_020_VARIANT(CPU_TYPE))
+               USE_CYCLES(2);
+            goto m68k_op_moves_16_ix_done;
+         }
+         m68ki_exception_privilege_violation();
+         goto m68k_op_moves_16_ix_done;
+      }
+      m68ki_exception_illegal();
+   }
+m68k_op_moves_16_ix_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_moves_16_aw:
+   {
+      if(CPU_TYPE_IS_010_PLUS(CPU_TYPE))
+      {
+         if(FLAG_S)
+         {
+            uint word2 = OPER_I_16();
+            uint ea = EA_AW_16();
+
+            m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
+            if(BIT_B(word2))		   /* Register to memory */
+            {
+               m68ki_write_16_fc(ea, REG_DFC, MASK_OUT_ABOVE_16(REG_DA[(word2 >> 12) & 15]));
+               goto m68k_op_moves_16_aw_done;
+            }
+            if(BIT_F(word2))		   /* Memory to address register */
+            {
+               REG_A[(word2 >> 12) & 7] = MAKE_INT_16(m68ki_read_16_fc(ea, REG_SFC));
+               if(CPU_TYPE_IS_020_VARIANT(CPU_TYPE))
+                  USE_CYCLES(2);
+               goto m68k_op_moves_16_aw_done;
+            }
+            /* Memory to data register */
+            REG_D[(word2 >> 12) & 7] = MASK_OUT_BELOW_16(REG_D[(word2 >> 12) & 7]) | m68ki_read_16_fc(ea, REG_SFC);
+            if(CPU_TYPE_IS_020_VARIANT(CPU_TYPE))
+               USE_CYCLES(2);
+            goto m68k_op_moves_16_aw_done;
+         }
+         m68ki_exception_privilege_violation();
+         goto m68k_op_moves_16_aw_done;
+      }
+      m68ki_exception_illegal();
+   }
+m68k_op_moves_16_aw_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_moves_16_al:
+   {
+      if(CPU_TYPE_IS_010_PLUS(CPU_TYPE))
+      {
+         if(FLAG_S)
+         {
+            uint word2 = OPER_I_16();
+            uint ea = EA_AL_16();
+
+            m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
+            if(BIT_B(word2))		   /* Register to memory */
+            {
+               m68ki_write_16_fc(ea, REG_DFC, MASK_OUT_ABOVE_16(REG_DA[(word2 >> 12) & 15]));
+               goto m68k_op_moves_16_al_done;
+            }
+            if(BIT_F(word2))		   /* Memory to address register */
+            {
+               REG_A[(word2 >> 12) & 7] = MAKE_INT_16(m68ki_read_16_fc(ea, REG_SFC));
+               if(CPU_TYPE_IS_020_VARIANT(CPU_TYPE))
+                  USE_CYCLES(2);
+               goto m68k_op_moves_16_al_done;
+            }
+            /* Memory to data register */
+            REG_D[(word2 >> 12) & 7] = MASK_OUT_BELOW_16(REG_D[(word2 >> 12) & 7]) | m68ki_read_16_fc(ea, REG_SFC);
+            if(CPU_TYPE_IS_020_VARIANT(CPU_TYPE))
+               USE_CYCLES(2);
+            goto m68k_op_moves_16_al_done;
+         }
+         m68ki_exception_privilege_violation();
+         goto m68k_op_moves_16_al_done;
+      }
+      m68ki_exception_illegal();
+   }
+m68k_op_moves_16_al_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_moves_32_ai:
+   {
+      if(CPU_TYPE_IS_010_PLUS(CPU_TYPE))
+      {
+         if(FLAG_S)
+         {
+            uint word2 = OPER_I_16();
+            uint ea = EA_AY_AI_32();
+
+            m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
+            if(BIT_B(word2))		   /* Register to memory */
+            {
+               m68ki_write_32_fc(ea, REG_DFC, REG_DA[(word2 >> 12) & 15]);
+               if(CPU_TYPE_IS_020_VARIANT(CPU_TYPE))
+                  USE_CYCLES(2);
+               goto m68k_op_moves_32_ai_done;
+            }
+            /* Memory to register */
+            REG_DA[(word2 >> 12) & 15] = m68ki_read_32_fc(ea, REG_SFC);
+            if(CPU_TYPE_IS_020_VARIANT(CPU_TYPE))
+               USE_CYCLES(2);
+            goto m68k_op_moves_32_ai_done;
+         }
+         m68ki_exception_privilege_violation();
+         goto m68k_op_moves_32_ai_done;
+      }
+      m68ki_exception_illegal();
+   }
+m68k_op_moves_32_ai_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_moves_32_pi:
+   {
+      if(CPU_TYPE_IS_010_PLUS(CPU_TYPE))
+      {
+         if(FLAG_S)
+         {
+            uint word2 = OPER_I_16();
+            uint ea = EA_AY_PI_32();
+
+            m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
+            if(BIT_B(word2))		   /* Register to memory */
+            {
+               m68ki_write_32_fc(ea, REG_DFC, REG_DA[(word2 >> 12) & 15]);
+               if(CPU_TYPE_IS_020_VARIANT(CPU_TYPE))
+                  USE_CYCLES(2);
+               goto m68k_op_moves_32_pi_done;
+            }
+            /* Memory to register */
+            REG_DA[(word2 >> 12) & 15] = m68ki_read_32_fc(ea, REG_SFC);
+            if(CPU_TYPE_IS_020_VARIANT(CPU_TYPE))
+               USE_CYCLES(2);
+            goto m68k_op_moves_32_pi_done;
+         }
+         m68ki_exception_privilege_violation();
+         goto m68k_op_moves_32_pi_done;
+      }
+      m68ki_exception_illegal();
+   }
+m68k_op_moves_32_pi_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_moves_32_pd:
+   {
+      if(CPU_TYPE_IS_010_PLUS(CPU_TYPE))
+      {
+         if(FLAG_S)
+         {
+            uint word2 = OPER_I_16();
+            uint ea = EA_AY_PD_32();
+
+            m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
+            if(BIT_B(word2))		   /* Register to memory */
+            {
+               m68ki_write_32_fc(ea, REG_DFC, REG_DA[(word2 >> 12) & 15]);
+               if(CPU_TYPE_IS_020_VARIANT(CPU_TYPE))
+                  USE_CYCLES(2);
+               goto m68k_op_moves_32_pd_done;
+            }
+            /* Memory to register */
+            REG_DA[(word2 >> 12) & 15] = m68ki_read_32_fc(ea, REG_SFC);
+            if(CPU_TYPE_IS_020_VARIANT(CPU_TYPE))
+               USE_CYCLES(2);
+            goto m68k_op_moves_32_pd_done;
+         }
+         m68ki_exception_privilege_violation();
+         goto m68k_op_moves_32_pd_done;
+      }
+      m68ki_exception_illegal();
+   }
+m68k_op_moves_32_pd_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_moves_32_di:
+   {
+      if(CPU_TYPE_IS_010_PLUS(CPU_TYPE))
+      {
+         if(FLAG_S)
+         {
+            uint word2 = OPER_I_16();
+            uint ea = EA_AY_DI_32();
+
+            m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
+            if(BIT_B(word2))		   /* Register to memory */
+            {
+               m68ki_write_32_fc(ea, REG_DFC, REG_DA[(word2 >> 12) & 15]);
+               if(CPU_TYPE_IS_020_VARIANT(CPU_TYPE))
+                  USE_CYCLES(2);
+               goto m68k_op_moves_32_di_done;
+            }
+            /* Memory to register */
+            REG_DA[(word2 >> 12) & 15] = m68ki_read_32_fc(ea, REG_SFC);
+            if(CPU_TYPE_IS_020_VARIANT(CPU_TYPE))
+               USE_CYCLES(2);
+            goto m68k_op_moves_32_di_done;
+         }
+         m68ki_exception_privilege_violation();
+         goto m68k_op_moves_32_di_done;
+      }
+      m68ki_exception_illegal();
+   }
+m68k_op_moves_32_di_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_moves_32_ix:
+   {
+      if(CPU_TYPE_IS_010_PLUS(CPU_TYPE))
+      {
+         if(FLAG_S)
+         {
+            uint word2 = OPER_I_16();
+            uint ea = EA_AY_IX_32();
+
+            m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
+            if(BIT_B(word2))		   /* Register to memory */
+            {
+               m68ki_write_32_fc(ea, REG_DFC, REG_DA[(word2 >> 12) & 15]);
+               if(CPU_TYPE_IS_020_VARIANT(CPU_TYPE))
+                  USE_CYCLES(2);
+               goto m68k_op_moves_32_ix_done;
+            }
+            /* Memory to register */
+            REG_DA[(word2 >> 12) & 15] = m68ki_read_32_fc(ea, REG_SFC);
+            if(CPU_TYPE_IS_020_VARIANT(CPU_TYPE))
+               USE_CYCLES(2);
+            goto m68k_op_moves_32_ix_done;
+         }
+         m68ki_exception_privilege_violation();
+         goto m68k_op_moves_32_ix_done;
+      }
+      m68ki_exception_illegal();
+   }
+m68k_op_moves_32_ix_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_moves_32_aw:
+   {
+      if(CPU_TYPE_IS_010_PLUS(CPU_TYPE))
+      {
+         if(FLAG_S)
+         {
+            uint word2 = OPER_I_16();
+            uint ea = EA_AW_32();
+
+            m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
+            if(BIT_B(word2))		   /* Register to memory */
+            {
+               m68ki_write_32_fc(ea, REG_DFC, REG_DA[(word2 >> 12) & 15]);
+               if(CPU_TYPE_IS_020_VARIANT(CPU_TYPE))
+                  USE_CYCLES(2);
+               goto m68k_op_moves_32_aw_done;
+            }
+            /* Memory to register */
+            REG_DA[(word2 >> 12) & 15] = m68ki_read_32_fc(ea, REG_SFC);
+            if(CPU_TYPE_IS_020_VARIANT(CPU_TYPE))
+               USE_CYCLES(2);
+            goto m68k_op_moves_32_aw_done;
+         }
+         m68ki_exception_privilege_violation();
+         goto m68k_op_moves_32_aw_done;
+      }
+      m68ki_exception_illegal();
+   }
+m68k_op_moves_32_aw_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_moves_32_al:
+   {
+      if(CPU_TYPE_IS_010_PLUS(CPU_TYPE))
+      {
+         if(FLAG_S)
+         {
+            uint word2 = OPER_I_16();
+            uint ea = EA_AL_32();
+
+            m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
+            if(BIT_B(word2))		   /* Register to memory */
+            {
+               m68ki_write_32_fc(ea, REG_DFC, REG_DA[(word2 >> 12) & 15]);
+               if(CPU_TYPE_IS_020_VARIANT(CPU_TYPE))
+                  USE_CYCLES(2);
+               goto m68k_op_moves_32_al_done;
+            }
+            /* Memory to register */
+            REG_DA[(word2 >> 12) & 15] = m68ki_read_32_fc(ea, REG_SFC);
+            if(CPU_TYPE_IS_020_VARIANT(CPU_TYPE))
+               USE_CYCLES(2);
+            goto m68k_op_moves_32_al_done;
+         }
+         m68ki_exception_privilege_violation();
+         goto m68k_op_moves_32_al_done;
+      }
+      m68ki_exception_illegal();
+   }
+m68k_op_moves_32_al_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_moveq_32:
+   {
+      uint res = DX = MAKE_INT_8(MASK_OUT_ABOVE_8(REG_IR));
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_32(res);
+      FLAG_Z = res;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_muls_16_d:
+   {
+      uint* r_dst = &DX;
+      uint res = MASK_OUT_ABOVE_32(MAKE_INT_16(DY) * MAKE_INT_16(MASK_OUT_ABOVE_16(*r_dst)));
+
+      *r_dst = res;
+
+      m68ki_discard_lazy_flags();
+      FLAG_Z = res;
+      FLAG_N = NFLAG_32(res);
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_muls_16_ai:
+   {
+      uint* r_dst = &DX;
+      uint res = MASK_OUT_ABOVE_32(MAKE_INT_16(OPER_AY_AI_16()) * MAKE_INT_16(MASK_OUT_ABOVE_16(*r_dst)));
+
+      *r_dst = res;
+
+      m68ki_discard_lazy_flags();
+      FLAG_Z = res;
+      FLAG_N = NFLAG_32(res);
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_muls_16_pi:
+   {
+      uint* r_dst = &DX;
+      uint res = MASK_OUT_ABOVE_32(MAKE_INT_16(OPER_AY_PI_16()) * MAKE_INT_16(MASK_OUT_ABOVE_16(*r_dst)));
+
+      *r_dst = res;
+
+      m68ki_discard_lazy_flags();
+      FLAG_Z = res;
+      FLAG_N = NFLAG_32(res);
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_muls_16_pd:
+   {
+      uint* r_dst = &DX;
+      uint res = MASK_OUT_ABOVE_32(MAKE_INT_16(OPER_AY_PD_16()) * MAKE_INT_16(MASK_OUT_ABOVE_16(*r_dst)));
+
+      *r_dst = res;
+
+      m68ki_discard_lazy_flags();
+      FLAG_Z = res;
+      FLAG_N = NFLAG_32(res);
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_muls_16_di:
+   {
+      uint* r_dst = &DX;
+      uint res = MASK_OUT_ABOVE_32(MAKE_INT_16(OPER_AY_DI_16()) * MAKE_INT_16(MASK_OUT_ABOVE_16(*r_dst)));
+
+      *r_dst = res;
+
+      m68ki_discard_lazy_flags();
+      FLAG_Z = res;
+      FLAG_N = NFLAG_32(res);
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_muls_16_ix:
+   {
+      uint* r_dst = &DX;
+      uint res = MASK_OUT_ABOVE_32(MAKE_INT_16(OPER_AY_IX_16()) * MAKE_INT_16(MASK_OUT_ABOVE_16(*r_dst)));
+
+      *r_dst = res;
+
+      m68ki_discard_lazy_flags();
+      FLAG_Z = res;
+      FLAG_N = NFLAG_32(res);
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_muls_16_aw:
+   {
+      uint* r_dst = &DX;
+      uint res = MASK_OUT_ABOVE_32(MAKE_INT_16(OPER_AW_16()) * MAKE_INT_16(MASK_OUT_ABOVE_16(*r_dst)));
+
+      *r_dst = res;
+
+      m68ki_discard_lazy_flags();
+      FLAG_Z = res;
+      FLAG_N = NFLAG_32(res);
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_muls_16_al:
+   {
+      uint* r_dst = &DX;
+      uint res = MASK_OUT_ABOVE_32(MAKE_INT_16(OPER_AL_16()) * MAKE_INT_16(MASK_OUT_ABOVE_16(*r_dst)));
+
+      *r_dst = res;
+
+      m68ki_discard_lazy_flags();
+      FLAG_Z = res;
+      FLAG_N = NFLAG_32(res);
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_muls_16_pcdi:
+   {
+      uint* r_dst = &DX;
+      uint res = MASK_OUT_ABOVE_32(MAKE_INT_16(OPER_PCDI_16()) * MAKE_INT_16(MASK_OUT_ABOVE_16(*r_dst)));
+
+      *r_dst = res;
+
+      m68ki_discard_lazy_flags();
+      FLAG_Z = res;
+      FLAG_N = NFLAG_32(res);
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_muls_16_pcix:
+   {
+      uint* r_dst = &DX;
+      uint res = MASK_OUT_ABOVE_32(MAKE_INT_16(OPER_PCIX_16()) * MAKE_INT_16(MASK_OUT_ABOVE_16(*r_dst)));
+
+      *r_dst = res;
+
+      m68ki_discard_lazy_flags();
+      FLAG_Z = res;
+      FLAG_N = NFLAG_32(res);
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_muls_16_i:
+   {
+      uint* r_dst = &DX;
+      uint res = MASK_OUT_ABOVE_32(MAKE_INT_16(OPER_I_16()) * MAKE_INT_16(MASK_OUT_ABOVE_16(*r_dst)));
+
+      *r_dst = res;
+
+      m68ki_discard_lazy_flags();
+      FLAG_Z = res;
+      FLAG_N = NFLAG_32(res);
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_mulu_16_d:
+   {
+      uint* r_dst = &DX;
+      uint res = MASK_OUT_ABOVE_16(DY) * MASK_OUT_ABOVE_16(*r_dst);
+
+      *r_dst = res;
+
+      m68ki_discard_lazy_flags();
+      FLAG_Z = res;
+      FLAG_N = NFLAG_32(res);
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_mulu_16_ai:
+   {
+      uint* r_dst = &DX;
+      uint res = OPER_AY_AI_16() * MASK_OUT_ABOVE_16(*r_dst);
+
+      *r_dst = res;
+
+      m68ki_discard_lazy_flags();
+      FLAG_Z = res;
+      FLAG_N = NFLAG_32(res);
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_mulu_16_pi:
+   {
+      uint* r_dst = &DX;
+      uint res = OPER_AY_PI_16() * MASK_OUT_ABOVE_16(*r_dst);
+
+      *r_dst = res;
+
+      m68ki_discard_lazy_flags();
+      FLAG_Z = res;
+      FLAG_N = NFLAG_32(res);
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_mulu_16_pd:
+   {
+      uint* r_dst = &DX;
+      uint res = OPER_AY_PD_16() * MASK_OUT_ABOVE_16(*r_dst);
+
+      *r_dst = res;
+
+      m68ki_discard_lazy_flags();
+      FLAG_Z = res;
+      FLAG_N = NFLAG_32(res);
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_mulu_16_di:
+   {
+      uint* r_dst = &DX;
+      uint res = OPER_AY_DI_16() * MASK_OUT_ABOVE_16(*r_dst);
+
+      *r_dst = res;
+
+      m68ki_discard_lazy_flags();
+      FLAG_Z = res;
+      FLAG_N = NFLAG_32(res);
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_mulu_16_ix:
+   {
+      uint* r_dst = &DX;
+      uint res = OPER_AY_IX_16() * MASK_OUT_ABOVE_16(*r_dst);
+
+      *r_dst = res;
+
+      m68ki_discard_lazy_flags();
+      FLAG_Z = res;
+      FLAG_N = NFLAG_32(res);
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_mulu_16_aw:
+   {
+      uint* r_dst = &DX;
+      uint res = OPER_AW_16() * MASK_OUT_ABOVE_16(*r_dst);
+
+      *r_dst = res;
+
+      m68ki_discard_lazy_flags();
+      FLAG_Z = res;
+      FLAG_N = NFLAG_32(res);
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_mulu_16_al:
+   {
+      uint* r_dst = &DX;
+      uint res = OPER_AL_16() * MASK_OUT_ABOVE_16(*r_dst);
+
+      *r_dst = res;
+
+      m68ki_discard_lazy_flags();
+      FLAG_Z = res;
+      FLAG_N = NFLAG_32(res);
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_mulu_16_pcdi:
+   {
+      uint* r_dst = &DX;
+      uint res = OPER_PCDI_16() * MASK_OUT_ABOVE_16(*r_dst);
+
+      *r_dst = res;
+
+      m68ki_discard_lazy_flags();
+      FLAG_Z = res;
+      FLAG_N = NFLAG_32(res);
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_mulu_16_pcix:
+   {
+      uint* r_dst = &DX;
+      uint res = OPER_PCIX_16() * MASK_OUT_ABOVE_16(*r_dst);
+
+      *r_dst = res;
+
+      m68ki_discard_lazy_flags();
+      FLAG_Z = res;
+      FLAG_N = NFLAG_32(res);
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_mulu_16_i:
+   {
+      uint* r_dst = &DX;
+      uint res = OPER_I_16() * MASK_OUT_ABOVE_16(*r_dst);
+
+      *r_dst = res;
+
+      m68ki_discard_lazy_flags();
+      FLAG_Z = res;
+      FLAG_N = NFLAG_32(res);
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_mull_32_d:
+   {
+      m68ki_resolve_flags();
+   #if M68K_USE_64_BIT
+
+      if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+      {
+         uint word2 = OPER_I_16();
+         uint64 src = DY;
+         uint64 dst = REG_D[(word2 >> 12) & 7];
+         uint64 res;
+
+         FLAG_C = CFLAG_CLEAR;
+
+         if(BIT_B(word2))			   /* signed */
+         {
+            res = (sint64)((sint32)src) * (sint64)((sint32)dst);
+            if(!BIT_A(word2))
+            {
+               FLAG_Z = MASK_OUT_ABOVE_32(res);
+               FLAG_N = NFLAG_32(res);
+               FLAG_V = ((sint64)res != (sint32)res)<<7;
+               REG_D[(word2 >> 12) & 7] = FLAG_Z;
+               goto m68k_op_mull_32_d_done;
+            }
+            FLAG_Z = MASK_OUT_ABOVE_32(res) | (res>>32);
+            FLAG_N = NFLAG_64(res);
+            FLAG_V = VFLAG_CLEAR;
+            REG_D[word2 & 7] = (res >> 32);
+            REG_D[(word2 >> 12) & 7] = MASK_OUT_ABOVE_32(res);
+            goto m68k_op_mull_32_d_done;
+         }
+
+         res = src * dst;
+         if(!BIT_A(word2))
+         {
+            FLAG_Z = MASK_OUT_ABOVE_32(res);
+            FLAG_N = NFLAG_32(res);
+            FLAG_V = (res > 0xffffffff)<<7;
+            REG_D[(word2 >> 12) & 7] = FLAG_Z;
+            goto m68k_op_mull_32_d_done;
+         }
+         FLAG_Z = MASK_OUT_ABOVE_32(res) | (res>>32);
+         FLAG_N = NFLAG_64(res);
+         FLAG_V = VFLAG_CLEAR;
+         REG_D[word2 & 7] = (res >> 32);
+         REG_D[(word2 >> 12) & 7] = MASK_OUT_ABOVE_32(res);
+         goto m68k_op_mull_32_d_done;
+      }
+      m68ki_exception_illegal();
+
+   #else
+
+      if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+      {
+         uint word2 = OPER_I_16();
+         uint src = DY;
+         uint dst = REG_D[(word2 >> 12) & 7];
+         uint neg = GET_MSB_32(src ^ dst);
+         uint src1;
+         uint src2;
+         uint dst1;
+         uint dst2;
+         uint r1;
+         uint r2;
+         uint r3;
+         uint r4;
+         uint lo;
+         uint hi;
+
+         FLAG_C = CFLAG_CLEAR;
+
+         if(BIT_B(word2))			   /* signed */
+         {
+            if(GET_MSB_32(src))
+               src = (uint)MASK_OUT_ABOVE_32(-(sint)src);
+            if(GET_MSB_32(dst))
+               dst = (uint)MASK_OUT_ABOVE_32(-(sint)dst);
+         }
+
+         src1 = MASK_OUT_ABOVE_16(src);
+         src2 = src>>16;
+         dst1 = MASK_OUT_ABOVE_16(dst);
+         dst2 = dst>>16;
+
+
+         r1 = src1 * dst1;
+         r2 = src1 * dst2;
+         r3 = src2 * dst1;
+         r4 = src2 * dst2;
+
+         lo = r1 + (MASK_OUT_ABOVE_16(r2)<<16) + (MASK_OUT_ABOVE_16(r3)<<16);
+         hi = r4 + (r2>>16) + (r3>>16) + (((r1>>16) + MASK_OUT_ABOVE_16(r2) + MASK_OUT_ABOVE_16(r3)) >> 16);
+
+         if(BIT_B(word2) && neg)
+         {
+            hi = (uint)MASK_OUT_ABOVE_32((-(sint)hi) - (lo != 0));
+            lo = (uint)MASK_OUT_ABOVE_32(-(sint)lo);
+         }
+
+         if(BIT_A(word2))
+         {
+            REG_D[word2 & 7] = hi;
+            REG_D[(word2 >> 12) & 7] = lo;
+            FLAG_N = NFLAG_32(hi);
+            FLAG_Z = hi | lo;
+            FLAG_V = VFLAG_CLEAR;
+            goto m68k_op_mull_32_d_done;
+         }
+
+         REG_D[(word2 >> 12) & 7] = lo;
+         FLAG_N = NFLAG_32(lo);
+         FLAG_Z = lo;
+         if(BIT_B(word2))
+            FLAG_V = (!((GET_MSB_32(lo) && hi == 0xffffffff) || (!GET_MSB_32(lo) && !hi)))<<7;
+         else
+            FLAG_V = (hi != 0) << 7;
+         goto m68k_op_mull_32_d_done;
+      }
+      m68ki_exception_illegal();
+
+   #endif
+   }
+m68k_op_mull_32_d_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_mull_32_ai:
+   {
+      m68ki_resolve_flags();
+   #if M68K_USE_64_BIT
+
+      if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+      {
+         uint word2 = OPER_I_16();
+         uint64 src = OPER_AY_AI_32();
+         uint64 dst = REG_D[(word2 >> 12) & 7];
+         uint64 res;
+
+         FLAG_C = CFLAG_CLEAR;
+
+         if(BIT_B(word2))			   /* signed */
+         {
+            res = (sint64)((sint32)src) * (sint64)((sint32)dst);
+            if(!BIT_A(word2))
+            {
+               FLAG_Z = MASK_OUT_ABOVE_32(res);
+               FLAG_N = NFLAG_32(res);
+               FLAG_V = ((sint64)res != (sint32)res)<<7;
+               REG_D[(word2 >> 12) & 7] = FLAG_Z;
+               goto m68k_op_mull_32_ai_done;
+            }
+            FLAG_Z = MASK_OUT_ABOVE_32(res) | (res>>32);
+            FLAG_N = NFLAG_64(res);
+            FLAG_V = VFLAG_CLEAR;
+            REG_D[word2 & 7] = (res >> 32);
+            REG_D[(word2 >> 12) & 7] = MASK_OUT_ABOVE_32(res);
+            goto m68k_op_mull_32_ai_done;
+         }
+
+         res = src * dst;
+         if(!BIT_A(word2))
+         {
+            FLAG_Z = MASK_OUT_ABOVE_32(res);
+            FLAG_N = NFLAG_32(res);
+            FLAG_V = (res > 0xffffffff)<<7;
+            REG_D[(word2 >> 12) & 7] = FLAG_Z;
+            goto m68k_op_mull_32_ai_done;
+         }
+         FLAG_Z = MASK_OUT_ABOVE_32(res) | (res>>32);
+         FLAG_N = NFLAG_64(res);
+         FLAG_V = VFLAG_CLEAR;
+         REG_D[word2 & 7] = (res >> 32);
+         REG_D[(word2 >> 12) & 7] = MASK_OUT_ABOVE_32(res);
+         goto m68k_op_mull_32_ai_done;
+      }
+      m68ki_exception_illegal();
+
+   #else
+
+      if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+      {
+         uint word2 = OPER_I_16();
+         uint src = OPER_AY_AI_32();
+         uint dst = REG_D[(word2 >> 12) & 7];
+         uint neg = GET_MSB_32(src ^ dst);
+         uint src1;
+         uint src2;
+         uint dst1;
+         uint dst2;
+         uint r1;
+         uint r2;
+         uint r3;
+         uint r4;
+         uint lo;
+         uint hi;
+
+         FLAG_C = CFLAG_CLEAR;
+
+         if(BIT_B(word2))			   /* signed */
+         {
+            if(GET_MSB_32(src))
+               src = (uint)MASK_OUT_ABOVE_32(-(sint)src);
+            if(GET_MSB_32(dst))
+               dst = (uint)MASK_OUT_ABOVE_32(-(sint)dst);
+         }
+
+         src1 = MASK_OUT_ABOVE_16(src);
+         src2 = src>>16;
+         dst1 = MASK_OUT_ABOVE_16(dst);
+         dst2 = dst>>16;
+
+
+         r1 = src1 * dst1;
+         r2 = src1 * dst2;
+         r3 = src2 * dst1;
+         r4 = src2 * dst2;
+
+         lo = r1 + (MASK_OUT_ABOVE_16(r2)<<16) + (MASK_OUT_ABOVE_16(r3)<<16);
+         hi = r4 + (r2>>16) + (r3>>16) + (((r1>>16) + MASK_OUT_ABOVE_16(r2) + MASK_OUT_ABOVE_16(r3)) >> 16);
+
+         if(BIT_B(word2) && neg)
+         {
+            hi = (uint)MASK_OUT_ABOVE_32((-(sint)hi) - (lo != 0));
+            lo = (uint)MASK_OUT_ABOVE_32(-(sint)lo);
+         }
+
+         if(BIT_A(word2))
+         {
+            REG_D[word2 & 7] = hi;
+            REG_D[(word2 >> 12) & 7] = lo;
+            FLAG_N = NFLAG_32(hi);
+            FLAG_Z = hi | lo;
+            FLAG_V = VFLAG_CLEAR;
+            goto m68k_op_mull_32_ai_done;
+         }
+
+         REG_D[(word2 >> 12) & 7] = lo;
+         FLAG_N = NFLAG_32(lo);
+         FLAG_Z = lo;
+         if(BIT_B(word2))
+            FLAG_V = (!((GET_MSB_32(lo) && hi == 0xffffffff) || (!GET_MSB_32(lo) && !hi)))<<7;
+         else
+            FLAG_V = (hi != 0) << 7;
+         goto m68k_op_mull_32_ai_done;
+      }
+      m68ki_exception_illegal();
+
+   #endif
+   }
+m68k_op_mull_32_ai_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_mull_32_pi:
+   {
+      m68ki_resolve_flags();
+   #if M68K_USE_64_BIT
+
+      if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+      {
+         uint word2 = OPER_I_16();
+         uint64 src = OPER_AY_PI_32();
+         uint64 dst = REG_D[(word2 >> 12) & 7];
+         uint64 res;
+
+         FLAG_C = CFLAG_CLEAR;
+
+         if(BIT_B(word2))			   /* signed */
+         {
+            res = (sint64)((sint32)src) * (sint64)((sint32)dst);
+            if(!BIT_A(word2))
+            {
+               FLAG_Z = MASK_OUT_ABOVE_32(res);
+               FLAG_N = NFLAG_32(res);
+               FLAG_V = ((sint64)res != (sint32)res)<<7;
+               REG_D[(word2 >> 12) & 7] = FLAG_Z;
+               goto m68k_op_mull_32_pi_done;
+            }
+            FLAG_Z = MASK_OUT_ABOVE_32(res) | (res>>32);
+            FLAG_N = NFLAG_64(res);
+            FLAG_V = VFLAG_CLEAR;
+            REG_D[word2 & 7] = (res >> 32);
+            REG_D[(word2 >> 12) & 7] = MASK_OUT_ABOVE_32(res);
+            goto m68k_op_mull_32_pi_done;
+         }
+
+         res = src * dst;
+         if(!BIT_A(word2))
+         {
+            FLAG_Z = MASK_OUT_ABOVE_32(res);
+            FLAG_N = NFLAG_32(res);
+            FLAG_V = (res > 0xffffffff)<<7;
+            REG_D[(word2 >> 12) & 7] = FLAG_Z;
+            goto m68k_op_mull_32_pi_done;
+         }
+         FLAG_Z = MASK_OUT_ABOVE_32(res) | (res>>32);
+         FLAG_N = NFLAG_64(res);
+         FLAG_V = VFLAG_CLEAR;
+         REG_D[word2 & 7] = (res >> 32);
+         REG_D[(word2 >> 12) & 7] = MASK_OUT_ABOVE_32(res);
+         goto m68k_op_mull_32_pi_done;
+      }
+      m68ki_exception_illegal();
+
+   #else
+
+      if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+      {
+         uint word2 = OPER_I_16();
+         uint src = OPER_AY_PI_32();
+         uint dst = REG_D[(word2 >> 12) & 7];
+         uint neg = GET_MSB_32(src ^ dst);
+         uint src1;
+         uint src2;
+         uint dst1;
+         uint dst2;
+         uint r1;
+         uint r2;
+         uint r3;
+         uint r4;
+         uint lo;
+         uint hi;
+
+         FLAG_C = CFLAG_CLEAR;
+
+         if(BIT_B(word2))			   /* signed */
+         {
+            if(GET_MSB_32(src))
+               src = (uint)MASK_OUT_ABOVE_32(-(sint)src);
+            if(GET_MSB_32(dst))
+               dst = (uint)MASK_OUT_ABOVE_32(-(sint)dst);
+         }
+
+         src1 = MASK_OUT_ABOVE_16(src);
+         src2 = src>>16;
+         dst1 = MASK_OUT_ABOVE_16(dst);
+         dst2 = dst>>16;
+
+
+         r1 = src1 * dst1;
+         r2 = src1 * dst2;
+         r3 = src2 * dst1;
+         r4 = src2 * dst2;
+
+         lo = r1 + (MASK_OUT_ABOVE_16(r2)<<16) + (MASK_OUT_ABOVE_16(r3)<<16);
+         hi = r4 + (r2>>16) + (r3>>16) + (((r1>>16) + MASK_OUT_ABOVE_16(r2) + MASK_OUT_ABOVE_16(r3)) >> 16);
+
+         if(BIT_B(word2) && neg)
+         {
+            hi = (uint)MASK_OUT_ABOVE_32((-(sint)hi) - (lo != 0));
+            lo = (uint)MASK_OUT_ABOVE_32(-(sint)lo);
+         }
+
+         if(BIT_A(word2))
+         {
+            REG_D[word2 & 7] = hi;
+            REG_D[(word2 >> 12) & 7] = lo;
+            FLAG_N = NFLAG_32(hi);
+            FLAG_Z = hi | lo;
+            FLAG_V = VFLAG_CLEAR;
+            goto m68k_op_mull_32_pi_done;
+         }
+
+         REG_D[(word2 >> 12) & 7] = lo;
+         FLAG_N = NFLAG_32(lo);
+         FLAG_Z = lo;
+         if(BIT_B(word2))
+            FLAG_V = (!((GET_MSB_32(lo) && hi == 0xffffffff) || (!GET_MSB_32(lo) && !hi)))<<7;
+         else
+            FLAG_V = (hi != 0) << 7;
+         goto m68k_op_mull_32_pi_done;
+      }
+      m68ki_exception_illegal();
+
+   #endif
+   }
+m68k_op_mull_32_pi_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_mull_32_pd:
+   {
+      m68ki_resolve_flags();
+   #if M68K_USE_64_BIT
+
+      if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+      {
+         uint word2 = OPER_I_16();
+         uint64 src = OPER_AY_PD_32();
+         uint64 dst = REG_D[(word2 >> 12) & 7];
+         uint64 res;
+
+         FLAG_C = CFLAG_CLEAR;
+
+         if(BIT_B(word2))			   /* signed */
+         {
+            res = (sint64)((sint32)src) * (sint64)((sint32)dst);
+            if(!BIT_A(word2))
+            {
+               FLAG_Z = MASK_OUT_ABOVE_32(res);
+               FLAG_N = NFLAG_32(res);
+               FLAG_V = ((sint64)res != (sint32)res)<<7;
+               REG_D[(word2 >> 12) & 7] = FLAG_Z;
+               goto m68k_op_mull_32_pd_done;
+            }
+            FLAG_Z = MASK_OUT_ABOVE_32(res) | (res>>32);
+            FLAG_N = NFLAG_64(res);
+            FLAG_V = VFLAG_CLEAR;
+            REG_D[word2 & 7] = (res >> 32);
+            REG_D[(word2 >> 12) & 7] = MASK_OUT_ABOVE_32(res);
+            goto m68k_op_mull_32_pd_done;
+         }
+
+         res = src * dst;
+         if(!BIT_A(word2))
+         {
+            FLAG_Z = MASK_OUT_ABOVE_32(res);
+            FLAG_N = NFLAG_32(res);
+            FLAG_V = (res > 0xffffffff)<<7;
+            REG_D[(word2 >> 12) & 7] = FLAG_Z;
+            goto m68k_op_mull_32_pd_done;
+         }
+         FLAG_Z = MASK_OUT_ABOVE_32(res) | (res>>32);
+         FLAG_N = NFLAG_64(res);
+         FLAG_V = VFLAG_CLEAR;
+         REG_D[word2 & 7] = (res >> 32);
+         REG_D[(word2 >> 12) & 7] = MASK_OUT_ABOVE_32(res);
+         goto m68k_op_mull_32_pd_done;
+      }
+      m68ki_exception_illegal();
+
+   #else
+
+      if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+      {
+         uint word2 = OPER_I_16();
+         uint src = OPER_AY_PD_32();
+         uint dst = REG_D[(word2 >> 12) & 7];
+         uint neg = GET_MSB_32(src ^ dst);
+         uint src1;
+         uint src2;
+         uint dst1;
+         uint dst2;
+         uint r1;
+         uint r2;
+         uint r3;
+         uint r4;
+         uint lo;
+         uint hi;
+
+         FLAG_C = CFLAG_CLEAR;
+
+         if(BIT_B(word2))			   /* signed */
+         {
+            if(GET_MSB_32(src))
+               src = (uint)MASK_OUT_ABOVE_32(-(sint)src);
+            if(GET_MSB_32(dst))
+               dst = (uint)MASK_OUT_ABOVE_32(-(sint)dst);
+         }
+
+         src1 = MASK_OUT_ABOVE_16(src);
+         src2 = src>>16;
+         dst1 = MASK_OUT_ABOVE_16(dst);
+         dst2 = dst>>16;
+
+
+         r1 = src1 * dst1;
+         r2 = src1 * dst2;
+         r3 = src2 * dst1;
+         r4 = src2 * dst2;
+
+         lo = r1 + (MASK_OUT_ABOVE_16(r2)<<16) + (MASK_OUT_ABOVE_16(r3)<<16);
+         hi = r4 + (r2>>16) + (r3>>16) + (((r1>>16) + MASK_OUT_ABOVE_16(r2) + MASK_OUT_ABOVE_16(r3)) >> 16);
+
+         if(BIT_B(word2) && neg)
+         {
+            hi = (uint)MASK_OUT_ABOVE_32((-(sint)hi) - (lo != 0));
+            lo = (uint)MASK_OUT_ABOVE_32(-(sint)lo);
+         }
+
+         if(BIT_A(word2))
+         {
+            REG_D[word2 & 7] = hi;
+            REG_D[(word2 >> 12) & 7] = lo;
+            FLAG_N = NFLAG_32(hi);
+            FLAG_Z = hi | lo;
+            FLAG_V = VFLAG_CLEAR;
+            goto m68k_op_mull_32_pd_done;
+         }
+
+         REG_D[(word2 >> 12) & 7] = lo;
+         FLAG_N = NFLAG_32(lo);
+         FLAG_Z = lo;
+         if(BIT_B(word2))
+            FLAG_V = (!((GET_MSB_32(lo) && hi == 0xffffffff) || (!GET_MSB_32(lo) && !hi)))<<7;
+         else
+            FLAG_V = (hi != 0) << 7;
+         goto m68k_op_mull_32_pd_done;
+      }
+      m68ki_exception_illegal();
+
+   #endif
+   }
+m68k_op_mull_32_pd_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_mull_32_di:
+   {
+      m68ki_resolve_flags();
+   #if M68K_USE_64_BIT
+
+      if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+      {
+         uint word2 = OPER_I_16();
+         uint64 src = OPER_AY_DI_32();
+         uint64 dst = REG_D[(word2 >> 12) & 7];
+         uint64 res;
+
+         FLAG_C = CFLAG_CLEAR;
+
+         if(BIT_B(word2))			   /* signed */
+         {
+            res = (sint64)((sint32)src) * (sint64)((sint32)dst);
+            if(!BIT_A(word2))
+            {
+               FLAG_Z = MASK_OUT_ABOVE_32(res);
+               FLAG_N = NFLAG_32(res);
+               FLAG_V = ((sint64)res != (sint32)res)<<7;
+               REG_D[(word2 >> 12) & 7] = FLAG_Z;
+               goto m68k_op_mull_32_di_done;
+            }
+            FLAG_Z = MASK_OUT_ABOVE_32(res) | (res>>32);
+            FLAG_N = NFLAG_64(res);
+            FLAG_V = VFLAG_CLEAR;
+            REG_D[word2 & 7] = (res >> 32);
+            REG_D[(word2 >> 12) & 7] = MASK_OUT_ABOVE_32(res);
+            goto m68k_op_mull_32_di_done;
+         }
+
+         res = src * dst;
+         if(!BIT_A(word2))
+         {
+            FLAG_Z = MASK_OUT_ABOVE_32(res);
+            FLAG_N = NFLAG_32(res);
+            FLAG_V = (res > 0xffffffff)<<7;
+            REG_D[(word2 >> 12) & 7] = FLAG_Z;
+            goto m68k_op_mull_32_di_done;
+         }
+         FLAG_Z = MASK_OUT_ABOVE_32(res) | (res>>32);
+         FLAG_N = NFLAG_64(res);
+         FLAG_V = VFLAG_CLEAR;
+         REG_D[word2 & 7] = (res >> 32);
+         REG_D[(word2 >> 12) & 7] = MASK_OUT_ABOVE_32(res);
+         goto m68k_op_mull_32_di_done;
+      }
+      m68ki_exception_illegal();
+
+   #else
+
+      if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+      {
+         uint word2 = OPER_I_16();
+         uint src = OPER_AY_DI_32();
+         uint dst = REG_D[(word2 >> 12) & 7];
+         uint neg = GET_MSB_32(src ^ dst);
+         uint src1;
+         uint src2;
+         uint dst1;
+         uint dst2;
+         uint r1;
+         uint r2;
+         uint r3;
+         uint r4;
+         uint lo;
+         uint hi;
+
+         FLAG_C = CFLAG_CLEAR;
+
+         if(BIT_B(word2))			   /* signed */
+         {
+            if(GET_MSB_32(src))
+               src = (uint)MASK_OUT_ABOVE_32(-(sint)src);
+            if(GET_MSB_32(dst))
+               dst = (uint)MASK_OUT_ABOVE_32(-(sint)dst);
+         }
+
+         src1 = MASK_OUT_ABOVE_16(src);
+         src2 = src>>16;
+         dst1 = MASK_OUT_ABOVE_16(dst);
+         dst2 = dst>>16;
+
+
+         r1 = src1 * dst1;
+         r2 = src1 * dst2;
+         r3 = src2 * dst1;
+         r4 = src2 * dst2;
+
+         lo = r1 + (MASK_OUT_ABOVE_16(r2)<<16) + (MASK_OUT_ABOVE_16(r3)<<16);
+         hi = r4 + (r2>>16) + (r3>>16) + (((r1>>16) + MASK_OUT_ABOVE_16(r2) + MASK_OUT_ABOVE_16(r3)) >> 16);
+
+         if(BIT_B(word2) && neg)
+         {
+            hi = (uint)MASK_OUT_ABOVE_32((-(sint)hi) - (lo != 0));
+            lo = (uint)MASK_OUT_ABOVE_32(-(sint)lo);
+         }
+
+         if(BIT_A(word2))
+         {
+            REG_D[word2 & 7] = hi;
+            REG_D[(word2 >> 12) & 7] = lo;
+            FLAG_N = NFLAG_32(hi);
+            FLAG_Z = hi | lo;
+            FLAG_V = VFLAG_CLEAR;
+            goto m68k_op_mull_32_di_done;
+         }
+
+         REG_D[(word2 >> 12) & 7] = lo;
+         FLAG_N = NFLAG_32(lo);
+         FLAG_Z = lo;
+         if(BIT_B(word2))
+            FLAG_V = (!((GET_MSB_32(lo) && hi == 0xffffffff) || (!GET_MSB_32(lo) && !hi)))<<7;
+         else
+            FLAG_V = (hi != 0) << 7;
+         goto m68k_op_mull_32_di_done;
+      }
+      m68ki_exception_illegal();
+
+   #endif
+   }
+m68k_op_mull_32_di_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_mull_32_ix:
+   {
+      m68ki_resolve_flags();
+   #if M68K_USE_64_BIT
+
+      if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+      {
+         uint word2 = OPER_I_16();
+         uint64 src = OPER_AY_IX_32();
+         uint64 dst = REG_D[(word2 >> 12) & 7];
+         uint64 res;
+
+         FLAG_C = CFLAG_CLEAR;
+
+         if(BIT_B(word2))			   /* signed */
+         {
+            res = (sint64)((sint32)src) * (sint64)((sint32)dst);
+            if(!BIT_A(word2))
+            {
+               FLAG_Z = MASK_OUT_ABOVE_32(res);
+               FLAG_N = NFLAG_32(res);
+               FLAG_V = ((sint64)res != (sint32)res)<<7;
+               REG_D[(word2 >> 12) & 7] = FLAG_Z;
+               goto m68k_op_mull_32_ix_done;
+            }
+            FLAG_Z = MASK_OUT_ABOVE_32(res) | (res>>32);
+            FLAG_N = NFLAG_64(res);
+            FLAG_V = VFLAG_CLEAR;
+            REG_D[word2 & 7] = (res >> 32);
+            REG_D[(word2 >> 12) & 7] = MASK_OUT_ABOVE_32(res);
+            goto m68k_op_mull_32_ix_done;
+         }
+
+         res = src * dst;
+         if(!BIT_A(word2))
+         {
+            FLAG_Z = MASK_OUT_ABOVE_32(res);
+            FLAG_N = NFLAG_32(res);
+            FLAG_V = (res > 0xffffffff)<<7;
+            REG_D[(word2 >> 12) & 7] = FLAG_Z;
+            goto m68k_op_mull_32_ix_done;
+         }
+         FLAG_Z = MASK_OUT_ABOVE_32(res) | (res>>32);
+         FLAG_N = NFLAG_64(res);
+         FLAG_V = VFLAG_CLEAR;
+         REG_D[word2 & 7] = (res >> 32);
+         REG_D[(word2 >> 12) & 7] = MASK_OUT_ABOVE_32(res);
+         goto m68k_op_mull_32_ix_done;
+      }
+      m68ki_exception_illegal();
+
+   #else
+
+      if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+      {
+         uint word2 = OPER_I_16();
+         uint src = OPER_AY_IX_32();
+         uint dst = REG_D[(word2 >> 12) & 7];
+         uint neg = GET_MSB_32(src ^ dst);
+         uint src1;
+         uint src2;
+         uint dst1;
+         uint dst2;
+         uint r1;
+         uint r2;
+         uint r3;
+         uint r4;
+         uint lo;
+         uint hi;
+
+         FLAG_C = CFLAG_CLEAR;
+
+         if(BIT_B(word2))			   /* signed */
+         {
+            if(GET_MSB_32(src))
+               src = (uint)MASK_OUT_ABOVE_32(-(sint)src);
+            if(GET_MSB_32(dst))
+               dst = (uint)MASK_OUT_ABOVE_32(-(sint)dst);
+         }
+
+         src1 = MASK_OUT_ABOVE_16(src);
+         src2 = src>>16;
+         dst1 = MASK_OUT_ABOVE_16(dst);
+         dst2 = dst>>16;
+
+
+         r1 = src1 * dst1;
+         r2 = src1 * dst2;
+         r3 = src2 * dst1;
+         r4 = src2 * dst2;
+
+         lo = r1 + (MASK_OUT_ABOVE_16(r2)<<16) + (MASK_OUT_ABOVE_16(r3)<<16);
+         hi = r4 + (r2>>16) + (r3>>16) + (((r1>>16) + MASK_OUT_ABOVE_16(r2) + MASK_OUT_ABOVE_16(r3)) >> 16);
+
+         if(BIT_B(word2) && neg)
+         {
+            hi = (uint)MASK_OUT_ABOVE_32((-(sint)hi) - (lo != 0));
+            lo = (uint)MASK_OUT_ABOVE_32(-(sint)lo);
+         }
+
+         if(BIT_A(word2))
+         {
+            REG_D[word2 & 7] = hi;
+            REG_D[(word2 >> 12) & 7] = lo;
+            FLAG_N = NFLAG_32(hi);
+            FLAG_Z = hi | lo;
+            FLAG_V = VFLAG_CLEAR;
+            goto m68k_op_mull_32_ix_done;
+         }
+
+         REG_D[(word2 >> 12) & 7] = lo;
+         FLAG_N = NFLAG_32(lo);
+         FLAG_Z = lo;
+         if(BIT_B(word2))
+            FLAG_V = (!((GET_MSB_32(lo) && hi == 0xffffffff) || (!GET_MSB_32(lo) && !hi)))<<7;
+         else
+            FLAG_V = (hi != 0) << 7;
+         goto m68k_op_mull_32_ix_done;
+      }
+      m68ki_exception_illegal();
+
+   #endif
+   }
+m68k_op_mull_32_ix_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_mull_32_aw:
+   {
+      m68ki_resolve_flags();
+   #if M68K_USE_64_BIT
+
+      if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+      {
+         uint word2 = OPER_I_16();
+         uint64 src = OPER_AW_32();
+         uint64 dst = REG_D[(word2 >> 12) & 7];
+         uint64 res;
+
+         FLAG_C = CFLAG_CLEAR;
+
+         if(BIT_B(word2))			   /* signed */
+         {
+            res = (sint64)((sint32)src) * (sint64)((sint32)dst);
+            if(!BIT_A(word2))
+            {
+               FLAG_Z = MASK_OUT_ABOVE_32(res);
+               FLAG_N = NFLAG_32(res);
+               FLAG_V = ((sint64)res != (sint32)res)<<7;
+               REG_D[(word2 >> 12) & 7] = FLAG_Z;
+               goto m68k_op_mull_32_aw_done;
+            }
+            FLAG_Z = MASK_OUT_ABOVE_32(res) | (res>>32);
+            FLAG_N = NFLAG_64(res);
+            FLAG_V = VFLAG_CLEAR;
+            REG_D[word2 & 7] = (res >> 32);
+            REG_D[(word2 >> 12) & 7] = MASK_OUT_ABOVE_32(res);
+            goto m68k_op_mull_32_aw_done;
+         }
+
+         res = src * dst;
+         if(!BIT_A(word2))
+         {
+            FLAG_Z = MASK_OUT_ABOVE_32(res);
+            FLAG_N = NFLAG_32(res);
+            FLAG_V = (res > 0xffffffff)<<7;
+            REG_D[(word2 >> 12) & 7] = FLAG_Z;
+            goto m68k_op_mull_32_aw_done;
+         }
+         FLAG_Z = MASK_OUT_ABOVE_32(res) | (res>>32);
+         FLAG_N = NFLAG_64(res);
+         FLAG_V = VFLAG_CLEAR;
+         REG_D[word2 & 7] = (res >> 32);
+         REG_D[(word2 >> 12) & 7] = MASK_OUT_ABOVE_32(res);
+         goto m68k_op_mull_32_aw_done;
+      }
+      m68ki_exception_illegal();
+
+   #else
+
+      if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+      {
+         uint word2 = OPER_I_16();
+         uint src = OPER_AW_32();
+         uint dst = REG_D[(word2 >> 12) & 7];
+         uint neg = GET_MSB_32(src ^ dst);
+         uint src1;
+         uint src2;
+         uint dst1;
+         uint dst2;
+         uint r1;
+         uint r2;
+         uint r3;
+         uint r4;
+         uint lo;
+         uint hi;
+
+         FLAG_C = CFLAG_CLEAR;
+
+         if(BIT_B(word2))			   /* signed */
+         {
+            if(GET_MSB_32(src))
+               src = (uint)MASK_OUT_ABOVE_32(-(sint)src);
+            if(GET_MSB_32(dst))
+               dst = (uint)MASK_OUT_ABOVE_32(-(sint)dst);
+         }
+
+         src1 = MASK_OUT_ABOVE_16(src);
+         src2 = src>>16;
+         dst1 = MASK_OUT_ABOVE_16(dst);
+         dst2 = dst>>16;
+
+
+         r1 = src1 * dst1;
+         r2 = src1 * dst2;
+         r3 = src2 * dst1;
+         r4 = src2 * dst2;
+
+         lo = r1 + (MASK_OUT_ABOVE_16(r2)<<16) + (MASK_OUT_ABOVE_16(r3)<<16);
+         hi = r4 + (r2>>16) + (r3>>16) + (((r1>>16) + MASK_OUT_ABOVE_16(r2) + MASK_OUT_ABOVE_16(r3)) >> 16);
+
+         if(BIT_B(word2) && neg)
+         {
+            hi = (uint)MASK_OUT_ABOVE_32((-(sint)hi) - (lo != 0));
+            lo = (uint)MASK_OUT_ABOVE_32(-(sint)lo);
+         }
+
+         if(BIT_A(word2))
+         {
+            REG_D[word2 & 7] = hi;
+            REG_D[(word2 >> 12) & 7] = lo;
+            FLAG_N = NFLAG_32(hi);
+            FLAG_Z = hi | lo;
+            FLAG_V = VFLAG_CLEAR;
+            goto m68k_op_mull_32_aw_done;
+         }
+
+         REG_D[(word2 >> 12) & 7] = lo;
+         FLAG_N = NFLAG_32(lo);
+         FLAG_Z = lo;
+         if(BIT_B(word2))
+            FLAG_V = (!((GET_MSB_32(lo) && hi == 0xffffffff) || (!GET_MSB_32(lo) && !hi)))<<7;
+         else
+            FLAG_V = (hi != 0) << 7;
+         goto m68k_op_mull_32_aw_done;
+      }
+      m68ki_exception_illegal();
+
+   #endif
+   }
+m68k_op_mull_32_aw_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_mull_32_al:
+   {
+      m68ki_resolve_flags();
+   #if M68K_USE_64_BIT
+
+      if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+      {
+         uint word2 = OPER_I_16();
+         uint64 src = OPER_AL_32();
+         uint64 dst = REG_D[(word2 >> 12) & 7];
+         uint64 res;
+
+         FLAG_C = CFLAG_CLEAR;
+
+         if(BIT_B(word2))			   /* signed */
+         {
+            res = (sint64)((sint32)src) * (sint64)((sint32)dst);
+            if(!BIT_A(word2))
+            {
+               FLAG_Z = MASK_OUT_ABOVE_32(res);
+               FLAG_N = NFLAG_32(res);
+               FLAG_V = ((sint64)res != (sint32)res)<<7;
+               REG_D[(word2 >> 12) & 7] = FLAG_Z;
+               goto m68k_op_mull_32_al_done;
+            }
+            FLAG_Z = MASK_OUT_ABOVE_32(res) | (res>>32);
+            FLAG_N = NFLAG_64(res);
+            FLAG_V = VFLAG_CLEAR;
+            REG_D[word2 & 7] = (res >> 32);
+            REG_D[(word2 >> 12) & 7] = MASK_OUT_ABOVE_32(res);
+            goto m68k_op_mull_32_al_done;
+         }
+
+         res = src * dst;
+         if(!BIT_A(word2))
+         {
+            FLAG_Z = MASK_OUT_ABOVE_32(res);
+            FLAG_N = NFLAG_32(res);
+            FLAG_V = (res > 0xffffffff)<<7;
+            REG_D[(word2 >> 12) & 7] = FLAG_Z;
+            goto m68k_op_mull_32_al_done;
+         }
+         FLAG_Z = MASK_OUT_ABOVE_32(res) | (res>>32);
+         FLAG_N = NFLAG_64(res);
+         FLAG_V = VFLAG_CLEAR;
+         REG_D[word2 & 7] = (res >> 32);
+         REG_D[(word2 >> 12) & 7] = MASK_OUT_ABOVE_32(res);
+         goto m68k_op_mull_32_al_done;
+      }
+      m68ki_exception_illegal();
+
+   #else
+
+      if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+      {
+         uint word2 = OPER_I_16();
+         uint src = OPER_AL_32();
+         uint dst = REG_D[(word2 >> 12) & 7];
+         uint neg = GET_MSB_32(src ^ dst);
+         uint src1;
+         uint src2;
+         uint dst1;
+         uint dst2;
+         uint r1;
+         uint r2;
+         uint r3;
+         uint r4;
+         uint lo;
+         uint hi;
+
+         FLAG_C = CFLAG_CLEAR;
+
+         if(BIT_B(word2))			   /* signed */
+         {
+            if(GET_MSB_32(src))
+               src = (uint)MASK_OUT_ABOVE_32(-(sint)src);
+            if(GET_MSB_32(dst))
+               dst = (uint)MASK_OUT_ABOVE_32(-(sint)dst);
+         }
+
+         src1 = MASK_OUT_ABOVE_16(src);
+         src2 = src>>16;
+         dst1 = MASK_OUT_ABOVE_16(dst);
+         dst2 = dst>>16;
+
+
+         r1 = src1 * dst1;
+         r2 = src1 * dst2;
+         r3 = src2 * dst1;
+         r4 = src2 * dst2;
+
+         lo = r1 + (MASK_OUT_ABOVE_16(r2)<<16) + (MASK_OUT_ABOVE_16(r3)<<16);
+         hi = r4 + (r2>>16) + (r3>>16) + (((r1>>16) + MASK_OUT_ABOVE_16(r2) + MASK_OUT_ABOVE_16(r3)) >> 16);
+
+         if(BIT_B(word2) && neg)
+         {
+            hi = (uint)MASK_OUT_ABOVE_32((-(sint)hi) - (lo != 0));
+            lo = (uint)MASK_OUT_ABOVE_32(-(sint)lo);
+         }
+
+         if(BIT_A(word2))
+         {
+            REG_D[word2 & 7] = hi;
+            REG_D[(word2 >> 12) & 7] = lo;
+            FLAG_N = NFLAG_32(hi);
+            FLAG_Z = hi | lo;
+            FLAG_V = VFLAG_CLEAR;
+            goto m68k_op_mull_32_al_done;
+         }
+
+         REG_D[(word2 >> 12) & 7] = lo;
+         FLAG_N = NFLAG_32(lo);
+         FLAG_Z = lo;
+         if(BIT_B(word2))
+            FLAG_V = (!((GET_MSB_32(lo) && hi == 0xffffffff) || (!GET_MSB_32(lo) && !hi)))<<7;
+         else
+            FLAG_V = (hi != 0) << 7;
+         goto m68k_op_mull_32_al_done;
+      }
+      m68ki_exception_illegal();
+
+   #endif
+   }
+m68k_op_mull_32_al_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_mull_32_pcdi:
+   {
+      m68ki_resolve_flags();
+   #if M68K_USE_64_BIT
+
+      if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+      {
+         uint word2 = OPER_I_16();
+         uint64 src = OPER_PCDI_32();
+         uint64 dst = REG_D[(word2 >> 12) & 7];
+         uint64 res;
+
+         FLAG_C = CFLAG_CLEAR;
+
+         if(BIT_B(word2))			   /* signed */
+         {
+            res = (sint64)((sint32)src) * (sint64)((sint32)dst);
+            if(!BIT_A(word2))
+            {
+               FLAG_Z = MASK_OUT_ABOVE_32(res);
+               FLAG_N = NFLAG_32(res);
+               FLAG_V = ((sint64)res != (sint32)res)<<7;
+               REG_D[(word2 >> 12) & 7] = FLAG_Z;
+               goto m68k_op_mull_32_pcdi_done;
+            }
+            FLAG_Z = MASK_OUT_ABOVE_32(res) | (res>>32);
+            FLAG_N = NFLAG_64(res);
+            FLAG_V = VFLAG_CLEAR;
+            REG_D[word2 & 7] = (res >> 32);
+            REG_D[(word2 >> 12) & 7] = MASK_OUT_ABOVE_32(res);
+            goto m68k_op_mull_32_pcdi_done;
+         }
+
+         res = src * dst;
+         if(!BIT_A(word2))
+         {
+            FLAG_Z = MASK_OUT_ABOVE_32(res);
+            FLAG_N = NFLAG_32(res);
+            FLAG_V = (res > 0xffffffff)<<7;
+            REG_D[(word2 >> 12) & 7] = FLAG_Z;
+            goto m68k_op_mull_32_pcdi_done;
+         }
+         FLAG_Z = MASK_OUT_ABOVE_32(res) | (res>>32);
+         FLAG_N = NFLAG_64(res);
+         FLAG_V = VFLAG_CLEAR;
+         REG_D[word2 & 7] = (res >> 32);
+         REG_D[(word2 >> 12) & 7] = MASK_OUT_ABOVE_32(res);
+         goto m68k_op_mull_32_pcdi_done;
+      }
+      m68ki_exception_illegal();
+
+   #else
+
+      if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+      {
+         uint word2 = OPER_I_16();
+         uint src = OPER_PCDI_32();
+         uint dst = REG_D[(word2 >> 12) & 7];
+         uint neg = GET_MSB_32(src ^ dst);
+         uint src1;
+         uint src2;
+         uint dst1;
+         uint dst2;
+         uint r1;
+         uint r2;
+         uint r3;
+         uint r4;
+         uint lo;
+         uint hi;
+
+         FLAG_C = CFLAG_CLEAR;
+
+         if(BIT_B(word2))			   /* signed */
+         {
+            if(GET_MSB_32(src))
+               src = (uint)MASK_OUT_ABOVE_32(-(sint)src);
+            if(GET_MSB_32(dst))
+               dst = (uint)MASK_OUT_ABOVE_32(-(sint)dst);
+         }
+
+         src1 = MASK_OUT_ABOVE_16(src);
+         src2 = src>>16;
+         dst1 = MASK_OUT_ABOVE_16(dst);
+         dst2 = dst>>16;
+
+
+         r1 = src1 * dst1;
+         r2 = src1 * dst2;
+         r3 = src2 * dst1;
+         r4 = src2 * dst2;
+
+         lo = r1 + (MASK_OUT_ABOVE_16(r2)<<16) + (MASK_OUT_ABOVE_16(r3)<<16);
+         hi = r4 + (r2>>16) + (r3>>16) + (((r1>>16) + MASK_OUT_ABOVE_16(r2) + MASK_OUT_ABOVE_16(r3)) >> 16);
+
+         if(BIT_B(word2) && neg)
+         {
+            hi = (uint)MASK_OUT_ABOVE_32((-(sint)hi) - (lo != 0));
+            lo = (uint)MASK_OUT_ABOVE_32(-(sint)lo);
+         }
+
+         if(BIT_A(word2))
+         {
+            REG_D[word2 & 7] = hi;
+            REG_D[(word2 >> 12) & 7] = lo;
+            FLAG_N = NFLAG_32(hi);
+            FLAG_Z = hi | lo;
+            FLAG_V = VFLAG_CLEAR;
+            goto m68k_op_mull_32_pcdi_done;
+         }
+
+         REG_D[(word2 >> 12) & 7] = lo;
+         FLAG_N = NFLAG_32(lo);
+         FLAG_Z = lo;
+         if(BIT_B(word2))
+            FLAG_V = (!((GET_MSB_32(lo) && hi == 0xffffffff) || (!GET_MSB_32(lo) && !hi)))<<7;
+         else
+            FLAG_V = (hi != 0) << 7;
+         goto m68k_op_mull_32_pcdi_done;
+      }
+      m68ki_exception_illegal();
+
+   #endif
+   }
+m68k_op_mull_32_pcdi_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_mull_32_pcix:
+   {
+      m68ki_resolve_flags();
+   #if M68K_USE_64_BIT
+
+      if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+      {
+         uint word2 = OPER_I_16();
+         uint64 src = OPER_PCIX_32();
+         uint64 dst = REG_D[(word2 >> 12) & 7];
+         uint64 res;
+
+         FLAG_C = CFLAG_CLEAR;
+
+         if(BIT_B(word2))			   /* signed */
+         {
+            res = (sint64)((sint32)src) * (sint64)((sint32)dst);
+            if(!BIT_A(word2))
+            {
+               FLAG_Z = MASK_OUT_ABOVE_32(res);
+               FLAG_N = NFLAG_32(res);
+               FLAG_V = ((sint64)res != (sint32)res)<<7;
+               REG_D[(word2 >> 12) & 7] = FLAG_Z;
+               goto m68k_op_mull_32_pcix_done;
+            }
+            FLAG_Z = MASK_OUT_ABOVE_32(res) | (res>>32);
+            FLAG_N = NFLAG_64(res);
+            FLAG_V = VFLAG_CLEAR;
+            REG_D[word2 & 7] = (res >> 32);
+            REG_D[(word2 >> 12) & 7] = MASK_OUT_ABOVE_32(res);
+            goto m68k_op_mull_32_pcix_done;
+         }
+
+         res = src * dst;
+         if(!BIT_A(word2))
+         {
+            FLAG_Z = MASK_OUT_ABOVE_32(res);
+            FLAG_N = NFLAG_32(res);
+            FLAG_V = (res > 0xffffffff)<<7;
+            REG_D[(word2 >> 12) & 7] = FLAG_Z;
+            goto m68k_op_mull_32_pcix_done;
+         }
+         FLAG_Z = MASK_OUT_ABOVE_32(res) | (res>>32);
+         FLAG_N = NFLAG_64(res);
+         FLAG_V = VFLAG_CLEAR;
+         REG_D[word2 & 7] = (res >> 32);
+         REG_D[(word2 >> 12) & 7] = MASK_OUT_ABOVE_32(res);
+         goto m68k_op_mull_32_pcix_done;
+      }
+      m68ki_exception_illegal();
+
+   #else
+
+      if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+      {
+         uint word2 = OPER_I_16();
+         uint src = OPER_PCIX_32();
+         uint dst = REG_D[(word2 >> 12) & 7];
+         uint neg = GET_MSB_32(src ^ dst);
+         uint src1;
+         uint src2;
+         uint dst1;
+         uint dst2;
+         uint r1;
+         uint r2;
+         uint r3;
+         uint r4;
+         uint lo;
+         uint hi;
+
+         FLAG_C = CFLAG_CLEAR;
+
+         if(BIT_B(word2))			   /* signed */
+         {
+            if(GET_MSB_32(src))
+               src = (uint)MASK_OUT_ABOVE_32(-(sint)src);
+            if(GET_MSB_32(dst))
+               dst = (uint)MASK_OUT_ABOVE_32(-(sint)dst);
+         }
+
+         src1 = MASK_OUT_ABOVE_16(src);
+         src2 = src>>16;
+         dst1 = MASK_OUT_ABOVE_16(dst);
+         dst2 = dst>>16;
+
+
+         r1 = src1 * dst1;
+         r2 = src1 * dst2;
+         r3 = src2 * dst1;
+         r4 = src2 * dst2;
+
+         lo = r1 + (MASK_OUT_ABOVE_16(r2)<<16) + (MASK_OUT_ABOVE_16(r3)<<16);
+         hi = r4 + (r2>>16) + (r3>>16) + (((r1>>16) + MASK_OUT_ABOVE_16(r2) + MASK_OUT_ABOVE_16(r3)) >> 16);
+
+         if(BIT_B(word2) && neg)
+         {
+            hi = (uint)MASK_OUT_ABOVE_32((-(sint)hi) - (lo != 0));
+            lo = (uint)MASK_OUT_ABOVE_32(-(sint)lo);
+         }
+
+         if(BIT_A(word2))
+         {
+            REG_D[word2 & 7] = hi;
+            REG_D[(word2 >> 12) & 7] = lo;
+            FLAG_N = NFLAG_32(hi);
+            FLAG_Z = hi | lo;
+            FLAG_V = VFLAG_CLEAR;
+            goto m68k_op_mull_32_pcix_done;
+         }
+
+         REG_D[(word2 >> 12) & 7] = lo;
+         FLAG_N = NFLAG_32(lo);
+         FLAG_Z = lo;
+         if(BIT_B(word2))
+            FLAG_V = (!((GET_MSB_32(lo) && hi == 0xffffffff) || (!GET_MSB_32(lo) && !hi)))<<7;
+         else
+            FLAG_V = (hi != 0) << 7;
+         goto m68k_op_mull_32_pcix_done;
+      }
+      m68ki_exception_illegal();
+
+   #endif
+   }
+m68k_op_mull_32_pcix_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_mull_32_i:
+   {
+      m68ki_resolve_flags();
+   #if M68K_USE_64_BIT
+
+      if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+      {
+         uint word2 = OPER_I_16();
+         uint64 src = OPER_I_32();
+         uint64 dst = REG_D[(word2 >> 12) & 7];
+         uint64 res;
+
+         FLAG_C = CFLAG_CLEAR;
+
+         if(BIT_B(word2))			   /* signed */
+         {
+            res = (sint64)((sint32)src) * (sint64)((sint32)dst);
+            if(!BIT_A(word2))
+            {
+               FLAG_Z = MASK_OUT_ABOVE_32(res);
+               FLAG_N = NFLAG_32(res);
+               FLAG_V = ((sint64)res != (sint32)res)<<7;
+               REG_D[(word2 >> 12) & 7] = FLAG_Z;
+               goto m68k_op_mull_32_i_done;
+            }
+            FLAG_Z = MASK_OUT_ABOVE_32(res) | (res>>32);
+            FLAG_N = NFLAG_64(res);
+            FLAG_V = VFLAG_CLEAR;
+            REG_D[word2 & 7] = (res >> 32);
+            REG_D[(word2 >> 12) & 7] = MASK_OUT_ABOVE_32(res);
+            goto m68k_op_mull_32_i_done;
+         }
+
+         res = src * dst;
+         if(!BIT_A(word2))
+         {
+            FLAG_Z = MASK_OUT_ABOVE_32(res);
+            FLAG_N = NFLAG_32(res);
+            FLAG_V = (res > 0xffffffff)<<7;
+            REG_D[(word2 >> 12) & 7] = FLAG_Z;
+            goto m68k_op_mull_32_i_done;
+         }
+         FLAG_Z = MASK_OUT_ABOVE_32(res) | (res>>32);
+         FLAG_N = NFLAG_64(res);
+         FLAG_V = VFLAG_CLEAR;
+         REG_D[word2 & 7] = (res >> 32);
+         REG_D[(word2 >> 12) & 7] = MASK_OUT_ABOVE_32(res);
+         goto m68k_op_mull_32_i_done;
+      }
+      m68ki_exception_illegal();
+
+   #else
+
+      if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+      {
+         uint word2 = OPER_I_16();
+         uint src = OPER_I_32();
+         uint dst = REG_D[(word2 >> 12) & 7];
+         uint neg = GET_MSB_32(src ^ dst);
+         uint src1;
+         uint src2;
+         uint dst1;
+         uint dst2;
+         uint r1;
+         uint r2;
+         uint r3;
+         uint r4;
+         uint lo;
+         uint hi;
+
+         FLAG_C = CFLAG_CLEAR;
+
+         if(BIT_B(word2))			   /* signed */
+         {
+            if(GET_MSB_32(src))
+               src = (uint)MASK_OUT_ABOVE_32(-(sint)src);
+            if(GET_MSB_32(dst))
+               dst = (uint)MASK_OUT_ABOVE_32(-(sint)dst);
+         }
+
+         src1 = MASK_OUT_ABOVE_16(src);
+         src2 = src>>16;
+         dst1 = MASK_OUT_ABOVE_16(dst);
+         dst2 = dst>>16;
+
+
+         r1 = src1 * dst1;
+         r2 = src1 * dst2;
+         r3 = src2 * dst1;
+         r4 = src2 * dst2;
+
+         lo = r1 + (MASK_OUT_ABOVE_16(r2)<<16) + (MASK_OUT_ABOVE_16(r3)<<16);
+         hi = r4 + (r2>>16) + (r3>>16) + (((r1>>16) + MASK_OUT_ABOVE_16(r2) + MASK_OUT_ABOVE_16(r3)) >> 16);
+
+         if(BIT_B(word2) && neg)
+         {
+            hi = (uint)MASK_OUT_ABOVE_32((-(sint)hi) - (lo != 0));
+            lo = (uint)MASK_OUT_ABOVE_32(-(sint)lo);
+         }
+
+         if(BIT_A(word2))
+         {
+            REG_D[word2 & 7] = hi;
+            REG_D[(word2 >> 12) & 7] = lo;
+            FLAG_N = NFLAG_32(hi);
+            FLAG_Z = hi | lo;
+            FLAG_V = VFLAG_CLEAR;
+            goto m68k_op_mull_32_i_done;
+         }
+
+         REG_D[(word2 >> 12) & 7] = lo;
+         FLAG_N = NFLAG_32(lo);
+         FLAG_Z = lo;
+         if(BIT_B(word2))
+            FLAG_V = (!((GET_MSB_32(lo) && hi == 0xffffffff) || (!GET_MSB_32(lo) && !hi)))<<7;
+         else
+            FLAG_V = (hi != 0) << 7;
+         goto m68k_op_mull_32_i_done;
+      }
+      m68ki_exception_illegal();
+
+   #endif
+   }
+m68k_op_mull_32_i_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_nbcd_8_d:
+   {
+      uint* r_dst = &DY;
+      uint dst = *r_dst;
+      uint res = MASK_OUT_ABOVE_8(0x9a - dst - XFLAG_AS_1());
+
+      m68ki_resolve_flags();
+
+      if(res != 0x9a)
+      {
+         FLAG_V = ~res; /* Undefined V behavior */
+
+         if((res & 0x0f) == 0xa)
+            res = (res & 0xf0) + 0x10;
+
+         res = MASK_OUT_ABOVE_8(res);
+
+         FLAG_V &= res; /* Undefined V behavior part II */
+
+         *r_dst = MASK_OUT_BELOW_8(*r_dst) | res;
+
+         FLAG_Z |= res;
+         FLAG_C = CFLAG_SET;
+         FLAG_X = XFLAG_SET;
+      }
+      else
+      {
+         FLAG_V = VFLAG_CLEAR;
+         FLAG_C = CFLAG_CLEAR;
+         FLAG_X = XFLAG_CLEAR;
+      }
+      FLAG_N = NFLAG_8(res);	/* Undefined N behavior */
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_nbcd_8_ai:
+   {
+      uint ea = EA_AY_AI_8();
+      uint dst = m68ki_read_8(ea);
+      uint res = MASK_OUT_ABOVE_8(0x9a - dst - XFLAG_AS_1());
+
+      m68ki_resolve_flags();
+
+      if(res != 0x9a)
+      {
+         FLAG_V = ~res; /* Undefined V behavior */
+
+         if((res & 0x0f) == 0xa)
+            res = (res & 0xf0) + 0x10;
+
+         res = MASK_OUT_ABOVE_8(res);
+
+         FLAG_V &= res; /* Undefined V behavior part II */
+
+         m68ki_write_8(ea, MASK_OUT_ABOVE_8(res));
+
+         FLAG_Z |= res;
+         FLAG_C = CFLAG_SET;
+         FLAG_X = XFLAG_SET;
+      }
+      else
+      {
+         FLAG_V = VFLAG_CLEAR;
+         FLAG_C = CFLAG_CLEAR;
+         FLAG_X = XFLAG_CLEAR;
+      }
+      FLAG_N = NFLAG_8(res);	/* Undefined N behavior */
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_nbcd_8_pi:
+   {
+      uint ea = EA_AY_PI_8();
+      uint dst = m68ki_read_8(ea);
+      uint res = MASK_OUT_ABOVE_8(0x9a - dst - XFLAG_AS_1());
+
+      m68ki_resolve_flags();
+
+      if(res != 0x9a)
+      {
+         FLAG_V = ~res; /* Undefined V behavior */
+
+         if((res & 0x0f) == 0xa)
+            res = (res & 0xf0) + 0x10;
+
+         res = MASK_OUT_ABOVE_8(res);
+
+         FLAG_V &= res; /* Undefined V behavior part II */
+
+         m68ki_write_8(ea, MASK_OUT_ABOVE_8(res));
+
+         FLAG_Z |= res;
+         FLAG_C = CFLAG_SET;
+         FLAG_X = XFLAG_SET;
+      }
+      else
+      {
+         FLAG_V = VFLAG_CLEAR;
+         FLAG_C = CFLAG_CLEAR;
+         FLAG_X = XFLAG_CLEAR;
+      }
+      FLAG_N = NFLAG_8(res);	/* Undefined N behavior */
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_nbcd_8_pi7:
+   {
+      uint ea = EA_A7_PI_8();
+      uint dst = m68ki_read_8(ea);
+      uint res = MASK_OUT_ABOVE_8(0x9a - dst - XFLAG_AS_1());
+
+      m68ki_resolve_flags();
+
+      if(res != 0x9a)
+      {
+         FLAG_V = ~res; /* Undefined V behavior */
+
+         if((res & 0x0f) == 0xa)
+            res = (res & 0xf0) + 0x10;
+
+         res = MASK_OUT_ABOVE_8(res);
+
+         FLAG_V &= res; /* Undefined V behavior part II */
+
+         m68ki_write_8(ea, MASK_OUT_ABOVE_8(res));
+
+         FLAG_Z |= res;
+         FLAG_C = CFLAG_SET;
+         FLAG_X = XFLAG_SET;
+      }
+      else
+      {
+         FLAG_V = VFLAG_CLEAR;
+         FLAG_C = CFLAG_CLEAR;
+         FLAG_X = XFLAG_CLEAR;
+      }
+      FLAG_N = NFLAG_8(res);	/* Undefined N behavior */
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_nbcd_8_pd:
+   {
+      uint ea = EA_AY_PD_8();
+      uint dst = m68ki_read_8(ea);
+      uint res = MASK_OUT_ABOVE_8(0x9a - dst - XFLAG_AS_1());
+
+      m68ki_resolve_flags();
+
+      if(res != 0x9a)
+      {
+         FLAG_V = ~res; /* Undefined V behavior */
+
+         if((res & 0x0f) == 0xa)
+            res = (res & 0xf0) + 0x10;
+
+         res = MASK_OUT_ABOVE_8(res);
+
+         FLAG_V &= res; /* Undefined V behavior part II */
+
+         m68ki_write_8(ea, MASK_OUT_ABOVE_8(res));
+
+         FLAG_Z |= res;
+         FLAG_C = CFLAG_SET;
+         FLAG_X = XFLAG_SET;
+      }
+      else
+      {
+         FLAG_V = VFLAG_CLEAR;
+         FLAG_C = CFLAG_CLEAR;
+         FLAG_X = XFLAG_CLEAR;
+      }
+      FLAG_N = NFLAG_8(res);	/* Undefined N behavior */
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_nbcd_8_pd7:
+   {
+      uint ea = EA_A7_PD_8();
+      uint dst = m68ki_read_8(ea);
+      uint res = MASK_OUT_ABOVE_8(0x9a - dst - XFLAG_AS_1());
+
+      m68ki_resolve_flags();
+
+      if(res != 0x9a)
+      {
+         FLAG_V = ~res; /* Undefined V behavior */
+
+         if((res & 0x0f) == 0xa)
+            res = (res & 0xf0) + 0x10;
+
+         res = MASK_OUT_ABOVE_8(res);
+
+         FLAG_V &= res; /* Undefined V behavior part II */
+
+         m68ki_write_8(ea, MASK_OUT_ABOVE_8(res));
+
+         FLAG_Z |= res;
+         FLAG_C = CFLAG_SET;
+         FLAG_X = XFLAG_SET;
+      }
+      else
+      {
+         FLAG_V = VFLAG_CLEAR;
+         FLAG_C = CFLAG_CLEAR;
+         FLAG_X = XFLAG_CLEAR;
+      }
+      FLAG_N = NFLAG_8(res);	/* Undefined N behavior */
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_nbcd_8_di:
+   {
+      uint ea = EA_AY_DI_8();
+      uint dst = m68ki_read_8(ea);
+      uint res = MASK_OUT_ABOVE_8(0x9a - dst - XFLAG_AS_1());
+
+      m68ki_resolve_flags();
+
+      if(res != 0x9a)
+      {
+         FLAG_V = ~res; /* Undefined V behavior */
+
+         if((res & 0x0f) == 0xa)
+            res = (res & 0xf0) + 0x10;
+
+         res = MASK_OUT_ABOVE_8(res);
+
+         FLAG_V &= res; /* Undefined V behavior part II */
+
+         m68ki_write_8(ea, MASK_OUT_ABOVE_8(res));
+
+         FLAG_Z |= res;
+         FLAG_C = CFLAG_SET;
+         FLAG_X = XFLAG_SET;
+      }
+      else
+      {
+         FLAG_V = VFLAG_CLEAR;
+         FLAG_C = CFLAG_CLEAR;
+         FLAG_X = XFLAG_CLEAR;
+      }
+      FLAG_N = NFLAG_8(res);	/* Undefined N behavior */
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_nbcd_8_ix:
+   {
+      uint ea = EA_AY_IX_8();
+      uint dst = m68ki_read_8(ea);
+      uint res = MASK_OUT_ABOVE_8(0x9a - dst - XFLAG_AS_1());
+
+      m68ki_resolve_flags();
+
+      if(res != 0x9a)
+      {
+         FLAG_V = ~res; /* Undefined V behavior */
+
+         if((res & 0x0f) == 0xa)
+            res = (res & 0xf0) + 0x10;
+
+         res = MASK_OUT_ABOVE_8(res);
+
+         FLAG_V &= res; /* Undefined V behavior part II */
+
+         m68ki_write_8(ea, MASK_OUT_ABOVE_8(res));
+
+         FLAG_Z |= res;
+         FLAG_C = CFLAG_SET;
+         FLAG_X = XFLAG_SET;
+      }
+      else
+      {
+         FLAG_V = VFLAG_CLEAR;
+         FLAG_C = CFLAG_CLEAR;
+         FLAG_X = XFLAG_CLEAR;
+      }
+      FLAG_N = NFLAG_8(res);	/* Undefined N behavior */
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_nbcd_8_aw:
+   {
+      uint ea = EA_AW_8();
+      uint dst = m68ki_read_8(ea);
+      uint res = MASK_OUT_ABOVE_8(0x9a - dst - XFLAG_AS_1());
+
+      m68ki_resolve_flags();
+
+      if(res != 0x9a)
+      {
+         FLAG_V = ~res; /* Undefined V behavior */
+
+         if((res & 0x0f) == 0xa)
+            res = (res & 0xf0) + 0x10;
+
+         res = MASK_OUT_ABOVE_8(res);
+
+         FLAG_V &= res; /* Undefined V behavior part II */
+
+         m68ki_write_8(ea, MASK_OUT_ABOVE_8(res));
+
+         FLAG_Z |= res;
+         FLAG_C = CFLAG_SET;
+         FLAG_X = XFLAG_SET;
+      }
+      else
+      {
+         FLAG_V = VFLAG_CLEAR;
+         FLAG_C = CFLAG_CLEAR;
+         FLAG_X = XFLAG_CLEAR;
+      }
+      FLAG_N = NFLAG_8(res);	/* Undefined N behavior */
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_nbcd_8_al:
+   {
+      uint ea = EA_AL_8();
+      uint dst = m68ki_read_8(ea);
+      uint res = MASK_OUT_ABOVE_8(0x9a - dst - XFLAG_AS_1());
+
+      m68ki_resolve_flags();
+
+      if(res != 0x9a)
+      {
+         FLAG_V = ~res; /* Undefined V behavior */
+
+         if((res & 0x0f) == 0xa)
+            res = (res & 0xf0) + 0x10;
+
+         res = MASK_OUT_ABOVE_8(res);
+
+         FLAG_V &= res; /* Undefined V behavior part II */
+
+         m68ki_write_8(ea, MASK_OUT_ABOVE_8(res));
+
+         FLAG_Z |= res;
+         FLAG_C = CFLAG_SET;
+         FLAG_X = XFLAG_SET;
+      }
+      else
+      {
+         FLAG_V = VFLAG_CLEAR;
+         FLAG_C = CFLAG_CLEAR;
+         FLAG_X = XFLAG_CLEAR;
+      }
+      FLAG_N = NFLAG_8(res);	/* Undefined N behavior */
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_neg_8_d:
+   {
+      uint* r_dst = &DY;
+      uint res = 0 - MASK_OUT_ABOVE_8(*r_dst);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_8(res);
+      FLAG_C = FLAG_X = CFLAG_8(res);
+      FLAG_V = *r_dst & res;
+      FLAG_Z = MASK_OUT_ABOVE_8(res);
+
+      *r_dst = MASK_OUT_BELOW_8(*r_dst) | FLAG_Z;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_neg_8_ai:
+   {
+      uint ea = EA_AY_AI_8();
+      uint src = m68ki_read_8(ea);
+      uint res = 0 - src;
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_8(res);
+      FLAG_C = FLAG_X = CFLAG_8(res);
+      FLAG_V = src & res;
+      FLAG_Z = MASK_OUT_ABOVE_8(res);
+
+      m68ki_write_8(ea, FLAG_Z);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_neg_8_pi:
+   {
+      uint ea = EA_AY_PI_8();
+      uint src = m68ki_read_8(ea);
+      uint res = 0 - src;
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_8(res);
+      FLAG_C = FLAG_X = CFLAG_8(res);
+      FLAG_V = src & res;
+      FLAG_Z = MASK_OUT_ABOVE_8(res);
+
+      m68ki_write_8(ea, FLAG_Z);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_neg_8_pi7:
+   {
+      uint ea = EA_A7_PI_8();
+      uint src = m68ki_read_8(ea);
+      uint res = 0 - src;
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_8(res);
+      FLAG_C = FLAG_X = CFLAG_8(res);
+      FLAG_V = src & res;
+      FLAG_Z = MASK_OUT_ABOVE_8(res);
+
+      m68ki_write_8(ea, FLAG_Z);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_neg_8_pd:
+   {
+      uint ea = EA_AY_PD_8();
+      uint src = m68ki_read_8(ea);
+      uint res = 0 - src;
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_8(res);
+      FLAG_C = FLAG_X = CFLAG_8(res);
+      FLAG_V = src & res;
+      FLAG_Z = MASK_OUT_ABOVE_8(res);
+
+      m68ki_write_8(ea, FLAG_Z);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_neg_8_pd7:
+   {
+      uint ea = EA_A7_PD_8();
+      uint src = m68ki_read_8(ea);
+      uint res = 0 - src;
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_8(res);
+      FLAG_C = FLAG_X = CFLAG_8(res);
+      FLAG_V = src & res;
+      FLAG_Z = MASK_OUT_ABOVE_8(res);
+
+      m68ki_write_8(ea, FLAG_Z);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_neg_8_di:
+   {
+      uint ea = EA_AY_DI_8();
+      uint src = m68ki_read_8(ea);
+      uint res = 0 - src;
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_8(res);
+      FLAG_C = FLAG_X = CFLAG_8(res);
+      FLAG_V = src & res;
+      FLAG_Z = MASK_OUT_ABOVE_8(res);
+
+      m68ki_write_8(ea, FLAG_Z);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_neg_8_ix:
+   {
+      uint ea = EA_AY_IX_8();
+      uint src = m68ki_read_8(ea);
+      uint res = 0 - src;
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_8(res);
+      FLAG_C = FLAG_X = CFLAG_8(res);
+      FLAG_V = src & res;
+      FLAG_Z = MASK_OUT_ABOVE_8(res);
+
+      m68ki_write_8(ea, FLAG_Z);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_neg_8_aw:
+   {
+      uint ea = EA_AW_8();
+      uint src = m68ki_read_8(ea);
+      uint res = 0 - src;
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_8(res);
+      FLAG_C = FLAG_X = CFLAG_8(res);
+      FLAG_V = src & res;
+      FLAG_Z = MASK_OUT_ABOVE_8(res);
+
+      m68ki_write_8(ea, FLAG_Z);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_neg_8_al:
+   {
+      uint ea = EA_AL_8();
+      uint src = m68ki_read_8(ea);
+      uint res = 0 - src;
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_8(res);
+      FLAG_C = FLAG_X = CFLAG_8(res);
+      FLAG_V = src & res;
+      FLAG_Z = MASK_OUT_ABOVE_8(res);
+
+      m68ki_write_8(ea, FLAG_Z);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_neg_16_d:
+   {
+      uint* r_dst = &DY;
+      uint res = 0 - MASK_OUT_ABOVE_16(*r_dst);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_16(res);
+      FLAG_C = FLAG_X = CFLAG_16(res);
+      FLAG_V = (*r_dst & res)>>8;
+      FLAG_Z = MASK_OUT_ABOVE_16(res);
+
+      *r_dst = MASK_OUT_BELOW_16(*r_dst) | FLAG_Z;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_neg_16_ai:
+   {
+      uint ea = EA_AY_AI_16();
+      uint src = m68ki_read_16(ea);
+      uint res = 0 - src;
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_16(res);
+      FLAG_C = FLAG_X = CFLAG_16(res);
+      FLAG_V = (src & res)>>8;
+      FLAG_Z = MASK_OUT_ABOVE_16(res);
+
+      m68ki_write_16(ea, FLAG_Z);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_neg_16_pi:
+   {
+      uint ea = EA_AY_PI_16();
+      uint src = m68ki_read_16(ea);
+      uint res = 0 - src;
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_16(res);
+      FLAG_C = FLAG_X = CFLAG_16(res);
+      FLAG_V = (src & res)>>8;
+      FLAG_Z = MASK_OUT_ABOVE_16(res);
+
+      m68ki_write_16(ea, FLAG_Z);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_neg_16_pd:
+   {
+      uint ea = EA_AY_PD_16();
+      uint src = m68ki_read_16(ea);
+      uint res = 0 - src;
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_16(res);
+      FLAG_C = FLAG_X = CFLAG_16(res);
+      FLAG_V = (src & res)>>8;
+      FLAG_Z = MASK_OUT_ABOVE_16(res);
+
+      m68ki_write_16(ea, FLAG_Z);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_neg_16_di:
+   {
+      uint ea = EA_AY_DI_16();
+      uint src = m68ki_read_16(ea);
+      uint res = 0 - src;
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_16(res);
+      FLAG_C = FLAG_X = CFLAG_16(res);
+      FLAG_V = (src & res)>>8;
+      FLAG_Z = MASK_OUT_ABOVE_16(res);
+
+      m68ki_write_16(ea, FLAG_Z);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_neg_16_ix:
+   {
+      uint ea = EA_AY_IX_16();
+      uint src = m68ki_read_16(ea);
+      uint res = 0 - src;
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_16(res);
+      FLAG_C = FLAG_X = CFLAG_16(res);
+      FLAG_V = (src & res)>>8;
+      FLAG_Z = MASK_OUT_ABOVE_16(res);
+
+      m68ki_write_16(ea, FLAG_Z);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_neg_16_aw:
+   {
+      uint ea = EA_AW_16();
+      uint src = m68ki_read_16(ea);
+      uint res = 0 - src;
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_16(res);
+      FLAG_C = FLAG_X = CFLAG_16(res);
+      FLAG_V = (src & res)>>8;
+      FLAG_Z = MASK_OUT_ABOVE_16(res);
+
+      m68ki_write_16(ea, FLAG_Z);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_neg_16_al:
+   {
+      uint ea = EA_AL_16();
+      uint src = m68ki_read_16(ea);
+      uint res = 0 - src;
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_16(res);
+      FLAG_C = FLAG_X = CFLAG_16(res);
+      FLAG_V = (src & res)>>8;
+      FLAG_Z = MASK_OUT_ABOVE_16(res);
+
+      m68ki_write_16(ea, FLAG_Z);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_neg_32_d:
+   {
+      uint* r_dst = &DY;
+      uint res = 0 - *r_dst;
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_32(res);
+      FLAG_C = FLAG_X = CFLAG_SUB_32(*r_dst, 0, res);
+      FLAG_V = (*r_dst & res)>>24;
+      FLAG_Z = MASK_OUT_ABOVE_32(res);
+
+      *r_dst = FLAG_Z;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_neg_32_ai:
+   {
+      uint ea = EA_AY_AI_32();
+      uint src = m68ki_read_32(ea);
+      uint res = 0 - src;
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_32(res);
+      FLAG_C = FLAG_X = CFLAG_SUB_32(src, 0, res);
+      FLAG_V = (src & res)>>24;
+      FLAG_Z = MASK_OUT_ABOVE_32(res);
+
+      m68ki_write_32(ea, FLAG_Z);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_neg_32_pi:
+   {
+      uint ea = EA_AY_PI_32();
+      uint src = m68ki_read_32(ea);
+      uint res = 0 - src;
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_32(res);
+      FLAG_C = FLAG_X = CFLAG_SUB_32(src, 0, res);
+      FLAG_V = (src & res)>>24;
+      FLAG_Z = MASK_OUT_ABOVE_32(res);
+
+      m68ki_write_32(ea, FLAG_Z);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_neg_32_pd:
+   {
+      uint ea = EA_AY_PD_32();
+      uint src = m68ki_read_32(ea);
+      uint res = 0 - src;
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_32(res);
+      FLAG_C = FLAG_X = CFLAG_SUB_32(src, 0, res);
+      FLAG_V = (src & res)>>24;
+      FLAG_Z = MASK_OUT_ABOVE_32(res);
+
+      m68ki_write_32(ea, FLAG_Z);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_neg_32_di:
+   {
+      uint ea = EA_AY_DI_32();
+      uint src = m68ki_read_32(ea);
+      uint res = 0 - src;
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_32(res);
+      FLAG_C = FLAG_X = CFLAG_SUB_32(src, 0, res);
+      FLAG_V = (src & res)>>24;
+      FLAG_Z = MASK_OUT_ABOVE_32(res);
+
+      m68ki_write_32(ea, FLAG_Z);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_neg_32_ix:
+   {
+      uint ea = EA_AY_IX_32();
+      uint src = m68ki_read_32(ea);
+      uint res = 0 - src;
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_32(res);
+      FLAG_C = FLAG_X = CFLAG_SUB_32(src, 0, res);
+      FLAG_V = (src & res)>>24;
+      FLAG_Z = MASK_OUT_ABOVE_32(res);
+
+      m68ki_write_32(ea, FLAG_Z);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_neg_32_aw:
+   {
+      uint ea = EA_AW_32();
+      uint src = m68ki_read_32(ea);
+      uint res = 0 - src;
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_32(res);
+      FLAG_C = FLAG_X = CFLAG_SUB_32(src, 0, res);
+      FLAG_V = (src & res)>>24;
+      FLAG_Z = MASK_OUT_ABOVE_32(res);
+
+      m68ki_write_32(ea, FLAG_Z);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_neg_32_al:
+   {
+      uint ea = EA_AL_32();
+      uint src = m68ki_read_32(ea);
+      uint res = 0 - src;
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_32(res);
+      FLAG_C = FLAG_X = CFLAG_SUB_32(src, 0, res);
+      FLAG_V = (src & res)>>24;
+      FLAG_Z = MASK_OUT_ABOVE_32(res);
+
+      m68ki_write_32(ea, FLAG_Z);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_negx_8_d:
+   {
+      uint* r_dst = &DY;
+      uint res = 0 - MASK_OUT_ABOVE_8(*r_dst) - XFLAG_AS_1();
+
+      m68ki_resolve_flags();
+
+      FLAG_N = NFLAG_8(res);
+      FLAG_X = FLAG_C = CFLAG_8(res);
+      FLAG_V = *r_dst & res;
+
+      res = MASK_OUT_ABOVE_8(res);
+      FLAG_Z |= res;
+
+      *r_dst = MASK_OUT_BELOW_8(*r_dst) | res;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_negx_8_ai:
+   {
+      uint ea = EA_AY_AI_8();
+      uint src = m68ki_read_8(ea);
+      uint res = 0 - src - XFLAG_AS_1();
+
+      m68ki_resolve_flags();
+
+      FLAG_N = NFLAG_8(res);
+      FLAG_X = FLAG_C = CFLAG_8(res);
+      FLAG_V = src & res;
+
+      res = MASK_OUT_ABOVE_8(res);
+      FLAG_Z |= res;
+
+      m68ki_write_8(ea, res);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_negx_8_pi:
+   {
+      uint ea = EA_AY_PI_8();
+      uint src = m68ki_read_8(ea);
+      uint res = 0 - src - XFLAG_AS_1();
+
+      m68ki_resolve_flags();
+
+      FLAG_N = NFLAG_8(res);
+      FLAG_X = FLAG_C = CFLAG_8(res);
+      FLAG_V = src & res;
+
+      res = MASK_OUT_ABOVE_8(res);
+      FLAG_Z |= res;
+
+      m68ki_write_8(ea, res);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_negx_8_pi7:
+   {
+      uint ea = EA_A7_PI_8();
+      uint src = m68ki_read_8(ea);
+      uint res = 0 - src - XFLAG_AS_1();
+
+      m68ki_resolve_flags();
+
+      FLAG_N = NFLAG_8(res);
+      FLAG_X = FLAG_C = CFLAG_8(res);
+      FLAG_V = src & res;
+
+      res = MASK_OUT_ABOVE_8(res);
+      FLAG_Z |= res;
+
+      m68ki_write_8(ea, res);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_negx_8_pd:
+   {
+      uint ea = EA_AY_PD_8();
+      uint src = m68ki_read_8(ea);
+      uint res = 0 - src - XFLAG_AS_1();
+
+      m68ki_resolve_flags();
+
+      FLAG_N = NFLAG_8(res);
+      FLAG_X = FLAG_C = CFLAG_8(res);
+      FLAG_V = src & res;
+
+      res = MASK_OUT_ABOVE_8(res);
+      FLAG_Z |= res;
+
+      m68ki_write_8(ea, res);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_negx_8_pd7:
+   {
+      uint ea = EA_A7_PD_8();
+      uint src = m68ki_read_8(ea);
+      uint res = 0 - src - XFLAG_AS_1();
+
+      m68ki_resolve_flags();
+
+      FLAG_N = NFLAG_8(res);
+      FLAG_X = FLAG_C = CFLAG_8(res);
+      FLAG_V = src & res;
+
+      res = MASK_OUT_ABOVE_8(res);
+      FLAG_Z |= res;
+
+      m68ki_write_8(ea, res);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_negx_8_di:
+   {
+      uint ea = EA_AY_DI_8();
+      uint src = m68ki_read_8(ea);
+      uint res = 0 - src - XFLAG_AS_1();
+
+      m68ki_resolve_flags();
+
+      FLAG_N = NFLAG_8(res);
+      FLAG_X = FLAG_C = CFLAG_8(res);
+      FLAG_V = src & res;
+
+      res = MASK_OUT_ABOVE_8(res);
+      FLAG_Z |= res;
+
+      m68ki_write_8(ea, res);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_negx_8_ix:
+   {
+      uint ea = EA_AY_IX_8();
+      uint src = m68ki_read_8(ea);
+      uint res = 0 - src - XFLAG_AS_1();
+
+      m68ki_resolve_flags();
+
+      FLAG_N = NFLAG_8(res);
+      FLAG_X = FLAG_C = CFLAG_8(res);
+      FLAG_V = src & res;
+
+      res = MASK_OUT_ABOVE_8(res);
+      FLAG_Z |= res;
+
+      m68ki_write_8(ea, res);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_negx_8_aw:
+   {
+      uint ea = EA_AW_8();
+      uint src = m68ki_read_8(ea);
+      uint res = 0 - src - XFLAG_AS_1();
+
+      m68ki_resolve_flags();
+
+      FLAG_N = NFLAG_8(res);
+      FLAG_X = FLAG_C = CFLAG_8(res);
+      FLAG_V = src & res;
+
+      res = MASK_OUT_ABOVE_8(res);
+      FLAG_Z |= res;
+
+      m68ki_write_8(ea, res);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_negx_8_al:
+   {
+      uint ea = EA_AL_8();
+      uint src = m68ki_read_8(ea);
+      uint res = 0 - src - XFLAG_AS_1();
+
+      m68ki_resolve_flags();
+
+      FLAG_N = NFLAG_8(res);
+      FLAG_X = FLAG_C = CFLAG_8(res);
+      FLAG_V = src & res;
+
+      res = MASK_OUT_ABOVE_8(res);
+      FLAG_Z |= res;
+
+      m68ki_write_8(ea, res);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_negx_16_d:
+   {
+      uint* r_dst = &DY;
+      uint res = 0 - MASK_OUT_ABOVE_16(*r_dst) - XFLAG_AS_1();
+
+      m68ki_resolve_flags();
+
+      FLAG_N = NFLAG_16(res);
+      FLAG_X = FLAG_C = CFLAG_16(res);
+      FLAG_V = (*r_dst & res)>>8;
+
+      res = MASK_OUT_ABOVE_16(res);
+      FLAG_Z |= res;
+
+      *r_dst = MASK_OUT_BELOW_16(*r_dst) | res;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_negx_16_ai:
+   {
+      uint ea  = EA_AY_AI_16();
+      uint src = m68ki_read_16(ea);
+      uint res = 0 - MASK_OUT_ABOVE_16(src) - XFLAG_AS_1();
+
+      m68ki_resolve_flags();
+
+      FLAG_N = NFLAG_16(res);
+      FLAG_X = FLAG_C = CFLAG_16(res);
+      FLAG_V = (src & res)>>8;
+
+      res = MASK_OUT_ABOVE_16(res);
+      FLAG_Z |= res;
+
+      m68ki_write_16(ea, res);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_negx_16_pi:
+   {
+      uint ea  = EA_AY_PI_16();
+      uint src = m68ki_read_16(ea);
+      uint res = 0 - MASK_OUT_ABOVE_16(src) - XFLAG_AS_1();
+
+      m68ki_resolve_flags();
+
+      FLAG_N = NFLAG_16(res);
+      FLAG_X = FLAG_C = CFLAG_16(res);
+      FLAG_V = (src & res)>>8;
+
+      res = MASK_OUT_ABOVE_16(res);
+      FLAG_Z |= res;
+
+      m68ki_write_16(ea, res);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_negx_16_pd:
+   {
+      uint ea  = EA_AY_PD_16();
+      uint src = m68ki_read_16(ea);
+      uint res = 0 - MASK_OUT_ABOVE_16(src) - XFLAG_AS_1();
+
+      m68ki_resolve_flags();
+
+      FLAG_N = NFLAG_16(res);
+      FLAG_X = FLAG_C = CFLAG_16(res);
+      FLAG_V = (src & res)>>8;
+
+      res = MASK_OUT_ABOVE_16(res);
+      FLAG_Z |= res;
+
+      m68ki_write_16(ea, res);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_negx_16_di:
+   {
+      uint ea  = EA_AY_DI_16();
+      uint src = m68ki_read_16(ea);
+      uint res = 0 - MASK_OUT_ABOVE_16(src) - XFLAG_AS_1();
+
+      m68ki_resolve_flags();
+
+      FLAG_N = NFLAG_16(res);
+      FLAG_X = FLAG_C = CFLAG_16(res);
+      FLAG_V = (src & res)>>8;
+
+      res = MASK_OUT_ABOVE_16(res);
+      FLAG_Z |= res;
+
+      m68ki_write_16(ea, res);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_negx_16_ix:
+   {
+      uint ea  = EA_AY_IX_16();
+      uint src = m68ki_read_16(ea);
+      uint res = 0 - MASK_OUT_ABOVE_16(src) - XFLAG_AS_1();
+
+      m68ki_resolve_flags();
+
+      FLAG_N = NFLAG_16(res);
+      FLAG_X = FLAG_C = CFLAG_16(res);
+      FLAG_V = (src & res)>>8;
+
+      res = MASK_OUT_ABOVE_16(res);
+      FLAG_Z |= res;
+
+      m68ki_write_16(ea, res);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_negx_16_aw:
+   {
+      uint ea  = EA_AW_16();
+      uint src = m68ki_read_16(ea);
+      uint res = 0 - MASK_OUT_ABOVE_16(src) - XFLAG_AS_1();
+
+      m68ki_resolve_flags();
+
+      FLAG_N = NFLAG_16(res);
+      FLAG_X = FLAG_C = CFLAG_16(res);
+      FLAG_V = (src & res)>>8;
+
+      res = MASK_OUT_ABOVE_16(res);
+      FLAG_Z |= res;
+
+      m68ki_write_16(ea, res);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_negx_16_al:
+   {
+      uint ea  = EA_AL_16();
+      uint src = m68ki_read_16(ea);
+      uint res = 0 - MASK_OUT_ABOVE_16(src) - XFLAG_AS_1();
+
+      m68ki_resolve_flags();
+
+      FLAG_N = NFLAG_16(res);
+      FLAG_X = FLAG_C = CFLAG_16(res);
+      FLAG_V = (src & res)>>8;
+
+      res = MASK_OUT_ABOVE_16(res);
+      FLAG_Z |= res;
+
+      m68ki_write_16(ea, res);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_negx_32_d:
+   {
+      uint* r_dst = &DY;
+      uint res = 0 - MASK_OUT_ABOVE_32(*r_dst) - XFLAG_AS_1();
+
+      m68ki_resolve_flags();
+
+      FLAG_N = NFLAG_32(res);
+      FLAG_X = FLAG_C = CFLAG_SUB_32(*r_dst, 0, res);
+      FLAG_V = (*r_dst & res)>>24;
+
+      res = MASK_OUT_ABOVE_32(res);
+      FLAG_Z |= res;
+
+      *r_dst = res;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_negx_32_ai:
+   {
+      uint ea  = EA_AY_AI_32();
+      uint src = m68ki_read_32(ea);
+      uint res = 0 - MASK_OUT_ABOVE_32(src) - XFLAG_AS_1();
+
+      m68ki_resolve_flags();
+
+      FLAG_N = NFLAG_32(res);
+      FLAG_X = FLAG_C = CFLAG_SUB_32(src, 0, res);
+      FLAG_V = (src & res)>>24;
+
+      res = MASK_OUT_ABOVE_32(res);
+      FLAG_Z |= res;
+
+      m68ki_write_32(ea, res);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_negx_32_pi:
+   {
+      uint ea  = EA_AY_PI_32();
+      uint src = m68ki_read_32(ea);
+      uint res = 0 - MASK_OUT_ABOVE_32(src) - XFLAG_AS_1();
+
+      m68ki_resolve_flags();
+
+      FLAG_N = NFLAG_32(res);
+      FLAG_X = FLAG_C = CFLAG_SUB_32(src, 0, res);
+      FLAG_V = (src & res)>>24;
+
+      res = MASK_OUT_ABOVE_32(res);
+      FLAG_Z |= res;
+
+      m68ki_write_32(ea, res);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_negx_32_pd:
+   {
+      uint ea  = EA_AY_PD_32();
+      uint src = m68ki_read_32(ea);
+      uint res = 0 - MASK_OUT_ABOVE_32(src) - XFLAG_AS_1();
+
+      m68ki_resolve_flags();
+
+      FLAG_N = NFLAG_32(res);
+      FLAG_X = FLAG_C = CFLAG_SUB_32(src, 0, res);
+      FLAG_V = (src & res)>>24;
+
+      res = MASK_OUT_ABOVE_32(res);
+      FLAG_Z |= res;
+
+      m68ki_write_32(ea, res);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_negx_32_di:
+   {
+      uint ea  = EA_AY_DI_32();
+      uint src = m68ki_read_32(ea);
+      uint res = 0 - MASK_OUT_ABOVE_32(src) - XFLAG_AS_1();
+
+      m68ki_resolve_flags();
+
+      FLAG_N = NFLAG_32(res);
+      FLAG_X = FLAG_C = CFLAG_SUB_32(src, 0, res);
+      FLAG_V = (src & res)>>24;
+
+      res = MASK_OUT_ABOVE_32(res);
+      FLAG_Z |= res;
+
+      m68ki_write_32(ea, res);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_negx_32_ix:
+   {
+      uint ea  = EA_AY_IX_32();
+      uint src = m68ki_read_32(ea);
+      uint res = 0 - MASK_OUT_ABOVE_32(src) - XFLAG_AS_1();
+
+      m68ki_resolve_flags();
+
+      FLAG_N = NFLAG_32(res);
+      FLAG_X = FLAG_C = CFLAG_SUB_32(src, 0, res);
+      FLAG_V = (src & res)>>24;
+
+      res = MASK_OUT_ABOVE_32(res);
+      FLAG_Z |= res;
+
+      m68ki_write_32(ea, res);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_negx_32_aw:
+   {
+      uint ea  = EA_AW_32();
+      uint src = m68ki_read_32(ea);
+      uint res = 0 - MASK_OUT_ABOVE_32(src) - XFLAG_AS_1();
+
+      m68ki_resolve_flags();
+
+      FLAG_N = NFLAG_32(res);
+      FLAG_X = FLAG_C = CFLAG_SUB_32(src, 0, res);
+      FLAG_V = (src & res)>>24;
+
+      res = MASK_OUT_ABOVE_32(res);
+      FLAG_Z |= res;
+
+      m68ki_write_32(ea, res);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_negx_32_al:
+   {
+      uint ea  = EA_AL_32();
+      uint src = m68ki_read_32(ea);
+      uint res = 0 - MASK_OUT_ABOVE_32(src) - XFLAG_AS_1();
+
+      m68ki_resolve_flags();
+
+      FLAG_N = NFLAG_32(res);
+      FLAG_X = FLAG_C = CFLAG_SUB_32(src, 0, res);
+      FLAG_V = (src & res)>>24;
+
+      res = MASK_OUT_ABOVE_32(res);
+      FLAG_Z |= res;
+
+      m68ki_write_32(ea, res);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_nop:
+   {
+      m68ki_trace_t0();				   /* auto-disable (see m68kcpu.h) */
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_not_8_d:
+   {
+      uint* r_dst = &DY;
+      uint res = MASK_OUT_ABOVE_8(~*r_dst);
+
+      *r_dst = MASK_OUT_BELOW_8(*r_dst) | res;
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_8(res);
+      FLAG_Z = res;
+      FLAG_C = CFLAG_CLEAR;
+      FLAG_V = VFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_not_8_ai:
+   {
+      uint ea = EA_AY_AI_8();
+      uint res = MASK_OUT_ABOVE_8(~m68ki_read_8(ea));
+
+      m68ki_write_8(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_8(res);
+      FLAG_Z = res;
+      FLAG_C = CFLAG_CLEAR;
+      FLAG_V = VFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_not_8_pi:
+   {
+      uint ea = EA_AY_PI_8();
+      uint res = MASK_OUT_ABOVE_8(~m68ki_read_8(ea));
+
+      m68ki_write_8(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_8(res);
+      FLAG_Z = res;
+      FLAG_C = CFLAG_CLEAR;
+      FLAG_V = VFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_not_8_pi7:
+   {
+      uint ea = EA_A7_PI_8();
+      uint res = MASK_OUT_ABOVE_8(~m68ki_read_8(ea));
+
+      m68ki_write_8(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_8(res);
+      FLAG_Z = res;
+      FLAG_C = CFLAG_CLEAR;
+      FLAG_V = VFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_not_8_pd:
+   {
+      uint ea = EA_AY_PD_8();
+      uint res = MASK_OUT_ABOVE_8(~m68ki_read_8(ea));
+
+      m68ki_write_8(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_8(res);
+      FLAG_Z = res;
+      FLAG_C = CFLAG_CLEAR;
+      FLAG_V = VFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_not_8_pd7:
+   {
+      uint ea = EA_A7_PD_8();
+      uint res = MASK_OUT_ABOVE_8(~m68ki_read_8(ea));
+
+      m68ki_write_8(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_8(res);
+      FLAG_Z = res;
+      FLAG_C = CFLAG_CLEAR;
+      FLAG_V = VFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_not_8_di:
+   {
+      uint ea = EA_AY_DI_8();
+      uint res = MASK_OUT_ABOVE_8(~m68ki_read_8(ea));
+
+      m68ki_write_8(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_8(res);
+      FLAG_Z = res;
+      FLAG_C = CFLAG_CLEAR;
+      FLAG_V = VFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_not_8_ix:
+   {
+      uint ea = EA_AY_IX_8();
+      uint res = MASK_OUT_ABOVE_8(~m68ki_read_8(ea));
+
+      m68ki_write_8(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_8(res);
+      FLAG_Z = res;
+      FLAG_C = CFLAG_CLEAR;
+      FLAG_V = VFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_not_8_aw:
+   {
+      uint ea = EA_AW_8();
+      uint res = MASK_OUT_ABOVE_8(~m68ki_read_8(ea));
+
+      m68ki_write_8(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_8(res);
+      FLAG_Z = res;
+      FLAG_C = CFLAG_CLEAR;
+      FLAG_V = VFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_not_8_al:
+   {
+      uint ea = EA_AL_8();
+      uint res = MASK_OUT_ABOVE_8(~m68ki_read_8(ea));
+
+      m68ki_write_8(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_8(res);
+      FLAG_Z = res;
+      FLAG_C = CFLAG_CLEAR;
+      FLAG_V = VFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_not_16_d:
+   {
+      uint* r_dst = &DY;
+      uint res = MASK_OUT_ABOVE_16(~*r_dst);
+
+      *r_dst = MASK_OUT_BELOW_16(*r_dst) | res;
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_16(res);
+      FLAG_Z = res;
+      FLAG_C = CFLAG_CLEAR;
+      FLAG_V = VFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_not_16_ai:
+   {
+      uint ea = EA_AY_AI_16();
+      uint res = MASK_OUT_ABOVE_16(~m68ki_read_16(ea));
+
+      m68ki_write_16(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_16(res);
+      FLAG_Z = res;
+      FLAG_C = CFLAG_CLEAR;
+      FLAG_V = VFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_not_16_pi:
+   {
+      uint ea = EA_AY_PI_16();
+      uint res = MASK_OUT_ABOVE_16(~m68ki_read_16(ea));
+
+      m68ki_write_16(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_16(res);
+      FLAG_Z = res;
+      FLAG_C = CFLAG_CLEAR;
+      FLAG_V = VFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_not_16_pd:
+   {
+      uint ea = EA_AY_PD_16();
+      uint res = MASK_OUT_ABOVE_16(~m68ki_read_16(ea));
+
+      m68ki_write_16(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_16(res);
+      FLAG_Z = res;
+      FLAG_C = CFLAG_CLEAR;
+      FLAG_V = VFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_not_16_di:
+   {
+      uint ea = EA_AY_DI_16();
+      uint res = MASK_OUT_ABOVE_16(~m68ki_read_16(ea));
+
+      m68ki_write_16(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_16(res);
+      FLAG_Z = res;
+      FLAG_C = CFLAG_CLEAR;
+      FLAG_V = VFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_not_16_ix:
+   {
+      uint ea = EA_AY_IX_16();
+      uint res = MASK_OUT_ABOVE_16(~m68ki_read_16(ea));
+
+      m68ki_write_16(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_16(res);
+      FLAG_Z = res;
+      FLAG_C = CFLAG_CLEAR;
+      FLAG_V = VFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_not_16_aw:
+   {
+      uint ea = EA_AW_16();
+      uint res = MASK_OUT_ABOVE_16(~m68ki_read_16(ea));
+
+      m68ki_write_16(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_16(res);
+      FLAG_Z = res;
+      FLAG_C = CFLAG_CLEAR;
+      FLAG_V = VFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_not_16_al:
+   {
+      uint ea = EA_AL_16();
+      uint res = MASK_OUT_ABOVE_16(~m68ki_read_16(ea));
+
+      m68ki_write_16(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_16(res);
+      FLAG_Z = res;
+      FLAG_C = CFLAG_CLEAR;
+      FLAG_V = VFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_not_32_d:
+   {
+      uint* r_dst = &DY;
+      uint res = *r_dst = MASK_OUT_ABOVE_32(~*r_dst);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_32(res);
+      FLAG_Z = res;
+      FLAG_C = CFLAG_CLEAR;
+      FLAG_V = VFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_not_32_ai:
+   {
+      uint ea = EA_AY_AI_32();
+      uint res = MASK_OUT_ABOVE_32(~m68ki_read_32(ea));
+
+      m68ki_write_32(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_32(res);
+      FLAG_Z = res;
+      FLAG_C = CFLAG_CLEAR;
+      FLAG_V = VFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_not_32_pi:
+   {
+      uint ea = EA_AY_PI_32();
+      uint res = MASK_OUT_ABOVE_32(~m68ki_read_32(ea));
+
+      m68ki_write_32(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_32(res);
+      FLAG_Z = res;
+      FLAG_C = CFLAG_CLEAR;
+      FLAG_V = VFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_not_32_pd:
+   {
+      uint ea = EA_AY_PD_32();
+      uint res = MASK_OUT_ABOVE_32(~m68ki_read_32(ea));
+
+      m68ki_write_32(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_32(res);
+      FLAG_Z = res;
+      FLAG_C = CFLAG_CLEAR;
+      FLAG_V = VFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_not_32_di:
+   {
+      uint ea = EA_AY_DI_32();
+      uint res = MASK_OUT_ABOVE_32(~m68ki_read_32(ea));
+
+      m68ki_write_32(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_32(res);
+      FLAG_Z = res;
+      FLAG_C = CFLAG_CLEAR;
+      FLAG_V = VFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_not_32_ix:
+   {
+      uint ea = EA_AY_IX_32();
+      uint res = MASK_OUT_ABOVE_32(~m68ki_read_32(ea));
+
+      m68ki_write_32(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_32(res);
+      FLAG_Z = res;
+      FLAG_C = CFLAG_CLEAR;
+      FLAG_V = VFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_not_32_aw:
+   {
+      uint ea = EA_AW_32();
+      uint res = MASK_OUT_ABOVE_32(~m68ki_read_32(ea));
+
+      m68ki_write_32(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_32(res);
+      FLAG_Z = res;
+      FLAG_C = CFLAG_CLEAR;
+      FLAG_V = VFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_not_32_al:
+   {
+      uint ea = EA_AL_32();
+      uint res = MASK_OUT_ABOVE_32(~m68ki_read_32(ea));
+
+      m68ki_write_32(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_32(res);
+      FLAG_Z = res;
+      FLAG_C = CFLAG_CLEAR;
+      FLAG_V = VFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_or_8_er_d:
+   {
+      uint res = MASK_OUT_ABOVE_8((DX |= MASK_OUT_ABOVE_8(DY)));
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_8(res);
+      FLAG_Z = res;
+      FLAG_C = CFLAG_CLEAR;
+      FLAG_V = VFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_or_8_er_ai:
+   {
+      uint res = MASK_OUT_ABOVE_8((DX |= OPER_AY_AI_8()));
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_8(res);
+      FLAG_Z = res;
+      FLAG_C = CFLAG_CLEAR;
+      FLAG_V = VFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_or_8_er_pi:
+   {
+      uint res = MASK_OUT_ABOVE_8((DX |= OPER_AY_PI_8()));
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_8(res);
+      FLAG_Z = res;
+      FLAG_C = CFLAG_CLEAR;
+      FLAG_V = VFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_or_8_er_pi7:
+   {
+      uint res = MASK_OUT_ABOVE_8((DX |= OPER_A7_PI_8()));
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_8(res);
+      FLAG_Z = res;
+      FLAG_C = CFLAG_CLEAR;
+      FLAG_V = VFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_or_8_er_pd:
+   {
+      uint res = MASK_OUT_ABOVE_8((DX |= OPER_AY_PD_8()));
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_8(res);
+      FLAG_Z = res;
+      FLAG_C = CFLAG_CLEAR;
+      FLAG_V = VFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_or_8_er_pd7:
+   {
+      uint res = MASK_OUT_ABOVE_8((DX |= OPER_A7_PD_8()));
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_8(res);
+      FLAG_Z = res;
+      FLAG_C = CFLAG_CLEAR;
+      FLAG_V = VFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_or_8_er_di:
+   {
+      uint res = MASK_OUT_ABOVE_8((DX |= OPER_AY_DI_8()));
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_8(res);
+      FLAG_Z = res;
+      FLAG_C = CFLAG_CLEAR;
+      FLAG_V = VFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_or_8_er_ix:
+   {
+      uint res = MASK_OUT_ABOVE_8((DX |= OPER_AY_IX_8()));
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_8(res);
+      FLAG_Z = res;
+      FLAG_C = CFLAG_CLEAR;
+      FLAG_V = VFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_or_8_er_aw:
+   {
+      uint res = MASK_OUT_ABOVE_8((DX |= OPER_AW_8()));
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_8(res);
+      FLAG_Z = res;
+      FLAG_C = CFLAG_CLEAR;
+      FLAG_V = VFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_or_8_er_al:
+   {
+      uint res = MASK_OUT_ABOVE_8((DX |= OPER_AL_8()));
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_8(res);
+      FLAG_Z = res;
+      FLAG_C = CFLAG_CLEAR;
+      FLAG_V = VFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_or_8_er_pcdi:
+   {
+      uint res = MASK_OUT_ABOVE_8((DX |= OPER_PCDI_8()));
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_8(res);
+      FLAG_Z = res;
+      FLAG_C = CFLAG_CLEAR;
+      FLAG_V = VFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_or_8_er_pcix:
+   {
+      uint res = MASK_OUT_ABOVE_8((DX |= OPER_PCIX_8()));
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_8(res);
+      FLAG_Z = res;
+      FLAG_C = CFLAG_CLEAR;
+      FLAG_V = VFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_or_8_er_i:
+   {
+      uint res = MASK_OUT_ABOVE_8((DX |= OPER_I_8()));
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_8(res);
+      FLAG_Z = res;
+      FLAG_C = CFLAG_CLEAR;
+      FLAG_V = VFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_or_16_er_d:
+   {
+      uint res = MASK_OUT_ABOVE_16((DX |= MASK_OUT_ABOVE_16(DY)));
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_16(res);
+      FLAG_Z = res;
+      FLAG_C = CFLAG_CLEAR;
+      FLAG_V = VFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_or_16_er_ai:
+   {
+      uint res = MASK_OUT_ABOVE_16((DX |= OPER_AY_AI_16()));
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_16(res);
+      FLAG_Z = res;
+      FLAG_C = CFLAG_CLEAR;
+      FLAG_V = VFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_or_16_er_pi:
+   {
+      uint res = MASK_OUT_ABOVE_16((DX |= OPER_AY_PI_16()));
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_16(res);
+      FLAG_Z = res;
+      FLAG_C = CFLAG_CLEAR;
+      FLAG_V = VFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_or_16_er_pd:
+   {
+      uint res = MASK_OUT_ABOVE_16((DX |= OPER_AY_PD_16()));
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_16(res);
+      FLAG_Z = res;
+      FLAG_C = CFLAG_CLEAR;
+      FLAG_V = VFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_or_16_er_di:
+   {
+      uint res = MASK_OUT_ABOVE_16((DX |= OPER_AY_DI_16()));
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_16(res);
+      FLAG_Z = res;
+      FLAG_C = CFLAG_CLEAR;
+      FLAG_V = VFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_or_16_er_ix:
+   {
+      uint res = MASK_OUT_ABOVE_16((DX |= OPER_AY_IX_16()));
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_16(res);
+      FLAG_Z = res;
+      FLAG_C = CFLAG_CLEAR;
+      FLAG_V = VFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_or_16_er_aw:
+   {
+      uint res = MASK_OUT_ABOVE_16((DX |= OPER_AW_16()));
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_16(res);
+      FLAG_Z = res;
+      FLAG_C = CFLAG_CLEAR;
+      FLAG_V = VFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_or_16_er_al:
+   {
+      uint res = MASK_OUT_ABOVE_16((DX |= OPER_AL_16()));
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_16(res);
+      FLAG_Z = res;
+      FLAG_C = CFLAG_CLEAR;
+      FLAG_V = VFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_or_16_er_pcdi:
+   {
+      uint res = MASK_OUT_ABOVE_16((DX |= OPER_PCDI_16()));
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_16(res);
+      FLAG_Z = res;
+      FLAG_C = CFLAG_CLEAR;
+      FLAG_V = VFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_or_16_er_pcix:
+   {
+      uint res = MASK_OUT_ABOVE_16((DX |= OPER_PCIX_16()));
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_16(res);
+      FLAG_Z = res;
+      FLAG_C = CFLAG_CLEAR;
+      FLAG_V = VFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_or_16_er_i:
+   {
+      uint res = MASK_OUT_ABOVE_16((DX |= OPER_I_16()));
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_16(res);
+      FLAG_Z = res;
+      FLAG_C = CFLAG_CLEAR;
+      FLAG_V = VFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_or_32_er_d:
+   {
+      uint res = DX |= DY;
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_32(res);
+      FLAG_Z = res;
+      FLAG_C = CFLAG_CLEAR;
+      FLAG_V = VFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_or_32_er_ai:
+   {
+      uint res = DX |= OPER_AY_AI_32();
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_32(res);
+      FLAG_Z = res;
+      FLAG_C = CFLAG_CLEAR;
+      FLAG_V = VFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_or_32_er_pi:
+   {
+      uint res = DX |= OPER_AY_PI_32();
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_32(res);
+      FLAG_Z = res;
+      FLAG_C = CFLAG_CLEAR;
+      FLAG_V = VFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_or_32_er_pd:
+   {
+      uint res = DX |= OPER_AY_PD_32();
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_32(res);
+      FLAG_Z = res;
+      FLAG_C = CFLAG_CLEAR;
+      FLAG_V = VFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_or_32_er_di:
+   {
+      uint res = DX |= OPER_AY_DI_32();
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_32(res);
+      FLAG_Z = res;
+      FLAG_C = CFLAG_CLEAR;
+      FLAG_V = VFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_or_32_er_ix:
+   {
+      uint res = DX |= OPER_AY_IX_32();
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_32(res);
+      FLAG_Z = res;
+      FLAG_C = CFLAG_CLEAR;
+      FLAG_V = VFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_or_32_er_aw:
+   {
+      uint res = DX |= OPER_AW_32();
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_32(res);
+      FLAG_Z = res;
+      FLAG_C = CFLAG_CLEAR;
+      FLAG_V = VFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_or_32_er_al:
+   {
+      uint res = DX |= OPER_AL_32();
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_32(res);
+      FLAG_Z = res;
+      FLAG_C = CFLAG_CLEAR;
+      FLAG_V = VFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_or_32_er_pcdi:
+   {
+      uint res = DX |= OPER_PCDI_32();
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_32(res);
+      FLAG_Z = res;
+      FLAG_C = CFLAG_CLEAR;
+      FLAG_V = VFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_or_32_er_pcix:
+   {
+      uint res = DX |= OPER_PCIX_32();
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_32(res);
+      FLAG_Z = res;
+      FLAG_C = CFLAG_CLEAR;
+      FLAG_V = VFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_or_32_er_i:
+   {
+      uint res = DX |= OPER_I_32();
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_32(res);
+      FLAG_Z = res;
+      FLAG_C = CFLAG_CLEAR;
+      FLAG_V = VFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_or_8_re_ai:
+   {
+      uint ea = EA_AY_AI_8();
+      uint res = MASK_OUT_ABOVE_8(DX | m68ki_read_8(ea));
+
+      m68ki_write_8(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_8(res);
+      FLAG_Z = res;
+      FLAG_C = CFLAG_CLEAR;
+      FLAG_V = VFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_or_8_re_pi:
+   {
+      uint ea = EA_AY_PI_8();
+      uint res = MASK_OUT_ABOVE_8(DX | m68ki_read_8(ea));
+
+      m68ki_write_8(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_8(res);
+      FLAG_Z = res;
+      FLAG_C = CFLAG_CLEAR;
+      FLAG_V = VFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_or_8_re_pi7:
+   {
+      uint ea = EA_A7_PI_8();
+      uint res = MASK_OUT_ABOVE_8(DX | m68ki_read_8(ea));
+
+      m68ki_write_8(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_8(res);
+      FLAG_Z = res;
+      FLAG_C = CFLAG_CLEAR;
+      FLAG_V = VFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_or_8_re_pd:
+   {
+      uint ea = EA_AY_PD_8();
+      uint res = MASK_OUT_ABOVE_8(DX | m68ki_read_8(ea));
+
+      m68ki_write_8(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_8(res);
+      FLAG_Z = res;
+      FLAG_C = CFLAG_CLEAR;
+      FLAG_V = VFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_or_8_re_pd7:
+   {
+      uint ea = EA_A7_PD_8();
+      uint res = MASK_OUT_ABOVE_8(DX | m68ki_read_8(ea));
+
+      m68ki_write_8(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_8(res);
+      FLAG_Z = res;
+      FLAG_C = CFLAG_CLEAR;
+      FLAG_V = VFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_or_8_re_di:
+   {
+      uint ea = EA_AY_DI_8();
+      uint res = MASK_OUT_ABOVE_8(DX | m68ki_read_8(ea));
+
+      m68ki_write_8(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_8(res);
+      FLAG_Z = res;
+      FLAG_C = CFLAG_CLEAR;
+      FLAG_V = VFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_or_8_re_ix:
+   {
+      uint ea = EA_AY_IX_8();
+      uint res = MASK_OUT_ABOVE_8(DX | m68ki_read_8(ea));
+
+      m68ki_write_8(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_8(res);
+      FLAG_Z = res;
+      FLAG_C = CFLAG_CLEAR;
+      FLAG_V = VFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_or_8_re_aw:
+   {
+      uint ea = EA_AW_8();
+      uint res = MASK_OUT_ABOVE_8(DX | m68ki_read_8(ea));
+
+      m68ki_write_8(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_8(res);
+      FLAG_Z = res;
+      FLAG_C = CFLAG_CLEAR;
+      FLAG_V = VFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_or_8_re_al:
+   {
+      uint ea = EA_AL_8();
+      uint res = MASK_OUT_ABOVE_8(DX | m68ki_read_8(ea));
+
+      m68ki_write_8(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_8(res);
+      FLAG_Z = res;
+      FLAG_C = CFLAG_CLEAR;
+      FLAG_V = VFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_or_16_re_ai:
+   {
+      uint ea = EA_AY_AI_16();
+      uint res = MASK_OUT_ABOVE_16(DX | m68ki_read_16(ea));
+
+      m68ki_write_16(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_16(res);
+      FLAG_Z = res;
+      FLAG_C = CFLAG_CLEAR;
+      FLAG_V = VFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_or_16_re_pi:
+   {
+      uint ea = EA_AY_PI_16();
+      uint res = MASK_OUT_ABOVE_16(DX | m68ki_read_16(ea));
+
+      m68ki_write_16(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_16(res);
+      FLAG_Z = res;
+      FLAG_C = CFLAG_CLEAR;
+      FLAG_V = VFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_or_16_re_pd:
+   {
+      uint ea = EA_AY_PD_16();
+      uint res = MASK_OUT_ABOVE_16(DX | m68ki_read_16(ea));
+
+      m68ki_write_16(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_16(res);
+      FLAG_Z = res;
+      FLAG_C = CFLAG_CLEAR;
+      FLAG_V = VFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_or_16_re_di:
+   {
+      uint ea = EA_AY_DI_16();
+      uint res = MASK_OUT_ABOVE_16(DX | m68ki_read_16(ea));
+
+      m68ki_write_16(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_16(res);
+      FLAG_Z = res;
+      FLAG_C = CFLAG_CLEAR;
+      FLAG_V = VFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_or_16_re_ix:
+   {
+      uint ea = EA_AY_IX_16();
+      uint res = MASK_OUT_ABOVE_16(DX | m68ki_read_16(ea));
+
+      m68ki_write_16(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_16(res);
+      FLAG_Z = res;
+      FLAG_C = CFLAG_CLEAR;
+      FLAG_V = VFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_or_16_re_aw:
+   {
+      uint ea = EA_AW_16();
+      uint res = MASK_OUT_ABOVE_16(DX | m68ki_read_16(ea));
+
+      m68ki_write_16(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_16(res);
+      FLAG_Z = res;
+      FLAG_C = CFLAG_CLEAR;
+      FLAG_V = VFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_or_16_re_al:
+   {
+      uint ea = EA_AL_16();
+      uint res = MASK_OUT_ABOVE_16(DX | m68ki_read_16(ea));
+
+      m68ki_write_16(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_16(res);
+      FLAG_Z = res;
+      FLAG_C = CFLAG_CLEAR;
+      FLAG_V = VFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_or_32_re_ai:
+   {
+      uint ea = EA_AY_AI_32();
+      uint res = DX | m68ki_read_32(ea);
+
+      m68ki_write_32(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_32(res);
+      FLAG_Z = res;
+      FLAG_C = CFLAG_CLEAR;
+      FLAG_V = VFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_or_32_re_pi:
+   {
+      uint ea = EA_AY_PI_32();
+      uint res = DX | m68ki_read_32(ea);
+
+      m68ki_write_32(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_32(res);
+      FLAG_Z = res;
+      FLAG_C = CFLAG_CLEAR;
+      FLAG_V = VFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_or_32_re_pd:
+   {
+      uint ea = EA_AY_PD_32();
+      uint res = DX | m68ki_read_32(ea);
+
+      m68ki_write_32(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_32(res);
+      FLAG_Z = res;
+      FLAG_C = CFLAG_CLEAR;
+      FLAG_V = VFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_or_32_re_di:
+   {
+      uint ea = EA_AY_DI_32();
+      uint res = DX | m68ki_read_32(ea);
+
+      m68ki_write_32(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_32(res);
+      FLAG_Z = res;
+      FLAG_C = CFLAG_CLEAR;
+      FLAG_V = VFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_or_32_re_ix:
+   {
+      uint ea = EA_AY_IX_32();
+      uint res = DX | m68ki_read_32(ea);
+
+      m68ki_write_32(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_32(res);
+      FLAG_Z = res;
+      FLAG_C = CFLAG_CLEAR;
+      FLAG_V = VFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_or_32_re_aw:
+   {
+      uint ea = EA_AW_32();
+      uint res = DX | m68ki_read_32(ea);
+
+      m68ki_write_32(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_32(res);
+      FLAG_Z = res;
+      FLAG_C = CFLAG_CLEAR;
+      FLAG_V = VFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_or_32_re_al:
+   {
+      uint ea = EA_AL_32();
+      uint res = DX | m68ki_read_32(ea);
+
+      m68ki_write_32(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_32(res);
+      FLAG_Z = res;
+      FLAG_C = CFLAG_CLEAR;
+      FLAG_V = VFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_ori_8_d:
+   {
+      uint res = MASK_OUT_ABOVE_8((DY |= OPER_I_8()));
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_8(res);
+      FLAG_Z = res;
+      FLAG_C = CFLAG_CLEAR;
+      FLAG_V = VFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_ori_8_ai:
+   {
+      uint src = OPER_I_8();
+      uint ea = EA_AY_AI_8();
+      uint res = MASK_OUT_ABOVE_8(src | m68ki_read_8(ea));
+
+      m68ki_write_8(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_8(res);
+      FLAG_Z = res;
+      FLAG_C = CFLAG_CLEAR;
+      FLAG_V = VFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_ori_8_pi:
+   {
+      uint src = OPER_I_8();
+      uint ea = EA_AY_PI_8();
+      uint res = MASK_OUT_ABOVE_8(src | m68ki_read_8(ea));
+
+      m68ki_write_8(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_8(res);
+      FLAG_Z = res;
+      FLAG_C = CFLAG_CLEAR;
+      FLAG_V = VFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_ori_8_pi7:
+   {
+      uint src = OPER_I_8();
+      uint ea = EA_A7_PI_8();
+      uint res = MASK_OUT_ABOVE_8(src | m68ki_read_8(ea));
+
+      m68ki_write_8(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_8(res);
+      FLAG_Z = res;
+      FLAG_C = CFLAG_CLEAR;
+      FLAG_V = VFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_ori_8_pd:
+   {
+      uint src = OPER_I_8();
+      uint ea = EA_AY_PD_8();
+      uint res = MASK_OUT_ABOVE_8(src | m68ki_read_8(ea));
+
+      m68ki_write_8(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_8(res);
+      FLAG_Z = res;
+      FLAG_C = CFLAG_CLEAR;
+      FLAG_V = VFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_ori_8_pd7:
+   {
+      uint src = OPER_I_8();
+      uint ea = EA_A7_PD_8();
+      uint res = MASK_OUT_ABOVE_8(src | m68ki_read_8(ea));
+
+      m68ki_write_8(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_8(res);
+      FLAG_Z = res;
+      FLAG_C = CFLAG_CLEAR;
+      FLAG_V = VFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_ori_8_di:
+   {
+      uint src = OPER_I_8();
+      uint ea = EA_AY_DI_8();
+      uint res = MASK_OUT_ABOVE_8(src | m68ki_read_8(ea));
+
+      m68ki_write_8(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_8(res);
+      FLAG_Z = res;
+      FLAG_C = CFLAG_CLEAR;
+      FLAG_V = VFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_ori_8_ix:
+   {
+      uint src = OPER_I_8();
+      uint ea = EA_AY_IX_8();
+      uint res = MASK_OUT_ABOVE_8(src | m68ki_read_8(ea));
+
+      m68ki_write_8(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_8(res);
+      FLAG_Z = res;
+      FLAG_C = CFLAG_CLEAR;
+      FLAG_V = VFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_ori_8_aw:
+   {
+      uint src = OPER_I_8();
+      uint ea = EA_AW_8();
+      uint res = MASK_OUT_ABOVE_8(src | m68ki_read_8(ea));
+
+      m68ki_write_8(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_8(res);
+      FLAG_Z = res;
+      FLAG_C = CFLAG_CLEAR;
+      FLAG_V = VFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_ori_8_al:
+   {
+      uint src = OPER_I_8();
+      uint ea = EA_AL_8();
+      uint res = MASK_OUT_ABOVE_8(src | m68ki_read_8(ea));
+
+      m68ki_write_8(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_8(res);
+      FLAG_Z = res;
+      FLAG_C = CFLAG_CLEAR;
+      FLAG_V = VFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_ori_16_d:
+   {
+      uint res = MASK_OUT_ABOVE_16(DY |= OPER_I_16());
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_16(res);
+      FLAG_Z = res;
+      FLAG_C = CFLAG_CLEAR;
+      FLAG_V = VFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_ori_16_ai:
+   {
+      uint src = OPER_I_16();
+      uint ea = EA_AY_AI_16();
+      uint res = MASK_OUT_ABOVE_16(src | m68ki_read_16(ea));
+
+      m68ki_write_16(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_16(res);
+      FLAG_Z = res;
+      FLAG_C = CFLAG_CLEAR;
+      FLAG_V = VFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_ori_16_pi:
+   {
+      uint src = OPER_I_16();
+      uint ea = EA_AY_PI_16();
+      uint res = MASK_OUT_ABOVE_16(src | m68ki_read_16(ea));
+
+      m68ki_write_16(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_16(res);
+      FLAG_Z = res;
+      FLAG_C = CFLAG_CLEAR;
+      FLAG_V = VFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_ori_16_pd:
+   {
+      uint src = OPER_I_16();
+      uint ea = EA_AY_PD_16();
+      uint res = MASK_OUT_ABOVE_16(src | m68ki_read_16(ea));
+
+      m68ki_write_16(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_16(res);
+      FLAG_Z = res;
+      FLAG_C = CFLAG_CLEAR;
+      FLAG_V = VFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_ori_16_di:
+   {
+      uint src = OPER_I_16();
+      uint ea = EA_AY_DI_16();
+      uint res = MASK_OUT_ABOVE_16(src | m68ki_read_16(ea));
+
+      m68ki_write_16(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_16(res);
+      FLAG_Z = res;
+      FLAG_C = CFLAG_CLEAR;
+      FLAG_V = VFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_ori_16_ix:
+   {
+      uint src = OPER_I_16();
+      uint ea = EA_AY_IX_16();
+      uint res = MASK_OUT_ABOVE_16(src | m68ki_read_16(ea));
+
+      m68ki_write_16(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_16(res);
+      FLAG_Z = res;
+      FLAG_C = CFLAG_CLEAR;
+      FLAG_V = VFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_ori_16_aw:
+   {
+      uint src = OPER_I_16();
+      uint ea = EA_AW_16();
+      uint res = MASK_OUT_ABOVE_16(src | m68ki_read_16(ea));
+
+      m68ki_write_16(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_16(res);
+      FLAG_Z = res;
+      FLAG_C = CFLAG_CLEAR;
+      FLAG_V = VFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_ori_16_al:
+   {
+      uint src = OPER_I_16();
+      uint ea = EA_AL_16();
+      uint res = MASK_OUT_ABOVE_16(src | m68ki_read_16(ea));
+
+      m68ki_write_16(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_16(res);
+      FLAG_Z = res;
+      FLAG_C = CFLAG_CLEAR;
+      FLAG_V = VFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_ori_32_d:
+   {
+      uint res = DY |= OPER_I_32();
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_32(res);
+      FLAG_Z = res;
+      FLAG_C = CFLAG_CLEAR;
+      FLAG_V = VFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_ori_32_ai:
+   {
+      uint src = OPER_I_32();
+      uint ea = EA_AY_AI_32();
+      uint res = src | m68ki_read_32(ea);
+
+      m68ki_write_32(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_32(res);
+      FLAG_Z = res;
+      FLAG_C = CFLAG_CLEAR;
+      FLAG_V = VFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_ori_32_pi:
+   {
+      uint src = OPER_I_32();
+      uint ea = EA_AY_PI_32();
+      uint res = src | m68ki_read_32(ea);
+
+      m68ki_write_32(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_32(res);
+      FLAG_Z = res;
+      FLAG_C = CFLAG_CLEAR;
+      FLAG_V = VFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_ori_32_pd:
+   {
+      uint src = OPER_I_32();
+      uint ea = EA_AY_PD_32();
+      uint res = src | m68ki_read_32(ea);
+
+      m68ki_write_32(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_32(res);
+      FLAG_Z = res;
+      FLAG_C = CFLAG_CLEAR;
+      FLAG_V = VFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_ori_32_di:
+   {
+      uint src = OPER_I_32();
+      uint ea = EA_AY_DI_32();
+      uint res = src | m68ki_read_32(ea);
+
+      m68ki_write_32(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_32(res);
+      FLAG_Z = res;
+      FLAG_C = CFLAG_CLEAR;
+      FLAG_V = VFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_ori_32_ix:
+   {
+      uint src = OPER_I_32();
+      uint ea = EA_AY_IX_32();
+      uint res = src | m68ki_read_32(ea);
+
+      m68ki_write_32(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_32(res);
+      FLAG_Z = res;
+      FLAG_C = CFLAG_CLEAR;
+      FLAG_V = VFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_ori_32_aw:
+   {
+      uint src = OPER_I_32();
+      uint ea = EA_AW_32();
+      uint res = src | m68ki_read_32(ea);
+
+      m68ki_write_32(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_32(res);
+      FLAG_Z = res;
+      FLAG_C = CFLAG_CLEAR;
+      FLAG_V = VFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_ori_32_al:
+   {
+      uint src = OPER_I_32();
+      uint ea = EA_AL_32();
+      uint res = src | m68ki_read_32(ea);
+
+      m68ki_write_32(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_32(res);
+      FLAG_Z = res;
+      FLAG_C = CFLAG_CLEAR;
+      FLAG_V = VFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_ori_8_toc:
+   {
+      m68ki_set_ccr(m68ki_get_ccr() | OPER_I_8());
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_ori_16_tos:
+   {
+      if(FLAG_S)
+      {
+         uint src = OPER_I_16();
+         m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
+         m68ki_set_sr(m68ki_get_sr() | src);
+         goto m68k_op_ori_16_tos_done;
+      }
+      m68ki_exception_privilege_violation();
+   }
+m68k_op_ori_16_tos_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_pack_16_rr:
+   {
+      if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+      {
+         /* Note: DX and DY are reversed in Motorola's docs */
+         uint src = DY + OPER_I_16();
+         uint* r_dst = &DX;
+
+         *r_dst = MASK_OUT_BELOW_8(*r_dst) | ((src >> 4) & 0x00f0) | (src & 0x000f);
+         goto m68k_op_pack_16_rr_done;
+      }
+      m68ki_exception_illegal();
+   }
+m68k_op_pack_16_rr_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_pack_16_mm_ax7:
+   {
+      if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+      {
+         /* Note: AX and AY are reversed in Motorola's docs */
+         uint ea_src = EA_AY_PD_8();
+         uint src = m68ki_read_8(ea_src);
+         ea_src = EA_AY_PD_8();
+         src = ((src << 8) | m68ki_read_8(ea_src)) + OPER_I_16();
+
+         m68ki_write_8(EA_A7_PD_8(), ((src >> 4) & 0x00f0) | (src & 0x000f));
+         goto m68k_op_pack_16_mm_ax7_done;
+      }
+      m68ki_exception_illegal();
+   }
+m68k_op_pack_16_mm_ax7_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_pack_16_mm_ay7:
+   {
+      if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+      {
+         /* Note: AX and AY are reversed in Motorola's docs */
+         uint ea_src = EA_A7_PD_8();
+         uint src = m68ki_read_8(ea_src);
+         ea_src = EA_A7_PD_8();
+         src = ((src << 8) | m68ki_read_8(ea_src)) + OPER_I_16();
+
+         m68ki_write_8(EA_AX_PD_8(), ((src >> 4) & 0x00f0) | (src & 0x000f));
+         goto m68k_op_pack_16_mm_ay7_done;
+      }
+      m68ki_exception_illegal();
+   }
+m68k_op_pack_16_mm_ay7_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_pack_16_mm_axy7:
+   {
+      if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+      {
+         uint ea_src = EA_A7_PD_8();
+         uint src = m68ki_read_8(ea_src);
+         ea_src = EA_A7_PD_8();
+         src = ((src << 8) | m68ki_read_8(ea_src)) + OPER_I_16();
+
+         m68ki_write_8(EA_A7_PD_8(), ((src >> 4) & 0x00f0) | (src & 0x000f));
+         goto m68k_op_pack_16_mm_axy7_done;
+      }
+      m68ki_exception_illegal();
+   }
+m68k_op_pack_16_mm_axy7_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_pack_16_mm:
+   {
+      if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+      {
+         /* Note: AX and AY are reversed in Motorola's docs */
+         uint ea_src = EA_AY_PD_8();
+         uint src = m68ki_read_8(ea_src);
+         ea_src = EA_AY_PD_8();
+         src = ((src << 8) | m68ki_read_8(ea_src)) + OPER_I_16();
+
+         m68ki_write_8(EA_AX_PD_8(), ((src >> 4) & 0x00f0) | (src & 0x000f));
+         goto m68k_op_pack_16_mm_done;
+      }
+      m68ki_exception_illegal();
+   }
+m68k_op_pack_16_mm_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_pea_32_ai:
+   {
+      uint ea = EA_AY_AI_32();
+
+      m68ki_push_32(ea);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_pea_32_di:
+   {
+      uint ea = EA_AY_DI_32();
+
+      m68ki_push_32(ea);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_pea_32_ix:
+   {
+      uint ea = EA_AY_IX_32();
+
+      m68ki_push_32(ea);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_pea_32_aw:
+   {
+      uint ea = EA_AW_32();
+
+      m68ki_push_32(ea);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_pea_32_al:
+   {
+      uint ea = EA_AL_32();
+
+      m68ki_push_32(ea);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_pea_32_pcdi:
+   {
+      uint ea = EA_PCDI_32();
+
+      m68ki_push_32(ea);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_pea_32_pcix:
+   {
+      uint ea = EA_PCIX_32();
+
+      m68ki_push_32(ea);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_reset:
+   {
+      if(FLAG_S)
+      {
+         m68ki_output_reset();		   /* auto-disable (see m68kcpu.h) */
+         USE_CYCLES(CYC_RESET);
+         goto m68k_op_reset_done;
+      }
+      m68ki_exception_privilege_violation();
+   }
+m68k_op_reset_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_ror_8_s:
+   {
+      uint* r_dst = &DY;
+      uint orig_shift = (((REG_IR >> 9) - 1) & 7) + 1;
+      uint shift = orig_shift & 7;
+      uint src = MASK_OUT_ABOVE_8(*r_dst);
+      uint res = ROR_8(src, shift);
+
+      *r_dst = MASK_OUT_BELOW_8(*r_dst) | res;
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_8(res);
+      FLAG_Z = res;
+      FLAG_C = src << (9-orig_shift);
+      FLAG_V = VFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_ror_16_s:
+   {
+      uint* r_dst = &DY;
+      uint shift = (((REG_IR >> 9) - 1) & 7) + 1;
+      uint src = MASK_OUT_ABOVE_16(*r_dst);
+      uint res = ROR_16(src, shift);
+
+      *r_dst = MASK_OUT_BELOW_16(*r_dst) | res;
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_16(res);
+      FLAG_Z = res;
+      FLAG_C = src << (9-shift);
+      FLAG_V = VFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_ror_32_s:
+   {
+      uint* r_dst = &DY;
+      uint shift = (((REG_IR >> 9) - 1) & 7) + 1;
+      uint64 src = *r_dst;
+      uint res = ROR_32(src, shift);
+
+      *r_dst = res;
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_32(res);
+      FLAG_Z = res;
+      FLAG_C = src << (9-shift);
+      FLAG_V = VFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_ror_8_r:
+   {
+      uint* r_dst = &DY;
+      uint orig_shift = DX & 0x3f;
+      uint shift = orig_shift & 7;
+      uint src = MASK_OUT_ABOVE_8(*r_dst);
+      uint res = ROR_8(src, shift);
+
+      m68ki_resolve_flags();
+
+      if(orig_shift != 0)
+      {
+         USE_CYCLES(orig_shift<<CYC_SHIFT);
+
+         *r_dst = MASK_OUT_BELOW_8(*r_dst) | res;
+         FLAG_C = src << (8-((shift-1)&7));
+         FLAG_N = NFLAG_8(res);
+         FLAG_Z = res;
+         FLAG_V = VFLAG_CLEAR;
+         goto m68k_op_ror_8_r_done;
+      }
+
+      FLAG_C = CFLAG_CLEAR;
+      FLAG_N = NFLAG_8(src);
+      FLAG_Z = src;
+      FLAG_V = VFLAG_CLEAR;
+   }
+m68k_op_ror_8_r_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_ror_16_r:
+   {
+      uint* r_dst = &DY;
+      uint orig_shift = DX & 0x3f;
+      uint shift = orig_shift & 15;
+      uint src = MASK_OUT_ABOVE_16(*r_dst);
+      uint res = ROR_16(src, shift);
+
+      m68ki_resolve_flags();
+
+      if(orig_shift != 0)
+      {
+         USE_CYCLES(orig_shift<<CYC_SHIFT);
+
+         *r_dst = MASK_OUT_BELOW_16(*r_dst) | res;
+         FLAG_C = (src >> ((shift - 1) & 15)) << 8;
+         FLAG_N = NFLAG_16(res);
+         FLAG_Z = res;
+         FLAG_V = VFLAG_CLEAR;
+         goto m68k_op_ror_16_r_done;
+      }
+
+      FLAG_C = CFLAG_CLEAR;
+      FLAG_N = NFLAG_16(src);
+      FLAG_Z = src;
+      FLAG_V = VFLAG_CLEAR;
+   }
+m68k_op_ror_16_r_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_ror_32_r:
+   {
+      uint* r_dst = &DY;
+      uint orig_shift = DX & 0x3f;
+      uint shift = orig_shift & 31;
+
+      m68ki_resolve_flags();
+      uint64 src = *r_dst;
+      uint res = ROR_32(src, shift);
+
+      if(orig_shift != 0)
+      {
+         USE_CYCLES(orig_shift<<CYC_SHIFT);
+
+         *r_dst = res;
+         FLAG_C = (src >> ((shift - 1) & 31)) << 8;
+         FLAG_N = NFLAG_32(res);
+         FLAG_Z = res;
+         FLAG_V = VFLAG_CLEAR;
+         goto m68k_op_ror_32_r_done;
+      }
+
+      FLAG_C = CFLAG_CLEAR;
+      FLAG_N = NFLAG_32(src);
+      FLAG_Z = src;
+      FLAG_V = VFLAG_CLEAR;
+   }
+m68k_op_ror_32_r_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_ror_16_ai:
+   {
+      uint ea = EA_AY_AI_16();
+      uint src = m68ki_read_16(ea);
+      uint res = ROR_16(src, 1);
+
+      m68ki_write_16(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_16(res);
+      FLAG_Z = res;
+      FLAG_C = src << 8;
+      FLAG_V = VFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_ror_16_pi:
+   {
+      uint ea = EA_AY_PI_16();
+      uint src = m68ki_read_16(ea);
+      uint res = ROR_16(src, 1);
+
+      m68ki_write_16(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_16(res);
+      FLAG_Z = res;
+      FLAG_C = src << 8;
+      FLAG_V = VFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_ror_16_pd:
+   {
+      uint ea = EA_AY_PD_16();
+      uint src = m68ki_read_16(ea);
+      uint res = ROR_16(src, 1);
+
+      m68ki_write_16(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_16(res);
+      FLAG_Z = res;
+      FLAG_C = src << 8;
+      FLAG_V = VFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_ror_16_di:
+   {
+      uint ea = EA_AY_DI_16();
+      uint src = m68ki_read_16(ea);
+      uint res = ROR_16(src, 1);
+
+      m68ki_write_16(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_16(res);
+      FLAG_Z = res;
+      FLAG_C = src << 8;
+      FLAG_V = VFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_ror_16_ix:
+   {
+      uint ea = EA_AY_IX_16();
+      uint src = m68ki_read_16(ea);
+      uint res = ROR_16(src, 1);
+
+      m68ki_write_16(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_16(res);
+      FLAG_Z = res;
+      FLAG_C = src << 8;
+      FLAG_V = VFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_ror_16_aw:
+   {
+      uint ea = EA_AW_16();
+      uint src = m68ki_read_16(ea);
+      uint res = ROR_16(src, 1);
+
+      m68ki_write_16(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_16(res);
+      FLAG_Z = res;
+      FLAG_C = src << 8;
+      FLAG_V = VFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_ror_16_al:
+   {
+      uint ea = EA_AL_16();
+      uint src = m68ki_read_16(ea);
+      uint res = ROR_16(src, 1);
+
+      m68ki_write_16(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_16(res);
+      FLAG_Z = res;
+      FLAG_C = src << 8;
+      FLAG_V = VFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_rol_8_s:
+   {
+      uint* r_dst = &DY;
+      uint orig_shift = (((REG_IR >> 9) - 1) & 7) + 1;
+      uint shift = orig_shift & 7;
+      uint src = MASK_OUT_ABOVE_8(*r_dst);
+      uint res = ROL_8(src, shift);
+
+      *r_dst = MASK_OUT_BELOW_8(*r_dst) | res;
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_8(res);
+      FLAG_Z = res;
+      FLAG_C = src << orig_shift;
+      FLAG_V = VFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_rol_16_s:
+   {
+      uint* r_dst = &DY;
+      uint shift = (((REG_IR >> 9) - 1) & 7) + 1;
+      uint src = MASK_OUT_ABOVE_16(*r_dst);
+      uint res = ROL_16(src, shift);
+
+      *r_dst = MASK_OUT_BELOW_16(*r_dst) | res;
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_16(res);
+      FLAG_Z = res;
+      FLAG_C = src >> (8-shift);
+      FLAG_V = VFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_rol_32_s:
+   {
+      uint* r_dst = &DY;
+      uint shift = (((REG_IR >> 9) - 1) & 7) + 1;
+      uint64 src = *r_dst;
+      uint res = ROL_32(src, shift);
+
+      *r_dst = res;
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_32(res);
+      FLAG_Z = res;
+      FLAG_C = src >> (24-shift);
+      FLAG_V = VFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_rol_8_r:
+   {
+      uint* r_dst = &DY;
+      uint orig_shift = DX & 0x3f;
+      uint shift = orig_shift & 7;
+      uint src = MASK_OUT_ABOVE_8(*r_dst);
+      uint res = ROL_8(src, shift);
+
+      m68ki_resolve_flags();
+
+      if(orig_shift != 0)
+      {
+         USE_CYCLES(orig_shift<<CYC_SHIFT);
+
+         if(shift != 0)
+         {
+            *r_dst = MASK_OUT_BELOW_8(*r_dst) | res;
+            FLAG_C = src << shift;
+            FLAG_N = NFLAG_8(res);
+            FLAG_Z = res;
+            FLAG_V = VFLAG_CLEAR;
+            goto m68k_op_rol_8_r_done;
+         }
+         FLAG_C = (src & 1)<<8;
+         FLAG_N = NFLAG_8(src);
+         FLAG_Z = src;
+         FLAG_V = VFLAG_CLEAR;
+         goto m68k_op_rol_8_r_done;
+      }
+
+      FLAG_C = CFLAG_CLEAR;
+      FLAG_N = NFLAG_8(src);
+      FLAG_Z = src;
+      FLAG_V = VFLAG_CLEAR;
+   }
+m68k_op_rol_8_r_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_rol_16_r:
+   {
+      uint* r_dst = &DY;
+      uint orig_shift = DX & 0x3f;
+      uint shift = orig_shift & 15;
+      uint src = MASK_OUT_ABOVE_16(*r_dst);
+      uint res = MASK_OUT_ABOVE_16(ROL_16(src, shift));
+
+      m68ki_resolve_flags();
+
+      if(orig_shift != 0)
+      {
+         USE_CYCLES(orig_shift<<CYC_SHIFT);
+
+         if(shift != 0)
+         {
+            *r_dst = MASK_OUT_BELOW_16(*r_dst) | res;
+            FLAG_C = (src << shift) >> 8;
+            FLAG_N = NFLAG_16(res);
+            FLAG_Z = res;
+            FLAG_V = VFLAG_CLEAR;
+            goto m68k_op_rol_16_r_done;
+         }
+         FLAG_C = (src & 1)<<8;
+         FLAG_N = NFLAG_16(src);
+         FLAG_Z = src;
+         FLAG_V = VFLAG_CLEAR;
+         goto m68k_op_rol_16_r_done;
+      }
+
+      FLAG_C = CFLAG_CLEAR;
+      FLAG_N = NFLAG_16(src);
+      FLAG_Z = src;
+      FLAG_V = VFLAG_CLEAR;
+   }
+m68k_op_rol_16_r_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_rol_32_r:
+   {
+      uint* r_dst = &DY;
+      uint orig_shift = DX & 0x3f;
+      uint shift = orig_shift & 31;
+
+      m68ki_resolve_flags();
+      uint64 src = *r_dst;
+      uint res = ROL_32(src, shift);
+
+      if(orig_shift != 0)
+      {
+         USE_CYCLES(orig_shift<<CYC_SHIFT);
+
+         *r_dst = res;
+
+         FLAG_C = (src >> (32 - shift)) << 8;
+         FLAG_N = NFLAG_32(res);
+         FLAG_Z = res;
+         FLAG_V = VFLAG_CLEAR;
+         goto m68k_op_rol_32_r_done;
+      }
+
+      FLAG_C = CFLAG_CLEAR;
+      FLAG_N = NFLAG_32(src);
+      FLAG_Z = src;
+      FLAG_V = VFLAG_CLEAR;
+   }
+m68k_op_rol_32_r_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_rol_16_ai:
+   {
+      uint ea = EA_AY_AI_16();
+      uint src = m68ki_read_16(ea);
+      uint res = MASK_OUT_ABOVE_16(ROL_16(src, 1));
+
+      m68ki_write_16(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_16(res);
+      FLAG_Z = res;
+      FLAG_C = src >> 7;
+      FLAG_V = VFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_rol_16_pi:
+   {
+      uint ea = EA_AY_PI_16();
+      uint src = m68ki_read_16(ea);
+      uint res = MASK_OUT_ABOVE_16(ROL_16(src, 1));
+
+      m68ki_write_16(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_16(res);
+      FLAG_Z = res;
+      FLAG_C = src >> 7;
+      FLAG_V = VFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_rol_16_pd:
+   {
+      uint ea = EA_AY_PD_16();
+      uint src = m68ki_read_16(ea);
+      uint res = MASK_OUT_ABOVE_16(ROL_16(src, 1));
+
+      m68ki_write_16(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_16(res);
+      FLAG_Z = res;
+      FLAG_C = src >> 7;
+      FLAG_V = VFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_rol_16_di:
+   {
+      uint ea = EA_AY_DI_16();
+      uint src = m68ki_read_16(ea);
+      uint res = MASK_OUT_ABOVE_16(ROL_16(src, 1));
+
+      m68ki_write_16(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_16(res);
+      FLAG_Z = res;
+      FLAG_C = src >> 7;
+      FLAG_V = VFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_rol_16_ix:
+   {
+      uint ea = EA_AY_IX_16();
+      uint src = m68ki_read_16(ea);
+      uint res = MASK_OUT_ABOVE_16(ROL_16(src, 1));
+
+      m68ki_write_16(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_16(res);
+      FLAG_Z = res;
+      FLAG_C = src >> 7;
+      FLAG_V = VFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_rol_16_aw:
+   {
+      uint ea = EA_AW_16();
+      uint src = m68ki_read_16(ea);
+      uint res = MASK_OUT_ABOVE_16(ROL_16(src, 1));
+
+      m68ki_write_16(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_16(res);
+      FLAG_Z = res;
+      FLAG_C = src >> 7;
+      FLAG_V = VFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_rol_16_al:
+   {
+      uint ea = EA_AL_16();
+      uint src = m68ki_read_16(ea);
+      uint res = MASK_OUT_ABOVE_16(ROL_16(src, 1));
+
+      m68ki_write_16(ea, res);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_16(res);
+      FLAG_Z = res;
+      FLAG_C = src >> 7;
+      FLAG_V = VFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_roxr_8_s:
+   {
+      uint* r_dst = &DY;
+      uint shift = (((REG_IR >> 9) - 1) & 7) + 1;
+      uint src = MASK_OUT_ABOVE_8(*r_dst);
+      uint res = ROR_9(src | (XFLAG_AS_1() << 8), shift);
+
+      m68ki_resolve_flags();
+
+      FLAG_C = FLAG_X = res;
+      res = MASK_OUT_ABOVE_8(res);
+
+      *r_dst = MASK_OUT_BELOW_8(*r_dst) | res;
+
+      FLAG_N = NFLAG_8(res);
+      FLAG_Z = res;
+      FLAG_V = VFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_roxr_16_s:
+   {
+      uint* r_dst = &DY;
+      uint shift = (((REG_IR >> 9) - 1) & 7) + 1;
+      uint src = MASK_OUT_ABOVE_16(*r_dst);
+      uint res = ROR_17(src | (XFLAG_AS_1() << 16), shift);
+
+      m68ki_resolve_flags();
+
+      FLAG_C = FLAG_X = res >> 8;
+      res = MASK_OUT_ABOVE_16(res);
+
+      *r_dst = MASK_OUT_BELOW_16(*r_dst) | res;
+
+      FLAG_N = NFLAG_16(res);
+      FLAG_Z = res;
+      FLAG_V = VFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_roxr_32_s:
+   {
+      m68ki_resolve_flags();
+   #if M68K_USE_64_BIT
+
+      uint*  r_dst = &DY;
+      uint   shift = (((REG_IR >> 9) - 1) & 7) + 1;
+      uint64 src   = *r_dst;
+      uint64 res   = src | (((uint64)XFLAG_AS_1()) << 32);
+
+      res = ROR_33_64(res, shift);
+
+      FLAG_C = FLAG_X = res >> 24;
+      res = MASK_OUT_ABOVE_32(res);
+
+      *r_dst =  res;
+
+      FLAG_N = NFLAG_32(res);
+      FLAG_Z = res;
+      FLAG_V = VFLAG_CLEAR;
+
+   #else
+
+      uint* r_dst = &DY;
+      uint shift = (((REG_IR >> 9) - 1) & 7) + 1;
+      uint src = *r_dst;
+      uint res = MASK_OUT_ABOVE_32((ROR_33(src, shift) & ~(1 << (32 - shift))) | (XFLAG_AS_1() << (32 - shift)));
+      uint new_x_flag = src & (1 << (shift - 1));
+
+      *r_dst = res;
+
+      FLAG_C = FLAG_X = (new_x_flag != 0)<<8;
+      FLAG_N = NFLAG_32(res);
+      FLAG_Z = res;
+      FLAG_V = VFLAG_CLEAR;
+
+   #endif
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_roxr_8_r:
+   {
+      uint* r_dst = &DY;
+      uint orig_shift = DX & 0x3f;
+
+      m68ki_resolve_flags();
+
+      if(orig_shift != 0)
+      {
+         uint shift = orig_shift % 9;
+         uint src   = MASK_OUT_ABOVE_8(*r_dst);
+         uint res   = ROR_9(src | (XFLAG_AS_1() << 8), shift);
+
+         USE_CYCLES(orig_shift<<CYC_SHIFT);
+
+         FLAG_C = FLAG_X = res;
+         res = MASK_OUT_ABOVE_8(res);
+
+         *r_dst = MASK_OUT_BELOW_8(*r_dst) | res;
+         FLAG_N = NFLAG_8(res);
+         FLAG_Z = res;
+         FLAG_V = VFLAG_CLEAR;
+         goto m68k_op_roxr_8_r_done;
+      }
+
+      FLAG_C = FLAG_X;
+      FLAG_N = NFLAG_8(*r_dst);
+      FLAG_Z = MASK_OUT_ABOVE_8(*r_dst);
+      FLAG_V = VFLAG_CLEAR;
+   }
+m68k_op_roxr_8_r_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_roxr_16_r:
+   {
+      uint* r_dst = &DY;
+      uint orig_shift = DX & 0x3f;
+
+      m68ki_resolve_flags();
+
+      if(orig_shift != 0)
+      {
+         uint shift = orig_shift % 17;
+         uint src   = MASK_OUT_ABOVE_16(*r_dst);
+         uint res   = ROR_17(src | (XFLAG_AS_1() << 16), shift);
+
+         USE_CYCLES(orig_shift<<CYC_SHIFT);
+
+         FLAG_C = FLAG_X = res >> 8;
+         res = MASK_OUT_ABOVE_16(res);
+
+         *r_dst = MASK_OUT_BELOW_16(*r_dst) | res;
+         FLAG_N = NFLAG_16(res);
+         FLAG_Z = res;
+         FLAG_V = VFLAG_CLEAR;
+         goto m68k_op_roxr_16_r_done;
+      }
+
+      FLAG_C = FLAG_X;
+      FLAG_N = NFLAG_16(*r_dst);
+      FLAG_Z = MASK_OUT_ABOVE_16(*r_dst);
+      FLAG_V = VFLAG_CLEAR;
+   }
+m68k_op_roxr_16_r_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_roxr_32_r:
+   {
+      m68ki_resolve_flags();
+   #if M68K_USE_64_BIT
+
+      uint*  r_dst = &DY;
+      uint   orig_shift = DX & 0x3f;
+
+      if(orig_shift != 0)
+      {
+         uint   shift = orig_shift % 33;
+         uint64 src   = *r_dst;
+         uint64 res   = src | (((uint64)XFLAG_AS_1()) << 32);
+
+         res = ROR_33_64(res, shift);
+
+         USE_CYCLES(orig_shift<<CYC_SHIFT);
+
+         FLAG_C = FLAG_X = res >> 24;
+         res = MASK_OUT_ABOVE_32(res);
+
+         *r_dst = res;
+         FLAG_N = NFLAG_32(res);
+         FLAG_Z = res;
+         FLAG_V = VFLAG_CLEAR;
+         goto m68k_op_roxr_32_r_done;
+      }
+
+      FLAG_C = FLAG_X;
+      FLAG_N = NFLAG_32(*r_dst);
+      FLAG_Z = *r_dst;
+      FLAG_V = VFLAG_CLEAR;
+
+   #else
+
+      uint* r_dst = &DY;
+      uint orig_shift = DX & 0x3f;
+      uint shift = orig_shift % 33;
+      uint src = *r_dst;
+      uint res = MASK_OUT_ABOVE_32((ROR_33(src, shift) & ~(1 << (32 - shift))) | (XFLAG_AS_1() << (32 - shift)));
+      uint new_x_flag = src & (1 << (shift - 1));
+
+      if(orig_shift != 0)
+         USE_CYCLES(orig_shift<<CYC_SHIFT);
+
+      if(shift != 0)
+      {
+         *r_dst = res;
+         FLAG_X = (new_x_flag != 0)<<8;
+      }
+      else
+         res = src;
+      FLAG_C = FLAG_X;
+      FLAG_N = NFLAG_32(res);
+      FLAG_Z = res;
+      FLAG_V = VFLAG_CLEAR;
+
+   #endif
+   }
+m68k_op_roxr_32_r_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_roxr_16_ai:
+   {
+      uint ea = EA_AY_AI_16();
+      uint src = m68ki_read_16(ea);
+      uint res = ROR_17(src | (XFLAG_AS_1() << 16), 1);
+
+      m68ki_resolve_flags();
+
+      FLAG_C = FLAG_X = res >> 8;
+      res = MASK_OUT_ABOVE_16(res);
+
+      m68ki_write_16(ea, res);
+
+      FLAG_N = NFLAG_16(res);
+      FLAG_Z = res;
+      FLAG_V = VFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_roxr_16_pi:
+   {
+      uint ea = EA_AY_PI_16();
+      uint src = m68ki_read_16(ea);
+      uint res = ROR_17(src | (XFLAG_AS_1() << 16), 1);
+
+      m68ki_resolve_flags();
+
+      FLAG_C = FLAG_X = res >> 8;
+      res = MASK_OUT_ABOVE_16(res);
+
+      m68ki_write_16(ea, res);
+
+      FLAG_N = NFLAG_16(res);
+      FLAG_Z = res;
+      FLAG_V = VFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_roxr_16_pd:
+   {
+      uint ea = EA_AY_PD_16();
+      uint src = m68ki_read_16(ea);
+      uint res = ROR_17(src | (XFLAG_AS_1() << 16), 1);
+
+      m68ki_resolve_flags();
+
+      FLAG_C = FLAG_X = res >> 8;
+      res = MASK_OUT_ABOVE_16(res);
+
+      m68ki_write_16(ea, res);
+
+      FLAG_N = NFLAG_16(res);
+      FLAG_Z = res;
+      FLAG_V = VFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_roxr_16_di:
+   {
+      uint ea = EA_AY_DI_16();
+      uint src = m68ki_read_16(ea);
+      uint res = ROR_17(src | (XFLAG_AS_1() << 16), 1);
+
+      m68ki_resolve_flags();
+
+      FLAG_C = FLAG_X = res >> 8;
+      res = MASK_OUT_ABOVE_16(res);
+
+      m68ki_write_16(ea, res);
+
+      FLAG_N = NFLAG_16(res);
+      FLAG_Z = res;
+      FLAG_V = VFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_roxr_16_ix:
+   {
+      uint ea = EA_AY_IX_16();
+      uint src = m68ki_read_16(ea);
+      uint res = ROR_17(src | (XFLAG_AS_1() << 16), 1);
+
+      m68ki_resolve_flags();
+
+      FLAG_C = FLAG_X = res >> 8;
+      res = MASK_OUT_ABOVE_16(res);
+
+      m68ki_write_16(ea, res);
+
+      FLAG_N = NFLAG_16(res);
+      FLAG_Z = res;
+      FLAG_V = VFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_roxr_16_aw:
+   {
+      uint ea = EA_AW_16();
+      uint src = m68ki_read_16(ea);
+      uint res = ROR_17(src | (XFLAG_AS_1() << 16), 1);
+
+      m68ki_resolve_flags();
+
+      FLAG_C = FLAG_X = res >> 8;
+      res = MASK_OUT_ABOVE_16(res);
+
+      m68ki_write_16(ea, res);
+
+      FLAG_N = NFLAG_16(res);
+      FLAG_Z = res;
+      FLAG_V = VFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_roxr_16_al:
+   {
+      uint ea = EA_AL_16();
+      uint src = m68ki_read_16(ea);
+      uint res = ROR_17(src | (XFLAG_AS_1() << 16), 1);
+
+      m68ki_resolve_flags();
+
+      FLAG_C = FLAG_X = res >> 8;
+      res = MASK_OUT_ABOVE_16(res);
+
+      m68ki_write_16(ea, res);
+
+      FLAG_N = NFLAG_16(res);
+      FLAG_Z = res;
+      FLAG_V = VFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_roxl_8_s:
+   {
+      uint* r_dst = &DY;
+      uint shift = (((REG_IR >> 9) - 1) & 7) + 1;
+      uint src = MASK_OUT_ABOVE_8(*r_dst);
+      uint res = ROL_9(src | (XFLAG_AS_1() << 8), shift);
+
+      m68ki_resolve_flags();
+
+      FLAG_C = FLAG_X = res;
+      res = MASK_OUT_ABOVE_8(res);
+
+      *r_dst = MASK_OUT_BELOW_8(*r_dst) | res;
+
+      FLAG_N = NFLAG_8(res);
+      FLAG_Z = res;
+      FLAG_V = VFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_roxl_16_s:
+   {
+      uint* r_dst = &DY;
+      uint shift = (((REG_IR >> 9) - 1) & 7) + 1;
+      uint src = MASK_OUT_ABOVE_16(*r_dst);
+      uint res = ROL_17(src | (XFLAG_AS_1() << 16), shift);
+
+      m68ki_resolve_flags();
+
+      FLAG_C = FLAG_X = res >> 8;
+      res = MASK_OUT_ABOVE_16(res);
+
+      *r_dst = MASK_OUT_BELOW_16(*r_dst) | res;
+
+      FLAG_N = NFLAG_16(res);
+      FLAG_Z = res;
+      FLAG_V = VFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_roxl_32_s:
+   {
+      m68ki_resolve_flags();
+   #if M68K_USE_64_BIT
+
+      uint*  r_dst = &DY;
+      uint   shift = (((REG_IR >> 9) - 1) & 7) + 1;
+      uint64 src   = *r_dst;
+      uint64 res   = src | (((uint64)XFLAG_AS_1()) << 32);
+
+      res = ROL_33_64(res, shift);
+
+      FLAG_C = FLAG_X = res >> 24;
+      res = MASK_OUT_ABOVE_32(res);
+
+      *r_dst = res;
+
+      FLAG_N = NFLAG_32(res);
+      FLAG_Z = res;
+      FLAG_V = VFLAG_CLEAR;
+
+   #else
+
+      uint* r_dst = &DY;
+      uint shift = (((REG_IR >> 9) - 1) & 7) + 1;
+      uint src = *r_dst;
+      uint res = MASK_OUT_ABOVE_32((ROL_33(src, shift) & ~(1 << (shift - 1))) | (XFLAG_AS_1() << (shift - 1)));
+      uint new_x_flag = src & (1 << (32 - shift));
+
+      *r_dst = res;
+
+      FLAG_C = FLAG_X = (new_x_flag != 0)<<8;
+      FLAG_N = NFLAG_32(res);
+      FLAG_Z = res;
+      FLAG_V = VFLAG_CLEAR;
+
+   #endif
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_roxl_8_r:
+   {
+      uint* r_dst = &DY;
+      uint orig_shift = DX & 0x3f;
+
+      m68ki_resolve_flags();
+
+
+      if(orig_shift != 0)
+      {
+         uint shift = orig_shift % 9;
+         uint src   = MASK_OUT_ABOVE_8(*r_dst);
+         uint res   = ROL_9(src | (XFLAG_AS_1() << 8), shift);
+
+         USE_CYCLES(orig_shift<<CYC_SHIFT);
+
+         FLAG_C = FLAG_X = res;
+         res = MASK_OUT_ABOVE_8(res);
+
+         *r_dst = MASK_OUT_BELOW_8(*r_dst) | res;
+         FLAG_N = NFLAG_8(res);
+         FLAG_Z = res;
+         FLAG_V = VFLAG_CLEAR;
+         goto m68k_op_roxl_8_r_done;
+      }
+
+      FLAG_C = FLAG_X;
+      FLAG_N = NFLAG_8(*r_dst);
+      FLAG_Z = MASK_OUT_ABOVE_8(*r_dst);
+      FLAG_V = VFLAG_CLEAR;
+   }
+m68k_op_roxl_8_r_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_roxl_16_r:
+   {
+      uint* r_dst = &DY;
+      uint orig_shift = DX & 0x3f;
+
+      m68ki_resolve_flags();
+
+      if(orig_shift != 0)
+      {
+         uint shift = orig_shift % 17;
+         uint src   = MASK_OUT_ABOVE_16(*r_dst);
+         uint res   = ROL_17(src | (XFLAG_AS_1() << 16), shift);
+
+         USE_CYCLES(orig_shift<<CYC_SHIFT);
+
+         FLAG_C = FLAG_X = res >> 8;
+         res = MASK_OUT_ABOVE_16(res);
+
+         *r_dst = MASK_OUT_BELOW_16(*r_dst) | res;
+         FLAG_N = NFLAG_16(res);
+         FLAG_Z = res;
+         FLAG_V = VFLAG_CLEAR;
+         goto m68k_op_roxl_16_r_done;
+      }
+
+      FLAG_C = FLAG_X;
+      FLAG_N = NFLAG_16(*r_dst);
+      FLAG_Z = MASK_OUT_ABOVE_16(*r_dst);
+      FLAG_V = VFLAG_CLEAR;
+   }
+m68k_op_roxl_16_r_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_roxl_32_r:
+   {
+      m68ki_resolve_flags();
+   #if M68K_USE_64_BIT
+
+      uint*  r_dst = &DY;
+      uint   orig_shift = DX & 0x3f;
+
+      if(orig_shift != 0)
+      {
+         uint   shift = orig_shift % 33;
+         uint64 src   = *r_dst;
+         uint64 res   = src | (((uint64)XFLAG_AS_1()) << 32);
+
+         res = ROL_33_64(res, shift);
+
+         USE_CYCLES(orig_shift<<CYC_SHIFT);
+
+         FLAG_C = FLAG_X = res >> 24;
+         res = MASK_OUT_ABOVE_32(res);
+
+         *r_dst = res;
+         FLAG_N = NFLAG_32(res);
+         FLAG_Z = res;
+         FLAG_V = VFLAG_CLEAR;
+         goto m68k_op_roxl_32_r_done;
+      }
+
+      FLAG_C = FLAG_X;
+      FLAG_N = NFLAG_32(*r_dst);
+      FLAG_Z = *r_dst;
+      FLAG_V = VFLAG_CLEAR;
+
+   #else
+
+      uint* r_dst = &DY;
+      uint orig_shift = DX & 0x3f;
+      uint shift = orig_shift % 33;
+      uint src = *r_dst;
+      uint res = MASK_OUT_ABOVE_32((ROL_33(src, shift) & ~(1 << (shift - 1))) | (XFLAG_AS_1() << (shift - 1)));
+      uint new_x_flag = src & (1 << (32 - shift));
+
+      if(orig_shift != 0)
+         USE_CYCLES(orig_shift<<CYC_SHIFT);
+
+      if(shift != 0)
+      {
+         *r_dst = res;
+         FLAG_X = (new_x_flag != 0)<<8;
+      }
+      else
+         res = src;
+      FLAG_C = FLAG_X;
+      FLAG_N = NFLAG_32(res);
+      FLAG_Z = res;
+      FLAG_V = VFLAG_CLEAR;
+
+   #endif
+   }
+m68k_op_roxl_32_r_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_roxl_16_ai:
+   {
+      uint ea = EA_AY_AI_16();
+      uint src = m68ki_read_16(ea);
+      uint res = ROL_17(src | (XFLAG_AS_1() << 16), 1);
+
+      m68ki_resolve_flags();
+
+      FLAG_C = FLAG_X = res >> 8;
+      res = MASK_OUT_ABOVE_16(res);
+
+      m68ki_write_16(ea, res);
+
+      FLAG_N = NFLAG_16(res);
+      FLAG_Z = res;
+      FLAG_V = VFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_roxl_16_pi:
+   {
+      uint ea = EA_AY_PI_16();
+      uint src = m68ki_read_16(ea);
+      uint res = ROL_17(src | (XFLAG_AS_1() << 16), 1);
+
+      m68ki_resolve_flags();
+
+      FLAG_C = FLAG_X = res >> 8;
+      res = MASK_OUT_ABOVE_16(res);
+
+      m68ki_write_16(ea, res);
+
+      FLAG_N = NFLAG_16(res);
+      FLAG_Z = res;
+      FLAG_V = VFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_roxl_16_pd:
+   {
+      uint ea = EA_AY_PD_16();
+      uint src = m68ki_read_16(ea);
+      uint res = ROL_17(src | (XFLAG_AS_1() << 16), 1);
+
+      m68ki_resolve_flags();
+
+      FLAG_C = FLAG_X = res >> 8;
+      res = MASK_OUT_ABOVE_16(res);
+
+      m68ki_write_16(ea, res);
+
+      FLAG_N = NFLAG_16(res);
+      FLAG_Z = res;
+      FLAG_V = VFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_roxl_16_di:
+   {
+      uint ea = EA_AY_DI_16();
+      uint src = m68ki_read_16(ea);
+      uint res = ROL_17(src | (XFLAG_AS_1() << 16), 1);
+
+      m68ki_resolve_flags();
+
+      FLAG_C = FLAG_X = res >> 8;
+      res = MASK_OUT_ABOVE_16(res);
+
+      m68ki_write_16(ea, res);
+
+      FLAG_N = NFLAG_16(res);
+      FLAG_Z = res;
+      FLAG_V = VFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_roxl_16_ix:
+   {
+      uint ea = EA_AY_IX_16();
+      uint src = m68ki_read_16(ea);
+      uint res = ROL_17(src | (XFLAG_AS_1() << 16), 1);
+
+      m68ki_resolve_flags();
+
+      FLAG_C = FLAG_X = res >> 8;
+      res = MASK_OUT_ABOVE_16(res);
+
+      m68ki_write_16(ea, res);
+
+      FLAG_N = NFLAG_16(res);
+      FLAG_Z = res;
+      FLAG_V = VFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_roxl_16_aw:
+   {
+      uint ea = EA_AW_16();
+      uint src = m68ki_read_16(ea);
+      uint res = ROL_17(src | (XFLAG_AS_1() << 16), 1);
+
+      m68ki_resolve_flags();
+
+      FLAG_C = FLAG_X = res >> 8;
+      res = MASK_OUT_ABOVE_16(res);
+
+      m68ki_write_16(ea, res);
+
+      FLAG_N = NFLAG_16(res);
+      FLAG_Z = res;
+      FLAG_V = VFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_roxl_16_al:
+   {
+      uint ea = EA_AL_16();
+      uint src = m68ki_read_16(ea);
+      uint res = ROL_17(src | (XFLAG_AS_1() << 16), 1);
+
+      m68ki_resolve_flags();
+
+      FLAG_C = FLAG_X = res >> 8;
+      res = MASK_OUT_ABOVE_16(res);
+
+      m68ki_write_16(ea, res);
+
+      FLAG_N = NFLAG_16(res);
+      FLAG_Z = res;
+      FLAG_V = VFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_rtd_32:
+   {
+      if(CPU_TYPE_IS_010_PLUS(CPU_TYPE))
+      {
+         uint new_pc = m68ki_pull_32();
+
+         m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
+         REG_A[7] = MASK_OUT_ABOVE_32(REG_A[7] + MAKE_INT_16(OPER_I_16()));
+         m68ki_jump(new_pc);
+         goto m68k_op_rtd_32_done;
+      }
+      m68ki_exception_illegal();
+   }
+m68k_op_rtd_32_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_rte_32:
+   {
+      if(FLAG_S)
+      {
+         uint new_sr;
+         uint new_pc;
+         uint format_word;
+
+         m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
+
+         if(CPU_TYPE_IS_000(CPU_TYPE))
+         {
+            new_sr = m68ki_pull_16();
+            new_pc = m68ki_pull_32();
+            m68ki_jump(new_pc);
+            m68ki_set_sr(new_sr);
+
+            CPU_INSTR_MODE = INSTRUCTION_YES;
+            CPU_RUN_MODE = RUN_MODE_NORMAL;
+
+            goto m68k_op_rte_32_done;
+         }
+
+         if(CPU_TYPE_IS_010(CPU_TYPE))
+         {
+            format_word = m68ki_read_16(REG_A[7]+6) >> 12;
+            if(format_word == 0)
+            {
+               new_sr = m68ki_pull_16();
+               new_pc = m68ki_pull_32();
+               m68ki_fake_pull_16();	/* format word */
+               m68ki_jump(new_pc);
+               m68ki_set_sr(new_sr);
+               CPU_INSTR_MODE = INSTRUCTION_YES;
+               CPU_RUN_MODE = RUN_MODE_NORMAL;
+               goto m68k_op_rte_32_done;
+            }
+            CPU_INSTR_MODE = INSTRUCTION_YES;
+            CPU_RUN_MODE = RUN_MODE_NORMAL;
+            /* Not handling bus fault (9) */
+            m68ki_exception_format_error();
+            goto m68k_op_rte_32_done;
+         }
+
+         /* Otherwise it's 020 */
+m68k_op_rte_32_rte_loop:
+         format_word = m68ki_read_16(REG_A[7]+6) >> 12;
+         switch(format_word)
+         {
+            case 0: /* Normal */
+               new_sr = m68ki_pull_16();
+               new_pc = m68ki_pull_32();
+               m68ki_fake_pull_16();	/* format word */
+               m68ki_jump(new_pc);
+               m68ki_set_sr(new_sr);
+               CPU_INSTR_MODE = INSTRUCTION_YES;
+               CPU_RUN_MODE = RUN_MODE_NORMAL;
+               goto m68k_op_rte_32_done;
+            case 1: /* Throwaway */
+               new_sr = m68ki_pull_16();
+               m68ki_fake_pull_32();	/* program counter */
+               m68ki_fake_pull_16();	/* format word */
+               m68ki_set_sr_noint(new_sr);
+               goto m68k_op_rte_32_rte_loop;
+            case 2: /* Trap */
+               new_sr = m68ki_pull_16();
+               new_pc = m68ki_pull_32();
+               m68ki_fake_pull_16();	/* format word */
+               m68ki_fake_pull_32();	/* address */
+               m68ki_jump(new_pc);
+               m68ki_set_sr(new_sr);
+               CPU_INSTR_MODE = INSTRUCTION_YES;
+               CPU_RUN_MODE = RUN_MODE_NORMAL;
+               goto m68k_op_rte_32_done;
+         }
+         /* Not handling long or short bus fault */
+         CPU_INSTR_MODE = INSTRUCTION_YES;
+         CPU_RUN_MODE = RUN_MODE_NORMAL;
+         m68ki_exception_format_error();
+         goto m68k_op_rte_32_done;
+      }
+      m68ki_exception_privilege_violation();
+   }
+m68k_op_rte_32_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_rtm_32:
+   {
+      if(CPU_TYPE_IS_020_VARIANT(CPU_TYPE))
+      {
+         m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
+         M68K_DO_LOG((M68K_LOG_FILEHANDLE "%s at %08x: called unimplemented instruction %04x (%s)\n",
+                   m68ki_cpu_names[CPU_TYPE], ADDRESS_68K(REG_PC - 2), REG_IR,
+                   m68k_disassemble_quick(ADDRESS_68K(REG_PC - 2))));
+         goto m68k_op_rtm_32_done;
+      }
+      m68ki_exception_illegal();
+   }
+m68k_op_rtm_32_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_rtr_32:
+   {
+      m68ki_trace_t0();				   /* auto-disable (see m68kcpu.h) */
+      m68ki_set_ccr(m68ki_pull_16());
+      m68ki_jump(m68ki_pull_32());
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_rts_32:
+   {
+      m68ki_trace_t0();				   /* auto-disable (see m68kcpu.h) */
+      m68ki_jump(m68ki_pull_32());
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_sbcd_8_rr:
+   {
+      uint* r_dst = &DX;
+      uint src = DY;
+      uint dst = *r_dst;
+      uint res = LOW_NIBBLE(dst) - LOW_NIBBLE(src) - XFLAG_AS_1();
+
+      m68ki_resolve_flags();
+
+      FLAG_V = ~res; /* Undefined V behavior */
+
+      if(res > 9)
+         res -= 6;
+      res += HIGH_NIBBLE(dst) - HIGH_NIBBLE(src);
+      FLAG_X = FLAG_C = (res > 0x99) << 8;
+      if(FLAG_C)
+         res += 0xa0;
+
+      res = MASK_OUT_ABOVE_8(res);
+
+      FLAG_V &= res; /* Undefined V behavior part II */
+      FLAG_N = NFLAG_8(res); /* Undefined N behavior */
+      FLAG_Z |= res;
+
+      *r_dst = MASK_OUT_BELOW_8(*r_dst) | res;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_sbcd_8_mm_ax7:
+   {
+      uint src = OPER_AY_PD_8();
+      uint ea  = EA_A7_PD_8();
+      uint dst = m68ki_read_8(ea);
+      uint res = LOW_NIBBLE(dst) - LOW_NIBBLE(src) - XFLAG_AS_1();
+
+      m68ki_resolve_flags();
+
+      FLAG_V = ~res; /* Undefined V behavior */
+
+      if(res > 9)
+         res -= 6;
+      res += HIGH_NIBBLE(dst) - HIGH_NIBBLE(src);
+      FLAG_X = FLAG_C = (res > 0x99) << 8;
+      if(FLAG_C)
+         res += 0xa0;
+
+      res = MASK_OUT_ABOVE_8(res);
+
+      FLAG_V &= res; /* Undefined V behavior part II */
+      FLAG_N = NFLAG_8(res); /* Undefined N behavior */
+      FLAG_Z |= res;
+
+      m68ki_write_8(ea, res);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_sbcd_8_mm_ay7:
+   {
+      uint src = OPER_A7_PD_8();
+      uint ea  = EA_AX_PD_8();
+      uint dst = m68ki_read_8(ea);
+      uint res = LOW_NIBBLE(dst) - LOW_NIBBLE(src) - XFLAG_AS_1();
+
+      m68ki_resolve_flags();
+
+      FLAG_V = ~res; /* Undefined V behavior */
+
+      if(res > 9)
+         res -= 6;
+      res += HIGH_NIBBLE(dst) - HIGH_NIBBLE(src);
+      FLAG_X = FLAG_C = (res > 0x99) << 8;
+      if(FLAG_C)
+         res += 0xa0;
+
+      res = MASK_OUT_ABOVE_8(res);
+
+      FLAG_V &= res; /* Undefined V behavior part II */
+      FLAG_N = NFLAG_8(res); /* Undefined N behavior */
+      FLAG_Z |= res;
+
+      m68ki_write_8(ea, res);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_sbcd_8_mm_axy7:
+   {
+      uint src = OPER_A7_PD_8();
+      uint ea  = EA_A7_PD_8();
+      uint dst = m68ki_read_8(ea);
+      uint res = LOW_NIBBLE(dst) - LOW_NIBBLE(src) - XFLAG_AS_1();
+
+      m68ki_resolve_flags();
+
+      FLAG_V = ~res; /* Undefined V behavior */
+
+      if(res > 9)
+         res -= 6;
+      res += HIGH_NIBBLE(dst) - HIGH_NIBBLE(src);
+      FLAG_X = FLAG_C = (res > 0x99) << 8;
+      if(FLAG_C)
+         res += 0xa0;
+
+      res = MASK_OUT_ABOVE_8(res);
+
+      FLAG_V &= res; /* Undefined V behavior part II */
+      FLAG_N = NFLAG_8(res); /* Undefined N behavior */
+      FLAG_Z |= res;
+
+      m68ki_write_8(ea, res);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_sbcd_8_mm:
+   {
+      uint src = OPER_AY_PD_8();
+      uint ea  = EA_AX_PD_8();
+      uint dst = m68ki_read_8(ea);
+      uint res = LOW_NIBBLE(dst) - LOW_NIBBLE(src) - XFLAG_AS_1();
+
+      m68ki_resolve_flags();
+
+      FLAG_V = ~res; /* Undefined V behavior */
+
+      if(res > 9)
+         res -= 6;
+      res += HIGH_NIBBLE(dst) - HIGH_NIBBLE(src);
+      FLAG_X = FLAG_C = (res > 0x99) << 8;
+      if(FLAG_C)
+         res += 0xa0;
+
+      res = MASK_OUT_ABOVE_8(res);
+
+      FLAG_V &= res; /* Undefined V behavior part II */
+      FLAG_N = NFLAG_8(res); /* Undefined N behavior */
+      FLAG_Z |= res;
+
+      m68ki_write_8(ea, res);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_st_8_d:
+   {
+      DY |= 0xff;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_st_8_ai:
+   {
+      m68ki_write_8(EA_AY_AI_8(), 0xff);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_st_8_pi:
+   {
+      m68ki_write_8(EA_AY_PI_8(), 0xff);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_st_8_pi7:
+   {
+      m68ki_write_8(EA_A7_PI_8(), 0xff);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_st_8_pd:
+   {
+      m68ki_write_8(EA_AY_PD_8(), 0xff);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_st_8_pd7:
+   {
+      m68ki_write_8(EA_A7_PD_8(), 0xff);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_st_8_di:
+   {
+      m68ki_write_8(EA_AY_DI_8(), 0xff);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_st_8_ix:
+   {
+      m68ki_write_8(EA_AY_IX_8(), 0xff);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_st_8_aw:
+   {
+      m68ki_write_8(EA_AW_8(), 0xff);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_st_8_al:
+   {
+      m68ki_write_8(EA_AL_8(), 0xff);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_sf_8_d:
+   {
+      DY &= 0xffffff00;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_sf_8_ai:
+   {
+      m68ki_write_8(EA_AY_AI_8(), 0);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_sf_8_pi:
+   {
+      m68ki_write_8(EA_AY_PI_8(), 0);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_sf_8_pi7:
+   {
+      m68ki_write_8(EA_A7_PI_8(), 0);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_sf_8_pd:
+   {
+      m68ki_write_8(EA_AY_PD_8(), 0);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_sf_8_pd7:
+   {
+      m68ki_write_8(EA_A7_PD_8(), 0);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_sf_8_di:
+   {
+      m68ki_write_8(EA_AY_DI_8(), 0);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_sf_8_ix:
+   {
+      m68ki_write_8(EA_AY_IX_8(), 0);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_sf_8_aw:
+   {
+      m68ki_write_8(EA_AW_8(), 0);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_sf_8_al:
+   {
+      m68ki_write_8(EA_AL_8(), 0);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_shi_8_d:
+   {
+      m68ki_resolve_flags();
+      if(COND_HI())
+      {
+         DY |= 0xff;
+         USE_CYCLES(CYC_SCC_R_TRUE);
+         goto m68k_op_shi_8_d_done;
+      }
+      DY &= 0xffffff00;
+   }
+m68k_op_shi_8_d_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_sls_8_d:
+   {
+      m68ki_resolve_flags();
+      if(COND_LS())
+      {
+         DY |= 0xff;
+         USE_CYCLES(CYC_SCC_R_TRUE);
+         goto m68k_op_sls_8_d_done;
+      }
+      DY &= 0xffffff00;
+   }
+m68k_op_sls_8_d_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_scc_8_d:
+   {
+      m68ki_resolve_flags();
+      if(COND_CC())
+      {
+         DY |= 0xff;
+         USE_CYCLES(CYC_SCC_R_TRUE);
+         goto m68k_op_scc_8_d_done;
+      }
+      DY &= 0xffffff00;
+   }
+m68k_op_scc_8_d_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_scs_8_d:
+   {
+      m68ki_resolve_flags();
+      if(COND_CS())
+      {
+         DY |= 0xff;
+         USE_CYCLES(CYC_SCC_R_TRUE);
+         goto m68k_op_scs_8_d_done;
+      }
+      DY &= 0xffffff00;
+   }
+m68k_op_scs_8_d_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_sne_8_d:
+   {
+      m68ki_resolve_flags();
+      if(COND_NE())
+      {
+         DY |= 0xff;
+         USE_CYCLES(CYC_SCC_R_TRUE);
+         goto m68k_op_sne_8_d_done;
+      }
+      DY &= 0xffffff00;
+   }
+m68k_op_sne_8_d_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_seq_8_d:
+   {
+      m68ki_resolve_flags();
+      if(COND_EQ())
+      {
+         DY |= 0xff;
+         USE_CYCLES(CYC_SCC_R_TRUE);
+         goto m68k_op_seq_8_d_done;
+      }
+      DY &= 0xffffff00;
+   }
+m68k_op_seq_8_d_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_svc_8_d:
+   {
+      m68ki_resolve_flags();
+      if(COND_VC())
+      {
+         DY |= 0xff;
+         USE_CYCLES(CYC_SCC_R_TRUE);
+         goto m68k_op_svc_8_d_done;
+      }
+      DY &= 0xffffff00;
+   }
+m68k_op_svc_8_d_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_svs_8_d:
+   {
+      m68ki_resolve_flags();
+      if(COND_VS())
+      {
+         DY |= 0xff;
+         USE_CYCLES(CYC_SCC_R_TRUE);
+         goto m68k_op_svs_8_d_done;
+      }
+      DY &= 0xffffff00;
+   }
+m68k_op_svs_8_d_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_spl_8_d:
+   {
+      m68ki_resolve_flags();
+      if(COND_PL())
+      {
+         DY |= 0xff;
+         USE_CYCLES(CYC_SCC_R_TRUE);
+         goto m68k_op_spl_8_d_done;
+      }
+      DY &= 0xffffff00;
+   }
+m68k_op_spl_8_d_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_smi_8_d:
+   {
+      m68ki_resolve_flags();
+      if(COND_MI())
+      {
+         DY |= 0xff;
+         USE_CYCLES(CYC_SCC_R_TRUE);
+         goto m68k_op_smi_8_d_done;
+      }
+      DY &= 0xffffff00;
+   }
+m68k_op_smi_8_d_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_sge_8_d:
+   {
+      m68ki_resolve_flags();
+      if(COND_GE())
+      {
+         DY |= 0xff;
+         USE_CYCLES(CYC_SCC_R_TRUE);
+         goto m68k_op_sge_8_d_done;
+      }
+      DY &= 0xffffff00;
+   }
+m68k_op_sge_8_d_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_slt_8_d:
+   {
+      m68ki_resolve_flags();
+      if(COND_LT())
+      {
+         DY |= 0xff;
+         USE_CYCLES(CYC_SCC_R_TRUE);
+         goto m68k_op_slt_8_d_done;
+      }
+      DY &= 0xffffff00;
+   }
+m68k_op_slt_8_d_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_sgt_8_d:
+   {
+      m68ki_resolve_flags();
+      if(COND_GT())
+      {
+         DY |= 0xff;
+         USE_CYCLES(CYC_SCC_R_TRUE);
+         goto m68k_op_sgt_8_d_done;
+      }
+      DY &= 0xffffff00;
+   }
+m68k_op_sgt_8_d_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_sle_8_d:
+   {
+      m68ki_resolve_flags();
+      if(COND_LE())
+      {
+         DY |= 0xff;
+         USE_CYCLES(CYC_SCC_R_TRUE);
+         goto m68k_op_sle_8_d_done;
+      }
+      DY &= 0xffffff00;
+   }
+m68k_op_sle_8_d_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_shi_8_ai:
+   {
+      m68ki_resolve_flags();
+      m68ki_write_8(EA_AY_AI_8(), COND_HI() ? 0xff : 0);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_shi_8_pi:
+   {
+      m68ki_resolve_flags();
+      m68ki_write_8(EA_AY_PI_8(), COND_HI() ? 0xff : 0);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_shi_8_pi7:
+   {
+      m68ki_resolve_flags();
+      m68ki_write_8(EA_A7_PI_8(), COND_HI() ? 0xff : 0);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_shi_8_pd:
+   {
+      m68ki_resolve_flags();
+      m68ki_write_8(EA_AY_PD_8(), COND_HI() ? 0xff : 0);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_shi_8_pd7:
+   {
+      m68ki_resolve_flags();
+      m68ki_write_8(EA_A7_PD_8(), COND_HI() ? 0xff : 0);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_shi_8_di:
+   {
+      m68ki_resolve_flags();
+      m68ki_write_8(EA_AY_DI_8(), COND_HI() ? 0xff : 0);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_shi_8_ix:
+   {
+      m68ki_resolve_flags();
+      m68ki_write_8(EA_AY_IX_8(), COND_HI() ? 0xff : 0);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_shi_8_aw:
+   {
+      m68ki_resolve_flags();
+      m68ki_write_8(EA_AW_8(), COND_HI() ? 0xff : 0);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_shi_8_al:
+   {
+      m68ki_resolve_flags();
+      m68ki_write_8(EA_AL_8(), COND_HI() ? 0xff : 0);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_sls_8_ai:
+   {
+      m68ki_resolve_flags();
+      m68ki_write_8(EA_AY_AI_8(), COND_LS() ? 0xff : 0);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_sls_8_pi:
+   {
+      m68ki_resolve_flags();
+      m68ki_write_8(EA_AY_PI_8(), COND_LS() ? 0xff : 0);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_sls_8_pi7:
+   {
+      m68ki_resolve_flags();
+      m68ki_write_8(EA_A7_PI_8(), COND_LS() ? 0xff : 0);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_sls_8_pd:
+   {
+      m68ki_resolve_flags();
+      m68ki_write_8(EA_AY_PD_8(), COND_LS() ? 0xff : 0);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_sls_8_pd7:
+   {
+      m68ki_resolve_flags();
+      m68ki_write_8(EA_A7_PD_8(), COND_LS() ? 0xff : 0);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_sls_8_di:
+   {
+      m68ki_resolve_flags();
+      m68ki_write_8(EA_AY_DI_8(), COND_LS() ? 0xff : 0);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_sls_8_ix:
+   {
+      m68ki_resolve_flags();
+      m68ki_write_8(EA_AY_IX_8(), COND_LS() ? 0xff : 0);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_sls_8_aw:
+   {
+      m68ki_resolve_flags();
+      m68ki_write_8(EA_AW_8(), COND_LS() ? 0xff : 0);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_sls_8_al:
+   {
+      m68ki_resolve_flags();
+      m68ki_write_8(EA_AL_8(), COND_LS() ? 0xff : 0);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_scc_8_ai:
+   {
+      m68ki_resolve_flags();
+      m68ki_write_8(EA_AY_AI_8(), COND_CC() ? 0xff : 0);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_scc_8_pi:
+   {
+      m68ki_resolve_flags();
+      m68ki_write_8(EA_AY_PI_8(), COND_CC() ? 0xff : 0);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_scc_8_pi7:
+   {
+      m68ki_resolve_flags();
+      m68ki_write_8(EA_A7_PI_8(), COND_CC() ? 0xff : 0);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_scc_8_pd:
+   {
+      m68ki_resolve_flags();
+      m68ki_write_8(EA_AY_PD_8(), COND_CC() ? 0xff : 0);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_scc_8_pd7:
+   {
+      m68ki_resolve_flags();
+      m68ki_write_8(EA_A7_PD_8(), COND_CC() ? 0xff : 0);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_scc_8_di:
+   {
+      m68ki_resolve_flags();
+      m68ki_write_8(EA_AY_DI_8(), COND_CC() ? 0xff : 0);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_scc_8_ix:
+   {
+      m68ki_resolve_flags();
+      m68ki_write_8(EA_AY_IX_8(), COND_CC() ? 0xff : 0);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_scc_8_aw:
+   {
+      m68ki_resolve_flags();
+      m68ki_write_8(EA_AW_8(), COND_CC() ? 0xff : 0);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_scc_8_al:
+   {
+      m68ki_resolve_flags();
+      m68ki_write_8(EA_AL_8(), COND_CC() ? 0xff : 0);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_scs_8_ai:
+   {
+      m68ki_resolve_flags();
+      m68ki_write_8(EA_AY_AI_8(), COND_CS() ? 0xff : 0);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_scs_8_pi:
+   {
+      m68ki_resolve_flags();
+      m68ki_write_8(EA_AY_PI_8(), COND_CS() ? 0xff : 0);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_scs_8_pi7:
+   {
+      m68ki_resolve_flags();
+      m68ki_write_8(EA_A7_PI_8(), COND_CS() ? 0xff : 0);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_scs_8_pd:
+   {
+      m68ki_resolve_flags();
+      m68ki_write_8(EA_AY_PD_8(), COND_CS() ? 0xff : 0);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_scs_8_pd7:
+   {
+      m68ki_resolve_flags();
+      m68ki_write_8(EA_A7_PD_8(), COND_CS() ? 0xff : 0);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_scs_8_di:
+   {
+      m68ki_resolve_flags();
+      m68ki_write_8(EA_AY_DI_8(), COND_CS() ? 0xff : 0);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_scs_8_ix:
+   {
+      m68ki_resolve_flags();
+      m68ki_write_8(EA_AY_IX_8(), COND_CS() ? 0xff : 0);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_scs_8_aw:
+   {
+      m68ki_resolve_flags();
+      m68ki_write_8(EA_AW_8(), COND_CS() ? 0xff : 0);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_scs_8_al:
+   {
+      m68ki_resolve_flags();
+      m68ki_write_8(EA_AL_8(), COND_CS() ? 0xff : 0);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_sne_8_ai:
+   {
+      m68ki_resolve_flags();
+      m68ki_write_8(EA_AY_AI_8(), COND_NE() ? 0xff : 0);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_sne_8_pi:
+   {
+      m68ki_resolve_flags();
+      m68ki_write_8(EA_AY_PI_8(), COND_NE() ? 0xff : 0);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_sne_8_pi7:
+   {
+      m68ki_resolve_flags();
+      m68ki_write_8(EA_A7_PI_8(), COND_NE() ? 0xff : 0);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_sne_8_pd:
+   {
+      m68ki_resolve_flags();
+      m68ki_write_8(EA_AY_PD_8(), COND_NE() ? 0xff : 0);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_sne_8_pd7:
+   {
+      m68ki_resolve_flags();
+      m68ki_write_8(EA_A7_PD_8(), COND_NE() ? 0xff : 0);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_sne_8_di:
+   {
+      m68ki_resolve_flags();
+      m68ki_write_8(EA_AY_DI_8(), COND_NE() ? 0xff : 0);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_sne_8_ix:
+   {
+      m68ki_resolve_flags();
+      m68ki_write_8(EA_AY_IX_8(), COND_NE() ? 0xff : 0);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_sne_8_aw:
+   {
+      m68ki_resolve_flags();
+      m68ki_write_8(EA_AW_8(), COND_NE() ? 0xff : 0);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_sne_8_al:
+   {
+      m68ki_resolve_flags();
+      m68ki_write_8(EA_AL_8(), COND_NE() ? 0xff : 0);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_seq_8_ai:
+   {
+      m68ki_resolve_flags();
+      m68ki_write_8(EA_AY_AI_8(), COND_EQ() ? 0xff : 0);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_seq_8_pi:
+   {
+      m68ki_resolve_flags();
+      m68ki_write_8(EA_AY_PI_8(), COND_EQ() ? 0xff : 0);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_seq_8_pi7:
+   {
+      m68ki_resolve_flags();
+      m68ki_write_8(EA_A7_PI_8(), COND_EQ() ? 0xff : 0);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_seq_8_pd:
+   {
+      m68ki_resolve_flags();
+      m68ki_write_8(EA_AY_PD_8(), COND_EQ() ? 0xff : 0);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_seq_8_pd7:
+   {
+      m68ki_resolve_flags();
+      m68ki_write_8(EA_A7_PD_8(), COND_EQ() ? 0xff : 0);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_seq_8_di:
+   {
+      m68ki_resolve_flags();
+      m68ki_write_8(EA_AY_DI_8(), COND_EQ() ? 0xff : 0);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_seq_8_ix:
+   {
+      m68ki_resolve_flags();
+      m68ki_write_8(EA_AY_IX_8(), COND_EQ() ? 0xff : 0);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_seq_8_aw:
+   {
+      m68ki_resolve_flags();
+      m68ki_write_8(EA_AW_8(), COND_EQ() ? 0xff : 0);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_seq_8_al:
+   {
+      m68ki_resolve_flags();
+      m68ki_write_8(EA_AL_8(), COND_EQ() ? 0xff : 0);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_svc_8_ai:
+   {
+      m68ki_resolve_flags();
+      m68ki_write_8(EA_AY_AI_8(), COND_VC() ? 0xff : 0);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_svc_8_pi:
+   {
+      m68ki_resolve_flags();
+      m68ki_write_8(EA_AY_PI_8(), COND_VC() ? 0xff : 0);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_svc_8_pi7:
+   {
+      m68ki_resolve_flags();
+      m68ki_write_8(EA_A7_PI_8(), COND_VC() ? 0xff : 0);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_svc_8_pd:
+   {
+      m68ki_resolve_flags();
+      m68ki_write_8(EA_AY_PD_8(), COND_VC() ? 0xff : 0);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_svc_8_pd7:
+   {
+      m68ki_resolve_flags();
+      m68ki_write_8(EA_A7_PD_8(), COND_VC() ? 0xff : 0);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_svc_8_di:
+   {
+      m68ki_resolve_flags();
+      m68ki_write_8(EA_AY_DI_8(), COND_VC() ? 0xff : 0);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_svc_8_ix:
+   {
+      m68ki_resolve_flags();
+      m68ki_write_8(EA_AY_IX_8(), COND_VC() ? 0xff : 0);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_svc_8_aw:
+   {
+      m68ki_resolve_flags();
+      m68ki_write_8(EA_AW_8(), COND_VC() ? 0xff : 0);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_svc_8_al:
+   {
+      m68ki_resolve_flags();
+      m68ki_write_8(EA_AL_8(), COND_VC() ? 0xff : 0);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_svs_8_ai:
+   {
+      m68ki_resolve_flags();
+      m68ki_write_8(EA_AY_AI_8(), COND_VS() ? 0xff : 0);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_svs_8_pi:
+   {
+      m68ki_resolve_flags();
+      m68ki_write_8(EA_AY_PI_8(), COND_VS() ? 0xff : 0);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_svs_8_pi7:
+   {
+      m68ki_resolve_flags();
+      m68ki_write_8(EA_A7_PI_8(), COND_VS() ? 0xff : 0);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_svs_8_pd:
+   {
+      m68ki_resolve_flags();
+      m68ki_write_8(EA_AY_PD_8(), COND_VS() ? 0xff : 0);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_svs_8_pd7:
+   {
+      m68ki_resolve_flags();
+      m68ki_write_8(EA_A7_PD_8(), COND_VS() ? 0xff : 0);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_svs_8_di:
+   {
+      m68ki_resolve_flags();
+      m68ki_write_8(EA_AY_DI_8(), COND_VS() ? 0xff : 0);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_svs_8_ix:
+   {
+      m68ki_resolve_flags();
+      m68ki_write_8(EA_AY_IX_8(), COND_VS() ? 0xff : 0);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_svs_8_aw:
+   {
+      m68ki_resolve_flags();
+      m68ki_write_8(EA_AW_8(), COND_VS() ? 0xff : 0);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_svs_8_al:
+   {
+      m68ki_resolve_flags();
+      m68ki_write_8(EA_AL_8(), COND_VS() ? 0xff : 0);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_spl_8_ai:
+   {
+      m68ki_resolve_flags();
+      m68ki_write_8(EA_AY_AI_8(), COND_PL() ? 0xff : 0);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_spl_8_pi:
+   {
+      m68ki_resolve_flags();
+      m68ki_write_8(EA_AY_PI_8(), COND_PL() ? 0xff : 0);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_spl_8_pi7:
+   {
+      m68ki_resolve_flags();
+      m68ki_write_8(EA_A7_PI_8(), COND_PL() ? 0xff : 0);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_spl_8_pd:
+   {
+      m68ki_resolve_flags();
+      m68ki_write_8(EA_AY_PD_8(), COND_PL() ? 0xff : 0);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_spl_8_pd7:
+   {
+      m68ki_resolve_flags();
+      m68ki_write_8(EA_A7_PD_8(), COND_PL() ? 0xff : 0);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_spl_8_di:
+   {
+      m68ki_resolve_flags();
+      m68ki_write_8(EA_AY_DI_8(), COND_PL() ? 0xff : 0);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_spl_8_ix:
+   {
+      m68ki_resolve_flags();
+      m68ki_write_8(EA_AY_IX_8(), COND_PL() ? 0xff : 0);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_spl_8_aw:
+   {
+      m68ki_resolve_flags();
+      m68ki_write_8(EA_AW_8(), COND_PL() ? 0xff : 0);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_spl_8_al:
+   {
+      m68ki_resolve_flags();
+      m68ki_write_8(EA_AL_8(), COND_PL() ? 0xff : 0);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_smi_8_ai:
+   {
+      m68ki_resolve_flags();
+      m68ki_write_8(EA_AY_AI_8(), COND_MI() ? 0xff : 0);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_smi_8_pi:
+   {
+      m68ki_resolve_flags();
+      m68ki_write_8(EA_AY_PI_8(), COND_MI() ? 0xff : 0);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_smi_8_pi7:
+   {
+      m68ki_resolve_flags();
+      m68ki_write_8(EA_A7_PI_8(), COND_MI() ? 0xff : 0);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_smi_8_pd:
+   {
+      m68ki_resolve_flags();
+      m68ki_write_8(EA_AY_PD_8(), COND_MI() ? 0xff : 0);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_smi_8_pd7:
+   {
+      m68ki_resolve_flags();
+      m68ki_write_8(EA_A7_PD_8(), COND_MI() ? 0xff : 0);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_smi_8_di:
+   {
+      m68ki_resolve_flags();
+      m68ki_write_8(EA_AY_DI_8(), COND_MI() ? 0xff : 0);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_smi_8_ix:
+   {
+      m68ki_resolve_flags();
+      m68ki_write_8(EA_AY_IX_8(), COND_MI() ? 0xff : 0);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_smi_8_aw:
+   {
+      m68ki_resolve_flags();
+      m68ki_write_8(EA_AW_8(), COND_MI() ? 0xff : 0);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_smi_8_al:
+   {
+      m68ki_resolve_flags();
+      m68ki_write_8(EA_AL_8(), COND_MI() ? 0xff : 0);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_sge_8_ai:
+   {
+      m68ki_resolve_flags();
+      m68ki_write_8(EA_AY_AI_8(), COND_GE() ? 0xff : 0);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_sge_8_pi:
+   {
+      m68ki_resolve_flags();
+      m68ki_write_8(EA_AY_PI_8(), COND_GE() ? 0xff : 0);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_sge_8_pi7:
+   {
+      m68ki_resolve_flags();
+      m68ki_write_8(EA_A7_PI_8(), COND_GE() ? 0xff : 0);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_sge_8_pd:
+   {
+      m68ki_resolve_flags();
+      m68ki_write_8(EA_AY_PD_8(), COND_GE() ? 0xff : 0);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_sge_8_pd7:
+   {
+      m68ki_resolve_flags();
+      m68ki_write_8(EA_A7_PD_8(), COND_GE() ? 0xff : 0);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_sge_8_di:
+   {
+      m68ki_resolve_flags();
+      m68ki_write_8(EA_AY_DI_8(), COND_GE() ? 0xff : 0);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_sge_8_ix:
+   {
+      m68ki_resolve_flags();
+      m68ki_write_8(EA_AY_IX_8(), COND_GE() ? 0xff : 0);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_sge_8_aw:
+   {
+      m68ki_resolve_flags();
+      m68ki_write_8(EA_AW_8(), COND_GE() ? 0xff : 0);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_sge_8_al:
+   {
+      m68ki_resolve_flags();
+      m68ki_write_8(EA_AL_8(), COND_GE() ? 0xff : 0);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_slt_8_ai:
+   {
+      m68ki_resolve_flags();
+      m68ki_write_8(EA_AY_AI_8(), COND_LT() ? 0xff : 0);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_slt_8_pi:
+   {
+      m68ki_resolve_flags();
+      m68ki_write_8(EA_AY_PI_8(), COND_LT() ? 0xff : 0);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_slt_8_pi7:
+   {
+      m68ki_resolve_flags();
+      m68ki_write_8(EA_A7_PI_8(), COND_LT() ? 0xff : 0);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_slt_8_pd:
+   {
+      m68ki_resolve_flags();
+      m68ki_write_8(EA_AY_PD_8(), COND_LT() ? 0xff : 0);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_slt_8_pd7:
+   {
+      m68ki_resolve_flags();
+      m68ki_write_8(EA_A7_PD_8(), COND_LT() ? 0xff : 0);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_slt_8_di:
+   {
+      m68ki_resolve_flags();
+      m68ki_write_8(EA_AY_DI_8(), COND_LT() ? 0xff : 0);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_slt_8_ix:
+   {
+      m68ki_resolve_flags();
+      m68ki_write_8(EA_AY_IX_8(), COND_LT() ? 0xff : 0);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_slt_8_aw:
+   {
+      m68ki_resolve_flags();
+      m68ki_write_8(EA_AW_8(), COND_LT() ? 0xff : 0);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_slt_8_al:
+   {
+      m68ki_resolve_flags();
+      m68ki_write_8(EA_AL_8(), COND_LT() ? 0xff : 0);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_sgt_8_ai:
+   {
+      m68ki_resolve_flags();
+      m68ki_write_8(EA_AY_AI_8(), COND_GT() ? 0xff : 0);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_sgt_8_pi:
+   {
+      m68ki_resolve_flags();
+      m68ki_write_8(EA_AY_PI_8(), COND_GT() ? 0xff : 0);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_sgt_8_pi7:
+   {
+      m68ki_resolve_flags();
+      m68ki_write_8(EA_A7_PI_8(), COND_GT() ? 0xff : 0);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_sgt_8_pd:
+   {
+      m68ki_resolve_flags();
+      m68ki_write_8(EA_AY_PD_8(), COND_GT() ? 0xff : 0);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_sgt_8_pd7:
+   {
+      m68ki_resolve_flags();
+      m68ki_write_8(EA_A7_PD_8(), COND_GT() ? 0xff : 0);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_sgt_8_di:
+   {
+      m68ki_resolve_flags();
+      m68ki_write_8(EA_AY_DI_8(), COND_GT() ? 0xff : 0);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_sgt_8_ix:
+   {
+      m68ki_resolve_flags();
+      m68ki_write_8(EA_AY_IX_8(), COND_GT() ? 0xff : 0);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_sgt_8_aw:
+   {
+      m68ki_resolve_flags();
+      m68ki_write_8(EA_AW_8(), COND_GT() ? 0xff : 0);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_sgt_8_al:
+   {
+      m68ki_resolve_flags();
+      m68ki_write_8(EA_AL_8(), COND_GT() ? 0xff : 0);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_sle_8_ai:
+   {
+      m68ki_resolve_flags();
+      m68ki_write_8(EA_AY_AI_8(), COND_LE() ? 0xff : 0);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_sle_8_pi:
+   {
+      m68ki_resolve_flags();
+      m68ki_write_8(EA_AY_PI_8(), COND_LE() ? 0xff : 0);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_sle_8_pi7:
+   {
+      m68ki_resolve_flags();
+      m68ki_write_8(EA_A7_PI_8(), COND_LE() ? 0xff : 0);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_sle_8_pd:
+   {
+      m68ki_resolve_flags();
+      m68ki_write_8(EA_AY_PD_8(), COND_LE() ? 0xff : 0);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_sle_8_pd7:
+   {
+      m68ki_resolve_flags();
+      m68ki_write_8(EA_A7_PD_8(), COND_LE() ? 0xff : 0);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_sle_8_di:
+   {
+      m68ki_resolve_flags();
+      m68ki_write_8(EA_AY_DI_8(), COND_LE() ? 0xff : 0);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_sle_8_ix:
+   {
+      m68ki_resolve_flags();
+      m68ki_write_8(EA_AY_IX_8(), COND_LE() ? 0xff : 0);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_sle_8_aw:
+   {
+      m68ki_resolve_flags();
+      m68ki_write_8(EA_AW_8(), COND_LE() ? 0xff : 0);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_sle_8_al:
+   {
+      m68ki_resolve_flags();
+      m68ki_write_8(EA_AL_8(), COND_LE() ? 0xff : 0);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_stop:
+   {
+      if(FLAG_S)
+      {
+         uint new_sr = OPER_I_16();
+         m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
+         CPU_STOPPED |= STOP_LEVEL_STOP;
+         m68ki_set_sr(new_sr);
+         if(m68ki_remaining_cycles >= CYC_INSTRUCTION[REG_IR])
+            m68ki_remaining_cycles = CYC_INSTRUCTION[REG_IR];
+         else
+            USE_ALL_CYCLES();
+         goto m68k_op_stop_done;
+      }
+      m68ki_exception_privilege_violation();
+   }
+m68k_op_stop_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_sub_8_er_d:
+   {
+      uint* r_dst = &DX;
+      uint src = MASK_OUT_ABOVE_8(DY);
+      uint dst = MASK_OUT_ABOVE_8(*r_dst);
+      uint res = dst - src;
+
+      m68ki_set_xnzvc_sub_8(src, dst, res);
+
+      *r_dst = MASK_OUT_BELOW_8(*r_dst) | MASK_OUT_ABOVE_8(res);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_sub_8_er_ai:
+   {
+      uint* r_dst = &DX;
+      uint src = OPER_AY_AI_8();
+      uint dst = MASK_OUT_ABOVE_8(*r_dst);
+      uint res = dst - src;
+
+      m68ki_set_xnzvc_sub_8(src, dst, res);
+
+      *r_dst = MASK_OUT_BELOW_8(*r_dst) | MASK_OUT_ABOVE_8(res);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_sub_8_er_pi:
+   {
+      uint* r_dst = &DX;
+      uint src = OPER_AY_PI_8();
+      uint dst = MASK_OUT_ABOVE_8(*r_dst);
+      uint res = dst - src;
+
+      m68ki_set_xnzvc_sub_8(src, dst, res);
+
+      *r_dst = MASK_OUT_BELOW_8(*r_dst) | MASK_OUT_ABOVE_8(res);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_sub_8_er_pi7:
+   {
+      uint* r_dst = &DX;
+      uint src = OPER_A7_PI_8();
+      uint dst = MASK_OUT_ABOVE_8(*r_dst);
+      uint res = dst - src;
+
+      m68ki_set_xnzvc_sub_8(src, dst, res);
+
+      *r_dst = MASK_OUT_BELOW_8(*r_dst) | MASK_OUT_ABOVE_8(res);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_sub_8_er_pd:
+   {
+      uint* r_dst = &DX;
+      uint src = OPER_AY_PD_8();
+      uint dst = MASK_OUT_ABOVE_8(*r_dst);
+      uint res = dst - src;
+
+      m68ki_set_xnzvc_sub_8(src, dst, res);
+
+      *r_dst = MASK_OUT_BELOW_8(*r_dst) | MASK_OUT_ABOVE_8(res);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_sub_8_er_pd7:
+   {
+      uint* r_dst = &DX;
+      uint src = OPER_A7_PD_8();
+      uint dst = MASK_OUT_ABOVE_8(*r_dst);
+      uint res = dst - src;
+
+      m68ki_set_xnzvc_sub_8(src, dst, res);
+
+      *r_dst = MASK_OUT_BELOW_8(*r_dst) | MASK_OUT_ABOVE_8(res);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_sub_8_er_di:
+   {
+      uint* r_dst = &DX;
+      uint src = OPER_AY_DI_8();
+      uint dst = MASK_OUT_ABOVE_8(*r_dst);
+      uint res = dst - src;
+
+      m68ki_set_xnzvc_sub_8(src, dst, res);
+
+      *r_dst = MASK_OUT_BELOW_8(*r_dst) | MASK_OUT_ABOVE_8(res);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_sub_8_er_ix:
+   {
+      uint* r_dst = &DX;
+      uint src = OPER_AY_IX_8();
+      uint dst = MASK_OUT_ABOVE_8(*r_dst);
+      uint res = dst - src;
+
+      m68ki_set_xnzvc_sub_8(src, dst, res);
+
+      *r_dst = MASK_OUT_BELOW_8(*r_dst) | MASK_OUT_ABOVE_8(res);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_sub_8_er_aw:
+   {
+      uint* r_dst = &DX;
+      uint src = OPER_AW_8();
+      uint dst = MASK_OUT_ABOVE_8(*r_dst);
+      uint res = dst - src;
+
+      m68ki_set_xnzvc_sub_8(src, dst, res);
+
+      *r_dst = MASK_OUT_BELOW_8(*r_dst) | MASK_OUT_ABOVE_8(res);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_sub_8_er_al:
+   {
+      uint* r_dst = &DX;
+      uint src = OPER_AL_8();
+      uint dst = MASK_OUT_ABOVE_8(*r_dst);
+      uint res = dst - src;
+
+      m68ki_set_xnzvc_sub_8(src, dst, res);
+
+      *r_dst = MASK_OUT_BELOW_8(*r_dst) | MASK_OUT_ABOVE_8(res);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_sub_8_er_pcdi:
+   {
+      uint* r_dst = &DX;
+      uint src = OPER_PCDI_8();
+      uint dst = MASK_OUT_ABOVE_8(*r_dst);
+      uint res = dst - src;
+
+      m68ki_set_xnzvc_sub_8(src, dst, res);
+
+      *r_dst = MASK_OUT_BELOW_8(*r_dst) | MASK_OUT_ABOVE_8(res);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_sub_8_er_pcix:
+   {
+      uint* r_dst = &DX;
+      uint src = OPER_PCIX_8();
+      uint dst = MASK_OUT_ABOVE_8(*r_dst);
+      uint res = dst - src;
+
+      m68ki_set_xnzvc_sub_8(src, dst, res);
+
+      *r_dst = MASK_OUT_BELOW_8(*r_dst) | MASK_OUT_ABOVE_8(res);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_sub_8_er_i:
+   {
+      uint* r_dst = &DX;
+      uint src = OPER_I_8();
+      uint dst = MASK_OUT_ABOVE_8(*r_dst);
+      uint res = dst - src;
+
+      m68ki_set_xnzvc_sub_8(src, dst, res);
+
+      *r_dst = MASK_OUT_BELOW_8(*r_dst) | MASK_OUT_ABOVE_8(res);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_sub_16_er_d:
+   {
+      uint* r_dst = &DX;
+      uint src = MASK_OUT_ABOVE_16(DY);
+      uint dst = MASK_OUT_ABOVE_16(*r_dst);
+      uint res = dst - src;
+
+      m68ki_set_xnzvc_sub_16(src, dst, res);
+
+      *r_dst = MASK_OUT_BELOW_16(*r_dst) | MASK_OUT_ABOVE_16(res);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_sub_16_er_a:
+   {
+      uint* r_dst = &DX;
+      uint src = MASK_OUT_ABOVE_16(AY);
+      uint dst = MASK_OUT_ABOVE_16(*r_dst);
+      uint res = dst - src;
+
+      m68ki_set_xnzvc_sub_16(src, dst, res);
+
+      *r_dst = MASK_OUT_BELOW_16(*r_dst) | MASK_OUT_ABOVE_16(res);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_sub_16_er_ai:
+   {
+      uint* r_dst = &DX;
+      uint src = OPER_AY_AI_16();
+      uint dst = MASK_OUT_ABOVE_16(*r_dst);
+      uint res = dst - src;
+
+      m68ki_set_xnzvc_sub_16(src, dst, res);
+
+      *r_dst = MASK_OUT_BELOW_16(*r_dst) | MASK_OUT_ABOVE_16(res);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_sub_16_er_pi:
+   {
+      uint* r_dst = &DX;
+      uint src = OPER_AY_PI_16();
+      uint dst = MASK_OUT_ABOVE_16(*r_dst);
+      uint res = dst - src;
+
+      m68ki_set_xnzvc_sub_16(src, dst, res);
+
+      *r_dst = MASK_OUT_BELOW_16(*r_dst) | MASK_OUT_ABOVE_16(res);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_sub_16_er_pd:
+   {
+      uint* r_dst = &DX;
+      uint src = OPER_AY_PD_16();
+      uint dst = MASK_OUT_ABOVE_16(*r_dst);
+      uint res = dst - src;
+
+      m68ki_set_xnzvc_sub_16(src, dst, res);
+
+      *r_dst = MASK_OUT_BELOW_16(*r_dst) | MASK_OUT_ABOVE_16(res);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_sub_16_er_di:
+   {
+      uint* r_dst = &DX;
+      uint src = OPER_AY_DI_16();
+      uint dst = MASK_OUT_ABOVE_16(*r_dst);
+      uint res = dst - src;
+
+      m68ki_set_xnzvc_sub_16(src, dst, res);
+
+      *r_dst = MASK_OUT_BELOW_16(*r_dst) | MASK_OUT_ABOVE_16(res);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_sub_16_er_ix:
+   {
+      uint* r_dst = &DX;
+      uint src = OPER_AY_IX_16();
+      uint dst = MASK_OUT_ABOVE_16(*r_dst);
+      uint res = dst - src;
+
+      m68ki_set_xnzvc_sub_16(src, dst, res);
+
+      *r_dst = MASK_OUT_BELOW_16(*r_dst) | MASK_OUT_ABOVE_16(res);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_sub_16_er_aw:
+   {
+      uint* r_dst = &DX;
+      uint src = OPER_AW_16();
+      uint dst = MASK_OUT_ABOVE_16(*r_dst);
+      uint res = dst - src;
+
+      m68ki_set_xnzvc_sub_16(src, dst, res);
+
+      *r_dst = MASK_OUT_BELOW_16(*r_dst) | MASK_OUT_ABOVE_16(res);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_sub_16_er_al:
+   {
+      uint* r_dst = &DX;
+      uint src = OPER_AL_16();
+      uint dst = MASK_OUT_ABOVE_16(*r_dst);
+      uint res = dst - src;
+
+      m68ki_set_xnzvc_sub_16(src, dst, res);
+
+      *r_dst = MASK_OUT_BELOW_16(*r_dst) | MASK_OUT_ABOVE_16(res);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_sub_16_er_pcdi:
+   {
+      uint* r_dst = &DX;
+      uint src = OPER_PCDI_16();
+      uint dst = MASK_OUT_ABOVE_16(*r_dst);
+      uint res = dst - src;
+
+      m68ki_set_xnzvc_sub_16(src, dst, res);
+
+      *r_dst = MASK_OUT_BELOW_16(*r_dst) | MASK_OUT_ABOVE_16(res);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_sub_16_er_pcix:
+   {
+      uint* r_dst = &DX;
+      uint src = OPER_PCIX_16();
+      uint dst = MASK_OUT_ABOVE_16(*r_dst);
+      uint res = dst - src;
+
+      m68ki_set_xnzvc_sub_16(src, dst, res);
+
+      *r_dst = MASK_OUT_BELOW_16(*r_dst) | MASK_OUT_ABOVE_16(res);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_sub_16_er_i:
+   {
+      uint* r_dst = &DX;
+      uint src = OPER_I_16();
+      uint dst = MASK_OUT_ABOVE_16(*r_dst);
+      uint res = dst - src;
+
+      m68ki_set_xnzvc_sub_16(src, dst, res);
+
+      *r_dst = MASK_OUT_BELOW_16(*r_dst) | MASK_OUT_ABOVE_16(res);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_sub_32_er_d:
+   {
+      uint* r_dst = &DX;
+      uint src = DY;
+      uint dst = *r_dst;
+      uint res = dst - src;
+
+      m68ki_set_xnzvc_sub_32(src, dst, res);
+
+      *r_dst = MASK_OUT_ABOVE_32(res);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_sub_32_er_a:
+   {
+      uint* r_dst = &DX;
+      uint src = AY;
+      uint dst = *r_dst;
+      uint res = dst - src;
+
+      m68ki_set_xnzvc_sub_32(src, dst, res);
+
+      *r_dst = MASK_OUT_ABOVE_32(res);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_sub_32_er_ai:
+   {
+      uint* r_dst = &DX;
+      uint src = OPER_AY_AI_32();
+      uint dst = *r_dst;
+      uint res = dst - src;
+
+      m68ki_set_xnzvc_sub_32(src, dst, res);
+
+      *r_dst = MASK_OUT_ABOVE_32(res);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_sub_32_er_pi:
+   {
+      uint* r_dst = &DX;
+      uint src = OPER_AY_PI_32();
+      uint dst = *r_dst;
+      uint res = dst - src;
+
+      m68ki_set_xnzvc_sub_32(src, dst, res);
+
+      *r_dst = MASK_OUT_ABOVE_32(res);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_sub_32_er_pd:
+   {
+      uint* r_dst = &DX;
+      uint src = OPER_AY_PD_32();
+      uint dst = *r_dst;
+      uint res = dst - src;
+
+      m68ki_set_xnzvc_sub_32(src, dst, res);
+
+      *r_dst = MASK_OUT_ABOVE_32(res);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_sub_32_er_di:
+   {
+      uint* r_dst = &DX;
+      uint src = OPER_AY_DI_32();
+      uint dst = *r_dst;
+      uint res = dst - src;
+
+      m68ki_set_xnzvc_sub_32(src, dst, res);
+
+      *r_dst = MASK_OUT_ABOVE_32(res);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_sub_32_er_ix:
+   {
+      uint* r_dst = &DX;
+      uint src = OPER_AY_IX_32();
+      uint dst = *r_dst;
+      uint res = dst - src;
+
+      m68ki_set_xnzvc_sub_32(src, dst, res);
+
+      *r_dst = MASK_OUT_ABOVE_32(res);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_sub_32_er_aw:
+   {
+      uint* r_dst = &DX;
+      uint src = OPER_AW_32();
+      uint dst = *r_dst;
+      uint res = dst - src;
+
+      m68ki_set_xnzvc_sub_32(src, dst, res);
+
+      *r_dst = MASK_OUT_ABOVE_32(res);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_sub_32_er_al:
+   {
+      uint* r_dst = &DX;
+      uint src = OPER_AL_32();
+      uint dst = *r_dst;
+      uint res = dst - src;
+
+      m68ki_set_xnzvc_sub_32(src, dst, res);
+
+      *r_dst = MASK_OUT_ABOVE_32(res);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_sub_32_er_pcdi:
+   {
+      uint* r_dst = &DX;
+      uint src = OPER_PCDI_32();
+      uint dst = *r_dst;
+      uint res = dst - src;
+
+      m68ki_set_xnzvc_sub_32(src, dst, res);
+
+      *r_dst = MASK_OUT_ABOVE_32(res);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_sub_32_er_pcix:
+   {
+      uint* r_dst = &DX;
+      uint src = OPER_PCIX_32();
+      uint dst = *r_dst;
+      uint res = dst - src;
+
+      m68ki_set_xnzvc_sub_32(src, dst, res);
+
+      *r_dst = MASK_OUT_ABOVE_32(res);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_sub_32_er_i:
+   {
+      uint* r_dst = &DX;
+      uint src = OPER_I_32();
+      uint dst = *r_dst;
+      uint res = dst - src;
+
+      m68ki_set_xnzvc_sub_32(src, dst, res);
+
+      *r_dst = MASK_OUT_ABOVE_32(res);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_sub_8_re_ai:
+   {
+      uint ea = EA_AY_AI_8();
+      uint src = MASK_OUT_ABOVE_8(DX);
+      uint dst = m68ki_read_8(ea);
+      uint res = dst - src;
+
+      m68ki_set_xnzvc_sub_8(src, dst, res);
+
+      m68ki_write_8(ea, MASK_OUT_ABOVE_8(res));
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_sub_8_re_pi:
+   {
+      uint ea = EA_AY_PI_8();
+      uint src = MASK_OUT_ABOVE_8(DX);
+      uint dst = m68ki_read_8(ea);
+      uint res = dst - src;
+
+      m68ki_set_xnzvc_sub_8(src, dst, res);
+
+      m68ki_write_8(ea, MASK_OUT_ABOVE_8(res));
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_sub_8_re_pi7:
+   {
+      uint ea = EA_A7_PI_8();
+      uint src = MASK_OUT_ABOVE_8(DX);
+      uint dst = m68ki_read_8(ea);
+      uint res = dst - src;
+
+      m68ki_set_xnzvc_sub_8(src, dst, res);
+
+      m68ki_write_8(ea, MASK_OUT_ABOVE_8(res));
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_sub_8_re_pd:
+   {
+      uint ea = EA_AY_PD_8();
+      uint src = MASK_OUT_ABOVE_8(DX);
+      uint dst = m68ki_read_8(ea);
+      uint res = dst - src;
+
+      m68ki_set_xnzvc_sub_8(src, dst, res);
+
+      m68ki_write_8(ea, MASK_OUT_ABOVE_8(res));
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_sub_8_re_pd7:
+   {
+      uint ea = EA_A7_PD_8();
+      uint src = MASK_OUT_ABOVE_8(DX);
+      uint dst = m68ki_read_8(ea);
+      uint res = dst - src;
+
+      m68ki_set_xnzvc_sub_8(src, dst, res);
+
+      m68ki_write_8(ea, MASK_OUT_ABOVE_8(res));
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_sub_8_re_di:
+   {
+      uint ea = EA_AY_DI_8();
+      uint src = MASK_OUT_ABOVE_8(DX);
+      uint dst = m68ki_read_8(ea);
+      uint res = dst - src;
+
+      m68ki_set_xnzvc_sub_8(src, dst, res);
+
+      m68ki_write_8(ea, MASK_OUT_ABOVE_8(res));
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_sub_8_re_ix:
+   {
+      uint ea = EA_AY_IX_8();
+      uint src = MASK_OUT_ABOVE_8(DX);
+      uint dst = m68ki_read_8(ea);
+      uint res = dst - src;
+
+      m68ki_set_xnzvc_sub_8(src, dst, res);
+
+      m68ki_write_8(ea, MASK_OUT_ABOVE_8(res));
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_sub_8_re_aw:
+   {
+      uint ea = EA_AW_8();
+      uint src = MASK_OUT_ABOVE_8(DX);
+      uint dst = m68ki_read_8(ea);
+      uint res = dst - src;
+
+      m68ki_set_xnzvc_sub_8(src, dst, res);
+
+      m68ki_write_8(ea, MASK_OUT_ABOVE_8(res));
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_sub_8_re_al:
+   {
+      uint ea = EA_AL_8();
+      uint src = MASK_OUT_ABOVE_8(DX);
+      uint dst = m68ki_read_8(ea);
+      uint res = dst - src;
+
+      m68ki_set_xnzvc_sub_8(src, dst, res);
+
+      m68ki_write_8(ea, MASK_OUT_ABOVE_8(res));
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_sub_16_re_ai:
+   {
+      uint ea = EA_AY_AI_16();
+      uint src = MASK_OUT_ABOVE_16(DX);
+      uint dst = m68ki_read_16(ea);
+      uint res = dst - src;
+
+      m68ki_set_xnzvc_sub_16(src, dst, res);
+
+      m68ki_write_16(ea, MASK_OUT_ABOVE_16(res));
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_sub_16_re_pi:
+   {
+      uint ea = EA_AY_PI_16();
+      uint src = MASK_OUT_ABOVE_16(DX);
+      uint dst = m68ki_read_16(ea);
+      uint res = dst - src;
+
+      m68ki_set_xnzvc_sub_16(src, dst, res);
+
+      m68ki_write_16(ea, MASK_OUT_ABOVE_16(res));
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_sub_16_re_pd:
+   {
+      uint ea = EA_AY_PD_16();
+      uint src = MASK_OUT_ABOVE_16(DX);
+      uint dst = m68ki_read_16(ea);
+      uint res = dst - src;
+
+      m68ki_set_xnzvc_sub_16(src, dst, res);
+
+      m68ki_write_16(ea, MASK_OUT_ABOVE_16(res));
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_sub_16_re_di:
+   {
+      uint ea = EA_AY_DI_16();
+      uint src = MASK_OUT_ABOVE_16(DX);
+      uint dst = m68ki_read_16(ea);
+      uint res = dst - src;
+
+      m68ki_set_xnzvc_sub_16(src, dst, res);
+
+      m68ki_write_16(ea, MASK_OUT_ABOVE_16(res));
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_sub_16_re_ix:
+   {
+      uint ea = EA_AY_IX_16();
+      uint src = MASK_OUT_ABOVE_16(DX);
+      uint dst = m68ki_read_16(ea);
+      uint res = dst - src;
+
+      m68ki_set_xnzvc_sub_16(src, dst, res);
+
+      m68ki_write_16(ea, MASK_OUT_ABOVE_16(res));
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_sub_16_re_aw:
+   {
+      uint ea = EA_AW_16();
+      uint src = MASK_OUT_ABOVE_16(DX);
+      uint dst = m68ki_read_16(ea);
+      uint res = dst - src;
+
+      m68ki_set_xnzvc_sub_16(src, dst, res);
+
+      m68ki_write_16(ea, MASK_OUT_ABOVE_16(res));
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_sub_16_re_al:
+   {
+      uint ea = EA_AL_16();
+      uint src = MASK_OUT_ABOVE_16(DX);
+      uint dst = m68ki_read_16(ea);
+      uint res = dst - src;
+
+      m68ki_set_xnzvc_sub_16(src, dst, res);
+
+      m68ki_write_16(ea, MASK_OUT_ABOVE_16(res));
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_sub_32_re_ai:
+   {
+      uint ea = EA_AY_AI_32();
+      uint src = DX;
+      uint dst = m68ki_read_32(ea);
+      uint res = dst - src;
+
+      m68ki_set_xnzvc_sub_32(src, dst, res);
+
+      m68ki_write_32(ea, MASK_OUT_ABOVE_32(res));
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_sub_32_re_pi:
+   {
+      uint ea = EA_AY_PI_32();
+      uint src = DX;
+      uint dst = m68ki_read_32(ea);
+      uint res = dst - src;
+
+      m68ki_set_xnzvc_sub_32(src, dst, res);
+
+      m68ki_write_32(ea, MASK_OUT_ABOVE_32(res));
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_sub_32_re_pd:
+   {
+      uint ea = EA_AY_PD_32();
+      uint src = DX;
+      uint dst = m68ki_read_32(ea);
+      uint res = dst - src;
+
+      m68ki_set_xnzvc_sub_32(src, dst, res);
+
+      m68ki_write_32(ea, MASK_OUT_ABOVE_32(res));
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_sub_32_re_di:
+   {
+      uint ea = EA_AY_DI_32();
+      uint src = DX;
+      uint dst = m68ki_read_32(ea);
+      uint res = dst - src;
+
+      m68ki_set_xnzvc_sub_32(src, dst, res);
+
+      m68ki_write_32(ea, MASK_OUT_ABOVE_32(res));
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_sub_32_re_ix:
+   {
+      uint ea = EA_AY_IX_32();
+      uint src = DX;
+      uint dst = m68ki_read_32(ea);
+      uint res = dst - src;
+
+      m68ki_set_xnzvc_sub_32(src, dst, res);
+
+      m68ki_write_32(ea, MASK_OUT_ABOVE_32(res));
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_sub_32_re_aw:
+   {
+      uint ea = EA_AW_32();
+      uint src = DX;
+      uint dst = m68ki_read_32(ea);
+      uint res = dst - src;
+
+      m68ki_set_xnzvc_sub_32(src, dst, res);
+
+      m68ki_write_32(ea, MASK_OUT_ABOVE_32(res));
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_sub_32_re_al:
+   {
+      uint ea = EA_AL_32();
+      uint src = DX;
+      uint dst = m68ki_read_32(ea);
+      uint res = dst - src;
+
+      m68ki_set_xnzvc_sub_32(src, dst, res);
+
+      m68ki_write_32(ea, MASK_OUT_ABOVE_32(res));
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_suba_16_d:
+   {
+      uint* r_dst = &AX;
+
+      *r_dst = MASK_OUT_ABOVE_32(*r_dst - MAKE_INT_16(DY));
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_suba_16_a:
+   {
+      uint* r_dst = &AX;
+
+      *r_dst = MASK_OUT_ABOVE_32(*r_dst - MAKE_INT_16(AY));
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_suba_16_ai:
+   {
+      signed short src = MAKE_INT_16(OPER_AY_AI_16());
+      uint* r_dst = &AX;
+
+      *r_dst = MASK_OUT_ABOVE_32(*r_dst - src);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_suba_16_pi:
+   {
+      signed short src = MAKE_INT_16(OPER_AY_PI_16());
+      uint* r_dst = &AX;
+
+      *r_dst = MASK_OUT_ABOVE_32(*r_dst - src);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_suba_16_pd:
+   {
+      signed short src = MAKE_INT_16(OPER_AY_PD_16());
+      uint* r_dst = &AX;
+
+      *r_dst = MASK_OUT_ABOVE_32(*r_dst - src);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_suba_16_di:
+   {
+      signed short src = MAKE_INT_16(OPER_AY_DI_16());
+      uint* r_dst = &AX;
+
+      *r_dst = MASK_OUT_ABOVE_32(*r_dst - src);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_suba_16_ix:
+   {
+      signed short src = MAKE_INT_16(OPER_AY_IX_16());
+      uint* r_dst = &AX;
+
+      *r_dst = MASK_OUT_ABOVE_32(*r_dst - src);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_suba_16_aw:
+   {
+      signed short src = MAKE_INT_16(OPER_AW_16());
+      uint* r_dst = &AX;
+
+      *r_dst = MASK_OUT_ABOVE_32(*r_dst - src);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_suba_16_al:
+   {
+      signed short src = MAKE_INT_16(OPER_AL_16());
+      uint* r_dst = &AX;
+
+      *r_dst = MASK_OUT_ABOVE_32(*r_dst - src);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_suba_16_pcdi:
+   {
+      signed short src = MAKE_INT_16(OPER_PCDI_16());
+      uint* r_dst = &AX;
+
+      *r_dst = MASK_OUT_ABOVE_32(*r_dst - src);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_suba_16_pcix:
+   {
+      signed short src = MAKE_INT_16(OPER_PCIX_16());
+      uint* r_dst = &AX;
+
+      *r_dst = MASK_OUT_ABOVE_32(*r_dst - src);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_suba_16_i:
+   {
+      signed short src = MAKE_INT_16(OPER_I_16());
+      uint* r_dst = &AX;
+
+      *r_dst = MASK_OUT_ABOVE_32(*r_dst - src);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_suba_32_d:
+   {
+      uint* r_dst = &AX;
+
+      *r_dst = MASK_OUT_ABOVE_32(*r_dst - DY);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_suba_32_a:
+   {
+      uint* r_dst = &AX;
+
+      *r_dst = MASK_OUT_ABOVE_32(*r_dst - AY);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_suba_32_ai:
+   {
+      uint src = OPER_AY_AI_32();
+      uint* r_dst = &AX;
+
+      *r_dst = MASK_OUT_ABOVE_32(*r_dst - src);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_suba_32_pi:
+   {
+      uint src = OPER_AY_PI_32();
+      uint* r_dst = &AX;
+
+      *r_dst = MASK_OUT_ABOVE_32(*r_dst - src);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_suba_32_pd:
+   {
+      uint src = OPER_AY_PD_32();
+      uint* r_dst = &AX;
+
+      *r_dst = MASK_OUT_ABOVE_32(*r_dst - src);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_suba_32_di:
+   {
+      uint src = OPER_AY_DI_32();
+      uint* r_dst = &AX;
+
+      *r_dst = MASK_OUT_ABOVE_32(*r_dst - src);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_suba_32_ix:
+   {
+      uint src = OPER_AY_IX_32();
+      uint* r_dst = &AX;
+
+      *r_dst = MASK_OUT_ABOVE_32(*r_dst - src);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_suba_32_aw:
+   {
+      uint src = OPER_AW_32();
+      uint* r_dst = &AX;
+
+      *r_dst = MASK_OUT_ABOVE_32(*r_dst - src);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_suba_32_al:
+   {
+      uint src = OPER_AL_32();
+      uint* r_dst = &AX;
+
+      *r_dst = MASK_OUT_ABOVE_32(*r_dst - src);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_suba_32_pcdi:
+   {
+      uint src = OPER_PCDI_32();
+      uint* r_dst = &AX;
+
+      *r_dst = MASK_OUT_ABOVE_32(*r_dst - src);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_suba_32_pcix:
+   {
+      uint src = OPER_PCIX_32();
+      uint* r_dst = &AX;
+
+      *r_dst = MASK_OUT_ABOVE_32(*r_dst - src);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_suba_32_i:
+   {
+      uint src = OPER_I_32();
+      uint* r_dst = &AX;
+
+      *r_dst = MASK_OUT_ABOVE_32(*r_dst - src);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_subi_8_d:
+   {
+      uint* r_dst = &DY;
+      uint src = OPER_I_8();
+      uint dst = MASK_OUT_ABOVE_8(*r_dst);
+      uint res = dst - src;
+
+      m68ki_set_xnzvc_sub_8(src, dst, res);
+
+      *r_dst = MASK_OUT_BELOW_8(*r_dst) | MASK_OUT_ABOVE_8(res);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_subi_8_ai:
+   {
+      uint src = OPER_I_8();
+      uint ea = EA_AY_AI_8();
+      uint dst = m68ki_read_8(ea);
+      uint res = dst - src;
+
+      m68ki_set_xnzvc_sub_8(src, dst, res);
+
+      m68ki_write_8(ea, MASK_OUT_ABOVE_8(res));
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_subi_8_pi:
+   {
+      uint src = OPER_I_8();
+      uint ea = EA_AY_PI_8();
+      uint dst = m68ki_read_8(ea);
+      uint res = dst - src;
+
+      m68ki_set_xnzvc_sub_8(src, dst, res);
+
+      m68ki_write_8(ea, MASK_OUT_ABOVE_8(res));
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_subi_8_pi7:
+   {
+      uint src = OPER_I_8();
+      uint ea = EA_A7_PI_8();
+      uint dst = m68ki_read_8(ea);
+      uint res = dst - src;
+
+      m68ki_set_xnzvc_sub_8(src, dst, res);
+
+      m68ki_write_8(ea, MASK_OUT_ABOVE_8(res));
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_subi_8_pd:
+   {
+      uint src = OPER_I_8();
+      uint ea = EA_AY_PD_8();
+      uint dst = m68ki_read_8(ea);
+      uint res = dst - src;
+
+      m68ki_set_xnzvc_sub_8(src, dst, res);
+
+      m68ki_write_8(ea, MASK_OUT_ABOVE_8(res));
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_subi_8_pd7:
+   {
+      uint src = OPER_I_8();
+      uint ea = EA_A7_PD_8();
+      uint dst = m68ki_read_8(ea);
+      uint res = dst - src;
+
+      m68ki_set_xnzvc_sub_8(src, dst, res);
+
+      m68ki_write_8(ea, MASK_OUT_ABOVE_8(res));
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_subi_8_di:
+   {
+      uint src = OPER_I_8();
+      uint ea = EA_AY_DI_8();
+      uint dst = m68ki_read_8(ea);
+      uint res = dst - src;
+
+      m68ki_set_xnzvc_sub_8(src, dst, res);
+
+      m68ki_write_8(ea, MASK_OUT_ABOVE_8(res));
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_subi_8_ix:
+   {
+      uint src = OPER_I_8();
+      uint ea = EA_AY_IX_8();
+      uint dst = m68ki_read_8(ea);
+      uint res = dst - src;
+
+      m68ki_set_xnzvc_sub_8(src, dst, res);
+
+      m68ki_write_8(ea, MASK_OUT_ABOVE_8(res));
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_subi_8_aw:
+   {
+      uint src = OPER_I_8();
+      uint ea = EA_AW_8();
+      uint dst = m68ki_read_8(ea);
+      uint res = dst - src;
+
+      m68ki_set_xnzvc_sub_8(src, dst, res);
+
+      m68ki_write_8(ea, MASK_OUT_ABOVE_8(res));
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_subi_8_al:
+   {
+      uint src = OPER_I_8();
+      uint ea = EA_AL_8();
+      uint dst = m68ki_read_8(ea);
+      uint res = dst - src;
+
+      m68ki_set_xnzvc_sub_8(src, dst, res);
+
+      m68ki_write_8(ea, MASK_OUT_ABOVE_8(res));
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_subi_16_d:
+   {
+      uint* r_dst = &DY;
+      uint src = OPER_I_16();
+      uint dst = MASK_OUT_ABOVE_16(*r_dst);
+      uint res = dst - src;
+
+      m68ki_set_xnzvc_sub_16(src, dst, res);
+
+      *r_dst = MASK_OUT_BELOW_16(*r_dst) | MASK_OUT_ABOVE_16(res);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_subi_16_ai:
+   {
+      uint src = OPER_I_16();
+      uint ea = EA_AY_AI_16();
+      uint dst = m68ki_read_16(ea);
+      uint res = dst - src;
+
+      m68ki_set_xnzvc_sub_16(src, dst, res);
+
+      m68ki_write_16(ea, MASK_OUT_ABOVE_16(res));
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_subi_16_pi:
+   {
+      uint src = OPER_I_16();
+      uint ea = EA_AY_PI_16();
+      uint dst = m68ki_read_16(ea);
+      uint res = dst - src;
+
+      m68ki_set_xnzvc_sub_16(src, dst, res);
+
+      m68ki_write_16(ea, MASK_OUT_ABOVE_16(res));
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_subi_16_pd:
+   {
+      uint src = OPER_I_16();
+      uint ea = EA_AY_PD_16();
+      uint dst = m68ki_read_16(ea);
+      uint res = dst - src;
+
+      m68ki_set_xnzvc_sub_16(src, dst, res);
+
+      m68ki_write_16(ea, MASK_OUT_ABOVE_16(res));
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_subi_16_di:
+   {
+      uint src = OPER_I_16();
+      uint ea = EA_AY_DI_16();
+      uint dst = m68ki_read_16(ea);
+      uint res = dst - src;
+
+      m68ki_set_xnzvc_sub_16(src, dst, res);
+
+      m68ki_write_16(ea, MASK_OUT_ABOVE_16(res));
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_subi_16_ix:
+   {
+      uint src = OPER_I_16();
+      uint ea = EA_AY_IX_16();
+      uint dst = m68ki_read_16(ea);
+      uint res = dst - src;
+
+      m68ki_set_xnzvc_sub_16(src, dst, res);
+
+      m68ki_write_16(ea, MASK_OUT_ABOVE_16(res));
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_subi_16_aw:
+   {
+      uint src = OPER_I_16();
+      uint ea = EA_AW_16();
+      uint dst = m68ki_read_16(ea);
+      uint res = dst - src;
+
+      m68ki_set_xnzvc_sub_16(src, dst, res);
+
+      m68ki_write_16(ea, MASK_OUT_ABOVE_16(res));
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_subi_16_al:
+   {
+      uint src = OPER_I_16();
+      uint ea = EA_AL_16();
+      uint dst = m68ki_read_16(ea);
+      uint res = dst - src;
+
+      m68ki_set_xnzvc_sub_16(src, dst, res);
+
+      m68ki_write_16(ea, MASK_OUT_ABOVE_16(res));
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_subi_32_d:
+   {
+      uint* r_dst = &DY;
+      uint src = OPER_I_32();
+      uint dst = *r_dst;
+      uint res = dst - src;
+
+      m68ki_set_xnzvc_sub_32(src, dst, res);
+
+      *r_dst = MASK_OUT_ABOVE_32(res);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_subi_32_ai:
+   {
+      uint src = OPER_I_32();
+      uint ea = EA_AY_AI_32();
+      uint dst = m68ki_read_32(ea);
+      uint res = dst - src;
+
+      m68ki_set_xnzvc_sub_32(src, dst, res);
+
+      m68ki_write_32(ea, MASK_OUT_ABOVE_32(res));
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_subi_32_pi:
+   {
+      uint src = OPER_I_32();
+      uint ea = EA_AY_PI_32();
+      uint dst = m68ki_read_32(ea);
+      uint res = dst - src;
+
+      m68ki_set_xnzvc_sub_32(src, dst, res);
+
+      m68ki_write_32(ea, MASK_OUT_ABOVE_32(res));
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_subi_32_pd:
+   {
+      uint src = OPER_I_32();
+      uint ea = EA_AY_PD_32();
+      uint dst = m68ki_read_32(ea);
+      uint res = dst - src;
+
+      m68ki_set_xnzvc_sub_32(src, dst, res);
+
+      m68ki_write_32(ea, MASK_OUT_ABOVE_32(res));
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_subi_32_di:
+   {
+      uint src = OPER_I_32();
+      uint ea = EA_AY_DI_32();
+      uint dst = m68ki_read_32(ea);
+      uint res = dst - src;
+
+      m68ki_set_xnzvc_sub_32(src, dst, res);
+
+      m68ki_write_32(ea, MASK_OUT_ABOVE_32(res));
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_subi_32_ix:
+   {
+      uint src = OPER_I_32();
+      uint ea = EA_AY_IX_32();
+      uint dst = m68ki_read_32(ea);
+      uint res = dst - src;
+
+      m68ki_set_xnzvc_sub_32(src, dst, res);
+
+      m68ki_write_32(ea, MASK_OUT_ABOVE_32(res));
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_subi_32_aw:
+   {
+      uint src = OPER_I_32();
+      uint ea = EA_AW_32();
+      uint dst = m68ki_read_32(ea);
+      uint res = dst - src;
+
+      m68ki_set_xnzvc_sub_32(src, dst, res);
+
+      m68ki_write_32(ea, MASK_OUT_ABOVE_32(res));
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_subi_32_al:
+   {
+      uint src = OPER_I_32();
+      uint ea = EA_AL_32();
+      uint dst = m68ki_read_32(ea);
+      uint res = dst - src;
+
+      m68ki_set_xnzvc_sub_32(src, dst, res);
+
+      m68ki_write_32(ea, MASK_OUT_ABOVE_32(res));
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_subq_8_d:
+   {
+      uint* r_dst = &DY;
+      uint src = (((REG_IR >> 9) - 1) & 7) + 1;
+      uint dst = MASK_OUT_ABOVE_8(*r_dst);
+      uint res = dst - src;
+
+      m68ki_set_xnzvc_sub_8(src, dst, res);
+
+      *r_dst = MASK_OUT_BELOW_8(*r_dst) | MASK_OUT_ABOVE_8(res);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_subq_8_ai:
+   {
+      uint src = (((REG_IR >> 9) - 1) & 7) + 1;
+      uint ea = EA_AY_AI_8();
+      uint dst = m68ki_read_8(ea);
+      uint res = dst - src;
+
+      m68ki_set_xnzvc_sub_8(src, dst, res);
+
+      m68ki_write_8(ea, MASK_OUT_ABOVE_8(res));
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_subq_8_pi:
+   {
+      uint src = (((REG_IR >> 9) - 1) & 7) + 1;
+      uint ea = EA_AY_PI_8();
+      uint dst = m68ki_read_8(ea);
+      uint res = dst - src;
+
+      m68ki_set_xnzvc_sub_8(src, dst, res);
+
+      m68ki_write_8(ea, MASK_OUT_ABOVE_8(res));
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_subq_8_pi7:
+   {
+      uint src = (((REG_IR >> 9) - 1) & 7) + 1;
+      uint ea = EA_A7_PI_8();
+      uint dst = m68ki_read_8(ea);
+      uint res = dst - src;
+
+      m68ki_set_xnzvc_sub_8(src, dst, res);
+
+      m68ki_write_8(ea, MASK_OUT_ABOVE_8(res));
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_subq_8_pd:
+   {
+      uint src = (((REG_IR >> 9) - 1) & 7) + 1;
+      uint ea = EA_AY_PD_8();
+      uint dst = m68ki_read_8(ea);
+      uint res = dst - src;
+
+      m68ki_set_xnzvc_sub_8(src, dst, res);
+
+      m68ki_write_8(ea, MASK_OUT_ABOVE_8(res));
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_subq_8_pd7:
+   {
+      uint src = (((REG_IR >> 9) - 1) & 7) + 1;
+      uint ea = EA_A7_PD_8();
+      uint dst = m68ki_read_8(ea);
+      uint res = dst - src;
+
+      m68ki_set_xnzvc_sub_8(src, dst, res);
+
+      m68ki_write_8(ea, MASK_OUT_ABOVE_8(res));
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_subq_8_di:
+   {
+      uint src = (((REG_IR >> 9) - 1) & 7) + 1;
+      uint ea = EA_AY_DI_8();
+      uint dst = m68ki_read_8(ea);
+      uint res = dst - src;
+
+      m68ki_set_xnzvc_sub_8(src, dst, res);
+
+      m68ki_write_8(ea, MASK_OUT_ABOVE_8(res));
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_subq_8_ix:
+   {
+      uint src = (((REG_IR >> 9) - 1) & 7) + 1;
+      uint ea = EA_AY_IX_8();
+      uint dst = m68ki_read_8(ea);
+      uint res = dst - src;
+
+      m68ki_set_xnzvc_sub_8(src, dst, res);
+
+      m68ki_write_8(ea, MASK_OUT_ABOVE_8(res));
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_subq_8_aw:
+   {
+      uint src = (((REG_IR >> 9) - 1) & 7) + 1;
+      uint ea = EA_AW_8();
+      uint dst = m68ki_read_8(ea);
+      uint res = dst - src;
+
+      m68ki_set_xnzvc_sub_8(src, dst, res);
+
+      m68ki_write_8(ea, MASK_OUT_ABOVE_8(res));
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_subq_8_al:
+   {
+      uint src = (((REG_IR >> 9) - 1) & 7) + 1;
+      uint ea = EA_AL_8();
+      uint dst = m68ki_read_8(ea);
+      uint res = dst - src;
+
+      m68ki_set_xnzvc_sub_8(src, dst, res);
+
+      m68ki_write_8(ea, MASK_OUT_ABOVE_8(res));
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_subq_16_d:
+   {
+      uint* r_dst = &DY;
+      uint src = (((REG_IR >> 9) - 1) & 7) + 1;
+      uint dst = MASK_OUT_ABOVE_16(*r_dst);
+      uint res = dst - src;
+
+      m68ki_set_xnzvc_sub_16(src, dst, res);
+
+      *r_dst = MASK_OUT_BELOW_16(*r_dst) | MASK_OUT_ABOVE_16(res);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_subq_16_a:
+   {
+      uint* r_dst = &AY;
+
+      *r_dst = MASK_OUT_ABOVE_32(*r_dst - ((((REG_IR >> 9) - 1) & 7) + 1));
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_subq_16_ai:
+   {
+      uint src = (((REG_IR >> 9) - 1) & 7) + 1;
+      uint ea = EA_AY_AI_16();
+      uint dst = m68ki_read_16(ea);
+      uint res = dst - src;
+
+      m68ki_set_xnzvc_sub_16(src, dst, res);
+
+      m68ki_write_16(ea, MASK_OUT_ABOVE_16(res));
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_subq_16_pi:
+   {
+      uint src = (((REG_IR >> 9) - 1) & 7) + 1;
+      uint ea = EA_AY_PI_16();
+      uint dst = m68ki_read_16(ea);
+      uint res = dst - src;
+
+      m68ki_set_xnzvc_sub_16(src, dst, res);
+
+      m68ki_write_16(ea, MASK_OUT_ABOVE_16(res));
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_subq_16_pd:
+   {
+      uint src = (((REG_IR >> 9) - 1) & 7) + 1;
+      uint ea = EA_AY_PD_16();
+      uint dst = m68ki_read_16(ea);
+      uint res = dst - src;
+
+      m68ki_set_xnzvc_sub_16(src, dst, res);
+
+      m68ki_write_16(ea, MASK_OUT_ABOVE_16(res));
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_subq_16_di:
+   {
+      uint src = (((REG_IR >> 9) - 1) & 7) + 1;
+      uint ea = EA_AY_DI_16();
+      uint dst = m68ki_read_16(ea);
+      uint res = dst - src;
+
+      m68ki_set_xnzvc_sub_16(src, dst, res);
+
+      m68ki_write_16(ea, MASK_OUT_ABOVE_16(res));
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_subq_16_ix:
+   {
+      uint src = (((REG_IR >> 9) - 1) & 7) + 1;
+      uint ea = EA_AY_IX_16();
+      uint dst = m68ki_read_16(ea);
+      uint res = dst - src;
+
+      m68ki_set_xnzvc_sub_16(src, dst, res);
+
+      m68ki_write_16(ea, MASK_OUT_ABOVE_16(res));
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_subq_16_aw:
+   {
+      uint src = (((REG_IR >> 9) - 1) & 7) + 1;
+      uint ea = EA_AW_16();
+      uint dst = m68ki_read_16(ea);
+      uint res = dst - src;
+
+      m68ki_set_xnzvc_sub_16(src, dst, res);
+
+      m68ki_write_16(ea, MASK_OUT_ABOVE_16(res));
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_subq_16_al:
+   {
+      uint src = (((REG_IR >> 9) - 1) & 7) + 1;
+      uint ea = EA_AL_16();
+      uint dst = m68ki_read_16(ea);
+      uint res = dst - src;
+
+      m68ki_set_xnzvc_sub_16(src, dst, res);
+
+      m68ki_write_16(ea, MASK_OUT_ABOVE_16(res));
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_subq_32_d:
+   {
+      uint* r_dst = &DY;
+      uint src = (((REG_IR >> 9) - 1) & 7) + 1;
+      uint dst = *r_dst;
+      uint res = dst - src;
+
+      m68ki_set_xnzvc_sub_32(src, dst, res);
+
+      *r_dst = MASK_OUT_ABOVE_32(res);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_subq_32_a:
+   {
+      uint* r_dst = &AY;
+
+      *r_dst = MASK_OUT_ABOVE_32(*r_dst - ((((REG_IR >> 9) - 1) & 7) + 1));
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_subq_32_ai:
+   {
+      uint src = (((REG_IR >> 9) - 1) & 7) + 1;
+      uint ea = EA_AY_AI_32();
+      uint dst = m68ki_read_32(ea);
+      uint res = dst - src;
+
+      m68ki_set_xnzvc_sub_32(src, dst, res);
+
+      m68ki_write_32(ea, MASK_OUT_ABOVE_32(res));
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_subq_32_pi:
+   {
+      uint src = (((REG_IR >> 9) - 1) & 7) + 1;
+      uint ea = EA_AY_PI_32();
+      uint dst = m68ki_read_32(ea);
+      uint res = dst - src;
+
+      m68ki_set_xnzvc_sub_32(src, dst, res);
+
+      m68ki_write_32(ea, MASK_OUT_ABOVE_32(res));
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_subq_32_pd:
+   {
+      uint src = (((REG_IR >> 9) - 1) & 7) + 1;
+      uint ea = EA_AY_PD_32();
+      uint dst = m68ki_read_32(ea);
+      uint res = dst - src;
+
+      m68ki_set_xnzvc_sub_32(src, dst, res);
+
+      m68ki_write_32(ea, MASK_OUT_ABOVE_32(res));
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_subq_32_di:
+   {
+      uint src = (((REG_IR >> 9) - 1) & 7) + 1;
+      uint ea = EA_AY_DI_32();
+      uint dst = m68ki_read_32(ea);
+      uint res = dst - src;
+
+      m68ki_set_xnzvc_sub_32(src, dst, res);
+
+      m68ki_write_32(ea, MASK_OUT_ABOVE_32(res));
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_subq_32_ix:
+   {
+      uint src = (((REG_IR >> 9) - 1) & 7) + 1;
+      uint ea = EA_AY_IX_32();
+      uint dst = m68ki_read_32(ea);
+      uint res = dst - src;
+
+      m68ki_set_xnzvc_sub_32(src, dst, res);
+
+      m68ki_write_32(ea, MASK_OUT_ABOVE_32(res));
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_subq_32_aw:
+   {
+      uint src = (((REG_IR >> 9) - 1) & 7) + 1;
+      uint ea = EA_AW_32();
+      uint dst = m68ki_read_32(ea);
+      uint res = dst - src;
+
+      m68ki_set_xnzvc_sub_32(src, dst, res);
+
+      m68ki_write_32(ea, MASK_OUT_ABOVE_32(res));
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_subq_32_al:
+   {
+      uint src = (((REG_IR >> 9) - 1) & 7) + 1;
+      uint ea = EA_AL_32();
+      uint dst = m68ki_read_32(ea);
+      uint res = dst - src;
+
+      m68ki_set_xnzvc_sub_32(src, dst, res);
+
+      m68ki_write_32(ea, MASK_OUT_ABOVE_32(res));
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_subx_8_rr:
+   {
+      uint* r_dst = &DX;
+      uint src = MASK_OUT_ABOVE_8(DY);
+      uint dst = MASK_OUT_ABOVE_8(*r_dst);
+      uint res = dst - src - XFLAG_AS_1();
+
+      m68ki_resolve_flags();
+
+      FLAG_N = NFLAG_8(res);
+      FLAG_X = FLAG_C = CFLAG_8(res);
+      FLAG_V = VFLAG_SUB_8(src, dst, res);
+
+      res = MASK_OUT_ABOVE_8(res);
+      FLAG_Z |= res;
+
+      *r_dst = MASK_OUT_BELOW_8(*r_dst) | res;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_subx_16_rr:
+   {
+      uint* r_dst = &DX;
+      uint src = MASK_OUT_ABOVE_16(DY);
+      uint dst = MASK_OUT_ABOVE_16(*r_dst);
+      uint res = dst - src - XFLAG_AS_1();
+
+      m68ki_resolve_flags();
+
+      FLAG_N = NFLAG_16(res);
+      FLAG_X = FLAG_C = CFLAG_16(res);
+      FLAG_V = VFLAG_SUB_16(src, dst, res);
+
+      res = MASK_OUT_ABOVE_16(res);
+      FLAG_Z |= res;
+
+      *r_dst = MASK_OUT_BELOW_16(*r_dst) | res;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_subx_32_rr:
+   {
+      uint* r_dst = &DX;
+      uint src = DY;
+      uint dst = *r_dst;
+      uint res = dst - src - XFLAG_AS_1();
+
+      m68ki_resolve_flags();
+
+      FLAG_N = NFLAG_32(res);
+      FLAG_X = FLAG_C = CFLAG_SUB_32(src, dst, res);
+      FLAG_V = VFLAG_SUB_32(src, dst, res);
+
+      res = MASK_OUT_ABOVE_32(res);
+      FLAG_Z |= res;
+
+      *r_dst = res;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_subx_8_mm_ax7:
+   {
+      uint src = OPER_AY_PD_8();
+      uint ea  = EA_A7_PD_8();
+      uint dst = m68ki_read_8(ea);
+      uint res = dst - src - XFLAG_AS_1();
+
+      m68ki_resolve_flags();
+
+      FLAG_N = NFLAG_8(res);
+      FLAG_X = FLAG_C = CFLAG_8(res);
+      FLAG_V = VFLAG_SUB_8(src, dst, res);
+
+      res = MASK_OUT_ABOVE_8(res);
+      FLAG_Z |= res;
+
+      m68ki_write_8(ea, res);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_subx_8_mm_ay7:
+   {
+      uint src = OPER_A7_PD_8();
+      uint ea  = EA_AX_PD_8();
+      uint dst = m68ki_read_8(ea);
+      uint res = dst - src - XFLAG_AS_1();
+
+      m68ki_resolve_flags();
+
+      FLAG_N = NFLAG_8(res);
+      FLAG_X = FLAG_C = CFLAG_8(res);
+      FLAG_V = VFLAG_SUB_8(src, dst, res);
+
+      res = MASK_OUT_ABOVE_8(res);
+      FLAG_Z |= res;
+
+      m68ki_write_8(ea, res);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_subx_8_mm_axy7:
+   {
+      uint src = OPER_A7_PD_8();
+      uint ea  = EA_A7_PD_8();
+      uint dst = m68ki_read_8(ea);
+      uint res = dst - src - XFLAG_AS_1();
+
+      m68ki_resolve_flags();
+
+      FLAG_N = NFLAG_8(res);
+      FLAG_X = FLAG_C = CFLAG_8(res);
+      FLAG_V = VFLAG_SUB_8(src, dst, res);
+
+      res = MASK_OUT_ABOVE_8(res);
+      FLAG_Z |= res;
+
+      m68ki_write_8(ea, res);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_subx_8_mm:
+   {
+      uint src = OPER_AY_PD_8();
+      uint ea  = EA_AX_PD_8();
+      uint dst = m68ki_read_8(ea);
+      uint res = dst - src - XFLAG_AS_1();
+
+      m68ki_resolve_flags();
+
+      FLAG_N = NFLAG_8(res);
+      FLAG_X = FLAG_C = CFLAG_8(res);
+      FLAG_V = VFLAG_SUB_8(src, dst, res);
+
+      res = MASK_OUT_ABOVE_8(res);
+      FLAG_Z |= res;
+
+      m68ki_write_8(ea, res);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_subx_16_mm:
+   {
+      uint src = OPER_AY_PD_16();
+      uint ea  = EA_AX_PD_16();
+      uint dst = m68ki_read_16(ea);
+      uint res = dst - src - XFLAG_AS_1();
+
+      m68ki_resolve_flags();
+
+      FLAG_N = NFLAG_16(res);
+      FLAG_X = FLAG_C = CFLAG_16(res);
+      FLAG_V = VFLAG_SUB_16(src, dst, res);
+
+      res = MASK_OUT_ABOVE_16(res);
+      FLAG_Z |= res;
+
+      m68ki_write_16(ea, res);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_subx_32_mm:
+   {
+      uint src = OPER_AY_PD_32();
+      uint ea  = EA_AX_PD_32();
+      uint dst = m68ki_read_32(ea);
+      uint res = dst - src - XFLAG_AS_1();
+
+      m68ki_resolve_flags();
+
+      FLAG_N = NFLAG_32(res);
+      FLAG_X = FLAG_C = CFLAG_SUB_32(src, dst, res);
+      FLAG_V = VFLAG_SUB_32(src, dst, res);
+
+      res = MASK_OUT_ABOVE_32(res);
+      FLAG_Z |= res;
+
+      m68ki_write_32(ea, res);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_swap_32:
+   {
+      uint* r_dst = &DY;
+
+      m68ki_resolve_flags();
+
+      FLAG_Z = MASK_OUT_ABOVE_32(*r_dst<<16);
+      *r_dst = (*r_dst>>16) | FLAG_Z;
+
+      FLAG_Z = *r_dst;
+      FLAG_N = NFLAG_32(*r_dst);
+      FLAG_C = CFLAG_CLEAR;
+      FLAG_V = VFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_tas_8_d:
+   {
+      uint* r_dst = &DY;
+
+      m68ki_discard_lazy_flags();
+      FLAG_Z = MASK_OUT_ABOVE_8(*r_dst);
+      FLAG_N = NFLAG_8(*r_dst);
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+      *r_dst |= 0x80;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_tas_8_ai:
+   {
+      uint ea = EA_AY_AI_8();
+      uint dst = m68ki_read_8(ea);
+
+      m68ki_discard_lazy_flags();
+      FLAG_Z = dst;
+      FLAG_N = NFLAG_8(dst);
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+      m68ki_write_8(ea, dst | 0x80);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_tas_8_pi:
+   {
+      uint ea = EA_AY_PI_8();
+      uint dst = m68ki_read_8(ea);
+
+      m68ki_discard_lazy_flags();
+      FLAG_Z = dst;
+      FLAG_N = NFLAG_8(dst);
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+      m68ki_write_8(ea, dst | 0x80);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_tas_8_pi7:
+   {
+      uint ea = EA_A7_PI_8();
+      uint dst = m68ki_read_8(ea);
+
+      m68ki_discard_lazy_flags();
+      FLAG_Z = dst;
+      FLAG_N = NFLAG_8(dst);
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+      m68ki_write_8(ea, dst | 0x80);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_tas_8_pd:
+   {
+      uint ea = EA_AY_PD_8();
+      uint dst = m68ki_read_8(ea);
+
+      m68ki_discard_lazy_flags();
+      FLAG_Z = dst;
+      FLAG_N = NFLAG_8(dst);
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+      m68ki_write_8(ea, dst | 0x80);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_tas_8_pd7:
+   {
+      uint ea = EA_A7_PD_8();
+      uint dst = m68ki_read_8(ea);
+
+      m68ki_discard_lazy_flags();
+      FLAG_Z = dst;
+      FLAG_N = NFLAG_8(dst);
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+      m68ki_write_8(ea, dst | 0x80);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_tas_8_di:
+   {
+      uint ea = EA_AY_DI_8();
+      uint dst = m68ki_read_8(ea);
+
+      m68ki_discard_lazy_flags();
+      FLAG_Z = dst;
+      FLAG_N = NFLAG_8(dst);
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+      m68ki_write_8(ea, dst | 0x80);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_tas_8_ix:
+   {
+      uint ea = EA_AY_IX_8();
+      uint dst = m68ki_read_8(ea);
+
+      m68ki_discard_lazy_flags();
+      FLAG_Z = dst;
+      FLAG_N = NFLAG_8(dst);
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+      m68ki_write_8(ea, dst | 0x80);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_tas_8_aw:
+   {
+      uint ea = EA_AW_8();
+      uint dst = m68ki_read_8(ea);
+
+      m68ki_discard_lazy_flags();
+      FLAG_Z = dst;
+      FLAG_N = NFLAG_8(dst);
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+      m68ki_write_8(ea, dst | 0x80);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_tas_8_al:
+   {
+      uint ea = EA_AL_8();
+      uint dst = m68ki_read_8(ea);
+
+      m68ki_discard_lazy_flags();
+      FLAG_Z = dst;
+      FLAG_N = NFLAG_8(dst);
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+      m68ki_write_8(ea, dst | 0x80);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_trap:
+   {
+      /* Trap#n stacks exception frame type 0 */
+      m68ki_exception_trapN(EXCEPTION_TRAP_BASE + (REG_IR & 0xf));	/* HJB 990403 */
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_trapt:
+   {
+      if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+      {
+         m68ki_exception_trap(EXCEPTION_TRAPV);	/* HJB 990403 */
+         goto m68k_op_trapt_done;
+      }
+      m68ki_exception_illegal();
+   }
+m68k_op_trapt_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_trapt_16:
+   {
+      if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+      {
+         m68ki_exception_trap(EXCEPTION_TRAPV);	/* HJB 990403 */
+         goto m68k_op_trapt_16_done;
+      }
+      m68ki_exception_illegal();
+   }
+m68k_op_trapt_16_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_trapt_32:
+   {
+      if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+      {
+         m68ki_exception_trap(EXCEPTION_TRAPV);	/* HJB 990403 */
+         goto m68k_op_trapt_32_done;
+      }
+      m68ki_exception_illegal();
+   }
+m68k_op_trapt_32_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_trapf:
+   {
+      if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+      {
+         goto m68k_op_trapf_done;
+      }
+      m68ki_exception_illegal();
+   }
+m68k_op_trapf_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_trapf_16:
+   {
+      if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+      {
+         REG_PC += 2;
+         goto m68k_op_trapf_16_done;
+      }
+      m68ki_exception_illegal();
+   }
+m68k_op_trapf_16_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_trapf_32:
+   {
+      if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+      {
+         REG_PC += 4;
+         goto m68k_op_trapf_32_done;
+      }
+      m68ki_exception_illegal();
+   }
+m68k_op_trapf_32_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_traphi:
+   {
+      m68ki_resolve_flags();
+      if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+      {
+         if(COND_HI())
+            m68ki_exception_trap(EXCEPTION_TRAPV);	/* HJB 990403 */
+         goto m68k_op_traphi_done;
+      }
+      m68ki_exception_illegal();
+   }
+m68k_op_traphi_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_trapls:
+   {
+      m68ki_resolve_flags();
+      if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+      {
+         if(COND_LS())
+            m68ki_exception_trap(EXCEPTION_TRAPV);	/* HJB 990403 */
+         goto m68k_op_trapls_done;
+      }
+      m68ki_exception_illegal();
+   }
+m68k_op_trapls_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_trapcc:
+   {
+      m68ki_resolve_flags();
+      if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+      {
+         if(COND_CC())
+            m68ki_exception_trap(EXCEPTION_TRAPV);	/* HJB 990403 */
+         goto m68k_op_trapcc_done;
+      }
+      m68ki_exception_illegal();
+   }
+m68k_op_trapcc_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_trapcs:
+   {
+      m68ki_resolve_flags();
+      if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+      {
+         if(COND_CS())
+            m68ki_exception_trap(EXCEPTION_TRAPV);	/* HJB 990403 */
+         goto m68k_op_trapcs_done;
+      }
+      m68ki_exception_illegal();
+   }
+m68k_op_trapcs_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_trapne:
+   {
+      m68ki_resolve_flags();
+      if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+      {
+         if(COND_NE())
+            m68ki_exception_trap(EXCEPTION_TRAPV);	/* HJB 990403 */
+         goto m68k_op_trapne_done;
+      }
+      m68ki_exception_illegal();
+   }
+m68k_op_trapne_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_trapeq:
+   {
+      m68ki_resolve_flags();
+      if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+      {
+         if(COND_EQ())
+            m68ki_exception_trap(EXCEPTION_TRAPV);	/* HJB 990403 */
+         goto m68k_op_trapeq_done;
+      }
+      m68ki_exception_illegal();
+   }
+m68k_op_trapeq_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_trapvc:
+   {
+      m68ki_resolve_flags();
+      if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+      {
+         if(COND_VC())
+            m68ki_exception_trap(EXCEPTION_TRAPV);	/* HJB 990403 */
+         goto m68k_op_trapvc_done;
+      }
+      m68ki_exception_illegal();
+   }
+m68k_op_trapvc_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_trapvs:
+   {
+      m68ki_resolve_flags();
+      if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+      {
+         if(COND_VS())
+            m68ki_exception_trap(EXCEPTION_TRAPV);	/* HJB 990403 */
+         goto m68k_op_trapvs_done;
+      }
+      m68ki_exception_illegal();
+   }
+m68k_op_trapvs_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_trappl:
+   {
+      m68ki_resolve_flags();
+      if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+      {
+         if(COND_PL())
+            m68ki_exception_trap(EXCEPTION_TRAPV);	/* HJB 990403 */
+         goto m68k_op_trappl_done;
+      }
+      m68ki_exception_illegal();
+   }
+m68k_op_trappl_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_trapmi:
+   {
+      m68ki_resolve_flags();
+      if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+      {
+         if(COND_MI())
+            m68ki_exception_trap(EXCEPTION_TRAPV);	/* HJB 990403 */
+         goto m68k_op_trapmi_done;
+      }
+      m68ki_exception_illegal();
+   }
+m68k_op_trapmi_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_trapge:
+   {
+      m68ki_resolve_flags();
+      if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+      {
+         if(COND_GE())
+            m68ki_exception_trap(EXCEPTION_TRAPV);	/* HJB 990403 */
+         goto m68k_op_trapge_done;
+      }
+      m68ki_exception_illegal();
+   }
+m68k_op_trapge_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_traplt:
+   {
+      m68ki_resolve_flags();
+      if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+      {
+         if(COND_LT())
+            m68ki_exception_trap(EXCEPTION_TRAPV);	/* HJB 990403 */
+         goto m68k_op_traplt_done;
+      }
+      m68ki_exception_illegal();
+   }
+m68k_op_traplt_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_trapgt:
+   {
+      m68ki_resolve_flags();
+      if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+      {
+         if(COND_GT())
+            m68ki_exception_trap(EXCEPTION_TRAPV);	/* HJB 990403 */
+         goto m68k_op_trapgt_done;
+      }
+      m68ki_exception_illegal();
+   }
+m68k_op_trapgt_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_traple:
+   {
+      m68ki_resolve_flags();
+      if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+      {
+         if(COND_LE())
+            m68ki_exception_trap(EXCEPTION_TRAPV);	/* HJB 990403 */
+         goto m68k_op_traple_done;
+      }
+      m68ki_exception_illegal();
+   }
+m68k_op_traple_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_traphi_16:
+   {
+      m68ki_resolve_flags();
+      if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+      {
+         if(COND_HI())
+         {
+            m68ki_exception_trap(EXCEPTION_TRAPV);	/* HJB 990403 */
+            goto m68k_op_traphi_16_done;
+         }
+         REG_PC += 2;
+         goto m68k_op_traphi_16_done;
+      }
+      m68ki_exception_illegal();
+   }
+m68k_op_traphi_16_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_trapls_16:
+   {
+      m68ki_resolve_flags();
+      if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+      {
+         if(COND_LS())
+         {
+            m68ki_exception_trap(EXCEPTION_TRAPV);	/* HJB 990403 */
+            goto m68k_op_trapls_16_done;
+         }
+         REG_PC += 2;
+         goto m68k_op_trapls_16_done;
+      }
+      m68ki_exception_illegal();
+   }
+m68k_op_trapls_16_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_trapcc_16:
+   {
+      m68ki_resolve_flags();
+      if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+      {
+         if(COND_CC())
+         {
+            m68ki_exception_trap(EXCEPTION_TRAPV);	/* HJB 990403 */
+            goto m68k_op_trapcc_16_done;
+         }
+         REG_PC += 2;
+         goto m68k_op_trapcc_16_done;
+      }
+      m68ki_exception_illegal();
+   }
+m68k_op_trapcc_16_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_trapcs_16:
+   {
+      m68ki_resolve_flags();
+      if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+      {
+         if(COND_CS())
+         {
+            m68ki_exception_trap(EXCEPTION_TRAPV);	/* HJB 990403 */
+            goto m68k_op_trapcs_16_done;
+         }
+         REG_PC += 2;
+         goto m68k_op_trapcs_16_done;
+      }
+      m68ki_exception_illegal();
+   }
+m68k_op_trapcs_16_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_trapne_16:
+   {
+      m68ki_resolve_flags();
+      if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+      {
+         if(COND_NE())
+         {
+            m68ki_exception_trap(EXCEPTION_TRAPV);	/* HJB 990403 */
+            goto m68k_op_trapne_16_done;
+         }
+         REG_PC += 2;
+         goto m68k_op_trapne_16_done;
+      }
+      m68ki_exception_illegal();
+   }
+m68k_op_trapne_16_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_trapeq_16:
+   {
+      m68ki_resolve_flags();
+      if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+      {
+         if(COND_EQ())
+         {
+            m68ki_exception_trap(EXCEPTION_TRAPV);	/* HJB 990403 */
+            goto m68k_op_trapeq_16_done;
+         }
+         REG_PC += 2;
+         goto m68k_op_trapeq_16_done;
+      }
+      m68ki_exception_illegal();
+   }
+m68k_op_trapeq_16_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_trapvc_16:
+   {
+      m68ki_resolve_flags();
+      if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+      {
+         if(COND_VC())
+         {
+            m68ki_exception_trap(EXCEPTION_TRAPV);	/* HJB 990403 */
+            goto m68k_op_trapvc_16_done;
+         }
+         REG_PC += 2;
+         goto m68k_op_trapvc_16_done;
+      }
+      m68ki_exception_illegal();
+   }
+m68k_op_trapvc_16_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_trapvs_16:
+   {
+      m68ki_resolve_flags();
+      if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+      {
+         if(COND_VS())
+         {
+            m68ki_exception_trap(EXCEPTION_TRAPV);	/* HJB 990403 */
+            goto m68k_op_trapvs_16_done;
+         }
+         REG_PC += 2;
+         goto m68k_op_trapvs_16_done;
+      }
+      m68ki_exception_illegal();
+   }
+m68k_op_trapvs_16_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_trappl_16:
+   {
+      m68ki_resolve_flags();
+      if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+      {
+         if(COND_PL())
+         {
+            m68ki_exception_trap(EXCEPTION_TRAPV);	/* HJB 990403 */
+            goto m68k_op_trappl_16_done;
+         }
+         REG_PC += 2;
+         goto m68k_op_trappl_16_done;
+      }
+      m68ki_exception_illegal();
+   }
+m68k_op_trappl_16_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_trapmi_16:
+   {
+      m68ki_resolve_flags();
+      if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+      {
+         if(COND_MI())
+         {
+            m68ki_exception_trap(EXCEPTION_TRAPV);	/* HJB 990403 */
+            goto m68k_op_trapmi_16_done;
+         }
+         REG_PC += 2;
+         goto m68k_op_trapmi_16_done;
+      }
+      m68ki_exception_illegal();
+   }
+m68k_op_trapmi_16_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_trapge_16:
+   {
+      m68ki_resolve_flags();
+      if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+      {
+         if(COND_GE())
+         {
+            m68ki_exception_trap(EXCEPTION_TRAPV);	/* HJB 990403 */
+            goto m68k_op_trapge_16_done;
+         }
+         REG_PC += 2;
+         goto m68k_op_trapge_16_done;
+      }
+      m68ki_exception_illegal();
+   }
+m68k_op_trapge_16_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_traplt_16:
+   {
+      m68ki_resolve_flags();
+      if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+      {
+         if(COND_LT())
+         {
+            m68ki_exception_trap(EXCEPTION_TRAPV);	/* HJB 990403 */
+            goto m68k_op_traplt_16_done;
+         }
+         REG_PC += 2;
+         goto m68k_op_traplt_16_done;
+      }
+      m68ki_exception_illegal();
+   }
+m68k_op_traplt_16_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_trapgt_16:
+   {
+      m68ki_resolve_flags();
+      if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+      {
+         if(COND_GT())
+         {
+            m68ki_exception_trap(EXCEPTION_TRAPV);	/* HJB 990403 */
+            goto m68k_op_trapgt_16_done;
+         }
+         REG_PC += 2;
+         goto m68k_op_trapgt_16_done;
+      }
+      m68ki_exception_illegal();
+   }
+m68k_op_trapgt_16_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_traple_16:
+   {
+      m68ki_resolve_flags();
+      if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+      {
+         if(COND_LE())
+         {
+            m68ki_exception_trap(EXCEPTION_TRAPV);	/* HJB 990403 */
+            goto m68k_op_traple_16_done;
+         }
+         REG_PC += 2;
+         goto m68k_op_traple_16_done;
+      }
+      m68ki_exception_illegal();
+   }
+m68k_op_traple_16_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_traphi_32:
+   {
+      m68ki_resolve_flags();
+      if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+      {
+         if(COND_HI())
+         {
+            m68ki_exception_trap(EXCEPTION_TRAPV);	/* HJB 990403 */
+            goto m68k_op_traphi_32_done;
+         }
+         REG_PC += 4;
+         goto m68k_op_traphi_32_done;
+      }
+      m68ki_exception_illegal();
+   }
+m68k_op_traphi_32_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_trapls_32:
+   {
+      m68ki_resolve_flags();
+      if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+      {
+         if(COND_LS())
+         {
+            m68ki_exception_trap(EXCEPTION_TRAPV);	/* HJB 990403 */
+            goto m68k_op_trapls_32_done;
+         }
+         REG_PC += 4;
+         goto m68k_op_trapls_32_done;
+      }
+      m68ki_exception_illegal();
+   }
+m68k_op_trapls_32_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_trapcc_32:
+   {
+      m68ki_resolve_flags();
+      if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+      {
+         if(COND_CC())
+         {
+            m68ki_exception_trap(EXCEPTION_TRAPV);	/* HJB 990403 */
+            goto m68k_op_trapcc_32_done;
+         }
+         REG_PC += 4;
+         goto m68k_op_trapcc_32_done;
+      }
+      m68ki_exception_illegal();
+   }
+m68k_op_trapcc_32_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_trapcs_32:
+   {
+      m68ki_resolve_flags();
+      if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+      {
+         if(COND_CS())
+         {
+            m68ki_exception_trap(EXCEPTION_TRAPV);	/* HJB 990403 */
+            goto m68k_op_trapcs_32_done;
+         }
+         REG_PC += 4;
+         goto m68k_op_trapcs_32_done;
+      }
+      m68ki_exception_illegal();
+   }
+m68k_op_trapcs_32_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_trapne_32:
+   {
+      m68ki_resolve_flags();
+      if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+      {
+         if(COND_NE())
+         {
+            m68ki_exception_trap(EXCEPTION_TRAPV);	/* HJB 990403 */
+            goto m68k_op_trapne_32_done;
+         }
+         REG_PC += 4;
+         goto m68k_op_trapne_32_done;
+      }
+      m68ki_exception_illegal();
+   }
+m68k_op_trapne_32_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_trapeq_32:
+   {
+      m68ki_resolve_flags();
+      if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+      {
+         if(COND_EQ())
+         {
+            m68ki_exception_trap(EXCEPTION_TRAPV);	/* HJB 990403 */
+            goto m68k_op_trapeq_32_done;
+         }
+         REG_PC += 4;
+         goto m68k_op_trapeq_32_done;
+      }
+      m68ki_exception_illegal();
+   }
+m68k_op_trapeq_32_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_trapvc_32:
+   {
+      m68ki_resolve_flags();
+      if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+      {
+         if(COND_VC())
+         {
+            m68ki_exception_trap(EXCEPTION_TRAPV);	/* HJB 990403 */
+            goto m68k_op_trapvc_32_done;
+         }
+         REG_PC += 4;
+         goto m68k_op_trapvc_32_done;
+      }
+      m68ki_exception_illegal();
+   }
+m68k_op_trapvc_32_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_trapvs_32:
+   {
+      m68ki_resolve_flags();
+      if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+      {
+         if(COND_VS())
+         {
+            m68ki_exception_trap(EXCEPTION_TRAPV);	/* HJB 990403 */
+            goto m68k_op_trapvs_32_done;
+         }
+         REG_PC += 4;
+         goto m68k_op_trapvs_32_done;
+      }
+      m68ki_exception_illegal();
+   }
+m68k_op_trapvs_32_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_trappl_32:
+   {
+      m68ki_resolve_flags();
+      if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+      {
+         if(COND_PL())
+         {
+            m68ki_exception_trap(EXCEPTION_TRAPV);	/* HJB 990403 */
+            goto m68k_op_trappl_32_done;
+         }
+         REG_PC += 4;
+         goto m68k_op_trappl_32_done;
+      }
+      m68ki_exception_illegal();
+   }
+m68k_op_trappl_32_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_trapmi_32:
+   {
+      m68ki_resolve_flags();
+      if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+      {
+         if(COND_MI())
+         {
+            m68ki_exception_trap(EXCEPTION_TRAPV);	/* HJB 990403 */
+            goto m68k_op_trapmi_32_done;
+         }
+         REG_PC += 4;
+         goto m68k_op_trapmi_32_done;
+      }
+      m68ki_exception_illegal();
+   }
+m68k_op_trapmi_32_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_trapge_32:
+   {
+      m68ki_resolve_flags();
+      if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+      {
+         if(COND_GE())
+         {
+            m68ki_exception_trap(EXCEPTION_TRAPV);	/* HJB 990403 */
+            goto m68k_op_trapge_32_done;
+         }
+         REG_PC += 4;
+         goto m68k_op_trapge_32_done;
+      }
+      m68ki_exception_illegal();
+   }
+m68k_op_trapge_32_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_traplt_32:
+   {
+      m68ki_resolve_flags();
+      if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+      {
+         if(COND_LT())
+         {
+            m68ki_exception_trap(EXCEPTION_TRAPV);	/* HJB 990403 */
+            goto m68k_op_traplt_32_done;
+         }
+         REG_PC += 4;
+         goto m68k_op_traplt_32_done;
+      }
+      m68ki_exception_illegal();
+   }
+m68k_op_traplt_32_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_trapgt_32:
+   {
+      m68ki_resolve_flags();
+      if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+      {
+         if(COND_GT())
+         {
+            m68ki_exception_trap(EXCEPTION_TRAPV);	/* HJB 990403 */
+            goto m68k_op_trapgt_32_done;
+         }
+         REG_PC += 4;
+         goto m68k_op_trapgt_32_done;
+      }
+      m68ki_exception_illegal();
+   }
+m68k_op_trapgt_32_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_traple_32:
+   {
+      m68ki_resolve_flags();
+      if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+      {
+         if(COND_LE())
+         {
+            m68ki_exception_trap(EXCEPTION_TRAPV);	/* HJB 990403 */
+            goto m68k_op_traple_32_done;
+         }
+         REG_PC += 4;
+         goto m68k_op_traple_32_done;
+      }
+      m68ki_exception_illegal();
+   }
+m68k_op_traple_32_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_trapv:
+   {
+      m68ki_resolve_flags();
+      if(COND_VC())
+      {
+         goto m68k_op_trapv_done;
+      }
+      m68ki_exception_trap(EXCEPTION_TRAPV);  /* HJB 990403 */
+   }
+m68k_op_trapv_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_tst_8_d:
+   {
+      uint res = MASK_OUT_ABOVE_8(DY);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_8(res);
+      FLAG_Z = res;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_tst_8_ai:
+   {
+      uint res = OPER_AY_AI_8();
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_8(res);
+      FLAG_Z = res;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_tst_8_pi:
+   {
+      uint res = OPER_AY_PI_8();
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_8(res);
+      FLAG_Z = res;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_tst_8_pi7:
+   {
+      uint res = OPER_A7_PI_8();
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_8(res);
+      FLAG_Z = res;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_tst_8_pd:
+   {
+      uint res = OPER_AY_PD_8();
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_8(res);
+      FLAG_Z = res;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_tst_8_pd7:
+   {
+      uint res = OPER_A7_PD_8();
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_8(res);
+      FLAG_Z = res;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_tst_8_di:
+   {
+      uint res = OPER_AY_DI_8();
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_8(res);
+      FLAG_Z = res;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_tst_8_ix:
+   {
+      uint res = OPER_AY_IX_8();
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_8(res);
+      FLAG_Z = res;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_tst_8_aw:
+   {
+      uint res = OPER_AW_8();
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_8(res);
+      FLAG_Z = res;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_tst_8_al:
+   {
+      uint res = OPER_AL_8();
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_8(res);
+      FLAG_Z = res;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_tst_8_pcdi:
+   {
+      m68ki_resolve_flags();
+      if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+      {
+         uint res = OPER_PCDI_8();
+
+         FLAG_N = NFLAG_8(res);
+         FLAG_Z = res;
+         FLAG_V = VFLAG_CLEAR;
+         FLAG_C = CFLAG_CLEAR;
+         goto m68k_op_tst_8_pcdi_done;
+      }
+      m68ki_exception_illegal();
+   }
+m68k_op_tst_8_pcdi_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_tst_8_pcix:
+   {
+      m68ki_resolve_flags();
+      if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+      {
+         uint res = OPER_PCIX_8();
+
+         FLAG_N = NFLAG_8(res);
+         FLAG_Z = res;
+         FLAG_V = VFLAG_CLEAR;
+         FLAG_C = CFLAG_CLEAR;
+         goto m68k_op_tst_8_pcix_done;
+      }
+      m68ki_exception_illegal();
+   }
+m68k_op_tst_8_pcix_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_tst_8_i:
+   {
+      m68ki_resolve_flags();
+      if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+      {
+         uint res = OPER_I_8();
+
+         FLAG_N = NFLAG_8(res);
+         FLAG_Z = res;
+         FLAG_V = VFLAG_CLEAR;
+         FLAG_C = CFLAG_CLEAR;
+         goto m68k_op_tst_8_i_done;
+      }
+      m68ki_exception_illegal();
+   }
+m68k_op_tst_8_i_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_tst_16_d:
+   {
+      uint res = MASK_OUT_ABOVE_16(DY);
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_16(res);
+      FLAG_Z = res;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_tst_16_a:
+   {
+      m68ki_resolve_flags();
+      if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+      {
+         uint res = MAKE_INT_16(AY);
+
+         FLAG_N = NFLAG_16(res);
+         FLAG_Z = res;
+         FLAG_V = VFLAG_CLEAR;
+         FLAG_C = CFLAG_CLEAR;
+         goto m68k_op_tst_16_a_done;
+      }
+      m68ki_exception_illegal();
+   }
+m68k_op_tst_16_a_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_tst_16_ai:
+   {
+      uint res = OPER_AY_AI_16();
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_16(res);
+      FLAG_Z = res;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_tst_16_pi:
+   {
+      uint res = OPER_AY_PI_16();
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_16(res);
+      FLAG_Z = res;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_tst_16_pd:
+   {
+      uint res = OPER_AY_PD_16();
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_16(res);
+      FLAG_Z = res;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_tst_16_di:
+   {
+      uint res = OPER_AY_DI_16();
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_16(res);
+      FLAG_Z = res;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_tst_16_ix:
+   {
+      uint res = OPER_AY_IX_16();
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_16(res);
+      FLAG_Z = res;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_tst_16_aw:
+   {
+      uint res = OPER_AW_16();
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_16(res);
+      FLAG_Z = res;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_tst_16_al:
+   {
+      uint res = OPER_AL_16();
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_16(res);
+      FLAG_Z = res;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_tst_16_pcdi:
+   {
+      m68ki_resolve_flags();
+      if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+      {
+         uint res = OPER_PCDI_16();
+
+         FLAG_N = NFLAG_16(res);
+         FLAG_Z = res;
+         FLAG_V = VFLAG_CLEAR;
+         FLAG_C = CFLAG_CLEAR;
+         goto m68k_op_tst_16_pcdi_done;
+      }
+      m68ki_exception_illegal();
+   }
+m68k_op_tst_16_pcdi_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_tst_16_pcix:
+   {
+      m68ki_resolve_flags();
+      if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+      {
+         uint res = OPER_PCIX_16();
+
+         FLAG_N = NFLAG_16(res);
+         FLAG_Z = res;
+         FLAG_V = VFLAG_CLEAR;
+         FLAG_C = CFLAG_CLEAR;
+         goto m68k_op_tst_16_pcix_done;
+      }
+      m68ki_exception_illegal();
+   }
+m68k_op_tst_16_pcix_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_tst_16_i:
+   {
+      m68ki_resolve_flags();
+      if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+      {
+         uint res = OPER_I_16();
+
+         FLAG_N = NFLAG_16(res);
+         FLAG_Z = res;
+         FLAG_V = VFLAG_CLEAR;
+         FLAG_C = CFLAG_CLEAR;
+         goto m68k_op_tst_16_i_done;
+      }
+      m68ki_exception_illegal();
+   }
+m68k_op_tst_16_i_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_tst_32_d:
+   {
+      uint res = DY;
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_32(res);
+      FLAG_Z = res;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_tst_32_a:
+   {
+      m68ki_resolve_flags();
+      if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+      {
+         uint res = AY;
+
+         FLAG_N = NFLAG_32(res);
+         FLAG_Z = res;
+         FLAG_V = VFLAG_CLEAR;
+         FLAG_C = CFLAG_CLEAR;
+         goto m68k_op_tst_32_a_done;
+      }
+      m68ki_exception_illegal();
+   }
+m68k_op_tst_32_a_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_tst_32_ai:
+   {
+      uint res = OPER_AY_AI_32();
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_32(res);
+      FLAG_Z = res;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_tst_32_pi:
+   {
+      uint res = OPER_AY_PI_32();
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_32(res);
+      FLAG_Z = res;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_tst_32_pd:
+   {
+      uint res = OPER_AY_PD_32();
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_32(res);
+      FLAG_Z = res;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_tst_32_di:
+   {
+      uint res = OPER_AY_DI_32();
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_32(res);
+      FLAG_Z = res;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_tst_32_ix:
+   {
+      uint res = OPER_AY_IX_32();
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_32(res);
+      FLAG_Z = res;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_tst_32_aw:
+   {
+      uint res = OPER_AW_32();
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_32(res);
+      FLAG_Z = res;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_tst_32_al:
+   {
+      uint res = OPER_AL_32();
+
+      m68ki_discard_lazy_flags();
+      FLAG_N = NFLAG_32(res);
+      FLAG_Z = res;
+      FLAG_V = VFLAG_CLEAR;
+      FLAG_C = CFLAG_CLEAR;
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_tst_32_pcdi:
+   {
+      m68ki_resolve_flags();
+      if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+      {
+         uint res = OPER_PCDI_32();
+
+         FLAG_N = NFLAG_32(res);
+         FLAG_Z = res;
+         FLAG_V = VFLAG_CLEAR;
+         FLAG_C = CFLAG_CLEAR;
+         goto m68k_op_tst_32_pcdi_done;
+      }
+      m68ki_exception_illegal();
+   }
+m68k_op_tst_32_pcdi_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_tst_32_pcix:
+   {
+      m68ki_resolve_flags();
+      if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+      {
+         uint res = OPER_PCIX_32();
+
+         FLAG_N = NFLAG_32(res);
+         FLAG_Z = res;
+         FLAG_V = VFLAG_CLEAR;
+         FLAG_C = CFLAG_CLEAR;
+         goto m68k_op_tst_32_pcix_done;
+      }
+      m68ki_exception_illegal();
+   }
+m68k_op_tst_32_pcix_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_tst_32_i:
+   {
+      m68ki_resolve_flags();
+      if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+      {
+         uint res = OPER_I_32();
+
+         FLAG_N = NFLAG_32(res);
+         FLAG_Z = res;
+         FLAG_V = VFLAG_CLEAR;
+         FLAG_C = CFLAG_CLEAR;
+         goto m68k_op_tst_32_i_done;
+      }
+      m68ki_exception_illegal();
+   }
+m68k_op_tst_32_i_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_unlk_32_a7:
+   {
+      REG_A[7] = m68ki_read_32(REG_A[7]);
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_unlk_32:
+   {
+      uint* r_dst = &AY;
+
+      REG_A[7] = *r_dst;
+      *r_dst = m68ki_pull_32();
+   }
+   M68KI_THREADED_NEXT();
+
+m68k_op_unpk_16_rr:
+   {
+      if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+      {
+         /* Note: DX and DY are reversed in Motorola's docs */
+         uint src = DY;
+         uint* r_dst = &DX;
+
+         *r_dst = MASK_OUT_BELOW_16(*r_dst) | (((((src << 4) & 0x0f00) | (src & 0x000f)) + OPER_I_16()) & 0xffff);
+         goto m68k_op_unpk_16_rr_done;
+      }
+      m68ki_exception_illegal();
+   }
+m68k_op_unpk_16_rr_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_unpk_16_mm_ax7:
+   {
+      if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+      {
+         /* Note: AX and AY are reversed in Motorola's docs */
+         uint src = OPER_AY_PD_8();
+         uint ea_dst;
+
+         src = (((src << 4) & 0x0f00) | (src & 0x000f)) + OPER_I_16();
+         ea_dst = EA_A7_PD_8();
+         m68ki_write_8(ea_dst, (src >> 8) & 0xff);
+         ea_dst = EA_A7_PD_8();
+         m68ki_write_8(ea_dst, src & 0xff);
+         goto m68k_op_unpk_16_mm_ax7_done;
+      }
+      m68ki_exception_illegal();
+   }
+m68k_op_unpk_16_mm_ax7_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_unpk_16_mm_ay7:
+   {
+      if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+      {
+         /* Note: AX and AY are reversed in Motorola's docs */
+         uint src = OPER_A7_PD_8();
+         uint ea_dst;
+
+         src = (((src << 4) & 0x0f00) | (src & 0x000f)) + OPER_I_16();
+         ea_dst = EA_AX_PD_8();
+         m68ki_write_8(ea_dst, (src >> 8) & 0xff);
+         ea_dst = EA_AX_PD_8();
+         m68ki_write_8(ea_dst, src & 0xff);
+         goto m68k_op_unpk_16_mm_ay7_done;
+      }
+      m68ki_exception_illegal();
+   }
+m68k_op_unpk_16_mm_ay7_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_unpk_16_mm_axy7:
+   {
+      if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+      {
+         uint src = OPER_A7_PD_8();
+         uint ea_dst;
+
+         src = (((src << 4) & 0x0f00) | (src & 0x000f)) + OPER_I_16();
+         ea_dst = EA_A7_PD_8();
+         m68ki_write_8(ea_dst, (src >> 8) & 0xff);
+         ea_dst = EA_A7_PD_8();
+         m68ki_write_8(ea_dst, src & 0xff);
+         goto m68k_op_unpk_16_mm_axy7_done;
+      }
+      m68ki_exception_illegal();
+   }
+m68k_op_unpk_16_mm_axy7_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+m68k_op_unpk_16_mm:
+   {
+      if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+      {
+         /* Note: AX and AY are reversed in Motorola's docs */
+         uint src = OPER_AY_PD_8();
+         uint ea_dst;
+
+         src = (((src << 4) & 0x0f00) | (src & 0x000f)) + OPER_I_16();
+         ea_dst = EA_AX_PD_8();
+         m68ki_write_8(ea_dst, (src >> 8) & 0xff);
+         ea_dst = EA_AX_PD_8();
+         m68ki_write_8(ea_dst, src & 0xff);
+         goto m68k_op_unpk_16_mm_done;
+      }
+      m68ki_exception_illegal();
+   }
+m68k_op_unpk_16_mm_done: __attribute__((unused));
+   M68KI_THREADED_NEXT();
+
+}
+#endif /* M68K_THREADED_DISPATCH */
+
+/* ======================================================================== */
+/* ============================== END OF FILE ============================= */
+/* ======================================================================== */
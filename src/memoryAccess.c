@@ -11,15 +11,137 @@
 
 
 uint8_t bankType[TOTAL_MEMORY_BANKS];
+#if defined(EMU_DIRTY_RAM_PAGES)
+uint32_t dirtyRamPages[DIRTY_RAM_PAGES / 32];
+#endif
+static uint8_t* bankPointer[TOTAL_MEMORY_BANKS];//host address of RAM and ROM banks, NULL if the bank has to go through the switch
+#if !defined(EMU_NO_SAFETY)
+static uint8_t  bankProtection[TOTAL_MEMORY_BANKS];//BANK_PROTECTION_* bits of the chip covering the bank, 0 if the bank can be accessed freely
+
+enum{
+   BANK_PROTECTION_READ_ONLY = 0x01,
+   BANK_PROTECTION_SUPERVISOR_ONLY = 0x02,//the whole bank is past unprotectedSize
+   BANK_PROTECTION_READ_ONLY_PROTECTED = 0x04,//the whole bank is past unprotectedSize
+   BANK_PROTECTION_SPLIT = 0x08//unprotectedSize is inside the bank, every access needs a range check
+};
+#endif
+static watchpoint_t     watchpoints[EMU_WATCHPOINTS];
+static bool             watchpointsSet;
+static bool             watchpointsSuspended;
+static bool             watchpointHitPending;
+static watchpoint_hit_t watchpointHit;
+#if defined(EMU_BUS_STATISTICS)
+static bus_statistics_t busStatistics;
+
+#define COUNT_READ(address, size) (busStatistics.chip[bankType[START_BANK(address)] & ~BANK_WATCHED].reads[size]++)
+#define COUNT_WRITE(address, size) (busStatistics.chip[bankType[START_BANK(address)] & ~BANK_WATCHED].writes[size]++)
+#define COUNT_REGISTER_READ(address) (busStatistics.registerReads[(address) & (REG_SIZE - 1)]++)
+#define COUNT_REGISTER_WRITE(address) (busStatistics.registerWrites[(address) & (REG_SIZE - 1)]++)
+#else
+#define COUNT_READ(address, size) ((void)0)
+#define COUNT_WRITE(address, size) ((void)0)
+#define COUNT_REGISTER_READ(address) ((void)0)
+#define COUNT_REGISTER_WRITE(address) ((void)0)
+#endif
 
 
 //RAM accesses
 static uint8_t ramRead8(uint32_t address){return BUFFER_READ_8(palmRam, address, chips[CHIP_DX_RAM].mask);}
 static uint16_t ramRead16(uint32_t address){return BUFFER_READ_16(palmRam, address, chips[CHIP_DX_RAM].mask);}
 static uint32_t ramRead32(uint32_t address){return BUFFER_READ_32(palmRam, address, chips[CHIP_DX_RAM].mask);}
-static void ramWrite8(uint32_t address, uint8_t value){BUFFER_WRITE_8(palmRam, address, chips[CHIP_DX_RAM].mask, value);}
-static void ramWrite16(uint32_t address, uint16_t value){BUFFER_WRITE_16(palmRam, address, chips[CHIP_DX_RAM].mask, value);}
-static void ramWrite32(uint32_t address, uint32_t value){BUFFER_WRITE_32(palmRam, address, chips[CHIP_DX_RAM].mask, value);}
+static void ramWrite8(uint32_t address, uint8_t value){BUFFER_WRITE_8(palmRam, address, chips[CHIP_DX_RAM].mask, value); MARK_RAM_DIRTY(address & chips[CHIP_DX_RAM].mask);}
+static void ramWrite16(uint32_t address, uint16_t value){BUFFER_WRITE_16(palmRam, address, chips[CHIP_DX_RAM].mask, value); MARK_RAM_DIRTY(address & chips[CHIP_DX_RAM].mask);}
+static void ramWrite32(uint32_t address, uint32_t value){BUFFER_WRITE_32(palmRam, address, chips[CHIP_DX_RAM].mask, value); MARK_RAM_DIRTY(address & chips[CHIP_DX_RAM].mask); MARK_RAM_DIRTY((address + 2) & chips[CHIP_DX_RAM].mask);}
+
+void markRamRangeDirty(uint32_t offset, uint32_t size){
+#if defined(EMU_DIRTY_RAM_PAGES)
+   uint32_t page;
+
+   if(size == 0)
+      return;
+
+   for(page = offset >> DIRTY_RAM_PAGE_SCOOT; page <= (offset + size - 1) >> DIRTY_RAM_PAGE_SCOOT && page < DIRTY_RAM_PAGES; page++)
+      dirtyRamPages[page >> 5] |= UINT32_C(1) << (page & 31);
+#endif
+}
+
+static uint32_t ramBulkLongs(uint32_t address, uint32_t count, bool write){
+   //returns how many of the longs starting at address are plain RAM that can be accessed directly in palmRam
+   uint32_t mask = chips[CHIP_DX_RAM].mask;
+   uint32_t bank;
+
+   if(address & 1)
+      return 0;
+
+   //cant wrap around the end of RAM or the address space
+   if((address & mask) + count * 4 > mask + 1)
+      count = (mask + 1 - (address & mask)) / 4;
+   if(address + count * 4 < address)
+      count = (0 - address) / 4;
+
+   //stop at the first bank that isnt RAM
+   for(bank = START_BANK(address); count > 0 && bank <= START_BANK(address + count * 4 - 1); bank++)
+      if(bankType[bank] != CHIP_DX_RAM)
+         count = BANK_ADDRESS(bank) > address ? (BANK_ADDRESS(bank) - address) / 4 : 0;
+
+#if !defined(EMU_NO_SAFETY)
+   //protected RAM has to go through probeRead/probeWrite, they only check the address an access starts at
+   if(write && chips[CHIP_DX_RAM].readOnly)
+      return 0;
+   if((chips[CHIP_DX_RAM].supervisorOnlyProtectedMemory && !flx68000IsSupervisor()) || (write && chips[CHIP_DX_RAM].readOnlyForProtectedMemory)){
+      uint32_t index = address - chips[CHIP_DX_RAM].start;
+
+      if(index >= chips[CHIP_DX_RAM].unprotectedSize)
+         return 0;
+      if(count > (chips[CHIP_DX_RAM].unprotectedSize - index + 3) / 4)
+         count = (chips[CHIP_DX_RAM].unprotectedSize - index + 3) / 4;
+   }
+#endif
+
+   return count;
+}
+
+uint32_t ramBulkCopy32(uint32_t dest, uint32_t source, uint32_t count){
+   //same as count MOVE.L (Ay)+,(Ax)+, returns how many longs were copied
+   uint32_t mask = chips[CHIP_DX_RAM].mask;
+
+   count = ramBulkLongs(dest, count, true);
+   count = ramBulkLongs(source, count, false);
+
+   //when the destination starts inside the source the loop repeats the start of the source, memmove cant do that
+   if((dest & mask) > (source & mask) && (dest & mask) < (source & mask) + count * 4)
+      return 0;
+
+   //RAM is stored as 16 bit words, moving whole words is the same on both layouts
+   memmove(palmRam + (dest & mask), palmRam + (source & mask), count * 4);
+   markRamRangeDirty(dest & mask, count * 4);
+#if defined(EMU_BUS_STATISTICS)
+   busStatistics.chip[CHIP_DX_RAM].reads[2] += count;
+   busStatistics.chip[CHIP_DX_RAM].writes[2] += count;
+#endif
+   return count;
+}
+
+uint32_t ramBulkFill32(uint32_t dest, uint32_t value, uint32_t count){
+   //same as count MOVE.L Dy,(Ax)+, returns how many longs were written
+   uint32_t mask = chips[CHIP_DX_RAM].mask;
+   uint32_t index;
+
+   count = ramBulkLongs(dest, count, true);
+
+   if(value == (value & 0xFF) * 0x01010101){
+      memset(palmRam + (dest & mask), value & 0xFF, count * 4);
+   }
+   else{
+      for(index = 0; index < count; index++)
+         BUFFER_WRITE_32(palmRam, dest + index * 4, mask, value);
+   }
+   markRamRangeDirty(dest & mask, count * 4);
+#if defined(EMU_BUS_STATISTICS)
+   busStatistics.chip[CHIP_DX_RAM].writes[2] += count;
+#endif
+   return count;
+}
 
 //ROM accesses
 static uint8_t romRead8(uint32_t address){return BUFFER_READ_8(palmRom, address, chips[CHIP_A0_ROM].mask);}
@@ -58,69 +180,175 @@ static uint32_t sed1376Read32(uint32_t address){
       return sed1376GetRegister(address & chips[CHIP_B0_SED].mask);
 }
 static void sed1376Write8(uint32_t address, uint8_t value){
-   if(address & SED1376_MR_BIT)
+   if(address & SED1376_MR_BIT){
       BUFFER_WRITE_8_BIG_ENDIAN(sed1376Ram, address, chips[CHIP_B0_SED].mask, value);
-   else
+      sed1376ScreenChanged = true;
+   }
+   else{
       sed1376SetRegister(address & chips[CHIP_B0_SED].mask, value);
+   }
 }
 static void sed1376Write16(uint32_t address, uint16_t value){
-   if(address & SED1376_MR_BIT)
+   if(address & SED1376_MR_BIT){
       BUFFER_WRITE_16_BIG_ENDIAN(sed1376Ram, address, chips[CHIP_B0_SED].mask, value);
-   else
+      sed1376ScreenChanged = true;
+   }
+   else{
       sed1376SetRegister(address & chips[CHIP_B0_SED].mask, value);
+   }
 }
 static void sed1376Write32(uint32_t address, uint32_t value){
-   if(address & SED1376_MR_BIT)
+   if(address & SED1376_MR_BIT){
       BUFFER_WRITE_32_BIG_ENDIAN(sed1376Ram, address, chips[CHIP_B0_SED].mask, value);
-   else
+      sed1376ScreenChanged = true;
+   }
+   else{
       sed1376SetRegister(address & chips[CHIP_B0_SED].mask, value);
+   }
 }
 
-static bool probeRead(uint8_t bank, uint32_t address){
-   if(chips[bank].supervisorOnlyProtectedMemory){
-      uint32_t index = address - chips[bank].start;
-      if(index >= chips[bank].unprotectedSize && !flx68000IsSupervisor()){
-         setPrivilegeViolation(address, false);
-         return false;
-      }
+#if !defined(EMU_NO_SAFETY)
+static bool probeRead(uint32_t bank, uint32_t address){
+   uint8_t protection = bankProtection[bank];
+
+   if(!protection)
+      return true;
+
+   if(protection & BANK_PROTECTION_SPLIT && address - chips[bankType[bank] & ~BANK_WATCHED].start < chips[bankType[bank] & ~BANK_WATCHED].unprotectedSize)
+      return true;
+
+   if(protection & BANK_PROTECTION_SUPERVISOR_ONLY && !flx68000IsSupervisor()){
+      setPrivilegeViolation(address, false);
+      return false;
    }
    return true;
 }
 
-static bool probeWrite(uint8_t bank, uint32_t address){
-   if(chips[bank].readOnly){
+static bool probeWrite(uint32_t bank, uint32_t address){
+   uint8_t protection = bankProtection[bank];
+
+   if(!protection)
+      return true;
+
+   if(protection & BANK_PROTECTION_READ_ONLY){
       setWriteProtectViolation(address);
       return false;
    }
-   else if(chips[bank].supervisorOnlyProtectedMemory || chips[bank].readOnlyForProtectedMemory){
-      uint32_t index = address - chips[bank].start;
-      if(index >= chips[bank].unprotectedSize){
-         if(chips[bank].supervisorOnlyProtectedMemory && !flx68000IsSupervisor()){
-            setPrivilegeViolation(address, true);
-            return false;
-         }
-         if(chips[bank].readOnlyForProtectedMemory){
-            setWriteProtectViolation(address);
-            return false;
-         }
-      }
+
+   if(protection & BANK_PROTECTION_SPLIT && address - chips[bankType[bank] & ~BANK_WATCHED].start < chips[bankType[bank] & ~BANK_WATCHED].unprotectedSize)
+      return true;
+
+   if(protection & BANK_PROTECTION_SUPERVISOR_ONLY && !flx68000IsSupervisor()){
+      setPrivilegeViolation(address, true);
+      return false;
+   }
+   if(protection & BANK_PROTECTION_READ_ONLY_PROTECTED){
+      setWriteProtectViolation(address);
+      return false;
    }
    return true;
 }
+#endif
 
-uint8_t m68k_read_memory_8(uint32_t address){
-   uint8_t addressType = bankType[START_BANK(address)];
+//watchpoints
+static void checkWatchpoints(uint32_t address, uint8_t size, bool write, uint32_t value){
+   uint8_t index;
 
-#if !defined(EMU_NO_SAFETY)
-   if(!probeRead(addressType, address))
-      return 0x00;
+   if(watchpointsSuspended || watchpointHitPending)
+      return;
+
+   for(index = 0; index < EMU_WATCHPOINTS; index++){
+      const watchpoint_t* watchpoint = &watchpoints[index];
+
+      if(!(watchpoint->type & (write ? WATCHPOINT_WRITE : WATCHPOINT_READ)))
+         continue;
+
+      //the access and the watched range dont overlap
+      if(address - watchpoint->address >= watchpoint->size && watchpoint->address - address >= size / 8)
+         continue;
+
+      if(watchpoint->type & WATCHPOINT_VALUE && value != watchpoint->value)
+         continue;
+
+      watchpointHit.watchpoint = index;
+      watchpointHit.write = write;
+      watchpointHit.size = size;
+      watchpointHit.address = address;
+      watchpointHit.value = value;
+      watchpointHit.pc = flx68000GetPc();
+      watchpointHitPending = true;
+      flx68000EndTimeslice();
+      return;
+   }
+}
+
+static bool bankIsWatched(uint32_t bank){
+   //accesses can start up to 3 bytes before a watched range, so the bank before it is watched too when the range starts at the top of a bank
+   uint8_t index;
+
+   if(!watchpointsSet)
+      return false;
+
+   for(index = 0; index < EMU_WATCHPOINTS; index++){
+      const watchpoint_t* watchpoint = &watchpoints[index];
+
+      if(watchpoint->type && bank >= START_BANK(watchpoint->address >= 3 ? watchpoint->address - 3 : 0) && bank <= START_BANK(watchpoint->address + watchpoint->size - 1))
+         return true;
+   }
+
+   return false;
+}
+
+void setWatchpoint(uint8_t index, watchpoint_t watchpoint){
+   uint8_t watchpointIndex;
+
+   watchpoints[index] = watchpoint;
+   watchpointsSet = false;
+   for(watchpointIndex = 0; watchpointIndex < EMU_WATCHPOINTS; watchpointIndex++)
+      if(watchpoints[watchpointIndex].type)
+         watchpointsSet = true;
+
+   updateBankAttributes();
+}
+
+watchpoint_t getWatchpoint(uint8_t index){
+   return watchpoints[index];
+}
+
+bool getWatchpointHit(watchpoint_hit_t* hit, bool clear){
+   if(!watchpointHitPending)
+      return false;
+
+   if(hit)
+      *hit = watchpointHit;
+   if(clear)
+      watchpointHitPending = false;
+   return true;
+}
+
+void suspendWatchpoints(bool suspend){
+   watchpointsSuspended = suspend;
+}
+
+bool getBusStatistics(bus_statistics_t* statistics, bool reset){
+#if defined(EMU_BUS_STATISTICS)
+   if(statistics)
+      *statistics = busStatistics;
+   if(reset)
+      memset(&busStatistics, 0x00, sizeof(busStatistics));
+   return true;
+#else
+   return false;
 #endif
+}
 
-   switch(addressType){
+static uint8_t chipRead8(uint8_t chip, uint32_t address){
+   switch(chip){
       case CHIP_A0_ROM:
          return romRead8(address);
 
       case CHIP_A1_USB:
+         flx68000IdleLoopChanged = true;//reading the data register takes from the FIFO
          return pdiUsbD12GetRegister(!!(address & chips[CHIP_A1_USB].mask));
 
       case CHIP_B0_SED:
@@ -133,6 +361,8 @@ uint8_t m68k_read_memory_8(uint32_t address){
          return 0x00;
 
       case CHIP_REGISTERS:
+         COUNT_REGISTER_READ(address);
+         flx68000IdleLoopPolled = true;
          return getHwRegister8(address);
 
       case CHIP_NONE:
@@ -140,24 +370,40 @@ uint8_t m68k_read_memory_8(uint32_t address){
          return 0x00;
 
       default:
-         debugLog("Unknown bank type:%d\n", bankType[START_BANK(address)]);
+         if(chip & BANK_WATCHED){
+            uint8_t value = chipRead8(chip & ~BANK_WATCHED, address);
+
+            checkWatchpoints(address, 8, false, value);
+            return value;
+         }
+
+         debugLog("Unknown bank type:%d\n", chip);
          return 0x00;
    }
 }
 
-uint16_t m68k_read_memory_16(uint32_t address){
-   uint8_t addressType = bankType[START_BANK(address)];
-
+uint8_t m68k_read_memory_8(uint32_t address){
 #if !defined(EMU_NO_SAFETY)
-   if(!probeRead(addressType, address))
-      return 0x0000;
+   if(!probeRead(START_BANK(address), address))
+      return 0x00;
 #endif
 
-   switch(addressType){
+   COUNT_READ(address, 0);
+
+   //RAM and ROM dont need the switch
+   if(bankPointer[START_BANK(address)])
+      return BUFFER_READ_8(bankPointer[START_BANK(address)], address, BANK_MASK);
+
+   return chipRead8(bankType[START_BANK(address)], address);
+}
+
+static uint16_t chipRead16(uint8_t chip, uint32_t address){
+   switch(chip){
       case CHIP_A0_ROM:
          return romRead16(address);
 
       case CHIP_A1_USB:
+         flx68000IdleLoopChanged = true;//reading the data register takes from the FIFO
          return pdiUsbD12GetRegister(!!(address & chips[CHIP_A1_USB].mask));
 
       case CHIP_B0_SED:
@@ -170,6 +416,8 @@ uint16_t m68k_read_memory_16(uint32_t address){
          return 0x0000;
 
       case CHIP_REGISTERS:
+         COUNT_REGISTER_READ(address);
+         flx68000IdleLoopPolled = true;
          return getHwRegister16(address);
 
       case CHIP_NONE:
@@ -177,24 +425,40 @@ uint16_t m68k_read_memory_16(uint32_t address){
          return 0x0000;
 
       default:
-         debugLog("Unknown bank type:%d\n", bankType[START_BANK(address)]);
+         if(chip & BANK_WATCHED){
+            uint16_t value = chipRead16(chip & ~BANK_WATCHED, address);
+
+            checkWatchpoints(address, 16, false, value);
+            return value;
+         }
+
+         debugLog("Unknown bank type:%d\n", chip);
          return 0x0000;
    }
 }
 
-uint32_t m68k_read_memory_32(uint32_t address){
-   uint8_t addressType = bankType[START_BANK(address)];
-
+uint16_t m68k_read_memory_16(uint32_t address){
 #if !defined(EMU_NO_SAFETY)
-   if(!probeRead(addressType, address))
-      return 0x00000000;
+   if(!probeRead(START_BANK(address), address))
+      return 0x0000;
 #endif
 
-   switch(addressType){
+   COUNT_READ(address, 1);
+
+   //RAM and ROM dont need the switch
+   if(bankPointer[START_BANK(address)])
+      return BUFFER_READ_16(bankPointer[START_BANK(address)], address, BANK_MASK);
+
+   return chipRead16(bankType[START_BANK(address)], address);
+}
+
+static uint32_t chipRead32(uint8_t chip, uint32_t address){
+   switch(chip){
       case CHIP_A0_ROM:
          return romRead32(address);
 
       case CHIP_A1_USB:
+         flx68000IdleLoopChanged = true;//reading the data register takes from the FIFO
          return pdiUsbD12GetRegister(!!(address & chips[CHIP_A1_USB].mask));
 
       case CHIP_B0_SED:
@@ -207,6 +471,8 @@ uint32_t m68k_read_memory_32(uint32_t address){
          return getEmuRegister(address);
 
       case CHIP_REGISTERS:
+         COUNT_REGISTER_READ(address);
+         flx68000IdleLoopPolled = true;
          return getHwRegister32(address);
 
       case CHIP_NONE:
@@ -214,20 +480,35 @@ uint32_t m68k_read_memory_32(uint32_t address){
          return 0x00000000;
 
       default:
-         debugLog("Unknown bank type:%d\n", bankType[START_BANK(address)]);
+         if(chip & BANK_WATCHED){
+            uint32_t value = chipRead32(chip & ~BANK_WATCHED, address);
+
+            checkWatchpoints(address, 32, false, value);
+            return value;
+         }
+
+         debugLog("Unknown bank type:%d\n", chip);
          return 0x00000000;
    }
 }
 
-void m68k_write_memory_8(uint32_t address, uint8_t value){
-   uint8_t addressType = bankType[START_BANK(address)];
-
+uint32_t m68k_read_memory_32(uint32_t address){
 #if !defined(EMU_NO_SAFETY)
-   if(!probeWrite(addressType, address))
-      return;
+   if(!probeRead(START_BANK(address), address))
+      return 0x00000000;
 #endif
 
-   switch(addressType){
+   COUNT_READ(address, 2);
+
+   //RAM and ROM dont need the switch
+   if(bankPointer[START_BANK(address)] && (address & BANK_MASK) <= BANK_MASK - 3)
+      return BUFFER_READ_32(bankPointer[START_BANK(address)], address, BANK_MASK);
+
+   return chipRead32(bankType[START_BANK(address)], address);
+}
+
+static void chipWrite8(uint8_t chip, uint32_t address, uint8_t value){
+   switch(chip){
       case CHIP_A0_ROM:
          return;
 
@@ -247,6 +528,7 @@ void m68k_write_memory_8(uint32_t address, uint8_t value){
          return;
 
       case CHIP_REGISTERS:
+         COUNT_REGISTER_WRITE(address);
          setHwRegister8(address, value);
          return;
 
@@ -255,20 +537,40 @@ void m68k_write_memory_8(uint32_t address, uint8_t value){
          return;
 
       default:
-         debugLog("Unknown bank type:%d\n", bankType[START_BANK(address)]);
+         if(chip & BANK_WATCHED){
+            chipWrite8(chip & ~BANK_WATCHED, address, value);
+            checkWatchpoints(address, 8, true, value);
+            return;
+         }
+
+         debugLog("Unknown bank type:%d\n", chip);
          return;
    }
 }
 
-void m68k_write_memory_16(uint32_t address, uint16_t value){
+void m68k_write_memory_8(uint32_t address, uint8_t value){
    uint8_t addressType = bankType[START_BANK(address)];
 
 #if !defined(EMU_NO_SAFETY)
-   if(!probeWrite(addressType, address))
+   if(!probeWrite(START_BANK(address), address))
       return;
 #endif
 
-   switch(addressType){
+   flx68000IdleLoopChanged = true;
+   COUNT_WRITE(address, 0);
+
+   //RAM doesnt need the switch
+   if(addressType == CHIP_DX_RAM && bankPointer[START_BANK(address)]){
+      BUFFER_WRITE_8(bankPointer[START_BANK(address)], address, BANK_MASK, value);
+      MARK_RAM_DIRTY(address & chips[CHIP_DX_RAM].mask);
+      return;
+   }
+
+   chipWrite8(addressType, address, value);
+}
+
+static void chipWrite16(uint8_t chip, uint32_t address, uint16_t value){
+   switch(chip){
       case CHIP_A0_ROM:
          return;
 
@@ -288,6 +590,7 @@ void m68k_write_memory_16(uint32_t address, uint16_t value){
          return;
 
       case CHIP_REGISTERS:
+         COUNT_REGISTER_WRITE(address);
          setHwRegister16(address, value);
          return;
 
@@ -296,20 +599,40 @@ void m68k_write_memory_16(uint32_t address, uint16_t value){
          return;
 
       default:
-         debugLog("Unknown bank type:%d\n", bankType[START_BANK(address)]);
+         if(chip & BANK_WATCHED){
+            chipWrite16(chip & ~BANK_WATCHED, address, value);
+            checkWatchpoints(address, 16, true, value);
+            return;
+         }
+
+         debugLog("Unknown bank type:%d\n", chip);
          return;
    }
 }
 
-void m68k_write_memory_32(uint32_t address, uint32_t value){
+void m68k_write_memory_16(uint32_t address, uint16_t value){
    uint8_t addressType = bankType[START_BANK(address)];
 
 #if !defined(EMU_NO_SAFETY)
-   if(!probeWrite(addressType, address))
+   if(!probeWrite(START_BANK(address), address))
       return;
 #endif
 
-   switch(addressType){
+   flx68000IdleLoopChanged = true;
+   COUNT_WRITE(address, 1);
+
+   //RAM doesnt need the switch
+   if(addressType == CHIP_DX_RAM && bankPointer[START_BANK(address)]){
+      BUFFER_WRITE_16(bankPointer[START_BANK(address)], address, BANK_MASK, value);
+      MARK_RAM_DIRTY(address & chips[CHIP_DX_RAM].mask);
+      return;
+   }
+
+   chipWrite16(addressType, address, value);
+}
+
+static void chipWrite32(uint8_t chip, uint32_t address, uint32_t value){
+   switch(chip){
       case CHIP_A0_ROM:
          return;
 
@@ -330,6 +653,7 @@ void m68k_write_memory_32(uint32_t address, uint32_t value){
          return;
 
       case CHIP_REGISTERS:
+         COUNT_REGISTER_WRITE(address);
          setHwRegister32(address, value);
          return;
 
@@ -338,11 +662,38 @@ void m68k_write_memory_32(uint32_t address, uint32_t value){
          return;
 
       default:
-         debugLog("Unknown bank type:%d\n", bankType[START_BANK(address)]);
+         if(chip & BANK_WATCHED){
+            chipWrite32(chip & ~BANK_WATCHED, address, value);
+            checkWatchpoints(address, 32, true, value);
+            return;
+         }
+
+         debugLog("Unknown bank type:%d\n", chip);
          return;
    }
 }
 
+void m68k_write_memory_32(uint32_t address, uint32_t value){
+   uint8_t addressType = bankType[START_BANK(address)];
+
+#if !defined(EMU_NO_SAFETY)
+   if(!probeWrite(START_BANK(address), address))
+      return;
+#endif
+
+   flx68000IdleLoopChanged = true;
+   COUNT_WRITE(address, 2);
+
+   //RAM doesnt need the switch
+   if(addressType == CHIP_DX_RAM && bankPointer[START_BANK(address)] && (address & BANK_MASK) <= BANK_MASK - 3){
+      BUFFER_WRITE_32(bankPointer[START_BANK(address)], address, BANK_MASK, value);
+      MARK_RAM_DIRTY(address & chips[CHIP_DX_RAM].mask);
+      return;
+   }
+
+   chipWrite32(addressType, address, value);
+}
+
 void m68k_write_memory_32_pd(uint32_t address, uint32_t value){
    m68k_write_memory_32(address, value >> 16 | value << 16);
 }
@@ -372,11 +723,61 @@ static uint8_t getProperBankType(uint32_t bank){
    return CHIP_NONE;
 }
 
+static void updateBank(uint32_t bank){
+   uint8_t chipType = bankType[bank] & ~BANK_WATCHED;
+
+   //a bank can only be accessed directly if its chip mask doesnt mirror anything smaller than a bank, watched banks have to go through the switch to be checked
+   if(bankIsWatched(bank)){
+      bankType[bank] = chipType | BANK_WATCHED;
+      bankPointer[bank] = NULL;
+   }
+   else{
+      bankType[bank] = chipType;
+      if(chipType == CHIP_DX_RAM && (chips[CHIP_DX_RAM].mask & BANK_MASK) == BANK_MASK)
+         bankPointer[bank] = palmRam + (BANK_ADDRESS(bank) & chips[CHIP_DX_RAM].mask);
+      else if(chipType == CHIP_A0_ROM && (chips[CHIP_A0_ROM].mask & BANK_MASK) == BANK_MASK)
+         bankPointer[bank] = palmRom + (BANK_ADDRESS(bank) & chips[CHIP_A0_ROM].mask);
+      else
+         bankPointer[bank] = NULL;
+   }
+
+#if !defined(EMU_NO_SAFETY)
+   {
+      const chip_t* chip = &chips[chipType];
+      uint32_t firstIndex = BANK_ADDRESS(bank) - chip->start;
+      uint32_t lastIndex = firstIndex + BANK_MASK;
+      uint8_t protection = 0;
+
+      if(chip->readOnly)
+         protection |= BANK_PROTECTION_READ_ONLY;
+
+      if(chip->supervisorOnlyProtectedMemory || chip->readOnlyForProtectedMemory){
+         //the index wraps when the chip starts inside the bank
+         if(lastIndex < firstIndex || (firstIndex < chip->unprotectedSize && lastIndex >= chip->unprotectedSize))
+            protection |= BANK_PROTECTION_SPLIT;
+
+         if(lastIndex < firstIndex || lastIndex >= chip->unprotectedSize){
+            if(chip->supervisorOnlyProtectedMemory)
+               protection |= BANK_PROTECTION_SUPERVISOR_ONLY;
+            if(chip->readOnlyForProtectedMemory)
+               protection |= BANK_PROTECTION_READ_ONLY_PROTECTED;
+         }
+      }
+
+      bankProtection[bank] = protection;
+   }
+#endif
+}
+
 void setRegisterXXFFAccessMode(void){
    uint32_t topByte;
 
-   MULTITHREAD_LOOP(topByte) for(topByte = 0; topByte < 0x100; topByte++)
-      bankType[START_BANK(topByte << 24 | 0x00FFF000)] = CHIP_REGISTERS;
+   MULTITHREAD_LOOP(topByte) for(topByte = 0; topByte < 0x100; topByte++){
+      uint32_t bank = START_BANK(topByte << 24 | 0x00FFF000);
+      bankType[bank] = CHIP_REGISTERS;
+      updateBank(bank);
+   }
+   flx68000AddressSpaceChanged();
 }
 
 void setRegisterFFFFAccessMode(void){
@@ -385,17 +786,52 @@ void setRegisterFFFFAccessMode(void){
    MULTITHREAD_LOOP(topByte) for(topByte = 0; topByte < 0x100; topByte++){
       uint32_t bank = START_BANK(topByte << 24 | 0x00FFF000);
       bankType[bank] = getProperBankType(bank);
+      updateBank(bank);
    }
+   flx68000AddressSpaceChanged();
 }
 
 void setSed1376Attached(bool attached){
-   if(chips[CHIP_B0_SED].enable && bankType[START_BANK(chips[CHIP_B0_SED].start)] != (attached ? CHIP_B0_SED : CHIP_NONE))
+   if(chips[CHIP_B0_SED].enable && bankType[START_BANK(chips[CHIP_B0_SED].start)] != (attached ? CHIP_B0_SED : CHIP_NONE)){
+      uint32_t bank;
+
       memset(&bankType[START_BANK(chips[CHIP_B0_SED].start)], attached ? CHIP_B0_SED : CHIP_NONE, END_BANK(chips[CHIP_B0_SED].start, chips[CHIP_B0_SED].lineSize) - START_BANK(chips[CHIP_B0_SED].start) + 1);
+      for(bank = START_BANK(chips[CHIP_B0_SED].start); bank <= END_BANK(chips[CHIP_B0_SED].start, chips[CHIP_B0_SED].lineSize); bank++)
+         updateBank(bank);
+   }
 }
 
 void resetAddressSpace(void){
    uint32_t bank;
 
-   MULTITHREAD_LOOP(bank) for(bank = 0; bank < TOTAL_MEMORY_BANKS; bank++)
+   MULTITHREAD_LOOP(bank) for(bank = 0; bank < TOTAL_MEMORY_BANKS; bank++){
+      bankType[bank] = getProperBankType(bank);
+      updateBank(bank);
+   }
+   flx68000AddressSpaceChanged();
+}
+
+void resetAddressSpaceRange(uint32_t address, uint32_t size){
+   //only recomputes the banks in the range, used when a single chip select moves or changes size
+   uint32_t endBank = END_BANK(address, size);
+   uint32_t bank;
+
+   if(size == 0)
+      return;
+
+   if(endBank >= TOTAL_MEMORY_BANKS)
+      endBank = TOTAL_MEMORY_BANKS - 1;
+
+   for(bank = START_BANK(address); bank <= endBank; bank++){
       bankType[bank] = getProperBankType(bank);
+      updateBank(bank);
+   }
+   flx68000AddressSpaceChanged();
+}
+
+void updateBankAttributes(void){
+   uint32_t bank;
+
+   MULTITHREAD_LOOP(bank) for(bank = 0; bank < TOTAL_MEMORY_BANKS; bank++)
+      updateBank(bank);
 }
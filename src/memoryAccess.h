@@ -2,6 +2,7 @@
 #define MEMORY_ACCESS_H
 
 #include <stdint.h>
+#include <stdbool.h>
 
 //address space
 //new bank size (0x4000)
@@ -12,6 +13,8 @@
 #define BANK_IN_RANGE(bank, address, size) ((bank) >= START_BANK(address) && (bank) <= END_BANK(address, size))
 #define BANK_ADDRESS(bank) ((bank) << BANK_SCOOT)
 #define TOTAL_MEMORY_BANKS (1 << (32 - BANK_SCOOT))//0x40000 banks for BANK_SCOOT = 14
+#define BANK_MASK ((1 << BANK_SCOOT) - 1)
+#define BANK_WATCHED 0x80//set in bankType[] on banks with a watchpoint, the other bits are still the chip, these banks always go through the switch
 
 //chip addresses and sizes
 //after boot RAM is at 0x00000000,
@@ -43,6 +46,15 @@
 #define BUFFER_WRITE_16_BIG_ENDIAN BUFFER_WRITE_16
 #define BUFFER_WRITE_32_BIG_ENDIAN BUFFER_WRITE_32
 #else
+#if defined(EMU_BIG_ENDIAN_MEMORY)
+//memory layout is the same as the Palm m515, every access is byte swapped so 32 bit accesses can be 1 load, unless the second half would wrap around the mask
+#define BUFFER_READ_8(segment, accessAddress, mask)  (*(uint8_t*)(segment + ((accessAddress) & (mask))))
+#define BUFFER_READ_16(segment, accessAddress, mask) SWAP_16(*(uint16_t*)(segment + ((accessAddress) & (mask))))
+#define BUFFER_READ_32(segment, accessAddress, mask) (((accessAddress) & (mask)) + 3 <= (mask) ? SWAP_32(readUnaligned32(segment + ((accessAddress) & (mask)))) : (uint32_t)SWAP_16(*(uint16_t*)(segment + ((accessAddress) & (mask)))) << 16 | SWAP_16(*(uint16_t*)(segment + ((accessAddress) + 2 & (mask)))))
+#define BUFFER_WRITE_8(segment, accessAddress, mask, value)  (*(uint8_t*)(segment + ((accessAddress) & (mask))) = (value))
+#define BUFFER_WRITE_16(segment, accessAddress, mask, value) (*(uint16_t*)(segment + ((accessAddress) & (mask))) = SWAP_16(value))
+#define BUFFER_WRITE_32(segment, accessAddress, mask, value) (((accessAddress) & (mask)) + 3 <= (mask) ? writeUnaligned32(segment + ((accessAddress) & (mask)), SWAP_32(value)) : (void)(*(uint16_t*)(segment + ((accessAddress) & (mask))) = SWAP_16((value) >> 16), *(uint16_t*)(segment + (((accessAddress) + 2) & (mask))) = SWAP_16((value) & 0xFFFF)))
+#else
 //memory layout is different from the Palm m515, optimize for opcode fetches(16 bit reads)
 #define BUFFER_READ_8(segment, accessAddress, mask)  (*(uint8_t*)(segment + ((accessAddress) & (mask) ^ 1)))
 #define BUFFER_READ_16(segment, accessAddress, mask) (*(uint16_t*)(segment + ((accessAddress) & (mask))))
@@ -50,6 +62,7 @@
 #define BUFFER_WRITE_8(segment, accessAddress, mask, value)  (*(uint8_t*)(segment + ((accessAddress) & (mask) ^ 1)) = (value))
 #define BUFFER_WRITE_16(segment, accessAddress, mask, value) (*(uint16_t*)(segment + ((accessAddress) & (mask))) = (value))
 #define BUFFER_WRITE_32(segment, accessAddress, mask, value) (*(uint16_t*)(segment + ((accessAddress) & (mask))) = (value) >> 16 , *(uint16_t*)(segment + ((accessAddress) + 2 & (mask))) = (value) & 0xFFFF)
+#endif
 #define BUFFER_READ_8_BIG_ENDIAN(segment, accessAddress, mask)  (segment[(accessAddress) & (mask)])
 #define BUFFER_READ_16_BIG_ENDIAN(segment, accessAddress, mask) (segment[(accessAddress) & (mask)] << 8 | segment[(accessAddress) + 1 & (mask)])
 #define BUFFER_READ_32_BIG_ENDIAN(segment, accessAddress, mask) (segment[(accessAddress) & (mask)] << 24 | segment[(accessAddress) + 1 & (mask)] << 16 | segment[(accessAddress) + 2 & (mask)] << 8 | segment[(accessAddress) + 3 & (mask)])
@@ -62,11 +75,77 @@
 #define SWAP_32(x) ((uint32_t)((((uint32_t)(x) & 0x000000FF) << 24) | (((uint32_t)(x) & 0x0000FF00) <<  8) | (((uint32_t)(x) & 0x00FF0000) >>  8) | (((uint32_t)(x) & 0xFF000000) >> 24)))
 #define SWAP_64(x) ((((uint64_t)(x) & UINT64_C(0x00000000000000FF)) << 56) | (((uint64_t)(x) & UINT64_C(0x000000000000FF00)) << 40) | (((uint64_t)(x) & UINT64_C(0x0000000000FF0000)) << 24) | (((uint64_t)(x) & UINT64_C(0x00000000FF000000)) << 8) | (((uint64_t)(x) & UINT64_C(0x000000FF00000000)) >> 8) | (((uint64_t)(x) & UINT64_C(0x0000FF0000000000)) >> 24) | (((uint64_t)(x) & UINT64_C(0x00FF000000000000)) >> 40) | (((uint64_t)(x) & UINT64_C(0xFF00000000000000)) >> 56))
 
+//watchpoints, VALUE only triggers when the accessed value equals the watchpoints value
+#define EMU_WATCHPOINTS 16
+enum{
+   WATCHPOINT_READ = 0x01,
+   WATCHPOINT_WRITE = 0x02,
+   WATCHPOINT_VALUE = 0x04
+};
+
+typedef struct{
+   uint8_t  type;//WATCHPOINT_* bits, 0 = unused
+   uint32_t address;
+   uint32_t size;//in bytes
+   uint32_t value;
+}watchpoint_t;
+
+typedef struct{
+   uint8_t  watchpoint;//index of the watchpoint that was hit
+   bool     write;
+   uint8_t  size;//access size in bits
+   uint32_t address;
+   uint32_t value;
+   uint32_t pc;//start of the opcode that made the access
+}watchpoint_hit_t;
+
+//bus statistics, only counted when EMU_BUS_STATISTICS is defined
+#define BUS_STATISTICS_CHIPS 7//CHIP_A0_ROM<->CHIP_NONE from hardwareRegisters.h
+typedef struct{
+   uint64_t reads[3];//8, 16 and 32 bit accesses
+   uint64_t writes[3];
+}bus_counter_t;
+
+typedef struct{
+   bus_counter_t chip[BUS_STATISTICS_CHIPS];//indexed by the CHIP_* values, CHIP_NONE is unmapped memory
+   uint64_t      registerReads[REG_SIZE];//indexed by address - REG_START_ADDRESS, any size access counts as 1
+   uint64_t      registerWrites[REG_SIZE];
+}bus_statistics_t;
+
+//dirty RAM tracking, 1 bit per page of palmRam, set when the 68k, the ARM core or a bulk move writes to the page
+#define DIRTY_RAM_PAGE_SCOOT BANK_SCOOT
+#define DIRTY_RAM_PAGE_SIZE (1 << DIRTY_RAM_PAGE_SCOOT)
+#define DIRTY_RAM_PAGES (SUPERMASSIVE_RAM_SIZE >> DIRTY_RAM_PAGE_SCOOT)
+#if defined(EMU_DIRTY_RAM_PAGES)
+#define MARK_RAM_DIRTY(offset) (dirtyRamPages[(offset) >> DIRTY_RAM_PAGE_SCOOT >> 5] |= UINT32_C(1) << ((offset) >> DIRTY_RAM_PAGE_SCOOT & 31))
+#else
+#define MARK_RAM_DIRTY(offset) ((void)0)
+#endif
+
 extern uint8_t bankType[];
+#if defined(EMU_DIRTY_RAM_PAGES)
+extern uint32_t dirtyRamPages[];
+#endif
 
 void setRegisterXXFFAccessMode(void);
 void setRegisterFFFFAccessMode(void);
 void setSed1376Attached(bool attached);
 void resetAddressSpace(void);
+void resetAddressSpaceRange(uint32_t address, uint32_t size);
+void updateBankAttributes(void);//must be called when a chip mask or protection setting changes without the address space being reset
+
+void markRamRangeDirty(uint32_t offset, uint32_t size);//offset and size are in palmRam, does nothing without EMU_DIRTY_RAM_PAGES
+
+//watchpoints
+void setWatchpoint(uint8_t index, watchpoint_t watchpoint);
+watchpoint_t getWatchpoint(uint8_t index);
+bool getWatchpointHit(watchpoint_hit_t* hit, bool clear);
+void suspendWatchpoints(bool suspend);//for debugger reads that shouldnt trigger watchpoints
+
+bool getBusStatistics(bus_statistics_t* statistics, bool reset);
+
+//used by the 68k core to run MOVE.L copy and fill loops at once, return how many longs were done
+uint32_t ramBulkCopy32(uint32_t dest, uint32_t source, uint32_t count);
+uint32_t ramBulkFill32(uint32_t dest, uint32_t value, uint32_t count);
 
 #endif
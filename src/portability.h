@@ -3,10 +3,19 @@
 
 #include <stdint.h>
 #include <stdbool.h>
+#include <string.h>
+#include <stdlib.h>
+#if defined(__linux__)
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
 
 //endian
 static inline void swap16BufferIfLittle(uint8_t* buffer, uint64_t count){
-#if !defined(EMU_BIG_ENDIAN)
+   //converts between the Palm byte order and the order RAM, ROM and registers are stored in, EMU_BIG_ENDIAN_MEMORY stores them in Palm order
+#if !defined(EMU_BIG_ENDIAN) && !defined(EMU_BIG_ENDIAN_MEMORY)
    uint64_t index;
    //count specifys the number of uint16_t's that need to be swapped, the uint8_t* is because of alignment restrictions that crash on some platforms
    count *= sizeof(uint16_t);
@@ -18,6 +27,83 @@ static inline void swap16BufferIfLittle(uint8_t* buffer, uint64_t count){
 #endif
 }
 
+static inline uint32_t readUnaligned32(const uint8_t* where){
+   //compiles to 1 load on platforms that allow unaligned accesses
+   uint32_t value;
+
+   memcpy(&value, where, sizeof(value));
+   return value;
+}
+
+static inline void writeUnaligned32(uint8_t* where, uint32_t value){
+   memcpy(where, &value, sizeof(value));
+}
+
+//lazily committed memory, pages are only given host memory once written, zeroLazyBuffer() gives them back
+static inline uint8_t* allocateLazyBuffer(uint64_t size){
+#if defined(__linux__)
+   void* buffer = mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0);
+
+   return buffer != MAP_FAILED ? (uint8_t*)buffer : NULL;
+#else
+   return (uint8_t*)calloc(size, 1);
+#endif
+}
+
+static inline void freeLazyBuffer(uint8_t* buffer, uint64_t size){
+#if defined(__linux__)
+   if(buffer)
+      munmap(buffer, size);
+#else
+   free(buffer);
+#endif
+}
+
+static inline void zeroLazyBuffer(uint8_t* buffer, uint64_t size){
+   //size must be a multiple of the host page size for the pages to be released
+#if defined(__linux__)
+   if(madvise(buffer, size, MADV_DONTNEED) == 0)
+      return;
+#endif
+   memset(buffer, 0x00, size);
+}
+
+static inline bool mapFileOverLazyBuffer(uint8_t* buffer, uint64_t size, const char* path){
+   //replaces the first size bytes of a buffer from allocateLazyBuffer() with the file, an empty or new file is grown to size, a file of any other size is left alone and false is returned
+#if defined(__linux__)
+   struct stat fileInfo;
+   int file = open(path, O_RDWR | O_CREAT, 0644);
+   void* mapped;
+
+   if(file < 0)
+      return false;
+
+   if(fstat(file, &fileInfo) != 0 || ((uint64_t)fileInfo.st_size != size && (fileInfo.st_size != 0 || ftruncate(file, size) != 0))){
+      close(file);
+      return false;
+   }
+
+   mapped = mmap(buffer, size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_FIXED, file, 0);
+   close(file);
+
+   return mapped == (void*)buffer;
+#else
+   return false;
+#endif
+}
+
+static inline bool flushMappedFile(uint8_t* buffer, uint64_t size){
+#if defined(__linux__)
+   return msync(buffer, size, MS_SYNC) == 0;
+#else
+   return false;
+#endif
+}
+
+static inline bool bufferIsZero(const uint8_t* buffer, uint64_t size){
+   return size == 0 || (buffer[0] == 0x00 && memcmp(buffer, buffer + 1, size - 1) == 0);
+}
+
 //threads
 #if defined(EMU_MULTITHREADED)
 #define PRAGMA_STRINGIFY(x) _Pragma(#x)
@@ -159,6 +245,37 @@ static inline double dClamp(double low, double value, double high){
    return dMax(low, dMin(value, high));
 }
 
+static inline uint32_t u32CeilFromDouble(double value){
+   //value must be positive and fit in a uint32_t
+   uint32_t truncated = value;
+
+   return truncated + (truncated < value);
+}
+
+//fixed point, emulated time is kept in 32.32 fixed point so it runs the same on every host
+#define FIXED_POINT_ONE (UINT64_C(1) << 32)
+
+static inline uint64_t fixedMultiply(uint64_t x, uint64_t y){
+   //the result must fit in 32.32, rounds down
+   uint64_t xHigh = x >> 32;
+   uint64_t xLow = x & 0xFFFFFFFF;
+   uint64_t yHigh = y >> 32;
+   uint64_t yLow = y & 0xFFFFFFFF;
+
+   return (xHigh * yHigh << 32) + xHigh * yLow + xLow * yHigh + (xLow * yLow >> 32);
+}
+
+static inline uint64_t fixedDivide(uint64_t x, uint64_t y){
+   //y must not be 0 and the result must fit in 32.32, rounds down, the fraction loses the low bits of y when y is 1.0 or more
+   uint64_t remainder = x % y;
+   uint8_t shift = 0;
+
+   while(y >> shift > 0xFFFFFFFF)
+      shift++;
+
+   return (x / y << 32) + ((remainder >> shift << 32) / (y >> shift));
+}
+
 //float platform safety
 static inline uint64_t getUint64FromDouble(double data){
    //1.32.31 fixed point
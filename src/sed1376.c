@@ -30,6 +30,9 @@
 
 uint16_t sed1376Framebuffer[160 * 160];
 uint8_t  sed1376Ram[SED1376_RAM_SIZE];
+bool     sed1376ScreenChanged;
+
+static uint8_t  sed1376LastRenderState;//the things outside the SED1376 that change the picture, as of the last render
 
 static uint8_t  sed1376Registers[SED1376_REG_SIZE];
 static uint8_t  sed1376RLut[SED1376_LUT_SIZE];
@@ -125,6 +128,8 @@ void sed1376Reset(void){
 
    //timing hack
    sed1376Registers[PWR_SAVE_CFG] = 0x80;
+
+   sed1376ScreenChanged = true;
 }
 
 uint64_t sed1376StateSize(void){
@@ -170,6 +175,8 @@ void sed1376LoadState(uint8_t* data){
    //refresh LUT
    MULTITHREAD_LOOP(index) for(index = 0; index < SED1376_LUT_SIZE; index++)
       sed1376OutputLut[index] = makeRgb16FromSed666(sed1376RLut[index], sed1376GLut[index], sed1376BLut[index]);
+
+   sed1376ScreenChanged = true;
 }
 
 bool sed1376PowerSaveEnabled(void){
@@ -217,6 +224,7 @@ uint8_t sed1376GetRegister(uint8_t address){
 }
 
 void sed1376SetRegister(uint8_t address, uint8_t value){
+   sed1376ScreenChanged = true;
 
    if(sandboxRunning())
       debugLog("SED1376 register write 0x%02X to 0x%02X, PC 0x%08X.\n", value, address, flx68000GetPc());
@@ -323,6 +331,14 @@ void sed1376SetRegister(uint8_t address, uint8_t value){
 }
 
 void sed1376Render(void){
+   uint8_t renderState = palmMisc.lcdOn | pllIsOn() << 1 | palmMisc.backlightLevel << 2;
+
+   //an idle Palm keeps showing the same picture, only redraw it when something it depends on changed
+   if(!sed1376ScreenChanged && renderState == sed1376LastRenderState)
+      return;
+   sed1376ScreenChanged = false;
+   sed1376LastRenderState = renderState;
+
    //render if LCD on, PLL on, power save off and force blank off, SED1376 clock is provided by the CPU, if its off so is the SED
    if(palmMisc.lcdOn && pllIsOn() && !sed1376PowerSaveEnabled() && !(sed1376Registers[DISP_MODE] & 0x80)){
       bool color = !!(sed1376Registers[PANEL_TYPE] & 0x40);
@@ -6,6 +6,7 @@
 
 extern uint16_t sed1376Framebuffer[];
 extern uint8_t sed1376Ram[];
+extern bool sed1376ScreenChanged;//set when VRAM or a register is written, sed1376Render() does nothing while its clear
 
 void sed1376Reset(void);
 uint64_t sed1376StateSize(void);
@@ -0,0 +1,93 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <time.h>
+
+#include "../../../src/emulator.h"
+#include "../../../src/specs/emuFeatureRegisterSpec.h"
+#include "../../../src/m68k/m68k.h"
+#include "../../../src/m68k/m68kops.h"
+
+
+static buffer_t loadFile(const char* path){
+   buffer_t file = {NULL, 0};
+   FILE* handle = fopen(path, "rb");
+
+   if(!handle)
+      return file;
+
+   fseek(handle, 0, SEEK_END);
+   file.size = ftell(handle);
+   fseek(handle, 0, SEEK_SET);
+   file.data = malloc(file.size);
+   if(!file.data || fread(file.data, 1, file.size, handle) != file.size){
+      free(file.data);
+      file.data = NULL;
+      file.size = 0;
+   }
+   fclose(handle);
+
+   return file;
+}
+
+int main(int argc, const char* argv[]){
+   buffer_t rom;
+   buffer_t bootloader = {NULL, 0};
+   uint32_t frames;
+   uint32_t frame;
+   uint32_t fusion;
+   uint32_t error;
+   clock_t start;
+   double seconds;
+
+   if(argc < 3){
+      printf("Usage: %s frames palmRom.rom [bootloader.rom]\n", argv[0]);
+      return 1;
+   }
+
+   frames = strtoul(argv[1], NULL, 0);
+   rom = loadFile(argv[2]);
+   if(!rom.data){
+      printf("Cant open %s\n", argv[2]);
+      return 1;
+   }
+   if(argc > 3){
+      bootloader = loadFile(argv[3]);
+      if(!bootloader.data){
+         printf("Cant open %s\n", argv[3]);
+         return 1;
+      }
+   }
+
+   error = emulatorInit(rom, bootloader, FEATURE_ACCURATE);
+   if(error != EMU_ERROR_NONE){
+      printf("emulatorInit failed, error:%d\n", error);
+      return 1;
+   }
+
+   //the 68k dispatch tables are touched on every opcode, their size is what competes with guest RAM for the cache
+   printf("68k dispatch tables: %d bytes\n", (int)(sizeof(m68ki_instruction_index_table) + sizeof(m68ki_instruction_handlers) + sizeof(m68ki_cycles[0])));
+
+   start = clock();
+   for(frame = 0; frame < frames; frame++)
+      emulatorRunFrame();
+   seconds = (double)(clock() - start) / CLOCKS_PER_SEC;
+
+   printf("%d frames in %f seconds, %f ms per frame, %f%% of real time\n", frames, seconds, seconds * 1000.0 / frames, seconds * EMU_FPS * 100.0 / frames);
+
+   //only counted when built with EMU_FUSED_M68K and EMU_FUSION_STATISTICS
+   for(fusion = 0; fusion < M68K_FUSIONS; fusion++){
+      uint64_t seen;
+      uint64_t fused;
+
+      m68k_get_fusion_counts(fusion, &seen, &fused);
+      printf("%s: seen %llu, fused %llu\n", m68k_get_fusion_name(fusion), (unsigned long long)seen, (unsigned long long)fused);
+   }
+
+   emulatorExit();
+   free(rom.data);
+   free(bootloader.data);
+
+   return 0;
+}
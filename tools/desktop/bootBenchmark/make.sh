@@ -0,0 +1,15 @@
+#!/bin/bash
+
+# builds the boot benchmark with the same source list as the other build systems
+# arg1 = frames, arg2 = ROM path, arg3 = bootloader path(optional), extra CFLAGS can be passed in the CFLAGS environment variable
+
+DIR="$( cd "$( dirname "${BASH_SOURCE[0]}" )" && pwd )"
+EMU_PATH=$DIR/../../../src
+
+cd $DIR
+
+SOURCES=$(sed -n 's/.*\$(EMU_PATH)\/\([^ ]*\.c\).*/\1/p' $EMU_PATH/makefile.all | sed "s|^|$EMU_PATH/|")
+gcc -O2 -DEMU_NO_SAFETY $CFLAGS ./main.c $SOURCES -lm -o ./bootBenchmark
+chmod 777 ./bootBenchmark
+./bootBenchmark "$@"
+rm -f ./bootBenchmark
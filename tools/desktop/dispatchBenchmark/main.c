@@ -0,0 +1,206 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include <time.h>
+
+//included from EMU_PATH so the benchmark can be built against an older core
+#include "emulator.h"
+#include "specs/emuFeatureRegisterSpec.h"
+#include "m68k/m68k.h"
+#include "m68k/m68kops.h"
+
+
+#define PROGRAM_OPCODES 0x20000//256kb of guest code run in a loop
+#define EXECUTE_CYCLES 10000000
+#define EXECUTE_CALLS 100
+#define CACHE_LINE 64
+#define L2_WAYS 16
+#define L2_MAX_SETS (1024 * 1024 / CACHE_LINE / L2_WAYS)
+
+
+//68000 opcodes that only use data and address registers, base opcode and the bits that can be anything
+typedef struct{
+   uint16_t base;
+   uint16_t variable;
+}opcode_template_t;
+
+static const opcode_template_t templates[] = {
+   {0x7000, 0x0EFF},//MOVEQ #,Dn
+   {0xD000, 0x0E07}, {0xD040, 0x0E0F}, {0xD080, 0x0E0F},//ADD Dn/An,Dn
+   {0x9000, 0x0E07}, {0x9040, 0x0E0F}, {0x9080, 0x0E0F},//SUB Dn/An,Dn
+   {0xB000, 0x0E07}, {0xB040, 0x0E0F}, {0xB080, 0x0E0F},//CMP Dn/An,Dn
+   {0xC000, 0x0E07}, {0xC040, 0x0E07}, {0xC080, 0x0E07},//AND Dn,Dn
+   {0x8000, 0x0E07}, {0x8040, 0x0E07}, {0x8080, 0x0E07},//OR Dn,Dn
+   {0xB100, 0x0E07}, {0xB140, 0x0E07}, {0xB180, 0x0E07},//EOR Dn,Dn
+   {0xD0C0, 0x0F0F},//ADDA.W/L Dn/An,An
+   {0x90C0, 0x0F0F},//SUBA.W/L Dn/An,An
+   {0x5000, 0x0EC7},//ADDQ/SUBQ #,Dn, size 3 is Scc and is also safe
+   {0x5100, 0x0EC7},
+   {0xE000, 0x0FE7}, {0xE008, 0x0FE7}, {0xE010, 0x0FE7}, {0xE018, 0x0FE7},//shifts and rotates, size 3 is caught below
+   {0x1000, 0x0E07}, {0x3000, 0x0E0F}, {0x2000, 0x0E0F},//MOVE Dn/An,Dn
+   {0x3040, 0x0E0F}, {0x2040, 0x0E0F},//MOVEA Dn/An,An
+   {0x4200, 0x00C7},//CLR Dn, size 3 is caught below
+   {0x4400, 0x00C7},//NEG Dn
+   {0x4600, 0x00C7},//NOT Dn
+   {0x4A00, 0x00C7},//TST Dn
+   {0x4840, 0x0007}, {0x4880, 0x0047},//SWAP, EXT
+   {0xC140, 0x0E07}, {0xC148, 0x0E07}, {0xC188, 0x0E07},//EXG
+   {0xC0C0, 0x0F07},//MULU/MULS Dn,Dn
+   {0x0100, 0x0EC7},//BTST/BCHG/BCLR/BSET Dn,Dn
+   {0xC100, 0x0E07}, {0x8100, 0x0E07},//ABCD/SBCD Dn,Dn
+   {0xD100, 0x0EC7}, {0x9100, 0x0EC7}//ADDX/SUBX Dn,Dn
+};
+
+static uint16_t program[PROGRAM_OPCODES];
+static uint64_t l2Tags[L2_MAX_SETS][L2_WAYS];
+static uint32_t l2Sets;
+static uint64_t l2Accesses;
+static uint64_t l2Misses;
+
+
+static uint16_t randomOpcode(void){
+   while(true){
+      const opcode_template_t* template = &templates[rand() % (sizeof(templates) / sizeof(templates[0]))];
+      uint16_t opcode = template->base | (rand() & template->variable);
+
+      //size 3 of the shift, CLR, NEG, NOT, TST and ADDX/SUBX groups is a different instruction that may touch memory
+      if((template->base & 0xF000) == 0xE000 || (template->base & 0xF900) == 0x4000 || template->base == 0x4A00 || (template->base & 0xB1C0) == 0x9100)
+         if((opcode & 0x00C0) == 0x00C0)
+            continue;
+
+      return opcode;
+   }
+}
+
+static void l2Access(const void* pointer){
+   //LRU, way 0 is the newest
+   uint64_t line = (uintptr_t)pointer / CACHE_LINE;
+   uint64_t* ways = l2Tags[line % l2Sets];
+   uint8_t way;
+
+   l2Accesses++;
+   for(way = 0; way < L2_WAYS - 1; way++)
+      if(ways[way] == line)
+         break;
+   if(ways[way] != line)
+      l2Misses++;
+   memmove(ways + 1, ways, way * sizeof(uint64_t));
+   ways[0] = line;
+}
+
+static uint32_t tableLinesTouched(void){
+   //how much of the dispatch tables the program keeps in the cache
+   static bool touched[0x10000 * 8 / CACHE_LINE * 3];
+   uint32_t lines = 0;
+   uint32_t index;
+
+   for(index = 0; index < PROGRAM_OPCODES; index++){
+      uint16_t opcode = program[index];
+
+#if defined(m68ki_instruction_handler)
+      touched[opcode * 2 / CACHE_LINE] = true;
+      touched[0x10000 * 2 / CACHE_LINE + m68ki_instruction_index_table[opcode] * sizeof(m68ki_instruction_handlers[0]) / CACHE_LINE] = true;
+#else
+      touched[opcode * sizeof(m68ki_instruction_jump_table[0]) / CACHE_LINE] = true;
+#endif
+      touched[0x10000 * 8 / CACHE_LINE * 2 + opcode / CACHE_LINE] = true;
+   }
+
+   for(index = 0; index < sizeof(touched); index++)
+      if(touched[index])
+         lines++;
+
+   return lines;
+}
+
+static void modelDispatch(const uint8_t* code, uint32_t l2Size){
+   //replays what an L2 would see if only the guest code and the dispatch tables were competing for it
+   uint32_t pass;
+   uint32_t index;
+
+   l2Sets = l2Size / CACHE_LINE / L2_WAYS;
+   memset(l2Tags, 0x00, sizeof(l2Tags));
+
+   for(pass = 0; pass < 4; pass++){
+      for(index = 0; index < PROGRAM_OPCODES; index++){
+         uint16_t opcode = program[index];
+
+         l2Access(code + index * 2);
+#if defined(m68ki_instruction_handler)
+         l2Access(&m68ki_instruction_index_table[opcode]);
+         l2Access(&m68ki_instruction_handlers[m68ki_instruction_index_table[opcode]]);
+#else
+         l2Access(&m68ki_instruction_jump_table[opcode]);
+#endif
+         l2Access(&m68ki_cycles[0][opcode]);
+      }
+
+      //the first pass fills the cache
+      if(pass == 0){
+         l2Accesses = 0;
+         l2Misses = 0;
+      }
+   }
+}
+
+int main(void){
+   buffer_t rom;
+   buffer_t bootloader = {NULL, 0};
+   uint32_t index;
+   uint32_t error;
+   uint64_t cycles = 0;
+   clock_t start;
+   double seconds;
+
+   rom.size = 0x400000;
+   rom.data = calloc(rom.size, 1);
+   if(!rom.data){
+      printf("Cant allocate ROM\n");
+      return 1;
+   }
+
+   //reset vectors, a long run of register only opcodes and a jump back to the start
+   srand(0);
+   for(index = 0; index < PROGRAM_OPCODES; index++)
+      program[index] = randomOpcode();
+   rom.data[2] = 0x10;
+   rom.data[7] = 0x08;
+   for(index = 0; index < PROGRAM_OPCODES; index++){
+      rom.data[0x08 + index * 2] = program[index] >> 8;
+      rom.data[0x08 + index * 2 + 1] = program[index] & 0xFF;
+   }
+   rom.data[0x08 + PROGRAM_OPCODES * 2] = 0x4E;
+   rom.data[0x08 + PROGRAM_OPCODES * 2 + 1] = 0xF9;
+   rom.data[0x08 + PROGRAM_OPCODES * 2 + 5] = 0x08;
+
+   error = emulatorInit(rom, bootloader, FEATURE_ACCURATE);
+   if(error != EMU_ERROR_NONE){
+      printf("emulatorInit failed, error:%d\n", error);
+      return 1;
+   }
+
+#if defined(m68ki_instruction_handler)
+   printf("16 bit handler indices, dispatch tables: %d bytes\n", (int)(sizeof(m68ki_instruction_index_table) + sizeof(m68ki_instruction_handlers) + sizeof(m68ki_cycles[0])));
+#else
+   printf("handler pointer per opcode, dispatch tables: %d bytes\n", (int)(sizeof(m68ki_instruction_jump_table) + sizeof(m68ki_cycles[0])));
+#endif
+
+   start = clock();
+   for(index = 0; index < EXECUTE_CALLS; index++)
+      cycles += m68k_execute(EXECUTE_CYCLES);
+   seconds = (double)(clock() - start) / CLOCKS_PER_SEC;
+   printf("%llu cycles in %f seconds, %f emulated MHz\n", (unsigned long long)cycles, seconds, cycles / seconds / 1000000.0);
+
+   printf("dispatch table cache lines used: %d, %d bytes\n", tableLinesTouched(), tableLinesTouched() * CACHE_LINE);
+   for(index = 256; index <= 1024; index *= 2){
+      modelDispatch(rom.data + 0x08, index * 1024);
+      printf("modelled %dkb L2: %llu accesses, %llu misses\n", index, (unsigned long long)l2Accesses, (unsigned long long)l2Misses);
+   }
+
+   emulatorExit();
+   free(rom.data);
+
+   return 0;
+}
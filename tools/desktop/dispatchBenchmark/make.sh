@@ -0,0 +1,15 @@
+#!/bin/bash
+
+# builds and runs the 68k dispatch benchmark with the same source list as the other build systems
+# EMU_PATH can be set to the src folder of another checkout to compare an older core, extra CFLAGS can be passed in the CFLAGS environment variable
+
+DIR="$( cd "$( dirname "${BASH_SOURCE[0]}" )" && pwd )"
+EMU_PATH=${EMU_PATH:-$DIR/../../../src}
+
+cd $DIR
+
+SOURCES=$(sed -n 's/.*\$(EMU_PATH)\/\([^ ]*\.c\).*/\1/p' $EMU_PATH/makefile.all | sed "s|^|$EMU_PATH/|")
+gcc -O2 -DEMU_NO_SAFETY $CFLAGS -I$EMU_PATH ./main.c $SOURCES -lm -o ./dispatchBenchmark
+chmod 777 ./dispatchBenchmark
+./dispatchBenchmark
+rm -f ./dispatchBenchmark
@@ -0,0 +1,256 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <time.h>
+
+#include "../../../src/emulator.h"
+#include "../../../src/hardwareRegisters.h"
+#include "../../../src/m68k/m68k.h"
+#include "../../../src/specs/emuFeatureRegisterSpec.h"
+#include "../../../src/specs/dragonballVzRegisterSpec.h"
+
+
+#define ROM_START 0x10000000
+#define PROGRAM_START 0x400//after the handler
+#define PROGRAM_OPCODES 4000
+#define FRAMES 200
+
+
+static uint8_t* rom;
+static uint32_t romOffset;
+
+
+static void emit16(uint16_t value){
+   rom[romOffset] = value >> 8;
+   rom[romOffset + 1] = value & 0xFF;
+   romOffset += 2;
+}
+
+static void emit32(uint32_t value){
+   emit16(value >> 16);
+   emit16(value & 0xFFFF);
+}
+
+static uint32_t randomRange(uint32_t start, uint32_t end){
+   return start + rand() % (end - start + 1);
+}
+
+static uint32_t random32(void){
+   return (uint32_t)rand() << 16 ^ (uint32_t)rand();
+}
+
+static uint16_t randomSource(void){
+   //any data or address register as a mode 0 or 1 source
+   uint16_t reg = randomRange(0, 15);
+
+   return reg >= 8 ? 0x0008 | (reg & 7) : reg;
+}
+
+static void emitRegisterOpcode(void){
+   //only the opcodes the translator handles, the destinations are D0-D6 and A4-A6 so the loop counter, the memory pointers and the stack are left alone
+   uint16_t dx = randomRange(0, 6);
+   uint16_t dy = randomRange(0, 6);
+   uint16_t ax = randomRange(4, 6);
+   uint16_t ay = randomRange(4, 6);
+   uint16_t q = randomRange(0, 7);
+
+   switch(randomRange(0, 23)){
+      case 0: emit16(0x7000 | dx << 9 | randomRange(0, 255)); break;//MOVEQ
+      case 1: emit16(0x2000 | dx << 9 | randomSource()); break;//MOVE.L Ry,Dx
+      case 2: emit16(0x2040 | ax << 9 | randomSource()); break;//MOVEA.L Ry,Ax
+      case 3: emit16(0x203C | dx << 9); emit32(random32()); break;//MOVE.L #,Dx
+      case 4: emit16(0x207C | ax << 9); emit32(random32()); break;//MOVEA.L #,Ax
+      case 5: emit16(0x3000 | dx << 9 | dy); break;//MOVE.W Dy,Dx
+      case 6: emit16(0xD080 | dx << 9 | randomSource()); break;//ADD.L
+      case 7: emit16(0x9080 | dx << 9 | randomSource()); break;//SUB.L
+      case 8: emit16(0xB080 | dx << 9 | randomSource()); break;//CMP.L
+      case 9: emit16((rand() & 1 ? 0x5180 : 0x5080) | q << 9 | dy); break;//ADDQ.L/SUBQ.L #,Dy
+      case 10: emit16((rand() & 1 ? 0x5100 : 0x5000) | (rand() & 1 ? 0x0048 : 0x0088) | q << 9 | ay); break;//ADDQ/SUBQ #,Ay
+      case 11: emit16((rand() & 1 ? 0x91C0 : 0xD1C0) | ax << 9 | randomSource()); break;//ADDA.L/SUBA.L
+      case 12: emit16((rand() & 1 ? 0xC080 : 0x8080) | dx << 9 | randomRange(0, 7)); break;//AND.L/OR.L
+      case 13: emit16(0xB180 | randomRange(0, 7) << 9 | dy); break;//EOR.L
+      case 14: emit16(0x4280 | dy); break;//CLR.L
+      case 15: emit16(0x4A80 | randomRange(0, 7)); break;//TST.L
+      case 16: emit16(0x4680 | dy); break;//NOT.L
+      case 17: emit16(0x4480 | dy); break;//NEG.L
+      case 18: emit16(0x4840 | dy); break;//SWAP
+      case 19: emit16((rand() & 1 ? 0x48C0 : 0x4880) | dy); break;//EXT.L/EXT.W
+      case 20: emit16(0x41D0 | ax << 9 | randomRange(0, 7)); break;//LEA (Ay),Ax
+      case 21: emit16(0x41E8 | ax << 9 | randomRange(0, 7)); emit16(random32()); break;//LEA d16(Ay),Ax
+      case 22://EXG
+         switch(randomRange(0, 2)){
+            case 0: emit16(0xC140 | dx << 9 | dy); break;
+            case 1: emit16(0xC148 | ax << 9 | ay); break;
+            case 2: emit16(0xC188 | dx << 9 | ay); break;
+         }
+         break;
+      case 23: emit16(0x4E71); break;//NOP
+   }
+}
+
+static void emitMemoryOpcode(void){
+   //MOVE.L between D0-D6 and RAM through A0-A2
+   uint16_t dx = randomRange(0, 6);
+   uint16_t an = randomRange(0, 2);
+   uint16_t displacement = randomRange(0, 64) * 2 - 64;
+
+   switch(randomRange(0, 6)){
+      case 0: emit16(0x2010 | dx << 9 | an); break;//(An),Dx
+      case 1: emit16(0x2018 | dx << 9 | an); break;//(An)+,Dx
+      case 2: emit16(0x2028 | dx << 9 | an); emit16(displacement); break;//d16(An),Dx
+      case 3: emit16(0x2080 | an << 9 | dx); break;//Dx,(An)
+      case 4: emit16(0x20C0 | an << 9 | dx); break;//Dx,(An)+
+      case 5: emit16(0x2100 | an << 9 | dx); break;//Dx,-(An)
+      case 6: emit16(0x2140 | an << 9 | dx); emit16(displacement); break;//Dx,d16(An)
+   }
+}
+
+static void emitOtherOpcode(void){
+   //opcodes that arnt translated and end a block
+   uint16_t dx = randomRange(0, 6);
+   uint16_t dy = randomRange(0, 7);
+
+   switch(randomRange(0, 3)){
+      case 0: emit16(0xE388 | dx); break;//LSL.L #1,Dx
+      case 1: emit16(0xC0C0 | dx << 9 | dy); break;//MULU.W Dy,Dx
+      case 2: emit16(0x6602); emit16(0x4E71); break;//BNE.S over a NOP
+      case 3: emit16(0xD180 | dx << 9 | randomRange(0, 6)); break;//ADDX.L
+   }
+}
+
+static void emitProgram(void){
+   uint32_t index;
+   uint32_t loop;
+
+   //all vectors go to a handler that acknowledges timer 2 and returns
+   romOffset = 0x100;
+   emit16(0x4A78); emit16(0xF000 | TSTAT2);//tst.w (TSTAT2).w
+   emit16(0x31FC); emit16(0x0000); emit16(0xF000 | TSTAT2);//move.w #0,(TSTAT2).w
+   emit16(0x4E73);//rte
+
+   romOffset = PROGRAM_START;
+   emit16(0x46FC); emit16(0x2000);//move.w #0x2000,sr
+   loop = ROM_START + romOffset;
+   emit16(0x207C); emit32(0x00010000);//movea.l #,a0
+   emit16(0x227C); emit32(0x00020000);//movea.l #,a1
+   emit16(0x247C); emit32(0x00030000);//movea.l #,a2
+   emit16(0x267C); emit32(0xFFFFF000 | IMR);//movea.l #,a3
+   for(index = 0; index < PROGRAM_OPCODES; index++){
+      uint32_t kind = randomRange(0, 99);
+
+      if(kind < 70){
+         emitRegisterOpcode();
+      }
+      else if(kind < 85){
+         emitMemoryOpcode();
+      }
+      else if(kind < 95){
+         emitOtherOpcode();
+      }
+      else if(kind < 97){
+         //mask or unmask timer 2, a pending interrupt is taken in the middle of the block
+         emit16(0x2E3C); emit32(rand() & 1 ? 0x00FFFFFF : 0x00FFFFDF);//move.l #,d7
+         emit16(0x2687);//move.l d7,(a3)
+      }
+      else{
+         //a short DBF loop over translated opcodes
+         uint32_t body;
+         uint32_t bodyOpcodes = randomRange(1, 6);
+         uint32_t bodyIndex;
+
+         emit16(0x7E00 | randomRange(1, 20));//moveq #,d7
+         body = romOffset;
+         for(bodyIndex = 0; bodyIndex < bodyOpcodes; bodyIndex++){
+            if(rand() & 3)
+               emitRegisterOpcode();
+            else
+               emitMemoryOpcode();
+         }
+         emit16(0x51CF); emit16(body - romOffset);//dbf d7,body
+      }
+   }
+   emit16(0x4EF9); emit32(loop);//jmp loop
+}
+
+static uint64_t hashState(void){
+   //FNV-1a of the registers and the RAM the program writes
+   uint64_t hash = 0xCBF29CE484222325ULL;
+   uint32_t index;
+
+   for(index = M68K_REG_D0; index <= M68K_REG_SR; index++){
+      uint32_t value = m68k_get_reg(NULL, index);
+      uint8_t byte;
+
+      for(byte = 0; byte < 4; byte++){
+         hash ^= value >> byte * 8 & 0xFF;
+         hash *= 0x100000001B3ULL;
+      }
+   }
+   for(index = 0x0000F000; index < 0x00031000; index++){
+      hash ^= palmRam[index];
+      hash *= 0x100000001B3ULL;
+   }
+
+   return hash;
+}
+
+
+int main(void){
+   buffer_t romBuffer;
+   buffer_t bootloader = {NULL, 0};
+   uint32_t index;
+   uint32_t error;
+   clock_t start;
+
+   romBuffer.size = 0x400000;
+   romBuffer.data = calloc(romBuffer.size, 1);
+   if(!romBuffer.data){
+      printf("Cant allocate ROM\n");
+      return 1;
+   }
+   rom = romBuffer.data;
+
+   //reset vectors, the stack is in RAM once it is turned on below
+   romOffset = 0;
+   emit32(0x00001000);
+   emit32(ROM_START + PROGRAM_START);
+   srand(0);
+   emitProgram();
+
+   error = emulatorInit(romBuffer, bootloader, FEATURE_ACCURATE);
+   if(error != EMU_ERROR_NONE){
+      printf("emulatorInit failed, error:%d\n", error);
+      return 1;
+   }
+
+   //ROM at 0x10000000, 16mb of RAM at 0, no watchdog
+   setHwRegister16(0xFFFFF000 | WATCHDOG, 0x0000);
+   setHwRegister16(0xFFFFF000 | CSGBA, ROM_START >> 13);
+   setHwRegister16(0xFFFFF000 | CSA, 0x000B);
+   setHwRegister16(0xFFFFF000 | CSGBD, 0x0000);
+   setHwRegister16(0xFFFFF000 | CSCTRL1, 0x0040);
+   setHwRegister16(0xFFFFF000 | CSD, 0x0201);
+   setHwRegister16(0xFFFFF000 | SDCTRL, 0x8000);
+   setHwRegister16(0xFFFFF000 | DRAMC, 0x8000);
+   for(index = 0x08; index < 0x400; index += 4)
+      m68k_write_memory_32(index, ROM_START + 0x100);
+
+   //timer 2 interrupts every 5000 SYSCLKs
+   setHwRegister16(0xFFFFF000 | TPRER2, 0x0000);
+   setHwRegister16(0xFFFFF000 | TCMP2, 5000);
+   setHwRegister16(0xFFFFF000 | TCTL2, 0x0013);
+   setHwRegister32(0xFFFFF000 | IMR, 0x00FFFFDF);
+
+   start = clock();
+   for(index = 0; index < FRAMES; index++){
+      emulatorRunFrame();
+      printf("frame %d: PC 0x%08X, state 0x%016llX, %d timeslices\n", index, m68k_get_reg(NULL, M68K_REG_PC), (unsigned long long)hashState(), palmFrameTimeslices);
+   }
+   fprintf(stderr, "%d frames in %f seconds\n", FRAMES, (double)(clock() - start) / CLOCKS_PER_SEC);
+
+   emulatorExit();
+   free(romBuffer.data);
+
+   return 0;
+}
@@ -0,0 +1,28 @@
+#!/bin/bash
+
+# builds the x86-64 translator check with and without the translator using the same source list as the other build systems and compares what both did, extra CFLAGS can be passed in the CFLAGS environment variable
+
+DIR="$( cd "$( dirname "${BASH_SOURCE[0]}" )" && pwd )"
+EMU_PATH=$DIR/../../../src
+
+cd $DIR
+
+SOURCES=$(sed -n 's/.*\$(EMU_PATH)\/\([^ ]*\.c\).*/\1/p' $EMU_PATH/makefile.all | sed "s|^|$EMU_PATH/|")
+gcc -O2 -DEMU_NO_SAFETY $CFLAGS ./main.c $SOURCES -lm -o ./jitCheckInterpreter
+gcc -O2 -DEMU_NO_SAFETY -DEMU_X86_64_JIT $CFLAGS ./main.c $SOURCES -lm -o ./jitCheckTranslated
+chmod 777 ./jitCheckInterpreter ./jitCheckTranslated
+echo "interpreter:"
+./jitCheckInterpreter > ./interpreter.txt
+echo "translator:"
+./jitCheckTranslated > ./translated.txt
+if cmp -s ./interpreter.txt ./translated.txt; then
+   tail -n 1 ./translated.txt
+   echo "Pass"
+   RESULT=0
+else
+   diff ./interpreter.txt ./translated.txt | head -n 10
+   echo "Fail, the translated code didnt do the same as the handlers"
+   RESULT=1
+fi
+rm -f ./jitCheckInterpreter ./jitCheckTranslated ./interpreter.txt ./translated.txt
+exit $RESULT
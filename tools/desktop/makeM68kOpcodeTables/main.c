@@ -0,0 +1,150 @@
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+
+
+#define MAX_LINE 1024
+#define MAX_HANDLERS 4096
+#define CPU_TYPES 3
+
+
+typedef struct{
+   char     name[64];
+   uint32_t mask;
+   uint32_t match;
+   uint32_t cycles[CPU_TYPES];
+}opcode_handler_t;
+
+static opcode_handler_t handlers[MAX_HANDLERS];
+static int              handlerCount = 0;
+static uint16_t         indexTable[0x10000];
+static uint8_t          cycleTables[CPU_TYPES][0x10000];
+
+
+static int readHandlers(const char* path){
+   FILE* file = fopen(path, "r");
+   char line[MAX_LINE];
+
+   if(!file){
+      fprintf(stderr, "Cant open %s\n", path);
+      return 0;
+   }
+
+   while(fgets(line, sizeof(line), file)){
+      opcode_handler_t* handler = &handlers[handlerCount];
+
+      //skip comments and empty lines
+      if(line[0] != '{')
+         continue;
+
+      if(handlerCount >= MAX_HANDLERS - 1 || sscanf(line, "{%63[a-z0-9_] ,%x ,%x , {%u ,%u ,%u", handler->name, &handler->mask, &handler->match, &handler->cycles[0], &handler->cycles[1], &handler->cycles[2]) != 6){
+         fprintf(stderr, "Bad handler in %s:%s", path, line);
+         fclose(file);
+         return 0;
+      }
+      handlerCount++;
+   }
+
+   fclose(file);
+
+   //the last index is used for every opcode without a handler
+   strcpy(handlers[handlerCount].name, "m68k_op_illegal");
+   handlerCount++;
+
+   return 1;
+}
+
+static void buildTables(void){
+   //same as the old m68ki_build_opcode_table() and m68ki_build_cycle_table(), later handlers overwrite earlier ones
+   int handler;
+   int cpu;
+   int i;
+
+   for(i = 0; i < 0x10000; i++)
+      indexTable[i] = handlerCount - 1;
+
+   for(handler = 0; handler < handlerCount - 1; handler++)
+      for(i = 0; i < 0x10000; i++)
+         if((i & handlers[handler].mask) == handlers[handler].match)
+            indexTable[i] = handler;
+
+   for(cpu = 0; cpu < CPU_TYPES; cpu++){
+      for(i = 0; i < 0x10000; i++){
+         opcode_handler_t* ostruct = &handlers[indexTable[i]];
+
+         cycleTables[cpu][i] = ostruct->cycles[cpu];
+
+         //shifts with the distance encoded in the opcode take 2 cycles per bit on the 68000 and 68010, not on the 68020
+         if(ostruct->mask == 0xf1f8 && (i & 0xf000) == 0xe000 && !(i & 0x20) && cpu < 2)
+            cycleTables[cpu][i] += ((((i >> 9) - 1) & 7) + 1) << 1;
+      }
+   }
+}
+
+static void printTables(void){
+   int cpu;
+   int i;
+
+   printf("/* ======================================================================== */\n");
+   printf("/* ========================= OPCODE HANDLER TABLES ======================== */\n");
+   printf("/* ======================================================================== */\n");
+   printf("\n");
+   printf("/* Generated by tools/desktop/makeM68kOpcodeTables from m68kophandlers.txt,\n");
+   printf(" * dont edit this file, edit m68kophandlers.txt and run make.sh again.\n");
+   printf(" * The tables are const so nothing has to be built when the CPU starts.\n");
+   printf(" */\n");
+   printf("\n");
+   printf("#include <stdint.h>\n");
+   printf("#include \"m68kops.h\"\n");
+   printf("\n");
+   printf("#if M68KI_INSTRUCTION_HANDLERS != %d\n", handlerCount);
+   printf("#error \"M68KI_INSTRUCTION_HANDLERS in m68kops.h must be %d\"\n", handlerCount);
+   printf("#endif\n");
+   printf("\n");
+
+   printf("/* Opcode handlers by index */\n");
+   printf("void (*const m68ki_instruction_handlers[M68KI_INSTRUCTION_HANDLERS])(void) =\n");
+   printf("{\n");
+   for(i = 0; i < handlerCount; i++)
+      printf("   %s%s\n", handlers[i].name, i + 1 < handlerCount ? "," : "");
+   printf("};\n");
+   printf("\n");
+
+   printf("/* Handler index for every opcode */\n");
+   printf("const uint16_t m68ki_instruction_index_table[0x10000] =\n");
+   printf("{");
+   for(i = 0; i < 0x10000; i++)
+      printf("%s%d%s", i % 16 == 0 ? "\n   " : "", indexTable[i], i + 1 < 0x10000 ? "," : "\n");
+   printf("};\n");
+   printf("\n");
+
+   printf("/* Cycles for every opcode, 0 = 68000, 1 = 68010, 2 = 68020 */\n");
+   printf("const uint8_t m68ki_cycles[%d][0x10000] =\n", CPU_TYPES);
+   printf("{\n");
+   for(cpu = 0; cpu < CPU_TYPES; cpu++){
+      printf("   {");
+      for(i = 0; i < 0x10000; i++)
+         printf("%s%d%s", i % 32 == 0 ? "\n      " : "", cycleTables[cpu][i], i + 1 < 0x10000 ? "," : "\n");
+      printf("   }%s\n", cpu + 1 < CPU_TYPES ? "," : "");
+   }
+   printf("};\n");
+   printf("\n");
+
+   printf("/* ======================================================================== */\n");
+   printf("/* ============================== END OF FILE ============================= */\n");
+   printf("/* ======================================================================== */\n");
+}
+
+int main(int argc, const char* argv[]){
+   if(argc < 2){
+      fprintf(stderr, "Usage: %s m68kophandlers.txt > m68kops.c\n", argv[0]);
+      return 1;
+   }
+
+   if(!readHandlers(argv[1]))
+      return 1;
+   buildTables();
+   printTables();
+
+   return 0;
+}
@@ -0,0 +1,13 @@
+#!/bin/bash
+
+# regenerates src/m68k/m68kops.c from the Musashi opcode handler table
+
+DIR="$( cd "$( dirname "${BASH_SOURCE[0]}" )" && pwd )"
+M68K_DIR=$DIR/../../../src/m68k
+
+cd $DIR
+
+gcc ./main.c -o ./makeM68kOpcodeTables
+chmod 777 ./makeM68kOpcodeTables
+./makeM68kOpcodeTables $M68K_DIR/m68kophandlers.txt > $M68K_DIR/m68kops.c.new && mv $M68K_DIR/m68kops.c.new $M68K_DIR/m68kops.c
+rm -f ./makeM68kOpcodeTables
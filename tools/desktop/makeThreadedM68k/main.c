@@ -0,0 +1,245 @@
+#include <stdio.h>
+#include <string.h>
+#include <ctype.h>
+
+
+#define MAX_LINE 1024
+
+
+static char handlerNames[4096][64];
+static int  handlerCount = 0;
+
+
+static void printHeader(void){
+   printf("#include <stdlib.h>\n");
+   printf("\n");
+   printf("#include \"m68kops.h\"\n");
+   printf("#include \"m68kcpu.h\"\n");
+   printf("\n");
+   printf("/* ======================================================================== */\n");
+   printf("/* ==================== THREADED INSTRUCTION HANDLERS ===================== */\n");
+   printf("/* ======================================================================== */\n");
+   printf("\n");
+   printf("/* Generated by tools/desktop/makeThreadedM68k from m68kopac.c, m68kopdm.c and\n");
+   printf(" * m68kopnz.c, dont edit this file, edit the handlers and run make.sh again.\n");
+   printf(" */\n");
+   printf("\n");
+   printf("#if M68K_THREADED_DISPATCH\n");
+   printf("typedef struct\n");
+   printf("{\n");
+   printf("   void (*handler)(void);\n");
+   printf("   void* label;\n");
+   printf("} m68ki_threaded_handler;\n");
+   printf("\n");
+   printf("static int m68ki_threaded_compare(const void* a, const void* b)\n");
+   printf("{\n");
+   printf("   uintptr_t handler_a = (uintptr_t)((const m68ki_threaded_handler*)a)->handler;\n");
+   printf("   uintptr_t handler_b = (uintptr_t)((const m68ki_threaded_handler*)b)->handler;\n");
+   printf("\n");
+   printf("   return handler_a < handler_b ? -1 : handler_a > handler_b;\n");
+   printf("}\n");
+   printf("\n");
+   printf("/* Fetch the next opcode and jump straight to its handler */\n");
+   printf("#define M68KI_THREADED_DISPATCH() \\\n");
+   printf("   do \\\n");
+   printf("   { \\\n");
+   printf("      REG_PPC = REG_PC; \\\n");
+   printf("      REG_IR = m68ki_read_imm_16(); \\\n");
+   printf("      goto *m68ki_threaded_jump_table[m68ki_instruction_index_table[REG_IR]]; \\\n");
+   printf("   } while(0)\n");
+   printf("\n");
+   printf("/* End of every handler, same as the end of the loop in m68k_execute() */\n");
+   printf("#define M68KI_THREADED_NEXT() \\\n");
+   printf("   do \\\n");
+   printf("   { \\\n");
+   printf("      USE_CYCLES(CYC_INSTRUCTION[REG_IR]); \\\n");
+   printf("      if(GET_CYCLES() <= 0) \\\n");
+   printf("         return; \\\n");
+   printf("      M68KI_THREADED_DISPATCH(); \\\n");
+   printf("   } while(0)\n");
+   printf("\n");
+}
+
+static int isLabelLine(const char* line, char* label){
+   //a line with only an identifier followed by ':'
+   const char* start = line;
+   const char* end;
+
+   while(isspace((unsigned char)*start))
+      start++;
+   end = start;
+   while(isalnum((unsigned char)*end) || *end == '_')
+      end++;
+   if(end == start || *end != ':' || end[1] == ':')
+      return 0;
+   if(strncmp(start, "default", end - start) == 0 && end - start == 7)
+      return 0;
+   memcpy(label, start, end - start);
+   label[end - start] = '\0';
+   return 1;
+}
+
+static void printBodyLine(FILE* out, const char* handler, const char* line, int* usesDone){
+   //returns leave the handler so they become jumps to the end of it, gotos get the handler prefixed to their label
+   const char* position = line;
+
+   if(line[0] == '\n' || line[0] == '\0'){
+      fprintf(out, "\n");
+      return;
+   }
+
+   fprintf(out, "   ");
+   while(*position){
+      if(strncmp(position, "return;", 7) == 0){
+         fprintf(out, "goto %s_done;", handler);
+         *usesDone = 1;
+         position += 7;
+      }
+      else if(strncmp(position, "goto ", 5) == 0){
+         fprintf(out, "goto %s_", handler);
+         position += 5;
+      }
+      else{
+         fputc(*position, out);
+         position++;
+      }
+   }
+}
+
+static int convertFile(FILE* out, const char* path){
+   FILE* file = fopen(path, "r");
+   char line[MAX_LINE];
+   char handler[64];
+   int inHandler = 0;
+   int usesDone = 0;
+
+   if(!file){
+      fprintf(stderr, "Cant open %s\n", path);
+      return 0;
+   }
+
+   while(fgets(line, sizeof(line), file)){
+      if(!inHandler){
+         if(strncmp(line, "void m68k_op_", 13) == 0){
+            char* nameEnd = strchr(line + 5, '(');
+
+            if(!nameEnd || nameEnd - (line + 5) >= (int)sizeof(handler)){
+               fprintf(stderr, "Bad handler in %s:%s", path, line);
+               fclose(file);
+               return 0;
+            }
+            memcpy(handler, line + 5, nameEnd - (line + 5));
+            handler[nameEnd - (line + 5)] = '\0';
+            strcpy(handlerNames[handlerCount++], handler);
+
+            //skip the opening brace
+            if(!fgets(line, sizeof(line), file) || line[0] != '{'){
+               fprintf(stderr, "Missing { after %s in %s\n", handler, path);
+               fclose(file);
+               return 0;
+            }
+            fprintf(out, "%s:\n", handler);
+            fprintf(out, "   {\n");
+            inHandler = 1;
+            usesDone = 0;
+         }
+      }
+      else{
+         char label[MAX_LINE];
+
+         if(line[0] == '}'){
+            fprintf(out, "   }\n");
+            if(usesDone)
+               fprintf(out, "%s_done: __attribute__((unused));\n", handler);
+            fprintf(out, "   M68KI_THREADED_NEXT();\n");
+            fprintf(out, "\n");
+            inHandler = 0;
+         }
+         else if(isLabelLine(line, label)){
+            fprintf(out, "%s_%s:\n", handler, label);
+         }
+         else{
+            printBodyLine(out, handler, line, &usesDone);
+         }
+      }
+   }
+
+   fclose(file);
+   return 1;
+}
+
+int main(int argc, const char* argv[]){
+   int index;
+
+   if(argc < 2){
+      fprintf(stderr, "Usage: %s m68kopac.c m68kopdm.c m68kopnz.c > m68kthreaded.c\n", argv[0]);
+      return 1;
+   }
+
+   printHeader();
+
+   printf("/* Runs opcodes until the cycles run out, every handler is a label and jumps to the next opcode itself */\n");
+   printf("void m68ki_execute_threaded(void)\n");
+   printf("{\n");
+   printf("   static m68ki_threaded_handler m68ki_threaded_handlers[] =\n");
+   printf("   {\n");
+
+   //the handler list has to come before the bodys but is built from them, so write the bodys to a temporary file first
+   {
+      FILE* bodys = tmpfile();
+      char line[MAX_LINE];
+
+      if(!bodys){
+         fprintf(stderr, "Cant create temporary file\n");
+         return 1;
+      }
+
+      for(index = 1; index < argc; index++){
+         if(!convertFile(bodys, argv[index])){
+            fclose(bodys);
+            return 1;
+         }
+      }
+
+      for(index = 0; index < handlerCount; index++)
+         printf("      {%s, &&%s},\n", handlerNames[index], handlerNames[index]);
+      printf("   };\n");
+      printf("   static void* m68ki_threaded_jump_table[M68KI_INSTRUCTION_HANDLERS];\n");
+      printf("   static int m68ki_threaded_built = 0;\n");
+      printf("\n");
+      printf("   if(!m68ki_threaded_built)\n");
+      printf("   {\n");
+      printf("      /* match every handler in m68ki_instruction_handlers[] to its label */\n");
+      printf("      uint i;\n");
+      printf("\n");
+      printf("      qsort(m68ki_threaded_handlers, sizeof(m68ki_threaded_handlers) / sizeof(m68ki_threaded_handlers[0]), sizeof(m68ki_threaded_handler), m68ki_threaded_compare);\n");
+      printf("      for(i = 0; i < M68KI_INSTRUCTION_HANDLERS; i++)\n");
+      printf("      {\n");
+      printf("         m68ki_threaded_handler key;\n");
+      printf("         m68ki_threaded_handler* found;\n");
+      printf("\n");
+      printf("         key.handler = m68ki_instruction_handlers[i];\n");
+      printf("         found = bsearch(&key, m68ki_threaded_handlers, sizeof(m68ki_threaded_handlers) / sizeof(m68ki_threaded_handlers[0]), sizeof(m68ki_threaded_handler), m68ki_threaded_compare);\n");
+      printf("         m68ki_threaded_jump_table[i] = found ? found->label : &&m68k_op_illegal;\n");
+      printf("      }\n");
+      printf("      m68ki_threaded_built = 1;\n");
+      printf("   }\n");
+      printf("\n");
+      printf("   M68KI_THREADED_DISPATCH();\n");
+      printf("\n");
+
+      rewind(bodys);
+      while(fgets(line, sizeof(line), bodys))
+         fputs(line, stdout);
+      fclose(bodys);
+   }
+
+   printf("}\n");
+   printf("#endif /* M68K_THREADED_DISPATCH */\n");
+   printf("\n");
+   printf("/* ======================================================================== */\n");
+   printf("/* ============================== END OF FILE ============================= */\n");
+   printf("/* ======================================================================== */\n");
+
+   return 0;
+}
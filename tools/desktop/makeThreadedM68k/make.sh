@@ -0,0 +1,13 @@
+#!/bin/bash
+
+# regenerates src/m68k/m68kthreaded.c from the Musashi opcode handlers
+
+DIR="$( cd "$( dirname "${BASH_SOURCE[0]}" )" && pwd )"
+M68K_DIR=$DIR/../../../src/m68k
+
+cd $DIR
+
+gcc ./main.c -o ./makeThreadedM68k
+chmod 777 ./makeThreadedM68k
+./makeThreadedM68k $M68K_DIR/m68kopac.c $M68K_DIR/m68kopdm.c $M68K_DIR/m68kopnz.c > $M68K_DIR/m68kthreaded.c
+rm -f ./makeThreadedM68k
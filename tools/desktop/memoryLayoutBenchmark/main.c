@@ -0,0 +1,98 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <time.h>
+
+#include "../../../src/portability.h"
+#include "../../../src/memoryAccess.h"
+
+
+#define ACCESSES 0x4000000
+#define RAM_MASK (RAM_SIZE - 1)
+
+
+static uint8_t* ram;
+static uint32_t addresses[0x10000];
+
+
+static double timeReads32(void){
+   clock_t start = clock();
+   uint32_t sum = 0;
+   uint32_t index;
+
+   for(index = 0; index < ACCESSES; index++)
+      sum += BUFFER_READ_32(ram, addresses[index & 0xFFFF] + index * 4, RAM_MASK);
+
+   //keep the reads from being removed
+   if(sum == 0x12345678)
+      printf("\n");
+
+   return (double)(clock() - start) / CLOCKS_PER_SEC;
+}
+
+static double timeWrites32(void){
+   clock_t start = clock();
+   uint32_t index;
+
+   for(index = 0; index < ACCESSES; index++)
+      BUFFER_WRITE_32(ram, addresses[index & 0xFFFF] + index * 4, RAM_MASK, index);
+
+   return (double)(clock() - start) / CLOCKS_PER_SEC;
+}
+
+static double timeReads16(void){
+   clock_t start = clock();
+   uint32_t sum = 0;
+   uint32_t index;
+
+   for(index = 0; index < ACCESSES; index++)
+      sum += BUFFER_READ_16(ram, addresses[index & 0xFFFF] + index * 2, RAM_MASK);
+
+   if(sum == 0x12345678)
+      printf("\n");
+
+   return (double)(clock() - start) / CLOCKS_PER_SEC;
+}
+
+static double timeReads8(void){
+   clock_t start = clock();
+   uint32_t sum = 0;
+   uint32_t index;
+
+   for(index = 0; index < ACCESSES; index++)
+      sum += BUFFER_READ_8(ram, addresses[index & 0xFFFF] + index, RAM_MASK);
+
+   if(sum == 0x12345678)
+      printf("\n");
+
+   return (double)(clock() - start) / CLOCKS_PER_SEC;
+}
+
+int main(void){
+   uint32_t index;
+
+   ram = calloc(RAM_SIZE + 4, 1);
+   if(!ram){
+      printf("Cant allocate RAM\n");
+      return 1;
+   }
+
+   //the 68k only does word aligned 16 and 32 bit accesses, mostly close to each other
+   srand(0);
+   for(index = 0; index < 0x10000; index++)
+      addresses[index] = (rand() & 0xFF) << 12 & ~1;
+
+#if defined(EMU_BIG_ENDIAN_MEMORY)
+   printf("Palm byte order, swapped on access(EMU_BIG_ENDIAN_MEMORY):\n");
+#else
+   printf("16 bit swapped byte order(default):\n");
+#endif
+   printf("32 bit reads:  %f ns per access\n", timeReads32() * 1000000000.0 / ACCESSES);
+   printf("32 bit writes: %f ns per access\n", timeWrites32() * 1000000000.0 / ACCESSES);
+   printf("16 bit reads:  %f ns per access\n", timeReads16() * 1000000000.0 / ACCESSES);
+   printf("8 bit reads:   %f ns per access\n", timeReads8() * 1000000000.0 / ACCESSES);
+
+   free(ram);
+   return 0;
+}
@@ -0,0 +1,14 @@
+#!/bin/bash
+
+# builds and runs the memory access benchmark once for each RAM layout
+
+DIR="$( cd "$( dirname "${BASH_SOURCE[0]}" )" && pwd )"
+
+cd $DIR
+
+gcc -O2 ./main.c -o ./memoryLayoutBenchmark
+gcc -O2 -DEMU_BIG_ENDIAN_MEMORY ./main.c -o ./memoryLayoutBenchmarkBigEndian
+chmod 777 ./memoryLayoutBenchmark ./memoryLayoutBenchmarkBigEndian
+./memoryLayoutBenchmark
+./memoryLayoutBenchmarkBigEndian
+rm -f ./memoryLayoutBenchmark ./memoryLayoutBenchmarkBigEndian
@@ -0,0 +1,75 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "../../../src/emulator.h"
+#include "../../../src/hardwareRegisters.h"
+#include "../../../src/flx68000.h"
+#include "../../../src/specs/emuFeatureRegisterSpec.h"
+#include "../../../src/specs/dragonballVzRegisterSpec.h"
+
+
+//reads TCN2 after ~20000 cycles, waits ~1000 cycles and reads it again, then stops
+static const uint16_t program[] = {
+   0x0000, 0x1000,//initial SSP
+   0x0000, 0x0008,//initial PC
+   0x343C, 0x07CF,//move.w #1999,d2
+   0x51CA, 0xFFFE,//dbf d2,*
+   0x3038, 0xF618,//move.w (TCN2).w,d0
+   0x343C, 0x0063,//move.w #99,d2
+   0x51CA, 0xFFFE,//dbf d2,*
+   0x3238, 0xF618,//move.w (TCN2).w,d1
+   0x4E72, 0x2700,//stop #0x2700
+   0x60FA//bra.s stop
+};
+
+
+int main(void){
+   buffer_t rom;
+   buffer_t bootloader = {NULL, 0};
+   uint16_t firstRead;
+   uint16_t secondRead;
+   uint32_t index;
+   uint32_t error;
+
+   rom.size = 0x400000;
+   rom.data = calloc(rom.size, 1);
+   if(!rom.data){
+      printf("Cant allocate ROM\n");
+      return 1;
+   }
+   for(index = 0; index < sizeof(program) / sizeof(program[0]); index++){
+      rom.data[index * 2] = program[index] >> 8;
+      rom.data[index * 2 + 1] = program[index] & 0xFF;
+   }
+
+   error = emulatorInit(rom, bootloader, FEATURE_ACCURATE);
+   if(error != EMU_ERROR_NONE){
+      printf("emulatorInit failed, error:%d\n", error);
+      return 1;
+   }
+
+   //timer2 free running from SYSCLK with no prescaler, nothing else that would end the timeslice
+   setHwRegister16(0xFFFFF000 | WATCHDOG, 0x0000);
+   setHwRegister16(0xFFFFF000 | TPRER2, 0x0000);
+   setHwRegister16(0xFFFFF000 | TCMP2, 0xFFFF);
+   setHwRegister16(0xFFFFF000 | TCTL2, 0x0103);
+
+   emulatorRunFrame();
+   firstRead = flx68000GetRegister(0);
+   secondRead = flx68000GetRegister(1);
+   printf("TCN2 reads: 0x%04X, 0x%04X, %d timeslices\n", firstRead, secondRead, palmFrameTimeslices);
+
+   emulatorExit();
+   free(rom.data);
+
+   //the reads are in the same timeslice, both have to show the time the CPU ran before them
+   if(firstRead < 1000 || secondRead <= firstRead){
+      printf("Fail, TCN isnt moving inside a timeslice\n");
+      return 1;
+   }
+
+   printf("Pass\n");
+   return 0;
+}
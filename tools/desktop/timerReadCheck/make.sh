@@ -0,0 +1,16 @@
+#!/bin/bash
+
+# builds and runs the timer counter read check with the same source list as the other build systems, extra CFLAGS can be passed in the CFLAGS environment variable
+
+DIR="$( cd "$( dirname "${BASH_SOURCE[0]}" )" && pwd )"
+EMU_PATH=$DIR/../../../src
+
+cd $DIR
+
+SOURCES=$(sed -n 's/.*\$(EMU_PATH)\/\([^ ]*\.c\).*/\1/p' $EMU_PATH/makefile.all | sed "s|^|$EMU_PATH/|")
+gcc -O2 -DEMU_NO_SAFETY $CFLAGS ./main.c $SOURCES -lm -o ./timerReadCheck
+chmod 777 ./timerReadCheck
+./timerReadCheck
+RESULT=$?
+rm -f ./timerReadCheck
+exit $RESULT